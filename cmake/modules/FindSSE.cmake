@@ -173,4 +173,13 @@ if (ENABLE_SSE)
 
 endif()
 
+if (ENABLE_SIMD_DISPATCH)
+    # Only SSE4.1 is required, wider kernels are selected at runtime
+    set(HAVE_AVX    False)
+    set(HAVE_AVX2   False)
+    set(HAVE_FMA    False)
+    set(HAVE_AVX512 False)
+    message(STATUS "SIMD dispatch is enabled - AVX/AVX2/AVX512 are not required")
+endif()
+
 mark_as_advanced(HAVE_SSE, HAVE_AVX, HAVE_AVX2, HAVE_FMA, HAVE_AVX512)
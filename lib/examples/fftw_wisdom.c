@@ -0,0 +1,190 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Plans the DFTs of all LTE bandwidths and saves the FFTW wisdom, so that the
+ * eNodeB and the UE do not have to measure them at startup. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+#define NOF_BANDWIDTHS 6
+
+uint32_t bandwidths[NOF_BANDWIDTHS] = {6, 15, 25, 50, 75, 100};
+
+char *wisdom_file_name = ".fftw_wisdom";
+bool standard_symbol_size = false;
+
+void usage(char *prog) {
+  printf("Usage: %s [os]\n", prog);
+  printf("\t-o wisdom file [Default %s]\n", wisdom_file_name);
+  printf("\t-s use standard symbol sizes [Default %s]\n", standard_symbol_size?"yes":"no");
+  printf("\t-v srslte_verbose\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "osv")) != -1) {
+    switch(opt) {
+    case 'o':
+      wisdom_file_name = argv[optind];
+      break;
+    case 's':
+      standard_symbol_size = true;
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+/* Plans the OFDM modulator and demodulator of a bandwidth on buffers allocated
+ * like the ones of the PHY, so that the plans have the same alignment */
+static int plan_ofdm(uint32_t nof_prb, srslte_cp_t cp) {
+  srslte_ofdm_t fft, ifft;
+  uint32_t sf_len = SRSLTE_SF_LEN_PRB(nof_prb);
+  uint32_t sf_re  = SRSLTE_SF_LEN_RE(nof_prb, cp);
+  int ret = SRSLTE_ERROR;
+
+  cf_t *td = srslte_vec_malloc(sizeof(cf_t) * sf_len);
+  cf_t *fd = srslte_vec_malloc(sizeof(cf_t) * sf_re);
+  if (!td || !fd) {
+    perror("malloc");
+    goto clean_exit;
+  }
+  bzero(td, sizeof(cf_t) * sf_len);
+  bzero(fd, sizeof(cf_t) * sf_re);
+
+  if (srslte_ofdm_rx_init(&fft, cp, td, fd, nof_prb)) {
+    fprintf(stderr, "Error initializing FFT for %d PRB\n", nof_prb);
+    goto clean_exit;
+  }
+  srslte_ofdm_rx_free(&fft);
+
+  if (srslte_ofdm_tx_init(&ifft, cp, fd, td, nof_prb)) {
+    fprintf(stderr, "Error initializing iFFT for %d PRB\n", nof_prb);
+    goto clean_exit;
+  }
+  srslte_ofdm_tx_free(&ifft);
+  ret = SRSLTE_SUCCESS;
+
+clean_exit:
+  if (td) {
+    free(td);
+  }
+  if (fd) {
+    free(fd);
+  }
+  return ret;
+}
+
+/* Plans the PRACH transforms of a bandwidth. All preamble formats set by the
+ * PRACH configuration index use the same sizes. */
+static int plan_prach(uint32_t nof_prb) {
+  srslte_prach_t prach;
+  uint32_t N_ifft_ul = (uint32_t) srslte_symbol_sz(nof_prb);
+  int ret = SRSLTE_SUCCESS;
+
+  if (srslte_prach_init(&prach, N_ifft_ul)) {
+    fprintf(stderr, "Error initializing PRACH for %d PRB\n", nof_prb);
+    return SRSLTE_ERROR;
+  }
+  if (srslte_prach_set_cell(&prach, N_ifft_ul, 3, 0, false, 1)) {
+    fprintf(stderr, "Error setting PRACH for %d PRB\n", nof_prb);
+    ret = SRSLTE_ERROR;
+  }
+  srslte_prach_free(&prach);
+  return ret;
+}
+
+int main(int argc, char **argv) {
+  struct timeval t[3];
+  srslte_dft_precoding_t precoding;
+  srslte_dft_plan_t plan;
+  uint32_t nof_plans;
+
+  parse_args(argc, argv);
+
+  srslte_use_standard_symbol_size(standard_symbol_size);
+  srslte_dft_set_wisdom_file(wisdom_file_name);
+
+  // Extend the wisdom already in the file
+  srslte_dft_load();
+
+  gettimeofday(&t[1], NULL);
+  for (int i = 0; i < NOF_BANDWIDTHS; i++) {
+    uint32_t nof_prb = bandwidths[i];
+    int symbol_sz = srslte_symbol_sz(nof_prb);
+
+    printf("Planning %3d PRB, symbol size %4d\n", nof_prb, symbol_sz);
+
+    // Single-symbol transforms (PSS, SSS, OFDM without guru)
+    for (int dir = 0; dir < 2; dir++) {
+      if (srslte_dft_plan_c(&plan, symbol_sz, dir?SRSLTE_DFT_BACKWARD:SRSLTE_DFT_FORWARD)) {
+        fprintf(stderr, "Error creating DFT plan of size %d\n", symbol_sz);
+        exit(-1);
+      }
+      srslte_dft_plan_free(&plan);
+    }
+
+    if (plan_ofdm(nof_prb, SRSLTE_CP_NORM) || plan_ofdm(nof_prb, SRSLTE_CP_EXT)) {
+      exit(-1);
+    }
+    if (plan_prach(nof_prb)) {
+      exit(-1);
+    }
+  }
+
+  // SC-FDMA transform precoding of all valid PUSCH allocations
+  if (srslte_dft_precoding_init_tx(&precoding, SRSLTE_MAX_PRB)) {
+    fprintf(stderr, "Error initializing transform precoding\n");
+    exit(-1);
+  }
+  srslte_dft_precoding_free(&precoding);
+  if (srslte_dft_precoding_init_rx(&precoding, SRSLTE_MAX_PRB)) {
+    fprintf(stderr, "Error initializing transform predecoding\n");
+    exit(-1);
+  }
+  srslte_dft_precoding_free(&precoding);
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  srslte_dft_get_nof_plans(&nof_plans, NULL);
+  printf("Planned %d transforms in %.1f s\n", nof_plans, t[0].tv_sec + (float) t[0].tv_usec / 1000000);
+
+  srslte_dft_exit();
+  printf("Saved wisdom to %s\n", wisdom_file_name);
+
+  exit(0);
+}
@@ -0,0 +1,95 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Renders a log written by srslte::logger_binary in binary mode (log.mode =
+ * binary in the eNodeB and UE configuration) as the text log_filter would
+ * have written.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "srslte/common/logger_binary.h"
+
+char *input_file_name  = NULL;
+char *output_file_name = NULL;
+
+void usage(char *prog) {
+  printf("Usage: %s [o] -i input_file\n", prog);
+  printf("\t-o output_file [Default stdout]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "io")) != -1) {
+    switch(opt) {
+    case 'i':
+      input_file_name = argv[optind];
+      break;
+    case 'o':
+      output_file_name = argv[optind];
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (!input_file_name) {
+    usage(argv[0]);
+    exit(-1);
+  }
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  FILE *in = fopen(input_file_name, "r");
+  if (!in) {
+    perror("fopen");
+    exit(-1);
+  }
+  FILE *out = stdout;
+  if (output_file_name) {
+    out = fopen(output_file_name, "w");
+    if (!out) {
+      perror("fopen");
+      exit(-1);
+    }
+  }
+
+  int n = srslte::logger_binary::decode(in, out);
+  fclose(in);
+  if (out != stdout) {
+    fclose(out);
+  }
+  if (n < 0) {
+    fprintf(stderr, "Error: %s is not a complete binary log\n", input_file_name);
+    exit(-1);
+  }
+  fprintf(stderr, "Decoded %d records\n", n);
+  exit(0);
+}
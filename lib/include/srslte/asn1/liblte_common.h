@@ -177,6 +177,14 @@ struct LIBLTE_BIT_MSG_STRUCT{
     }
 };
 
+// Position in a packed buffer (8 bits per byte, MSB first). The same
+// operations as on LIBLTE_BIT_MSG_STRUCT bit arrays are available on it,
+// without the unpack/pack passes and with 1/8th of the memory.
+typedef struct{
+    uint8  *msg;
+    uint32  N_bits;
+}LIBLTE_BIT_CURSOR_STRUCT;
+
 
 /*******************************************************************************
                               DECLARATIONS
@@ -244,4 +252,54 @@ void liblte_align_up(uint8_t **ptr, uint32_t align);
 *********************************************************************/
 void liblte_align_up_zero(uint8_t **ptr, uint32_t align);
 
+/*********************************************************************
+    Name: liblte_bit_cursor_init
+
+    Description: Points a bit cursor to the first bit of a packed
+                 buffer
+*********************************************************************/
+void liblte_bit_cursor_init(LIBLTE_BIT_CURSOR_STRUCT *ptr,
+                            uint8                    *msg);
+
+/*********************************************************************
+    Name: liblte_value_2_bits
+
+    Description: Writes a value to a packed buffer
+*********************************************************************/
+void liblte_value_2_bits(uint32                    value,
+                         LIBLTE_BIT_CURSOR_STRUCT *bits,
+                         uint32                    N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Reads a value from a packed buffer
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_CURSOR_STRUCT *bits,
+                           uint32                    N_bits);
+
+/*********************************************************************
+    Name: liblte_bits_copy
+
+    Description: Writes the first N_bits of a packed buffer
+*********************************************************************/
+void liblte_bits_copy(uint8                    *src,
+                      LIBLTE_BIT_CURSOR_STRUCT *bits,
+                      uint32                    N_bits);
+
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a bit cursor to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_CURSOR_STRUCT *ptr, uint32_t align);
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a bit cursor to a multibit boundary and zeros
+                  bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_CURSOR_STRUCT *ptr, uint32_t align);
+
 #endif // SRSLTE_LIBLTE_COMMON_H
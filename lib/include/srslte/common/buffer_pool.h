@@ -28,8 +28,8 @@
 #define SRSLTE_BUFFER_POOL_H
 
 #include <pthread.h>
+#include <stdio.h>
 #include <vector>
-#include <stack>
 #include <map>
 #include <string>
 #include <algorithm>
@@ -49,42 +49,74 @@ namespace srslte {
  * deallocate functions. Provides quick object creation and deletion as well
  * as object reuse. 
  * Singleton class of byte_buffer_t (but other pools of different type can be created)
+ *
+ * Buffers are stored in a contiguous array of nodes. Each node carries an
+ * intrusive header (freelist link and in-use flag) so deallocate() is O(1).
+ * Free nodes are kept in a lock-free LIFO (tagged head to avoid ABA). If
+ * cache_size is non-zero, each thread also keeps a small private magazine of
+ * free buffers that is refilled from and flushed to the global list in batches,
+ * so most allocate/deallocate calls touch no shared state.
  *****************************************************************************/
 
 template <class buffer_t>
 class buffer_pool{
 public:
-  
+
+  typedef struct {
+    uint32_t capacity;
+    uint32_t nof_used;
+    uint32_t high_watermark;
+    uint64_t nof_hits;    // allocations served from a thread cache
+    uint64_t nof_misses;  // allocations that had to go to the global list
+  } stats_t;
+
   // non-static methods
-  buffer_pool(uint32_t nof_buffers = POOL_SIZE)
+  buffer_pool(uint32_t nof_buffers = POOL_SIZE, uint32_t cache_size_ = 0)
   {
     pthread_mutex_init(&mutex, NULL);
-    for(uint32_t i=0;i<nof_buffers;i++) {
-      buffer_t *b = new buffer_t;
-      available.push(b);
+    capacity       = nof_buffers;
+    nof_used       = 0;
+    high_watermark = 0;
+    nof_misses     = 0;
+    caches         = NULL;
+    cache_size     = cache_size_ > MAX_CACHE_SIZE ? MAX_CACHE_SIZE : cache_size_;
+    if (cache_size) {
+      pthread_key_create(&cache_key, cache_release);
+    }
+    nodes = new node_t[nof_buffers];
+    head  = NIL;
+    for (uint32_t i = 0; i < nof_buffers; i++) {
+      nodes[i].in_use = 0;
+      push_global(nof_buffers - i - 1, nof_buffers - i - 1);
     }
-    capacity = nof_buffers; 
   }
 
   ~buffer_pool() { 
-    // this destructor assumes all buffers have been properly deallocated 
-    while(available.size()) {
-      delete available.top();
-      available.pop();
+    // this destructor assumes no other thread is using the pool
+    if (cache_size) {
+      pthread_key_delete(cache_key);
     }
-
-    for (uint32_t i = 0; i < used.size(); i++) {
-      delete used[i];
+    while (caches) {
+      cache_t *c = caches;
+      caches = c->next_cache;
+      delete c;
     }
+    delete [] nodes;
+    pthread_mutex_destroy(&mutex);
   }
   
   void print_all_buffers()
   {
-    printf("%d buffers in queue\n", (int) used.size());
+    stats_t s = get_stats();
+    printf("%d buffers in queue\n", (int) s.nof_used);
+    printf("pool stats: capacity=%d, high_watermark=%d, hits=%ld, misses=%ld\n",
+           s.capacity, s.high_watermark, (long) s.nof_hits, (long) s.nof_misses);
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
     std::map<std::string, uint32_t> buffer_cnt;
-    for (uint32_t i=0;i<used.size();i++) {
-      buffer_cnt[strlen(used[i]->debug_name)?used[i]->debug_name:"Undefined"]++;
+    for (uint32_t i=0;i<capacity;i++) {
+      if (nodes[i].in_use) {
+        buffer_cnt[strlen(nodes[i].obj.debug_name)?nodes[i].obj.debug_name:"Undefined"]++;
+      }
     }
     std::map<std::string, uint32_t>::iterator it;
     for (it = buffer_cnt.begin(); it != buffer_cnt.end(); it++) {
@@ -94,63 +126,223 @@ public:
   }
 
   bool is_almost_empty() {
-    return available.size() < capacity/20;
+    return capacity - nof_used < capacity/20;
   }
 
-  buffer_t* allocate(const char *debug_name = NULL)
+  stats_t get_stats()
   {
+    stats_t s;
+    s.capacity       = capacity;
+    s.nof_used       = nof_used;
+    s.high_watermark = high_watermark;
+    s.nof_hits       = 0;
+    s.nof_misses     = nof_misses;
     pthread_mutex_lock(&mutex);
-    buffer_t* b = NULL;
-
-    if(available.size() > 0)
-    {
-      b = available.top();
-      used.push_back(b);
-      available.pop();
-      
-      if (is_almost_empty()) {
-        printf("Warning buffer pool capacity is %f %%\n", (float) 100*available.size()/capacity);
-      }
-#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
-    if (debug_name) {
-      strncpy(b->debug_name, debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
-      b->debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN-1] = 0;
+    for (cache_t *c = caches; c != NULL; c = c->next_cache) {
+      s.nof_hits   += c->nof_hits;
+      s.nof_misses += c->nof_misses;
     }
-#endif
-      
+    pthread_mutex_unlock(&mutex);
+    return s;
+  }
+
+  buffer_t* allocate(const char *debug_name = NULL)
+  {
+    uint32_t idx = NIL;
+
+    cache_t *c = get_cache();
+    if (c) {
+      if (c->count == 0) {
+        c->count = pop_global_batch(c->idx, cache_size/2 + 1);
+        c->nof_misses++;
+      } else {
+        c->nof_hits++;
+      }
+      if (c->count > 0) {
+        idx = c->idx[--c->count];
+      }
     } else {
+      idx = pop_global();
+      __sync_fetch_and_add(&nof_misses, 1);
+    }
+
+    if (idx == NIL) {
       printf("Error - buffer pool is empty\n");
-      
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
       print_all_buffers();
 #endif
+      return NULL;
     }
 
-    pthread_mutex_unlock(&mutex);
-    return b;
+    node_t *n = &nodes[idx];
+    n->in_use = 1;
+    update_used(__sync_add_and_fetch(&nof_used, 1));
+
+    if (is_almost_empty()) {
+      printf("Warning buffer pool capacity is %f %%\n", (float) 100*(capacity-nof_used)/capacity);
+    }
+#ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
+    if (debug_name) {
+      strncpy(n->obj.debug_name, debug_name, SRSLTE_BUFFER_POOL_LOG_NAME_LEN);
+      n->obj.debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN-1] = 0;
+    }
+#endif
+    return &n->obj;
   }
   
   bool deallocate(buffer_t *b)
   {
-    bool ret = false; 
-    pthread_mutex_lock(&mutex);
-    typename std::vector<buffer_t*>::iterator elem = std::find(used.begin(), used.end(), b);
-    if (elem != used.end()) {
-      used.erase(elem); 
-      available.push(b);
-      ret = true; 
+    // O(1) check that b belongs to this pool and is currently allocated
+    uint8_t *base = (uint8_t*) &nodes[0].obj;
+    if ((uint8_t*) b < base) {
+      return false;
     }
-    pthread_mutex_unlock(&mutex);
-    return ret; 
+    size_t offset = (uint8_t*) b - base;
+    if (offset % sizeof(node_t) || offset / sizeof(node_t) >= capacity) {
+      return false;
+    }
+    uint32_t idx = offset / sizeof(node_t);
+    if (!__sync_bool_compare_and_swap(&nodes[idx].in_use, 1, 0)) {
+      return false;
+    }
+    __sync_fetch_and_sub(&nof_used, 1);
+
+    cache_t *c = get_cache();
+    if (c) {
+      if (c->count == cache_size) {
+        // Flush half of the magazine to the global list in a single operation
+        uint32_t n = cache_size/2;
+        c->count -= n;
+        push_global_batch(&c->idx[c->count], n);
+      }
+      c->idx[c->count++] = idx;
+    } else {
+      push_global(idx, idx);
+    }
+    return true;
   }
 
   
 private:  
-  static const int       POOL_SIZE = 2048;
-  std::stack<buffer_t*>  available;
-  std::vector<buffer_t*> used; 
-  pthread_mutex_t        mutex;  
-  uint32_t capacity;
+  static const int      POOL_SIZE      = 2048;
+  static const uint32_t MAX_CACHE_SIZE = 64;
+  static const uint32_t NIL            = 0xFFFFFFFF;
+
+  typedef struct {
+    buffer_t          obj;
+    volatile uint32_t next;
+    volatile uint32_t in_use;
+  } node_t;
+
+  struct cache_t {
+    buffer_pool *pool;
+    uint32_t     count;
+    uint32_t     idx[MAX_CACHE_SIZE];
+    uint64_t     nof_hits;
+    uint64_t     nof_misses;
+    cache_t     *next_cache;
+  };
+
+  node_t           *nodes;
+  volatile uint64_t head;   // ABA tag in the upper 32 bits, node index in the lower 32 bits
+  volatile uint32_t nof_used;
+  volatile uint32_t high_watermark;
+  volatile uint64_t nof_misses;
+  uint32_t          capacity;
+  uint32_t          cache_size;
+  pthread_key_t     cache_key;
+  cache_t          *caches;
+  pthread_mutex_t   mutex;   // only protects the list of caches
+
+  // Links nodes first..last (already chained through next) at the top of the global list
+  void push_global(uint32_t first, uint32_t last)
+  {
+    uint64_t old_head, new_head;
+    do {
+      old_head = head;
+      nodes[last].next = (uint32_t) old_head;
+      new_head = (((old_head >> 32) + 1) << 32) | first;
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+  }
+
+  void push_global_batch(uint32_t *idx, uint32_t n)
+  {
+    if (n == 0) {
+      return;
+    }
+    for (uint32_t i = 0; i < n - 1; i++) {
+      nodes[idx[i]].next = idx[i+1];
+    }
+    push_global(idx[0], idx[n-1]);
+  }
+
+  uint32_t pop_global()
+  {
+    uint32_t idx;
+    return pop_global_batch(&idx, 1) ? idx : NIL;
+  }
+
+  // Pops up to max_n nodes with a single CAS. Nodes are never freed while the
+  // pool exists, so walking a stale chain is safe; the tag detects any change.
+  uint32_t pop_global_batch(uint32_t *idx, uint32_t max_n)
+  {
+    uint64_t old_head, new_head;
+    uint32_t n;
+    do {
+      old_head = head;
+      uint32_t next = (uint32_t) old_head;
+      for (n = 0; n < max_n && next != NIL; n++) {
+        idx[n] = next;
+        next   = nodes[next].next;
+      }
+      if (n == 0) {
+        return 0;
+      }
+      new_head = (((old_head >> 32) + 1) << 32) | next;
+    } while (!__sync_bool_compare_and_swap(&head, old_head, new_head));
+    return n;
+  }
+
+  void update_used(uint32_t used)
+  {
+    uint32_t hw = high_watermark;
+    while (used > hw) {
+      if (__sync_bool_compare_and_swap(&high_watermark, hw, used)) {
+        break;
+      }
+      hw = high_watermark;
+    }
+  }
+
+  cache_t* get_cache()
+  {
+    if (!cache_size) {
+      return NULL;
+    }
+    cache_t *c = (cache_t*) pthread_getspecific(cache_key);
+    if (!c) {
+      c = new cache_t;
+      c->pool       = this;
+      c->count      = 0;
+      c->nof_hits   = 0;
+      c->nof_misses = 0;
+      pthread_mutex_lock(&mutex);
+      c->next_cache = caches;
+      caches        = c;
+      pthread_mutex_unlock(&mutex);
+      pthread_setspecific(cache_key, c);
+    }
+    return c;
+  }
+
+  // Called on thread exit: return cached buffers to the global list. The cache
+  // object itself is kept (for its counters) and freed with the pool.
+  static void cache_release(void *arg)
+  {
+    cache_t *c = (cache_t*) arg;
+    c->pool->push_global_batch(c->idx, c->count);
+    c->count = 0;
+  }
 };
 
 
@@ -161,7 +353,7 @@ public:
   static byte_buffer_pool*   get_instance(void);
   static void                cleanup(void); 
   byte_buffer_pool() {
-    pool = new buffer_pool<byte_buffer_t>;
+    pool = new buffer_pool<byte_buffer_t>(POOL_SIZE, CACHE_SIZE);
   }
   ~byte_buffer_pool() {
     delete pool; 
@@ -169,10 +361,20 @@ public:
   byte_buffer_t* allocate(const char *debug_name = NULL) {
     return pool->allocate(debug_name);
   }
+  // Takes an extra reference on b. Each reference is dropped with deallocate()
+  // and the buffer only returns to the pool when the last one is gone.
+  void ref(byte_buffer_t *b) {
+    __sync_fetch_and_add(&b->nof_refs, 1);
+  }
   void deallocate(byte_buffer_t *b) {
     if(!b) {
       return;
     }
+    if (__sync_fetch_and_sub(&b->nof_refs, 1) > 0) {
+      return;
+    }
+    // Last owner, nobody else can touch the count any more
+    b->nof_refs = 0;
     b->reset();
     pool->deallocate(b);
     b = NULL;
@@ -180,7 +382,12 @@ public:
   void print_all_buffers() {
     pool->print_all_buffers();
   }
+  buffer_pool<byte_buffer_t>::stats_t get_stats() {
+    return pool->get_stats();
+  }
 private:
+  static const uint32_t POOL_SIZE  = 2048;
+  static const uint32_t CACHE_SIZE = 16;
   buffer_pool<byte_buffer_t> *pool; 
 };
 
@@ -0,0 +1,206 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_BYTE_BUFFER_LIST_H
+#define SRSLTE_BYTE_BUFFER_LIST_H
+
+#include <vector>
+#include <algorithm>
+
+/*******************************************************************************
+                              INCLUDES
+*******************************************************************************/
+
+#include "srslte/common/common.h"
+#include "srslte/common/buffer_pool.h"
+
+namespace srslte {
+
+/******************************************************************************
+ * Byte buffer list
+ *
+ * Scatter/gather view over one or more pool byte_buffer_t. Each view holds a
+ * reference on the buffer it points into, so the owner of the buffer can
+ * deallocate it as usual and the memory returns to the pool once the last
+ * view is released. Used by RLC to keep the payload of transmitted PDUs
+ * without copying the SDUs, and to gather them into the MAC PDU only once.
+ *
+ * Small pieces can be copied instead with append_copy(). They are packed into
+ * a buffer owned by the list so that many small SDUs do not pin many buffers.
+ *****************************************************************************/
+
+typedef struct {
+  byte_buffer_t *buf;
+  uint8_t       *msg;
+  uint32_t       N_bytes;
+} byte_buffer_view_t;
+
+class byte_buffer_list_t
+{
+public:
+  uint32_t N_bytes;
+
+  byte_buffer_list_t() : N_bytes(0), owned(NULL), pool(NULL) {}
+  byte_buffer_list_t(const byte_buffer_list_t &l) : N_bytes(0), owned(NULL), pool(NULL)
+  {
+    append(l);
+  }
+  byte_buffer_list_t & operator= (const byte_buffer_list_t &l)
+  {
+    // avoid self assignment
+    if (&l == this) {
+      return *this;
+    }
+    clear();
+    append(l);
+    return *this;
+  }
+  ~byte_buffer_list_t()
+  {
+    clear();
+  }
+
+  // Adds len bytes of buf starting at msg. Takes a reference on buf
+  void append(byte_buffer_t *buf, uint8_t *msg, uint32_t len)
+  {
+    if (len == 0) {
+      return;
+    }
+    if (!views.empty()) {
+      byte_buffer_view_t *last = &views.back();
+      if (last->buf == buf && last->msg + last->N_bytes == msg) {
+        last->N_bytes += len;
+        N_bytes       += len;
+        return;
+      }
+    }
+    get_pool()->ref(buf);
+    push_view(buf, msg, len);
+  }
+
+  // Adds all views of another list, taking a reference on each buffer
+  void append(const byte_buffer_list_t &l)
+  {
+    for (uint32_t i = 0; i < l.views.size(); i++) {
+      append(l.views[i].buf, l.views[i].msg, l.views[i].N_bytes);
+    }
+  }
+
+  // Copies len bytes at msg into a buffer owned by the list
+  bool append_copy(uint8_t *msg, uint32_t len)
+  {
+    if (len == 0) {
+      return true;
+    }
+    if (!owned || owned->get_tailroom() < len) {
+      owned = get_pool()->allocate("byte_buffer_list_t");
+      if (!owned) {
+        return false;
+      }
+      memcpy(owned->msg, msg, len);
+      owned->N_bytes = len;
+      // The allocation itself is the reference held by this view
+      push_view(owned, owned->msg, len);
+      return true;
+    }
+    uint8_t *dst = &owned->msg[owned->N_bytes];
+    memcpy(dst, msg, len);
+    owned->N_bytes += len;
+    append(owned, dst, len);
+    return true;
+  }
+
+  // Gathers up to len bytes starting at offset into dst. Returns bytes copied
+  uint32_t read(uint8_t *dst, uint32_t offset, uint32_t len) const
+  {
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < views.size() && n < len; i++) {
+      const byte_buffer_view_t *v = &views[i];
+      if (offset >= v->N_bytes) {
+        offset -= v->N_bytes;
+        continue;
+      }
+      uint32_t to_copy = std::min(v->N_bytes - offset, len - n);
+      memcpy(&dst[n], &v->msg[offset], to_copy);
+      n     += to_copy;
+      offset = 0;
+    }
+    return n;
+  }
+
+  uint32_t nof_views() const
+  {
+    return views.size();
+  }
+
+  // Releases all references. Keeps the capacity of the view list
+  void clear()
+  {
+    for (uint32_t i = 0; i < views.size(); i++) {
+      pool->deallocate(views[i].buf);
+    }
+    views.clear();
+    owned   = NULL;
+    N_bytes = 0;
+  }
+
+  // Exchanges contents without touching the references
+  void swap(byte_buffer_list_t &l)
+  {
+    views.swap(l.views);
+    std::swap(owned, l.owned);
+    std::swap(pool, l.pool);
+    std::swap(N_bytes, l.N_bytes);
+  }
+
+private:
+  // get_instance() takes a lock, so look the pool up once per list
+  byte_buffer_pool* get_pool()
+  {
+    if (!pool) {
+      pool = byte_buffer_pool::get_instance();
+    }
+    return pool;
+  }
+
+  void push_view(byte_buffer_t *buf, uint8_t *msg, uint32_t len)
+  {
+    byte_buffer_view_t v;
+    v.buf     = buf;
+    v.msg     = msg;
+    v.N_bytes = len;
+    views.push_back(v);
+    N_bytes  += len;
+  }
+
+  std::vector<byte_buffer_view_t> views;
+  byte_buffer_t                  *owned;
+  byte_buffer_pool               *pool;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_BYTE_BUFFER_LIST_H
@@ -31,6 +31,7 @@
                               INCLUDES
 *******************************************************************************/
 
+#include <assert.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -110,11 +111,12 @@ public:
     uint32_t    N_bytes;
     uint8_t     buffer[SRSLTE_MAX_BUFFER_SIZE_BYTES];
     uint8_t    *msg;
+    int32_t     nof_refs;   // Extra references held by byte_buffer_list_t views
 #ifdef SRSLTE_BUFFER_POOL_LOG_ENABLED
     char        debug_name[SRSLTE_BUFFER_POOL_LOG_NAME_LEN];
 #endif
 
-    byte_buffer_t():N_bytes(0)
+    byte_buffer_t():N_bytes(0),nof_refs(0)
     {
       timestamp_is_set = false; 
       msg  = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
@@ -123,11 +125,13 @@ public:
       debug_name[0] = 0;
 #endif
     }
-    byte_buffer_t(const byte_buffer_t& buf)
+    byte_buffer_t(const byte_buffer_t& buf):nof_refs(0)
     {
+      msg     = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
       N_bytes = buf.N_bytes;
       memcpy(msg, buf.msg, N_bytes);
     }
+    // Copies the contents only, the references held on this buffer stay as they are
     byte_buffer_t & operator= (const byte_buffer_t & buf)
     {
       // avoid self assignment
@@ -137,8 +141,10 @@ public:
       memcpy(msg, buf.msg, N_bytes);
       return *this;
     }
+    // Must not be called while byte_buffer_list_t views still reference the buffer
     void reset()
     {
+      assert(nof_refs == 0);
       msg       = &buffer[SRSLTE_BUFFER_HEADER_OFFSET];
       N_bytes   = 0;
       timestamp_is_set = false; 
@@ -42,6 +42,7 @@
 #include "srslte/common/log.h"
 #include "srslte/common/logger.h"
 #include "srslte/common/logger_stdout.h"
+#include "srslte/common/logger_binary.h"
 
 namespace srslte {
 
@@ -84,6 +85,10 @@ private:
   logger *logger_h;
   bool    do_tti;
 
+  // Set if logger_h is a logger_binary, which takes the raw arguments
+  logger_binary *binary_h;
+  uint8_t        layer_id;
+
   time_itf      *time_src;
   time_format_t time_format;
 
@@ -92,6 +97,8 @@ private:
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *msg);
   void all_log(srslte::LOG_LEVEL_ENUM level, uint32_t tti, const char *msg, const uint8_t *hex, int size);
   void all_log_line(srslte::LOG_LEVEL_ENUM level, uint32_t tti, std::string file, int line, char *msg);
+  void binary_log(srslte::LOG_LEVEL_ENUM level, const char *message, va_list args,
+                  const uint8_t *hex, int size, bool is_hex);
   std::string now_time();
   std::string hex_string(const uint8_t *hex, int size);
 };
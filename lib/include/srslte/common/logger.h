@@ -37,10 +37,14 @@
 
 namespace srslte {
 
+class logger_binary;
+
 class logger
 {
 public:
   virtual void log(std::string *msg) = 0;
+  // Loggers taking unformatted records return themselves, see logger_binary.h
+  virtual logger_binary* binary() { return NULL; }
 };
 
 } // namespace srslte
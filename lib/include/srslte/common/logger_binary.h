@@ -0,0 +1,181 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        logger_binary.h
+ * Description: Asynchronous logger for real-time threads. log_filter hands
+ *              it the format string and the raw arguments of each message,
+ *              which are stored as a compact binary record in a ring buffer
+ *              owned by the calling thread (single producer, single
+ *              consumer). A background thread drains the rings and either
+ *              formats the records into a text file or stores them as they
+ *              are, to be rendered offline with decode(). Producers never
+ *              block: if their ring is full the record is dropped and
+ *              counted.
+ *
+ *              Format strings are identified by their address, so they must
+ *              be string literals (or otherwise outlive the logger).
+ *****************************************************************************/
+
+#ifndef SRSLTE_LOGGER_BINARY_H
+#define SRSLTE_LOGGER_BINARY_H
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <set>
+#include <string>
+#include <vector>
+#include "srslte/common/log.h"
+#include "srslte/common/logger.h"
+#include "srslte/common/threads.h"
+
+#define SRSLTE_LOGGER_BINARY_RING_SIZE  (1<<20)  // Bytes per producer thread
+#define SRSLTE_LOGGER_BINARY_MAX_RECORD 2048     // Record size limit, hex dumps are truncated
+#define SRSLTE_LOGGER_BINARY_MAX_ARGS   16
+#define SRSLTE_LOGGER_BINARY_MAX_STR    128      // Bytes kept of each %s argument
+#define SRSLTE_LOGGER_BINARY_MAX_LAYERS 256
+
+namespace srslte {
+
+typedef enum {
+  LOG_RECORD_WRAP = 0,  // Rest of the ring is unused, continue at its start
+  LOG_RECORD_MSG,       // Format string id and arguments
+  LOG_RECORD_TEXT,      // Message already formatted by the caller
+  LOG_RECORD_FMT_DEF,   // File only: text of a format string id
+  LOG_RECORD_LAYER_DEF  // File only: name of a layer id
+} log_record_type_t;
+
+// Record flags, taken from the log_filter settings
+#define LOG_RECORD_FLAG_TTI         0x01
+#define LOG_RECORD_FLAG_LAYER       0x02
+#define LOG_RECORD_FLAG_LEVEL_SHORT 0x04
+#define LOG_RECORD_FLAG_EPOCH       0x08
+#define LOG_RECORD_FLAG_HEX         0x10
+#define LOG_RECORD_FLAG_TIME_SRC    0x20  // time_us comes from the log time source
+
+/* Record header. It is followed by nof_args 64-bit argument slots and by
+ * data_len bytes holding, in order, the %s arguments (null terminated, their
+ * slot holds the length) and hex_len bytes of hex dump. Records are padded to
+ * 8 bytes.
+ */
+typedef struct {
+  uint16_t len;
+  uint8_t  type;
+  uint8_t  level;
+  uint8_t  nof_args;
+  uint8_t  layer;
+  uint8_t  flags;
+  uint8_t  reserved;
+  uint16_t data_len;
+  uint16_t hex_len;
+  uint32_t tti;
+  uint64_t time_us;
+  uint64_t fmt;
+} log_record_t;
+
+class logger_binary : public thread, public logger
+{
+public:
+  logger_binary();
+  ~logger_binary();
+
+  // If text is true, records are formatted by the background thread.
+  // Otherwise they are stored in binary form, see decode().
+  bool init(std::string file,
+            bool text = false,
+            int max_length = -1,
+            uint32_t ring_size = SRSLTE_LOGGER_BINARY_RING_SIZE);
+  void stop();
+
+  // logger interface. Strings are stored as TEXT records
+  void log(std::string *msg);
+  void log(const char *msg);
+  logger_binary* binary() { return this; }
+
+  // Called by log_filter
+  uint8_t add_layer(std::string name);
+  void    log_record(uint8_t layer, LOG_LEVEL_ENUM level, uint32_t tti, uint8_t flags,
+                     uint64_t time_us, const char *fmt, va_list args,
+                     const uint8_t *hex, int hex_len);
+
+  uint64_t get_nof_records();
+  uint64_t get_nof_dropped();
+
+  // Renders a file written in binary mode as text. Returns the number of
+  // records or -1 on a malformed file
+  static int decode(FILE *in, FILE *out);
+
+  // Renders one MSG or TEXT record, as log_filter would have done
+  static std::string render(const log_record_t *r, const char *fmt, const char *layer);
+
+private:
+  typedef struct {
+    uint8_t          *buf;
+    uint32_t          mask;
+    volatile uint32_t head;   // Written by the producer only
+    volatile uint32_t tail;   // Written by the consumer only
+    uint64_t          nof_records;
+    uint64_t          nof_dropped;
+    volatile bool     retired;  // Its thread has exited
+  } ring_t;
+
+  void    run_thread();
+  ring_t* get_ring();
+  static void retire_ring(void *r);
+  uint8_t* reserve(ring_t *r);
+  void    commit(ring_t *r, log_record_t *rec);
+  bool    drain();
+  void    write_record(const log_record_t *rec);
+  void    write_def(log_record_type_t type, uint64_t id, const char *str);
+  bool    open_file();
+
+  pthread_key_t         ring_key;
+  pthread_mutex_t       mutex;
+  std::vector<ring_t*>  rings;
+  uint32_t              ring_size;
+
+  std::string           layers[SRSLTE_LOGGER_BINARY_MAX_LAYERS];
+  uint32_t              nof_layers;
+  uint32_t              nof_layers_written;
+  std::set<uint64_t>    fmt_written;
+
+  bool                  text;
+  bool                  inited;
+  volatile bool         running;
+  FILE                 *logfile;
+  std::string           filename;
+  uint32_t              name_idx;
+  int64_t               max_length;
+  int64_t               cur_length;
+  uint64_t              retired_records;
+  uint64_t              retired_dropped;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_LOGGER_BINARY_H
@@ -0,0 +1,109 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#ifndef SRSLTE_PHCH_PIPELINE_H
+#define SRSLTE_PHCH_PIPELINE_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#define SRSLTE_PIPELINE_MAX_STAGES    8
+#define SRSLTE_PIPELINE_MAX_SECTIONS  4
+
+#define SRSLTE_PIPELINE_HIST_BIN_US   250
+#define SRSLTE_PIPELINE_HIST_SZ       17   // Last bin counts everything above 4 ms
+
+namespace srslte {
+
+// Finish times are measured from the end of the subframe reception
+struct pipeline_stage_metrics_t
+{
+  uint32_t nof_ttis;
+  uint32_t nof_late;
+  uint32_t budget_us;
+  float    avg_us;
+  float    max_us;
+  uint32_t hist[SRSLTE_PIPELINE_HIST_SZ];
+};
+
+/* Subframe processing pipeline shared by all PHY workers of the eNodeB or UE.
+ *
+ * Each worker processes one subframe in a fixed list of stages. Stages of
+ * consecutive subframes run concurrently in different workers, except for the
+ * sections that must follow the TTI order, such as the MAC calls and the
+ * transmission to the radio. A worker enters one of these sections for
+ * subframe seq only after the worker of subframe seq-1 has left it.
+ *
+ * The end of every stage is timed from the end of the subframe reception and
+ * compared with its share of the processing budget. Late subframes are counted
+ * and all finish times are collected in a histogram.
+ */
+class phch_pipeline
+{
+public:
+  phch_pipeline();
+  ~phch_pipeline();
+
+  // budget_share[i] is the fraction of budget_us by which stage i has to end. A zero budget selects the default
+  void init(uint32_t nof_stages, const float *budget_share, uint32_t nof_sections, uint32_t budget_us);
+  void stop();
+
+  // Blocks until subframe seq may enter the section. Returns false if the pipeline is stopped
+  bool enter(uint32_t section, uint32_t seq);
+  void leave(uint32_t section, uint32_t seq);
+
+  // Passes all sections that have not been entered yet, used when a subframe is dropped
+  void skip(uint32_t seq, uint32_t first_section);
+
+  // Records the end of a stage. Returns true and the finish time if it missed its budget
+  bool stage_end(uint32_t stage, struct timeval *t_rx, uint32_t *finish_us);
+
+  uint32_t get_budget_us(uint32_t stage);
+
+  // Writes the metrics of every stage since the last call
+  void get_metrics(pipeline_stage_metrics_t *stages);
+
+private:
+  const static uint32_t DEFAULT_BUDGET_US = 3000;
+
+  bool            running;
+  uint32_t        nof_stages;
+  uint32_t        nof_sections;
+  uint32_t        next_seq[SRSLTE_PIPELINE_MAX_SECTIONS];
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+
+  uint32_t        budget_us[SRSLTE_PIPELINE_MAX_STAGES];
+  uint64_t        sum_us[SRSLTE_PIPELINE_MAX_STAGES];
+  pipeline_stage_metrics_t metrics[SRSLTE_PIPELINE_MAX_STAGES];
+  pthread_mutex_t metrics_mutex;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_PHCH_PIPELINE_H
@@ -33,6 +33,7 @@
 
 
 #include "srslte/common/common.h"
+#include "srslte/common/security_aes.h"
 
 
 #define SECURITY_DIRECTION_UPLINK   0
@@ -143,6 +144,57 @@ uint8_t security_128_eea2(uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *msg_out);
 
+/******************************************************************************
+ * Security context
+ *
+ * Keys and algorithms of one PDCP entity or NAS connection. The AES key
+ * schedules of EEA2 and EIA2 are expanded once, when the keys are set.
+ *****************************************************************************/
+
+class security_ctx
+{
+public:
+  security_ctx();
+
+  // k_enc and k_int are 256-bit derived keys, of which the 128 LSBs are used
+  void config(uint8_t                     *k_enc,
+              uint8_t                     *k_int,
+              CIPHERING_ALGORITHM_ID_ENUM  cipher_algo,
+              INTEGRITY_ALGORITHM_ID_ENUM  integ_algo);
+
+  CIPHERING_ALGORITHM_ID_ENUM get_cipher_algo();
+  INTEGRITY_ALGORITHM_ID_ENUM get_integ_algo();
+
+  uint8_t integrity(uint32_t  count,
+                    uint8_t   bearer,
+                    uint8_t   direction,
+                    uint8_t  *msg,
+                    uint32_t  msg_len,
+                    uint8_t  *mac);
+
+  uint8_t cipher(uint32_t  count,
+                 uint8_t   bearer,
+                 uint8_t   direction,
+                 uint8_t  *msg,
+                 uint32_t  msg_len,
+                 uint8_t  *msg_out);
+
+  // Several PDUs per call. EIA2 and EEA2 interleave them in the AES pipeline
+  uint8_t integrity(security_pdu_t *pdus,
+                    uint32_t        nof_pdus);
+
+  uint8_t cipher(security_pdu_t *pdus,
+                 uint32_t        nof_pdus);
+
+private:
+  uint8_t                     k_enc[16];
+  uint8_t                     k_int[16];
+  CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
+  INTEGRITY_ALGORITHM_ID_ENUM integ_algo;
+  security_aes_t              aes_enc;
+  security_aes_t              aes_int;
+};
+
 /******************************************************************************
  * Authentication
  *****************************************************************************/
@@ -0,0 +1,101 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_SECURITY_AES_H
+#define SRSLTE_SECURITY_AES_H
+
+/******************************************************************************
+ * AES-128 for EEA2 (CTR) and EIA2 (CMAC) with a key schedule expanded once
+ * per key. Blocks are encrypted with AES-NI, or with VAES on AVX-512 CPUs,
+ * when the CPU supports them, which is checked at run time. Otherwise a
+ * table based software implementation is used.
+ *
+ * The batch functions process several PDUs per call. Short PDUs are
+ * interleaved so that the AES pipeline is kept full.
+ *****************************************************************************/
+
+#include <stdint.h>
+
+namespace srslte {
+
+typedef enum{
+  SECURITY_AES_IMPL_SOFT = 0,
+  SECURITY_AES_IMPL_AESNI,
+  SECURITY_AES_IMPL_VAES,
+  SECURITY_AES_IMPL_N_ITEMS,
+}security_aes_impl_t;
+static const char security_aes_impl_text[SECURITY_AES_IMPL_N_ITEMS][20] = {"soft",
+                                                                          "AES-NI",
+                                                                          "VAES"};
+
+typedef struct{
+  uint8_t             rk[11*16] __attribute__((aligned(16)));  // Round keys
+  uint8_t             k1[16];                                  // CMAC subkeys
+  uint8_t             k2[16];
+  security_aes_impl_t impl;
+}security_aes_t;
+
+// One PDU of a batch. msg and out may be the same buffer
+typedef struct{
+  uint32_t  count;
+  uint8_t   bearer;
+  uint8_t   direction;
+  uint8_t  *msg;
+  uint32_t  msg_len;  // Bytes
+  uint8_t  *out;      // Cipher text, or the 4-byte MAC
+}security_pdu_t;
+
+// Fastest implementation supported by this CPU
+security_aes_impl_t security_aes_get_impl();
+
+/* Expands the 128-bit key. impl is lowered to what the CPU supports */
+void security_aes_init(security_aes_t       *q,
+                       uint8_t              *key,
+                       security_aes_impl_t   impl = SECURITY_AES_IMPL_N_ITEMS);
+
+void security_aes_encrypt_block(security_aes_t *q,
+                                uint8_t        *in,
+                                uint8_t        *out);
+
+/* AES-CMAC (RFC 4493) of msg_len bytes */
+void security_aes_cmac(security_aes_t *q,
+                       uint8_t        *msg,
+                       uint32_t        msg_len,
+                       uint8_t        *mac);
+
+/* 128-EEA2 (33.401 Annex B.1.3) of every PDU */
+void security_aes_eea2(security_aes_t *q,
+                       security_pdu_t *pdus,
+                       uint32_t        nof_pdus);
+
+/* 128-EIA2 (33.401 Annex B.2.3) of every PDU */
+void security_aes_eia2(security_aes_t *q,
+                       security_pdu_t *pdus,
+                       uint32_t        nof_pdus);
+
+} // namespace srslte
+
+#endif // SRSLTE_SECURITY_AES_H
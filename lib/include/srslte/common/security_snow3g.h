@@ -0,0 +1,85 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_SECURITY_SNOW3G_H
+#define SRSLTE_SECURITY_SNOW3G_H
+
+/******************************************************************************
+ * SNOW 3G for EEA1 (f8) and EIA1 (f9). Unlike the reference code in
+ * snow_3g.h, all the state lives in the context, so any number of threads
+ * may run it at once.
+ *
+ * The S-boxes and the alpha multiplications are read from tables computed
+ * once, and the LFSR is clocked 16 words at a time without shifting it.
+ * The f9 universal hash uses PCLMULQDQ when the CPU supports it, which is
+ * checked at run time.
+ *****************************************************************************/
+
+#include <stdint.h>
+
+namespace srslte {
+
+typedef struct{
+  uint32_t s[16];   // LFSR, s0 to s15
+  uint32_t r1;      // FSM
+  uint32_t r2;
+  uint32_t r3;
+  uint32_t z[16];   // Keystream words generated but not read yet
+  uint32_t nof_z;
+}security_snow3g_t;
+
+/* Loads the 128-bit key and IV and runs the initialization clocks */
+void security_snow3g_init(security_snow3g_t *q,
+                          uint8_t           *key,
+                          uint32_t           iv[4]);
+
+/* Next n words of keystream. Successive calls continue the stream */
+void security_snow3g_keystream(security_snow3g_t *q,
+                               uint32_t          *z,
+                               uint32_t           n);
+
+/* UEA2 f8, out = msg XOR keystream. msg and out may be the same buffer.
+ * Bits of the last byte beyond length are cleared */
+void security_snow3g_f8(uint8_t  *key,
+                        uint32_t  count,
+                        uint32_t  bearer,
+                        uint32_t  dir,
+                        uint8_t  *msg,
+                        uint32_t  length,
+                        uint8_t  *out);
+
+/* UIA2 f9, 32-bit MAC of length bits of msg */
+void security_snow3g_f9(uint8_t  *key,
+                        uint32_t  count,
+                        uint32_t  fresh,
+                        uint32_t  dir,
+                        uint8_t  *msg,
+                        uint64_t  length,
+                        uint8_t  *mac);
+
+} // namespace srslte
+
+#endif // SRSLTE_SECURITY_SNOW3G_H
@@ -24,11 +24,12 @@
  *
  */
 
-
 /******************************************************************************
  *  File:         timers.h
  *  Description:  Manually incremented timers. Call a callback function upon
- *                expiry.
+ *                expiry. Running timers are kept in a hierarchical timing
+ *                wheel so that starting, stopping and expiring a timer is
+ *                O(1) and step_all() only visits the timers that expire.
  *  Reference:
  *****************************************************************************/
 
@@ -39,6 +40,7 @@
 #include <stdint.h>
 #include <vector>
 #include <time.h>
+#include <pthread.h>
 
 namespace srslte {
   
@@ -54,29 +56,46 @@ public:
   class timer
   {
   public:
-    timer(uint32_t id_=0) {id = id_; counter = 0; timeout = 0; running = false; callback = NULL; }
+    timer(uint32_t id_=0) {
+      id = id_; counter = 0; timeout = 0; running = false; callback = NULL;
+      parent = NULL; start = 0; expires = 0; slot = NULL; prev = NULL; next = NULL;
+    }
     void set(timer_callback *callback_, uint32_t timeout_) {
+      lock();
       callback = callback_; 
       timeout = timeout_; 
-      reset();
+      restart();
+      unlock();
     }
     bool is_running() {
-      return (counter < timeout) && running; 
+      lock();
+      bool ret = (elapsed() < timeout) && running;
+      unlock();
+      return ret;
     }
     bool is_expired() {
-      return (timeout > 0) && (counter >= timeout || !running);
+      lock();
+      bool ret = (timeout > 0) && (elapsed() >= timeout || !running);
+      unlock();
+      return ret;
     }
     uint32_t get_timeout() {
       return timeout; 
     }
     void reset() {
-      counter = 0; 
+      lock();
+      restart();
+      unlock();
     }
     uint32_t value() {
-      return counter;
+      lock();
+      uint32_t ret = elapsed();
+      unlock();
+      return ret;
     }
+    // Only for timers not owned by a timers object. Owned timers are stepped by timers::step_all()
     void step() {
-      if (running) {
+      if (running && !parent) {
         counter++;
         if (is_expired()) {
           running = false; 
@@ -87,33 +106,133 @@ public:
       }
     }
     void stop() {
+      lock();
+      if (running && parent) {
+        counter = parent->now - start;
+        parent->unlink(this);
+      }
       running = false; 
+      unlock();
     }
     void run() {
-      running = true; 
+      lock();
+      if (!running) {
+        running = true; 
+        if (parent) {
+          start = parent->now - counter;
+          schedule();
+        }
+      }
+      unlock();
     }
     uint32_t id; 
   private: 
+    friend class timers;
+
+    void lock() {
+      if (parent) {
+        pthread_mutex_lock(&parent->mutex);
+      }
+    }
+    void unlock() {
+      if (parent) {
+        pthread_mutex_unlock(&parent->mutex);
+      }
+    }
+    uint32_t elapsed() {
+      return (parent && running) ? parent->now - start : counter;
+    }
+    void restart() {
+      counter = 0;
+      if (parent) {
+        start = parent->now;
+        if (running) {
+          schedule();
+        }
+      }
+    }
+    void schedule() {
+      parent->unlink(this);
+      if (timeout > 0) {
+        // A timer run past its timeout expires on the next step, as if it was incremented once more
+        expires = (parent->now - start >= timeout) ? parent->now + 1 : start + timeout;
+        parent->link(this);
+      }
+    }
+
     timer_callback *callback; 
     uint32_t timeout; 
     uint32_t counter; 
     bool running; 
+
+    // Timing wheel state, only used for timers owned by a timers object
+    timers  *parent;
+    uint32_t start;
+    uint32_t expires;
+    timer  **slot;
+    timer   *prev;
+    timer   *next;
   };
   
-  timers(uint32_t nof_timers_) : timer_list(nof_timers_),used_timers(nof_timers_) {
+  timers(uint32_t nof_timers_) : timer_list(nof_timers_),free_ids((nof_timers_+63)/64, 0) {
     nof_timers = nof_timers_; 
-    next_timer = 0;
     nof_used_timers = 0;
+    first_free_word = 0;
+    now = 0;
+    pthread_mutex_init(&mutex, NULL);
+    for (uint32_t i=0;i<WHEEL0_SIZE;i++) {
+      wheel0[i] = NULL;
+    }
+    for (uint32_t l=0;l<NOF_LEVELS-1;l++) {
+      for (uint32_t i=0;i<WHEELN_SIZE;i++) {
+        wheeln[l][i] = NULL;
+      }
+    }
     for (uint32_t i=0;i<nof_timers;i++) {
       timer_list[i].id = i;
-      used_timers[i] = false;
+      timer_list[i].parent = this;
+      free_ids[i/64] |= 1ULL << (i%64);
     }
   }
+
+  ~timers() {
+    pthread_mutex_destroy(&mutex);
+  }
   
   void step_all() {
-    for (uint32_t i=0;i<nof_timers;i++) {
-      get(i)->step();
+    pthread_mutex_lock(&mutex);
+    now++;
+
+    // Move the timers of the next slot of each upper level down when the level below wraps around
+    uint32_t idx = now & WHEEL0_MASK;
+    for (uint32_t l=0;l<NOF_LEVELS-1 && idx == 0;l++) {
+      idx = (now >> (WHEEL0_BITS + l*WHEELN_BITS)) & WHEELN_MASK;
+      timer *t = wheeln[l][idx];
+      wheeln[l][idx] = NULL;
+      while (t) {
+        timer *n = t->next;
+        t->slot = NULL;
+        link(t);
+        t = n;
+      }
+    }
+
+    // Expire the timers of the current slot. Callbacks run unlocked so that they can restart timers
+    timer **head = &wheel0[now & WHEEL0_MASK];
+    while (*head) {
+      timer *t = *head;
+      unlink(t);
+      t->counter = now - t->start;
+      t->running = false;
+      timer_callback *callback = t->callback;
+      uint32_t id = t->id;
+      pthread_mutex_unlock(&mutex);
+      if (callback) {
+        callback->timer_expired(id);
+      }
+      pthread_mutex_lock(&mutex);
     }
+    pthread_mutex_unlock(&mutex);
   }
   void stop_all() {
     for (uint32_t i=0;i<nof_timers;i++) {
@@ -139,36 +258,101 @@ public:
     }
   }
   void release_id(uint32_t i) {
-    if (nof_used_timers > 0 && i < nof_timers) {
-      used_timers[i] = false;
+    pthread_mutex_lock(&mutex);
+    if (nof_used_timers > 0 && i < nof_timers && !(free_ids[i/64] & (1ULL << (i%64)))) {
+      free_ids[i/64] |= 1ULL << (i%64);
+      if (i/64 < first_free_word) {
+        first_free_word = i/64;
+      }
       nof_used_timers--;
     } else {
       fprintf(stderr, "Error releasing timer: nof_used_timers=%d, nof_timers=%d\n", nof_used_timers, nof_timers);
     }
+    pthread_mutex_unlock(&mutex);
   }
   uint32_t get_unique_id() {
+    uint32_t id = 0;
+    pthread_mutex_lock(&mutex);
     if (nof_used_timers >= nof_timers) {
       fprintf(stderr, "Error getting unique timer id: no more timers available\n");
-      return 0;
     } else {
-      for (uint32_t i=0;i<nof_timers;i++) {
-        if (!used_timers[i]) {
-          used_timers[i] = true;
-          nof_used_timers++;
-          return i;
-        }
+      while (!free_ids[first_free_word]) {
+        first_free_word++;
       }
-      fprintf(stderr, "Error getting unique timer id: no more timers available but nof_used_timers=%d, nof_timers=%d\n",
-              nof_used_timers, nof_timers);
-      return 0;
+      uint32_t bit = __builtin_ctzll(free_ids[first_free_word]);
+      free_ids[first_free_word] &= ~(1ULL << bit);
+      id = first_free_word*64 + bit;
+      nof_used_timers++;
     }
+    pthread_mutex_unlock(&mutex);
+    return id;
   }
 private:
-  uint32_t next_timer;
+  friend class timer;
+
+  // Level 0 has one slot per tick, each upper level slot spans a whole turn of the level below
+  static const uint32_t NOF_LEVELS  = 4;
+  static const uint32_t WHEEL0_BITS = 8;
+  static const uint32_t WHEEL0_SIZE = 1 << WHEEL0_BITS;
+  static const uint32_t WHEEL0_MASK = WHEEL0_SIZE - 1;
+  static const uint32_t WHEELN_BITS = 6;
+  static const uint32_t WHEELN_SIZE = 1 << WHEELN_BITS;
+  static const uint32_t WHEELN_MASK = WHEELN_SIZE - 1;
+  static const uint32_t MAX_DELTA   = (1u << (WHEEL0_BITS + (NOF_LEVELS-1)*WHEELN_BITS)) - 1;
+
+  timers(const timers&);
+  timers& operator=(const timers&);
+
+  void link(timer *t) {
+    uint32_t delta = t->expires - now;
+    timer  **head;
+    if (delta < WHEEL0_SIZE) {
+      head = &wheel0[t->expires & WHEEL0_MASK];
+    } else {
+      // Timers beyond the last level are parked in its farthest slot and placed again when cascaded
+      uint32_t expires = delta > MAX_DELTA ? now + MAX_DELTA : t->expires;
+      uint32_t l = 0;
+      while (l < NOF_LEVELS-2 && delta >= (1u << (WHEEL0_BITS + (l+1)*WHEELN_BITS))) {
+        l++;
+      }
+      head = &wheeln[l][(expires >> (WHEEL0_BITS + l*WHEELN_BITS)) & WHEELN_MASK];
+    }
+    t->slot = head;
+    t->prev = NULL;
+    t->next = *head;
+    if (*head) {
+      (*head)->prev = t;
+    }
+    *head = t;
+  }
+  void unlink(timer *t) {
+    if (t->slot) {
+      if (t->prev) {
+        t->prev->next = t->next;
+      } else {
+        *t->slot = t->next;
+      }
+      if (t->next) {
+        t->next->prev = t->prev;
+      }
+      t->slot = NULL;
+      t->prev = NULL;
+      t->next = NULL;
+    }
+  }
+
   uint32_t nof_used_timers;
   uint32_t nof_timers;
-  std::vector<timer>   timer_list;
-  std::vector<bool>    used_timers;
+  std::vector<timer>    timer_list;
+  // One bit per id, set while the id is free. The lowest free id is always
+  // handed out first. Words below first_free_word have no free id
+  std::vector<uint64_t> free_ids;
+  uint32_t              first_free_word;
+
+  pthread_mutex_t mutex;
+  uint32_t now;
+  timer   *wheel0[WHEEL0_SIZE];
+  timer   *wheeln[NOF_LEVELS-1][WHEELN_SIZE];
 };
 
 } // namespace srslte
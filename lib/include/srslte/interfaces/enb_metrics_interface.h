@@ -49,6 +49,7 @@ typedef struct {
 typedef struct {
   rf_metrics_t    rf;
   phy_metrics_t   phy[ENB_METRICS_MAX_USERS];
+  phy_pipeline_metrics_t phy_pipeline;
   mac_metrics_t   mac[ENB_METRICS_MAX_USERS];
   rrc_metrics_t   rrc; 
   s1ap_metrics_t  s1ap;
@@ -465,6 +465,8 @@ typedef struct {
   int pdsch_max_its;
   bool attach_enable_64qam; 
   int nof_phy_threads;
+  uint32_t nof_fec_threads;
+  uint32_t pipeline_budget_us;
   
   int worker_cpu_mask;
   int sync_cpu_affinity;
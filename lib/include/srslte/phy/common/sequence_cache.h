@@ -0,0 +1,96 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/**********************************************************************************************
+ *  File:         sequence_cache.h
+ *
+ *  Description:  Cache of per-RNTI PDSCH, PUSCH and PUCCH scrambling sequences, shared by all
+ *                the PHY workers of a cell. Sequences are generated on first use for a given
+ *                (RNTI, subframe, codeword) and least recently used entries are evicted when
+ *                the cache exceeds its memory budget. Entries returned by
+ *                srslte_sequence_cache_get() are reference counted and are not evicted until
+ *                released with srslte_sequence_cache_put().
+ *
+ *  Reference:    3GPP TS 36.211 version 10.0.0 Release 10 Sec. 5.3.1, 5.4.2, 6.3.1
+ *********************************************************************************************/
+
+#ifndef SRSLTE_SEQUENCE_CACHE_H
+#define SRSLTE_SEQUENCE_CACHE_H
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "srslte/config.h"
+#include "srslte/phy/common/sequence.h"
+
+typedef enum SRSLTE_API {
+  SRSLTE_SEQUENCE_CACHE_PDSCH = 0,
+  SRSLTE_SEQUENCE_CACHE_PUSCH,
+  SRSLTE_SEQUENCE_CACHE_PUCCH,
+} srslte_sequence_cache_type_t;
+
+typedef struct srslte_sequence_cache_entry_s srslte_sequence_cache_entry_t;
+
+typedef struct SRSLTE_API {
+  uint32_t cell_id;
+  uint64_t max_bytes;
+
+  /* Statistics */
+  uint64_t nof_bytes;
+  uint32_t nof_entries;
+  uint64_t nof_hits;
+  uint64_t nof_misses;
+  uint64_t nof_evictions;
+
+  srslte_sequence_cache_entry_t **buckets;
+  srslte_sequence_cache_entry_t *lru_head; /* Most recently used */
+  srslte_sequence_cache_entry_t *lru_tail; /* Least recently used */
+
+  pthread_mutex_t mutex;
+} srslte_sequence_cache_t;
+
+SRSLTE_API int srslte_sequence_cache_init(srslte_sequence_cache_t *q,
+                                          uint64_t max_bytes);
+
+SRSLTE_API void srslte_sequence_cache_free(srslte_sequence_cache_t *q);
+
+SRSLTE_API void srslte_sequence_cache_set_cell(srslte_sequence_cache_t *q,
+                                               uint32_t cell_id);
+
+SRSLTE_API srslte_sequence_t *srslte_sequence_cache_get(srslte_sequence_cache_t *q,
+                                                        srslte_sequence_cache_type_t type,
+                                                        uint16_t rnti,
+                                                        uint32_t codeword_idx,
+                                                        uint32_t sf_idx,
+                                                        uint32_t len);
+
+SRSLTE_API void srslte_sequence_cache_put(srslte_sequence_cache_t *q,
+                                          srslte_sequence_t *seq);
+
+SRSLTE_API void srslte_sequence_cache_free_rnti(srslte_sequence_cache_t *q,
+                                                uint16_t rnti);
+
+#endif // SRSLTE_SEQUENCE_CACHE_H
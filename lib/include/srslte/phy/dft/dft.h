@@ -29,6 +29,7 @@
 #define SRSLTE_DFT_H
  
 #include <stdbool.h>
+#include <stdint.h>
 #include "srslte/config.h"
 
 /**********************************************************************************************
@@ -46,6 +47,11 @@
  *                norm   - Normalizes output (by sqrt(len) for complex, len for real).
  *                dc     - Handles insertion and removal of null DC carrier internally.
  *
+ *                FFTW plans are shared by all DFT objects of the process that
+ *                compute the same transform, and run on the buffers of each object.
+ *                They are created the first time a transform is planned, or
+ *                imported from the wisdom file, and are kept until srslte_dft_exit().
+ *
  *  Reference:
  *********************************************************************************************/
 
@@ -64,6 +70,7 @@ typedef struct SRSLTE_API {
   void *out;          // Output buffer
   void *p;            // DFT plan
   bool is_guru;
+  bool is_shared;     // Plan owned by the process-wide plan registry?
   bool forward;       // Forward transform?
   bool mirror;        // Shift negative and positive frequencies?
   bool db;            // Provide output in dB?
@@ -73,10 +80,19 @@ typedef struct SRSLTE_API {
   srslte_dft_mode_t mode;   // Complex/Real
 }srslte_dft_plan_t;
 
+/* Sets the file the FFTW wisdom is imported from by srslte_dft_load() and
+ * exported to by srslte_dft_exit(). NULL or an empty name disables it. */
+SRSLTE_API void srslte_dft_set_wisdom_file(const char *filename);
+
 SRSLTE_API void srslte_dft_load();
 
 SRSLTE_API void srslte_dft_exit();
 
+/* Number of distinct FFTW plans held by the registry and number of plans
+ * requested by DFT objects since the start */
+SRSLTE_API void srslte_dft_get_nof_plans(uint32_t *nof_plans,
+                                         uint32_t *nof_requests);
+
 SRSLTE_API int srslte_dft_plan(srslte_dft_plan_t *plan,
                                int dft_points, 
                                srslte_dft_dir_t dir,                         
@@ -165,6 +165,9 @@ SRSLTE_API int srslte_enb_dl_add_rnti(srslte_enb_dl_t *q,
 SRSLTE_API void srslte_enb_dl_rem_rnti(srslte_enb_dl_t *q, 
                                       uint16_t rnti); 
 
+SRSLTE_API void srslte_enb_dl_set_sequence_cache(srslte_enb_dl_t *q, 
+                                                srslte_sequence_cache_t *cache); 
+
 SRSLTE_API int srslte_enb_dl_put_pdsch(srslte_enb_dl_t *q, 
                                        srslte_ra_dl_grant_t *grant, 
                                        srslte_softbuffer_tx_t *softbuffer[SRSLTE_MAX_CODEWORDS],
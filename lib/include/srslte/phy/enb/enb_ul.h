@@ -119,6 +119,9 @@ SRSLTE_API int srslte_enb_ul_add_rnti(srslte_enb_ul_t *q,
 SRSLTE_API void srslte_enb_ul_rem_rnti(srslte_enb_ul_t *q, 
                                       uint16_t rnti); 
 
+SRSLTE_API void srslte_enb_ul_set_sequence_cache(srslte_enb_ul_t *q, 
+                                                srslte_sequence_cache_t *cache); 
+
 SRSLTE_API int srslte_enb_ul_cfg_ue(srslte_enb_ul_t *q, uint16_t rnti, 
                                     srslte_uci_cfg_t *uci_cfg, 
                                     srslte_pucch_sched_t *pucch_sched,
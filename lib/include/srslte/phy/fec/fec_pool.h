@@ -0,0 +1,113 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/**********************************************************************************************
+ *  File:         fec_pool.h
+ *
+ *  Description:  Pool of threads for forward error correction tasks, shared by all the PHY
+ *                workers. Each thread owns its own turbo decoder, CRC objects and output
+ *                buffer so that the code blocks of a transport block can be decoded
+ *                concurrently. Tasks are grouped in batches; the submitting thread waits
+ *                for the completion of its batch with srslte_fec_pool_wait().
+ *********************************************************************************************/
+
+#ifndef SRSLTE_FEC_POOL_H
+#define SRSLTE_FEC_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "srslte/config.h"
+#include "srslte/phy/fec/crc.h"
+#include "srslte/phy/fec/turbodecoder.h"
+
+#define SRSLTE_FEC_POOL_MAX_WORKERS 16
+#define SRSLTE_FEC_POOL_QUEUE_LEN   64
+
+/* Decoding resources owned by each thread of the pool */
+typedef struct SRSLTE_API {
+  srslte_tdec_t decoder;
+  srslte_crc_t  crc_tb;
+  srslte_crc_t  crc_cb;
+  uint8_t      *cb_in;
+  uint32_t      id;
+  void         *pool;
+} srslte_fec_ctx_t;
+
+typedef void (*srslte_fec_task_fn_t)(void *arg, srslte_fec_ctx_t *ctx);
+
+typedef struct SRSLTE_API {
+  uint32_t nof_pending;
+} srslte_fec_batch_t;
+
+typedef struct SRSLTE_API {
+  srslte_fec_task_fn_t fn;
+  void                *arg;
+  srslte_fec_batch_t  *batch;
+} srslte_fec_task_t;
+
+typedef struct SRSLTE_API {
+  uint32_t          nof_workers;
+  pthread_t         threads[SRSLTE_FEC_POOL_MAX_WORKERS];
+  srslte_fec_ctx_t  ctx[SRSLTE_FEC_POOL_MAX_WORKERS];
+
+  srslte_fec_task_t queue[SRSLTE_FEC_POOL_QUEUE_LEN];
+  uint32_t          head;
+  uint32_t          count;
+  bool              running;
+
+  /* Statistics */
+  uint64_t          nof_tasks;
+  uint64_t          nof_rejected;
+
+  pthread_mutex_t   mutex;
+  pthread_cond_t    cvar_task;
+  pthread_cond_t    cvar_done;
+} srslte_fec_pool_t;
+
+SRSLTE_API int srslte_fec_ctx_init(srslte_fec_ctx_t *ctx);
+
+SRSLTE_API void srslte_fec_ctx_free(srslte_fec_ctx_t *ctx);
+
+SRSLTE_API int srslte_fec_pool_init(srslte_fec_pool_t *q,
+                                    uint32_t nof_workers);
+
+SRSLTE_API void srslte_fec_pool_free(srslte_fec_pool_t *q);
+
+SRSLTE_API uint32_t srslte_fec_pool_nof_workers(srslte_fec_pool_t *q);
+
+SRSLTE_API void srslte_fec_pool_batch_init(srslte_fec_batch_t *batch);
+
+SRSLTE_API int srslte_fec_pool_submit(srslte_fec_pool_t *q,
+                                      srslte_fec_batch_t *batch,
+                                      srslte_fec_task_fn_t fn,
+                                      void *arg);
+
+SRSLTE_API void srslte_fec_pool_wait(srslte_fec_pool_t *q,
+                                     srslte_fec_batch_t *batch);
+
+#endif // SRSLTE_FEC_POOL_H
@@ -63,6 +63,11 @@ typedef struct SRSLTE_API {
 SRSLTE_API int srslte_tdec_init(srslte_tdec_t * h, 
                                 uint32_t max_long_cb);
 
+/* Selects the implementation instead of the highest one the CPU supports */
+SRSLTE_API int srslte_tdec_init_manual(srslte_tdec_t * h, 
+                                       uint32_t max_long_cb, 
+                                       srslte_tdec_impl_t impl);
+
 SRSLTE_API void srslte_tdec_free(srslte_tdec_t * h);
 
 SRSLTE_API int srslte_tdec_reset(srslte_tdec_t * h, 
@@ -76,6 +81,10 @@ SRSLTE_API int srslte_tdec_get_nof_iterations_cb(srslte_tdec_t * h,
 
 SRSLTE_API uint32_t srslte_tdec_get_nof_parallel(srslte_tdec_t * h);
 
+SRSLTE_API srslte_tdec_impl_t srslte_tdec_get_impl(srslte_tdec_t * h);
+
+SRSLTE_API const char *srslte_tdec_impl_string(srslte_tdec_impl_t impl);
+
 SRSLTE_API void srslte_tdec_iteration(srslte_tdec_t * h, 
                                       int16_t* input, 
                                       uint32_t long_cb);
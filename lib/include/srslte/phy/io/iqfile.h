@@ -0,0 +1,145 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         iqfile.h
+ *
+ *  Description:  Memory-mapped IQ capture files.
+ *                A 64-byte header (sample rate, start timestamp, number of
+ *                channels, sample type and layout) is followed by the samples
+ *                of all channels. With block_len = 1 the channels are
+ *                interleaved sample by sample, as written by
+ *                srslte_filesink_write_multi(). With block_len > 1 each
+ *                channel stores block_len consecutive samples in turn, so
+ *                that every channel can be read in place.
+ *                Samples are complex float or complex int16, the latter
+ *                converted to and from float on the fly.
+ *                The header is in host byte order.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSLTE_IQFILE_H
+#define SRSLTE_IQFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "srslte/config.h"
+#include "srslte/phy/common/timestamp.h"
+
+#define SRSLTE_IQFILE_MAGIC       0x51495253 // "SRIQ"
+#define SRSLTE_IQFILE_VERSION     1
+
+// Full scale of complex int16 samples
+#define SRSLTE_IQFILE_SC16_SCALE  32767.0f
+
+typedef enum SRSLTE_API {
+  SRSLTE_IQFILE_CF32 = 0,
+  SRSLTE_IQFILE_SC16
+} srslte_iqfile_type_t;
+
+typedef struct SRSLTE_API {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t header_len;        // Offset of the first sample
+  uint32_t type;              // srslte_iqfile_type_t
+  uint32_t nof_channels;
+  uint32_t block_len;         // Consecutive samples of one channel
+  double   srate;
+  uint64_t start_full_secs;   // Timestamp of the first sample
+  double   start_frac_secs;
+  uint64_t nof_samples;       // Per channel, 0 while the file is being written
+  uint8_t  reserved[8];
+} srslte_iqfile_header_t;
+
+typedef struct SRSLTE_API {
+  srslte_iqfile_header_t hdr;
+  int fd;
+  bool write_mode;
+  uint32_t sample_size;       // Bytes of one sample of one channel
+  uint64_t nof_samples;       // Per channel
+  uint64_t pos;               // Next sample to read, per channel
+
+  // Reader
+  uint8_t *map;
+  size_t map_len;
+  uint8_t *data;
+
+  // Writer: samples are staged in file layout and written in whole blocks
+  uint8_t *staging;
+  uint32_t staging_len;       // Samples per channel
+  uint32_t staging_count;
+} srslte_iqfile_t;
+
+/* Opens a file for reading. A file without header is read as a raw capture
+ * of interleaved complex float samples of raw_nof_channels channels. */
+SRSLTE_API int srslte_iqfile_open(srslte_iqfile_t *q,
+                                  char *filename,
+                                  uint32_t raw_nof_channels);
+
+SRSLTE_API int srslte_iqfile_create(srslte_iqfile_t *q,
+                                    char *filename,
+                                    uint32_t nof_channels,
+                                    srslte_iqfile_type_t type,
+                                    uint32_t block_len,
+                                    double srate,
+                                    srslte_timestamp_t *start);
+
+/* Writes the remaining samples and the final header of a created file */
+SRSLTE_API void srslte_iqfile_close(srslte_iqfile_t *q);
+
+SRSLTE_API uint64_t srslte_iqfile_nof_samples(srslte_iqfile_t *q);
+
+SRSLTE_API void srslte_iqfile_get_start(srslte_iqfile_t *q,
+                                        srslte_timestamp_t *start);
+
+SRSLTE_API int srslte_iqfile_seek(srslte_iqfile_t *q,
+                                  uint64_t sample);
+
+SRSLTE_API uint64_t srslte_iqfile_tell(srslte_iqfile_t *q);
+
+/* Reads up to nsamples of each channel into buffer[0..nof_channels-1],
+ * skipping channels whose buffer is NULL. Returns the number of samples
+ * read per channel, 0 at the end of the file. */
+SRSLTE_API int srslte_iqfile_read(srslte_iqfile_t *q,
+                                  cf_t **buffer,
+                                  int nsamples);
+
+/* Zero-copy read. Points ptr[0..nof_channels-1] to up to nsamples of each
+ * channel, in the sample type of the file, and returns how many. Views end
+ * at block boundaries and are read-only. Not available for interleaved
+ * files of several channels. */
+SRSLTE_API int srslte_iqfile_read_view(srslte_iqfile_t *q,
+                                       void **ptr,
+                                       int nsamples);
+
+SRSLTE_API int srslte_iqfile_write(srslte_iqfile_t *q,
+                                   cf_t **buffer,
+                                   int nsamples);
+
+#endif // SRSLTE_IQFILE_H
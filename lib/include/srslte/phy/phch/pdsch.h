@@ -37,6 +37,7 @@
 
 #include "srslte/config.h"
 #include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/common/sequence_cache.h"
 #include "srslte/phy/mimo/precoding.h"
 #include "srslte/phy/mimo/layermap.h"
 #include "srslte/phy/modem/mod.h"
@@ -85,6 +86,9 @@ typedef struct SRSLTE_API {
   // This is to generate the scrambling seq for multiple CRNTIs
   srslte_pdsch_user_t **users;
 
+  // Shared cell-wide sequence cache (eNodeB only). If set, users is not used
+  srslte_sequence_cache_t *seq_cache;
+
   srslte_sequence_t tmp_seq;
 
   srslte_sch_t dl_sch;
@@ -107,6 +111,9 @@ SRSLTE_API int srslte_pdsch_set_cell(srslte_pdsch_t *q,
 SRSLTE_API int srslte_pdsch_set_rnti(srslte_pdsch_t *q,
                                      uint16_t rnti);
 
+SRSLTE_API void srslte_pdsch_set_sequence_cache(srslte_pdsch_t *q,
+                                                srslte_sequence_cache_t *cache);
+
 SRSLTE_API void srslte_pdsch_set_power_allocation(srslte_pdsch_t *q,
                                                   float rho_a);
 
@@ -165,6 +172,9 @@ SRSLTE_API int srslte_pdsch_cn_compute(srslte_pdsch_t *q,
 SRSLTE_API void srslte_pdsch_set_max_noi(srslte_pdsch_t *q,
                                          uint32_t max_iter);
 
+SRSLTE_API void srslte_pdsch_set_fec_pool(srslte_pdsch_t *q,
+                                          srslte_fec_pool_t *pool);
+
 SRSLTE_API float srslte_pdsch_last_noi(srslte_pdsch_t *q);
 
 SRSLTE_API uint32_t srslte_pdsch_last_noi_cw(srslte_pdsch_t *q,
@@ -42,10 +42,13 @@
 #include "srslte/config.h"
 #include "srslte/phy/dft/dft.h"
 #include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/fec/fec_pool.h"
 
 
 #define SRSLTE_PRACH_MAX_LEN  (2*24576+21024) // Maximum Tcp + Tseq
 
+#define SRSLTE_PRACH_MAX_GROUPS (SRSLTE_FEC_POOL_MAX_WORKERS + 1)
+
 /** Generation and detection of RACH signals for uplink.
  *  Currently only supports preamble formats 0-3.
  *  Does not currently support high speed flag.
@@ -82,23 +85,29 @@ typedef struct SRSLTE_API {
   cf_t *ifft_in;
   cf_t *ifft_out;
   cf_t *prach_bins;
-  cf_t *corr_spec;
-  float *corr;
+  cf_t *corr_spec;            // Correlation spectrum of each root, corr_stride apart
+  float *corr;                // Correlation power of each root, corr_stride apart
+  uint32_t corr_stride;       // N_zc rounded up to keep the rows aligned
 
   // PRACH IFFT
   srslte_dft_plan_t fft;
   srslte_dft_plan_t ifft;
 
-  // ZC-sequence FFT and IFFT
+  // ZC-sequence FFT
   srslte_dft_plan_t zc_fft;
-  srslte_dft_plan_t zc_ifft;
+
+  // Batched in-place IFFT of the correlation rows of each group of roots
+  srslte_dft_plan_t zc_ifft_group[SRSLTE_PRACH_MAX_GROUPS];
+  uint32_t nof_groups;
+  srslte_fec_pool_t *fec_pool;
   
   cf_t *signal_fft; 
   float detect_factor; 
     
   uint32_t deadzone; 
-  float    peak_values[65];
-  uint32_t peak_offsets[65];
+  float    corr_ave[64];
+  float    peak_values[64][65];
+  uint32_t peak_offsets[64][65];
   
 } srslte_prach_t;
 
@@ -170,6 +179,12 @@ SRSLTE_API int srslte_prach_detect_offset(srslte_prach_t *p,
 SRSLTE_API void srslte_prach_set_detect_factor(srslte_prach_t *p, 
                                                float factor); 
 
+/* Spreads the root correlations of srslte_prach_detect_offset() across the
+ * threads of the pool, the calling thread included. NULL runs them all in
+ * the calling thread. */
+SRSLTE_API int srslte_prach_set_fec_pool(srslte_prach_t *p,
+                                         srslte_fec_pool_t *pool);
+
 SRSLTE_API int srslte_prach_free(srslte_prach_t *p);
 
 SRSLTE_API int srslte_prach_print_seqs(srslte_prach_t *p);
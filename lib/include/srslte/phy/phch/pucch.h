@@ -38,6 +38,7 @@
 #include "srslte/config.h"
 #include "srslte/phy/common/phy_common.h"
 #include "srslte/phy/common/sequence.h"
+#include "srslte/phy/common/sequence_cache.h"
 #include "srslte/phy/modem/mod.h"
 #include "srslte/phy/phch/cqi.h"
 #include "srslte/phy/phch/uci.h"
@@ -94,6 +95,9 @@ typedef struct SRSLTE_API {
   
   srslte_pucch_user_t **users;
   
+  // Shared cell-wide sequence cache (eNodeB only). If set, users is not used
+  srslte_sequence_cache_t *seq_cache;
+  
   uint8_t bits_scram[SRSLTE_PUCCH_MAX_BITS];
   cf_t d[SRSLTE_PUCCH_MAX_BITS/2];
   uint32_t n_cs_cell[SRSLTE_NSLOTS_X_FRAME][SRSLTE_CP_NORM_NSYMB]; 
@@ -135,6 +139,9 @@ SRSLTE_API int srslte_pucch_set_crnti(srslte_pucch_t *q,
 SRSLTE_API void srslte_pucch_clear_rnti(srslte_pucch_t *q, 
                                         uint16_t rnti); 
 
+SRSLTE_API void srslte_pucch_set_sequence_cache(srslte_pucch_t *q, 
+                                                srslte_sequence_cache_t *cache); 
+
 SRSLTE_API uint32_t srslte_pucch_nof_symbols(srslte_pucch_cfg_t *cfg, 
                                              srslte_pucch_format_t format, 
                                              bool shortened); 
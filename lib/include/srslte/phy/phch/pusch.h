@@ -37,6 +37,7 @@
 
 #include "srslte/config.h"
 #include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/common/sequence_cache.h"
 #include "srslte/phy/mimo/precoding.h"
 #include "srslte/phy/mimo/layermap.h"
 #include "srslte/phy/modem/mod.h"
@@ -93,6 +94,9 @@ typedef struct SRSLTE_API {
   srslte_pusch_user_t **users;
   srslte_sequence_t tmp_seq;
 
+  // Shared cell-wide sequence cache (eNodeB only). If set, users is not used
+  srslte_sequence_cache_t *seq_cache;
+
   srslte_sch_t ul_sch;
   bool shortened;
   
@@ -123,6 +127,9 @@ SRSLTE_API int srslte_pusch_cfg(srslte_pusch_t             *q,
 SRSLTE_API int srslte_pusch_set_rnti(srslte_pusch_t *q, 
                                      uint16_t rnti);
 
+SRSLTE_API void srslte_pusch_set_sequence_cache(srslte_pusch_t *q,
+                                                srslte_sequence_cache_t *cache);
+
 SRSLTE_API void srslte_pusch_free_rnti(srslte_pusch_t *q,
                                        uint16_t rnti);
 
@@ -41,6 +41,7 @@
 #include "srslte/phy/fec/turbocoder.h"
 #include "srslte/phy/fec/turbodecoder.h"
 #include "srslte/phy/fec/crc.h"
+#include "srslte/phy/fec/fec_pool.h"
 #include "srslte/phy/phch/pdsch_cfg.h"
 #include "srslte/phy/phch/pusch_cfg.h"
 #include "srslte/phy/phch/uci.h"
@@ -74,6 +75,9 @@ typedef struct SRSLTE_API {
   srslte_crc_t crc_cb;
   
   srslte_uci_cqi_pusch_t uci_cqi;
+
+  /* Optional threads for decoding code blocks in parallel */
+  srslte_fec_pool_t *fec_pool;
   
 } srslte_sch_t;
 #include "srslte/phy/phch/pmch.h"
@@ -86,6 +90,9 @@ SRSLTE_API void srslte_sch_free(srslte_sch_t *q);
 SRSLTE_API void srslte_sch_set_max_noi(srslte_sch_t *q, 
                                        uint32_t max_iterations); 
 
+SRSLTE_API void srslte_sch_set_fec_pool(srslte_sch_t *q,
+                                        srslte_fec_pool_t *pool);
+
 SRSLTE_API uint32_t srslte_sch_last_noi(srslte_sch_t *q);
 
 SRSLTE_API int srslte_dlsch_encode(srslte_sch_t *q, 
@@ -59,7 +59,7 @@
 #include "srslte/phy/phch/pbch.h"
 #include "srslte/phy/dft/ofdm.h"
 #include "srslte/phy/common/timestamp.h"
-#include "srslte/phy/io/filesource.h"
+#include "srslte/phy/io/iqfile.h"
 
 
 #define DEFAULT_CFO_BW_PSS  0.05
@@ -94,7 +94,7 @@ typedef struct SRSLTE_API {
   
   uint32_t nof_rx_antennas; 
   
-  srslte_filesource_t file_source; 
+  srslte_iqfile_t file_source;
   bool file_mode; 
   float file_cfo;
   bool file_wrap_enable;
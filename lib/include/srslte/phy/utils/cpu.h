@@ -0,0 +1,143 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         cpu.h
+ *
+ *  Description:  Runtime selection of the SIMD kernel variants.
+ *                The library is built with several variants of its SIMD
+ *                kernels. The level is the highest instruction set that the
+ *                CPU supports, unless it is lowered with the SRSLTE_SIMD
+ *                environment variable or srslte_cpu_set_level(). Each kernel
+ *                group then runs the highest variant built that does not
+ *                exceed the level.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSLTE_CPU_H
+#define SRSLTE_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include "srslte/config.h"
+
+typedef enum SRSLTE_API {
+  SRSLTE_CPU_GENERIC = 0,
+  SRSLTE_CPU_SSE,         // SSE4.1
+  SRSLTE_CPU_AVX,
+  SRSLTE_CPU_AVX2,
+  SRSLTE_CPU_AVX512,      // AVX512F, AVX512DQ and AVX512BW
+  SRSLTE_CPU_NOF_LEVELS
+} srslte_cpu_level_t;
+
+#define SRSLTE_CPU_MASK(level) (1 << (level))
+
+/* Variants built for each kernel group. HAVE_SIMD_* are set by CMake for the
+ * variants of vector_simd.c, which also decide whether the AVX2 turbo and
+ * Viterbi decoders, the AVX precoding kernels and the AVX512 turbo decoder
+ * and rate matching are built. The other variants follow the build flags. */
+#ifdef HAVE_SIMD_GENERIC
+#define SRSLTE_CPU_VEC_GENERIC SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC)
+#else
+#define SRSLTE_CPU_VEC_GENERIC 0
+#endif
+#ifdef HAVE_SIMD_SSE
+#define SRSLTE_CPU_VEC_SSE SRSLTE_CPU_MASK(SRSLTE_CPU_SSE)
+#else
+#define SRSLTE_CPU_VEC_SSE 0
+#endif
+#ifdef HAVE_SIMD_AVX2
+#define SRSLTE_CPU_VEC_AVX2 SRSLTE_CPU_MASK(SRSLTE_CPU_AVX2)
+#else
+#define SRSLTE_CPU_VEC_AVX2 0
+#endif
+#ifdef HAVE_SIMD_AVX512
+#define SRSLTE_CPU_VEC_AVX512 SRSLTE_CPU_MASK(SRSLTE_CPU_AVX512)
+#else
+#define SRSLTE_CPU_VEC_AVX512 0
+#endif
+
+#define SRSLTE_CPU_VARIANTS_VEC (SRSLTE_CPU_VEC_GENERIC | SRSLTE_CPU_VEC_SSE | SRSLTE_CPU_VEC_AVX2 | SRSLTE_CPU_VEC_AVX512)
+
+#ifdef LV_HAVE_SSE
+#define SRSLTE_CPU_VARIANTS_TDEC (SRSLTE_CPU_MASK(SRSLTE_CPU_SSE) | SRSLTE_CPU_VEC_AVX2 | SRSLTE_CPU_VEC_AVX512)
+#define SRSLTE_CPU_VARIANTS_VITERBI (SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC) | SRSLTE_CPU_MASK(SRSLTE_CPU_SSE) | SRSLTE_CPU_VEC_AVX2)
+#else
+#define SRSLTE_CPU_VARIANTS_TDEC SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC)
+#define SRSLTE_CPU_VARIANTS_VITERBI SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC)
+#endif /* LV_HAVE_SSE */
+
+#ifdef LV_HAVE_SSE
+#define SRSLTE_CPU_VARIANTS_SSE (SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC) | SRSLTE_CPU_MASK(SRSLTE_CPU_SSE))
+#else
+#define SRSLTE_CPU_VARIANTS_SSE SRSLTE_CPU_MASK(SRSLTE_CPU_GENERIC)
+#endif /* LV_HAVE_SSE */
+
+/* If the library is not built for AVX, the AVX precoding kernels are built
+ * with the flags of the AVX2 variant and selected as such */
+#ifdef LV_HAVE_AVX
+#define SRSLTE_CPU_VARIANTS_PRECODING (SRSLTE_CPU_VARIANTS_SSE | SRSLTE_CPU_MASK(SRSLTE_CPU_AVX))
+#define SRSLTE_CPU_VARIANTS_RM_TURBO (SRSLTE_CPU_VARIANTS_PRECODING | SRSLTE_CPU_VEC_AVX512)
+#else
+#define SRSLTE_CPU_VARIANTS_PRECODING (SRSLTE_CPU_VARIANTS_SSE | SRSLTE_CPU_VEC_AVX2)
+#define SRSLTE_CPU_VARIANTS_RM_TURBO SRSLTE_CPU_VARIANTS_SSE
+#endif /* LV_HAVE_AVX */
+
+/* Highest level supported by the CPU and the operating system */
+SRSLTE_API srslte_cpu_level_t srslte_cpu_detect();
+
+/* Current level. Read from SRSLTE_SIMD on first use */
+SRSLTE_API srslte_cpu_level_t srslte_cpu_level();
+
+/* Lowers (or restores) the level and rebinds the vector kernels. Levels
+ * above srslte_cpu_detect() are clipped. Call it at startup, before any
+ * PHY object is initialized. Returns the level set. */
+SRSLTE_API srslte_cpu_level_t srslte_cpu_set_level(srslte_cpu_level_t level);
+
+/* Highest variant in the mask not above the current level, or the lowest
+ * variant in the mask if all of them are above it */
+SRSLTE_API srslte_cpu_level_t srslte_cpu_select(uint32_t variants);
+
+/* Parses "generic", "sse", "avx", "avx2", "avx512" or "auto" (the detected
+ * level). Returns -1 if the string is not a level. */
+SRSLTE_API int srslte_cpu_level_parse(const char *str,
+                                      srslte_cpu_level_t *level);
+
+SRSLTE_API const char *srslte_cpu_level_string(srslte_cpu_level_t level);
+
+/* Prints the detected and current levels and the variant of each kernel group */
+SRSLTE_API void srslte_cpu_report(FILE *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SRSLTE_CPU_H
@@ -1,3 +1,16 @@
+/******************************************************************************
+ *  File:         ringbuffer.h
+ *
+ *  Description:  Lock-free single-producer/single-consumer byte ring buffer.
+ *                One thread writes and one thread reads. Only a reader
+ *                waiting for data takes the mutex.
+ *
+ *                A mirrored buffer maps the same memory twice back to back,
+ *                so any range of the buffer is contiguous in memory and the
+ *                acquire/commit views give zero-copy access to all buffered
+ *                data or free space. Without the mirror, views end at the
+ *                wrap-around point.
+ *****************************************************************************/
 
 #ifndef SRSLTE_RINGBUFFER_H
 #define SRSLTE_RINGBUFFER_H
@@ -10,36 +23,72 @@
 typedef struct {
   uint8_t *buffer;
   bool active;
-  int capacity; 
-  int count; 
-  int wpm; 
-  int rpm; 
-  pthread_mutex_t mutex; 
-  pthread_cond_t  cvar; 
-} srslte_ringbuffer_t; 
+  bool mirrored;
+  int capacity;
+
+  // Written by the producer only
+  volatile int wpm;           // Write position in [0, 2*capacity)
+  uint64_t nof_overrun;       // Bytes dropped because the buffer was full
+  uint8_t  pad0[64];
+
+  // Written by the consumer only
+  volatile int rpm;           // Read position in [0, 2*capacity)
+  volatile bool reader_waiting;
+  uint64_t nof_underrun;      // Reads that had to wait for data
+  uint8_t  pad1[64];
+
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+} srslte_ringbuffer_t;
 
 
 SRSLTE_API int  srslte_ringbuffer_init(srslte_ringbuffer_t *q,
                                        int capacity);
 
+/* Capacity is rounded up to a multiple of the page size. Falls back to a
+ * plain buffer, with q->mirrored false, if the mirror cannot be mapped. */
+SRSLTE_API int  srslte_ringbuffer_init_mirrored(srslte_ringbuffer_t *q,
+                                                int capacity);
+
 SRSLTE_API void srslte_ringbuffer_free(srslte_ringbuffer_t *q);
 
+/* Discards all buffered data. It moves the read position, so call it from the
+ * consumer thread only; other threads must ask the consumer to do it. */
 SRSLTE_API void srslte_ringbuffer_reset(srslte_ringbuffer_t *q);
 
 SRSLTE_API int  srslte_ringbuffer_status(srslte_ringbuffer_t *q);
 
 SRSLTE_API int srslte_ringbuffer_space(srslte_ringbuffer_t *q);
 
+/* Never blocks. Writes as much as fits and returns the number of bytes written. */
 SRSLTE_API int  srslte_ringbuffer_write(srslte_ringbuffer_t *q,
                                        void *ptr,
                                        int nof_bytes);
 
+/* Blocks until nof_bytes are buffered. Returns 0 if the buffer is stopped. */
 SRSLTE_API int  srslte_ringbuffer_read(srslte_ringbuffer_t *q,
                                        void *ptr,
                                        int nof_bytes);
 
-SRSLTE_API void srslte_ringbuffer_stop(srslte_ringbuffer_t *q);
+/* Producer view. Returns the number of contiguous free bytes at *ptr. */
+SRSLTE_API int  srslte_ringbuffer_write_acquire(srslte_ringbuffer_t *q,
+                                                void **ptr);
 
-#endif // SRSLTE_RINGBUFFER_H
+SRSLTE_API void srslte_ringbuffer_write_commit(srslte_ringbuffer_t *q,
+                                               int nof_bytes);
+
+/* Consumer view. Blocks until at least min_bytes are buffered, then returns
+ * the number of contiguous buffered bytes at *ptr, which is less than
+ * min_bytes only across the wrap-around of a buffer without mirror.
+ * Returns 0 if the buffer is stopped. */
+SRSLTE_API int  srslte_ringbuffer_read_acquire(srslte_ringbuffer_t *q,
+                                               void **ptr,
+                                               int min_bytes);
 
+SRSLTE_API void srslte_ringbuffer_read_commit(srslte_ringbuffer_t *q,
+                                              int nof_bytes);
 
+/* Wakes up a blocked reader. Reads return 0 afterwards. */
+SRSLTE_API void srslte_ringbuffer_stop(srslte_ringbuffer_t *q);
+
+#endif // SRSLTE_RINGBUFFER_H
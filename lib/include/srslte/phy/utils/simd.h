@@ -1523,6 +1523,30 @@ static inline simd_s_t srslte_simd_convert_2f_s(simd_f_t a, simd_f_t b) {
 #endif /* LV_HAVE_AVX512 */
 }
 
+/* Inverse of srslte_simd_convert_2f_s: the first half of s goes to a, the second half to b */
+static inline void srslte_simd_convert_s_2f(simd_s_t s, simd_f_t *a, simd_f_t *b) {
+#ifdef LV_HAVE_AVX512
+  *a = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm512_castsi512_si256(s)));
+  *b = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(s, 1)));
+#else /* LV_HAVE_AVX512 */
+#ifdef LV_HAVE_AVX2
+  *a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(s)));
+  *b = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(s, 1)));
+#else
+#ifdef LV_HAVE_SSE
+  /* Sign extension without SSE4.1: move each short to the upper half and shift back */
+  *a = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+  *b = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+#else
+#ifdef HAVE_NEON
+  *a = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+  *b = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+#endif /* HAVE_NEON */
+#endif /* LV_HAVE_SSE */
+#endif /* LV_HAVE_AVX2 */
+#endif /* LV_HAVE_AVX512 */
+}
+
 #endif /* SRSLTE_SIMD_F_SIZE && SRSLTE_SIMD_C16_SIZE */
 
 #if SRSLTE_SIMD_B_SIZE
@@ -34,6 +34,7 @@ extern "C" {
 #include <stdio.h>
 #include <stdint.h>
 #include "srslte/config.h"
+#include "srslte/phy/utils/cpu.h"
 
 #ifdef LV_HAVE_AVX512
 #define SRSLTE_SIMD_BIT_ALIGN 512
@@ -54,86 +55,84 @@ extern "C" {
 #endif /* LV_HAVE_AVX512 */
 
 
-/*SIMD Logical operations*/
-SRSLTE_API void srslte_vec_xor_bbb_simd(const int8_t *x, const int8_t *y, int8_t *z, int len);
+/* Table of the kernels of one variant of vector_simd.c. The variant is
+ * built once per instruction set, see srslte/phy/utils/cpu.h */
+typedef struct SRSLTE_API {
+  const char *name;
 
-/* SIMD Basic vector math */
-SRSLTE_API void srslte_vec_sum_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, int len);
+  /*SIMD Logical operations*/
+  void (*xor_bbb)(const int8_t *x, const int8_t *y, int8_t *z, int len);
 
-SRSLTE_API void srslte_vec_sub_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, int len);
+  /* SIMD Basic vector math */
+  void (*sum_sss)(const int16_t *x, const int16_t *y, int16_t *z, int len);
+  void (*sub_sss)(const int16_t *x, const int16_t *y, int16_t *z, int len);
+  float (*acc_ff)(const float *x, int len);
+  cf_t (*acc_cc)(const cf_t *x, int len);
+  void (*add_fff)(const float *x, const float *y, float *z, int len);
+  void (*sub_fff)(const float *x, const float *y, float *z, int len);
 
-SRSLTE_API float srslte_vec_acc_ff_simd(const float *x, int len);
-
-SRSLTE_API cf_t srslte_vec_acc_cc_simd(const cf_t *x, int len);
-
-SRSLTE_API void srslte_vec_add_fff_simd(const float *x, const float *y, float *z, int len);
-
-SRSLTE_API void srslte_vec_sub_fff_simd(const float *x, const float *y, float *z, int len);
-
-/* SIMD Vector Scalar Product */
-SRSLTE_API void srslte_vec_sc_prod_cfc_simd(const cf_t *x, const float h,cf_t *y, const int len);
-
-SRSLTE_API void srslte_vec_sc_prod_fff_simd(const float *x, const float h, float *z, const int len);
-
-SRSLTE_API void srslte_vec_sc_prod_ccc_simd(const cf_t *x, const cf_t h, cf_t *z, const int len);
-
-/* SIMD Vector Product */
-SRSLTE_API void srslte_vec_prod_ccc_split_simd(const float *a_re, const float *a_im, const float *b_re, const float *b_im,
-                                               float *r_re, float *r_im, const int len);
-
-SRSLTE_API void srslte_vec_prod_ccc_c16_simd(const int16_t *a_re, const int16_t *a_im, const int16_t *b_re, const int16_t *b_im,
-                                             int16_t *r_re, int16_t *r_im, const int len);
-
-SRSLTE_API void srslte_vec_prod_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len);
-
-SRSLTE_API void srslte_vec_prod_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len);
-
-SRSLTE_API void srslte_vec_prod_fff_simd(const float *x, const float *y, float *z, const int len);
-
-SRSLTE_API void srslte_vec_prod_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len);
-
-SRSLTE_API void srslte_vec_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len);
-
-/* SIMD Division */
-SRSLTE_API void srslte_vec_div_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len);
-
-SRSLTE_API void srslte_vec_div_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len);
-
-SRSLTE_API void srslte_vec_div_fff_simd(const float *x, const float *y, float *z, const int len);
-
-/* SIMD Dot product */
-SRSLTE_API cf_t srslte_vec_dot_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, const int len);
-
-SRSLTE_API cf_t srslte_vec_dot_prod_ccc_simd(const cf_t *x, const cf_t *y, const int len);
+  /* SIMD Vector Scalar Product */
+  void (*sc_prod_cfc)(const cf_t *x, const float h, cf_t *y, const int len);
+  void (*sc_prod_fff)(const float *x, const float h, float *z, const int len);
+  void (*sc_prod_ccc)(const cf_t *x, const cf_t h, cf_t *z, const int len);
 
+  /* SIMD Vector Product */
+  void (*prod_ccc_split)(const float *a_re, const float *a_im, const float *b_re, const float *b_im,
+                         float *r_re, float *r_im, const int len);
 #ifdef ENABLE_C16
-SRSLTE_API c16_t srslte_vec_dot_prod_ccc_c16i_simd(const c16_t *x, const c16_t *y, const int len);
+  void (*prod_ccc_c16)(const int16_t *a_re, const int16_t *a_im, const int16_t *b_re, const int16_t *b_im,
+                       int16_t *r_re, int16_t *r_im, const int len);
 #endif /* ENABLE_C16 */
-
-SRSLTE_API int srslte_vec_dot_prod_sss_simd(const int16_t *x, const int16_t *y, const int len);
-
-/* SIMD Modulus functions */
-SRSLTE_API void srslte_vec_abs_cf_simd(const cf_t *x, float *z, const int len);
-
-SRSLTE_API void srslte_vec_abs_square_cf_simd(const cf_t *x, float *z, const int len);
-
-/* Other Functions */
-SRSLTE_API void srslte_vec_lut_sss_simd(const short *x, const unsigned short *lut, short *y, const int len);
-
-SRSLTE_API void srslte_vec_convert_if_simd(const int16_t *x, float *z, const float scale, const int len);
-
-SRSLTE_API void srslte_vec_convert_fi_simd(const float *x, int16_t *z, const float scale, const int len);
-
-SRSLTE_API void srslte_vec_cp_simd(const cf_t *src, cf_t *dst, int len);
-
-SRSLTE_API void srslte_vec_interleave_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len);
-
-SRSLTE_API void srslte_vec_interleave_add_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len);
-
-/* SIMD Find Max functions */
-SRSLTE_API uint32_t srslte_vec_max_fi_simd(const float *x, const int len);
-
-SRSLTE_API uint32_t srslte_vec_max_ci_simd(const cf_t *x, const int len);
+  void (*prod_sss)(const int16_t *x, const int16_t *y, int16_t *z, const int len);
+  void (*prod_cfc)(const cf_t *x, const float *y, cf_t *z, const int len);
+  void (*prod_fff)(const float *x, const float *y, float *z, const int len);
+  void (*prod_ccc)(const cf_t *x, const cf_t *y, cf_t *z, const int len);
+  void (*prod_conj_ccc)(const cf_t *x, const cf_t *y, cf_t *z, const int len);
+
+  /* SIMD Division */
+  void (*div_ccc)(const cf_t *x, const cf_t *y, cf_t *z, const int len);
+  void (*div_cfc)(const cf_t *x, const float *y, cf_t *z, const int len);
+  void (*div_fff)(const float *x, const float *y, float *z, const int len);
+
+  /* SIMD Dot product */
+  cf_t (*dot_prod_conj_ccc)(const cf_t *x, const cf_t *y, const int len);
+  cf_t (*dot_prod_ccc)(const cf_t *x, const cf_t *y, const int len);
+#ifdef ENABLE_C16
+  c16_t (*dot_prod_ccc_c16i)(const c16_t *x, const c16_t *y, const int len);
+#endif /* ENABLE_C16 */
+  int (*dot_prod_sss)(const int16_t *x, const int16_t *y, const int len);
+
+  /* SIMD Modulus functions */
+  void (*abs_cf)(const cf_t *x, float *z, const int len);
+  void (*abs_square_cf)(const cf_t *x, float *z, const int len);
+
+  /* Other Functions */
+  void (*lut_sss)(const short *x, const unsigned short *lut, short *y, const int len);
+  void (*convert_if)(const int16_t *x, float *z, const float scale, const int len);
+  void (*convert_fi)(const float *x, int16_t *z, const float scale, const int len);
+  void (*cp)(const cf_t *src, cf_t *dst, int len);
+  void (*interleave)(const cf_t *x, const cf_t *y, cf_t *z, const int len);
+  void (*interleave_add)(const cf_t *x, const cf_t *y, cf_t *z, const int len);
+
+  /* SIMD Find Max functions */
+  uint32_t (*max_fi)(const float *x, const int len);
+  uint32_t (*max_ci)(const cf_t *x, const int len);
+} srslte_vec_simd_t;
+
+SRSLTE_API extern const srslte_vec_simd_t srslte_vec_simd_generic;
+SRSLTE_API extern const srslte_vec_simd_t srslte_vec_simd_sse;
+SRSLTE_API extern const srslte_vec_simd_t srslte_vec_simd_avx2;
+SRSLTE_API extern const srslte_vec_simd_t srslte_vec_simd_avx512;
+SRSLTE_API extern const srslte_vec_simd_t srslte_vec_simd_native;
+
+/* Variant the srslte_vec_* functions are bound to */
+SRSLTE_API const srslte_vec_simd_t *srslte_vec_simd();
+
+/* Variant built for the given level, NULL if it was not built */
+SRSLTE_API const srslte_vec_simd_t *srslte_vec_simd_get(srslte_cpu_level_t level);
+
+/* Binds the srslte_vec_* functions to the variant for srslte_cpu_level() */
+SRSLTE_API void srslte_vec_simd_bind();
 
 #ifdef __cplusplus
 }
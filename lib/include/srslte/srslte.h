@@ -44,9 +44,11 @@
 #include "srslte/phy/utils/debug.h"
 #include "srslte/phy/utils/cexptab.h"
 #include "srslte/phy/utils/vector.h"
+#include "srslte/phy/utils/cpu.h"
 
 #include "srslte/phy/common/timestamp.h"
 #include "srslte/phy/common/sequence.h"
+#include "srslte/phy/common/sequence_cache.h"
 #include "srslte/phy/common/phy_common.h"
 #include "srslte/phy/common/phy_logger.h"
             
@@ -70,6 +72,7 @@
 #include "srslte/phy/fec/cbsegm.h"
 #include "srslte/phy/fec/rm_conv.h"
 #include "srslte/phy/fec/rm_turbo.h"
+#include "srslte/phy/fec/fec_pool.h"
 
 #include "srslte/phy/dft/dft_precoding.h"
 #include "srslte/phy/dft/ofdm.h"
@@ -78,6 +81,7 @@
 #include "srslte/phy/io/binsource.h"
 #include "srslte/phy/io/filesink.h"
 #include "srslte/phy/io/filesource.h"
+#include "srslte/phy/io/iqfile.h"
 #include "srslte/phy/io/netsink.h"
 #include "srslte/phy/io/netsource.h"
 
@@ -104,11 +104,7 @@ private:
 
   uint32_t            rx_count;
   uint32_t            tx_count;
-  uint8_t             k_enc[32];
-  uint8_t             k_int[32];
-
-  CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
-  INTEGRITY_ALGORITHM_ID_ENUM integ_algo;
+  security_ctx        sec_ctx;
 
   void integrity_generate(uint8_t  *msg,
                           uint32_t  msg_len,
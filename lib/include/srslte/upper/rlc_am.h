@@ -28,6 +28,7 @@
 #define SRSLTE_RLC_AM_H
 
 #include "srslte/common/buffer_pool.h"
+#include "srslte/common/byte_buffer_list.h"
 #include "srslte/common/log.h"
 #include "srslte/common/common.h"
 #include "srslte/interfaces/ue_interfaces.h"
@@ -53,7 +54,7 @@ struct rlc_amd_rx_pdu_segments_t{
 
 struct rlc_amd_tx_pdu_t{
   rlc_amd_pdu_header_t  header;
-  byte_buffer_t        *buf;
+  byte_buffer_list_t    buf;      // PDU payload, referencing the SDU buffers
   uint32_t              retx_count;
   bool                  is_acked;
 };
@@ -180,6 +181,7 @@ private:
   int  build_retx_pdu(uint8_t *payload, uint32_t nof_bytes);
   int  build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t retx);
   int  build_data_pdu(uint8_t *payload, uint32_t nof_bytes);
+  void append_sdu_segment(byte_buffer_list_t *pdu, uint32_t len);
 
   void handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t &header);
   void handle_data_pdu_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t &header);
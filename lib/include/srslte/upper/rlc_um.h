@@ -28,6 +28,7 @@
 #define SRSLTE_RLC_UM_H
 
 #include "srslte/common/buffer_pool.h"
+#include "srslte/common/byte_buffer_list.h"
 #include "srslte/common/log.h"
 #include "srslte/common/common.h"
 #include "srslte/interfaces/ue_interfaces.h"
@@ -91,6 +92,7 @@ private:
   // TX SDU buffers
   msg_queue           tx_sdu_queue;
   byte_buffer_t      *tx_sdu;
+  byte_buffer_list_t  tx_pdu;    // SDU segments of the PDU being built
 
   // Rx window
   std::map<uint32_t, rlc_umd_pdu_t>  rx_window;
@@ -145,6 +147,7 @@ private:
 void        rlc_um_read_data_pdu_header(byte_buffer_t *pdu, rlc_umd_sn_size_t sn_size, rlc_umd_pdu_header_t *header);
 void        rlc_um_read_data_pdu_header(uint8_t *payload, uint32_t nof_bytes, rlc_umd_sn_size_t sn_size, rlc_umd_pdu_header_t *header);
 void        rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *pdu);
+void        rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, uint8_t **payload);
 
 uint32_t    rlc_um_packed_length(rlc_umd_pdu_header_t *header);
 bool        rlc_um_start_aligned(uint8_t fi);
@@ -196,3 +196,120 @@ void liblte_align_up_zero(uint8_t **ptr, uint32_t align)
     (*ptr)++;
   }
 }
+
+/*********************************************************************
+    Name: liblte_bit_cursor_init
+
+    Description: Points a bit cursor to the first bit of a packed
+                 buffer
+*********************************************************************/
+void liblte_bit_cursor_init(LIBLTE_BIT_CURSOR_STRUCT *ptr,
+                            uint8                    *msg)
+{
+  ptr->msg    = msg;
+  ptr->N_bits = 0;
+}
+
+/*********************************************************************
+    Name: liblte_value_2_bits
+
+    Description: Writes a value to a packed buffer, a byte at a time.
+                 Bits of the buffer outside the value are preserved
+*********************************************************************/
+void liblte_value_2_bits(uint32                    value,
+                         LIBLTE_BIT_CURSOR_STRUCT *bits,
+                         uint32                    N_bits)
+{
+  while(N_bits > 0)
+  {
+    uint8  *byte  = &bits->msg[bits->N_bits/8];
+    uint32  free  = 8 - bits->N_bits%8;
+    uint32  n     = (N_bits < free) ? N_bits : free;
+    uint32  chunk = 0;
+
+    // Values are at most 32 bits wide, anything above is zero
+    N_bits -= n;
+    if(N_bits < 32)
+    {
+      chunk = (value >> N_bits) & ((1 << n) - 1);
+    }
+    uint8 mask = ((1 << n) - 1) << (free - n);
+    *byte = (*byte & ~mask) | (chunk << (free - n));
+    bits->N_bits += n;
+  }
+}
+
+/*********************************************************************
+    Name: liblte_bits_2_value
+
+    Description: Reads a value from a packed buffer
+*********************************************************************/
+uint32 liblte_bits_2_value(LIBLTE_BIT_CURSOR_STRUCT *bits,
+                           uint32                    N_bits)
+{
+  uint32 value = 0;
+
+  while(N_bits > 0)
+  {
+    uint8  byte = bits->msg[bits->N_bits/8];
+    uint32 free = 8 - bits->N_bits%8;
+    uint32 n    = (N_bits < free) ? N_bits : free;
+
+    value         = (value << n) | ((byte >> (free - n)) & ((1 << n) - 1));
+    N_bits       -= n;
+    bits->N_bits += n;
+  }
+
+  return(value);
+}
+
+/*********************************************************************
+    Name: liblte_bits_copy
+
+    Description: Writes the first N_bits of a packed buffer
+*********************************************************************/
+void liblte_bits_copy(uint8                    *src,
+                      LIBLTE_BIT_CURSOR_STRUCT *bits,
+                      uint32                    N_bits)
+{
+  uint32 i;
+
+  if(bits->N_bits%8 == 0)
+  {
+    memcpy(&bits->msg[bits->N_bits/8], src, N_bits/8);
+    bits->N_bits += N_bits/8*8;
+  }
+  else
+  {
+    for(i=0; i<N_bits/8; i++)
+    {
+      liblte_value_2_bits(src[i], bits, 8);
+    }
+  }
+  if(N_bits%8 > 0)
+  {
+    liblte_value_2_bits(src[N_bits/8] >> (8 - N_bits%8), bits, N_bits%8);
+  }
+}
+
+/*********************************************************************
+    Name: liblte_align_up
+
+    Description: Aligns a bit cursor to a multibit boundary
+*********************************************************************/
+void liblte_align_up(LIBLTE_BIT_CURSOR_STRUCT *ptr, uint32_t align)
+{
+  ptr->N_bits = (ptr->N_bits + align - 1) / align * align;
+}
+
+/*********************************************************************
+    Name: liblte_align_up_zero
+
+    Description:  Aligns a bit cursor to a multibit boundary and zeros
+                  bits skipped
+*********************************************************************/
+void liblte_align_up_zero(LIBLTE_BIT_CURSOR_STRUCT *ptr, uint32_t align)
+{
+  uint32 aligned = (ptr->N_bits + align - 1) / align * align;
+  liblte_value_2_bits(0, ptr, aligned - ptr->N_bits);
+}
@@ -75,12 +75,6 @@
 *******************************************************************************/
 
 
-/*******************************************************************************
-                              GLOBAL VARIABLES
-*******************************************************************************/
-
-LIBLTE_BIT_MSG_STRUCT global_msg;
-
 /*******************************************************************************
                               HELPERS
 *******************************************************************************/
@@ -116,7 +110,7 @@ static void liblte_rrc_log_print(const char *format, ...) {
 /*********************************************************************
     Description: Simply consume non-critical extensions for rel > r8
 *********************************************************************/
-void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, uint8 **ie_ptr)
+void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
   uint32 i=0;
   uint32 elem_flags=0;
@@ -144,7 +138,7 @@ void liblte_rrc_consume_noncrit_extension(bool ext, const char *func_name, uint8
                 elem_len = 0;
             }
         }
-        liblte_bits_2_value(ie_ptr, 8*elem_len);
+        ie_ptr->N_bits += 8*elem_len;
       }
       elem_flags = elem_flags >> 1;
     }
@@ -161,6 +155,36 @@ void liblte_rrc_warning_not_handled(bool opt, const char *func_name)
   }
 }
 
+/*********************************************************************
+    Description: Conversions between the packed buffers the messages
+                 are coded on and the bit arrays of the
+                 LIBLTE_BIT_MSG_STRUCT PDU functions. The last byte
+                 is MSB aligned and zero padded, as on the air
+*********************************************************************/
+static void liblte_rrc_bits_2_bytes(LIBLTE_BIT_MSG_STRUCT  *bits,
+                                    LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+  uint32  n_bytes = bits->N_bits/8;
+  uint32  n_rem   = bits->N_bits%8;
+  uint8  *bit_ptr = &bits->msg[n_bytes*8];
+
+  liblte_pack(bits->msg, n_bytes*8, bytes->msg);
+  if(n_rem > 0)
+  {
+    bytes->msg[n_bytes] = liblte_bits_2_value(&bit_ptr, n_rem) << (8 - n_rem);
+    n_bytes++;
+  }
+  bytes->N_bytes = n_bytes;
+}
+
+static void liblte_rrc_bytes_2_bits(LIBLTE_BIT_CURSOR_STRUCT *ptr,
+                                    LIBLTE_BIT_MSG_STRUCT    *bits)
+{
+  bits->N_bits = ptr->N_bits;
+  liblte_align_up_zero(ptr, 8);
+  liblte_unpack(ptr->msg, ptr->N_bits/8, bits->msg);
+}
+
 /*******************************************************************************
                               INFORMATION ELEMENT FUNCTIONS
 *******************************************************************************/
@@ -174,7 +198,7 @@ void liblte_rrc_warning_not_handled(bool opt, const char *func_name)
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -190,7 +214,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_notification_config_ie(LIBLTE_RRC_MBSFN_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_MBSFN_NOTIFICATION_CONFIG_STRUCT  *mbsfn_notification_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -218,7 +242,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_notification_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -242,7 +266,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_area_info_ie(LIBLTE_RRC_MBSFN_AREA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_MBSFN_AREA_INFO_STRUCT  *mbsfn_area_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -280,7 +304,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_area_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.7
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -302,7 +326,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mbsfn_subframe_config_ie(LIBLTE_RRC_MBSFN_SUBF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_MBSFN_SUBFRAME_CONFIG_STRUCT  *mbsfn_subfr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -343,7 +367,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mbsfn_subframe_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
-                                            uint8  **ie_ptr)
+                                            LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -356,7 +380,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_c_rnti_ie(uint16   rnti,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                               uint16  *rnti)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -381,7 +405,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_c_rnti_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_cdma2000,
-                                                             uint8                         **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -411,7 +435,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_cdma2000_ie(LIBLTE_SIMPLE_BYTE_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                                LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -453,7 +477,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_nas,
-                                                        uint8                         **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -483,7 +507,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_dedicated_info_nas_ie(LIBLTE_SIMPLE_BYTE_MSG_S
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                           LIBLTE_SIMPLE_BYTE_MSG_STRUCT  *ded_info_nas)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -524,7 +548,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dedicated_info_nas_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFICIENT_ENUM   filter_coeff,
-                                                        uint8                              **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -540,7 +564,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_filter_coefficient_ie(LIBLTE_RRC_FILTER_COEFFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                           LIBLTE_RRC_FILTER_COEFFICIENT_ENUM  *filter_coeff)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -570,7 +594,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_filter_coefficient_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
-                                          uint8 **ie_ptr)
+                                          LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -583,7 +607,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mmec_ie(uint8   mmec,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                             uint8  *mmec)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -608,7 +632,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mmec_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config,
-                                                       uint8 **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -621,7 +645,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_neigh_cell_config_ie(uint8   neigh_cell_config
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                          uint8  *neigh_cell_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -645,7 +669,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_neigh_cell_config_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg,
-                                                  uint8                             **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -680,7 +704,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_other_config_ie(LIBLTE_RRC_OTHER_CONFIG_R9_STR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                     LIBLTE_RRC_OTHER_CONFIG_R9_STRUCT  *other_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -728,7 +752,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_other_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
-                                                         uint8  **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -741,7 +765,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rand_cdma2000_1xrtt_ie(uint32   rand,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                            uint32  *rand)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -767,7 +791,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rand_cdma2000_1xrtt_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_type,
-                                              uint8                    **ie_ptr)
+                                              LIBLTE_BIT_CURSOR_STRUCT  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -783,7 +807,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rat_type_ie(LIBLTE_RRC_RAT_TYPE_ENUM   rat_typ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(LIBLTE_BIT_CURSOR_STRUCT  *ie_ptr,
                                                 LIBLTE_RRC_RAT_TYPE_ENUM  *rat_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -813,7 +837,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rat_type_ie(uint8                    **ie_pt
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_transaction_id,
-                                                                uint8 **ie_ptr)
+                                                                LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -826,7 +850,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_transaction_identifier_ie(uint8   rrc_tran
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                   uint8  *rrc_transaction_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -852,7 +876,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_transaction_identifier_ie(uint8 **ie_ptr
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
-                                            uint8                    **ie_ptr)
+                                            LIBLTE_BIT_CURSOR_STRUCT  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -867,7 +891,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_tmsi_ie(LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(LIBLTE_BIT_CURSOR_STRUCT  *ie_ptr,
                                               LIBLTE_RRC_S_TMSI_STRUCT  *s_tmsi)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -903,7 +927,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_tmsi_ie(uint8                    **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -934,7 +958,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_params_ie(LIBLTE_RRC_PDCP_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                    LIBLTE_RRC_PDCP_PARAMS_STRUCT  *pdcp_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -969,7 +993,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -985,7 +1009,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phy_layer_params_ie(LIBLTE_RRC_PHY_LAYER_PARAM
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_PHY_LAYER_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1003,7 +1027,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phy_layer_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *params,
-                                               uint8                       **ie_ptr)
+                                               LIBLTE_BIT_CURSOR_STRUCT     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1024,7 +1048,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rf_params_ie(LIBLTE_RRC_RF_PARAMS_STRUCT  *par
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(LIBLTE_BIT_CURSOR_STRUCT     *ie_ptr,
                                                  LIBLTE_RRC_RF_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1047,7 +1071,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rf_params_ie(uint8                       **i
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1070,7 +1094,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_info_eutra_ie(LIBLTE_RRC_BAND_INFO_EUTRA_
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_BAND_INFO_EUTRA_STRUCT  *info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1095,7 +1119,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_info_eutra_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1115,7 +1139,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_params_ie(LIBLTE_RRC_MEAS_PARAMS_STRUCT
     return(err);
 }
 
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                    LIBLTE_RRC_MEAS_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1137,7 +1161,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1152,7 +1176,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_inter_rat_params_ie(LIBLTE_RRC_INTER_RAT_PARAM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_INTER_RAT_PARAMS_STRUCT  *params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1176,42 +1200,38 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_inter_rat_params_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_eutra_capability_ie(LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *ue_eutra_capability,
-                                                         LIBLTE_BIT_MSG_STRUCT                 *msg)
+                                                         LIBLTE_BIT_CURSOR_STRUCT              *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(ue_eutra_capability   != NULL &&
        msg                   != NULL)
     {
         // Option indicator - featureGroupIndicators
-        liblte_value_2_bits(ue_eutra_capability->feature_group_indicator_present, &msg_ptr, 1);
+        liblte_value_2_bits(ue_eutra_capability->feature_group_indicator_present, msg, 1);
 
         // Option indicator - nonCriticalExtension
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Option indicator - access stratum release enum
-        liblte_value_2_bits(0, &msg_ptr, 1);
-        liblte_value_2_bits(ue_eutra_capability->access_stratum_release,      &msg_ptr, 3);
-
-        liblte_value_2_bits(ue_eutra_capability->ue_category - 1,             &msg_ptr, 3);
-        liblte_rrc_pack_pdcp_params_ie(&ue_eutra_capability->pdcp_params,     &msg_ptr);
-        liblte_rrc_pack_phy_layer_params_ie(&ue_eutra_capability->phy_params, &msg_ptr);
-        liblte_rrc_pack_rf_params_ie(&ue_eutra_capability->rf_params,         &msg_ptr);
-        liblte_rrc_pack_meas_params_ie(&ue_eutra_capability->meas_params,     &msg_ptr);
+        liblte_value_2_bits(0, msg, 1);
+        liblte_value_2_bits(ue_eutra_capability->access_stratum_release,      msg, 3);
+
+        liblte_value_2_bits(ue_eutra_capability->ue_category - 1,             msg, 3);
+        liblte_rrc_pack_pdcp_params_ie(&ue_eutra_capability->pdcp_params,     msg);
+        liblte_rrc_pack_phy_layer_params_ie(&ue_eutra_capability->phy_params, msg);
+        liblte_rrc_pack_rf_params_ie(&ue_eutra_capability->rf_params,         msg);
+        liblte_rrc_pack_meas_params_ie(&ue_eutra_capability->meas_params,     msg);
         if(ue_eutra_capability->feature_group_indicator_present)
-          liblte_value_2_bits(ue_eutra_capability->feature_group_indicator, &msg_ptr, 32);
-        liblte_rrc_pack_inter_rat_params_ie(&ue_eutra_capability->inter_rat_params, &msg_ptr);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+          liblte_value_2_bits(ue_eutra_capability->feature_group_indicator, msg, 32);
+        liblte_rrc_pack_inter_rat_params_ie(&ue_eutra_capability->inter_rat_params, msg);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                            LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *ue_eutra_capability)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1257,7 +1277,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_eutra_capability_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.6
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1279,7 +1299,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_timers_and_constants_ie(LIBLTE_RRC_UE_TIMER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_UE_TIMERS_AND_CONSTANTS_STRUCT  *ue_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1315,7 +1335,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM   allowed_meas_bw,
-                                                            uint8                                  **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1328,7 +1348,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_allowed_meas_bandwidth_ie(LIBLTE_RRC_ALLOWED_M
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                               LIBLTE_RRC_ALLOWED_MEAS_BANDWIDTH_ENUM  *allowed_meas_bw)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1353,7 +1373,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_allowed_meas_bandwidth_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1367,7 +1387,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_hysteresis_ie(uint8   hysteresis,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                   uint8  *hysteresis)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1405,7 +1425,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_hysteresis_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1534,7 +1554,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_config_ie(LIBLTE_RRC_MEAS_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                    LIBLTE_RRC_MEAS_CONFIG_STRUCT  *meas_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1673,7 +1693,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1702,7 +1722,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_gap_config_ie(LIBLTE_RRC_MEAS_GAP_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_MEAS_GAP_CONFIG_STRUCT  *meas_gap_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1742,7 +1762,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_gap_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
-                                             uint8 **ie_ptr)
+                                             LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1755,7 +1775,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_ie(uint8   meas_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                uint8  *meas_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1782,7 +1802,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1810,7 +1830,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_id_to_add_mod_list_ie(LIBLTE_RRC_MEAS_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_MEAS_ID_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1849,7 +1869,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_id_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -1917,7 +1937,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_cdma2000_ie(LIBLTE_RRC_MEAS_OBJECT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                             LIBLTE_RRC_MEAS_OBJECT_CDMA2000_STRUCT  *meas_obj_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1994,7 +2014,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2095,7 +2115,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_eutra_ie(LIBLTE_RRC_MEAS_OBJECT_EU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_EUTRA_STRUCT  *meas_obj_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2203,7 +2223,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2236,7 +2256,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_geran_ie(LIBLTE_RRC_MEAS_OBJECT_GE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                          LIBLTE_RRC_MEAS_OBJECT_GERAN_STRUCT  *meas_obj_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2279,7 +2299,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
-                                                    uint8 **ie_ptr)
+                                                    LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2292,7 +2312,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_id_ie(uint8   meas_object_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                       uint8  *meas_object_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2317,7 +2337,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                 uint8                                         **ie_ptr)
+                                                                 LIBLTE_BIT_CURSOR_STRUCT                       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2357,7 +2377,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_to_add_mod_list_ie(LIBLTE_RRC_MEAS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8                                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(LIBLTE_BIT_CURSOR_STRUCT                       *ie_ptr,
                                                                    LIBLTE_RRC_MEAS_OBJECT_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2408,7 +2428,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -2483,7 +2503,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_object_utra_ie(LIBLTE_RRC_MEAS_OBJECT_UTR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_MEAS_OBJECT_UTRA_STRUCT  *meas_obj_utra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2580,7 +2600,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_object_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2629,7 +2649,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_quantity_config_ie(LIBLTE_RRC_QUANTITY_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_QUANTITY_CONFIG_STRUCT  *qc)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2701,7 +2721,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_quantity_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2808,7 +2828,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_eutra_ie(LIBLTE_RRC_REPORT_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_REPORT_CONFIG_EUTRA_STRUCT  *rep_cnfg_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2928,7 +2948,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
-                                                      uint8 **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2941,7 +2961,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_id_ie(uint8   report_cnfg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                         uint8  *report_cnfg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2966,7 +2986,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_id_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3054,7 +3074,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_inter_rat_ie(LIBLTE_RRC_REPORT_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_REPORT_CONFIG_INTER_RAT_STRUCT  *rep_cnfg_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3153,7 +3173,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_inter_rat_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_CURSOR_STRUCT                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3185,7 +3205,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_config_to_add_mod_list_ie(LIBLTE_RRC_RE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(LIBLTE_BIT_CURSOR_STRUCT                         *ie_ptr,
                                                                      LIBLTE_RRC_REPORT_CONFIG_TO_ADD_MOD_LIST_STRUCT  *list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3227,7 +3247,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_config_to_add_mod_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_ENUM   report_int,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3240,7 +3260,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_report_interval_ie(LIBLTE_RRC_REPORT_INTERVAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr,
                                                        LIBLTE_RRC_REPORT_INTERVAL_ENUM  *report_int)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3265,7 +3285,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_report_interval_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3278,7 +3298,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrp_range_ie(uint8   rsrp_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                   uint8  *rsrp_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3303,7 +3323,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrp_range_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3316,7 +3336,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rsrq_range_ie(uint8   rsrq_range,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                   uint8  *rsrq_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3343,7 +3363,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rsrq_range_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.5
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_ENUM   time_to_trigger,
-                                                     uint8                           **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3356,7 +3376,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_to_trigger_ie(LIBLTE_RRC_TIME_TO_TRIGGER_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr,
                                                        LIBLTE_RRC_TIME_TO_TRIGGER_ENUM  *time_to_trigger)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3380,7 +3400,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_to_trigger_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_spect_em,
-                                                                  uint8 **ie_ptr)
+                                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3393,7 +3413,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_additional_spectrum_emission_ie(uint8   add_sp
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                     uint8  *add_spect_em)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3418,7 +3438,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_additional_spectrum_emission_ie(uint8 **ie_p
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
-                                                          uint8  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3431,7 +3451,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_cdma2000_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                             uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3457,7 +3477,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_cdma2000_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3470,7 +3490,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_eutra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                          uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3495,7 +3515,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_eutra_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
-                                                       uint8  **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3508,7 +3528,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_geran_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                          uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3534,7 +3554,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_geran_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
-                                                      uint8  **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3547,7 +3567,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_arfcn_value_utra_ie(uint16   arfcn,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                         uint16  *arfcn)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3572,7 +3592,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_arfcn_value_utra_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM   bc_cdma2000,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3588,7 +3608,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_class_cdma2000_ie(LIBLTE_RRC_BAND_CLASS_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                            LIBLTE_RRC_BAND_CLASS_CDMA2000_ENUM  *bc_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3616,7 +3636,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_class_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM   bi_geran,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3629,7 +3649,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_band_indicator_geran_ie(LIBLTE_RRC_BAND_INDICA
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                             LIBLTE_RRC_BAND_INDICATOR_GERAN_ENUM  *bi_geran)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3653,7 +3673,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_band_indicator_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3668,7 +3688,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_cdma2000_ie(LIBLTE_RRC_CARRIER_FR
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_CARRIER_FREQ_CDMA2000_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3694,7 +3714,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3709,7 +3729,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freq_geran_ie(LIBLTE_RRC_CARRIER_FREQ_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                           LIBLTE_RRC_CARRIER_FREQ_GERAN_STRUCT  *carrier_freq)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3735,7 +3755,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freq_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3765,7 +3785,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_carrier_freqs_geran_ie(LIBLTE_RRC_CARRIER_FREQ
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_CARRIER_FREQS_GERAN_STRUCT  *carrier_freqs)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3805,7 +3825,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_carrier_freqs_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM   cdma2000_type,
-                                                   uint8                         **ie_ptr)
+                                                   LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3818,7 +3838,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cdma2000_type_ie(LIBLTE_RRC_CDMA2000_TYPE_ENUM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                      LIBLTE_RRC_CDMA2000_TYPE_ENUM  *cdma2000_type)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3842,7 +3862,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cdma2000_type_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
-                                                   uint8  **ie_ptr)
+                                                   LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3855,7 +3875,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_identity_ie(uint32   cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                      uint32  *cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3880,7 +3900,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -3902,7 +3922,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_index_list_ie(LIBLTE_RRC_CELL_INDEX_LIST_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_CELL_INDEX_LIST_STRUCT  *cell_idx_list)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3937,7 +3957,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_index_list_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_resel_prio,
-                                                               uint8 **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3950,7 +3970,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_reselection_priority_ie(uint8   cell_rese
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                  uint8  *cell_resel_prio)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3976,7 +3996,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_reselection_priority_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param,
-                                                                   uint8                                           **ie_ptr)
+                                                                   LIBLTE_BIT_CURSOR_STRUCT                         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4002,7 +4022,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_ie(LIBLTE_RRC_CS
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8                                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(LIBLTE_BIT_CURSOR_STRUCT                         *ie_ptr,
                                                                      LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4030,7 +4050,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param,
-                                                                        uint8                                                **ie_ptr)
+                                                                        LIBLTE_BIT_CURSOR_STRUCT                              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4044,7 +4064,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8                                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(LIBLTE_BIT_CURSOR_STRUCT                              *ie_ptr,
                                                                           LIBLTE_RRC_CSFB_REGISTRATION_PARAM_1XRTT_V920_STRUCT  *csfb_reg_param)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4069,7 +4089,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_registration_param_1xrtt_v920_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4084,7 +4104,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_eutra_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_EUTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4110,7 +4130,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_eutra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4125,7 +4145,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_utra_ie(LIBLTE_RRC_CELL_GLOBAL_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_CELL_GLOBAL_ID_UTRA_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4151,7 +4171,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_utra_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4167,7 +4187,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_geran_ie(LIBLTE_RRC_CELL_GLOBAL
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                             LIBLTE_RRC_CELL_GLOBAL_ID_GERAN_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4194,7 +4214,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4213,7 +4233,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cell_global_id_cdma2000_ie(LIBLTE_RRC_CELL_GLO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_CELL_GLOBAL_ID_CDMA2000_STRUCT  *cell_global_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4242,7 +4262,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cell_global_id_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
-                                                  uint8  **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4255,7 +4275,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_csg_identity_ie(uint32   csg_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                     uint32  *csg_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4280,7 +4300,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csg_identity_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4357,7 +4377,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_control_info_ie(LIBLTE_RRC_MOBILITY_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_MOBILITY_CONTROL_INFO_STRUCT  *mob_ctrl_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4454,7 +4474,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_control_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4471,7 +4491,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mobility_state_parameters_ie(LIBLTE_RRC_MOBILI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_MOBILITY_STATE_PARAMETERS_STRUCT  *mobility_state_params)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4498,7 +4518,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mobility_state_parameters_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
-                                                  uint8  **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4511,7 +4531,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_ie(uint16   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                     uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4536,7 +4556,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              opt;
@@ -4560,7 +4580,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_range_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_RANGE_STRUCT  *phys_cell_id_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4604,7 +4624,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_range_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4617,7 +4637,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_cdma2000_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                              uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4641,7 +4661,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_cdma2000_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4656,7 +4676,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_geran_ie(LIBLTE_RRC_PHYS_CELL_ID_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                           LIBLTE_RRC_PHYS_CELL_ID_GERAN_STRUCT  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4681,7 +4701,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_geran_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id,
-                                                           uint8  **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4694,7 +4714,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_fdd_ie(uint16   phys_cell_id
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                              uint16  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4718,7 +4738,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_fdd_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
-                                                           uint8 **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4731,7 +4751,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phys_cell_id_utra_tdd_ie(uint8   phys_cell_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                              uint8  *phys_cell_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4755,7 +4775,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phys_cell_id_utra_tdd_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id,
-                                                   uint8                           **ie_ptr)
+                                                   LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint8             mcc_opt = true;
@@ -4795,7 +4815,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_plmn_identity_ie(LIBLTE_RRC_PLMN_IDENTITY_STRU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8                           **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(LIBLTE_BIT_CURSOR_STRUCT         *ie_ptr,
                                                      LIBLTE_RRC_PLMN_IDENTITY_STRUCT  *plmn_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4845,7 +4865,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_plmn_identity_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_CURSOR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -4883,7 +4903,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pre_registration_info_hrpd_ie(LIBLTE_RRC_PRE_R
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(LIBLTE_BIT_CURSOR_STRUCT                      *ie_ptr,
                                                                   LIBLTE_RRC_PRE_REGISTRATION_INFO_HRPD_STRUCT  *pre_reg_info_hrpd)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4931,7 +4951,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pre_registration_info_hrpd_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
-                                                uint8 **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4944,7 +4964,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_qual_min_ie(int8    q_qual_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                   int8   *q_qual_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4969,7 +4989,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_qual_min_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4982,7 +5002,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_rx_lev_min_ie(int16   q_rx_lev_min,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                     int16  *q_rx_lev_min)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5009,7 +5029,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_rx_lev_min_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_ENUM   q_offset_range,
-                                                    uint8                          **ie_ptr)
+                                                    LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5022,7 +5042,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_ie(LIBLTE_RRC_Q_OFFSET_RANGE_EN
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr,
                                                       LIBLTE_RRC_Q_OFFSET_RANGE_ENUM  *q_offset_range)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5048,7 +5068,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_range_inter_rat,
-                                                              uint8 **ie_ptr)
+                                                              LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5061,7 +5081,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_q_offset_range_inter_rat_ie(int8    q_offset_r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                 int8   *q_offset_range_inter_rat)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5085,7 +5105,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_q_offset_range_inter_rat_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
-                                                           uint8 **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5098,7 +5118,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_ie(uint8   resel_thresh,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                              uint8  *resel_thresh)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5123,7 +5143,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thresh_q,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5136,7 +5156,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_reselection_threshold_q_ie(uint8   resel_thres
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                uint8  *resel_thresh_q)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5161,7 +5181,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_reselection_threshold_q_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5174,7 +5194,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_s_cell_index_ie(uint8   s_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                     uint8  *s_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5199,7 +5219,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_s_cell_index_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
-                                                     uint8 **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5212,7 +5232,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_serv_cell_index_ie(uint8   serv_cell_idx,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                        uint8  *serv_cell_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5238,7 +5258,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_serv_cell_index_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5253,7 +5273,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_speed_state_scale_factors_ie(LIBLTE_RRC_SPEED_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_SPEED_STATE_SCALE_FACTORS_STRUCT  *speed_state_scale_factors)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5288,7 +5308,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_speed_state_scale_factors_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5311,7 +5331,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_system_time_info_cdma2000_ie(LIBLTE_RRC_SYSTEM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_SYSTEM_TIME_INFO_CDMA2000_STRUCT  *sys_time_info_cdma2000)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5345,7 +5365,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_system_time_info_cdma2000_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
-                                                        uint8  **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5358,7 +5378,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tracking_area_code_ie(uint16   tac,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                           uint16  *tac)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5383,7 +5403,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tracking_area_code_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.4
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
-                                                   uint8 **ie_ptr)
+                                                   LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5396,7 +5416,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_t_reselection_ie(uint8   t_resel,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                      uint8  *t_resel)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5421,7 +5441,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_t_reselection_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_chaining_count,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5434,7 +5454,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_next_hop_chaining_count_ie(uint8   next_hop_ch
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                uint8  *next_hop_chaining_count)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5459,7 +5479,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_next_hop_chaining_count_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5481,7 +5501,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_security_algorithm_config_ie(LIBLTE_RRC_SECURI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_SECURITY_ALGORITHM_CONFIG_STRUCT  *sec_alg_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5514,7 +5534,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_algorithm_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.3
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
-                                                 uint8  **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5527,7 +5547,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_short_mac_i_ie(uint16   short_mac_i,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                    uint16  *short_mac_i)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5552,7 +5572,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_short_mac_i_ie(uint8  **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM   antenna_ports_cnt,
-                                                         uint8                               **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5565,7 +5585,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_common_ie(LIBLTE_RRC_ANTENNA_PORT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                            LIBLTE_RRC_ANTENNA_PORTS_COUNT_ENUM  *antenna_ports_cnt)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5581,7 +5601,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5634,7 +5654,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_antenna_info_dedicated_ie(LIBLTE_RRC_ANTENNA_I
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr,
                                                               LIBLTE_RRC_ANTENNA_INFO_DEDICATED_STRUCT  *antenna_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5697,7 +5717,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_antenna_info_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5755,7 +5775,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cqi_report_config_ie(LIBLTE_RRC_CQI_REPORT_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                          LIBLTE_RRC_CQI_REPORT_CONFIG_STRUCT  *cqi_report_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5843,7 +5863,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cqi_report_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
-                                                  uint8 **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5856,7 +5876,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_drb_identity_ie(uint8   drb_id,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                     uint8  *drb_id)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5880,7 +5900,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_drb_identity_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5913,7 +5933,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_logical_channel_config_ie(LIBLTE_RRC_LOGICAL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr,
                                                               LIBLTE_RRC_LOGICAL_CHANNEL_CONFIG_STRUCT  *log_chan_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5961,7 +5981,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_logical_channel_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6098,7 +6118,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_mac_main_config_ie(LIBLTE_RRC_MAC_MAIN_CONFIG_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT  *mac_main_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6249,7 +6269,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_mac_main_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6309,7 +6329,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdcp_config_ie(LIBLTE_RRC_PDCP_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                    LIBLTE_RRC_PDCP_CONFIG_STRUCT  *pdcp_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6384,7 +6404,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdcp_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6399,7 +6419,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_common_ie(LIBLTE_RRC_PDSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_PDSCH_CONFIG_COMMON_STRUCT  *pdsch_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6416,7 +6436,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM   p_a,
-                                                            uint8                            **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT          *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6429,7 +6449,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pdsch_config_dedicated_ie(LIBLTE_RRC_PDSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8                            **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT          *ie_ptr,
                                                               LIBLTE_RRC_PDSCH_CONFIG_P_A_ENUM  *p_a)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6453,7 +6473,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pdsch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6468,7 +6488,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_phich_config_ie(LIBLTE_RRC_PHICH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr,
                                                     LIBLTE_RRC_PHICH_CONFIG_STRUCT  *phich_config)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6494,7 +6514,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_phich_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     bool              ext = false;
@@ -6586,7 +6606,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_physical_config_dedicated_ie(LIBLTE_RRC_PHYSIC
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT  *phy_cnfg_ded)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6693,7 +6713,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_physical_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
-                                           uint8 **ie_ptr)
+                                           LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6706,7 +6726,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_p_max_ie(int8    p_max,
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                              int8   *p_max)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6731,7 +6751,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_p_max_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6749,7 +6769,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_sib_ie(LIBLTE_RRC_PRACH_CONFIG_SI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_PRACH_CONFIG_SIB_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6769,7 +6789,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg,
-                                                  uint8                          **ie_ptr)
+                                                  LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6794,7 +6814,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_ie(LIBLTE_RRC_PRACH_CONFIG_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8                          **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(LIBLTE_BIT_CURSOR_STRUCT        *ie_ptr,
                                                     LIBLTE_RRC_PRACH_CONFIG_STRUCT  *prach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6821,7 +6841,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_idx,
-                                                            uint8 **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6834,7 +6854,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_prach_config_scell_r10_ie(uint8   prach_cnfg_i
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                               uint8  *prach_cnfg_idx)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6859,7 +6879,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_prach_config_scell_r10_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_ant_port_1,
-                                                             uint8 **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6872,7 +6892,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_presence_antenna_port_1_ie(bool    presence_an
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(LIBLTE_BIT_CURSOR_STRUCT *ie_ptr,
                                                                bool   *presence_ant_port_1)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6897,7 +6917,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_presence_antenna_port_1_ie(uint8 **ie_ptr,
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6914,7 +6934,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_common_ie(LIBLTE_RRC_PUCCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_PUCCH_CONFIG_COMMON_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6933,7 +6953,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6965,7 +6985,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pucch_config_dedicated_ie(LIBLTE_RRC_PUCCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr,
                                                               LIBLTE_RRC_PUCCH_CONFIG_DEDICATED_STRUCT  *pucch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7009,7 +7029,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pucch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7033,7 +7053,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_common_ie(LIBLTE_RRC_PUSCH_CONFIG
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_PUSCH_CONFIG_COMMON_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7059,7 +7079,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7080,7 +7100,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_pusch_config_dedicated_ie(LIBLTE_RRC_PUSCH_CON
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr,
                                                               LIBLTE_RRC_PUSCH_CONFIG_DEDICATED_STRUCT  *pusch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7111,7 +7131,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pusch_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg,
-                                                        uint8                                **ie_ptr)
+                                                        LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7150,7 +7170,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_common_ie(LIBLTE_RRC_RACH_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                           LIBLTE_RRC_RACH_CONFIG_COMMON_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7206,7 +7226,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7221,7 +7241,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rach_config_dedicated_ie(LIBLTE_RRC_RACH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_RACH_CONFIG_DEDICATED_STRUCT  *rach_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7249,7 +7269,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rach_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7283,7 +7303,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_sib_ie(LIBLTE_RRC_RR_CONFIG_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                             LIBLTE_RRC_RR_CONFIG_COMMON_SIB_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7321,7 +7341,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_sib_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7404,7 +7424,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_common_ie(LIBLTE_RRC_RR_CONFIG_COMMO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_RR_CONFIG_COMMON_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7501,7 +7521,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_common_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg,
-                                                         uint8                                 **ie_ptr)
+                                                         LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -7677,7 +7697,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rr_config_dedicated_ie(LIBLTE_RRC_RR_CONFIG_DE
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8                                 **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT               *ie_ptr,
                                                            LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT  *rr_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7867,7 +7887,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rr_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7936,7 +7956,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlc_config_ie(LIBLTE_RRC_RLC_CONFIG_STRUCT  *r
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr,
                                                   LIBLTE_RRC_RLC_CONFIG_STRUCT  *rlc_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8018,7 +8038,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlc_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants,
-                                                              uint8                                      **ie_ptr)
+                                                              LIBLTE_BIT_CURSOR_STRUCT                    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8042,7 +8062,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rlf_timers_and_constants_ie(LIBLTE_RRC_RLF_TIM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8                                      **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(LIBLTE_BIT_CURSOR_STRUCT                    *ie_ptr,
                                                                 LIBLTE_RRC_RLF_TIMERS_AND_CONSTANTS_STRUCT  *rlf_timers_and_constants)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8085,7 +8105,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rlf_timers_and_constants_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg,
-                                                               uint8                                       **ie_ptr)
+                                                               LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8111,7 +8131,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_scheduling_request_config_ie(LIBLTE_RRC_SCHEDU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8                                       **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(LIBLTE_BIT_CURSOR_STRUCT                     *ie_ptr,
                                                                  LIBLTE_RRC_SCHEDULING_REQUEST_CONFIG_STRUCT  *sched_request_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8148,7 +8168,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_scheduling_request_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg,
-                                                          uint8                                  **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8176,7 +8196,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_common_ie(LIBLTE_RRC_SRS_UL_CONF
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8                                  **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(LIBLTE_BIT_CURSOR_STRUCT                *ie_ptr,
                                                             LIBLTE_RRC_SRS_UL_CONFIG_COMMON_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8206,7 +8226,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8244,7 +8264,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_srs_ul_config_dedicated_ie(LIBLTE_RRC_SRS_UL_C
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_SRS_UL_CONFIG_DEDICATED_STRUCT  *srs_ul_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8293,7 +8313,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_srs_ul_config_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -8378,7 +8398,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sps_config_ie(LIBLTE_RRC_SPS_CONFIG_STRUCT  *s
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr,
                                                   LIBLTE_RRC_SPS_CONFIG_STRUCT  *sps_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8478,7 +8498,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sps_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg,
-                                                uint8                        **ie_ptr)
+                                                LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8493,7 +8513,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tdd_config_ie(LIBLTE_RRC_TDD_CONFIG_STRUCT  *t
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(LIBLTE_BIT_CURSOR_STRUCT      *ie_ptr,
                                                   LIBLTE_RRC_TDD_CONFIG_STRUCT  *tdd_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8519,7 +8539,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tdd_config_ie(uint8                        *
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM   time_alignment_timer,
-                                                          uint8                                **ie_ptr)
+                                                          LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8532,7 +8552,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_time_alignment_timer_ie(LIBLTE_RRC_TIME_ALIGNM
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8                                **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(LIBLTE_BIT_CURSOR_STRUCT              *ie_ptr,
                                                             LIBLTE_RRC_TIME_ALIGNMENT_TIMER_ENUM  *time_alignment_timer)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8557,7 +8577,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_time_alignment_timer_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg,
-                                                      uint8                              **ie_ptr)
+                                                      LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8586,7 +8606,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_tpc_pdcch_config_ie(LIBLTE_RRC_TPC_PDCCH_CONFI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8                              **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(LIBLTE_BIT_CURSOR_STRUCT            *ie_ptr,
                                                         LIBLTE_RRC_TPC_PDCCH_CONFIG_STRUCT  *tpc_pdcch_cnfg)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8625,7 +8645,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_tpc_pdcch_config_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info,
-                                                     uint8                             **ie_ptr)
+                                                     LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8643,7 +8663,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_antenna_info_ie(LIBLTE_RRC_UL_ANTENNA_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8                             **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(LIBLTE_BIT_CURSOR_STRUCT           *ie_ptr,
                                                        LIBLTE_RRC_UL_ANTENNA_INFO_STRUCT  *ul_ant_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8675,7 +8695,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_antenna_info_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl,
-                                                             uint8                                     **ie_ptr)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8700,7 +8720,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_common_ie(LIBLTE_RRC_UL_POWER
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8                                     **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(LIBLTE_BIT_CURSOR_STRUCT                   *ie_ptr,
                                                                LIBLTE_RRC_UL_POWER_CONTROL_COMMON_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8727,7 +8747,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_common_ie(uint8
     return(err);
 }
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl,
-                                                                uint8                                        **ie_ptr)
+                                                                LIBLTE_BIT_CURSOR_STRUCT                      *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8763,7 +8783,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_power_control_dedicated_ie(LIBLTE_RRC_UL_PO
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8                                        **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(LIBLTE_BIT_CURSOR_STRUCT                      *ie_ptr,
                                                                   LIBLTE_RRC_UL_POWER_CONTROL_DEDICATED_STRUCT  *ul_pwr_ctrl)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8810,7 +8830,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_power_control_dedicated_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -8908,7 +8928,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_2_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT  *sib2)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9022,7 +9042,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_2_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9106,7 +9126,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_3_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT  *sib3)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9205,7 +9225,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_3_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9263,7 +9283,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_4_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT  *sib4)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9334,7 +9354,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_4_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9414,7 +9434,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_5_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT  *sib5)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9514,7 +9534,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_5_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9596,7 +9616,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_6_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT  *sib6)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9691,7 +9711,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_6_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -9753,7 +9773,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_7_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT  *sib7)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9830,7 +9850,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_7_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
     LIBLTE_ERROR_ENUM                      err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9986,7 +10006,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_8_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT  *sib8)
 {
     LIBLTE_RRC_NEIGH_CELL_CDMA2000_STRUCT *neigh_cell_list;
@@ -10166,7 +10186,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_8_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9,
-                                                           uint8                                   **ie_ptr)
+                                                           LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10195,7 +10215,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_9_ie(LIBLTE_RRC_SYS_INFO_B
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8                                   **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(LIBLTE_BIT_CURSOR_STRUCT                 *ie_ptr,
                                                              LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT  *sib9)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10267,7 +10287,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_9_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.3.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13,
-                                                            uint8                                    **ie_ptr)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
     uint32            i;
@@ -10293,7 +10313,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_13_ie(LIBLTE_RRC_SYS_INFO_
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8                                    **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(LIBLTE_BIT_CURSOR_STRUCT                  *ie_ptr,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT  *sib13)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10338,74 +10358,69 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_13_ie(uint8
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_information_transfer_msg(LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg)
+                                                              LIBLTE_BIT_CURSOR_STRUCT                  *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(ul_info_transfer != NULL &&
        msg              != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Dedicated info type choice
-        liblte_value_2_bits(ul_info_transfer->dedicated_info_type, &msg_ptr, 2);
+        liblte_value_2_bits(ul_info_transfer->dedicated_info_type, msg, 2);
 
         if(LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_NAS == ul_info_transfer->dedicated_info_type)
         {
             liblte_rrc_pack_dedicated_info_nas_ie(&ul_info_transfer->dedicated_info,
-                                                  &msg_ptr);
+                                                  msg);
         }else{
             liblte_rrc_pack_dedicated_info_cdma2000_ie(&ul_info_transfer->dedicated_info,
-                                                       &msg_ptr);
+                                                       msg);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_CURSOR_STRUCT                  *msg,
                                                                 LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *ul_info_transfer)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg              != NULL &&
        ul_info_transfer != NULL)
     {
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Dedicated info type choice
-        ul_info_transfer->dedicated_info_type = (LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
+        ul_info_transfer->dedicated_info_type = (LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_ENUM)liblte_bits_2_value(msg, 2);
 
         if(LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_NAS == ul_info_transfer->dedicated_info_type)
         {
-            liblte_rrc_unpack_dedicated_info_nas_ie(&msg_ptr,
+            liblte_rrc_unpack_dedicated_info_nas_ie(msg,
                                                     &ul_info_transfer->dedicated_info);
         }else{
-            liblte_rrc_unpack_dedicated_info_cdma2000_ie(&msg_ptr,
+            liblte_rrc_unpack_dedicated_info_cdma2000_ie(msg,
                                                          &ul_info_transfer->dedicated_info);
         }
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -10442,70 +10457,65 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_information_transfer_msg(LIBLTE_BIT_MSG_S
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_information_request_msg(LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                 *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(ue_info_req != NULL &&
        msg         != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_info_req->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // RACH report required
-        liblte_value_2_bits(ue_info_req->rach_report_req, &msg_ptr, 1);
+        liblte_value_2_bits(ue_info_req->rach_report_req, msg, 1);
 
         // RLF report required
-        liblte_value_2_bits(ue_info_req->rlf_report_req, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(ue_info_req->rlf_report_req, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_CURSOR_STRUCT                 *msg,
                                                                LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *ue_info_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg         != NULL &&
        ue_info_req != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &ue_info_req->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // RACH report required
-        ue_info_req->rach_report_req = liblte_bits_2_value(&msg_ptr, 1);
+        ue_info_req->rach_report_req = liblte_bits_2_value(msg, 1);
 
         // RLF report required
-        ue_info_req->rlf_report_req = liblte_bits_2_value(&msg_ptr, 1);
+        ue_info_req->rlf_report_req = liblte_bits_2_value(msg, 1);
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -10522,10 +10532,9 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_information_request_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info,
-                                                                LIBLTE_BIT_MSG_STRUCT                       *msg)
+                                                                LIBLTE_BIT_CURSOR_STRUCT                    *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
 
     if(ue_capability_info != NULL &&
@@ -10533,107 +10542,100 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_information_msg(LIBLTE_RRC_UE_CA
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_capability_info->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 3);
+        liblte_value_2_bits(0, msg, 3);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
-        liblte_value_2_bits(ue_capability_info->N_ue_caps, &msg_ptr, 4);
+        liblte_value_2_bits(ue_capability_info->N_ue_caps, msg, 4);
         for(i=0; i<ue_capability_info->N_ue_caps; i++)
         {
             // RAT-Type
-            liblte_value_2_bits(0, &msg_ptr, 1); //Optional indicator
-            liblte_value_2_bits(ue_capability_info->ue_capability_rat[i].rat_type, &msg_ptr, 3);
+            liblte_value_2_bits(0, msg, 1); //Optional indicator
+            liblte_value_2_bits(ue_capability_info->ue_capability_rat[i].rat_type, msg, 3);
 
             // Octet string
-            LIBLTE_BIT_MSG_STRUCT  tmp;
-            liblte_rrc_pack_ue_eutra_capability_ie(&ue_capability_info->ue_capability_rat[i].eutra_capability, &tmp);
+            LIBLTE_BYTE_MSG_STRUCT    tmp;
+            LIBLTE_BIT_CURSOR_STRUCT  tmp_ptr;
+            liblte_bit_cursor_init(&tmp_ptr, tmp.msg);
+            liblte_rrc_pack_ue_eutra_capability_ie(&ue_capability_info->ue_capability_rat[i].eutra_capability, &tmp_ptr);
 
-            uint32 pad     = 8 - tmp.N_bits%8;
-            uint32 n_bytes = (tmp.N_bits+pad) / 8;
+            uint32 pad     = 8 - tmp_ptr.N_bits%8;
+            uint32 n_bytes = (tmp_ptr.N_bits+pad) / 8;
             if(n_bytes < 128)
             {
-                liblte_value_2_bits(0,       &msg_ptr, 1);
-                liblte_value_2_bits(n_bytes, &msg_ptr, 7);
+                liblte_value_2_bits(0,       msg, 1);
+                liblte_value_2_bits(n_bytes, msg, 7);
             }else if(n_bytes < 16383){
-                liblte_value_2_bits(1,       &msg_ptr, 1);
-                liblte_value_2_bits(0,       &msg_ptr, 1);
-                liblte_value_2_bits(n_bytes, &msg_ptr, 14);
+                liblte_value_2_bits(1,       msg, 1);
+                liblte_value_2_bits(0,       msg, 1);
+                liblte_value_2_bits(n_bytes, msg, 14);
             }else{
                 // FIXME: Unlikely to have more than 16K of octets
             }
 
-            for(i=0; i<tmp.N_bits; i++)
-            {
-                *msg_ptr = tmp.msg[i];
-                msg_ptr++;
-            }
-
-            msg_ptr += pad;
+            liblte_bits_copy(tmp.msg, msg, tmp_ptr.N_bits);
+            liblte_value_2_bits(0, msg, pad);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_CURSOR_STRUCT                    *msg,
                                                                   LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *ue_capability_info)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
 
     if(msg                != NULL &&
        ue_capability_info != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &ue_capability_info->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 3);
+        liblte_bits_2_value(msg, 3);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        ue_capability_info->N_ue_caps = liblte_bits_2_value(&msg_ptr, 4);
+        ue_capability_info->N_ue_caps = liblte_bits_2_value(msg, 4);
         for(i=0; i<ue_capability_info->N_ue_caps; i++)
         {
-            liblte_bits_2_value(&msg_ptr, 1); //Optional indicator
-            ue_capability_info->ue_capability_rat[i].rat_type = (LIBLTE_RRC_RAT_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 3);
+            liblte_bits_2_value(msg, 1); //Optional indicator
+            ue_capability_info->ue_capability_rat[i].rat_type = (LIBLTE_RRC_RAT_TYPE_ENUM)liblte_bits_2_value(msg, 3);
 
             //Octet string
             uint32 n_bytes = 0;
-            if(0 == liblte_bits_2_value(&msg_ptr, 1))
+            if(0 == liblte_bits_2_value(msg, 1))
             {
-                n_bytes = liblte_bits_2_value(&msg_ptr, 7);
+                n_bytes = liblte_bits_2_value(msg, 7);
             }else{
-                if(0 == liblte_bits_2_value(&msg_ptr, 1))
+                if(0 == liblte_bits_2_value(msg, 1))
                 {
-                    n_bytes = liblte_bits_2_value(&msg_ptr, 14);
+                    n_bytes = liblte_bits_2_value(msg, 14);
                 }else{
                     // FIXME: Unlikely to have more than 16K of octets
                     n_bytes = 0;
                 }
             }
 
-            liblte_rrc_unpack_ue_eutra_capability_ie(&msg_ptr, &ue_capability_info->ue_capability_rat[i].eutra_capability);
+            liblte_rrc_unpack_ue_eutra_capability_ie(msg, &ue_capability_info->ue_capability_rat[i].eutra_capability);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -10651,10 +10653,9 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_information_msg(LIBLTE_BIT_MSG
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
 
     if(ue_cap_enquiry != NULL &&
@@ -10662,62 +10663,58 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_ue_capability_enquiry_msg(LIBLTE_RRC_UE_CAPABI
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(ue_cap_enquiry->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // UE-CapabilityRequest
-        liblte_value_2_bits(ue_cap_enquiry->N_ue_cap_reqs - 1, &msg_ptr, 3);
+        liblte_value_2_bits(ue_cap_enquiry->N_ue_cap_reqs - 1, msg, 3);
         for(i=0; i<LIBLTE_RRC_MAX_RAT_CAPABILITIES; i++)
         {
-            liblte_rrc_pack_rat_type_ie(ue_cap_enquiry->ue_capability_request[i], &msg_ptr);
+            liblte_rrc_pack_rat_type_ie(ue_cap_enquiry->ue_capability_request[i], msg);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_CURSOR_STRUCT                *msg,
                                                               LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *ue_cap_enquiry)
 {
   LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-  uint8             *msg_ptr = msg->msg;
   uint32             i;
 
   if(msg         != NULL &&
      ue_cap_enquiry != NULL)
   {
       // RRC Transaction ID
-      liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+      liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                       &ue_cap_enquiry->rrc_transaction_id);
 
       // Extension choice
-      bool ext = liblte_bits_2_value(&msg_ptr, 1);
+      bool ext = liblte_bits_2_value(msg, 1);
 
       // C1 choice
-      liblte_bits_2_value(&msg_ptr, 2);
+      liblte_bits_2_value(msg, 2);
 
       // Optional indicator
-      liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+      liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-      ue_cap_enquiry->N_ue_cap_reqs = liblte_bits_2_value(&msg_ptr, 3) + 1;
+      ue_cap_enquiry->N_ue_cap_reqs = liblte_bits_2_value(msg, 3) + 1;
       for(i=0; i<ue_cap_enquiry->N_ue_cap_reqs; i++)
       {
-        liblte_rrc_unpack_rat_type_ie(&msg_ptr, &ue_cap_enquiry->ue_capability_request[i]);
+        liblte_rrc_unpack_rat_type_ie(msg, &ue_cap_enquiry->ue_capability_request[i]);
       }
       
-      liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+      liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
       err = LIBLTE_SUCCESS;
   }
@@ -10736,10 +10733,9 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ue_capability_enquiry_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
     uint8              non_crit_ext_opt        = false;
@@ -10751,87 +10747,84 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_block_type_1_msg(LIBLTE_RRC_SYS_INFO_
        msg  != NULL)
     {
         // Optional indicators
-        liblte_value_2_bits(sib1->p_max_present, &msg_ptr, 1);
-        liblte_value_2_bits(sib1->tdd,           &msg_ptr, 1);
-        liblte_value_2_bits(non_crit_ext_opt,    &msg_ptr, 1);
+        liblte_value_2_bits(sib1->p_max_present, msg, 1);
+        liblte_value_2_bits(sib1->tdd,           msg, 1);
+        liblte_value_2_bits(non_crit_ext_opt,    msg, 1);
 
         // Cell Access Related Info
-        liblte_value_2_bits(csg_id_opt,           &msg_ptr, 1);
-        liblte_value_2_bits(sib1->N_plmn_ids - 1, &msg_ptr, 3);
+        liblte_value_2_bits(csg_id_opt,           msg, 1);
+        liblte_value_2_bits(sib1->N_plmn_ids - 1, msg, 3);
         for(i=0; i<sib1->N_plmn_ids; i++)
         {
-            liblte_rrc_pack_plmn_identity_ie(&sib1->plmn_id[i].id, &msg_ptr);
-            liblte_value_2_bits(sib1->plmn_id[i].resv_for_oper, &msg_ptr, 1);
+            liblte_rrc_pack_plmn_identity_ie(&sib1->plmn_id[i].id, msg);
+            liblte_value_2_bits(sib1->plmn_id[i].resv_for_oper, msg, 1);
         }
-        liblte_rrc_pack_tracking_area_code_ie(sib1->tracking_area_code, &msg_ptr);
-        liblte_rrc_pack_cell_identity_ie(sib1->cell_id, &msg_ptr);
-        liblte_value_2_bits(sib1->cell_barred,            &msg_ptr, 1);
-        liblte_value_2_bits(sib1->intra_freq_reselection, &msg_ptr, 1);
-        liblte_value_2_bits(sib1->csg_indication,         &msg_ptr, 1);
+        liblte_rrc_pack_tracking_area_code_ie(sib1->tracking_area_code, msg);
+        liblte_rrc_pack_cell_identity_ie(sib1->cell_id, msg);
+        liblte_value_2_bits(sib1->cell_barred,            msg, 1);
+        liblte_value_2_bits(sib1->intra_freq_reselection, msg, 1);
+        liblte_value_2_bits(sib1->csg_indication,         msg, 1);
         if(true == csg_id_opt)
         {
-            liblte_rrc_pack_csg_identity_ie(sib1->csg_id, &msg_ptr);
+            liblte_rrc_pack_csg_identity_ie(sib1->csg_id, msg);
         }
 
         // Cell Selection Info
-        liblte_value_2_bits(q_rx_lev_min_offset_opt, &msg_ptr, 1);
-        liblte_rrc_pack_q_rx_lev_min_ie(sib1->q_rx_lev_min, &msg_ptr);
+        liblte_value_2_bits(q_rx_lev_min_offset_opt, msg, 1);
+        liblte_rrc_pack_q_rx_lev_min_ie(sib1->q_rx_lev_min, msg);
         if(true == q_rx_lev_min_offset_opt)
         {
-            liblte_value_2_bits((sib1->q_rx_lev_min_offset / 2) - 1, &msg_ptr, 3);
+            liblte_value_2_bits((sib1->q_rx_lev_min_offset / 2) - 1, msg, 3);
         }
 
         // P Max
         if(true == sib1->p_max_present)
         {
-            liblte_rrc_pack_p_max_ie(sib1->p_max, &msg_ptr);
+            liblte_rrc_pack_p_max_ie(sib1->p_max, msg);
         }
 
         // Freq Band Indicator
-        liblte_value_2_bits(sib1->freq_band_indicator - 1, &msg_ptr, 6);
+        liblte_value_2_bits(sib1->freq_band_indicator - 1, msg, 6);
 
         // Scheduling Info List
-        liblte_value_2_bits(sib1->N_sched_info - 1, &msg_ptr, 5);
+        liblte_value_2_bits(sib1->N_sched_info - 1, msg, 5);
         for(i=0; i<sib1->N_sched_info; i++)
         {
-            liblte_value_2_bits(sib1->sched_info[i].si_periodicity,     &msg_ptr, 3);
-            liblte_value_2_bits(sib1->sched_info[i].N_sib_mapping_info, &msg_ptr, 5);
+            liblte_value_2_bits(sib1->sched_info[i].si_periodicity,     msg, 3);
+            liblte_value_2_bits(sib1->sched_info[i].N_sib_mapping_info, msg, 5);
             for(j=0; j<sib1->sched_info[i].N_sib_mapping_info; j++)
             {
-                liblte_value_2_bits(extension,                                        &msg_ptr, 1);
-                liblte_value_2_bits(sib1->sched_info[i].sib_mapping_info[j].sib_type, &msg_ptr, 4);
+                liblte_value_2_bits(extension,                                        msg, 1);
+                liblte_value_2_bits(sib1->sched_info[i].sib_mapping_info[j].sib_type, msg, 4);
             }
         }
 
         // TDD Config
         if(true == sib1->tdd)
         {
-            liblte_rrc_pack_tdd_config_ie(&sib1->tdd_cnfg, &msg_ptr);
+            liblte_rrc_pack_tdd_config_ie(&sib1->tdd_cnfg, msg);
         }
 
         // SI Window Length
-        liblte_value_2_bits(sib1->si_window_length, &msg_ptr, 3);
+        liblte_value_2_bits(sib1->si_window_length, msg, 3);
 
         // System Info Value Tag
-        liblte_value_2_bits(sib1->system_info_value_tag, &msg_ptr, 5);
+        liblte_value_2_bits(sib1->system_info_value_tag, msg, 5);
 
         // Non Critical Extension
         // FIXME
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_CURSOR_STRUCT                *msg,
                                                               LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1,
                                                               uint32                                  *N_bits_used)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
+    uint32             N_bits  = msg->N_bits;
     uint32             i;
     uint32             j;
     bool               tdd_config_opt;
@@ -10846,41 +10839,41 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
     {
 
         // Optional indicators
-        sib1->p_max_present = liblte_bits_2_value(&msg_ptr, 1);
-        tdd_config_opt      = liblte_bits_2_value(&msg_ptr, 1);
-        non_crit_ext_opt    = liblte_bits_2_value(&msg_ptr, 1);
+        sib1->p_max_present = liblte_bits_2_value(msg, 1);
+        tdd_config_opt      = liblte_bits_2_value(msg, 1);
+        non_crit_ext_opt    = liblte_bits_2_value(msg, 1);
 
         // Cell Access Related Info
-        csg_id_opt       = liblte_bits_2_value(&msg_ptr, 1);
-        sib1->N_plmn_ids = liblte_bits_2_value(&msg_ptr, 3) + 1;
+        csg_id_opt       = liblte_bits_2_value(msg, 1);
+        sib1->N_plmn_ids = liblte_bits_2_value(msg, 3) + 1;
         for(i=0; i<sib1->N_plmn_ids; i++)
         {
-            liblte_rrc_unpack_plmn_identity_ie(&msg_ptr, &sib1->plmn_id[i].id);
+            liblte_rrc_unpack_plmn_identity_ie(msg, &sib1->plmn_id[i].id);
             if(LIBLTE_RRC_MCC_NOT_PRESENT == sib1->plmn_id[i].id.mcc &&
                0                          != i)
             {
                 sib1->plmn_id[i].id.mcc = sib1->plmn_id[i-1].id.mcc;
             }
-            sib1->plmn_id[i].resv_for_oper = (LIBLTE_RRC_RESV_FOR_OPER_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+            sib1->plmn_id[i].resv_for_oper = (LIBLTE_RRC_RESV_FOR_OPER_ENUM)liblte_bits_2_value(msg, 1);
         }
-        liblte_rrc_unpack_tracking_area_code_ie(&msg_ptr, &sib1->tracking_area_code);
-        liblte_rrc_unpack_cell_identity_ie(&msg_ptr, &sib1->cell_id);
-        sib1->cell_barred            = (LIBLTE_RRC_CELL_BARRED_ENUM)liblte_bits_2_value(&msg_ptr, 1);
-        sib1->intra_freq_reselection = (LIBLTE_RRC_INTRA_FREQ_RESELECTION_ENUM)liblte_bits_2_value(&msg_ptr, 1);
-        sib1->csg_indication         = liblte_bits_2_value(&msg_ptr, 1);
+        liblte_rrc_unpack_tracking_area_code_ie(msg, &sib1->tracking_area_code);
+        liblte_rrc_unpack_cell_identity_ie(msg, &sib1->cell_id);
+        sib1->cell_barred            = (LIBLTE_RRC_CELL_BARRED_ENUM)liblte_bits_2_value(msg, 1);
+        sib1->intra_freq_reselection = (LIBLTE_RRC_INTRA_FREQ_RESELECTION_ENUM)liblte_bits_2_value(msg, 1);
+        sib1->csg_indication         = liblte_bits_2_value(msg, 1);
         if(true == csg_id_opt)
         {
-            liblte_rrc_unpack_csg_identity_ie(&msg_ptr, &sib1->csg_id);
+            liblte_rrc_unpack_csg_identity_ie(msg, &sib1->csg_id);
         }else{
             sib1->csg_id = LIBLTE_RRC_CSG_IDENTITY_NOT_PRESENT;
         }
 
         // Cell Selection Info
-        q_rx_lev_min_offset_opt = liblte_bits_2_value(&msg_ptr, 1);
-        liblte_rrc_unpack_q_rx_lev_min_ie(&msg_ptr, &sib1->q_rx_lev_min);
+        q_rx_lev_min_offset_opt = liblte_bits_2_value(msg, 1);
+        liblte_rrc_unpack_q_rx_lev_min_ie(msg, &sib1->q_rx_lev_min);
         if(true == q_rx_lev_min_offset_opt)
         {
-            sib1->q_rx_lev_min_offset = (liblte_bits_2_value(&msg_ptr, 3) + 1) * 2;
+            sib1->q_rx_lev_min_offset = (liblte_bits_2_value(msg, 3) + 1) * 2;
         }else{
             sib1->q_rx_lev_min_offset = 0;
         }
@@ -10888,22 +10881,22 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
         // P Max
         if(true == sib1->p_max_present)
         {
-            liblte_rrc_unpack_p_max_ie(&msg_ptr, &sib1->p_max);
+            liblte_rrc_unpack_p_max_ie(msg, &sib1->p_max);
         }
 
         // Freq Band Indicator
-        sib1->freq_band_indicator = liblte_bits_2_value(&msg_ptr, 6) + 1;
+        sib1->freq_band_indicator = liblte_bits_2_value(msg, 6) + 1;
 
         // Scheduling Info List
-        sib1->N_sched_info = liblte_bits_2_value(&msg_ptr, 5) + 1;
+        sib1->N_sched_info = liblte_bits_2_value(msg, 5) + 1;
         for(i=0; i<sib1->N_sched_info; i++)
         {
-            sib1->sched_info[i].si_periodicity     = (LIBLTE_RRC_SI_PERIODICITY_ENUM)liblte_bits_2_value(&msg_ptr, 3);
-            sib1->sched_info[i].N_sib_mapping_info = liblte_bits_2_value(&msg_ptr, 5);
+            sib1->sched_info[i].si_periodicity     = (LIBLTE_RRC_SI_PERIODICITY_ENUM)liblte_bits_2_value(msg, 3);
+            sib1->sched_info[i].N_sib_mapping_info = liblte_bits_2_value(msg, 5);
             for(j=0; j<sib1->sched_info[i].N_sib_mapping_info; j++)
             {
-                extension                                        = liblte_bits_2_value(&msg_ptr, 1);
-                sib1->sched_info[i].sib_mapping_info[j].sib_type = (LIBLTE_RRC_SIB_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
+                extension                                        = liblte_bits_2_value(msg, 1);
+                sib1->sched_info[i].sib_mapping_info[j].sib_type = (LIBLTE_RRC_SIB_TYPE_ENUM)liblte_bits_2_value(msg, 4);
             }
         }
 
@@ -10911,22 +10904,22 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
         if(true == tdd_config_opt)
         {
             sib1->tdd = true;
-            liblte_rrc_unpack_tdd_config_ie(&msg_ptr, &sib1->tdd_cnfg);
+            liblte_rrc_unpack_tdd_config_ie(msg, &sib1->tdd_cnfg);
         }else{
             sib1->tdd = false;
         }
 
         // SI Window Length
-        sib1->si_window_length = (LIBLTE_RRC_SI_WINDOW_LENGTH_ENUM)liblte_bits_2_value(&msg_ptr, 3);
+        sib1->si_window_length = (LIBLTE_RRC_SI_WINDOW_LENGTH_ENUM)liblte_bits_2_value(msg, 3);
 
         // System Info Value Tag
-        sib1->system_info_value_tag = liblte_bits_2_value(&msg_ptr, 5);
+        sib1->system_info_value_tag = liblte_bits_2_value(msg, 5);
 
         // Non Critical Extension
-        liblte_rrc_consume_noncrit_extension(non_crit_ext_opt, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(non_crit_ext_opt, __func__, msg);
 
         // N_bits_used
-        *N_bits_used = msg_ptr - (msg->msg);
+        *N_bits_used = msg->N_bits - N_bits;
 
         err = LIBLTE_SUCCESS;
     }
@@ -10942,56 +10935,55 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_block_type_1_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs,
-                                               LIBLTE_BIT_MSG_STRUCT          *msg)
+                                               LIBLTE_BIT_CURSOR_STRUCT       *msg)
 {
-    LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint8             *length_ptr;
-    uint32             length;
-    uint32             pad_bits;
-    uint32             i;
+    LIBLTE_ERROR_ENUM         err     = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  length_ptr;
+    uint32                    length;
+    uint32                    pad_bits;
+    uint32                    i;
 
     if(sibs != NULL &&
        msg  != NULL)
     {
         // Critical extensions choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Number of SIBs present
-        liblte_value_2_bits(sibs->N_sibs - 1, &msg_ptr, 5);
+        liblte_value_2_bits(sibs->N_sibs - 1, msg, 5);
 
         for(i=0; i<sibs->N_sibs; i++)
         {
             if(sibs->sibs[i].sib_type < LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_12)
             {
                 // Extension indicator
-                liblte_value_2_bits(0, &msg_ptr, 1);
+                liblte_value_2_bits(0, msg, 1);
 
-                liblte_value_2_bits(sibs->sibs[i].sib_type, &msg_ptr, 4);
+                liblte_value_2_bits(sibs->sibs[i].sib_type, msg, 4);
                 switch(sibs->sibs[i].sib_type)
                 {
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2:
                     err = liblte_rrc_pack_sys_info_block_type_2_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *)&sibs->sibs[i].sib,
-                                                                   &msg_ptr);
+                                                                   msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3:
                     err = liblte_rrc_pack_sys_info_block_type_3_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT *)&sibs->sibs[i].sib,
-                                                                   &msg_ptr);
+                                                                   msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4:
                     err = liblte_rrc_pack_sys_info_block_type_4_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT *)&sibs->sibs[i].sib,
-                                                                   &msg_ptr);
+                                                                   msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8:
                     err = liblte_rrc_pack_sys_info_block_type_8_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT *)&sibs->sibs[i].sib,
-                                                                   &msg_ptr);
+                                                                   msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9:
                     err = liblte_rrc_pack_sys_info_block_type_9_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT *)&sibs->sibs[i].sib,
-                                                                   &msg_ptr);
+                                                                   msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5:
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6:
@@ -11005,16 +10997,16 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                 }
             }else{
                 // Extension indicator
-                liblte_value_2_bits(1, &msg_ptr, 1);
+                liblte_value_2_bits(1, msg, 1);
 
-                liblte_value_2_bits(sibs->sibs[i].sib_type - 10, &msg_ptr, 7);
-                length_ptr = msg_ptr;
-                liblte_value_2_bits(0, &msg_ptr, 8);
+                liblte_value_2_bits(sibs->sibs[i].sib_type - 10, msg, 7);
+                length_ptr = *msg;
+                liblte_value_2_bits(0, msg, 8);
                 switch(sibs->sibs[i].sib_type)
                 {
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13:
                     err = liblte_rrc_pack_sys_info_block_type_13_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT *)&sibs->sibs[i].sib,
-                                                                    &msg_ptr);
+                                                                    msg);
                     break;
                 case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_12:
                 default:
@@ -11022,8 +11014,8 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                     err = LIBLTE_ERROR_INVALID_INPUTS;
                     break;
                 }
-                length   = ((msg_ptr - length_ptr) / 8) - 1;
-                pad_bits = (msg_ptr - length_ptr) % 8;
+                length   = ((msg->N_bits - length_ptr.N_bits) / 8) - 1;
+                pad_bits = (msg->N_bits - length_ptr.N_bits) % 8;
                 if(0 != pad_bits)
                 {
                     length++;
@@ -11033,14 +11025,14 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                     liblte_value_2_bits(0,      &length_ptr, 1);
                     liblte_value_2_bits(length, &length_ptr, 7);
                 }else{
-                    msg_ptr = length_ptr;
-                    liblte_value_2_bits(0,      &msg_ptr, 2);
-                    liblte_value_2_bits(length, &msg_ptr, 14);
+                    *msg = length_ptr;
+                    liblte_value_2_bits(0,      msg, 2);
+                    liblte_value_2_bits(length, msg, 14);
                     switch(sibs->sibs[i].sib_type)
                     {
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13:
                         err = liblte_rrc_pack_sys_info_block_type_13_ie((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT *)&sibs->sibs[i].sib,
-                                                                        &msg_ptr);
+                                                                        msg);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_12:
                     default:
@@ -11049,7 +11041,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                         break;
                     }
                 }
-                liblte_value_2_bits(0, &msg_ptr, pad_bits);
+                liblte_value_2_bits(0, msg, pad_bits);
             }
 
             if(LIBLTE_SUCCESS != err)
@@ -11057,19 +11049,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_sys_info_msg(LIBLTE_RRC_SYS_INFO_MSG_STRUCT *s
                 break;
             }
         }
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT          *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_CURSOR_STRUCT       *msg,
                                                  LIBLTE_RRC_SYS_INFO_MSG_STRUCT *sibs)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint8             *head_ptr;
+    uint32             head_offset;
     uint32             i;
     uint32             length_determinant_octets;
     uint8              non_crit_ext_opt;
@@ -11078,52 +11066,52 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
        sibs != NULL)
     {
         // Critical extensions choice
-        if(0 == liblte_bits_2_value(&msg_ptr, 1))
+        if(0 == liblte_bits_2_value(msg, 1))
         {
             // Optional indicator
-            non_crit_ext_opt = liblte_bits_2_value(&msg_ptr, 1);
+            non_crit_ext_opt = liblte_bits_2_value(msg, 1);
 
             // Number of SIBs present
-            sibs->N_sibs = liblte_bits_2_value(&msg_ptr, 5) + 1;
+            sibs->N_sibs = liblte_bits_2_value(msg, 5) + 1;
 
             for(i=0; i<sibs->N_sibs; i++)
             {
                 // Extension indicator
-                if(0 == liblte_bits_2_value(&msg_ptr, 1))
+                if(0 == liblte_bits_2_value(msg, 1))
                 {
-                    sibs->sibs[i].sib_type = (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
+                    sibs->sibs[i].sib_type = (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_ENUM)liblte_bits_2_value(msg, 4);
                     switch(sibs->sibs[i].sib_type)
                     {
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2:
-                        err = liblte_rrc_unpack_sys_info_block_type_2_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_2_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3:
-                        err = liblte_rrc_unpack_sys_info_block_type_3_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_3_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4:
-                        err = liblte_rrc_unpack_sys_info_block_type_4_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_4_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_4_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5:
-                        err = liblte_rrc_unpack_sys_info_block_type_5_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_5_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_5_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6:
-                        err = liblte_rrc_unpack_sys_info_block_type_6_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_6_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_6_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7:
-                        err = liblte_rrc_unpack_sys_info_block_type_7_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_7_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_7_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8:
-                        err = liblte_rrc_unpack_sys_info_block_type_8_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_8_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_8_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9:
-                        err = liblte_rrc_unpack_sys_info_block_type_9_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_9_ie(msg,
                                                                          (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_9_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_10:
@@ -11134,24 +11122,24 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
                         break;
                     }
                 }else{
-                    sibs->sibs[i].sib_type    = (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_ENUM)(liblte_bits_2_value(&msg_ptr, 7) + 10);
+                    sibs->sibs[i].sib_type    = (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_ENUM)(liblte_bits_2_value(msg, 7) + 10);
                     length_determinant_octets = 0;
-                    if(0 == liblte_bits_2_value(&msg_ptr, 1))
+                    if(0 == liblte_bits_2_value(msg, 1))
                     {
-                        length_determinant_octets = liblte_bits_2_value(&msg_ptr, 7);
+                        length_determinant_octets = liblte_bits_2_value(msg, 7);
                     }else{
-                        if(0 == liblte_bits_2_value(&msg_ptr, 1))
+                        if(0 == liblte_bits_2_value(msg, 1))
                         {
-                            length_determinant_octets = liblte_bits_2_value(&msg_ptr, 14);
+                            length_determinant_octets = liblte_bits_2_value(msg, 14);
                         }else{
                             printf("ERROR: Not handling fragmented length determinants\n");
                         }
                     }
-                    head_ptr = msg_ptr;
+                    head_offset = msg->N_bits;
                     switch(sibs->sibs[i].sib_type)
                     {
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13:
-                        err = liblte_rrc_unpack_sys_info_block_type_13_ie(&msg_ptr,
+                        err = liblte_rrc_unpack_sys_info_block_type_13_ie(msg,
                                                                           (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_13_STRUCT *)&sibs->sibs[i].sib);
                         break;
                     case LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_12:
@@ -11160,7 +11148,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
                         err = LIBLTE_ERROR_INVALID_INPUTS;
                         break;
                     }
-                    liblte_bits_2_value(&msg_ptr, (msg_ptr - head_ptr) % 8);
+                    liblte_bits_2_value(msg, (msg->N_bits - head_offset) % 8);
                 }
 
                 if(LIBLTE_SUCCESS != err)
@@ -11169,7 +11157,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
                 }
             }
             
-            liblte_rrc_consume_noncrit_extension(non_crit_ext_opt, __func__, &msg_ptr);
+            liblte_rrc_consume_noncrit_extension(non_crit_ext_opt, __func__, msg);
                     
         }else{
             printf("ERROR: Not handling critical extensions in system information message\n");
@@ -11188,52 +11176,47 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_sys_info_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_failure_msg(LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(security_mode_failure != NULL &&
        msg                   != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_failure->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_CURSOR_STRUCT                *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *security_mode_failure)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                   != NULL &&
        security_mode_failure != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &security_mode_failure->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -11250,52 +11233,47 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_failure_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_complete_msg(LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete,
-                                                             LIBLTE_BIT_MSG_STRUCT                    *msg)
+                                                             LIBLTE_BIT_CURSOR_STRUCT                 *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(security_mode_complete != NULL &&
        msg                    != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_complete->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_STRUCT                    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_CURSOR_STRUCT                 *msg,
                                                                LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *security_mode_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                    != NULL &&
        security_mode_complete != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &security_mode_complete->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11311,74 +11289,69 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_complete_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_security_mode_command_msg(LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd,
-                                                            LIBLTE_BIT_MSG_STRUCT                   *msg)
+                                                            LIBLTE_BIT_CURSOR_STRUCT                *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(security_mode_cmd != NULL &&
        msg               != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(security_mode_cmd->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Extension indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Security Algorithms Config
         liblte_rrc_pack_security_algorithm_config_ie(&security_mode_cmd->sec_algs,
-                                                     &msg_ptr);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+                                                     msg);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STRUCT                   *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_CURSOR_STRUCT                *msg,
                                                               LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *security_mode_cmd)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
-    if(msg_ptr           != NULL &&
+    if(msg               != NULL &&
        security_mode_cmd != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &security_mode_cmd->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Extension indicator
-        bool ext2 = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext2 = liblte_bits_2_value(msg, 1);
        
-        liblte_rrc_consume_noncrit_extension(ext2, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext2, __func__, msg);
         
         // Security Algorithms Config
-        liblte_rrc_unpack_security_algorithm_config_ie(&msg_ptr,
+        liblte_rrc_unpack_security_algorithm_config_ie(msg,
                                                        &security_mode_cmd->sec_algs);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11395,112 +11368,107 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_security_mode_command_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_complete_msg(LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete,
-                                                                    LIBLTE_BIT_MSG_STRUCT                       *msg)
+                                                                    LIBLTE_BIT_CURSOR_STRUCT                    *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_setup_complete != NULL &&
        msg                != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_setup_complete->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicators
-        liblte_value_2_bits(con_setup_complete->registered_mme_present, &msg_ptr, 1);
-        liblte_value_2_bits(0,                                          &msg_ptr, 1);
+        liblte_value_2_bits(con_setup_complete->registered_mme_present, msg, 1);
+        liblte_value_2_bits(0,                                          msg, 1);
 
         // Selected PLMN identity
-        liblte_value_2_bits(con_setup_complete->selected_plmn_id - 1, &msg_ptr, 3);
+        liblte_value_2_bits(con_setup_complete->selected_plmn_id - 1, msg, 3);
 
         // Registered MME
         if(con_setup_complete->registered_mme_present)
         {
             // Optional indicator
-            liblte_value_2_bits(con_setup_complete->registered_mme.plmn_id_present, &msg_ptr, 1);
+            liblte_value_2_bits(con_setup_complete->registered_mme.plmn_id_present, msg, 1);
 
             // PLMN identity
             if(con_setup_complete->registered_mme.plmn_id_present)
             {
-                liblte_rrc_pack_plmn_identity_ie(&con_setup_complete->registered_mme.plmn_id, &msg_ptr);
+                liblte_rrc_pack_plmn_identity_ie(&con_setup_complete->registered_mme.plmn_id, msg);
             }
 
             // MMEGI
-            liblte_value_2_bits(con_setup_complete->registered_mme.mmegi, &msg_ptr, 16);
+            liblte_value_2_bits(con_setup_complete->registered_mme.mmegi, msg, 16);
 
             // MMEC
-            liblte_rrc_pack_mmec_ie(con_setup_complete->registered_mme.mmec, &msg_ptr);
+            liblte_rrc_pack_mmec_ie(con_setup_complete->registered_mme.mmec, msg);
         }
 
         // Dedicated info NAS
         liblte_rrc_pack_dedicated_info_nas_ie(&con_setup_complete->dedicated_info_nas,
-                                              &msg_ptr);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+                                              msg);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_MSG_STRUCT                       *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT_CURSOR_STRUCT                    *msg,
                                                                       LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *con_setup_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                != NULL &&
        con_setup_complete != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_setup_complete->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicators
-        con_setup_complete->registered_mme_present = liblte_bits_2_value(&msg_ptr, 1);
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        con_setup_complete->registered_mme_present = liblte_bits_2_value(msg, 1);
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
         
         // Selected PLMN identity
-        con_setup_complete->selected_plmn_id = liblte_bits_2_value(&msg_ptr, 3) + 1;
+        con_setup_complete->selected_plmn_id = liblte_bits_2_value(msg, 3) + 1;
 
         // Registered MME
         if(con_setup_complete->registered_mme_present)
         {
             // Optional indicator
-            con_setup_complete->registered_mme.plmn_id_present = liblte_bits_2_value(&msg_ptr, 1);
+            con_setup_complete->registered_mme.plmn_id_present = liblte_bits_2_value(msg, 1);
 
             // PLMN identity
             if(con_setup_complete->registered_mme.plmn_id_present)
             {
-                liblte_rrc_unpack_plmn_identity_ie(&msg_ptr, &con_setup_complete->registered_mme.plmn_id);
+                liblte_rrc_unpack_plmn_identity_ie(msg, &con_setup_complete->registered_mme.plmn_id);
             }
 
             // MMEGI
-            con_setup_complete->registered_mme.mmegi = liblte_bits_2_value(&msg_ptr, 16);
+            con_setup_complete->registered_mme.mmegi = liblte_bits_2_value(msg, 16);
 
             // MMEC
-            liblte_rrc_unpack_mmec_ie(&msg_ptr, &con_setup_complete->registered_mme.mmec);
+            liblte_rrc_unpack_mmec_ie(msg, &con_setup_complete->registered_mme.mmec);
         }
 
         // Dedicated info NAS
-        liblte_rrc_unpack_dedicated_info_nas_ie(&msg_ptr,
+        liblte_rrc_unpack_dedicated_info_nas_ie(msg,
                                                 &con_setup_complete->dedicated_info_nas);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11516,64 +11484,59 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_complete_msg(LIBLTE_BIT
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_setup_msg(LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup,
-                                                           LIBLTE_BIT_MSG_STRUCT              *msg)
+                                                           LIBLTE_BIT_CURSOR_STRUCT           *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_setup != NULL &&
        msg       != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_setup->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 3);
+        liblte_value_2_bits(0, msg, 3);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Radio Resource Config Dedicated
-        liblte_rrc_pack_rr_config_dedicated_ie(&con_setup->rr_cnfg, &msg_ptr);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_rrc_pack_rr_config_dedicated_ie(&con_setup->rr_cnfg, msg);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRUCT              *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_CURSOR_STRUCT           *msg,
                                                              LIBLTE_RRC_CONNECTION_SETUP_STRUCT *con_setup)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg       != NULL &&
        con_setup != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_setup->rrc_transaction_id);
 
         // Critical extension indicator
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 3);
+        liblte_bits_2_value(msg, 3);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Radio Resource Config Dedicated
-        liblte_rrc_unpack_rr_config_dedicated_ie(&msg_ptr, &con_setup->rr_cnfg);
+        liblte_rrc_unpack_rr_config_dedicated_ie(msg, &con_setup->rr_cnfg);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11590,41 +11553,37 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_setup_msg(LIBLTE_BIT_MSG_STRU
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                             LIBLTE_BIT_CURSOR_STRUCT             *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(con_req != NULL &&
        msg     != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         // UE Identity Type
-        liblte_value_2_bits(con_req->ue_id_type, &msg_ptr, 1);
+        liblte_value_2_bits(con_req->ue_id_type, msg, 1);
 
         // UE Identity
         if(LIBLTE_RRC_CON_REQ_UE_ID_TYPE_S_TMSI == con_req->ue_id_type)
         {
             liblte_rrc_pack_s_tmsi_ie((LIBLTE_RRC_S_TMSI_STRUCT *)&con_req->ue_id,
-                                      &msg_ptr);
+                                      msg);
         }else{ // LIBLTE_RRC_CON_REQ_UE_ID_TYPE_RANDOM_VALUE == con_req->ue_id_type
-            liblte_value_2_bits((uint32)(con_req->ue_id.random >> 32), &msg_ptr, 8);
-            liblte_value_2_bits((uint32)(con_req->ue_id.random), &msg_ptr, 32);
+            liblte_value_2_bits((uint32)(con_req->ue_id.random >> 32), msg, 8);
+            liblte_value_2_bits((uint32)(con_req->ue_id.random), msg, 32);
         }
 
         // Establishment Cause
-        liblte_value_2_bits(con_req->cause, &msg_ptr, 3);
+        liblte_value_2_bits(con_req->cause, msg, 3);
 
         // Spare
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
       
@@ -11632,35 +11591,34 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_request_msg(LIBLTE_RRC_CONNECTI
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_CURSOR_STRUCT             *msg,
                                                                LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *con_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg     != NULL &&
        con_req != NULL)
     {
         // Extension Choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
         
         // UE Identity Type
-        con_req->ue_id_type = (LIBLTE_RRC_CON_REQ_UE_ID_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+        con_req->ue_id_type = (LIBLTE_RRC_CON_REQ_UE_ID_TYPE_ENUM)liblte_bits_2_value(msg, 1);
 
         // UE Identity
         if(LIBLTE_RRC_CON_REQ_UE_ID_TYPE_S_TMSI == con_req->ue_id_type)
         {
-            liblte_rrc_unpack_s_tmsi_ie(&msg_ptr,
+            liblte_rrc_unpack_s_tmsi_ie(msg,
                                         (LIBLTE_RRC_S_TMSI_STRUCT *)&con_req->ue_id);
         }else{ // LIBLTE_RRC_CON_REQ_UE_ID_TYPE_RANDOM_VALUE == con_req->ue_id_type
-            con_req->ue_id.random  = (uint64)liblte_bits_2_value(&msg_ptr, 8) << 32;
-            con_req->ue_id.random |= liblte_bits_2_value(&msg_ptr, 32);
+            con_req->ue_id.random  = (uint64)liblte_bits_2_value(msg, 8) << 32;
+            con_req->ue_id.random |= liblte_bits_2_value(msg, 32);
         }
 
         // Establishment Cause
-        con_req->cause = (LIBLTE_RRC_CON_REQ_EST_CAUSE_ENUM)liblte_bits_2_value(&msg_ptr, 3);
+        con_req->cause = (LIBLTE_RRC_CON_REQ_EST_CAUSE_ENUM)liblte_bits_2_value(msg, 3);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11676,68 +11634,63 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_request_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_release_msg(LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release,
-                                                             LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                             LIBLTE_BIT_CURSOR_STRUCT             *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_release != NULL &&
        msg         != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_release->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicators
-        liblte_value_2_bits(0, &msg_ptr, 1);
-        liblte_value_2_bits(0, &msg_ptr, 1);
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
+        liblte_value_2_bits(0, msg, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Release cause
-        liblte_value_2_bits(con_release->release_cause, &msg_ptr, 2);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(con_release->release_cause, msg, 2);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_CURSOR_STRUCT             *msg,
                                                                LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *con_release)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg         != NULL &&
        con_release != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_release->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicators
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Release cause
-        con_release->release_cause = (LIBLTE_RRC_RELEASE_CAUSE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
+        con_release->release_cause = (LIBLTE_RRC_RELEASE_CAUSE_ENUM)liblte_bits_2_value(msg, 2);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11753,56 +11706,51 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_release_msg(LIBLTE_BIT_MSG_ST
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reject_msg(LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej,
-                                                            LIBLTE_BIT_MSG_STRUCT               *msg)
+                                                            LIBLTE_BIT_CURSOR_STRUCT            *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_rej != NULL &&
        msg     != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Wait Time
-        liblte_value_2_bits(con_rej->wait_time - 1, &msg_ptr, 4);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(con_rej->wait_time - 1, msg, 4);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STRUCT               *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_CURSOR_STRUCT            *msg,
                                                               LIBLTE_RRC_CONNECTION_REJECT_STRUCT *con_rej)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg     != NULL &&
        con_rej != NULL)
     {
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Wait Time
-        con_rej->wait_time = liblte_bits_2_value(&msg_ptr, 4) + 1;
+        con_rej->wait_time = liblte_bits_2_value(msg, 4) + 1;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11819,33 +11767,29 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reject_msg(LIBLTE_BIT_MSG_STR
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req,
-                                                                             LIBLTE_BIT_MSG_STRUCT                                *msg)
+                                                                             LIBLTE_BIT_CURSOR_STRUCT                             *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(con_reest_req != NULL &&
        msg           != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         if(!ext)
         {
             // UE Identity
-            liblte_rrc_pack_c_rnti_ie((uint16)con_reest_req->ue_id.c_rnti, &msg_ptr);
-            liblte_rrc_pack_phys_cell_id_ie((uint16)con_reest_req->ue_id.phys_cell_id, &msg_ptr);
-            liblte_rrc_pack_short_mac_i_ie((uint16)con_reest_req->ue_id.short_mac_i, &msg_ptr);
+            liblte_rrc_pack_c_rnti_ie((uint16)con_reest_req->ue_id.c_rnti, msg);
+            liblte_rrc_pack_phys_cell_id_ie((uint16)con_reest_req->ue_id.phys_cell_id, msg);
+            liblte_rrc_pack_short_mac_i_ie((uint16)con_reest_req->ue_id.short_mac_i, msg);
 
             // Reestablishment Cause
-            liblte_value_2_bits(con_reest_req->cause, &msg_ptr, 2);
+            liblte_value_2_bits(con_reest_req->cause, msg, 2);
 
             // Spare
-            liblte_value_2_bits(0, &msg_ptr, 2);
-
-            // Fill in the number of bits used
-            msg->N_bits = msg_ptr - msg->msg;
+            liblte_value_2_bits(0, msg, 2);
 
             err = LIBLTE_SUCCESS;
         }
@@ -11853,27 +11797,26 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_request_msg(LIB
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_MSG_STRUCT                                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(LIBLTE_BIT_CURSOR_STRUCT                             *msg,
                                                                                LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *con_reest_req)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        con_reest_req != NULL)
     {
         // Extension Choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
         
         // UE Identity
-        liblte_rrc_unpack_c_rnti_ie(&msg_ptr, &con_reest_req->ue_id.c_rnti);
-        liblte_rrc_unpack_phys_cell_id_ie(&msg_ptr, &con_reest_req->ue_id.phys_cell_id);
-        liblte_rrc_unpack_short_mac_i_ie(&msg_ptr, &con_reest_req->ue_id.short_mac_i);
+        liblte_rrc_unpack_c_rnti_ie(msg, &con_reest_req->ue_id.c_rnti);
+        liblte_rrc_unpack_phys_cell_id_ie(msg, &con_reest_req->ue_id.phys_cell_id);
+        liblte_rrc_unpack_short_mac_i_ie(msg, &con_reest_req->ue_id.short_mac_i);
 
         // Reestablishment Cause
-        con_reest_req->cause = (LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
+        con_reest_req->cause = (LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM)liblte_bits_2_value(msg, 2);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11890,44 +11833,39 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(L
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_reject_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej,
-                                                                            LIBLTE_BIT_MSG_STRUCT                               *msg)
+                                                                            LIBLTE_BIT_CURSOR_STRUCT                            *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_reest_rej != NULL &&
        msg           != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_MSG_STRUCT                               *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LIBLTE_BIT_CURSOR_STRUCT                            *msg,
                                                                               LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *con_reest_rej)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        con_reest_rej != NULL)
     {
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -11944,52 +11882,47 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(LI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_complete_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg)
+                                                                              LIBLTE_BIT_CURSOR_STRUCT                              *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_reest_complete != NULL &&
        msg                != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reest_complete->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(LIBLTE_BIT_CURSOR_STRUCT                              *msg,
                                                                                 LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *con_reest_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                != NULL &&
        con_reest_complete != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_reest_complete->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -12005,70 +11938,65 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reestablishment_msg(LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg)
+                                                                     LIBLTE_BIT_CURSOR_STRUCT                     *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_reest != NULL &&
        msg       != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reest->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 3);
+        liblte_value_2_bits(0, msg, 3);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Radio Resource Config Dedicated
-        liblte_rrc_pack_rr_config_dedicated_ie(&con_reest->rr_cnfg, &msg_ptr);
+        liblte_rrc_pack_rr_config_dedicated_ie(&con_reest->rr_cnfg, msg);
 
         // Next Hop Chaining Count
-        liblte_rrc_pack_next_hop_chaining_count_ie(con_reest->next_hop_chaining_count, &msg_ptr);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_rrc_pack_next_hop_chaining_count_ie(con_reest->next_hop_chaining_count, msg);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BIT_CURSOR_STRUCT                     *msg,
                                                                        LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *con_reest)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg       != NULL &&
        con_reest != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_reest->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 3);
+        liblte_bits_2_value(msg, 3);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Radio Resource Config Dedicated
-        liblte_rrc_unpack_rr_config_dedicated_ie(&msg_ptr, &con_reest->rr_cnfg);
+        liblte_rrc_unpack_rr_config_dedicated_ie(msg, &con_reest->rr_cnfg);
 
         // Next Hop Chaining Count
-        liblte_rrc_unpack_next_hop_chaining_count_ie(&msg_ptr, &con_reest->next_hop_chaining_count);
+        liblte_rrc_unpack_next_hop_chaining_count_ie(msg, &con_reest->next_hop_chaining_count);
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -12085,52 +12013,47 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reestablishment_msg(LIBLTE_BI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete,
-                                                                              LIBLTE_BIT_MSG_STRUCT                                 *msg)
+                                                                              LIBLTE_BIT_CURSOR_STRUCT                              *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(con_reconfig_complete != NULL &&
        msg                   != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(con_reconfig_complete->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                                 *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(LIBLTE_BIT_CURSOR_STRUCT                              *msg,
                                                                                 LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *con_reconfig_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                   != NULL &&
        con_reconfig_complete != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &con_reconfig_complete->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -12146,115 +12069,110 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rrc_connection_reconfiguration_msg(LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig,
-                                                                     LIBLTE_BIT_MSG_STRUCT                        *msg)
+                                                                     LIBLTE_BIT_CURSOR_STRUCT                     *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
 
     if(con_reconfig != NULL &&
        msg          != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_pack_rrc_transaction_identifier_ie(con_reconfig->rrc_transaction_id, &msg_ptr);
+        liblte_rrc_pack_rrc_transaction_identifier_ie(con_reconfig->rrc_transaction_id, msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 3);
+        liblte_value_2_bits(0, msg, 3);
 
         // Optional indicators
-        liblte_value_2_bits(con_reconfig->meas_cnfg_present,     &msg_ptr, 1);
-        liblte_value_2_bits(con_reconfig->mob_ctrl_info_present, &msg_ptr, 1);
+        liblte_value_2_bits(con_reconfig->meas_cnfg_present,     msg, 1);
+        liblte_value_2_bits(con_reconfig->mob_ctrl_info_present, msg, 1);
         if(0 == con_reconfig->N_ded_info_nas)
         {
-            liblte_value_2_bits(0, &msg_ptr, 1);
+            liblte_value_2_bits(0, msg, 1);
         }else{
-            liblte_value_2_bits(1, &msg_ptr, 1);
+            liblte_value_2_bits(1, msg, 1);
         }
-        liblte_value_2_bits(con_reconfig->rr_cnfg_ded_present, &msg_ptr, 1);
-        liblte_value_2_bits(con_reconfig->sec_cnfg_ho_present, &msg_ptr, 1);
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(con_reconfig->rr_cnfg_ded_present, msg, 1);
+        liblte_value_2_bits(con_reconfig->sec_cnfg_ho_present, msg, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Meas Config
         if(con_reconfig->meas_cnfg_present)
         {
-            liblte_rrc_pack_meas_config_ie(&con_reconfig->meas_cnfg, &msg_ptr);
+            liblte_rrc_pack_meas_config_ie(&con_reconfig->meas_cnfg, msg);
         }
 
         // Mobility Control Info
         if(con_reconfig->mob_ctrl_info_present)
         {
-            liblte_rrc_pack_mobility_control_info_ie(&con_reconfig->mob_ctrl_info, &msg_ptr);
+            liblte_rrc_pack_mobility_control_info_ie(&con_reconfig->mob_ctrl_info, msg);
         }
 
         // Dedicated Info NAS List
         if(0 != con_reconfig->N_ded_info_nas)
         {
-            liblte_value_2_bits(con_reconfig->N_ded_info_nas - 1, &msg_ptr, 4);
+            liblte_value_2_bits(con_reconfig->N_ded_info_nas - 1, msg, 4);
         }
         for(i=0; i<con_reconfig->N_ded_info_nas; i++)
         {
-            liblte_rrc_pack_dedicated_info_nas_ie(&con_reconfig->ded_info_nas_list[i], &msg_ptr);
+            liblte_rrc_pack_dedicated_info_nas_ie(&con_reconfig->ded_info_nas_list[i], msg);
         }
 
         // Radio Resource Config Dedicated
         if(con_reconfig->rr_cnfg_ded_present)
         {
-            liblte_rrc_pack_rr_config_dedicated_ie(&con_reconfig->rr_cnfg_ded, &msg_ptr);
+            liblte_rrc_pack_rr_config_dedicated_ie(&con_reconfig->rr_cnfg_ded, msg);
         }
 
         // Security Config HO
         if(con_reconfig->sec_cnfg_ho_present)
         {
             // Extension indicator
-            liblte_value_2_bits(0, &msg_ptr, 1);
+            liblte_value_2_bits(0, msg, 1);
 
             // Handover Type
-            liblte_value_2_bits(con_reconfig->sec_cnfg_ho.ho_type, &msg_ptr, 1);
+            liblte_value_2_bits(con_reconfig->sec_cnfg_ho.ho_type, msg, 1);
 
             if(LIBLTE_RRC_HANDOVER_TYPE_INTRA_LTE == con_reconfig->sec_cnfg_ho.ho_type)
             {
                 // Optional indicator
-                liblte_value_2_bits(con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present, &msg_ptr, 1);
+                liblte_value_2_bits(con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present, msg, 1);
 
                 // Security Algorithm Config
                 if(con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present)
                 {
-                    liblte_rrc_pack_security_algorithm_config_ie(&con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg, &msg_ptr);
+                    liblte_rrc_pack_security_algorithm_config_ie(&con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg, msg);
                 }
 
                 // Key Change Indicator
-                liblte_value_2_bits(con_reconfig->sec_cnfg_ho.intra_lte.key_change_ind, &msg_ptr, 1);
+                liblte_value_2_bits(con_reconfig->sec_cnfg_ho.intra_lte.key_change_ind, msg, 1);
 
                 // Next Hop Chaining Count
-                liblte_rrc_pack_next_hop_chaining_count_ie(con_reconfig->sec_cnfg_ho.intra_lte.next_hop_chaining_count, &msg_ptr);
+                liblte_rrc_pack_next_hop_chaining_count_ie(con_reconfig->sec_cnfg_ho.intra_lte.next_hop_chaining_count, msg);
             }else{
                 // Security Algorithm Config
-                liblte_rrc_pack_security_algorithm_config_ie(&con_reconfig->sec_cnfg_ho.inter_rat.sec_alg_cnfg, &msg_ptr);
+                liblte_rrc_pack_security_algorithm_config_ie(&con_reconfig->sec_cnfg_ho.inter_rat.sec_alg_cnfg, msg);
 
                 // NAS Security Params To EUTRA
                 for(i=0; i<6; i++)
                 {
-                    liblte_value_2_bits(con_reconfig->sec_cnfg_ho.inter_rat.nas_sec_param_to_eutra[i], &msg_ptr, 8);
+                    liblte_value_2_bits(con_reconfig->sec_cnfg_ho.inter_rat.nas_sec_param_to_eutra[i], msg, 8);
                 }
             }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_MSG_STRUCT                        *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BIT_CURSOR_STRUCT                     *msg,
                                                                        LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *con_reconfig)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
     bool               ded_info_nas_list_present;
 
@@ -12262,41 +12180,41 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BI
        con_reconfig != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr, &con_reconfig->rrc_transaction_id);
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg, &con_reconfig->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 3);
+        liblte_bits_2_value(msg, 3);
 
         // Optional indicators
-        con_reconfig->meas_cnfg_present     = liblte_bits_2_value(&msg_ptr, 1);
-        con_reconfig->mob_ctrl_info_present = liblte_bits_2_value(&msg_ptr, 1);
-        ded_info_nas_list_present           = liblte_bits_2_value(&msg_ptr, 1);
-        con_reconfig->rr_cnfg_ded_present   = liblte_bits_2_value(&msg_ptr, 1);
-        con_reconfig->sec_cnfg_ho_present   = liblte_bits_2_value(&msg_ptr, 1);
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        con_reconfig->meas_cnfg_present     = liblte_bits_2_value(msg, 1);
+        con_reconfig->mob_ctrl_info_present = liblte_bits_2_value(msg, 1);
+        ded_info_nas_list_present           = liblte_bits_2_value(msg, 1);
+        con_reconfig->rr_cnfg_ded_present   = liblte_bits_2_value(msg, 1);
+        con_reconfig->sec_cnfg_ho_present   = liblte_bits_2_value(msg, 1);
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Meas Config
         if(con_reconfig->meas_cnfg_present)
         {
-            liblte_rrc_unpack_meas_config_ie(&msg_ptr, &con_reconfig->meas_cnfg);
+            liblte_rrc_unpack_meas_config_ie(msg, &con_reconfig->meas_cnfg);
         }
 
         // Mobility Control Info
         if(con_reconfig->mob_ctrl_info_present)
         {
-            liblte_rrc_unpack_mobility_control_info_ie(&msg_ptr, &con_reconfig->mob_ctrl_info);
+            liblte_rrc_unpack_mobility_control_info_ie(msg, &con_reconfig->mob_ctrl_info);
         }
 
         // Dedicated Info NAS List
         if(ded_info_nas_list_present)
         {
-            con_reconfig->N_ded_info_nas = liblte_bits_2_value(&msg_ptr, 4) + 1;
+            con_reconfig->N_ded_info_nas = liblte_bits_2_value(msg, 4) + 1;
             for(i=0; i<con_reconfig->N_ded_info_nas; i++)
             {
-                liblte_rrc_unpack_dedicated_info_nas_ie(&msg_ptr, &con_reconfig->ded_info_nas_list[i]);
+                liblte_rrc_unpack_dedicated_info_nas_ie(msg, &con_reconfig->ded_info_nas_list[i]);
             }
         }else{
             con_reconfig->N_ded_info_nas = 0;
@@ -12305,49 +12223,49 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BI
         // Radio Resource Config Dedicated
         if(con_reconfig->rr_cnfg_ded_present)
         {
-            liblte_rrc_unpack_rr_config_dedicated_ie(&msg_ptr, &con_reconfig->rr_cnfg_ded);
+            liblte_rrc_unpack_rr_config_dedicated_ie(msg, &con_reconfig->rr_cnfg_ded);
         }
 
         // Security Config HO
         if(con_reconfig->sec_cnfg_ho_present)
         {
             // Extension indicator
-            bool ext2 = liblte_bits_2_value(&msg_ptr, 1);
+            bool ext2 = liblte_bits_2_value(msg, 1);
 
             // Handover Type
-            con_reconfig->sec_cnfg_ho.ho_type = (LIBLTE_RRC_HANDOVER_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+            con_reconfig->sec_cnfg_ho.ho_type = (LIBLTE_RRC_HANDOVER_TYPE_ENUM)liblte_bits_2_value(msg, 1);
 
             if(LIBLTE_RRC_HANDOVER_TYPE_INTRA_LTE == con_reconfig->sec_cnfg_ho.ho_type)
             {
                 // Optional indicator
-                con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present = liblte_bits_2_value(&msg_ptr, 1);
+                con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present = liblte_bits_2_value(msg, 1);
 
                 // Security Algorithm Config
                 if(con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg_present)
                 {
-                    liblte_rrc_unpack_security_algorithm_config_ie(&msg_ptr, &con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg);
+                    liblte_rrc_unpack_security_algorithm_config_ie(msg, &con_reconfig->sec_cnfg_ho.intra_lte.sec_alg_cnfg);
                 }
 
                 // Key Change Indicator
-                con_reconfig->sec_cnfg_ho.intra_lte.key_change_ind = liblte_bits_2_value(&msg_ptr, 1);
+                con_reconfig->sec_cnfg_ho.intra_lte.key_change_ind = liblte_bits_2_value(msg, 1);
 
                 // Next Hop Chaining Count
-                liblte_rrc_unpack_next_hop_chaining_count_ie(&msg_ptr, &con_reconfig->sec_cnfg_ho.intra_lte.next_hop_chaining_count);
+                liblte_rrc_unpack_next_hop_chaining_count_ie(msg, &con_reconfig->sec_cnfg_ho.intra_lte.next_hop_chaining_count);
             }else{
                 // Security Algorithm Config
-                liblte_rrc_unpack_security_algorithm_config_ie(&msg_ptr, &con_reconfig->sec_cnfg_ho.inter_rat.sec_alg_cnfg);
+                liblte_rrc_unpack_security_algorithm_config_ie(msg, &con_reconfig->sec_cnfg_ho.inter_rat.sec_alg_cnfg);
 
                 // NAS Security Params To EUTRA
                 for(i=0; i<6; i++)
                 {
-                    con_reconfig->sec_cnfg_ho.inter_rat.nas_sec_param_to_eutra[i] = liblte_bits_2_value(&msg_ptr, 8);
+                    con_reconfig->sec_cnfg_ho.inter_rat.nas_sec_param_to_eutra[i] = liblte_bits_2_value(msg, 8);
                 }
             }
             
-            liblte_rrc_consume_noncrit_extension(ext2, __func__, &msg_ptr);
+            liblte_rrc_consume_noncrit_extension(ext2, __func__, msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -12364,60 +12282,55 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rrc_connection_reconfiguration_msg(LIBLTE_BI
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_rn_reconfiguration_complete_msg(LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete,
-                                                                  LIBLTE_BIT_MSG_STRUCT                         *msg)
+                                                                  LIBLTE_BIT_CURSOR_STRUCT                      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(rn_reconfig_complete != NULL &&
        msg                  != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(rn_reconfig_complete->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicators
-        liblte_value_2_bits(0, &msg_ptr, 1);
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_MSG_STRUCT                         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_CURSOR_STRUCT                      *msg,
                                                                     LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *rn_reconfig_complete)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                  != NULL &&
        rn_reconfig_complete != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &rn_reconfig_complete->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicators
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -12445,88 +12358,83 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_rn_reconfiguration_complete_msg(LIBLTE_BIT_M
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_proximity_indication_msg(LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind,
-                                                           LIBLTE_BIT_MSG_STRUCT                  *msg)
+                                                           LIBLTE_BIT_CURSOR_STRUCT               *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(proximity_ind != NULL &&
        msg           != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Proximity indication type
-        liblte_value_2_bits(proximity_ind->type, &msg_ptr, 1);
+        liblte_value_2_bits(proximity_ind->type, msg, 1);
 
         // Carrier frequency type extension indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Carrier frequency choice
-        liblte_value_2_bits(proximity_ind->carrier_freq_type, &msg_ptr, 1);
+        liblte_value_2_bits(proximity_ind->carrier_freq_type, msg, 1);
 
         // Carrier frequency
         if(LIBLTE_RRC_PROXIMITY_INDICATION_CARRIER_FREQ_TYPE_EUTRA == proximity_ind->carrier_freq_type)
         {
             liblte_rrc_pack_arfcn_value_eutra_ie(proximity_ind->carrier_freq,
-                                                 &msg_ptr);
+                                                 msg);
         }else{
             liblte_rrc_pack_arfcn_value_utra_ie(proximity_ind->carrier_freq,
-                                                &msg_ptr);
+                                                msg);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRUCT                  *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_CURSOR_STRUCT               *msg,
                                                              LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *proximity_ind)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg           != NULL &&
        proximity_ind != NULL)
     {
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Proximity indication type
-        proximity_ind->type = (LIBLTE_RRC_PROXIMITY_INDICATION_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+        proximity_ind->type = (LIBLTE_RRC_PROXIMITY_INDICATION_TYPE_ENUM)liblte_bits_2_value(msg, 1);
 
         // Carrier frequency type extension indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Carrier frequency type
-        proximity_ind->carrier_freq_type = (LIBLTE_RRC_PROXIMITY_INDICATION_CARRIER_FREQ_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+        proximity_ind->carrier_freq_type = (LIBLTE_RRC_PROXIMITY_INDICATION_CARRIER_FREQ_TYPE_ENUM)liblte_bits_2_value(msg, 1);
 
         // Carrier frequency
         if(LIBLTE_RRC_PROXIMITY_INDICATION_CARRIER_FREQ_TYPE_EUTRA == proximity_ind->carrier_freq)
         {
-            liblte_rrc_unpack_arfcn_value_eutra_ie(&msg_ptr,
+            liblte_rrc_unpack_arfcn_value_eutra_ie(msg,
                                                    &proximity_ind->carrier_freq);
         }else{
-            liblte_rrc_unpack_arfcn_value_utra_ie(&msg_ptr,
+            liblte_rrc_unpack_arfcn_value_utra_ie(msg,
                                                   &proximity_ind->carrier_freq);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -12542,10 +12450,9 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_proximity_indication_msg(LIBLTE_BIT_MSG_STRU
     Document Reference: 36.331 v10.0.0 Section 6.2.2
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
-                                             LIBLTE_BIT_MSG_STRUCT    *msg)
+                                             LIBLTE_BIT_CURSOR_STRUCT *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
 
@@ -12555,60 +12462,60 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
         // Optional indicators
         if(page->paging_record_list_size != 0)
         {
-            liblte_value_2_bits(1, &msg_ptr, 1);
+            liblte_value_2_bits(1, msg, 1);
         }else{
-            liblte_value_2_bits(0, &msg_ptr, 1);
+            liblte_value_2_bits(0, msg, 1);
         }
-        liblte_value_2_bits(page->system_info_modification_present, &msg_ptr, 1);
-        liblte_value_2_bits(page->etws_indication_present,          &msg_ptr, 1);
-        liblte_value_2_bits(page->non_crit_ext_present,             &msg_ptr, 1);
+        liblte_value_2_bits(page->system_info_modification_present, msg, 1);
+        liblte_value_2_bits(page->etws_indication_present,          msg, 1);
+        liblte_value_2_bits(page->non_crit_ext_present,             msg, 1);
 
         if(page->paging_record_list_size != 0)
         {
-            liblte_value_2_bits(page->paging_record_list_size - 1, &msg_ptr, 4);
+            liblte_value_2_bits(page->paging_record_list_size - 1, msg, 4);
             for(i=0; i<page->paging_record_list_size; i++)
             {
                 // Extension indicator
-                liblte_value_2_bits(0, &msg_ptr, 1);
+                liblte_value_2_bits(0, msg, 1);
 
                 // Paging UE identity
                 {
                     // Extension indicator
-                    liblte_value_2_bits(0, &msg_ptr, 1);
+                    liblte_value_2_bits(0, msg, 1);
 
-                    liblte_value_2_bits(page->paging_record_list[i].ue_identity.ue_identity_type, &msg_ptr, 1);
+                    liblte_value_2_bits(page->paging_record_list[i].ue_identity.ue_identity_type, msg, 1);
                     if(LIBLTE_RRC_PAGING_UE_IDENTITY_TYPE_S_TMSI == page->paging_record_list[i].ue_identity.ue_identity_type)
                     {
                         liblte_rrc_pack_s_tmsi_ie(&page->paging_record_list[i].ue_identity.s_tmsi,
-                                                  &msg_ptr);
+                                                  msg);
                     }else{
-                        liblte_value_2_bits(page->paging_record_list[i].ue_identity.imsi_size - 6, &msg_ptr, 4);
+                        liblte_value_2_bits(page->paging_record_list[i].ue_identity.imsi_size - 6, msg, 4);
                         for(j=0; j<page->paging_record_list[i].ue_identity.imsi_size; j++)
                         {
-                            liblte_value_2_bits(page->paging_record_list[i].ue_identity.imsi[j], &msg_ptr, 4);
+                            liblte_value_2_bits(page->paging_record_list[i].ue_identity.imsi[j], msg, 4);
                         }
                     }
                 }
 
-                liblte_value_2_bits(page->paging_record_list[i].cn_domain, &msg_ptr, 1);
+                liblte_value_2_bits(page->paging_record_list[i].cn_domain, msg, 1);
             }
         }
 
         if(page->system_info_modification_present)
         {
-            liblte_value_2_bits(page->system_info_modification, &msg_ptr, 1);
+            liblte_value_2_bits(page->system_info_modification, msg, 1);
         }
 
         if(page->etws_indication_present)
         {
-            liblte_value_2_bits(page->etws_indication, &msg_ptr, 1);
+            liblte_value_2_bits(page->etws_indication, msg, 1);
         }
 
         if(page->non_crit_ext_present)
         {
             // Optional indicators
-            liblte_value_2_bits(page->non_crit_ext.late_non_crit_ext_present, &msg_ptr, 1);
-            liblte_value_2_bits(page->non_crit_ext.non_crit_ext_present,      &msg_ptr, 1);
+            liblte_value_2_bits(page->non_crit_ext.late_non_crit_ext_present, msg, 1);
+            liblte_value_2_bits(page->non_crit_ext.non_crit_ext_present,      msg, 1);
 
             if(page->non_crit_ext.late_non_crit_ext_present)
             {
@@ -12618,12 +12525,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
             if(page->non_crit_ext.non_crit_ext_present)
             {
                 // Optional indicators
-                liblte_value_2_bits(page->non_crit_ext.non_crit_ext.cmas_ind_present,     &msg_ptr, 1);
-                liblte_value_2_bits(page->non_crit_ext.non_crit_ext.non_crit_ext_present, &msg_ptr, 1);
+                liblte_value_2_bits(page->non_crit_ext.non_crit_ext.cmas_ind_present,     msg, 1);
+                liblte_value_2_bits(page->non_crit_ext.non_crit_ext.non_crit_ext_present, msg, 1);
 
                 if(page->non_crit_ext.non_crit_ext.cmas_ind_present)
                 {
-                    liblte_value_2_bits(page->non_crit_ext.non_crit_ext.cmas_ind_r9, &msg_ptr, 1);
+                    liblte_value_2_bits(page->non_crit_ext.non_crit_ext.cmas_ind_r9, msg, 1);
                 }
 
                 if(page->non_crit_ext.non_crit_ext.non_crit_ext_present)
@@ -12633,17 +12540,15 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_paging_msg(LIBLTE_RRC_PAGING_STRUCT *page,
             }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_CURSOR_STRUCT *msg,
                                                LIBLTE_RRC_PAGING_STRUCT *page)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             i;
     uint32             j;
     uint8              paging_record_list_present;
@@ -12652,61 +12557,61 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
        page != NULL)
     {
         // Optional indicators
-        paging_record_list_present             = liblte_bits_2_value(&msg_ptr, 1);
-        page->system_info_modification_present = liblte_bits_2_value(&msg_ptr, 1);
-        page->etws_indication_present          = liblte_bits_2_value(&msg_ptr, 1);
-        page->non_crit_ext_present             = liblte_bits_2_value(&msg_ptr, 1);
+        paging_record_list_present             = liblte_bits_2_value(msg, 1);
+        page->system_info_modification_present = liblte_bits_2_value(msg, 1);
+        page->etws_indication_present          = liblte_bits_2_value(msg, 1);
+        page->non_crit_ext_present             = liblte_bits_2_value(msg, 1);
 
         if(paging_record_list_present)
         {
-            page->paging_record_list_size = liblte_bits_2_value(&msg_ptr, 4) + 1;
+            page->paging_record_list_size = liblte_bits_2_value(msg, 4) + 1;
             for(i=0; i<page->paging_record_list_size; i++)
             {
                 // Extension indicator
-                bool ext = liblte_bits_2_value(&msg_ptr, 1);
+                bool ext = liblte_bits_2_value(msg, 1);
 
                 // Paging UE identity
                 {
                     // Extension indicator
-                    bool ext2 = liblte_bits_2_value(&msg_ptr, 1);
+                    bool ext2 = liblte_bits_2_value(msg, 1);
 
-                    page->paging_record_list[i].ue_identity.ue_identity_type = (LIBLTE_RRC_PAGING_UE_IDENTITY_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+                    page->paging_record_list[i].ue_identity.ue_identity_type = (LIBLTE_RRC_PAGING_UE_IDENTITY_TYPE_ENUM)liblte_bits_2_value(msg, 1);
                     if(LIBLTE_RRC_PAGING_UE_IDENTITY_TYPE_S_TMSI == page->paging_record_list[i].ue_identity.ue_identity_type)
                     {
-                        liblte_rrc_unpack_s_tmsi_ie(&msg_ptr,
+                        liblte_rrc_unpack_s_tmsi_ie(msg,
                                                     &page->paging_record_list[i].ue_identity.s_tmsi);
                     }else{
-                        page->paging_record_list[i].ue_identity.imsi_size = liblte_bits_2_value(&msg_ptr, 4) + 6;
+                        page->paging_record_list[i].ue_identity.imsi_size = liblte_bits_2_value(msg, 4) + 6;
                         for(j=0; j<page->paging_record_list[i].ue_identity.imsi_size; j++)
                         {
-                            page->paging_record_list[i].ue_identity.imsi[j] = liblte_bits_2_value(&msg_ptr, 4);
+                            page->paging_record_list[i].ue_identity.imsi[j] = liblte_bits_2_value(msg, 4);
                         }
                     }
                     
-                    liblte_rrc_consume_noncrit_extension(ext2, __func__, &msg_ptr);
+                    liblte_rrc_consume_noncrit_extension(ext2, __func__, msg);
                 }
 
-                page->paging_record_list[i].cn_domain = (LIBLTE_RRC_CN_DOMAIN_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+                page->paging_record_list[i].cn_domain = (LIBLTE_RRC_CN_DOMAIN_ENUM)liblte_bits_2_value(msg, 1);
                 
-                liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+                liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
             }
         }
 
         if(page->system_info_modification_present)
         {
-            page->system_info_modification = (LIBLTE_RRC_SYSTEM_INFO_MODIFICATION_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+            page->system_info_modification = (LIBLTE_RRC_SYSTEM_INFO_MODIFICATION_ENUM)liblte_bits_2_value(msg, 1);
         }
 
         if(page->etws_indication_present)
         {
-            page->etws_indication = (LIBLTE_RRC_ETWS_INDICATION_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+            page->etws_indication = (LIBLTE_RRC_ETWS_INDICATION_ENUM)liblte_bits_2_value(msg, 1);
         }
 
         if(page->non_crit_ext_present)
         {
             // Optional indicators
-            page->non_crit_ext.late_non_crit_ext_present = liblte_bits_2_value(&msg_ptr, 1);
-            page->non_crit_ext.non_crit_ext_present      = liblte_bits_2_value(&msg_ptr, 1);
+            page->non_crit_ext.late_non_crit_ext_present = liblte_bits_2_value(msg, 1);
+            page->non_crit_ext.non_crit_ext_present      = liblte_bits_2_value(msg, 1);
 
             if(page->non_crit_ext.late_non_crit_ext_present)
             {
@@ -12717,12 +12622,12 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
             if(page->non_crit_ext.non_crit_ext_present)
             {
                 // Optional indicators
-                page->non_crit_ext.non_crit_ext.cmas_ind_present     = liblte_bits_2_value(&msg_ptr, 1);
-                page->non_crit_ext.non_crit_ext.non_crit_ext_present = liblte_bits_2_value(&msg_ptr, 1);
+                page->non_crit_ext.non_crit_ext.cmas_ind_present     = liblte_bits_2_value(msg, 1);
+                page->non_crit_ext.non_crit_ext.non_crit_ext_present = liblte_bits_2_value(msg, 1);
 
                 if(page->non_crit_ext.non_crit_ext.cmas_ind_present)
                 {
-                    page->non_crit_ext.non_crit_ext.cmas_ind_r9 = (LIBLTE_RRC_CMAS_INDICATION_R9_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+                    page->non_crit_ext.non_crit_ext.cmas_ind_r9 = (LIBLTE_RRC_CMAS_INDICATION_R9_ENUM)liblte_bits_2_value(msg, 1);
                 }
 
                 if(page->non_crit_ext.non_crit_ext.non_crit_ext_present)
@@ -12758,7 +12663,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_paging_msg(LIBLTE_BIT_MSG_STRUCT    *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_cgi_info_ie(LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info,
-                                              uint8                      **ie_ptr)
+                                              LIBLTE_BIT_CURSOR_STRUCT    *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12780,7 +12685,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_cgi_info_ie(LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_i
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(uint8                      **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(LIBLTE_BIT_CURSOR_STRUCT    *ie_ptr,
                                                 LIBLTE_RRC_CGI_INFO_STRUCT  *cgi_info)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12804,7 +12709,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_cgi_info_ie(uint8                      **ie_
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_ie(LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result,
-                                                 uint8                         **ie_ptr)
+                                                 LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12830,7 +12735,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_ie(LIBLTE_RRC_MEAS_RESULT_STRUCT
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(uint8                         **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(LIBLTE_BIT_CURSOR_STRUCT       *ie_ptr,
                                                    LIBLTE_RRC_MEAS_RESULT_STRUCT  *meas_result)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12862,7 +12767,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_eutra_ie(LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra,
-                                                       uint8                               **ie_ptr)
+                                                       LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12881,7 +12786,7 @@ LIBLTE_ERROR_ENUM liblte_rrc_pack_meas_result_eutra_ie(LIBLTE_RRC_MEAS_RESULT_EU
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(uint8                               **ie_ptr,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(LIBLTE_BIT_CURSOR_STRUCT             *ie_ptr,
                                                          LIBLTE_RRC_MEAS_RESULT_EUTRA_STRUCT  *meas_result_eutra)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12903,89 +12808,84 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_meas_result_eutra_ie(uint8
 }
 
 LIBLTE_ERROR_ENUM liblte_rrc_pack_measurement_report_msg(LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report,
-                                                         LIBLTE_BIT_MSG_STRUCT                *msg)
+                                                         LIBLTE_BIT_CURSOR_STRUCT             *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(meas_report != NULL &&
        msg         != NULL)
     {
         //MeasurementReport
-        liblte_value_2_bits(0, &msg_ptr, 1); //critical extensions
-        liblte_value_2_bits(0, &msg_ptr, 3); //c1
+        liblte_value_2_bits(0, msg, 1); //critical extensions
+        liblte_value_2_bits(0, msg, 3); //c1
 
         //MeasurementReport-r8-IEs
-        liblte_value_2_bits(0, &msg_ptr, 1); //non-critical extensions
+        liblte_value_2_bits(0, msg, 1); //non-critical extensions
 
         //MeasResults
-        liblte_value_2_bits(0, &msg_ptr, 1); //ext
-        liblte_value_2_bits(meas_report->have_meas_result_neigh_cells, &msg_ptr, 1);
-        liblte_rrc_pack_meas_id_ie(meas_report->meas_id, &msg_ptr);
-        liblte_rrc_pack_rsrp_range_ie(meas_report->pcell_rsrp_result, &msg_ptr);
-        liblte_rrc_pack_rsrq_range_ie(meas_report->pcell_rsrq_result, &msg_ptr);
+        liblte_value_2_bits(0, msg, 1); //ext
+        liblte_value_2_bits(meas_report->have_meas_result_neigh_cells, msg, 1);
+        liblte_rrc_pack_meas_id_ie(meas_report->meas_id, msg);
+        liblte_rrc_pack_rsrp_range_ie(meas_report->pcell_rsrp_result, msg);
+        liblte_rrc_pack_rsrq_range_ie(meas_report->pcell_rsrq_result, msg);
         if(meas_report->have_meas_result_neigh_cells) {
-          liblte_value_2_bits(0, &msg_ptr, 1); //choice from before extension marker
-          liblte_value_2_bits(meas_report->meas_result_neigh_cells_choice, &msg_ptr, 2);
+          liblte_value_2_bits(0, msg, 1); //choice from before extension marker
+          liblte_value_2_bits(meas_report->meas_result_neigh_cells_choice, msg, 2);
           if(meas_report->meas_result_neigh_cells_choice != LIBLTE_RRC_MEAS_RESULT_LIST_EUTRA) {
             printf("NOT HANDLING %s\n", liblte_rrc_meas_reult_neigh_cells_text[meas_report->meas_result_neigh_cells_choice]);
           } else {
             //MeasResultListEUTRA
-            liblte_value_2_bits(meas_report->meas_result_neigh_cells.eutra.n_result-1, &msg_ptr, 3);
+            liblte_value_2_bits(meas_report->meas_result_neigh_cells.eutra.n_result-1, msg, 3);
             for(uint32 i=0; i<meas_report->meas_result_neigh_cells.eutra.n_result; i++) {
-              liblte_rrc_pack_meas_result_eutra_ie(&meas_report->meas_result_neigh_cells.eutra.result_eutra_list[i], &msg_ptr);
+              liblte_rrc_pack_meas_result_eutra_ie(&meas_report->meas_result_neigh_cells.eutra.result_eutra_list[i], msg);
             }
           }
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_MSG_STRUCT                *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_CURSOR_STRUCT             *msg,
                                                            LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *meas_report)
 {
     LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg      != NULL &&
        meas_report != NULL)
     {
         //MeasurementReport
-        bool crit_ext = liblte_bits_2_value(&msg_ptr, 1); //critical extensions
-        liblte_bits_2_value(&msg_ptr, 3); //c1
+        bool crit_ext = liblte_bits_2_value(msg, 1); //critical extensions
+        liblte_bits_2_value(msg, 3); //c1
 
         //MeasurementReport-r8-IEs
-        bool non_crit_ext = liblte_bits_2_value(&msg_ptr, 1); //non-critical extensions
+        bool non_crit_ext = liblte_bits_2_value(msg, 1); //non-critical extensions
 
         //MeasResults
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
-        meas_report->have_meas_result_neigh_cells = liblte_bits_2_value(&msg_ptr, 1);
-        liblte_rrc_unpack_meas_id_ie(&msg_ptr, &meas_report->meas_id);
-        liblte_rrc_unpack_rsrp_range_ie(&msg_ptr, &meas_report->pcell_rsrp_result);
-        liblte_rrc_unpack_rsrq_range_ie(&msg_ptr, &meas_report->pcell_rsrq_result);
+        bool ext = liblte_bits_2_value(msg, 1);
+        meas_report->have_meas_result_neigh_cells = liblte_bits_2_value(msg, 1);
+        liblte_rrc_unpack_meas_id_ie(msg, &meas_report->meas_id);
+        liblte_rrc_unpack_rsrp_range_ie(msg, &meas_report->pcell_rsrp_result);
+        liblte_rrc_unpack_rsrq_range_ie(msg, &meas_report->pcell_rsrq_result);
         if(meas_report->have_meas_result_neigh_cells) {
-          liblte_bits_2_value(&msg_ptr, 1); //choice from before extension marker
-          meas_report->meas_result_neigh_cells_choice = (LIBLTE_RRC_MEAS_RESULT_NEIGH_CELLS_ENUM) liblte_bits_2_value(&msg_ptr, 2);
+          liblte_bits_2_value(msg, 1); //choice from before extension marker
+          meas_report->meas_result_neigh_cells_choice = (LIBLTE_RRC_MEAS_RESULT_NEIGH_CELLS_ENUM) liblte_bits_2_value(msg, 2);
           if(meas_report->meas_result_neigh_cells_choice != LIBLTE_RRC_MEAS_RESULT_LIST_EUTRA) {
             printf("NOT HANDLING %s\n", liblte_rrc_meas_reult_neigh_cells_text[meas_report->meas_result_neigh_cells_choice]);
           } else {
             //MeasResultListEUTRA
-            meas_report->meas_result_neigh_cells.eutra.n_result = liblte_bits_2_value(&msg_ptr, 3) + 1;
+            meas_report->meas_result_neigh_cells.eutra.n_result = liblte_bits_2_value(msg, 3) + 1;
             for(uint32 i=0; i<meas_report->meas_result_neigh_cells.eutra.n_result; i++) {
-              liblte_rrc_unpack_meas_result_eutra_ie(&msg_ptr, &meas_report->meas_result_neigh_cells.eutra.result_eutra_list[i]);
+              liblte_rrc_unpack_meas_result_eutra_ie(msg, &meas_report->meas_result_neigh_cells.eutra.result_eutra_list[i]);
             }
           }
         }
 
         //skip extensions
-        liblte_rrc_consume_noncrit_extension(crit_ext, __func__, &msg_ptr);
-        liblte_rrc_consume_noncrit_extension(non_crit_ext, __func__, &msg_ptr);
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(crit_ext, __func__, msg);
+        liblte_rrc_consume_noncrit_extension(non_crit_ext, __func__, msg);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -13041,82 +12941,77 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_measurement_report_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_information_transfer_msg(LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer,
-                                                              LIBLTE_BIT_MSG_STRUCT                     *msg)
+                                                              LIBLTE_BIT_CURSOR_STRUCT                  *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(dl_info_transfer != NULL &&
        msg              != NULL)
     {
         // RRC Transaction ID
         liblte_rrc_pack_rrc_transaction_identifier_ie(dl_info_transfer->rrc_transaction_id,
-                                                      &msg_ptr);
+                                                      msg);
 
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // C1 choice
-        liblte_value_2_bits(0, &msg_ptr, 2);
+        liblte_value_2_bits(0, msg, 2);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Dedicated info type choice
-        liblte_value_2_bits(dl_info_transfer->dedicated_info_type, &msg_ptr, 2);
+        liblte_value_2_bits(dl_info_transfer->dedicated_info_type, msg, 2);
 
         if(LIBLTE_RRC_DL_INFORMATION_TRANSFER_TYPE_NAS == dl_info_transfer->dedicated_info_type)
         {
             liblte_rrc_pack_dedicated_info_nas_ie(&dl_info_transfer->dedicated_info,
-                                                  &msg_ptr);
+                                                  msg);
         }else{
             liblte_rrc_pack_dedicated_info_cdma2000_ie(&dl_info_transfer->dedicated_info,
-                                                       &msg_ptr);
+                                                       msg);
         }
 
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
-
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_STRUCT                     *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_CURSOR_STRUCT                  *msg,
                                                                 LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *dl_info_transfer)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg              != NULL &&
        dl_info_transfer != NULL)
     {
         // RRC Transaction ID
-        liblte_rrc_unpack_rrc_transaction_identifier_ie(&msg_ptr,
+        liblte_rrc_unpack_rrc_transaction_identifier_ie(msg,
                                                         &dl_info_transfer->rrc_transaction_id);
 
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // C1 choice
-        liblte_bits_2_value(&msg_ptr, 2);
+        liblte_bits_2_value(msg, 2);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
         // Dedicated info type choice
-        dl_info_transfer->dedicated_info_type = (LIBLTE_RRC_DL_INFORMATION_TRANSFER_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
+        dl_info_transfer->dedicated_info_type = (LIBLTE_RRC_DL_INFORMATION_TRANSFER_TYPE_ENUM)liblte_bits_2_value(msg, 2);
 
         if(LIBLTE_RRC_DL_INFORMATION_TRANSFER_TYPE_NAS == dl_info_transfer->dedicated_info_type)
         {
-            liblte_rrc_unpack_dedicated_info_nas_ie(&msg_ptr,
+            liblte_rrc_unpack_dedicated_info_nas_ie(msg,
                                                     &dl_info_transfer->dedicated_info);
         }else{
-            liblte_rrc_unpack_dedicated_info_cdma2000_ie(&msg_ptr,
+            liblte_rrc_unpack_dedicated_info_cdma2000_ie(msg,
                                                          &dl_info_transfer->dedicated_info);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
 
         err = LIBLTE_SUCCESS;
     }
@@ -13144,44 +13039,39 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_information_transfer_msg(LIBLTE_BIT_MSG_S
     Document Reference: 36.331 v10.0.0 Section 6.2.2 
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_csfb_parameters_request_cdma2000_msg(LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000,
-                                                                       LIBLTE_BIT_MSG_STRUCT                              *msg)
+                                                                       LIBLTE_BIT_CURSOR_STRUCT                           *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(csfb_params_req_cdma2000 != NULL &&
        msg                      != NULL)
     {
         // Extension choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         // Optional indicator
-        liblte_value_2_bits(0, &msg_ptr, 1);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 1);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_MSG_STRUCT                              *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_BIT_CURSOR_STRUCT                           *msg,
                                                                          LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *csfb_params_req_cdma2000)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg                      != NULL &&
        csfb_params_req_cdma2000 != NULL)
     {
         // Extension choice
-        bool ext = liblte_bits_2_value(&msg_ptr, 1);
+        bool ext = liblte_bits_2_value(msg, 1);
 
         // Optional indicator
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
         err = LIBLTE_SUCCESS;
     }
@@ -13219,58 +13109,88 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(LIBLTE_
 
     Document Reference: 36.331 v10.0.0 Sections 6.2.1 and 6.2.2
 *********************************************************************/
-LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
-                                               LIBLTE_BIT_MSG_STRUCT *msg)
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT    *mib,
+                                               LIBLTE_BIT_CURSOR_STRUCT *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(mib != NULL &&
        msg != NULL)
     {
         // DL Bandwidth
-        liblte_value_2_bits(mib->dl_bw, &msg_ptr, 3);
+        liblte_value_2_bits(mib->dl_bw, msg, 3);
 
         // PHICH Config
-        liblte_rrc_pack_phich_config_ie(&mib->phich_config, &msg_ptr);
+        liblte_rrc_pack_phich_config_ie(&mib->phich_config, msg);
 
         // SFN/4
-        liblte_value_2_bits(mib->sfn_div_4, &msg_ptr, 8);
+        liblte_value_2_bits(mib->sfn_div_4, msg, 8);
 
         // Spare
-        liblte_value_2_bits(0, &msg_ptr, 10);
-
-        // Fill in the number of bits used
-        msg->N_bits = msg_ptr - msg->msg;
+        liblte_value_2_bits(0, msg, 10);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
-                                                 LIBLTE_RRC_MIB_STRUCT *mib)
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_CURSOR_STRUCT *msg,
+                                                 LIBLTE_RRC_MIB_STRUCT    *mib)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
 
     if(msg != NULL &&
        mib != NULL)
     {
         // DL Bandwidth
-        mib->dl_bw = (LIBLTE_RRC_DL_BANDWIDTH_ENUM)liblte_bits_2_value(&msg_ptr, 3);
+        mib->dl_bw = (LIBLTE_RRC_DL_BANDWIDTH_ENUM)liblte_bits_2_value(msg, 3);
 
         // PHICH Config
-        liblte_rrc_unpack_phich_config_ie(&msg_ptr, &mib->phich_config);
+        liblte_rrc_unpack_phich_config_ie(msg, &mib->phich_config);
 
         // SFN/4
-        mib->sfn_div_4 = liblte_bits_2_value(&msg_ptr, 8);
+        mib->sfn_div_4 = liblte_bits_2_value(msg, 8);
 
         err = LIBLTE_SUCCESS;
     }
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_bch_msg(LIBLTE_RRC_MIB_STRUCT *mib,
+                                               LIBLTE_BIT_MSG_STRUCT *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(mib != NULL &&
+       msg != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_bcch_bch_msg(mib, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
+                                                 LIBLTE_RRC_MIB_STRUCT *mib)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg != NULL &&
+       mib != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_bcch_bch_msg(&ptr, mib);
+    }
+
+    return(err);
+}
 
 /*********************************************************************
     Message Name: BCCH DLSCH Message
@@ -13282,57 +13202,39 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_bch_msg(LIBLTE_BIT_MSG_STRUCT *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
-                                                 LIBLTE_BIT_MSG_STRUCT            *msg)
+                                                 LIBLTE_BIT_CURSOR_STRUCT         *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(bcch_dlsch_msg != NULL &&
        msg            != NULL)
     {
         // Extension indicator
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         if(LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1 == bcch_dlsch_msg->sibs[0].sib_type)
         {
             // SIB1 Choice
-            liblte_value_2_bits(1, &msg_ptr, 1);
+            liblte_value_2_bits(1, msg, 1);
 
             err = liblte_rrc_pack_sys_info_block_type_1_msg((LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
-                                                            &global_msg);
-            if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-                msg->N_bits = global_msg.N_bits + 2;
-            }else{
-                msg->N_bits = 0;
-                err         = LIBLTE_ERROR_INVALID_INPUTS;
-            }
+                                                            msg);
         }else{
             // SIB1 Choice
-            liblte_value_2_bits(0, &msg_ptr, 1);
+            liblte_value_2_bits(0, msg, 1);
 
             err = liblte_rrc_pack_sys_info_msg(bcch_dlsch_msg,
-                                               &global_msg);
-            if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-                msg->N_bits = global_msg.N_bits + 2;
-            }else{
-                msg->N_bits = 0;
-                err         = LIBLTE_ERROR_INVALID_INPUTS;
-            }
+                                               msg);
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT            *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_CURSOR_STRUCT         *msg,
                                                    LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint32             N_bits_used;
     uint8              ext;
 
@@ -13340,32 +13242,57 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
        bcch_dlsch_msg != NULL)
     {
         // Extension indicator
-        ext = liblte_bits_2_value(&msg_ptr, 1);
+        ext = liblte_bits_2_value(msg, 1);
 
         // SIB1 Choice
-        if(true == liblte_bits_2_value(&msg_ptr, 1))
+        if(true == liblte_bits_2_value(msg, 1))
         {
             bcch_dlsch_msg->N_sibs           = 1;
             bcch_dlsch_msg->sibs[0].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1;
-            if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-                global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
-                err               = liblte_rrc_unpack_sys_info_block_type_1_msg(&global_msg,
-                                                                                (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
-                                                                                &N_bits_used);
-                msg_ptr += N_bits_used;
-            }
+            err = liblte_rrc_unpack_sys_info_block_type_1_msg(msg,
+                                                              (LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *)&bcch_dlsch_msg->sibs[0].sib,
+                                                              &N_bits_used);
         }else{
-            if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-            {
-                memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-                err = liblte_rrc_unpack_sys_info_msg(&global_msg,
-                                                     bcch_dlsch_msg);
-            }
+            err = liblte_rrc_unpack_sys_info_msg(msg,
+                                                 bcch_dlsch_msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_bcch_dlsch_msg(LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg,
+                                                 LIBLTE_BIT_MSG_STRUCT            *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(bcch_dlsch_msg != NULL &&
+       msg            != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_bcch_dlsch_msg(bcch_dlsch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT            *msg,
+                                                   LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT *bcch_dlsch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg            != NULL &&
+       bcch_dlsch_msg != NULL &&
+       msg->N_bits    <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_bcch_dlsch_msg(&ptr, bcch_dlsch_msg);
     }
 
     return(err);
@@ -13381,51 +13308,70 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_bcch_dlsch_msg(LIBLTE_BIT_MSG_STRUCT
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
-                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+                                           LIBLTE_BIT_CURSOR_STRUCT   *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint8              ext     = false;
 
     if(pcch_msg != NULL &&
        msg      != NULL)
     {
         // Paging choice
-        liblte_value_2_bits(0, &msg_ptr, 1);
+        liblte_value_2_bits(0, msg, 1);
 
         err = liblte_rrc_pack_paging_msg(pcch_msg,
-                                         &global_msg);
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
-        {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 1;
-        }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
-        }
+                                         msg);
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_CURSOR_STRUCT   *msg,
                                              LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
-    uint32             N_bits_used;
 
     if(msg      != NULL &&
        pcch_msg != NULL)
     {
         // Paging choice
-        liblte_rrc_warning_not_handled(liblte_bits_2_value(&msg_ptr, 1), __func__);;
+        liblte_rrc_warning_not_handled(liblte_bits_2_value(msg, 1), __func__);;
 
-        if((msg->N_bits-(msg_ptr-msg->msg)) <= (LIBLTE_MAX_MSG_SIZE_BITS - 1))
-        {
-            memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-            err = liblte_rrc_unpack_paging_msg(&global_msg,
-                                               pcch_msg);
-        }
+        err = liblte_rrc_unpack_paging_msg(msg,
+                                           pcch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_pcch_msg(LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg,
+                                           LIBLTE_BIT_MSG_STRUCT      *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(pcch_msg != NULL &&
+       msg      != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_pcch_msg(pcch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
+                                             LIBLTE_RRC_PCCH_MSG_STRUCT *pcch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg      != NULL &&
+       pcch_msg != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_pcch_msg(&ptr, pcch_msg);
     }
 
     return(err);
@@ -13441,83 +13387,137 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_pcch_msg(LIBLTE_BIT_MSG_STRUCT      *msg,
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BIT_CURSOR_STRUCT      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(dl_ccch_msg != NULL &&
        msg         != NULL)
     {
         // Extension indicator
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         // Message type choice
-        liblte_value_2_bits(dl_ccch_msg->msg_type, &msg_ptr, 2);
+        liblte_value_2_bits(dl_ccch_msg->msg_type, msg, 2);
 
         if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST == dl_ccch_msg->msg_type)
         {
             err = liblte_rrc_pack_rrc_connection_reestablishment_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *)&dl_ccch_msg->msg,
-                                                                     &global_msg);
+                                                                     msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST_REJ == dl_ccch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reestablishment_reject_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *)&dl_ccch_msg->msg,
-                                                                            &global_msg);
+                                                                            msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REJ == dl_ccch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reject_msg((LIBLTE_RRC_CONNECTION_REJECT_STRUCT *)&dl_ccch_msg->msg,
-                                                            &global_msg);
+                                                            msg);
         }else{ // LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP == dl_ccch_msg->msg_type
             err = liblte_rrc_pack_rrc_connection_setup_msg((LIBLTE_RRC_CONNECTION_SETUP_STRUCT *)&dl_ccch_msg->msg,
-                                                           &global_msg);
-        }
-
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 3))
-        {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 3;
-        }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+                                                           msg);
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_CURSOR_STRUCT      *msg,
                                                 LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
        dl_ccch_msg != NULL)
     {
         // Extension indicator
-        ext = liblte_bits_2_value(&msg_ptr, 1);
+        ext = liblte_bits_2_value(msg, 1);
 
         // Message type choice
-        dl_ccch_msg->msg_type = (LIBLTE_RRC_DL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 2);
+        dl_ccch_msg->msg_type = (LIBLTE_RRC_DL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(msg, 2);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST == dl_ccch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_msg(msg,
                                                                        (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_STRUCT *)&dl_ccch_msg->msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REEST_REJ == dl_ccch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_reject_msg(msg,
                                                                               (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REJECT_STRUCT *)&dl_ccch_msg->msg);
         }else if(LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REJ == dl_ccch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reject_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reject_msg(msg,
                                                               (LIBLTE_RRC_CONNECTION_REJECT_STRUCT *)&dl_ccch_msg->msg);
         }else{ // LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP == dl_ccch_msg->msg_type
-            err = liblte_rrc_unpack_rrc_connection_setup_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_setup_msg(msg,
                                                              (LIBLTE_RRC_CONNECTION_SETUP_STRUCT *)&dl_ccch_msg->msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(dl_ccch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       dl_ccch_msg != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_dl_ccch_msg(&ptr, dl_ccch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_ccch_msg(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(dl_ccch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, &ptr);
+        liblte_align_up_zero(&ptr, 8);
+        msg->N_bytes = ptr.N_bits/8;
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       dl_ccch_msg != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_unpack_dl_ccch_msg(&ptr, dl_ccch_msg);
     }
 
     return(err);
@@ -13533,144 +13533,198 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BIT_CURSOR_STRUCT      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(dl_dcch_msg != NULL &&
        msg         != NULL)
     {
         // Extension indicator
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         // Message type choice
-        liblte_value_2_bits(dl_dcch_msg->msg_type, &msg_ptr, 4);
+        liblte_value_2_bits(dl_dcch_msg->msg_type, msg, 4);
 
         // Message
         if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_CSFB_PARAMS_RESP_CDMA2000 == dl_dcch_msg->msg_type)
         {
             printf("NOT HANDLING CSFB PARAMETERS RESPONSE CDMA2000\n");
 //            err = liblte_rrc_pack_csfb_parameters_response_cdma2000_msg((LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *)&dl_dcch_msg->msg,
-//                                                                        &global_msg);
+//                                                                        msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_DL_INFO_TRANSFER == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_dl_information_transfer_msg((LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *)&dl_dcch_msg->msg,
-                                                              &global_msg);
+                                                              msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_HANDOVER_FROM_EUTRA_PREP_REQ == dl_dcch_msg->msg_type){
             printf("NOT HANDLING HANDOVER FROM EUTRA PREPARATION REQUEST\n");
 //            err = liblte_rrc_pack_handover_from_eutra_preparation_request_msg((LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *)&dl_dcch_msg->msg,
-//                                                                              &global_msg);
+//                                                                              msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_MOBILITY_FROM_EUTRA_COMMAND == dl_dcch_msg->msg_type){
             printf("NOT HANDLING MOBILITY FROM EUTRA COMMAND\n");
 //            err = liblte_rrc_pack_mobility_from_eutra_command_msg((LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *)&dl_dcch_msg->msg,
-//                                                                  &global_msg);
+//                                                                  msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reconfiguration_msg((LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-                                                                     &global_msg);
+                                                                     msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RELEASE == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_release_msg((LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *)&dl_dcch_msg->msg,
-                                                             &global_msg);
+                                                             msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_SECURITY_MODE_COMMAND == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_command_msg((LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *)&dl_dcch_msg->msg,
-                                                            &global_msg);
+                                                            msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_CAPABILITY_ENQUIRY == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_capability_enquiry_msg((LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *)&dl_dcch_msg->msg,
-                                                            &global_msg);
+                                                            msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_COUNTER_CHECK == dl_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK\n");
 //            err = liblte_rrc_pack_counter_check_msg((LIBLTE_RRC_COUNTER_CHECK_STRUCT *)&dl_dcch_msg->msg,
-//                                                    &global_msg);
+//                                                    msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_INFO_REQ == dl_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_information_request_msg((LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *)&dl_dcch_msg->msg,
-                                                             &global_msg);
+                                                             msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_LOGGED_MEASUREMENTS_CONFIG == dl_dcch_msg->msg_type){
             printf("NOT HANDLING LOGGED MEASUREMENTS CONFIGURATION\n");
 //            err = liblte_rrc_pack_logged_measurements_configuration_msg((LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-//                                                                        &global_msg);
+//                                                                        msg);
         }else{ // LIBLTE_RRC_DL_DCCH_MSG_TYPE_RN_RECONFIG == dl_dcch_msg->msg_type
             printf("NOT HANDLING RN RECONFIGURATION\n");
 //            err = liblte_rrc_pack_rn_reconfiguration_msg((LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg,
-//                                                         &global_msg);
-        }
-
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
-        {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 5;
-        }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+//                                                         msg);
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_CURSOR_STRUCT      *msg,
                                                 LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
        dl_dcch_msg != NULL)
     {
         // Extension indicator
-        ext = liblte_bits_2_value(&msg_ptr, 1);
+        ext = liblte_bits_2_value(msg, 1);
 
         // Message type choice
-        dl_dcch_msg->msg_type = (LIBLTE_RRC_DL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
+        dl_dcch_msg->msg_type = (LIBLTE_RRC_DL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(msg, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_CSFB_PARAMS_RESP_CDMA2000 == dl_dcch_msg->msg_type)
         {
             printf("NOT HANDLING CSFB PARAMETERS RESPONSE CDMA2000\n");
-//            err = liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(&global_msg,
+//            err = liblte_rrc_unpack_csfb_parameters_response_cdma2000_msg(msg,
 //                                                                          (LIBLTE_RRC_CSFB_PARAMETERS_RESPONSE_CDMA2000_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_DL_INFO_TRANSFER == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_dl_information_transfer_msg(&global_msg,
+            err = liblte_rrc_unpack_dl_information_transfer_msg(msg,
                                                                 (LIBLTE_RRC_DL_INFORMATION_TRANSFER_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_HANDOVER_FROM_EUTRA_PREP_REQ == dl_dcch_msg->msg_type){
             printf("NOT HANDLING HANDOVER FROM EUTRA PREPARATION REQUEST\n");
-//            err = liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(&global_msg,
+//            err = liblte_rrc_unpack_handover_from_eutra_preparation_request_msg(msg,
 //                                                                                (LIBLTE_RRC_HANDOVER_FROM_EUTRA_PREPARATION_REQUEST_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_MOBILITY_FROM_EUTRA_COMMAND == dl_dcch_msg->msg_type){
             printf("NOT HANDLING MOBILITY FROM EUTRA COMMAND\n");
-//            err = liblte_rrc_unpack_mobility_from_eutra_command_msg(&global_msg,
+//            err = liblte_rrc_unpack_mobility_from_eutra_command_msg(msg,
 //                                                                    (LIBLTE_RRC_MOBILITY_FROM_EUTRA_COMMAND_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reconfiguration_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reconfiguration_msg(msg,
                                                                        (LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RELEASE == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_release_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_release_msg(msg,
                                                                (LIBLTE_RRC_CONNECTION_RELEASE_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_SECURITY_MODE_COMMAND == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_command_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_command_msg(msg,
                                                               (LIBLTE_RRC_SECURITY_MODE_COMMAND_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_CAPABILITY_ENQUIRY == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ue_capability_enquiry_msg(&global_msg,
+            err = liblte_rrc_unpack_ue_capability_enquiry_msg(msg,
                                                               (LIBLTE_RRC_UE_CAPABILITY_ENQUIRY_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_COUNTER_CHECK == dl_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK\n");
-//            err = liblte_rrc_unpack_counter_check_msg(&global_msg,
+//            err = liblte_rrc_unpack_counter_check_msg(msg,
 //                                                      (LIBLTE_RRC_COUNTER_CHECK_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_INFO_REQ == dl_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ue_information_request_msg(&global_msg,
+            err = liblte_rrc_unpack_ue_information_request_msg(msg,
                                                                (LIBLTE_RRC_UE_INFORMATION_REQUEST_STRUCT *)&dl_dcch_msg->msg);
         }else if(LIBLTE_RRC_DL_DCCH_MSG_TYPE_LOGGED_MEASUREMENTS_CONFIG == dl_dcch_msg->msg_type){
             printf("NOT HANDLING LOGGED MEASUREMENTS CONFIGURATION\n");
-//            err = liblte_rrc_unpack_logged_measurements_configuration_msg(&global_msg,
+//            err = liblte_rrc_unpack_logged_measurements_configuration_msg(msg,
 //                                                                          (LIBLTE_RRC_LOGGED_MEASUREMENTS_CONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }else{ // LIBLTE_RRC_DL_DCCH_MSG_TYPE_RN_RECONFIG == dl_dcch_msg->msg_type
             printf("NOT HANDLING RN RECONFIGURATION\n");
-//            err = liblte_rrc_unpack_rn_reconfiguration_msg(&global_msg,
+//            err = liblte_rrc_unpack_rn_reconfiguration_msg(msg,
 //                                                           (LIBLTE_RRC_RN_RECONFIGURATION_STRUCT *)&dl_dcch_msg->msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(dl_dcch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       dl_dcch_msg != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_dl_dcch_msg(&ptr, dl_dcch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_dl_dcch_msg(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(dl_dcch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, &ptr);
+        liblte_align_up_zero(&ptr, 8);
+        msg->N_bytes = ptr.N_bits/8;
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       dl_dcch_msg != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_unpack_dl_dcch_msg(&ptr, dl_dcch_msg);
     }
 
     return(err);
@@ -13686,71 +13740,125 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_dl_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BIT_CURSOR_STRUCT      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(ul_ccch_msg != NULL &&
        msg         != NULL)
     {
         // Extension indicator
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         // Message type choice
-        liblte_value_2_bits(ul_ccch_msg->msg_type, &msg_ptr, 1);
+        liblte_value_2_bits(ul_ccch_msg->msg_type, msg, 1);
 
         if(LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ == ul_ccch_msg->msg_type)
         {
             err = liblte_rrc_pack_rrc_connection_reestablishment_request_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *)&ul_ccch_msg->msg,
-                                                                             &global_msg);
+                                                                             msg);
         }else{ // LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ == ul_ccch_msg->msg_type
             err = liblte_rrc_pack_rrc_connection_request_msg((LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *)&ul_ccch_msg->msg,
-                                                             &global_msg);
-        }
-
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 2))
-        {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 2;
-        }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+                                                             msg);
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_CURSOR_STRUCT      *msg,
                                                 LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
        ul_ccch_msg != NULL)
     {
         // Extension indicator
-        ext = liblte_bits_2_value(&msg_ptr, 1);
+        ext = liblte_bits_2_value(msg, 1);
 
         // Message type choice
-        ul_ccch_msg->msg_type = (LIBLTE_RRC_UL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 1);
+        ul_ccch_msg->msg_type = (LIBLTE_RRC_UL_CCCH_MSG_TYPE_ENUM)liblte_bits_2_value(msg, 1);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ == ul_ccch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_request_msg(msg,
                                                                                (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_REQUEST_STRUCT *)&ul_ccch_msg->msg);
         }else{ // LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ == ul_ccch_msg->msg_type
-            err = liblte_rrc_unpack_rrc_connection_request_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_request_msg(msg,
                                                                (LIBLTE_RRC_CONNECTION_REQUEST_STRUCT *)&ul_ccch_msg->msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(ul_ccch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_ul_ccch_msg(ul_ccch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       ul_ccch_msg != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_ul_ccch_msg(&ptr, ul_ccch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_ccch_msg(LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(ul_ccch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_pack_ul_ccch_msg(ul_ccch_msg, &ptr);
+        liblte_align_up_zero(&ptr, 8);
+        msg->N_bytes = ptr.N_bits/8;
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_UL_CCCH_MSG_STRUCT *ul_ccch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       ul_ccch_msg != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_unpack_ul_ccch_msg(&ptr, ul_ccch_msg);
     }
 
     return(err);
@@ -13766,153 +13874,207 @@ LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_ccch_msg(LIBLTE_BIT_MSG_STRUCT         *m
     Document Reference: 36.331 v10.0.0 Section 6.2.1
 *********************************************************************/
 LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
-                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+                                              LIBLTE_BIT_CURSOR_STRUCT      *msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext     = false;
 
     if(ul_dcch_msg != NULL &&
        msg         != NULL)
     {
         // Extension indicator
-        liblte_value_2_bits(ext, &msg_ptr, 1);
+        liblte_value_2_bits(ext, msg, 1);
 
         // Message type choice
-        liblte_value_2_bits(ul_dcch_msg->msg_type, &msg_ptr, 4);
+        liblte_value_2_bits(ul_dcch_msg->msg_type, msg, 4);
 
         // Message
         if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_CSFB_PARAMS_REQ_CDMA2000 == ul_dcch_msg->msg_type)
         {
             err = liblte_rrc_pack_csfb_parameters_request_cdma2000_msg((LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *)&ul_dcch_msg->msg,
-                                                                       &global_msg);
+                                                                       msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_MEASUREMENT_REPORT == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_measurement_report_msg((LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *)&ul_dcch_msg->msg,
-                                                         &global_msg);
+                                                         msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reconfiguration_complete_msg((LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                              &global_msg);
+                                                                              msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_REEST_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_reestablishment_complete_msg((LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                              &global_msg);
+                                                                              msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_SETUP_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_rrc_connection_setup_complete_msg((LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                    &global_msg);
+                                                                    msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_complete_msg((LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                             &global_msg);
+                                                             msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_FAILURE == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_security_mode_failure_msg((LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *)&ul_dcch_msg->msg,
-                                                            &global_msg);
+                                                            msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_CAPABILITY_INFO == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_ue_capability_information_msg((LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *)&ul_dcch_msg->msg,
-                                                                &global_msg);
+                                                                msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_HANDOVER_PREP_TRANSFER == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UL HANDOVER PREPARATION TRANSFER\n");
 //            err = liblte_rrc_pack_ul_handover_preparation_transfer_msg((LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg,
-//                                                                       &global_msg);
+//                                                                       msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_ul_information_transfer_msg((LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg,
-                                                              &global_msg);
+                                                              msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_COUNTER_CHECK_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK RESPONSE\n");
 //            err = liblte_rrc_pack_counter_check_response_msg((LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *)&ul_dcch_msg->msg,
-//                                                             &global_msg);
+//                                                             msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_INFO_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE INFORMATION RESPONSE\n");
 //            err = liblte_rrc_pack_ue_information_response_msg((LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *)&ul_dcch_msg->msg,
-//                                                              &global_msg);
+//                                                              msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_PROXIMITY_IND == ul_dcch_msg->msg_type){
             err = liblte_rrc_pack_proximity_indication_msg((LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *)&ul_dcch_msg->msg,
-                                                           &global_msg);
+                                                           msg);
         }else{ // LIBLTE_RRC_UL_DCCH_MSG_TYPE_RN_RECONFIG_COMPLETE == ul_dcch_msg->msg_type
             err = liblte_rrc_pack_rn_reconfiguration_complete_msg((LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg,
-                                                                  &global_msg);
-        }
-
-        if(global_msg.N_bits <= (LIBLTE_MAX_MSG_SIZE_BITS - 5))
-        {
-            memcpy(msg_ptr, global_msg.msg, global_msg.N_bits);
-            msg->N_bits = global_msg.N_bits + 5;
-        }else{
-            msg->N_bits = 0;
-            err         = LIBLTE_ERROR_INVALID_INPUTS;
+                                                                  msg);
         }
     }
 
     return(err);
 }
-LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_CURSOR_STRUCT      *msg,
                                                 LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
 {
     LIBLTE_ERROR_ENUM  err     = LIBLTE_ERROR_INVALID_INPUTS;
-    uint8             *msg_ptr = msg->msg;
     uint8              ext;
 
     if(msg         != NULL &&
        ul_dcch_msg != NULL)
     {
         // Extension indicator
-        ext = liblte_bits_2_value(&msg_ptr, 1);
+        ext = liblte_bits_2_value(msg, 1);
 
         // Message type choice
-        ul_dcch_msg->msg_type = (LIBLTE_RRC_UL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(&msg_ptr, 4);
+        ul_dcch_msg->msg_type = (LIBLTE_RRC_UL_DCCH_MSG_TYPE_ENUM)liblte_bits_2_value(msg, 4);
 
         // Message
-        memcpy(global_msg.msg, msg_ptr, msg->N_bits-(msg_ptr-msg->msg));
-        global_msg.N_bits = msg->N_bits-(msg_ptr-msg->msg);
         if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_CSFB_PARAMS_REQ_CDMA2000 == ul_dcch_msg->msg_type)
         {
-            err = liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(&global_msg,
+            err = liblte_rrc_unpack_csfb_parameters_request_cdma2000_msg(msg,
                                                                          (LIBLTE_RRC_CSFB_PARAMETERS_REQUEST_CDMA2000_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_MEASUREMENT_REPORT == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_measurement_report_msg(&global_msg,
+            err = liblte_rrc_unpack_measurement_report_msg(msg,
                                                            (LIBLTE_RRC_MEASUREMENT_REPORT_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reconfiguration_complete_msg(msg,
                                                                                 (LIBLTE_RRC_CONNECTION_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_REEST_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_reestablishment_complete_msg(msg,
                                                                                 (LIBLTE_RRC_CONNECTION_REESTABLISHMENT_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_SETUP_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_rrc_connection_setup_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rrc_connection_setup_complete_msg(msg,
                                                                       (LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_complete_msg(msg,
                                                                (LIBLTE_RRC_SECURITY_MODE_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_FAILURE == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_security_mode_failure_msg(&global_msg,
+            err = liblte_rrc_unpack_security_mode_failure_msg(msg,
                                                               (LIBLTE_RRC_SECURITY_MODE_FAILURE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_CAPABILITY_INFO == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE CAPABILITY INFO\n");
-//            err = liblte_rrc_unpack_ue_capability_information_msg(&global_msg,
+//            err = liblte_rrc_unpack_ue_capability_information_msg(msg,
 //                                                                 (LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_HANDOVER_PREP_TRANSFER == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UL HANDOVER PREPARATION TRANSFER\n");
-//            err = liblte_rrc_unpack_ul_handover_preparation_transfer_msg(&global_msg,
+//            err = liblte_rrc_unpack_ul_handover_preparation_transfer_msg(msg,
 //                                                                         (LIBLTE_RRC_UL_HANDOVER_PREPARATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_ul_information_transfer_msg(&global_msg,
+            err = liblte_rrc_unpack_ul_information_transfer_msg(msg,
                                                                 (LIBLTE_RRC_UL_INFORMATION_TRANSFER_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_COUNTER_CHECK_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING COUNTER CHECK RESPONSE\n");
-//            err = liblte_rrc_unpack_counter_check_response_msg(&global_msg,
+//            err = liblte_rrc_unpack_counter_check_response_msg(msg,
 //                                                               (LIBLTE_RRC_COUNTER_CHECK_RESPONSE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_INFO_RESP == ul_dcch_msg->msg_type){
             printf("NOT HANDLING UE INFORMATION RESPONSE\n");
-//            err = liblte_rrc_unpack_ue_information_response_msg(&global_msg,
+//            err = liblte_rrc_unpack_ue_information_response_msg(msg,
 //                                                                (LIBLTE_RRC_UE_INFORMATION_RESPONSE_STRUCT *)&ul_dcch_msg->msg);
         }else if(LIBLTE_RRC_UL_DCCH_MSG_TYPE_PROXIMITY_IND == ul_dcch_msg->msg_type){
-            err = liblte_rrc_unpack_proximity_indication_msg(&global_msg,
+            err = liblte_rrc_unpack_proximity_indication_msg(msg,
                                                              (LIBLTE_RRC_PROXIMITY_INDICATION_STRUCT *)&ul_dcch_msg->msg);
         }else{ // LIBLTE_RRC_UL_DCCH_MSG_TYPE_RN_RECONFIG_COMPLETE == ul_dcch_msg->msg_type
-            err = liblte_rrc_unpack_rn_reconfiguration_complete_msg(&global_msg,
+            err = liblte_rrc_unpack_rn_reconfiguration_complete_msg(msg,
                                                                     (LIBLTE_RRC_RN_RECONFIGURATION_COMPLETE_STRUCT *)&ul_dcch_msg->msg);
         }
         
-        liblte_rrc_consume_noncrit_extension(ext, __func__, &msg_ptr);
+        liblte_rrc_consume_noncrit_extension(ext, __func__, msg);
         
     }
 
     return(err);
 }
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
+                                              LIBLTE_BIT_MSG_STRUCT         *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(ul_dcch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_pack_ul_dcch_msg(ul_dcch_msg, &ptr);
+        liblte_rrc_bytes_2_bits(&ptr, msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BIT_MSG_STRUCT         *msg,
+                                                LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BYTE_MSG_STRUCT    bytes;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       ul_dcch_msg != NULL &&
+       msg->N_bits <= LIBLTE_MAX_MSG_SIZE_BITS)
+    {
+        liblte_rrc_bits_2_bytes(msg, &bytes);
+        liblte_bit_cursor_init(&ptr, bytes.msg);
+        err = liblte_rrc_unpack_ul_dcch_msg(&ptr, ul_dcch_msg);
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_pack_ul_dcch_msg(LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg,
+                                              LIBLTE_BYTE_MSG_STRUCT        *msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(ul_dcch_msg != NULL &&
+       msg         != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_pack_ul_dcch_msg(ul_dcch_msg, &ptr);
+        liblte_align_up_zero(&ptr, 8);
+        msg->N_bytes = ptr.N_bits/8;
+    }
+
+    return(err);
+}
+LIBLTE_ERROR_ENUM liblte_rrc_unpack_ul_dcch_msg(LIBLTE_BYTE_MSG_STRUCT        *msg,
+                                                LIBLTE_RRC_UL_DCCH_MSG_STRUCT *ul_dcch_msg)
+{
+    LIBLTE_ERROR_ENUM         err = LIBLTE_ERROR_INVALID_INPUTS;
+    LIBLTE_BIT_CURSOR_STRUCT  ptr;
+
+    if(msg         != NULL &&
+       ul_dcch_msg != NULL)
+    {
+        liblte_bit_cursor_init(&ptr, msg->msg);
+        err = liblte_rrc_unpack_ul_dcch_msg(&ptr, ul_dcch_msg);
+    }
+
+    return(err);
+}
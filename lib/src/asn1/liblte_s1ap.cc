@@ -43,7 +43,7 @@ static void liblte_log_print(const char *format, ...) {
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -58,7 +58,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticality(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CRITICALITY_ENUM                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -79,7 +79,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticality(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -98,7 +98,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_local(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LOCAL_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -122,7 +122,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_local(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -145,7 +145,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIVATEIE_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -173,7 +173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -192,7 +192,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONID_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -215,7 +215,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -230,7 +230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_triggeringmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRIGGERINGMESSAGE_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -250,7 +250,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_triggeringmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -265,7 +265,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_presence(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRESENCE_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -285,7 +285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_presence(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -304,7 +304,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -327,7 +327,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -346,7 +346,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_procedurecode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROCEDURECODE_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -369,7 +369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_procedurecode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -390,7 +390,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -416,7 +416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -437,7 +437,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensionfield(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONFIELD_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -463,7 +463,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensionfield(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -488,7 +488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_fieldpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_FIELDPAIR_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -519,7 +519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_fieldpair(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -545,7 +545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolextensioncontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLEXTENSIONCONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -577,7 +577,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolextensioncontainer(
 // lb:0, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -603,7 +603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIR_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -635,7 +635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpair(
 // lb:None, ub:None
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -669,7 +669,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_CONTAINERPAIRLIST_STRUCT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -707,7 +707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -728,7 +728,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_field(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIVATEIE_FIELD_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -754,7 +754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_field(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -775,7 +775,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_singlecontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PROTOCOLIE_SINGLECONTAINER_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -802,7 +802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_singlecontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -828,7 +828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privateie_container(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIVATEIE_CONTAINER_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -859,7 +859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privateie_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -883,7 +883,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BITRATE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -909,7 +909,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -932,7 +932,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causemisc(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSEMISC_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -960,7 +960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causemisc(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -983,7 +983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeradionetwork(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSERADIONETWORK_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1011,7 +1011,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeradionetwork(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1034,7 +1034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causenas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSENAS_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1062,7 +1062,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causenas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1082,7 +1082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidentity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1107,7 +1107,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1138,7 +1138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000PDU_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1173,7 +1173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1204,7 +1204,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000sectorid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000SECTORID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1239,7 +1239,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000sectorid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1262,7 +1262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000horequiredindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000HOREQUIREDINDICATION_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1290,7 +1290,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000horequiredindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1321,7 +1321,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMSI_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1356,7 +1356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1387,7 +1387,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexrand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000ONEXRAND_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1422,7 +1422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexrand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1437,7 +1437,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cndomain(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CNDOMAIN_ENUM                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1457,7 +1457,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cndomain(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1479,7 +1479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_correlation_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CORRELATION_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1506,7 +1506,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_correlation_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1529,7 +1529,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_additionalcsfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ADDITIONALCSFALLBACKINDICATOR_ENUM_EXT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1557,7 +1557,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_additionalcsfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1580,7 +1580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_dl_forwarding(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_DL_FORWARDING_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1608,7 +1608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_dl_forwarding(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1631,7 +1631,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_data_forwarding_not_possible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_DATA_FORWARDING_NOT_POSSIBLE_ENUM_EXT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1659,7 +1659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_data_forwarding_not_possible(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1681,7 +1681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1709,7 +1709,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1729,7 +1729,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_macroenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MACROENB_ID_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1756,7 +1756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_macroenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1776,7 +1776,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_homeenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_HOMEENB_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1802,7 +1802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_homeenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1835,7 +1835,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENB_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1873,7 +1873,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1902,7 +1902,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbname(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENBNAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1936,7 +1936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbname(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -1961,7 +1961,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_encryptionalgorithms(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENCRYPTIONALGORITHMS_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -1991,7 +1991,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_encryptionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2014,7 +2014,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eventtype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EVENTTYPE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2042,7 +2042,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eventtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2061,7 +2061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EXTENDEDRNC_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2084,7 +2084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2107,7 +2107,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddeninterrats(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENINTERRATS_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2135,7 +2135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddeninterrats(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2158,7 +2158,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gwcontextreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GWCONTEXTRELEASEINDICATION_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2186,7 +2186,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gwcontextreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
   LIBLTE_S1AP_HFN_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2210,7 +2210,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_HFN_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2236,7 +2236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2273,7 +2273,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_imsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_IMSI_STRUCT                                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2308,7 +2308,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_imsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2326,7 +2326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_interfacestotrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_INTERFACESTOTRACE_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2349,7 +2349,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_interfacestotrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
   LIBLTE_S1AP_LAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2371,7 +2371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2398,7 +2398,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2429,7 +2429,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedutrancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LASTVISITEDUTRANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2464,7 +2464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2495,7 +2495,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_l3_information(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_L3_INFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2530,7 +2530,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_l3_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2561,7 +2561,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lhn_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LHN_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2596,7 +2596,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lhn_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2611,7 +2611,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggingduration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LOGGINGDURATION_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2631,7 +2631,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggingduration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2654,7 +2654,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_activation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MDT_ACTIVATION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2682,7 +2682,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_activation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2705,7 +2705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_managementbasedmdtallowed(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MANAGEMENTBASEDMDTALLOWED_ENUM_EXT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2733,7 +2733,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_managementbasedmdtallowed(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2756,7 +2756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privacyindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIVACYINDICATOR_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2784,7 +2784,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privacyindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2802,7 +2802,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementstoactivate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MEASUREMENTSTOACTIVATE_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2825,7 +2825,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementstoactivate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2843,7 +2843,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_messageidentifier(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGEIDENTIFIER_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2866,7 +2866,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_messageidentifier(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2895,7 +2895,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmename(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MMENAME_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2929,7 +2929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmename(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -2951,7 +2951,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_group_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MME_GROUP_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -2978,7 +2978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_group_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3002,7 +3002,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MME_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3028,7 +3028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3059,7 +3059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MSCLASSMARK2_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3094,7 +3094,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3125,7 +3125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nas_pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NAS_PDU_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3160,7 +3160,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nas_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3191,7 +3191,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparameterstoe_utran(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSTOE_UTRAN_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3226,7 +3226,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparameterstoe_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3245,7 +3245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcasts(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTS_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3268,7 +3268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcasts(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3291,7 +3291,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadaction(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_OVERLOADACTION_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3319,7 +3319,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadaction(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3342,7 +3342,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingdrx(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PAGINGDRX_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3370,7 +3370,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingdrx(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3389,7 +3389,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_sn(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PDCP_SN_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3412,7 +3412,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_sn(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3434,7 +3434,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_port_number(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PORT_NUMBER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3461,7 +3461,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_port_number(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3476,7 +3476,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptionvulnerability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_ENUM                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3496,7 +3496,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptionvulnerability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3519,7 +3519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ps_servicenotavailable(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PS_SERVICENOTAVAILABLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3547,7 +3547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ps_servicenotavailable(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3567,7 +3567,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUS_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3592,7 +3592,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3611,7 +3611,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relativemmecapacity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RELATIVEMMECAPACITY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3634,7 +3634,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relativemmecapacity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
   LIBLTE_S1AP_RAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3656,7 +3656,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3683,7 +3683,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rac(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3698,7 +3698,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportintervalmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_REPORTINTERVALMDT_ENUM                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3718,7 +3718,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportintervalmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3741,7 +3741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportarea(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_REPORTAREA_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3769,7 +3769,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportarea(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3788,7 +3788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RNC_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3811,7 +3811,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3834,7 +3834,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_establishment_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_ENUM_EXT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3862,7 +3862,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_establishment_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3881,7 +3881,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_routing_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ROUTING_ID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3904,7 +3904,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_routing_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3927,7 +3927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SONINFORMATIONREQUEST_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -3955,7 +3955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -3986,7 +3986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_source_totarget_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SOURCE_TOTARGET_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4021,7 +4021,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_source_totarget_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4044,7 +4044,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvcchoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SRVCCHOINDICATION_ENUM_EXT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4072,7 +4072,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvcchoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4103,7 +4103,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcernc_totargetrnc_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SOURCERNC_TOTARGETRNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4138,7 +4138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcernc_totargetrnc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4157,7 +4157,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_subscriberprofileidforrfp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SUBSCRIBERPROFILEIDFORRFP_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4180,7 +4180,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_subscriberprofileidforrfp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4203,7 +4203,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_synchronizationstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SYNCHRONIZATIONSTATUS_ENUM_EXT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4231,7 +4231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_synchronizationstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4262,7 +4262,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_tosourcernc_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETRNC_TOSOURCERNC_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4297,7 +4297,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_tosourcernc_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4313,7 +4313,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRQ_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4334,7 +4334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4353,7 +4353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4376,7 +4376,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4408,7 +4408,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportlayeraddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRANSPORTLAYERADDRESS_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4445,7 +4445,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportlayeraddress(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4468,7 +4468,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracedepth(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRACEDEPTH_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4496,7 +4496,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracedepth(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4512,7 +4512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_trafficloadreductionindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRAFFICLOADREDUCTIONINDICATION_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4533,7 +4533,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_trafficloadreductionindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4564,7 +4564,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UERADIOCAPABILITY_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4599,7 +4599,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4621,7 +4621,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningtype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_WARNINGTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4648,7 +4648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningtype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4679,7 +4679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningmessagecontents(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_WARNINGMESSAGECONTENTS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4714,7 +4714,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningmessagecontents(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4737,7 +4737,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causeprotocol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSEPROTOCOL_ENUM_EXT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4765,7 +4765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causeprotocol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4788,7 +4788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellaccessmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLACCESSMODE_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4816,7 +4816,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellaccessmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4839,7 +4839,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000rattype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000RATTYPE_ENUM_EXT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4867,7 +4867,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000rattype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4898,7 +4898,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexmeid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000ONEXMEID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4933,7 +4933,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexmeid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -4956,7 +4956,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cell_size(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELL_SIZE_ENUM_EXT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -4984,7 +4984,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cell_size(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
   LIBLTE_S1AP_CI_STRUCT                                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5006,7 +5006,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ci(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CI_STRUCT                                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5033,7 +5033,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5056,7 +5056,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csfallbackindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CSFALLBACKINDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5084,7 +5084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csfallbackindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5099,7 +5099,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csgmembershipstatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CSGMEMBERSHIPSTATUS_ENUM                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5119,7 +5119,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csgmembershipstatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5137,7 +5137,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_datacodingscheme(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_DATACODINGSCHEME_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5161,7 +5161,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_datacodingscheme(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5187,7 +5187,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLIST_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5219,7 +5219,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5245,7 +5245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaidlistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAIDLISTFORRESTART_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5276,7 +5276,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaidlistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5300,7 +5300,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_ue_s1ap_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENB_UE_S1AP_ID_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5326,7 +5326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_ue_s1ap_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5348,7 +5348,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RAB_ID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5375,7 +5375,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5413,7 +5413,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLISTITEM_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5456,7 +5456,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5475,7 +5475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutranroundtripdelayestimationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EUTRANROUNDTRIPDELAYESTIMATIONINFO_STRUCT              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5499,7 +5499,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutranroundtripdelayestimationinfo(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5525,7 +5525,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENLACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5556,7 +5556,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5578,7 +5578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gtp_teid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GTP_TEID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5605,7 +5605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gtp_teid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5628,7 +5628,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeitype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GUMMEITYPE_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5656,7 +5656,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeitype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5679,7 +5679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_HANDOVERTYPE_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5707,7 +5707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovertype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5732,7 +5732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_integrityprotectionalgorithms(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_INTEGRITYPROTECTIONALGORITHMS_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5762,7 +5762,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_integrityprotectionalgorithms(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5788,7 +5788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedgerancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LASTVISITEDGERANCELLINFORMATION_STRUCT                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5819,7 +5819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedgerancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5842,7 +5842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_links_to_log(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LINKS_TO_LOG_ENUM_EXT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5870,7 +5870,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_links_to_log(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5885,7 +5885,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_logginginterval(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LOGGINGINTERVAL_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5905,7 +5905,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_logginginterval(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5928,7 +5928,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M3PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -5956,7 +5956,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -5979,7 +5979,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M4PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6007,7 +6007,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6030,7 +6030,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5period(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M5PERIOD_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6058,7 +6058,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5period(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6078,7 +6078,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mobilityinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MOBILITYINFORMATION_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6103,7 +6103,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mobilityinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6125,7 +6125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mme_code(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MME_CODE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6152,7 +6152,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mme_code(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6183,7 +6183,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_msclassmark3(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MSCLASSMARK3_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6218,7 +6218,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_msclassmark3(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6237,7 +6237,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_numberofbroadcastrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NUMBEROFBROADCASTREQUEST_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6260,7 +6260,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_numberofbroadcastrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6289,7 +6289,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_OVERLOADRESPONSE_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6323,7 +6323,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6342,7 +6342,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pdcp_snextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PDCP_SNEXTENDED_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6365,7 +6365,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pdcp_snextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6380,7 +6380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pre_emptioncapability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_ENUM                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6400,7 +6400,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pre_emptioncapability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
   LIBLTE_S1AP_QCI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6419,7 +6419,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_qci(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_QCI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6442,7 +6442,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_qci(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6465,7 +6465,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_relaynode_indicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RELAYNODE_INDICATOR_ENUM_EXT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6493,7 +6493,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_relaynode_indicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6516,7 +6516,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1reportingtrigger(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M1REPORTINGTRIGGER_ENUM_EXT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6544,7 +6544,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1reportingtrigger(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6575,7 +6575,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_riminformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RIMINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6610,7 +6610,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_riminformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6629,7 +6629,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_repetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_REPETITIONPERIOD_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6652,7 +6652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_repetitionperiod(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6672,7 +6672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitykey(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SECURITYKEY_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6697,7 +6697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitykey(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6715,7 +6715,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_serialnumber(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERIALNUMBER_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6738,7 +6738,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_serialnumber(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6769,7 +6769,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourcebss_totargetbss_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SOURCEBSS_TOTARGETBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6804,7 +6804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourcebss_totargetbss_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6827,7 +6827,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_srvccoperationpossible(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SRVCCOPERATIONPOSSIBLE_ENUM_EXT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6856,7 +6856,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_srvccoperationpossible(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6882,7 +6882,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgroupids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERVEDGROUPIDS_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6913,7 +6913,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgroupids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6935,7 +6935,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_stratumlevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_STRATUMLEVEL_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -6962,7 +6962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_stratumlevel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
   LIBLTE_S1AP_TAC_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -6984,7 +6984,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tac(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAC_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7012,7 +7012,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tac(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7038,7 +7038,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_talistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TALISTFORMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7069,7 +7069,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_talistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7091,7 +7091,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tbcd_string(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TBCD_STRING_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7118,7 +7118,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tbcd_string(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7149,7 +7149,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_target_tosource_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGET_TOSOURCE_TRANSPARENTCONTAINER_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7184,7 +7184,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_target_tosource_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7200,7 +7200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_threshold_rsrp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_THRESHOLD_RSRP_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7221,7 +7221,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_threshold_rsrp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7240,7 +7240,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7263,7 +7263,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_time_ue_stayedincell_enhancedgranularity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7285,7 +7285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_utran_trace_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_UTRAN_TRACE_ID_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7312,7 +7312,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_utran_trace_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7335,7 +7335,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_typeoferror(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TYPEOFERROR_ENUM_EXT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7363,7 +7363,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_typeoferror(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7398,7 +7398,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregatemaximumbitrate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UEAGGREGATEMAXIMUMBITRATE_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7438,7 +7438,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregatemaximumbitrate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7473,7 +7473,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_S1AP_ID_PAIR_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7513,7 +7513,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7531,7 +7531,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueidentityindexvalue(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UEIDENTITYINDEXVALUE_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7554,7 +7554,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueidentityindexvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7589,7 +7589,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UESECURITYCAPABILITIES_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7629,7 +7629,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7652,7 +7652,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_voicesupportmatchindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_VOICESUPPORTMATCHINDICATOR_ENUM_EXT                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7680,7 +7680,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_voicesupportmatchindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7702,7 +7702,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningsecurityinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_WARNINGSECURITYINFO_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7730,7 +7730,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningsecurityinfo(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7756,7 +7756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2gtptlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENBX2GTPTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7787,7 +7787,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2gtptlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7810,7 +7810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_causetransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSETRANSPORT_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7838,7 +7838,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_causetransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7861,7 +7861,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000hostatus(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000HOSTATUS_ENUM_EXT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7889,7 +7889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000hostatus(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7920,7 +7920,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexpilot(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000ONEXPILOT_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7955,7 +7955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexpilot(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -7970,7 +7970,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_concurrentwarningmessageindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CONCURRENTWARNINGMESSAGEINDICATOR_ENUM                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -7990,7 +7990,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_concurrentwarningmessageindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8025,7 +8025,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COUNTVALUE_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8065,7 +8065,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8103,7 +8103,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8147,7 +8147,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item(
 // lb:1, ub:2
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8173,7 +8173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2tlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENBX2TLAS_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8204,7 +8204,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2tlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8228,7 +8228,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_extendedrepetitionperiod(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EXTENDEDREPETITIONPERIOD_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8255,7 +8255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_extendedrepetitionperiod(
 // lb:1, ub:4096
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8281,7 +8281,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentacs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENTACS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8312,7 +8312,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentacs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8355,7 +8355,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GBR_QOSINFORMATION_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8403,7 +8403,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8427,7 +8427,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_hfnmodified(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_HFNMODIFIED_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8453,7 +8453,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_hfnmodified(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8468,7 +8468,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killallwarningmessages(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_KILLALLWARNINGMESSAGES_ENUM                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8488,7 +8488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killallwarningmessages(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8519,7 +8519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lppa_pdu(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LPPA_PDU_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8554,7 +8554,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lppa_pdu(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8585,7 +8585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M3CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8621,7 +8621,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8656,7 +8656,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M5CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8696,7 +8696,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8729,7 +8729,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_measurementthresholda2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MEASUREMENTTHRESHOLDA2_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8767,7 +8767,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_measurementthresholda2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8789,7 +8789,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m_tmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8816,7 +8816,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m_tmsi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8847,7 +8847,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_oldbss_tonewbss_information(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_OLDBSS_TONEWBSS_INFORMATION_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8882,7 +8882,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_oldbss_tonewbss_information(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8904,7 +8904,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_plmnidentity(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PLMNIDENTITY_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8931,7 +8931,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_plmnidentity(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -8956,7 +8956,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_receivestatusofulpdcpsdusextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RECEIVESTATUSOFULPDCPSDUSEXTENDED_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -8986,7 +8986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_receivestatusofulpdcpsdusextended(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9021,7 +9021,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_REQUESTTYPE_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9061,7 +9061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9092,7 +9092,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rrc_container(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RRC_CONTAINER_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9128,7 +9128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rrc_container(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9144,7 +9144,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nexthopchainingcount(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NEXTHOPCHAININGCOUNT_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9166,7 +9166,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nexthopchainingcount(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9201,7 +9201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SECURITYCONTEXT_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9242,7 +9242,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9268,7 +9268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedmmecs(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERVEDMMECS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9299,7 +9299,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedmmecs(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9334,7 +9334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TIMESYNCHRONIZATIONINFO_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9374,7 +9374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
   LIBLTE_S1AP_TAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9409,7 +9409,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9449,7 +9449,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9480,7 +9480,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TABASEDMDT_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9516,7 +9516,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9547,7 +9547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9583,7 +9583,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9614,7 +9614,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M1THRESHOLDEVENTA2_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9650,7 +9650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9678,7 +9678,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_transportinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRANSPORTINFORMATION_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9711,7 +9711,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_transportinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9749,7 +9749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnelinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TUNNELINFORMATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9792,7 +9792,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnelinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9825,7 +9825,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_ids(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_S1AP_IDS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9863,7 +9863,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_ids(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9904,7 +9904,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENBX2EXTTLA_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -9951,7 +9951,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla(
 // lb:1, ub:6
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -9977,7 +9977,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10008,7 +10008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10053,7 +10053,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cause(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CAUSE_STRUCT                                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10103,7 +10103,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cause(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10142,7 +10142,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CDMA2000ONEXSRVCCINFO_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10186,7 +10186,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
   LIBLTE_S1AP_CGI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10232,7 +10232,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CGI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10283,7 +10283,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10318,7 +10318,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COUNTVALUEEXTENDED_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10359,7 +10359,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10385,7 +10385,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_list(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_IE_LIST_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10416,7 +10416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_list(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10451,7 +10451,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_global_enb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GLOBAL_ENB_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10492,7 +10492,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_global_enb_id(
 // lb:1, ub:15
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10518,7 +10518,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EPLMNS_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10549,7 +10549,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10584,7 +10584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABITEM_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10624,7 +10624,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10659,7 +10659,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EUTRAN_CGI_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10699,7 +10699,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10734,7 +10734,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10774,7 +10774,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10809,7 +10809,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10849,7 +10849,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
   LIBLTE_S1AP_LAI_STRUCT                                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10884,7 +10884,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LAI_STRUCT                                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -10924,7 +10924,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -10959,7 +10959,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M4CONFIGURATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11000,7 +11000,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11026,7 +11026,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtplmnlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MDTPLMNLIST_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11057,7 +11057,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtplmnlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11080,7 +11080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmerelaysupportindicator(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MMERELAYSUPPORTINDICATOR_ENUM_EXT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11108,7 +11108,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmerelaysupportindicator(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11131,7 +11131,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pagingpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PAGINGPRIORITY_ENUM_EXT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11159,7 +11159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pagingpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11175,7 +11175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_prioritylevel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIORITYLEVEL_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11197,7 +11197,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_prioritylevel(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11223,7 +11223,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ECGILISTFORRESTART_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11254,7 +11254,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11282,7 +11282,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SOURCEENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11316,7 +11316,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11342,7 +11342,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedplmns(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERVEDPLMNS_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11373,7 +11373,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedplmns(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11408,7 +11408,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_ITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11449,7 +11449,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11475,7 +11475,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAILISTFORMDT_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11506,7 +11506,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11537,7 +11537,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11573,7 +11573,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11608,7 +11608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETENB_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11648,7 +11648,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11679,7 +11679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetbss_tosourcebss_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETBSS_TOSOURCEBSS_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11715,7 +11715,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetbss_tosourcebss_transparentcontainer(
 // lb:1, ub:2048
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11741,7 +11741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforrestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAILISTFORRESTART_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11772,7 +11772,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforrestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11807,7 +11807,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_USERLOCATIONINFORMATION_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11848,7 +11848,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11874,7 +11874,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENBX2EXTTLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11905,7 +11905,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -11942,7 +11942,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ALLOCATIONANDRETENTIONPRIORITY_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -11984,7 +11984,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12019,7 +12019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12059,7 +12059,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12094,7 +12094,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12134,7 +12134,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12165,7 +12165,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12201,7 +12201,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12236,7 +12236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_ITEM_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12277,7 +12277,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item(
 // lb:1, ub:32
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12303,7 +12303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellidlistformdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLIDLISTFORMDT_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12334,7 +12334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellidlistformdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12354,7 +12354,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CSG_ID_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12379,7 +12379,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12410,7 +12410,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CSG_IDLIST_ITEM_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12446,7 +12446,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12469,7 +12469,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_direct_forwarding_path_availability(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_DIRECT_FORWARDING_PATH_AVAILABILITY_ENUM_EXT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12497,7 +12497,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_direct_forwarding_path_availability(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12528,7 +12528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_ITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12565,7 +12565,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12581,26 +12581,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabinformationlistitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABINFORMATIONLISTITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -12608,7 +12607,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABINFORMATIONLIST_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12651,7 +12650,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12677,7 +12676,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12708,7 +12707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12747,7 +12746,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GUMMEI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12791,7 +12790,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12824,7 +12823,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LOGGEDMDT_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12862,7 +12861,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12893,7 +12892,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nassecurityparametersfrome_utran(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_NASSECURITYPARAMETERSFROME_UTRAN_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12928,7 +12927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nassecurityparametersfrome_utran(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -12943,7 +12942,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reportamountmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_REPORTAMOUNTMDT_ENUM                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -12963,7 +12962,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reportamountmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13002,7 +13001,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERVEDGUMMEISITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13046,7 +13045,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13081,7 +13080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_S_TMSI_STRUCT                                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13122,7 +13121,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13148,7 +13147,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailistforwarning(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAILISTFORWARNING_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13180,7 +13179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailistforwarning(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13206,7 +13205,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13237,7 +13236,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13286,7 +13285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETRNC_ID_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13340,7 +13339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13381,7 +13380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13427,7 +13426,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13460,7 +13459,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uepagingid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UEPAGINGID_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13498,7 +13497,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uepagingid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13544,7 +13543,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13596,7 +13595,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13622,7 +13621,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13654,7 +13653,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13680,7 +13679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLID_BROADCAST_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13711,7 +13710,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13742,7 +13741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLBASEDMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13779,7 +13778,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13805,7 +13804,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CSG_IDLIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13837,7 +13836,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13863,7 +13862,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ecgilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ECGILIST_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13894,7 +13893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ecgilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -13929,7 +13928,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -13969,7 +13968,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14008,7 +14007,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GERAN_CELL_ID_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14053,7 +14052,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14069,26 +14068,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -14096,7 +14094,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABLIST_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14139,7 +14137,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablist(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14165,7 +14163,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_FORBIDDENLAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14196,7 +14194,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14214,7 +14212,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_location_info(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MDT_LOCATION_INFO_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14237,7 +14235,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_location_info(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14270,7 +14268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_M1PERIODICREPORTING_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14309,7 +14307,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14340,7 +14338,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ehrpd_sector_id(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EHRPD_SECTOR_ID_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14376,7 +14374,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ehrpd_sector_id(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14413,7 +14411,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimroutingaddress(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RIMROUTINGADDRESS_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14456,7 +14454,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimroutingaddress(
 // lb:1, ub:8
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14482,7 +14480,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeis(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SERVEDGUMMEIS_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14513,7 +14511,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeis(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14544,7 +14542,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAIBASEDMDT_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14580,7 +14578,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14615,7 +14613,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14655,7 +14653,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14692,7 +14690,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetid(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TARGETID_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14734,7 +14732,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetid(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14771,7 +14769,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_warningarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_WARNINGAREALIST_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14813,7 +14811,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_warningarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14851,7 +14849,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_areascopeofmdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_AREASCOPEOFMDT_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14895,7 +14893,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_areascopeofmdt(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14921,7 +14919,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CANCELLEDCELLINTAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -14952,7 +14950,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -14983,7 +14981,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLTYPE_STRUCT                                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15020,7 +15018,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15046,7 +15044,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_CANCELLED_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15078,7 +15076,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15104,7 +15102,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummeilist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_GUMMEILIST_STRUCT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15135,7 +15133,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummeilist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15177,7 +15175,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rablevelqosparameters(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABLEVELQOSPARAMETERS_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15224,7 +15222,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rablevelqosparameters(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15263,7 +15261,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LASTVISITEDEUTRANCELLINFORMATION_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15307,7 +15305,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15345,7 +15343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RIMTRANSFER_STRUCT                                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15389,7 +15387,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15415,7 +15413,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SUPPORTEDTAS_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15446,7 +15444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15481,7 +15479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_ITEM_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15521,7 +15519,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15552,7 +15550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_X2TNLCONFIGURATIONINFO_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15589,7 +15587,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15605,26 +15603,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_bearers_subjecttostatustransfer_item(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -15632,7 +15629,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransferlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BEARERS_SUBJECTTOSTATUSTRANSFERLIST_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15675,7 +15672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransferlist(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15701,7 +15698,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CELLID_CANCELLED_STRUCT                                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15733,7 +15730,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15759,7 +15756,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_COMPLETEDCELLINEAI_STRUCT                              *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15790,7 +15787,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15849,7 +15846,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_HANDOVERRESTRICTIONLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15913,7 +15910,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -15950,7 +15947,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedcell_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_LASTVISITEDCELL_ITEM_STRUCT                            *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -15992,7 +15989,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedcell_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16026,7 +16023,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SONINFORMATIONREPLY_STRUCT                             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16066,7 +16063,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16092,7 +16089,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAI_BROADCAST_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16123,7 +16120,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16146,7 +16143,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timetowait(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TIMETOWAIT_ENUM_EXT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16175,7 +16172,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timetowait(
 // lb:1, ub:16
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16201,7 +16198,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_historyinformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_HISTORYINFORMATION_STRUCT                           *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16232,7 +16229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_historyinformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16285,7 +16282,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_CRITICALITYDIAGNOSTICS_STRUCT                          *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16343,7 +16340,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16378,7 +16375,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_ITEM_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16418,7 +16415,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16467,7 +16464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_IMMEDIATEMDT_STRUCT                                    *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16521,7 +16518,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16554,7 +16551,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdtmode(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MDTMODE_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16592,7 +16589,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdtmode(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16645,7 +16642,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16704,7 +16701,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16730,7 +16727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_EMERGENCYAREAID_BROADCAST_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16761,7 +16758,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16800,7 +16797,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MDT_CONFIGURATION_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16845,7 +16842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration(
 // lb:1, ub:65535
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16871,7 +16868,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAI_CANCELLED_STRUCT                                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16902,7 +16899,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -16939,7 +16936,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcancelledarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BROADCASTCANCELLEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -16981,7 +16978,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcancelledarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17012,7 +17009,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_STRUCT         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17048,7 +17045,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17091,7 +17088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TRACEACTIVATION_STRUCT                                 *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17139,7 +17136,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17176,7 +17173,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_broadcastcompletedarealist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_BROADCASTCOMPLETEDAREALIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17218,7 +17215,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_broadcastcompletedarealist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17251,7 +17248,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformation(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SONINFORMATION_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17289,7 +17286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformation(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17328,7 +17325,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_SONCONFIGURATIONTRANSFER_STRUCT                        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17372,7 +17369,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17395,7 +17392,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetall(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RESETALL_ENUM_EXT                                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17423,7 +17420,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetall(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17452,7 +17449,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_inter_systeminformationtransfertype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_INTER_SYSTEMINFORMATIONTRANSFERTYPE_STRUCT             *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17487,7 +17484,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_inter_systeminformationtransfertype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17513,7 +17510,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rab_ie_containerpairlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RAB_IE_CONTAINERPAIRLIST_STRUCT                      *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17544,7 +17541,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rab_ie_containerpairlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17603,7 +17600,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABDATAFORWARDINGITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17667,7 +17664,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17710,7 +17707,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17758,7 +17755,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17825,7 +17822,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABADMITTEDITEM_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17897,7 +17894,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -17932,7 +17929,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -17972,7 +17969,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18011,7 +18008,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18055,7 +18052,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18094,7 +18091,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULITEM_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18138,7 +18135,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18185,7 +18182,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18237,7 +18234,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18276,7 +18273,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18320,7 +18317,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18359,7 +18356,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18403,7 +18400,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18434,7 +18431,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABMODIFYITEMBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18470,7 +18467,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18501,7 +18498,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABRELEASEITEMBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18537,7 +18534,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18587,7 +18584,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18642,7 +18639,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18681,7 +18678,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18725,7 +18722,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18756,7 +18753,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAIITEM_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18793,7 +18790,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18809,26 +18806,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -18836,7 +18832,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRES_STRUCT        *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18879,7 +18875,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18895,26 +18891,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -18922,7 +18917,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK_STRUCT       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -18964,7 +18959,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionlistresack
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -18988,7 +18983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_PRIVATEMESSAGE_STRUCT                                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19017,7 +19012,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19050,7 +19045,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resettype(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_RESETTYPE_STRUCT                                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19089,7 +19084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resettype(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19105,26 +19100,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabdataforwardingitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABDATAFORWARDINGITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19132,7 +19126,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABSUBJECTTODATAFORWARDINGLIST_STRUCT                *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19175,7 +19169,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsubjecttodataforwardinglist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19191,26 +19185,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitemhoreq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMHOREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19218,7 +19211,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplisthoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTHOREQ_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19261,7 +19254,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplisthoreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19277,26 +19270,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabadmitteditem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABADMITTEDITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19304,7 +19296,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmittedlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABADMITTEDLIST_STRUCT                               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19347,7 +19339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmittedlist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19363,26 +19355,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitcheddlitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLITEM,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19390,7 +19381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddllist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDDLLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19433,7 +19424,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddllist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19449,26 +19440,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitchedulitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19476,7 +19466,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedullist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESWITCHEDULLIST_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19519,7 +19509,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedullist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19535,26 +19525,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitembearersureq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMBEARERSUREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19562,7 +19551,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistbearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTBEARERSUREQ_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19605,7 +19594,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistbearersureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19621,26 +19610,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetupitembearersures(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPITEMBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19648,7 +19636,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistbearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTBEARERSURES_STRUCT                       *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19691,7 +19679,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistbearersures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19707,26 +19695,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDITEMBEARERMODREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19734,7 +19721,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBEMODIFIEDLISTBEARERMODREQ_STRUCT               *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19777,7 +19764,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifiedlistbearermodreq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19793,26 +19780,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabmodifyitembearermodres(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABMODIFYITEMBEARERMODRES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19820,7 +19806,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifylistbearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABMODIFYLISTBEARERMODRES_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19863,7 +19849,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifylistbearermodres(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19879,26 +19865,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABRELEASEITEMBEARERRELCOMP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19906,7 +19891,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABRELEASELISTBEARERRELCOMP_STRUCT                   *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -19949,7 +19934,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaselistbearerrelcomp(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -19965,26 +19950,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMCTXTSUREQ,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -19992,7 +19976,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABTOBESETUPLISTCTXTSUREQ_STRUCT                     *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20035,7 +20019,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetuplistctxtsureq(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20051,26 +20035,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetupitemctxtsures(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPITEMCTXTSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20078,7 +20061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuplistctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABSETUPLISTCTXTSURES_STRUCT                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20121,7 +20104,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuplistctxtsures(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20137,26 +20120,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_taiitem(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TAIITEM,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20164,7 +20146,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tailist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_TAILIST_STRUCT                                         *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20207,7 +20189,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tailist(
 // lb:1, ub:256
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20223,26 +20205,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
     liblte_align_up_zero(ptr, 8);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     uint32_t i;
     for(i=0;i<ie->len;i++) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(&ie->buffer[i], &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPITEMHOREQACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
     err = LIBLTE_SUCCESS;
   }
@@ -20250,7 +20231,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_E_RABFAILEDTOSETUPLISTHOREQACK_STRUCT                  *ie)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20292,7 +20273,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetuplisthoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20313,8 +20294,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20322,7 +20303,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_allocationandretentionpriority_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ALLOCATIONANDRETENTIONPRIORITY_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20360,7 +20341,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_allocationandretentionpriority_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20381,8 +20362,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20390,7 +20371,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20428,7 +20409,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20449,8 +20430,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20458,7 +20439,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cancelledcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CANCELLEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20496,7 +20477,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cancelledcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20517,8 +20498,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20526,7 +20507,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_BROADCAST_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20564,7 +20545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20585,8 +20566,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20594,7 +20575,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CELLID_CANCELLED_ITEM_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20632,7 +20613,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20653,8 +20634,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20662,7 +20643,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cellbasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CELLBASEDMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20700,7 +20681,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cellbasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20721,8 +20702,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20730,7 +20711,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cdma2000onexsrvccinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CDMA2000ONEXSRVCCINFO_EXT_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20768,7 +20749,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cdma2000onexsrvccinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20789,8 +20770,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20798,7 +20779,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTYPE_EXT_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20836,7 +20817,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20857,8 +20838,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20866,7 +20847,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CGI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20904,7 +20885,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20925,8 +20906,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -20934,7 +20915,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_csg_idlist_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CSG_IDLIST_ITEM_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -20972,7 +20953,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_csg_idlist_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -20993,8 +20974,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21002,7 +20983,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalue_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUE_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21040,7 +21021,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalue_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21061,8 +21042,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21070,7 +21051,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_countvalueextended_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_COUNTVALUEEXTENDED_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21108,7 +21089,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_countvalueextended_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21129,8 +21110,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21138,7 +21119,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21176,7 +21157,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21197,8 +21178,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21206,7 +21187,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_criticalitydiagnostics_ie_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CRITICALITYDIAGNOSTICS_IE_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21244,7 +21225,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_criticalitydiagnostics_ie_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21265,8 +21246,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21274,7 +21255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_BROADCAST_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21312,7 +21293,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21333,8 +21314,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21342,7 +21323,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_emergencyareaid_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_EMERGENCYAREAID_CANCELLED_ITEM_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21380,7 +21361,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_emergencyareaid_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21401,8 +21382,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21410,7 +21391,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellineai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINEAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21448,7 +21429,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellineai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21469,8 +21450,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21478,7 +21459,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_geran_cell_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_GERAN_CELL_ID_EXT_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21516,7 +21497,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_geran_cell_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21537,8 +21518,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21546,7 +21527,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_globalenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_GLOBALENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21584,7 +21565,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_globalenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21605,8 +21586,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21614,7 +21595,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enb_statustransfer_transparentcontainer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21652,7 +21633,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enb_statustransfer_transparentcontainer_ext
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21673,8 +21654,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21682,7 +21663,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlistitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLISTITEM_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21720,7 +21701,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlistitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21741,8 +21722,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21750,7 +21731,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21788,7 +21769,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21809,8 +21790,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21818,7 +21799,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabqosparameters_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABQOSPARAMETERS_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21856,7 +21837,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabqosparameters_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21877,8 +21858,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21886,7 +21867,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_eutran_cgi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_EUTRAN_CGI_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21924,7 +21905,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_eutran_cgi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -21945,8 +21926,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -21954,7 +21935,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddentas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -21992,7 +21973,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddentas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22013,8 +21994,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22022,7 +22003,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_forbiddenlas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_FORBIDDENLAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22060,7 +22041,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_forbiddenlas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22081,8 +22062,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22090,7 +22071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gbr_qosinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_GBR_QOSINFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22128,7 +22109,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gbr_qosinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22149,8 +22130,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22158,7 +22139,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_gummei_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_GUMMEI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22196,7 +22177,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_gummei_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22217,8 +22198,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22226,7 +22207,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrestrictionlist_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERRESTRICTIONLIST_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22264,7 +22245,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrestrictionlist_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22285,8 +22266,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22294,7 +22275,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22332,7 +22313,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22353,8 +22334,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22362,7 +22343,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_loggedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LOGGEDMDT_EXT_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22400,7 +22381,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_loggedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22421,8 +22402,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22430,7 +22411,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m3configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_M3CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22468,7 +22449,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m3configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22489,8 +22470,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22498,7 +22479,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m4configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_M4CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22536,7 +22517,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m4configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22557,8 +22538,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22566,7 +22547,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m5configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_M5CONFIGURATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22604,7 +22585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m5configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22625,8 +22606,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22634,7 +22615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1periodicreporting_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_M1PERIODICREPORTING_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22672,7 +22653,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1periodicreporting_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22693,8 +22674,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22702,7 +22683,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_requesttype_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_REQUESTTYPE_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22740,7 +22721,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_requesttype_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22761,8 +22742,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22770,7 +22751,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_rimtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_RIMTRANSFER_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22808,7 +22789,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_rimtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22829,8 +22810,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22838,7 +22819,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_securitycontext_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SECURITYCONTEXT_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22876,7 +22857,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_securitycontext_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22897,8 +22878,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22906,7 +22887,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -22944,7 +22925,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -22965,8 +22946,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -22974,7 +22955,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_servedgummeisitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SERVEDGUMMEISITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23012,7 +22993,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_servedgummeisitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23033,8 +23014,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23042,7 +23023,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_supportedtas_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SUPPORTEDTAS_ITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23080,7 +23061,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_supportedtas_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23101,8 +23082,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23110,7 +23091,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_timesynchronizationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TIMESYNCHRONIZATIONINFO_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23148,7 +23129,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_timesynchronizationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23169,8 +23150,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23178,7 +23159,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s_tmsi_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_S_TMSI_EXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23216,7 +23197,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s_tmsi_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23237,8 +23218,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23246,7 +23227,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taibasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAIBASEDMDT_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23284,7 +23265,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taibasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23305,8 +23286,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23314,7 +23295,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_EXT_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23352,7 +23333,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23373,8 +23354,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23382,7 +23363,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_broadcast_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_BROADCAST_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23420,7 +23401,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_broadcast_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23441,8 +23422,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23450,7 +23431,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tai_cancelled_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAI_CANCELLED_ITEM_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23488,7 +23469,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tai_cancelled_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23509,8 +23490,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23518,7 +23499,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tabasedmdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TABASEDMDT_EXT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23556,7 +23537,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tabasedmdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23577,8 +23558,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23586,7 +23567,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_completedcellintai_item_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_COMPLETEDCELLINTAI_ITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23624,7 +23605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_completedcellintai_item_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23645,8 +23626,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23654,7 +23635,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23692,7 +23673,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23713,8 +23694,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23722,7 +23703,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetrnc_id_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETRNC_ID_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23760,7 +23741,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetrnc_id_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23781,8 +23762,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23790,7 +23771,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_targetenb_tosourceenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TARGETENB_TOSOURCEENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23828,7 +23809,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_targetenb_tosourceenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23849,8 +23830,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23858,7 +23839,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_m1thresholdeventa2_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_M1THRESHOLDEVENTA2_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23896,7 +23877,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_m1thresholdeventa2_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23917,8 +23898,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23926,7 +23907,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tunnel_information_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TUNNEL_INFORMATION_EXT_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -23964,7 +23945,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tunnel_information_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -23985,8 +23966,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -23994,7 +23975,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueaggregate_maximumbitrates_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UEAGGREGATE_MAXIMUMBITRATES_EXT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24032,7 +24013,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueaggregate_maximumbitrates_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24053,8 +24034,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24062,7 +24043,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_s1ap_id_pair_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UE_S1AP_ID_PAIR_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24100,7 +24081,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_s1ap_id_pair_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24121,8 +24102,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24130,7 +24111,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24168,7 +24149,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24189,8 +24170,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24198,7 +24179,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uesecuritycapabilities_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UESECURITYCAPABILITIES_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24236,7 +24217,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uesecuritycapabilities_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24257,8 +24238,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24266,7 +24247,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_userlocationinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_USERLOCATIONINFORMATION_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24304,7 +24285,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_userlocationinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24325,8 +24306,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -24334,7 +24315,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbx2exttla_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBX2EXTTLA_EXT_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24372,7 +24353,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbx2exttla_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ext(
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24395,26 +24376,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MobilityInformation
     if(msg->MobilityInformation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mobilityinformation(&msg->MobilityInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MOBILITYINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24423,7 +24403,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sourceenb_totargetenb_transparentcontainer_ex
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SOURCEENB_TOTARGETENB_TRANSPARENTCONTAINER_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24475,7 +24455,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sourceenb_totargetenb_transparentcontainer_
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24496,25 +24476,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABInformationListItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabinformationlistitem(&msg->E_RABInformationListItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABINFORMATIONLISTITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -24522,7 +24501,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabinformationlist(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABINFORMATIONLIST_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24572,7 +24551,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabinformationlist(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24597,45 +24576,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Time_UE_StayedInCell_EnhancedGranularity
     if(msg->Time_UE_StayedInCell_EnhancedGranularity_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_time_ue_stayedincell_enhancedgranularity(&msg->Time_UE_StayedInCell_EnhancedGranularity, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TIME_UE_STAYEDINCELL_ENHANCEDGRANULARITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - HO_Cause
     if(msg->HO_Cause_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cause(&msg->HO_Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_HO_CAUSE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24644,7 +24621,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_lastvisitedeutrancellinformation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LASTVISITEDEUTRANCELLINFORMATION_EXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24703,7 +24680,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_lastvisitedeutrancellinformation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24726,26 +24703,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Time_Synchronization_Info
     if(msg->Time_Synchronization_Info_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timesynchronizationinfo(&msg->Time_Synchronization_Info, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TIME_SYNCHRONIZATION_INFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24754,7 +24730,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_soninformationreply_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SONINFORMATIONREPLY_EXT_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24806,7 +24782,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_soninformationreply_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24833,64 +24809,61 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - ULCOUNTValueExtended
     if(msg->ULCOUNTValueExtended_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_countvalueextended(&msg->ULCOUNTValueExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ULCOUNTVALUEEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - DLCOUNTValueExtended
     if(msg->DLCOUNTValueExtended_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_countvalueextended(&msg->DLCOUNTValueExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_DLCOUNTVALUEEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ReceiveStatusOfULPDCPSDUsExtended
     if(msg->ReceiveStatusOfULPDCPSDUsExtended_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_receivestatusofulpdcpsdusextended(&msg->ReceiveStatusOfULPDCPSDUsExtended, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_RECEIVESTATUSOFULPDCPSDUSEXTENDED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -24899,7 +24872,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_itemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEMEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -24965,7 +24938,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_itemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -24986,25 +24959,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabitem(&msg->E_RABItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -25012,7 +24984,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABITEM_STRUCT                               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25062,7 +25034,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25085,26 +25057,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - SignallingBasedMDTPLMNList
     if(msg->SignallingBasedMDTPLMNList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->SignallingBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SIGNALLINGBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25113,7 +25084,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mdt_configuration_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MDT_CONFIGURATION_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25165,7 +25136,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mdt_configuration_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25188,26 +25159,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - eNBX2ExtendedTransportLayerAddresses
     if(msg->eNBX2ExtendedTransportLayerAddresses_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbx2exttlas(&msg->eNBX2ExtendedTransportLayerAddresses, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ENBX2EXTENDEDTRANSPORTLAYERADDRESSES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25216,7 +25186,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_x2tnlconfigurationinfo_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_X2TNLCONFIGURATIONINFO_EXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25268,7 +25238,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_x2tnlconfigurationinfo_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25289,25 +25259,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Bearers_SubjectToStatusTransfer_Item
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_bearers_subjecttostatustransfer_item(&msg->Bearers_SubjectToStatusTransfer_Item, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -25315,7 +25284,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_bearers_subjecttostatustransfer_item(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_BEARERS_SUBJECTTOSTATUSTRANSFER_ITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25365,7 +25334,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_bearers_subjecttostatustransfer_item(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25394,83 +25363,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - M3Configuration
     if(msg->M3Configuration_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m3configuration(&msg->M3Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_M3CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - M4Configuration
     if(msg->M4Configuration_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m4configuration(&msg->M4Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_M4CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - M5Configuration
     if(msg->M5Configuration_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_m5configuration(&msg->M5Configuration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_M5CONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MDT_Location_Info
     if(msg->MDT_Location_Info_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdt_location_info(&msg->MDT_Location_Info, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MDT_LOCATION_INFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25479,7 +25444,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_immediatemdt_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_IMMEDIATEMDT_EXT_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25549,7 +25514,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_immediatemdt_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25572,26 +25537,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - x2TNLConfigurationInfo
     if(msg->x2TNLConfigurationInfo_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_x2tnlconfigurationinfo(&msg->x2TNLConfigurationInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_X2TNLCONFIGURATIONINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25600,7 +25564,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_sonconfigurationtransfer_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_SONCONFIGURATIONTRANSFER_EXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25651,7 +25615,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_sonconfigurationtransfer_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25674,26 +25638,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MDTConfiguration
     if(msg->MDTConfiguration_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdt_configuration(&msg->MDTConfiguration, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MDTCONFIGURATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -25702,7 +25665,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_traceactivation_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEACTIVATION_EXT_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -25754,7 +25717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_traceactivation_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -25791,261 +25754,247 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - HandoverType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TargetID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_targetid(&msg->TargetID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TARGETID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Direct_Forwarding_Path_Availability
     if(msg->Direct_Forwarding_Path_Availability_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_direct_forwarding_path_availability(&msg->Direct_Forwarding_Path_Availability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_DIRECT_FORWARDING_PATH_AVAILABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SRVCCHOIndication
     if(msg->SRVCCHOIndication_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvcchoindication(&msg->SRVCCHOIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SRVCCHOINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Source_ToTarget_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Source_ToTarget_TransparentContainer_Secondary
     if(msg->Source_ToTarget_TransparentContainer_Secondary_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer_Secondary, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER_SECONDARY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MSClassmark2
     if(msg->MSClassmark2_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_msclassmark2(&msg->MSClassmark2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MSCLASSMARK2,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MSClassmark3
     if(msg->MSClassmark3_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_msclassmark3(&msg->MSClassmark3, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MSCLASSMARK3,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - PS_ServiceNotAvailable
     if(msg->PS_ServiceNotAvailable_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ps_servicenotavailable(&msg->PS_ServiceNotAvailable, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_PS_SERVICENOTAVAILABLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26054,7 +26003,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequired(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUIRED_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26183,7 +26132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequired(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26204,8 +26153,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26213,7 +26162,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26251,7 +26200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26274,77 +26223,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26353,7 +26298,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverpreparationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERPREPARATIONFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26420,7 +26365,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverpreparationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26443,26 +26388,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Data_Forwarding_Not_Possible
     if(msg->Data_Forwarding_Not_Possible_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_data_forwarding_not_possible(&msg->Data_Forwarding_Not_Possible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_DATA_FORWARDING_NOT_POSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26471,7 +26415,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26523,7 +26467,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26544,8 +26488,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26553,7 +26497,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_EXT_STRUCT                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26591,7 +26535,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26612,8 +26556,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -26621,7 +26565,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqackext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACKEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26659,7 +26603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqackext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26682,60 +26626,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26744,7 +26685,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERFAILURE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -26806,7 +26747,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -26831,113 +26772,107 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -26946,7 +26881,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovernotify(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERNOTIFY_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27025,7 +26960,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovernotify(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27046,8 +26981,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27055,7 +26990,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27093,7 +27028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27114,8 +27049,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27123,7 +27058,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem_ext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_EXT_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27161,7 +27096,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem_ext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27184,77 +27119,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27263,7 +27194,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTFAILURE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27330,7 +27261,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27351,59 +27282,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -27411,7 +27339,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancel(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCEL_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27471,7 +27399,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancel(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27494,60 +27422,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27556,7 +27481,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercancelacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCANCELACKNOWLEDGE_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27618,7 +27543,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercancelacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27643,45 +27568,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SIPTO_Correlation_ID
     if(msg->SIPTO_Correlation_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->SIPTO_Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SIPTO_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27690,7 +27613,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27749,7 +27672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27770,8 +27693,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27779,7 +27702,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURESEXT_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27817,7 +27740,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27840,26 +27763,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - TransportInformation
     if(msg->TransportInformation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportinformation(&msg->TransportInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TRANSPORTINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -27868,7 +27790,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifyitembearermodreqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFYITEMBEARERMODREQEXT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27920,7 +27842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifyitembearermodreqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -27941,8 +27863,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -27950,7 +27872,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRESEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -27988,7 +27910,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28013,96 +27935,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABToBeReleasedList
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rablist(&msg->E_RABToBeReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBERELEASEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NAS_PDU
     if(msg->NAS_PDU_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_NAS_PDU,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28111,7 +28028,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASECOMMAND_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28185,7 +28102,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28206,8 +28123,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28215,7 +28132,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcompext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMPEXT_STRUCT        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28253,7 +28170,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcompext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28276,77 +28193,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABReleasedList
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rablist(&msg->E_RABReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABRELEASEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28355,7 +28268,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28422,7 +28335,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28447,45 +28360,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Correlation_ID
     if(msg->Correlation_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SIPTO_Correlation_ID
     if(msg->SIPTO_Correlation_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_correlation_id(&msg->SIPTO_Correlation_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SIPTO_CORRELATION_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28494,7 +28405,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureqext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQEXT_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28553,7 +28464,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureqext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28574,8 +28485,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28583,7 +28494,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsuresext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURESEXT_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28621,7 +28532,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsuresext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28644,77 +28555,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28723,7 +28630,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPFAILURE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28790,7 +28697,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28811,8 +28718,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -28820,7 +28727,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitemext(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEMEXT_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -28858,7 +28765,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitemext(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -28881,77 +28788,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - GWContextReleaseIndication
     if(msg->GWContextReleaseIndication_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gwcontextreleaseindication(&msg->GWContextReleaseIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GWCONTEXTRELEASEINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -28960,7 +28863,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleaserequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASEREQUEST_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29027,7 +28930,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleaserequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29048,42 +28951,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - UE_S1AP_IDs
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_s1ap_ids(&msg->UE_S1AP_IDs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UE_S1AP_IDS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -29091,7 +28992,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMMAND_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29146,7 +29047,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29171,79 +29072,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29252,7 +29149,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextreleasecomplete(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29321,7 +29218,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextreleasecomplete(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29358,193 +29255,183 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SecurityKey
     if(msg->SecurityKey_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_securitykey(&msg->SecurityKey, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SECURITYKEY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSFallbackIndicator
     if(msg->CSFallbackIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csfallbackindicator(&msg->CSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - UESecurityCapabilities
     if(msg->UESecurityCapabilities_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RegisteredLAI
     if(msg->RegisteredLAI_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lai(&msg->RegisteredLAI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_REGISTEREDLAI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - AdditionalCSFallbackIndicator
     if(msg->AdditionalCSFallbackIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_additionalcsfallbackindicator(&msg->AdditionalCSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ADDITIONALCSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29553,7 +29440,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONREQUEST_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29663,7 +29550,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29686,60 +29573,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29748,7 +29632,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONRESPONSE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29810,7 +29694,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -29833,77 +29717,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -29912,7 +29792,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecontextmodificationfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECONTEXTMODIFICATIONFAILURE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -29979,7 +29859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecontextmodificationfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30002,60 +29882,57 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UERadioCapability
     if(msg->UERadioCapability_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30064,7 +29941,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHREQUEST_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30126,7 +30003,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30149,77 +30026,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - VoiceSupportMatchIndicator
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_voicesupportmatchindicator(&msg->VoiceSupportMatchIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_VOICESUPPORTMATCHINDICATOR,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30228,7 +30101,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ueradiocapabilitymatchresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UERADIOCAPABILITYMATCHRESPONSE_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30295,7 +30168,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ueradiocapabilitymatchresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30320,96 +30193,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NAS_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30418,7 +30286,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30492,7 +30360,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30533,282 +30401,267 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NAS_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - RRC_Establishment_Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_rrc_establishment_cause(&msg->RRC_Establishment_Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_RRC_ESTABLISHMENT_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - S_TMSI
     if(msg->S_TMSI_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_s_tmsi(&msg->S_TMSI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_S_TMSI,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - GW_TransportLayerAddress
     if(msg->GW_TransportLayerAddress_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RelayNode_Indicator
     if(msg->RelayNode_Indicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_relaynode_indicator(&msg->RelayNode_Indicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_RELAYNODE_INDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - GUMMEIType
     if(msg->GUMMEIType_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeitype(&msg->GUMMEIType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEITYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SIPTO_L_GW_TransportLayerAddress
     if(msg->SIPTO_L_GW_TransportLayerAddress_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->SIPTO_L_GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SIPTO_L_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -30817,7 +30670,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialuemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -30957,7 +30810,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialuemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -30984,149 +30837,141 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NAS_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - GW_TransportLayerAddress
     if(msg->GW_TransportLayerAddress_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SIPTO_L_GW_TransportLayerAddress
     if(msg->SIPTO_L_GW_TransportLayerAddress_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_transportlayeraddress(&msg->SIPTO_L_GW_TransportLayerAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SIPTO_L_GW_TRANSPORTLAYERADDRESS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31135,7 +30980,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknastransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31226,7 +31071,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknastransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31247,76 +31092,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NAS_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_nas_pdu(&msg->NAS_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_NAS_PDU,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31324,7 +31165,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_nasnondeliveryindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_NASNONDELIVERYINDICATION_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31389,7 +31230,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_nasnondeliveryindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31410,25 +31251,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&msg->UE_associatedLogicalS1_ConnectionItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31436,7 +31276,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31486,7 +31326,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31507,25 +31347,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ue_associatedlogicals1_connectionitem(&msg->UE_associatedLogicalS1_ConnectionItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -31533,7 +31372,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_ue_associatedlogicals1_connectionitemres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UE_ASSOCIATEDLOGICALS1_CONNECTIONITEMRES_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31583,7 +31422,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_ue_associatedlogicals1_connectionitemres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31612,83 +31451,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     if(msg->MME_UE_S1AP_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - eNB_UE_S1AP_ID
     if(msg->eNB_UE_S1AP_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Cause
     if(msg->Cause_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CAUSE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31697,7 +31532,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_errorindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ERRORINDICATION_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31770,7 +31605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_errorindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31795,96 +31630,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Global_ENB_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_global_enb_id(&msg->Global_ENB_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_GLOBAL_ENB_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNBname
     if(msg->eNBname_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbname(&msg->eNBname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ENBNAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SupportedTAs
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_supportedtas(&msg->SupportedTAs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SUPPORTEDTAS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - DefaultPagingDRX
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_pagingdrx(&msg->DefaultPagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_DEFAULTPAGINGDRX,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -31893,7 +31723,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -31967,7 +31797,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -31994,98 +31824,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmename(&msg->MMEname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MMENAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ServedGUMMEIs
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_servedgummeis(&msg->ServedGUMMEIs, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SERVEDGUMMEIS,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - RelativeMMECapacity
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_relativemmecapacity(&msg->RelativeMMECapacity, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_RELATIVEMMECAPACITY,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - MMERelaySupportIndicator
     if(msg->MMERelaySupportIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmerelaysupportindicator(&msg->MMERelaySupportIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MMERELAYSUPPORTINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32094,7 +31919,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPRESPONSE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32170,7 +31995,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32195,62 +32020,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32259,7 +32081,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1setupfailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_S1SETUPFAILURE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32323,7 +32145,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1setupfailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32352,83 +32174,79 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - eNBname
     if(msg->eNBname_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_enbname(&msg->eNBname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ENBNAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SupportedTAs
     if(msg->SupportedTAs_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_supportedtas(&msg->SupportedTAs, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SUPPORTEDTAS,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - DefaultPagingDRX
     if(msg->DefaultPagingDRX_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingdrx(&msg->DefaultPagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_DEFAULTPAGINGDRX,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32437,7 +32255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32510,7 +32328,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32533,26 +32351,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32561,7 +32378,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32613,7 +32430,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32638,62 +32455,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32702,7 +32516,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32766,7 +32580,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32793,64 +32607,61 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MMEname
     if(msg->MMEname_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mmename(&msg->MMEname, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MMENAME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ServedGUMMEIs
     if(msg->ServedGUMMEIs_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_servedgummeis(&msg->ServedGUMMEIs, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SERVEDGUMMEIS,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RelativeMMECapacity
     if(msg->RelativeMMECapacity_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_relativemmecapacity(&msg->RelativeMMECapacity, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_RELATIVEMMECAPACITY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32859,7 +32670,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdate(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATE_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -32925,7 +32736,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdate(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -32948,26 +32759,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -32976,7 +32786,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdateacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEACKNOWLEDGE_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33028,7 +32838,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdateacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33053,62 +32863,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TimeToWait
     if(msg->TimeToWait_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_timetowait(&msg->TimeToWait, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TIMETOWAIT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -33117,7 +32924,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationupdatefailure(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONUPDATEFAILURE_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33181,7 +32988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationupdatefailure(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33210,168 +33017,159 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - cdma2000RATType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000rattype(&msg->cdma2000RATType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CDMA2000RATTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - cdma2000SectorID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000sectorid(&msg->cdma2000SectorID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CDMA2000SECTORID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - cdma2000HORequiredIndication
     if(msg->cdma2000HORequiredIndication_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000horequiredindication(&msg->cdma2000HORequiredIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CDMA2000HOREQUIREDINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - cdma2000OneXSRVCCInfo
     if(msg->cdma2000OneXSRVCCInfo_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000onexsrvccinfo(&msg->cdma2000OneXSRVCCInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CDMA2000ONEXSRVCCINFO,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - cdma2000OneXRAND
     if(msg->cdma2000OneXRAND_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000onexrand(&msg->cdma2000OneXRAND, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CDMA2000ONEXRAND,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - cdma2000PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000pdu(&msg->cdma2000PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CDMA2000PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRANRoundTripDelayEstimationInfo
     if(msg->EUTRANRoundTripDelayEstimationInfo_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_eutranroundtripdelayestimationinfo(&msg->EUTRANRoundTripDelayEstimationInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_EUTRANROUNDTRIPDELAYESTIMATIONINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -33380,7 +33178,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKS1CDMA2000TUNNELING_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33478,7 +33276,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33499,59 +33297,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UERadioCapability
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33559,7 +33354,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uecapabilityinfoindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UECAPABILITYINFOINDICATION_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33619,7 +33414,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uecapabilityinfoindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33640,59 +33435,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_statustransfer_transparentcontainer(&msg->eNB_StatusTransfer_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33700,7 +33492,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbstatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBSTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33760,7 +33552,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbstatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33781,59 +33573,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_StatusTransfer_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_statustransfer_transparentcontainer(&msg->eNB_StatusTransfer_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_STATUSTRANSFER_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33841,7 +33630,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmestatustransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMESTATUSTRANSFER_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -33901,7 +33690,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmestatustransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -33922,59 +33711,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TraceActivation
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -33982,7 +33768,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracestart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TRACESTART_STRUCT                              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34042,7 +33828,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracestart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34063,76 +33849,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34140,7 +33922,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_tracefailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TRACEFAILUREINDICATION_STRUCT                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34205,7 +33987,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_tracefailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34226,59 +34008,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34286,7 +34065,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_deactivatetrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_DEACTIVATETRACE_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34346,7 +34125,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_deactivatetrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34369,111 +34148,105 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_UTRAN_Trace_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_utran_trace_id(&msg->E_UTRAN_Trace_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_UTRAN_TRACE_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TraceCollectionEntityIPAddress
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_transportlayeraddress(&msg->TraceCollectionEntityIPAddress, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TRACECOLLECTIONENTITYIPADDRESS,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - PrivacyIndicator
     if(msg->PrivacyIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_privacyindicator(&msg->PrivacyIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_PRIVACYINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -34482,7 +34255,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_celltraffictrace(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_CELLTRAFFICTRACE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34559,7 +34332,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_celltraffictrace(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34580,59 +34353,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - RequestType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34640,7 +34410,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingcontrol(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGCONTROL_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34700,7 +34470,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingcontrol(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34721,59 +34491,56 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34781,7 +34548,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreportingfailureindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORTINGFAILUREINDICATION_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -34841,7 +34608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreportingfailureindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -34862,93 +34629,88 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - RequestType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -34956,7 +34718,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_locationreport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_LOCATIONREPORT_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35026,7 +34788,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_locationreport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35051,62 +34813,59 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - OverloadResponse
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_overloadresponse(&msg->OverloadResponse, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_OVERLOADRESPONSE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - GUMMEIList
     if(msg->GUMMEIList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeilist(&msg->GUMMEIList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEILIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - TrafficLoadReductionIndication
     if(msg->TrafficLoadReductionIndication_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_trafficloadreductionindication(&msg->TrafficLoadReductionIndication, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TRAFFICLOADREDUCTIONINDICATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35115,7 +34874,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstart(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTART_STRUCT                           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35179,7 +34938,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstart(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35202,26 +34961,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - GUMMEIList
     if(msg->GUMMEIList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummeilist(&msg->GUMMEIList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEILIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35230,7 +34988,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_overloadstop(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_OVERLOADSTOP_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35282,7 +35040,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_overloadstop(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35317,208 +35075,197 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SerialNumber
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - WarningAreaList
     if(msg->WarningAreaList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningarealist(&msg->WarningAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_WARNINGAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RepetitionPeriod
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_repetitionperiod(&msg->RepetitionPeriod, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_REPETITIONPERIOD,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - ExtendedRepetitionPeriod
     if(msg->ExtendedRepetitionPeriod_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_extendedrepetitionperiod(&msg->ExtendedRepetitionPeriod, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_EXTENDEDREPETITIONPERIOD,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - NumberofBroadcastRequest
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_numberofbroadcastrequest(&msg->NumberofBroadcastRequest, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_NUMBEROFBROADCASTREQUEST,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - WarningType
     if(msg->WarningType_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningtype(&msg->WarningType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_WARNINGTYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - WarningSecurityInfo
     if(msg->WarningSecurityInfo_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningsecurityinfo(&msg->WarningSecurityInfo, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_WARNINGSECURITYINFO,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - DataCodingScheme
     if(msg->DataCodingScheme_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_datacodingscheme(&msg->DataCodingScheme, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_DATACODINGSCHEME,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - WarningMessageContents
     if(msg->WarningMessageContents_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningmessagecontents(&msg->WarningMessageContents, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_WARNINGMESSAGECONTENTS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ConcurrentWarningMessageIndicator
     if(msg->ConcurrentWarningMessageIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_concurrentwarningmessageindicator(&msg->ConcurrentWarningMessageIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CONCURRENTWARNINGMESSAGEINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35527,7 +35274,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35641,7 +35388,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35666,79 +35413,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SerialNumber
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - BroadcastCompletedAreaList
     if(msg->BroadcastCompletedAreaList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_broadcastcompletedarealist(&msg->BroadcastCompletedAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_BROADCASTCOMPLETEDAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35747,7 +35490,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_writereplacewarningresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_WRITEREPLACEWARNINGRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35816,7 +35559,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_writereplacewarningresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35837,25 +35580,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeMDT
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_inter_systeminformationtransfertype(&msg->Inter_SystemInformationTransferTypeMDT, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_INTER_SYSTEMINFORMATIONTRANSFERTYPEMDT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -35863,7 +35605,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmedirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMEDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -35913,7 +35655,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmedirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -35936,26 +35678,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferECT
     if(msg->SONConfigurationTransferECT_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_sonconfigurationtransfer(&msg->SONConfigurationTransferECT, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SONCONFIGURATIONTRANSFERECT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -35964,7 +35705,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBCONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36016,7 +35757,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36039,26 +35780,25 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - SONConfigurationTransferMCT
     if(msg->SONConfigurationTransferMCT_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_sonconfigurationtransfer(&msg->SONConfigurationTransferMCT, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SONCONFIGURATIONTRANSFERMCT,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36067,7 +35807,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_mmeconfigurationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_MMECONFIGURATIONTRANSFER_STRUCT                *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36119,7 +35859,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_mmeconfigurationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36140,8 +35880,8 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     err = LIBLTE_SUCCESS;
   }
@@ -36149,7 +35889,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_privatemessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PRIVATEMESSAGE_STRUCT                          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36187,7 +35927,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_privatemessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36212,79 +35952,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SerialNumber
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - WarningAreaList
     if(msg->WarningAreaList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_warningarealist(&msg->WarningAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_WARNINGAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - KillAllWarningMessages
     if(msg->KillAllWarningMessages_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_killallwarningmessages(&msg->KillAllWarningMessages, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_KILLALLWARNINGMESSAGES,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36293,7 +36029,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_KILLREQUEST_STRUCT                             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36362,7 +36098,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36387,79 +36123,75 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MessageIdentifier
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_messageidentifier(&msg->MessageIdentifier, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MESSAGEIDENTIFIER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SerialNumber
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_serialnumber(&msg->SerialNumber, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SERIALNUMBER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - BroadcastCancelledAreaList
     if(msg->BroadcastCancelledAreaList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_broadcastcancelledarealist(&msg->BroadcastCancelledAreaList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_BROADCASTCANCELLEDAREALIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36468,7 +36200,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_killresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_KILLRESPONSE_STRUCT                            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36537,7 +36269,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_killresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36560,77 +36292,73 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - ECGIListForRestart
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ecgilistforrestart(&msg->ECGIListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ECGILISTFORRESTART,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Global_ENB_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_global_enb_id(&msg->Global_ENB_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_GLOBAL_ENB_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAIListForRestart
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tailistforrestart(&msg->TAIListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAILISTFORRESTART,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EmergencyAreaIDListForRestart
     if(msg->EmergencyAreaIDListForRestart_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_emergencyareaidlistforrestart(&msg->EmergencyAreaIDListForRestart, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_EMERGENCYAREAIDLISTFORRESTART,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -36639,7 +36367,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pwsrestartindication(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PWSRESTARTINDICATION_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36706,7 +36434,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pwsrestartindication(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36727,76 +36455,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - LPPa_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -36804,7 +36528,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -36869,7 +36593,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -36890,76 +36614,72 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - LPPa_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -36967,7 +36687,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinkueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKUEASSOCIATEDLPPATRANSPORT_STRUCT         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37032,7 +36752,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinkueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37053,42 +36773,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - LPPa_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37096,7 +36814,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37151,7 +36869,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37172,42 +36890,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Routing_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_routing_id(&msg->Routing_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ROUTING_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - LPPa_PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_lppa_pdu(&msg->LPPa_PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_LPPA_PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37215,7 +36931,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_uplinknonueassociatedlppatransport(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_UPLINKNONUEASSOCIATEDLPPATRANSPORT_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37270,7 +36986,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_uplinknonueassociatedlppatransport(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37291,25 +37007,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Inter_SystemInformationTransferTypeEDT
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_inter_systeminformationtransfertype(&msg->Inter_SystemInformationTransferTypeEDT, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_INTER_SYSTEMINFORMATIONTRANSFERTYPEEDT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37317,7 +37032,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_enbdirectinformationtransfer(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_ENBDIRECTINFORMATIONTRANSFER_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37367,7 +37082,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_enbdirectinformationtransfer(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37388,25 +37103,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABDataForwardingItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabdataforwardingitem(&msg->E_RABDataForwardingItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABDATAFORWARDINGITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37414,7 +37128,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabdataforwardingitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABDATAFORWARDINGITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37464,7 +37178,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabdataforwardingitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37485,25 +37199,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemHOReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitemhoreq(&msg->E_RABToBeSetupItemHOReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMHOREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37511,7 +37224,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemhoreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMHOREQ_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37561,7 +37274,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemhoreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37582,25 +37295,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABAdmittedItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabadmitteditem(&msg->E_RABAdmittedItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABADMITTEDITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37608,7 +37320,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabadmitteditem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABADMITTEDITEM_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37658,7 +37370,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabadmitteditem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37679,25 +37391,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABFailedtoSetupItemHOReqAck
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(&msg->E_RABFailedtoSetupItemHOReqAck, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPITEMHOREQACK,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37705,7 +37416,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabfailedtosetupitemhoreqack(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABFAILEDTOSETUPITEMHOREQACK_STRUCT          *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37755,7 +37466,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabfailedtosetupitemhoreqack(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37776,25 +37487,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedDLItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitcheddlitem(&msg->E_RABToBeSwitchedDLItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLITEM,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37802,7 +37512,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitcheddlitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDDLITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37852,7 +37562,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitcheddlitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37873,25 +37583,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeSwitchedULItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitchedulitem(&msg->E_RABToBeSwitchedULItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37899,7 +37608,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobeswitchedulitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESWITCHEDULITEM_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -37949,7 +37658,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobeswitchedulitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -37970,25 +37679,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemBearerSUReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitembearersureq(&msg->E_RABToBeSetupItemBearerSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMBEARERSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -37996,7 +37704,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitembearersureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMBEARERSUREQ_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38046,7 +37754,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitembearersureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38067,25 +37775,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemBearerSURes
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetupitembearersures(&msg->E_RABSetupItemBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPITEMBEARERSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38093,7 +37800,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitembearersures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMBEARERSURES_STRUCT               *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38143,7 +37850,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitembearersures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38164,25 +37871,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeModifiedItemBearerModReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(&msg->E_RABToBeModifiedItemBearerModReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDITEMBEARERMODREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38190,7 +37896,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobemodifieditembearermodreq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBEMODIFIEDITEMBEARERMODREQ_STRUCT       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38240,7 +37946,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobemodifieditembearermodreq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38261,25 +37967,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABModifyItemBearerModRes
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabmodifyitembearermodres(&msg->E_RABModifyItemBearerModRes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABMODIFYITEMBEARERMODRES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38287,7 +37992,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyitembearermodres(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYITEMBEARERMODRES_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38337,7 +38042,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyitembearermodres(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38358,25 +38063,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABReleaseItemBearerRelComp
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(&msg->E_RABReleaseItemBearerRelComp, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABRELEASEITEMBEARERRELCOMP,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38384,7 +38088,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseitembearerrelcomp(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASEITEMBEARERRELCOMP_STRUCT           *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38434,7 +38138,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseitembearerrelcomp(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38455,25 +38159,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABToBeSetupItemCtxtSUReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(&msg->E_RABToBeSetupItemCtxtSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPITEMCTXTSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38481,7 +38184,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabtobesetupitemctxtsureq(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38531,7 +38234,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabtobesetupitemctxtsureq(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38552,25 +38255,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - E_RABSetupItemCtxtSURes
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetupitemctxtsures(&msg->E_RABSetupItemCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPITEMCTXTSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38578,7 +38280,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupitemctxtsures(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPITEMCTXTSURES_STRUCT                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38628,7 +38330,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupitemctxtsures(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38649,25 +38351,24 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - TAIItem
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_taiitem(&msg->TAIItem, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAIITEM,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38675,7 +38376,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_taiitem(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_TAIITEM_STRUCT                                 *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38725,7 +38426,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_taiitem(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38750,45 +38451,43 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - UE_associatedLogicalS1_ConnectionListResAck
     if(msg->UE_associatedLogicalS1_ConnectionListResAck_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ue_associatedlogicals1_connectionlistresack(&msg->UE_associatedLogicalS1_ConnectionListResAck, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UE_ASSOCIATEDLOGICALS1_CONNECTIONLISTRESACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -38797,7 +38496,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_resetacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_RESETACKNOWLEDGE_STRUCT                        *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38856,7 +38555,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_resetacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -38877,42 +38576,40 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - ResetType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_resettype(&msg->ResetType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_RESETTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -38920,7 +38617,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_reset(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_RESET_STRUCT                                   *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -38975,7 +38672,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_reset(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39000,114 +38697,108 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABSubjecttoDataForwardingList
     if(msg->E_RABSubjecttoDataForwardingList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(&msg->E_RABSubjecttoDataForwardingList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABSUBJECTTODATAFORWARDINGLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - cdma2000HOStatus
     if(msg->cdma2000HOStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cdma2000hostatus(&msg->cdma2000HOStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CDMA2000HOSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - cdma2000RATType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000rattype(&msg->cdma2000RATType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CDMA2000RATTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - cdma2000PDU
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cdma2000pdu(&msg->cdma2000PDU, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CDMA2000PDU,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -39115,7 +38806,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_downlinks1cdma2000tunneling(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_DOWNLINKS1CDMA2000TUNNELING_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39194,7 +38885,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_downlinks1cdma2000tunneling(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39225,170 +38916,161 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - HandoverType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NASSecurityParametersfromE_UTRAN
     if(msg->NASSecurityParametersfromE_UTRAN_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nassecurityparametersfrome_utran(&msg->NASSecurityParametersfromE_UTRAN, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_NASSECURITYPARAMETERSFROME_UTRAN,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABSubjecttoDataForwardingList
     if(msg->E_RABSubjecttoDataForwardingList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsubjecttodataforwardinglist(&msg->E_RABSubjecttoDataForwardingList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABSUBJECTTODATAFORWARDINGLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABtoReleaseListHOCmd
     if(msg->E_RABtoReleaseListHOCmd_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABtoReleaseListHOCmd, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTORELEASELISTHOCMD,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Target_ToSource_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Target_ToSource_TransparentContainer_Secondary
     if(msg->Target_ToSource_TransparentContainer_Secondary_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer_Secondary, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER_SECONDARY,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -39397,7 +39079,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handovercommand(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERCOMMAND_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -39496,7 +39178,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handovercommand(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -39539,352 +39221,333 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - HandoverType
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_handovertype(&msg->HandoverType, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_HANDOVERTYPE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Cause
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cause(&msg->Cause, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CAUSE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABToBeSetupListHOReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplisthoreq(&msg->E_RABToBeSetupListHOReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTHOREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - Source_ToTarget_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_source_totarget_transparentcontainer(&msg->Source_ToTarget_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SOURCE_TOTARGET_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - TraceActivation
     if(msg->TraceActivation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RequestType
     if(msg->RequestType_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_requesttype(&msg->RequestType, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_REQUESTTYPE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SRVCCOperationPossible
     if(msg->SRVCCOperationPossible_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvccoperationpossible(&msg->SRVCCOperationPossible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SRVCCOPERATIONPOSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SecurityContext
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitycontext(&msg->SecurityContext, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SECURITYCONTEXT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - NASSecurityParameterstoE_UTRAN
     if(msg->NASSecurityParameterstoE_UTRAN_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_nassecurityparameterstoe_utran(&msg->NASSecurityParameterstoE_UTRAN, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_NASSECURITYPARAMETERSTOE_UTRAN,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTAllowed
     if(msg->ManagementBasedMDTAllowed_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_managementbasedmdtallowed(&msg->ManagementBasedMDTAllowed, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTALLOWED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTPLMNList
     if(msg->ManagementBasedMDTPLMNList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->ManagementBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -39893,7 +39556,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUEST_STRUCT                         *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40054,7 +39717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40087,223 +39750,211 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABToBeSwitchedDLList
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobeswitcheddllist(&msg->E_RABToBeSwitchedDLList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDDLLIST,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SourceMME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->SourceMME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SOURCEMME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - EUTRAN_CGI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_eutran_cgi(&msg->EUTRAN_CGI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_EUTRAN_CGI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAI
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tai(&msg->TAI, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAI,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SourceMME_GUMMEI
     if(msg->SourceMME_GUMMEI_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->SourceMME_GUMMEI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SOURCEMME_GUMMEI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Tunnel_Information_for_BBF
     if(msg->Tunnel_Information_for_BBF_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_tunnelinformation(&msg->Tunnel_Information_for_BBF, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TUNNEL_INFORMATION_FOR_BBF,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - LHN_ID
     if(msg->LHN_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lhn_id(&msg->LHN_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_LHN_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -40312,7 +39963,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40429,7 +40080,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40462,172 +40113,163 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABToBeSwitchedULList
     if(msg->E_RABToBeSwitchedULList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabtobeswitchedullist(&msg->E_RABToBeSwitchedULList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBESWITCHEDULLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABToBeReleasedList
     if(msg->E_RABToBeReleasedList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABToBeReleasedList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABTOBERELEASEDLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SecurityContext
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitycontext(&msg->SecurityContext, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SECURITYCONTEXT,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -40636,7 +40278,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_pathswitchrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PATHSWITCHREQUESTACKNOWLEDGE_STRUCT            *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40738,7 +40380,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_pathswitchrequestacknowledge(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40761,78 +40403,74 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABToBeSetupListBearerSUReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplistbearersureq(&msg->E_RABToBeSetupListBearerSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTBEARERSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -40840,7 +40478,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPREQUEST_STRUCT                       *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -40907,7 +40545,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -40934,98 +40572,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABSetupListBearerSURes
     if(msg->E_RABSetupListBearerSURes_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabsetuplistbearersures(&msg->E_RABSetupListBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABSETUPLISTBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToSetupListBearerSURes
     if(msg->E_RABFailedToSetupListBearerSURes_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToSetupListBearerSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTBEARERSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41034,7 +40667,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABSETUPRESPONSE_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41110,7 +40743,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41133,78 +40766,74 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     if(msg->uEaggregateMaximumBitrate_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABToBeModifiedListBearerModReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobemodifiedlistbearermodreq(&msg->E_RABToBeModifiedListBearerModReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBEMODIFIEDLISTBEARERMODREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -41212,7 +40841,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyrequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYREQUEST_STRUCT                      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41279,7 +40908,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyrequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41306,98 +40935,93 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABModifyListBearerModRes
     if(msg->E_RABModifyListBearerModRes_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabmodifylistbearermodres(&msg->E_RABModifyListBearerModRes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABMODIFYLISTBEARERMODRES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToModifyList
     if(msg->E_RABFailedToModifyList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToModifyList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOMODIFYLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41406,7 +41030,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabmodifyresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABMODIFYRESPONSE_STRUCT                     *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41482,7 +41106,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabmodifyresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41511,117 +41135,111 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABReleaseListBearerRelComp
     if(msg->E_RABReleaseListBearerRelComp_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabreleaselistbearerrelcomp(&msg->E_RABReleaseListBearerRelComp, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABRELEASELISTBEARERRELCOMP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - E_RABFailedToReleaseList
     if(msg->E_RABFailedToReleaseList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToReleaseList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTORELEASELIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - UserLocationInformation
     if(msg->UserLocationInformation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_userlocationinformation(&msg->UserLocationInformation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_USERLOCATIONINFORMATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -41630,7 +41248,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_e_rabreleaseresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_E_RABRELEASERESPONSE_STRUCT                    *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -41713,7 +41331,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_e_rabreleaseresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -41760,356 +41378,337 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - uEaggregateMaximumBitrate
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueaggregatemaximumbitrate(&msg->uEaggregateMaximumBitrate, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UEAGGREGATEMAXIMUMBITRATE,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABToBeSetupListCtxtSUReq
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabtobesetuplistctxtsureq(&msg->E_RABToBeSetupListCtxtSUReq, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABTOBESETUPLISTCTXTSUREQ,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UESecurityCapabilities
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uesecuritycapabilities(&msg->UESecurityCapabilities, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UESECURITYCAPABILITIES,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - SecurityKey
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_securitykey(&msg->SecurityKey, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_SECURITYKEY,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TraceActivation
     if(msg->TraceActivation_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_traceactivation(&msg->TraceActivation, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_TRACEACTIVATION,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - HandoverRestrictionList
     if(msg->HandoverRestrictionList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_handoverrestrictionlist(&msg->HandoverRestrictionList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_HANDOVERRESTRICTIONLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - UERadioCapability
     if(msg->UERadioCapability_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_ueradiocapability(&msg->UERadioCapability, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_UERADIOCAPABILITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SubscriberProfileIDforRFP
     if(msg->SubscriberProfileIDforRFP_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_subscriberprofileidforrfp(&msg->SubscriberProfileIDforRFP, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SUBSCRIBERPROFILEIDFORRFP,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSFallbackIndicator
     if(msg->CSFallbackIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csfallbackindicator(&msg->CSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_REJECT,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - SRVCCOperationPossible
     if(msg->SRVCCOperationPossible_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_srvccoperationpossible(&msg->SRVCCOperationPossible, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_SRVCCOPERATIONPOSSIBLE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CSGMembershipStatus
     if(msg->CSGMembershipStatus_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csgmembershipstatus(&msg->CSGMembershipStatus, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSGMEMBERSHIPSTATUS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - RegisteredLAI
     if(msg->RegisteredLAI_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_lai(&msg->RegisteredLAI, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_REGISTEREDLAI,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - GUMMEI_ID
     if(msg->GUMMEI_ID_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_gummei(&msg->GUMMEI_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_GUMMEI_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - MME_UE_S1AP_ID_2
     if(msg->MME_UE_S1AP_ID_2_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID_2, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID_2,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTAllowed
     if(msg->ManagementBasedMDTAllowed_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_managementbasedmdtallowed(&msg->ManagementBasedMDTAllowed, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTALLOWED,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - ManagementBasedMDTPLMNList
     if(msg->ManagementBasedMDTPLMNList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_mdtplmnlist(&msg->ManagementBasedMDTPLMNList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_MANAGEMENTBASEDMDTPLMNLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - AdditionalCSFallbackIndicator
     if(msg->AdditionalCSFallbackIndicator_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_additionalcsfallbackindicator(&msg->AdditionalCSFallbackIndicator, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_ADDITIONALCSFALLBACKINDICATOR,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42118,7 +41717,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetuprequest(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42283,7 +41882,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetuprequest(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42308,96 +41907,91 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABSetupListCtxtSURes
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabsetuplistctxtsures(&msg->E_RABSetupListCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABSETUPLISTCTXTSURES,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABFailedToSetupListCtxtSURes
     if(msg->E_RABFailedToSetupListCtxtSURes_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rablist(&msg->E_RABFailedToSetupListCtxtSURes, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTCTXTSURES,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42406,7 +42000,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initialcontextsetupresponse(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT             *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42480,7 +42074,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initialcontextsetupresponse(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42507,132 +42101,125 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - UEIdentityIndexValue
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_ueidentityindexvalue(&msg->UEIdentityIndexValue, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UEIDENTITYINDEXVALUE,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - UEPagingID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_uepagingid(&msg->UEPagingID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_UEPAGINGID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - pagingDRX
     if(msg->pagingDRX_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingdrx(&msg->pagingDRX, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_PAGINGDRX,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CNDomain
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_cndomain(&msg->CNDomain, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_CNDOMAIN,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - TAIList
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_tailist(&msg->TAIList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TAILIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CSG_IdList
     if(msg->CSG_IdList_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_idlist(&msg->CSG_IdList, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_IDLIST,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - PagingPriority
     if(msg->PagingPriority_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_pagingpriority(&msg->PagingPriority, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_PAGINGPRIORITY,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42641,7 +42228,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_paging(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_PAGING_STRUCT                                  *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -42727,7 +42314,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_paging(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg,
-  uint8_t                                                           **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -42756,151 +42343,143 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
     liblte_value_2_bits(n_ie, ptr, 16);
 
     // Temp container for IEs
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t              *tmp_ptr;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
 
     // ProtocolIE - MME_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_mme_ue_s1ap_id(&msg->MME_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_MME_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - eNB_UE_S1AP_ID
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_enb_ue_s1ap_id(&msg->eNB_UE_S1AP_ID, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_ENB_UE_S1AP_ID,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABAdmittedList
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_e_rabadmittedlist(&msg->E_RABAdmittedList, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_E_RABADMITTEDLIST,
                                           LIBLTE_S1AP_CRITICALITY_IGNORE,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - E_RABFailedToSetupListHOReqAck
     if(msg->E_RABFailedToSetupListHOReqAck_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_e_rabfailedtosetuplisthoreqack(&msg->E_RABFailedToSetupListHOReqAck, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_E_RABFAILEDTOSETUPLISTHOREQACK,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - Target_ToSource_TransparentContainer
     tmp_msg.reset();
-    tmp_ptr = tmp_msg.msg;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
     if(liblte_s1ap_pack_target_tosource_transparentcontainer(&msg->Target_ToSource_TransparentContainer, &tmp_ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
     liblte_align_up_zero(&tmp_ptr, 8);
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+    if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                           LIBLTE_S1AP_IE_ID_TARGET_TOSOURCE_TRANSPARENTCONTAINER,
                                           LIBLTE_S1AP_CRITICALITY_REJECT,
                                           ptr) != LIBLTE_SUCCESS) {
       return LIBLTE_ERROR_ENCODE_FAIL;
     }
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     // ProtocolIE - CSG_Id
     if(msg->CSG_Id_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_csg_id(&msg->CSG_Id, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CSG_ID,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CriticalityDiagnostics
     if(msg->CriticalityDiagnostics_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_criticalitydiagnostics(&msg->CriticalityDiagnostics, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CRITICALITYDIAGNOSTICS,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     // ProtocolIE - CellAccessMode
     if(msg->CellAccessMode_present) {
       tmp_msg.reset();
-      tmp_ptr = tmp_msg.msg;
+      liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
       if(liblte_s1ap_pack_cellaccessmode(&msg->CellAccessMode, &tmp_ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
       liblte_align_up_zero(&tmp_ptr, 8);
-      tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
-      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bits / 8,
+      tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
+      if(liblte_s1ap_pack_protocolie_header(tmp_msg.N_bytes,
                                             LIBLTE_S1AP_IE_ID_CELLACCESSMODE,
                                             LIBLTE_S1AP_CRITICALITY_IGNORE,
                                             ptr) != LIBLTE_SUCCESS) {
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
-      memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-      *ptr += tmp_msg.N_bits;
+      liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
     }
 
     err = LIBLTE_SUCCESS;
@@ -42909,7 +42488,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_handoverrequestacknowledge(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_handoverrequestacknowledge(
-  uint8_t                                                           **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT                                           *ptr,
   LIBLTE_S1AP_MESSAGE_HANDOVERREQUESTACKNOWLEDGE_STRUCT              *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
@@ -43004,7 +42583,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
   uint32_t                      len,
   uint32_t                      ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM  crit,
-  uint8_t                     **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT     *ptr)
 {
   liblte_value_2_bits(ie_id, ptr, 16); // ProtocolIE-ID
   liblte_value_2_bits(crit,  ptr, 2);  // Criticality
@@ -43024,7 +42603,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_protocolie_header(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
-  uint8_t                     **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT     *ptr,
   uint32_t                     *ie_id,
   LIBLTE_S1AP_CRITICALITY_ENUM *crit,
   uint32_t                     *len)
@@ -43050,15 +42629,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_protocolie_header(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT             *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_LOCATIONREPORTINGCONTROL) {
@@ -43262,7 +42842,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43273,7 +42853,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
     liblte_align_up_zero(ptr, 8);
 
     // Length
-    uint32_t len = (tmp_msg.N_bits + 7) / 8;
+    uint32_t len = tmp_msg.N_bytes;
     if(len < 128) {
       liblte_value_2_bits(0,   ptr, 1);
       liblte_value_2_bits(len, ptr, 7);
@@ -43285,8 +42865,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43294,7 +42873,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_initiatingmessage(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT             *ptr,
   LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43582,15 +43161,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_initiatingmessage(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                               **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT               *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_UNSUCCESSFULOUTCOME_CHOICE_S1SETUPFAILURE) {
@@ -43626,7 +43206,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43637,7 +43217,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
     liblte_align_up_zero(ptr, 8);
 
     // Length
-    uint32_t len = (tmp_msg.N_bits + 7) / 8;
+    uint32_t len = tmp_msg.N_bytes;
     if(len < 128) {
       liblte_value_2_bits(0,   ptr, 1);
       liblte_value_2_bits(len, ptr, 7);
@@ -43649,8 +43229,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43658,7 +43237,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_unsuccessfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
-  uint8_t                               **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT               *ptr,
   LIBLTE_S1AP_UNSUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43736,15 +43315,16 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_unsuccessfuloutcome(
 ********************************************************************************/
 LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg,
-  uint8_t                             **ptr)
+  LIBLTE_BIT_CURSOR_STRUCT             *ptr)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
   if(msg                                      != NULL &&
      ptr                                      != NULL)
   { 
-    LIBLTE_BIT_MSG_STRUCT tmp_msg;
-    uint8_t *tmp_ptr = tmp_msg.msg;
+    LIBLTE_BYTE_MSG_STRUCT   tmp_msg;
+    LIBLTE_BIT_CURSOR_STRUCT tmp_ptr;
+    liblte_bit_cursor_init(&tmp_ptr, tmp_msg.msg);
 
     // Message
     if(msg->choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_HANDOVERREQUESTACKNOWLEDGE) {
@@ -43816,7 +43396,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
         return LIBLTE_ERROR_ENCODE_FAIL;
       }
     } 
-    tmp_msg.N_bits = tmp_ptr - tmp_msg.msg;
+    tmp_msg.N_bytes = (tmp_ptr.N_bits + 7) / 8;
 
     // Procedure code
     liblte_value_2_bits(msg->procedureCode, ptr, 8);
@@ -43827,7 +43407,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
     liblte_align_up_zero(ptr, 8);
 
     // Length
-    uint32_t len = (tmp_msg.N_bits + 7) / 8;
+    uint32_t len = tmp_msg.N_bytes;
     if(len < 128) {
       liblte_value_2_bits(0,   ptr, 1);
       liblte_value_2_bits(len, ptr, 7);
@@ -43839,8 +43419,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
       // FIXME: Unlikely to have more than 16K of octets
     }
 
-    memcpy(*ptr, tmp_msg.msg, tmp_msg.N_bits);
-    *ptr += tmp_msg.N_bits;
+    liblte_bits_copy(tmp_msg.msg, ptr, tmp_ptr.N_bits);
 
     err = LIBLTE_SUCCESS;
   }
@@ -43848,7 +43427,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_successfuloutcome(
 }
 
 LIBLTE_ERROR_ENUM liblte_s1ap_unpack_successfuloutcome(
-  uint8_t                             **ptr,
+  LIBLTE_BIT_CURSOR_STRUCT             *ptr,
   LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *msg)
 {  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
 
@@ -43975,13 +43554,13 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
   LIBLTE_BYTE_MSG_STRUCT      *msg)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
+  LIBLTE_BIT_CURSOR_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_CURSOR_STRUCT *ptr = &bit_msg;
+    liblte_bit_cursor_init(ptr, msg->msg);
 
     // Extension
     liblte_value_2_bits(s1ap_pdu->ext?1:0, ptr, 1);
@@ -44006,9 +43585,7 @@ LIBLTE_ERROR_ENUM liblte_s1ap_pack_s1ap_pdu(
     }
 
     liblte_align_up_zero(ptr, 8);
-    bit_msg.N_bits += (*ptr - bit_msg.msg);
-
-    liblte_pack(&bit_msg, msg);
+    msg->N_bytes = bit_msg.N_bits / 8;
     err = LIBLTE_SUCCESS;
 
   }
@@ -44020,15 +43597,13 @@ LIBLTE_ERROR_ENUM liblte_s1ap_unpack_s1ap_pdu(
   LIBLTE_S1AP_S1AP_PDU_STRUCT *s1ap_pdu)
 {
   LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  LIBLTE_BIT_MSG_STRUCT bit_msg;
+  LIBLTE_BIT_CURSOR_STRUCT bit_msg;
 
   if(s1ap_pdu                                 != NULL &&
      msg                                      != NULL)
   {
-    liblte_unpack(msg, &bit_msg);
-
-    uint8_t *p    = bit_msg.msg;
-    uint8_t **ptr = &p;
+    LIBLTE_BIT_CURSOR_STRUCT *ptr = &bit_msg;
+    liblte_bit_cursor_init(ptr, msg->msg);
 
     // Extension
     s1ap_pdu->ext = liblte_bits_2_value(ptr, 1);
@@ -40,6 +40,8 @@ log_filter::log_filter()
   do_tti      = false;
   time_src    = NULL;
   time_format = TIME;
+  binary_h    = NULL;
+  layer_id    = 0;
   logger_h    = NULL;
 }
 
@@ -48,6 +50,8 @@ log_filter::log_filter(std::string layer)
   do_tti      = false;
   time_src    = NULL;
   time_format = TIME;
+  binary_h    = NULL;
+  layer_id    = 0;
   init(layer, &def_logger_stdout, tti);
 }
 
@@ -56,6 +60,8 @@ log_filter::log_filter(std::string layer, logger *logger_, bool tti)
   do_tti      = false;
   time_src    = NULL;
   time_format = TIME;
+  binary_h    = NULL;
+  layer_id    = 0;
   init(layer, logger_, tti);
 }
 
@@ -64,6 +70,10 @@ void log_filter::init(std::string layer, logger *logger_, bool tti)
   service_name  = layer;
   logger_h      = logger_;
   do_tti        = tti;
+  binary_h      = logger_ ? logger_->binary() : NULL;
+  if (binary_h) {
+    layer_id    = binary_h->add_layer(layer);
+  }
 }
 
 void log_filter::all_log(srslte::LOG_LEVEL_ENUM level,
@@ -147,10 +157,12 @@ void log_filter::console(const char * message, ...) {
 
 void log_filter::error(const char * message, ...) {
   if (level >= LOG_LEVEL_ERROR) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_ERROR, message, args, NULL, 0, false);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_ERROR, tti, args_msg);
     va_end(args);
     free(args_msg);
@@ -158,10 +170,12 @@ void log_filter::error(const char * message, ...) {
 }
 void log_filter::warning(const char * message, ...) {
   if (level >= LOG_LEVEL_WARNING) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_WARNING, message, args, NULL, 0, false);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_WARNING, tti, args_msg);
     va_end(args);
     free(args_msg);
@@ -169,10 +183,12 @@ void log_filter::warning(const char * message, ...) {
 }
 void log_filter::info(const char * message, ...) {
   if (level >= LOG_LEVEL_INFO) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_INFO, message, args, NULL, 0, false);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_INFO, tti, args_msg);
     va_end(args);
     free(args_msg);
@@ -180,10 +196,12 @@ void log_filter::info(const char * message, ...) {
 }
 void log_filter::debug(const char * message, ...) {
   if (level >= LOG_LEVEL_DEBUG) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_DEBUG, message, args, NULL, 0, false);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_DEBUG, tti, args_msg);
     va_end(args);
     free(args_msg);
@@ -192,10 +210,12 @@ void log_filter::debug(const char * message, ...) {
 
 void log_filter::error_hex(const uint8_t *hex, int size, const char * message, ...) {
   if (level >= LOG_LEVEL_ERROR) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_ERROR, message, args, hex, size, true);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_ERROR, tti, args_msg, hex, size);
     va_end(args);
     free(args_msg);
@@ -203,10 +223,12 @@ void log_filter::error_hex(const uint8_t *hex, int size, const char * message, .
 }
 void log_filter::warning_hex(const uint8_t *hex, int size, const char * message, ...) {
   if (level >= LOG_LEVEL_WARNING) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_WARNING, message, args, hex, size, true);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_WARNING, tti, args_msg, hex, size);
     va_end(args);
     free(args_msg);
@@ -214,10 +236,12 @@ void log_filter::warning_hex(const uint8_t *hex, int size, const char * message,
 }
 void log_filter::info_hex(const uint8_t *hex, int size, const char * message, ...) {
   if (level >= LOG_LEVEL_INFO) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_INFO, message, args, hex, size, true);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_INFO, tti, args_msg, hex, size);
     va_end(args);
     free(args_msg);
@@ -225,16 +249,55 @@ void log_filter::info_hex(const uint8_t *hex, int size, const char * message, ..
 }
 void log_filter::debug_hex(const uint8_t *hex, int size, const char * message, ...) {
   if (level >= LOG_LEVEL_DEBUG) {
-    char     *args_msg;
+    char     *args_msg = NULL;
     va_list   args;
     va_start(args, message);
-    if(vasprintf(&args_msg, message, args) > 0)
+    if (binary_h && !add_string_en)
+      binary_log(LOG_LEVEL_DEBUG, message, args, hex, size, true);
+    else if(vasprintf(&args_msg, message, args) > 0)
       all_log(LOG_LEVEL_DEBUG, tti, args_msg, hex, size);
     va_end(args);
     free(args_msg);
   }
 }
 
+void log_filter::binary_log(srslte::LOG_LEVEL_ENUM level, const char *message, va_list args,
+                            const uint8_t *hex, int size, bool is_hex)
+{
+  uint8_t  flags = 0;
+  uint64_t time_us;
+  int      hex_len = 0;
+
+  if (do_tti) {
+    flags |= LOG_RECORD_FLAG_TTI;
+  }
+  if (show_layer_en) {
+    flags |= LOG_RECORD_FLAG_LAYER;
+  }
+  if (level_text_short) {
+    flags |= LOG_RECORD_FLAG_LEVEL_SHORT;
+  }
+  if (time_format == EPOCH) {
+    flags |= LOG_RECORD_FLAG_EPOCH;
+  }
+  if (is_hex) {
+    flags |= LOG_RECORD_FLAG_HEX;
+    if (hex_limit > 0 && hex && size > 0) {
+      hex_len = (size > hex_limit) ? hex_limit : size;
+    }
+  }
+  if (time_src) {
+    srslte_timestamp_t now = time_src->get_time();
+    time_us = now.full_secs * 1000000 + (uint32_t) (now.frac_secs * 1e6);
+    flags |= LOG_RECORD_FLAG_TIME_SRC;
+  } else {
+    struct timeval rawtime;
+    gettimeofday(&rawtime, NULL);
+    time_us = rawtime.tv_sec * 1000000 + rawtime.tv_usec;
+  }
+  binary_h->log_record(layer_id, level, tti, flags, time_us, message, args, hex, hex_len);
+}
+
 void log_filter::set_time_src(time_itf *source, time_format_t format) {
   this->time_src    = source;
   this->time_format = format;
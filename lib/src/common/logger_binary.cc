@@ -0,0 +1,758 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <algorithm>
+#include <map>
+
+#include "srslte/common/logger_binary.h"
+
+#define RECORD_ALIGN(x) (((x)+7)&~7)
+
+using namespace std;
+
+namespace srslte{
+
+static const char file_magic[8] = {'S','R','S','L','O','G','0','1'};
+
+/* Reads the length modifier of a conversion. hh and ll are returned as H and
+ * q respectively.
+ */
+static const char* parse_length(const char *c, char *len)
+{
+  *len = 0;
+  if ((c[0] == 'h' && c[1] == 'h') || (c[0] == 'l' && c[1] == 'l')) {
+    *len = c[0] == 'h' ? 'H' : 'q';
+    return c + 2;
+  }
+  if (c[0] && strchr("hljztLq", c[0])) {
+    *len = c[0];
+    return c + 1;
+  }
+  return c;
+}
+
+static bool is_flag_or_width(char c)
+{
+  return c && strchr("-+ #0'123456789.", c);
+}
+
+/* Pulls the arguments of fmt out of args. Integers are stored sign or zero
+ * extended to 64 bits after truncating them to their own type, floating
+ * point values as the bits of a double. %s arguments are returned in strs.
+ * Stops at the first conversion it does not know, since the layout of the
+ * remaining arguments is then unknown.
+ */
+static uint32_t capture_args(const char *fmt, va_list args, uint64_t *vals, const char **strs)
+{
+  uint32_t n = 0;
+  const char *c = fmt;
+  while (*c && n < SRSLTE_LOGGER_BINARY_MAX_ARGS) {
+    if (*c++ != '%') {
+      continue;
+    }
+    if (*c == '%') {
+      c++;
+      continue;
+    }
+    while (is_flag_or_width(*c) || *c == '*') {
+      if (*c == '*') {
+        strs[n]   = NULL;
+        vals[n++] = (uint64_t) (int64_t) va_arg(args, int);
+        if (n == SRSLTE_LOGGER_BINARY_MAX_ARGS) {
+          return n;
+        }
+      }
+      c++;
+    }
+    char len;
+    c = parse_length(c, &len);
+    int64_t  s = 0;
+    uint64_t u = 0;
+    double   d = 0;
+    strs[n] = NULL;
+    switch (*c++) {
+      case 'd':
+      case 'i':
+        switch (len) {
+          case 'H': s = (signed char) va_arg(args, int);  break;
+          case 'h': s = (short) va_arg(args, int);        break;
+          case 'l': s = va_arg(args, long);               break;
+          case 'q': s = va_arg(args, long long);          break;
+          case 'j': s = va_arg(args, intmax_t);           break;
+          case 'z': s = va_arg(args, ssize_t);            break;
+          case 't': s = va_arg(args, ptrdiff_t);          break;
+          default:  s = va_arg(args, int);                break;
+        }
+        vals[n++] = (uint64_t) s;
+        break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+        switch (len) {
+          case 'H': u = (unsigned char) va_arg(args, unsigned int);  break;
+          case 'h': u = (unsigned short) va_arg(args, unsigned int); break;
+          case 'l': u = va_arg(args, unsigned long);                 break;
+          case 'q': u = va_arg(args, unsigned long long);            break;
+          case 'j': u = va_arg(args, uintmax_t);                     break;
+          case 'z': u = va_arg(args, size_t);                        break;
+          case 't': u = va_arg(args, ptrdiff_t);                     break;
+          default:  u = va_arg(args, unsigned int);                  break;
+        }
+        vals[n++] = u;
+        break;
+      case 'c':
+        vals[n++] = (uint64_t) va_arg(args, int);
+        break;
+      case 'e':
+      case 'E':
+      case 'f':
+      case 'F':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        d = len == 'L' ? (double) va_arg(args, long double) : va_arg(args, double);
+        memcpy(&vals[n++], &d, sizeof(double));
+        break;
+      case 's':
+        strs[n] = va_arg(args, const char*);
+        if (!strs[n]) {
+          strs[n] = "(null)";
+        }
+        vals[n++] = 0;
+        break;
+      case 'p':
+        vals[n++] = (uint64_t) (uintptr_t) va_arg(args, void*);
+        break;
+      case 'n':
+        va_arg(args, void*);
+        break;
+      default:
+        return n;
+    }
+  }
+  return n;
+}
+
+/* Formats fmt with the arguments captured by capture_args(), one conversion
+ * at a time. Conversions past the captured arguments are copied as they are.
+ */
+static std::string format_args(const char *fmt, const uint64_t *args, uint32_t nof_args, const char *strings)
+{
+  std::string out;
+  char        spec[32];
+  char        tmp[512];
+  uint32_t    n = 0;
+  const char *c = fmt;
+
+  while (*c) {
+    if (*c != '%') {
+      const char *e = strchr(c, '%');
+      if (!e) {
+        e = c + strlen(c);
+      }
+      out.append(c, e - c);
+      c = e;
+      continue;
+    }
+    if (c[1] == '%') {
+      out += '%';
+      c   += 2;
+      continue;
+    }
+    const char *start = c++;
+    uint32_t    sl    = 0;
+    spec[sl++] = '%';
+    while (is_flag_or_width(*c) || *c == '*') {
+      if (*c == '*' && n < nof_args) {
+        sl += snprintf(&spec[sl], 12, "%d", (int) args[n++]);
+      } else if (*c != '*') {
+        spec[sl++] = *c;
+      }
+      c++;
+      if (sl > sizeof(spec) - 16) {
+        break;
+      }
+    }
+    char len;
+    c = parse_length(c, &len);
+    char conv = *c;
+    if (!conv) {
+      out.append(start);
+      break;
+    }
+    c++;
+    if (conv == 'n') {
+      continue;
+    }
+    if (n >= nof_args || !strchr("diouxXceEfFgGaAsp", conv)) {
+      out.append(start, c - start);
+      continue;
+    }
+    uint64_t v = args[n++];
+    double   d;
+    int      r = 0;
+    switch (conv) {
+      case 'd':
+      case 'i':
+        strcpy(&spec[sl], "lld");
+        r = snprintf(tmp, sizeof(tmp), spec, (long long) v);
+        break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X':
+        spec[sl++] = 'l';
+        spec[sl++] = 'l';
+        spec[sl++] = conv;
+        spec[sl]   = 0;
+        r = snprintf(tmp, sizeof(tmp), spec, (unsigned long long) v);
+        break;
+      case 'c':
+        strcpy(&spec[sl], "c");
+        r = snprintf(tmp, sizeof(tmp), spec, (int) v);
+        break;
+      case 's':
+        strcpy(&spec[sl], "s");
+        r = snprintf(tmp, sizeof(tmp), spec, strings);
+        strings += v + 1;
+        break;
+      case 'p':
+        strcpy(&spec[sl], "p");
+        r = snprintf(tmp, sizeof(tmp), spec, (void*) (uintptr_t) v);
+        break;
+      default:
+        spec[sl++] = conv;
+        spec[sl]   = 0;
+        memcpy(&d, &v, sizeof(double));
+        r = snprintf(tmp, sizeof(tmp), spec, d);
+        break;
+    }
+    if (r > 0) {
+      out.append(tmp, r < (int) sizeof(tmp) ? r : sizeof(tmp) - 1);
+    }
+  }
+  return out;
+}
+
+logger_binary::logger_binary()
+  :ring_size(SRSLTE_LOGGER_BINARY_RING_SIZE)
+  ,nof_layers(0)
+  ,nof_layers_written(0)
+  ,text(false)
+  ,inited(false)
+  ,running(false)
+  ,logfile(NULL)
+  ,name_idx(0)
+  ,max_length(0)
+  ,cur_length(0)
+  ,retired_records(0)
+  ,retired_dropped(0)
+{
+  pthread_mutex_init(&mutex, NULL);
+  pthread_key_create(&ring_key, retire_ring);
+}
+
+logger_binary::~logger_binary()
+{
+  stop();
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    free(rings[i]->buf);
+    delete rings[i];
+  }
+  pthread_key_delete(ring_key);
+  pthread_mutex_destroy(&mutex);
+}
+
+bool logger_binary::init(std::string file, bool text_, int max_length_, uint32_t ring_size_)
+{
+  // Rings are a power of two bytes and hold a few records at least
+  ring_size = 4*SRSLTE_LOGGER_BINARY_MAX_RECORD;
+  while (ring_size < ring_size_) {
+    ring_size <<= 1;
+  }
+  text       = text_;
+  filename   = file;
+  max_length = (int64_t) max_length_*1024;
+  name_idx   = 0;
+  if (!open_file()) {
+    printf("Error: could not create log file, no messages will be logged!\n");
+  }
+  running = true;
+  start(-2);
+  inited = true;
+  return logfile != NULL;
+}
+
+void logger_binary::stop()
+{
+  if (inited) {
+    running = false;
+    wait_thread_finish();
+    drain();
+    if (logfile) {
+      fclose(logfile);
+      logfile = NULL;
+    }
+    inited = false;
+  }
+}
+
+bool logger_binary::open_file()
+{
+  std::string name = filename;
+  if (name_idx > 0) {
+    char numstr[21]; // enough to hold all numbers up to 64-bits
+    sprintf(numstr, ".%d", name_idx);
+    name += numstr;
+  }
+  logfile    = fopen(name.c_str(), "w");
+  cur_length = 0;
+  if (!logfile) {
+    return false;
+  }
+  if (!text) {
+    cur_length += fwrite(file_magic, 1, sizeof(file_magic), logfile);
+    // Each file can be decoded on its own
+    nof_layers_written = 0;
+    fmt_written.clear();
+  }
+  return true;
+}
+
+uint8_t logger_binary::add_layer(std::string name)
+{
+  pthread_mutex_lock(&mutex);
+  uint32_t id = nof_layers;
+  if (nof_layers < SRSLTE_LOGGER_BINARY_MAX_LAYERS) {
+    nof_layers++;
+  } else {
+    id = SRSLTE_LOGGER_BINARY_MAX_LAYERS - 1;
+  }
+  layers[id] = name;
+  pthread_mutex_unlock(&mutex);
+  return (uint8_t) id;
+}
+
+uint64_t logger_binary::get_nof_records()
+{
+  pthread_mutex_lock(&mutex);
+  uint64_t n = retired_records;
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    n += rings[i]->nof_records;
+  }
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+uint64_t logger_binary::get_nof_dropped()
+{
+  pthread_mutex_lock(&mutex);
+  uint64_t n = retired_dropped;
+  for (uint32_t i = 0; i < rings.size(); i++) {
+    n += rings[i]->nof_dropped;
+  }
+  pthread_mutex_unlock(&mutex);
+  return n;
+}
+
+/*******************************************************************************
+  Producer side. Runs on the logging thread and never blocks, except for the
+  allocation of the ring on the first message of each thread.
+*******************************************************************************/
+
+logger_binary::ring_t* logger_binary::get_ring()
+{
+  ring_t *r = (ring_t*) pthread_getspecific(ring_key);
+  if (!r) {
+    r = new ring_t;
+    r->buf = (uint8_t*) calloc(ring_size, 1);
+    if (!r->buf) {
+      delete r;
+      return NULL;
+    }
+    r->mask        = ring_size - 1;
+    r->head        = 0;
+    r->tail        = 0;
+    r->nof_records = 0;
+    r->nof_dropped = 0;
+    r->retired     = false;
+    pthread_mutex_lock(&mutex);
+    rings.push_back(r);
+    pthread_mutex_unlock(&mutex);
+    pthread_setspecific(ring_key, r);
+  }
+  return r;
+}
+
+// Called when a producer thread exits. The consumer frees the ring once it has drained it
+void logger_binary::retire_ring(void *arg)
+{
+  ring_t *r = (ring_t*) arg;
+  __sync_synchronize();
+  r->retired = true;
+}
+
+// Returns SRSLTE_LOGGER_BINARY_MAX_RECORD contiguous bytes, or NULL if full
+uint8_t* logger_binary::reserve(ring_t *r)
+{
+  uint32_t head = r->head;
+  uint32_t tail = r->tail;
+  uint32_t pos  = head & r->mask;
+  uint32_t pad  = 0;
+  if (r->mask + 1 - pos < SRSLTE_LOGGER_BINARY_MAX_RECORD) {
+    pad = r->mask + 1 - pos;
+  }
+  if (r->mask + 1 - (head - tail) < pad + SRSLTE_LOGGER_BINARY_MAX_RECORD) {
+    r->nof_dropped++;
+    return NULL;
+  }
+  if (pad) {
+    log_record_t *w = (log_record_t*) &r->buf[pos];
+    w->len  = pad;
+    w->type = LOG_RECORD_WRAP;
+    __sync_synchronize();
+    r->head = head + pad;
+    pos     = 0;
+  }
+  return &r->buf[pos];
+}
+
+void logger_binary::commit(ring_t *r, log_record_t *rec)
+{
+  __sync_synchronize();
+  r->head += rec->len;
+  r->nof_records++;
+}
+
+void logger_binary::log_record(uint8_t layer, LOG_LEVEL_ENUM level, uint32_t tti, uint8_t flags,
+                               uint64_t time_us, const char *fmt, va_list args,
+                               const uint8_t *hex, int hex_len)
+{
+  ring_t *r = get_ring();
+  if (!r) {
+    return;
+  }
+  uint64_t    vals[SRSLTE_LOGGER_BINARY_MAX_ARGS];
+  const char *strs[SRSLTE_LOGGER_BINARY_MAX_ARGS];
+  uint32_t    n = capture_args(fmt, args, vals, strs);
+
+  uint8_t *p = reserve(r);
+  if (!p) {
+    return;
+  }
+  log_record_t *rec = (log_record_t*) p;
+  uint32_t len      = sizeof(log_record_t) + n*sizeof(uint64_t);
+  uint8_t *data     = p + len;
+  uint32_t max      = SRSLTE_LOGGER_BINARY_MAX_RECORD - len;
+  uint32_t data_len = 0;
+
+  // Strings share the record, arguments from the first one that does not fit are dropped
+  uint32_t nof_args = n;
+  for (uint32_t i = 0; i < n; i++) {
+    if (strs[i]) {
+      if (data_len >= max) {
+        nof_args = i;
+        break;
+      }
+      uint32_t room = max - data_len - 1;
+      uint32_t l    = strnlen(strs[i], room < SRSLTE_LOGGER_BINARY_MAX_STR - 1 ? room : SRSLTE_LOGGER_BINARY_MAX_STR - 1);
+      memcpy(&data[data_len], strs[i], l);
+      data[data_len + l] = 0;
+      vals[i]   = l;
+      data_len += l + 1;
+    }
+  }
+  if (nof_args < n) {
+    n    = nof_args;
+    len  = sizeof(log_record_t) + n*sizeof(uint64_t);
+    memmove(p + len, data, data_len);
+    data = p + len;
+    max  = SRSLTE_LOGGER_BINARY_MAX_RECORD - len;
+  }
+  memcpy(&rec[1], vals, n*sizeof(uint64_t));
+
+  uint32_t h = 0;
+  if (hex && hex_len > 0 && data_len < max) {
+    h = (uint32_t) hex_len < max - data_len ? hex_len : max - data_len;
+    memcpy(&data[data_len], hex, h);
+  }
+
+  rec->type     = LOG_RECORD_MSG;
+  rec->level    = level;
+  rec->nof_args = n;
+  rec->layer    = layer;
+  rec->flags    = flags;
+  rec->reserved = 0;
+  rec->data_len = data_len + h;
+  rec->hex_len  = h;
+  rec->tti      = tti;
+  rec->time_us  = time_us;
+  rec->fmt      = (uint64_t) (uintptr_t) fmt;
+  rec->len      = RECORD_ALIGN(len + data_len + h);
+  commit(r, rec);
+}
+
+void logger_binary::log(const char *msg)
+{
+  ring_t *r = get_ring();
+  if (!r) {
+    return;
+  }
+  uint8_t *p = reserve(r);
+  if (!p) {
+    return;
+  }
+  log_record_t *rec = (log_record_t*) p;
+  uint32_t max = SRSLTE_LOGGER_BINARY_MAX_RECORD - sizeof(log_record_t);
+  uint32_t l   = strnlen(msg, max);
+  memcpy(&rec[1], msg, l);
+
+  bzero(rec, sizeof(log_record_t));
+  rec->type     = LOG_RECORD_TEXT;
+  rec->data_len = l;
+  rec->len      = RECORD_ALIGN(sizeof(log_record_t) + l);
+  commit(r, rec);
+}
+
+void logger_binary::log(std::string *msg)
+{
+  log(msg->c_str());
+  delete msg;
+}
+
+/*******************************************************************************
+  Consumer side
+*******************************************************************************/
+
+void logger_binary::run_thread()
+{
+  while (running) {
+    if (!drain()) {
+      usleep(1000);
+    }
+  }
+}
+
+bool logger_binary::drain()
+{
+  pthread_mutex_lock(&mutex);
+  std::vector<ring_t*> r = rings;
+  pthread_mutex_unlock(&mutex);
+
+  bool any = false;
+  std::vector<ring_t*> done;
+  for (uint32_t i = 0; i < r.size(); i++) {
+    // Once its thread has exited, the head read below is final
+    bool retired = r[i]->retired;
+    __sync_synchronize();
+    uint32_t head = r[i]->head;
+    __sync_synchronize();
+    uint32_t tail = r[i]->tail;
+    while (tail != head) {
+      log_record_t *rec = (log_record_t*) &r[i]->buf[tail & r[i]->mask];
+      if (rec->type != LOG_RECORD_WRAP) {
+        write_record(rec);
+      }
+      tail += rec->len;
+      any   = true;
+    }
+    __sync_synchronize();
+    r[i]->tail = tail;
+    if (retired) {
+      done.push_back(r[i]);
+    }
+  }
+
+  if (!done.empty()) {
+    pthread_mutex_lock(&mutex);
+    for (uint32_t i = 0; i < done.size(); i++) {
+      rings.erase(std::find(rings.begin(), rings.end(), done[i]));
+      retired_records += done[i]->nof_records;
+      retired_dropped += done[i]->nof_dropped;
+      free(done[i]->buf);
+      delete done[i];
+    }
+    pthread_mutex_unlock(&mutex);
+  }
+  return any;
+}
+
+void logger_binary::write_def(log_record_type_t type, uint64_t id, const char *str)
+{
+  log_record_t rec;
+  uint8_t      pad[8] = {0};
+  uint32_t     l      = strlen(str) + 1;
+
+  bzero(&rec, sizeof(log_record_t));
+  rec.type     = type;
+  rec.layer    = (uint8_t) id;
+  rec.fmt      = id;
+  rec.data_len = l;
+  rec.len      = RECORD_ALIGN(sizeof(log_record_t) + l);
+  cur_length  += fwrite(&rec, 1, sizeof(log_record_t), logfile);
+  cur_length  += fwrite(str, 1, l, logfile);
+  cur_length  += fwrite(pad, 1, rec.len - sizeof(log_record_t) - l, logfile);
+}
+
+void logger_binary::write_record(const log_record_t *rec)
+{
+  if (!logfile) {
+    return;
+  }
+  const char *fmt = (const char*) (uintptr_t) rec->fmt;
+  if (text) {
+    std::string s = render(rec, fmt, layers[rec->layer].c_str());
+    cur_length += fwrite(s.data(), 1, s.size(), logfile);
+  } else {
+    if (rec->type == LOG_RECORD_MSG) {
+      while (nof_layers_written <= rec->layer) {
+        write_def(LOG_RECORD_LAYER_DEF, nof_layers_written, layers[nof_layers_written].c_str());
+        nof_layers_written++;
+      }
+      if (fmt_written.find(rec->fmt) == fmt_written.end()) {
+        write_def(LOG_RECORD_FMT_DEF, rec->fmt, fmt);
+        fmt_written.insert(rec->fmt);
+      }
+    }
+    cur_length += fwrite(rec, 1, rec->len, logfile);
+  }
+  if (max_length > 0 && cur_length >= max_length) {
+    fclose(logfile);
+    name_idx++;
+    if (!open_file()) {
+      printf("Error: could not create log file, no messages will be logged!\n");
+    }
+  }
+}
+
+/*******************************************************************************
+  Rendering
+*******************************************************************************/
+
+std::string logger_binary::render(const log_record_t *r, const char *fmt, const char *layer)
+{
+  const uint8_t *data = (const uint8_t*) &r[1] + r->nof_args*sizeof(uint64_t);
+  if (r->type == LOG_RECORD_TEXT) {
+    return std::string((const char*) data, r->data_len);
+  }
+
+  std::string s;
+  char        buffer[64];
+  time_t      secs = r->time_us/1000000;
+  uint32_t    us   = r->time_us%1000000;
+
+  if (r->flags & LOG_RECORD_FLAG_EPOCH) {
+    snprintf(buffer, sizeof(buffer), "%lu", (unsigned long) r->time_us);
+  } else if (r->flags & LOG_RECORD_FLAG_TIME_SRC) {
+    snprintf(buffer, sizeof(buffer), "%ld:%06u", (long) secs, us);
+  } else {
+    struct tm timeinfo;
+    localtime_r(&secs, &timeinfo);
+    size_t n = strftime(buffer, sizeof(buffer), "%H:%M:%S", &timeinfo);
+    snprintf(&buffer[n], sizeof(buffer) - n, ".%06u", us);
+  }
+  s += buffer;
+  s += " ";
+  if (r->flags & LOG_RECORD_FLAG_LAYER) {
+    s += "[";
+    s += layer;
+    s += "] ";
+  }
+  s += (r->flags & LOG_RECORD_FLAG_LEVEL_SHORT) ? log_level_text_short[r->level] : log_level_text[r->level];
+  s += " ";
+  if (r->flags & LOG_RECORD_FLAG_TTI) {
+    snprintf(buffer, sizeof(buffer), "[%05u] ", r->tti);
+    s += buffer;
+  }
+
+  std::string msg = format_args(fmt, (const uint64_t*) &r[1], r->nof_args, (const char*) data);
+  s += msg;
+
+  if (r->flags & LOG_RECORD_FLAG_HEX) {
+    if (msg.empty() || msg[msg.size() - 1] != '\n') {
+      s += "\n";
+    }
+    const uint8_t *hex = data + r->data_len - r->hex_len;
+    for (uint32_t c = 0; c < r->hex_len; c += 16) {
+      snprintf(buffer, sizeof(buffer), "             %04x: ", c);
+      s += buffer;
+      for (uint32_t i = c; i < r->hex_len && i < c + 16; i++) {
+        snprintf(buffer, sizeof(buffer), "%02x ", hex[i]);
+        s += buffer;
+      }
+      s += "\n";
+    }
+  }
+  return s;
+}
+
+int logger_binary::decode(FILE *in, FILE *out)
+{
+  char magic[sizeof(file_magic)];
+  if (fread(magic, 1, sizeof(magic), in) != sizeof(magic) || memcmp(magic, file_magic, sizeof(magic))) {
+    return -1;
+  }
+
+  std::map<uint64_t, std::string> fmts;
+  std::string                     names[SRSLTE_LOGGER_BINARY_MAX_LAYERS];
+  uint64_t                        buf[SRSLTE_LOGGER_BINARY_MAX_RECORD/sizeof(uint64_t)];
+  log_record_t                   *rec = (log_record_t*) buf;
+  int                             n   = 0;
+
+  while (fread(rec, 1, sizeof(log_record_t), in) == sizeof(log_record_t)) {
+    if (rec->len < sizeof(log_record_t) || rec->len > sizeof(buf) ||
+        fread(&rec[1], 1, rec->len - sizeof(log_record_t), in) != rec->len - sizeof(log_record_t)) {
+      return -1;
+    }
+    const char *data = (const char*) &rec[1];
+    switch (rec->type) {
+      case LOG_RECORD_FMT_DEF:
+        fmts[rec->fmt] = std::string(data);
+        break;
+      case LOG_RECORD_LAYER_DEF:
+        names[rec->layer] = std::string(data);
+        break;
+      case LOG_RECORD_MSG:
+      case LOG_RECORD_TEXT: {
+        std::string s = render(rec, fmts[rec->fmt].c_str(), names[rec->layer].c_str());
+        fwrite(s.data(), 1, s.size(), out);
+        n++;
+        break;
+      }
+      default:
+        return -1;
+    }
+  }
+  return n;
+}
+
+} // namespace srslte
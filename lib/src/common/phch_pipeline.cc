@@ -0,0 +1,156 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <strings.h>
+#include "srslte/common/phch_pipeline.h"
+
+namespace srslte {
+
+phch_pipeline::phch_pipeline()
+{
+  running      = false;
+  nof_stages   = 0;
+  nof_sections = 0;
+  bzero(next_seq, sizeof(next_seq));
+  bzero(budget_us, sizeof(budget_us));
+  bzero(sum_us, sizeof(sum_us));
+  bzero(metrics, sizeof(metrics));
+  pthread_mutex_init(&mutex, NULL);
+  pthread_mutex_init(&metrics_mutex, NULL);
+  pthread_cond_init(&cvar, NULL);
+}
+
+phch_pipeline::~phch_pipeline()
+{
+  pthread_mutex_destroy(&mutex);
+  pthread_mutex_destroy(&metrics_mutex);
+  pthread_cond_destroy(&cvar);
+}
+
+void phch_pipeline::init(uint32_t nof_stages_, const float *budget_share, uint32_t nof_sections_, uint32_t budget_us_)
+{
+  nof_stages   = nof_stages_   < SRSLTE_PIPELINE_MAX_STAGES   ? nof_stages_   : SRSLTE_PIPELINE_MAX_STAGES;
+  nof_sections = nof_sections_ < SRSLTE_PIPELINE_MAX_SECTIONS ? nof_sections_ : SRSLTE_PIPELINE_MAX_SECTIONS;
+  if (!budget_us_) {
+    budget_us_ = DEFAULT_BUDGET_US;
+  }
+  for (uint32_t i=0;i<nof_stages;i++) {
+    budget_us[i] = (uint32_t) (budget_share[i]*budget_us_);
+  }
+  pthread_mutex_lock(&mutex);
+  bzero(next_seq, sizeof(next_seq));
+  running = true;
+  pthread_mutex_unlock(&mutex);
+}
+
+void phch_pipeline::stop()
+{
+  pthread_mutex_lock(&mutex);
+  running = false;
+  pthread_cond_broadcast(&cvar);
+  pthread_mutex_unlock(&mutex);
+}
+
+bool phch_pipeline::enter(uint32_t section, uint32_t seq)
+{
+  pthread_mutex_lock(&mutex);
+  while (running && next_seq[section] != seq) {
+    pthread_cond_wait(&cvar, &mutex);
+  }
+  bool ret = running;
+  pthread_mutex_unlock(&mutex);
+  return ret;
+}
+
+void phch_pipeline::leave(uint32_t section, uint32_t seq)
+{
+  pthread_mutex_lock(&mutex);
+  next_seq[section] = seq+1;
+  pthread_cond_broadcast(&cvar);
+  pthread_mutex_unlock(&mutex);
+}
+
+void phch_pipeline::skip(uint32_t seq, uint32_t first_section)
+{
+  for (uint32_t i=first_section;i<nof_sections;i++) {
+    if (enter(i, seq)) {
+      leave(i, seq);
+    }
+  }
+}
+
+bool phch_pipeline::stage_end(uint32_t stage, struct timeval *t_rx, uint32_t *finish_us)
+{
+  struct timeval t_now;
+  gettimeofday(&t_now, NULL);
+  int64_t  diff = (int64_t) (t_now.tv_sec - t_rx->tv_sec)*1000000 + (t_now.tv_usec - t_rx->tv_usec);
+  uint32_t us   = diff > 0 ? (uint32_t) diff : 0;
+  bool late = us > budget_us[stage];
+
+  uint32_t bin = us/SRSLTE_PIPELINE_HIST_BIN_US;
+  if (bin >= SRSLTE_PIPELINE_HIST_SZ) {
+    bin = SRSLTE_PIPELINE_HIST_SZ-1;
+  }
+
+  pthread_mutex_lock(&metrics_mutex);
+  pipeline_stage_metrics_t *m = &metrics[stage];
+  m->nof_ttis++;
+  if (late) {
+    m->nof_late++;
+  }
+  if (us > m->max_us) {
+    m->max_us = us;
+  }
+  m->hist[bin]++;
+  sum_us[stage] += us;
+  pthread_mutex_unlock(&metrics_mutex);
+
+  if (finish_us) {
+    *finish_us = us;
+  }
+  return late;
+}
+
+uint32_t phch_pipeline::get_budget_us(uint32_t stage)
+{
+  return budget_us[stage];
+}
+
+void phch_pipeline::get_metrics(pipeline_stage_metrics_t *stages)
+{
+  pthread_mutex_lock(&metrics_mutex);
+  for (uint32_t i=0;i<nof_stages;i++) {
+    metrics[i].budget_us = budget_us[i];
+    metrics[i].avg_us    = metrics[i].nof_ttis ? (float) sum_us[i]/metrics[i].nof_ttis : 0;
+    stages[i] = metrics[i];
+  }
+  bzero(metrics, sizeof(metrics));
+  bzero(sum_us, sizeof(sum_us));
+  pthread_mutex_unlock(&metrics_mutex);
+}
+
+} // namespace srslte
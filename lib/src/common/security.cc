@@ -27,7 +27,8 @@
 
 #include "srslte/common/security.h"
 #include "srslte/common/liblte_security.h"
-#include "srslte/common/snow_3g.h"
+#include "srslte/common/security_snow3g.h"
+#include <string.h>
 
 namespace srslte {
 
@@ -132,20 +133,13 @@ uint8_t security_128_eia1( uint8_t  *key,
                            uint32_t  msg_len,
                            uint8_t  *mac)
 {
-  uint32_t msg_len_bits;
-  uint32_t i;
-  uint8_t *m_ptr;
-
-  msg_len_bits = msg_len*8;
-  m_ptr = snow3g_f9(key,
-                    count,
-                    bearer,
-                    direction,
-                    msg,
-                    msg_len_bits);
-  for(i=0; i<4; i++) {
-    mac[i] = m_ptr[i];
-  }
+  security_snow3g_f9(key,
+                     count,
+                     bearer,
+                     direction,
+                     msg,
+                     (uint64_t) msg_len*8,
+                     mac);
   return ERROR_NONE;
 }
 
@@ -206,6 +200,126 @@ uint8_t security_128_eea2(uint8_t  *key,
                                            msg_out);
 }
 
+/******************************************************************************
+ * Security context
+ *****************************************************************************/
+
+security_ctx::security_ctx()
+{
+  bzero(k_enc, sizeof(k_enc));
+  bzero(k_int, sizeof(k_int));
+  cipher_algo = CIPHERING_ALGORITHM_ID_EEA0;
+  integ_algo  = INTEGRITY_ALGORITHM_ID_EIA0;
+}
+
+void security_ctx::config(uint8_t                     *k_enc_,
+                          uint8_t                     *k_int_,
+                          CIPHERING_ALGORITHM_ID_ENUM  cipher_algo_,
+                          INTEGRITY_ALGORITHM_ID_ENUM  integ_algo_)
+{
+  memcpy(k_enc, &k_enc_[16], 16);
+  memcpy(k_int, &k_int_[16], 16);
+  cipher_algo = cipher_algo_;
+  integ_algo  = integ_algo_;
+  if (cipher_algo == CIPHERING_ALGORITHM_ID_128_EEA2) {
+    security_aes_init(&aes_enc, k_enc);
+  }
+  if (integ_algo == INTEGRITY_ALGORITHM_ID_128_EIA2) {
+    security_aes_init(&aes_int, k_int);
+  }
+}
+
+CIPHERING_ALGORITHM_ID_ENUM security_ctx::get_cipher_algo()
+{
+  return cipher_algo;
+}
+
+INTEGRITY_ALGORITHM_ID_ENUM security_ctx::get_integ_algo()
+{
+  return integ_algo;
+}
+
+uint8_t security_ctx::integrity(uint32_t  count,
+                                uint8_t   bearer,
+                                uint8_t   direction,
+                                uint8_t  *msg,
+                                uint32_t  msg_len,
+                                uint8_t  *mac)
+{
+  security_pdu_t pdu;
+  pdu.count     = count;
+  pdu.bearer    = bearer;
+  pdu.direction = direction;
+  pdu.msg       = msg;
+  pdu.msg_len   = msg_len;
+  pdu.out       = mac;
+  return integrity(&pdu, 1);
+}
+
+uint8_t security_ctx::cipher(uint32_t  count,
+                             uint8_t   bearer,
+                             uint8_t   direction,
+                             uint8_t  *msg,
+                             uint32_t  msg_len,
+                             uint8_t  *msg_out)
+{
+  security_pdu_t pdu;
+  pdu.count     = count;
+  pdu.bearer    = bearer;
+  pdu.direction = direction;
+  pdu.msg       = msg;
+  pdu.msg_len   = msg_len;
+  pdu.out       = msg_out;
+  return cipher(&pdu, 1);
+}
+
+uint8_t security_ctx::integrity(security_pdu_t *pdus,
+                                uint32_t        nof_pdus)
+{
+  switch(integ_algo) {
+  case INTEGRITY_ALGORITHM_ID_EIA0:
+    break;
+  case INTEGRITY_ALGORITHM_ID_128_EIA1:
+    for (uint32_t i = 0; i < nof_pdus; i++) {
+      security_128_eia1(k_int, pdus[i].count, pdus[i].bearer, pdus[i].direction,
+                        pdus[i].msg, pdus[i].msg_len, pdus[i].out);
+    }
+    break;
+  case INTEGRITY_ALGORITHM_ID_128_EIA2:
+    security_aes_eia2(&aes_int, pdus, nof_pdus);
+    break;
+  default:
+    break;
+  }
+  return ERROR_NONE;
+}
+
+uint8_t security_ctx::cipher(security_pdu_t *pdus,
+                             uint32_t        nof_pdus)
+{
+  switch(cipher_algo) {
+  case CIPHERING_ALGORITHM_ID_EEA0:
+    for (uint32_t i = 0; i < nof_pdus; i++) {
+      if (pdus[i].out != pdus[i].msg) {
+        memcpy(pdus[i].out, pdus[i].msg, pdus[i].msg_len);
+      }
+    }
+    break;
+  case CIPHERING_ALGORITHM_ID_128_EEA1:
+    for (uint32_t i = 0; i < nof_pdus; i++) {
+      security_128_eea1(k_enc, pdus[i].count, pdus[i].bearer, pdus[i].direction,
+                        pdus[i].msg, pdus[i].msg_len, pdus[i].out);
+    }
+    break;
+  case CIPHERING_ALGORITHM_ID_128_EEA2:
+    security_aes_eea2(&aes_enc, pdus, nof_pdus);
+    break;
+  default:
+    break;
+  }
+  return ERROR_NONE;
+}
+
 /******************************************************************************
  * Authentication
  *****************************************************************************/
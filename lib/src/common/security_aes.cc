@@ -0,0 +1,529 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include "srslte/common/security_aes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SECURITY_AES_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 8)
+#define SECURITY_AES_VAES
+#endif
+#endif
+
+namespace srslte {
+
+#define AES_NR     10
+#define AES_LANES  8   // Blocks encrypted together
+
+// CPUID feature bits
+#define CPUID1_ECX_SSSE3     (1 << 9)
+#define CPUID1_ECX_AES       (1 << 25)
+#define CPUID1_ECX_OSXSAVE   (1 << 27)
+#define CPUID7_EBX_AVX512F   (1 << 16)
+#define CPUID7_EBX_AVX512BW  (1 << 30)
+#define CPUID7_ECX_VAES      (1 << 9)
+#define XCR0_AVX512_STATE    0xe6  // SSE, AVX, opmask and ZMM registers
+
+#define ROTL8(x, s)  ((uint8_t) (((x) << (s)) | ((x) >> (8 - (s)))))
+#define ROR32(x, s)  (((x) >> (s)) | ((x) << (32 - (s))))
+#define GET_U32(p)   (((uint32_t) (p)[0] << 24) | ((uint32_t) (p)[1] << 16) | ((uint32_t) (p)[2] << 8) | (uint32_t) (p)[3])
+#define PUT_U32(p, v) { (p)[0] = (uint8_t) ((v) >> 24); (p)[1] = (uint8_t) ((v) >> 16); \
+                        (p)[2] = (uint8_t) ((v) >> 8);  (p)[3] = (uint8_t) (v); }
+
+typedef void (*encrypt_blocks_fn)(const uint8_t *rk, const uint8_t *in, uint8_t *out, uint32_t nof_blocks);
+
+/******************************************************************************
+ * Software AES
+ *****************************************************************************/
+
+static uint8_t        sbox[256];
+static uint32_t       te0[256];  // S-box with MixColumns (2s, s, s, 3s), rotated for the other rows
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+static security_aes_impl_t cpu_impl;  // CPUID traps to the hypervisor on VMs, so it is read once
+
+static uint8_t xtime(uint8_t x)
+{
+  return (uint8_t) ((x << 1) ^ ((x & 0x80) ? 0x1b : 0));
+}
+
+static void tables_init()
+{
+  // Walks the multiplicative group with generator 3, p = 3^i and q = 3^-i
+  uint8_t p = 1, q = 1;
+  do {
+    p = (uint8_t) (p ^ (p << 1) ^ ((p & 0x80) ? 0x1b : 0));
+    q ^= q << 1;
+    q ^= q << 2;
+    q ^= q << 4;
+    q ^= (q & 0x80) ? 0x09 : 0;
+    sbox[p] = (uint8_t) (q ^ ROTL8(q, 1) ^ ROTL8(q, 2) ^ ROTL8(q, 3) ^ ROTL8(q, 4) ^ 0x63);
+  } while (p != 1);
+  sbox[0] = 0x63;
+
+  for (int i = 0; i < 256; i++) {
+    uint8_t s = sbox[i];
+    te0[i] = ((uint32_t) xtime(s) << 24) | ((uint32_t) s << 16) | ((uint32_t) s << 8) | (uint32_t) (xtime(s) ^ s);
+  }
+  cpu_impl = security_aes_get_impl();
+}
+
+static void key_expand(const uint8_t *key, uint8_t *rk)
+{
+  uint8_t rcon = 1;
+  memcpy(rk, key, 16);
+  for (int i = 4; i < 4*(AES_NR+1); i++) {
+    uint8_t t[4];
+    memcpy(t, &rk[4*(i-1)], 4);
+    if (i % 4 == 0) {
+      uint8_t t0 = t[0];
+      t[0] = sbox[t[1]] ^ rcon;
+      t[1] = sbox[t[2]];
+      t[2] = sbox[t[3]];
+      t[3] = sbox[t0];
+      rcon = xtime(rcon);
+    }
+    for (int j = 0; j < 4; j++) {
+      rk[4*i+j] = rk[4*(i-4)+j] ^ t[j];
+    }
+  }
+}
+
+static void soft_encrypt(const uint8_t *rk, const uint8_t *in, uint8_t *out)
+{
+  uint32_t s0 = GET_U32(in)    ^ GET_U32(rk);
+  uint32_t s1 = GET_U32(in+4)  ^ GET_U32(rk+4);
+  uint32_t s2 = GET_U32(in+8)  ^ GET_U32(rk+8);
+  uint32_t s3 = GET_U32(in+12) ^ GET_U32(rk+12);
+
+  for (int r = 1; r < AES_NR; r++) {
+    const uint8_t *k = &rk[16*r];
+    uint32_t t0 = te0[s0 >> 24] ^ ROR32(te0[(s1 >> 16) & 0xff], 8) ^ ROR32(te0[(s2 >> 8) & 0xff], 16) ^ ROR32(te0[s3 & 0xff], 24) ^ GET_U32(k);
+    uint32_t t1 = te0[s1 >> 24] ^ ROR32(te0[(s2 >> 16) & 0xff], 8) ^ ROR32(te0[(s3 >> 8) & 0xff], 16) ^ ROR32(te0[s0 & 0xff], 24) ^ GET_U32(k+4);
+    uint32_t t2 = te0[s2 >> 24] ^ ROR32(te0[(s3 >> 16) & 0xff], 8) ^ ROR32(te0[(s0 >> 8) & 0xff], 16) ^ ROR32(te0[s1 & 0xff], 24) ^ GET_U32(k+8);
+    uint32_t t3 = te0[s3 >> 24] ^ ROR32(te0[(s0 >> 16) & 0xff], 8) ^ ROR32(te0[(s1 >> 8) & 0xff], 16) ^ ROR32(te0[s2 & 0xff], 24) ^ GET_U32(k+12);
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+
+  const uint8_t *k = &rk[16*AES_NR];
+  uint32_t o0 = (((uint32_t) sbox[s0 >> 24] << 24) | ((uint32_t) sbox[(s1 >> 16) & 0xff] << 16) |
+                 ((uint32_t) sbox[(s2 >> 8) & 0xff] << 8) | sbox[s3 & 0xff]) ^ GET_U32(k);
+  uint32_t o1 = (((uint32_t) sbox[s1 >> 24] << 24) | ((uint32_t) sbox[(s2 >> 16) & 0xff] << 16) |
+                 ((uint32_t) sbox[(s3 >> 8) & 0xff] << 8) | sbox[s0 & 0xff]) ^ GET_U32(k+4);
+  uint32_t o2 = (((uint32_t) sbox[s2 >> 24] << 24) | ((uint32_t) sbox[(s3 >> 16) & 0xff] << 16) |
+                 ((uint32_t) sbox[(s0 >> 8) & 0xff] << 8) | sbox[s1 & 0xff]) ^ GET_U32(k+8);
+  uint32_t o3 = (((uint32_t) sbox[s3 >> 24] << 24) | ((uint32_t) sbox[(s0 >> 16) & 0xff] << 16) |
+                 ((uint32_t) sbox[(s1 >> 8) & 0xff] << 8) | sbox[s2 & 0xff]) ^ GET_U32(k+12);
+  PUT_U32(out,    o0);
+  PUT_U32(out+4,  o1);
+  PUT_U32(out+8,  o2);
+  PUT_U32(out+12, o3);
+}
+
+static void soft_encrypt_blocks(const uint8_t *rk, const uint8_t *in, uint8_t *out, uint32_t nof_blocks)
+{
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    soft_encrypt(rk, &in[16*i], &out[16*i]);
+  }
+}
+
+/******************************************************************************
+ * AES-NI and VAES
+ *****************************************************************************/
+
+#ifdef SECURITY_AES_X86
+
+#define AESNI_TARGET __attribute__((target("aes,ssse3")))
+
+// Up to AES_LANES independent blocks, interleaved to hide the latency of AESENC
+AESNI_TARGET
+static void aesni_encrypt_blocks(const uint8_t *rk, const uint8_t *in, uint8_t *out, uint32_t nof_blocks)
+{
+  __m128i k[AES_NR+1];
+  __m128i b[AES_LANES];
+  for (int r = 0; r <= AES_NR; r++) {
+    k[r] = _mm_load_si128((const __m128i*) &rk[16*r]);
+  }
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    b[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i*) &in[16*i]), k[0]);
+  }
+  for (int r = 1; r < AES_NR; r++) {
+    for (uint32_t i = 0; i < nof_blocks; i++) {
+      b[i] = _mm_aesenc_si128(b[i], k[r]);
+    }
+  }
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    _mm_storeu_si128((__m128i*) &out[16*i], _mm_aesenclast_si128(b[i], k[AES_NR]));
+  }
+}
+
+/* CTR mode over a multiple of AES_LANES blocks. The counter is the big-endian
+ * 128-bit iv, incremented in its 64 LSBs only, which start at zero in EEA2 */
+AESNI_TARGET
+static void aesni_ctr(const uint8_t *rk, const uint8_t *iv, const uint8_t *in, uint8_t *out, uint32_t nof_blocks)
+{
+  const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i one   = _mm_set_epi64x(0, 1);
+  __m128i ctr = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) iv), bswap);
+  __m128i k[AES_NR+1];
+  for (int r = 0; r <= AES_NR; r++) {
+    k[r] = _mm_load_si128((const __m128i*) &rk[16*r]);
+  }
+
+  for (uint32_t n = 0; n < nof_blocks; n += AES_LANES) {
+    __m128i b[AES_LANES];
+    for (int i = 0; i < AES_LANES; i++) {
+      b[i] = _mm_xor_si128(_mm_shuffle_epi8(ctr, bswap), k[0]);
+      ctr  = _mm_add_epi64(ctr, one);
+    }
+    for (int r = 1; r < AES_NR; r++) {
+      for (int i = 0; i < AES_LANES; i++) {
+        b[i] = _mm_aesenc_si128(b[i], k[r]);
+      }
+    }
+    for (int i = 0; i < AES_LANES; i++) {
+      __m128i ks = _mm_aesenclast_si128(b[i], k[AES_NR]);
+      _mm_storeu_si128((__m128i*) &out[16*i], _mm_xor_si128(ks, _mm_loadu_si128((const __m128i*) &in[16*i])));
+    }
+    in  += 16*AES_LANES;
+    out += 16*AES_LANES;
+  }
+}
+
+#ifdef SECURITY_AES_VAES
+
+#define VAES_TARGET __attribute__((target("vaes,avx512f,avx512bw")))
+#define VAES_BLOCKS 16  // Four blocks in each of four ZMM registers
+
+// The zero-masked form avoids the uninitialized upper lanes of the plain one
+#define broadcast_128(x) _mm512_maskz_broadcast_i32x4(0xffff, x)
+
+// Returns the number of blocks processed, a multiple of VAES_BLOCKS
+VAES_TARGET
+static uint32_t vaes_ctr(const uint8_t *rk, const uint8_t *iv, const uint8_t *in, uint8_t *out, uint32_t nof_blocks)
+{
+  const __m512i bswap = broadcast_128(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+  const __m512i four  = _mm512_set_epi64(0, 4, 0, 4, 0, 4, 0, 4);
+  __m512i ctr = _mm512_shuffle_epi8(broadcast_128(_mm_loadu_si128((const __m128i*) iv)), bswap);
+  ctr = _mm512_add_epi64(ctr, _mm512_set_epi64(0, 3, 0, 2, 0, 1, 0, 0));
+  __m512i k[AES_NR+1];
+  for (int r = 0; r <= AES_NR; r++) {
+    k[r] = broadcast_128(_mm_load_si128((const __m128i*) &rk[16*r]));
+  }
+
+  uint32_t n;
+  for (n = 0; n + VAES_BLOCKS <= nof_blocks; n += VAES_BLOCKS) {
+    __m512i b[4];
+    for (int i = 0; i < 4; i++) {
+      b[i] = _mm512_xor_si512(_mm512_shuffle_epi8(ctr, bswap), k[0]);
+      ctr  = _mm512_add_epi64(ctr, four);
+    }
+    for (int r = 1; r < AES_NR; r++) {
+      for (int i = 0; i < 4; i++) {
+        b[i] = _mm512_aesenc_epi128(b[i], k[r]);
+      }
+    }
+    for (int i = 0; i < 4; i++) {
+      __m512i ks = _mm512_aesenclast_epi128(b[i], k[AES_NR]);
+      _mm512_storeu_si512((__m512i*) &out[64*i], _mm512_xor_si512(ks, _mm512_loadu_si512((const __m512i*) &in[64*i])));
+    }
+    in  += 16*VAES_BLOCKS;
+    out += 16*VAES_BLOCKS;
+  }
+  return n;
+}
+
+#endif // SECURITY_AES_VAES
+
+#endif // SECURITY_AES_X86
+
+/******************************************************************************
+ * Common
+ *****************************************************************************/
+
+security_aes_impl_t security_aes_get_impl()
+{
+#ifdef SECURITY_AES_X86
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+      !(ecx & CPUID1_ECX_AES) || !(ecx & CPUID1_ECX_SSSE3)) {
+    return SECURITY_AES_IMPL_SOFT;
+  }
+  security_aes_impl_t impl = SECURITY_AES_IMPL_AESNI;
+#ifdef SECURITY_AES_VAES
+  if ((ecx & CPUID1_ECX_OSXSAVE) && __get_cpuid_max(0, NULL) >= 7) {
+    unsigned int xcr0_lo, xcr0_hi;
+    __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if ((xcr0_lo & XCR0_AVX512_STATE) == XCR0_AVX512_STATE &&
+        (ebx & CPUID7_EBX_AVX512F) && (ebx & CPUID7_EBX_AVX512BW) && (ecx & CPUID7_ECX_VAES)) {
+      impl = SECURITY_AES_IMPL_VAES;
+    }
+  }
+#endif
+  return impl;
+#else
+  return SECURITY_AES_IMPL_SOFT;
+#endif
+}
+
+void security_aes_init(security_aes_t *q, uint8_t *key, security_aes_impl_t impl)
+{
+  pthread_once(&tables_once, tables_init);
+
+  q->impl = (impl > cpu_impl) ? cpu_impl : impl;
+  key_expand(key, q->rk);
+
+  // CMAC subkeys, RFC 4493 Section 2.3
+  uint8_t zero[16] = {0};
+  uint8_t L[16];
+  security_aes_encrypt_block(q, zero, L);
+  for (int i = 0; i < 15; i++) {
+    q->k1[i] = (uint8_t) ((L[i] << 1) | (L[i+1] >> 7));
+  }
+  q->k1[15] = (uint8_t) ((L[15] << 1) ^ ((L[0] & 0x80) ? 0x87 : 0));
+  for (int i = 0; i < 15; i++) {
+    q->k2[i] = (uint8_t) ((q->k1[i] << 1) | (q->k1[i+1] >> 7));
+  }
+  q->k2[15] = (uint8_t) ((q->k1[15] << 1) ^ ((q->k1[0] & 0x80) ? 0x87 : 0));
+}
+
+static encrypt_blocks_fn get_encrypt_blocks(security_aes_t *q)
+{
+#ifdef SECURITY_AES_X86
+  if (q->impl != SECURITY_AES_IMPL_SOFT) {
+    return aesni_encrypt_blocks;
+  }
+#endif
+  return soft_encrypt_blocks;
+}
+
+void security_aes_encrypt_block(security_aes_t *q, uint8_t *in, uint8_t *out)
+{
+  get_encrypt_blocks(q)(q->rk, in, out, 1);
+}
+
+static void ctr_add(uint8_t *ctr, uint64_t n)
+{
+  uint64_t lo = 0;
+  for (int i = 8; i < 16; i++) {
+    lo = (lo << 8) | ctr[i];
+  }
+  lo += n;
+  for (int i = 15; i >= 8; i--) {
+    ctr[i] = (uint8_t) lo;
+    lo >>= 8;
+  }
+}
+
+// Counter block of 33.401 Annex B.1.3
+static void eea2_iv(security_pdu_t *pdu, uint8_t *iv)
+{
+  memset(iv, 0, 16);
+  PUT_U32(iv, pdu->count);
+  iv[4] = (uint8_t) (((pdu->bearer & 0x1f) << 3) | ((pdu->direction & 0x01) << 2));
+}
+
+static void eea2_flush(security_aes_t *q, encrypt_blocks_fn encrypt_blocks, uint8_t *ctr, uint8_t *ks,
+                       const uint8_t **src, uint8_t **dst, uint32_t *len, uint32_t nof_blocks)
+{
+  encrypt_blocks(q->rk, ctr, ks, nof_blocks);
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    for (uint32_t j = 0; j < len[i]; j++) {
+      dst[i][j] = src[i][j] ^ ks[16*i+j];
+    }
+  }
+}
+
+void security_aes_eea2(security_aes_t *q, security_pdu_t *pdus, uint32_t nof_pdus)
+{
+  encrypt_blocks_fn encrypt_blocks = get_encrypt_blocks(q);
+
+  // Blocks of short PDUs and the tails of long ones are encrypted together
+  uint8_t        ctr[AES_LANES*16];
+  uint8_t        ks[AES_LANES*16];
+  const uint8_t *src[AES_LANES];
+  uint8_t       *dst[AES_LANES];
+  uint32_t       len[AES_LANES];
+  uint32_t       nof_blocks = 0;
+
+  for (uint32_t p = 0; p < nof_pdus; p++) {
+    security_pdu_t *pdu = &pdus[p];
+    uint8_t iv[16];
+    uint32_t offset = 0;
+    eea2_iv(pdu, iv);
+
+#ifdef SECURITY_AES_X86
+    if (q->impl != SECURITY_AES_IMPL_SOFT) {
+      uint32_t nof_bulk = (pdu->msg_len / (16*AES_LANES)) * AES_LANES;
+      uint32_t done = 0;
+#ifdef SECURITY_AES_VAES
+      if (q->impl == SECURITY_AES_IMPL_VAES) {
+        done = vaes_ctr(q->rk, iv, pdu->msg, pdu->out, nof_bulk);
+        ctr_add(iv, done);
+      }
+#endif
+      if (done < nof_bulk) {
+        aesni_ctr(q->rk, iv, &pdu->msg[16*done], &pdu->out[16*done], nof_bulk - done);
+        ctr_add(iv, nof_bulk - done);
+      }
+      offset = 16*nof_bulk;
+    }
+#endif
+
+    for (; offset < pdu->msg_len; offset += 16) {
+      memcpy(&ctr[16*nof_blocks], iv, 16);
+      ctr_add(iv, 1);
+      src[nof_blocks] = &pdu->msg[offset];
+      dst[nof_blocks] = &pdu->out[offset];
+      len[nof_blocks] = (pdu->msg_len - offset < 16) ? (pdu->msg_len - offset) : 16;
+      nof_blocks++;
+      if (nof_blocks == AES_LANES) {
+        eea2_flush(q, encrypt_blocks, ctr, ks, src, dst, len, nof_blocks);
+        nof_blocks = 0;
+      }
+    }
+  }
+  if (nof_blocks) {
+    eea2_flush(q, encrypt_blocks, ctr, ks, src, dst, len, nof_blocks);
+  }
+}
+
+/* Block b of the CMAC input M = hdr || msg. The last block is padded and
+ * masked with the subkey, RFC 4493 Section 2.4 */
+static void cmac_block(security_aes_t *q, const uint8_t *hdr, uint32_t hdr_len, const uint8_t *msg,
+                       uint32_t msg_len, uint32_t b, uint32_t nof_blocks, uint8_t *blk)
+{
+  uint32_t total = hdr_len + msg_len;
+  uint32_t start = 16*b;
+  uint32_t end   = (start + 16 < total) ? start + 16 : total;
+
+  if (start >= hdr_len && end - start == 16) {
+    memcpy(blk, &msg[start - hdr_len], 16);
+  } else {
+    for (uint32_t i = start; i < end; i++) {
+      blk[i - start] = (i < hdr_len) ? hdr[i] : msg[i - hdr_len];
+    }
+  }
+  if (b == nof_blocks - 1) {
+    const uint8_t *k = q->k1;
+    if (end - start < 16 || total == 0) {
+      blk[end - start] = 0x80;
+      memset(&blk[end - start + 1], 0, 16 - (end - start) - 1);
+      k = q->k2;
+    }
+    for (int i = 0; i < 16; i++) {
+      blk[i] ^= k[i];
+    }
+  }
+}
+
+/* CMAC of every PDU, each one a chain of dependent blocks. Up to AES_LANES
+ * chains of different PDUs advance together. EIA2 prepends COUNT, BEARER and
+ * DIRECTION to the message and keeps 32 bits of the MAC */
+static void cmac_run(security_aes_t *q, security_pdu_t *pdus, uint32_t nof_pdus, bool eia2)
+{
+  encrypt_blocks_fn encrypt_blocks = get_encrypt_blocks(q);
+
+  uint8_t  hdr[AES_LANES][8];
+  uint8_t  x[AES_LANES*16];
+  uint8_t  t[AES_LANES*16];
+  uint32_t pdu_idx[AES_LANES];
+  uint32_t blk_idx[AES_LANES];
+  uint32_t nof_blk[AES_LANES];
+  uint32_t hdr_len = eia2 ? 8 : 0;
+  uint32_t nof_lanes = 0;
+  uint32_t next = 0;
+
+  while (true) {
+    // Start the next PDUs on the free lanes
+    while (nof_lanes < AES_LANES && next < nof_pdus) {
+      uint32_t l = nof_lanes++;
+      security_pdu_t *pdu = &pdus[next];
+      memset(hdr[l], 0, 8);
+      if (eia2) {
+        PUT_U32(hdr[l], pdu->count);
+        hdr[l][4] = (uint8_t) (((pdu->bearer & 0x1f) << 3) | ((pdu->direction & 0x01) << 2));
+      }
+      pdu_idx[l] = next++;
+      blk_idx[l] = 0;
+      nof_blk[l] = (hdr_len + pdu->msg_len) ? (hdr_len + pdu->msg_len + 15)/16 : 1;
+      memset(&t[16*l], 0, 16);
+    }
+    if (nof_lanes == 0) {
+      break;
+    }
+
+    for (uint32_t l = 0; l < nof_lanes; l++) {
+      security_pdu_t *pdu = &pdus[pdu_idx[l]];
+      cmac_block(q, hdr[l], hdr_len, pdu->msg, pdu->msg_len, blk_idx[l], nof_blk[l], &x[16*l]);
+      for (int i = 0; i < 16; i++) {
+        x[16*l+i] ^= t[16*l+i];
+      }
+    }
+    encrypt_blocks(q->rk, x, t, nof_lanes);
+
+    // Finished lanes are replaced by the last one, to keep the active lanes together
+    for (uint32_t l = 0; l < nof_lanes;) {
+      if (++blk_idx[l] == nof_blk[l]) {
+        memcpy(pdus[pdu_idx[l]].out, &t[16*l], eia2 ? 4 : 16);
+        uint32_t last = --nof_lanes;
+        if (l != last) {
+          memcpy(hdr[l], hdr[last], 8);
+          memcpy(&t[16*l], &t[16*last], 16);
+          pdu_idx[l] = pdu_idx[last];
+          blk_idx[l] = blk_idx[last];
+          nof_blk[l] = nof_blk[last];
+        }
+      } else {
+        l++;
+      }
+    }
+  }
+}
+
+void security_aes_cmac(security_aes_t *q, uint8_t *msg, uint32_t msg_len, uint8_t *mac)
+{
+  security_pdu_t pdu;
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.msg     = msg;
+  pdu.msg_len = msg_len;
+  pdu.out     = mac;
+  cmac_run(q, &pdu, 1, false);
+}
+
+void security_aes_eia2(security_aes_t *q, security_pdu_t *pdus, uint32_t nof_pdus)
+{
+  cmac_run(q, pdus, nof_pdus, true);
+}
+
+} // namespace srslte
@@ -0,0 +1,429 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include "srslte/common/security_snow3g.h"
+
+#if defined(__x86_64__)
+#define SECURITY_SNOW3G_CLMUL
+#include <cpuid.h>
+#include <immintrin.h>
+#define CPUID1_ECX_PCLMULQDQ (1 << 1)
+#endif
+
+namespace srslte {
+
+/* Rijndael S-box SR */
+static const uint8_t SR[256] = {
+  0x63,0x7C,0x77,0x7B,0xF2,0x6B,0x6F,0xC5,0x30,0x01,0x67,0x2B,0xFE,0xD7,0xAB,0x76,
+  0xCA,0x82,0xC9,0x7D,0xFA,0x59,0x47,0xF0,0xAD,0xD4,0xA2,0xAF,0x9C,0xA4,0x72,0xC0,
+  0xB7,0xFD,0x93,0x26,0x36,0x3F,0xF7,0xCC,0x34,0xA5,0xE5,0xF1,0x71,0xD8,0x31,0x15,
+  0x04,0xC7,0x23,0xC3,0x18,0x96,0x05,0x9A,0x07,0x12,0x80,0xE2,0xEB,0x27,0xB2,0x75,
+  0x09,0x83,0x2C,0x1A,0x1B,0x6E,0x5A,0xA0,0x52,0x3B,0xD6,0xB3,0x29,0xE3,0x2F,0x84,
+  0x53,0xD1,0x00,0xED,0x20,0xFC,0xB1,0x5B,0x6A,0xCB,0xBE,0x39,0x4A,0x4C,0x58,0xCF,
+  0xD0,0xEF,0xAA,0xFB,0x43,0x4D,0x33,0x85,0x45,0xF9,0x02,0x7F,0x50,0x3C,0x9F,0xA8,
+  0x51,0xA3,0x40,0x8F,0x92,0x9D,0x38,0xF5,0xBC,0xB6,0xDA,0x21,0x10,0xFF,0xF3,0xD2,
+  0xCD,0x0C,0x13,0xEC,0x5F,0x97,0x44,0x17,0xC4,0xA7,0x7E,0x3D,0x64,0x5D,0x19,0x73,
+  0x60,0x81,0x4F,0xDC,0x22,0x2A,0x90,0x88,0x46,0xEE,0xB8,0x14,0xDE,0x5E,0x0B,0xDB,
+  0xE0,0x32,0x3A,0x0A,0x49,0x06,0x24,0x5C,0xC2,0xD3,0xAC,0x62,0x91,0x95,0xE4,0x79,
+  0xE7,0xC8,0x37,0x6D,0x8D,0xD5,0x4E,0xA9,0x6C,0x56,0xF4,0xEA,0x65,0x7A,0xAE,0x08,
+  0xBA,0x78,0x25,0x2E,0x1C,0xA6,0xB4,0xC6,0xE8,0xDD,0x74,0x1F,0x4B,0xBD,0x8B,0x8A,
+  0x70,0x3E,0xB5,0x66,0x48,0x03,0xF6,0x0E,0x61,0x35,0x57,0xB9,0x86,0xC1,0x1D,0x9E,
+  0xE1,0xF8,0x98,0x11,0x69,0xD9,0x8E,0x94,0x9B,0x1E,0x87,0xE9,0xCE,0x55,0x28,0xDF,
+  0x8C,0xA1,0x89,0x0D,0xBF,0xE6,0x42,0x68,0x41,0x99,0x2D,0x0F,0xB0,0x54,0xBB,0x16
+};
+
+/* S-box SQ */
+static const uint8_t SQ[256] = {
+  0x25,0x24,0x73,0x67,0xD7,0xAE,0x5C,0x30,0xA4,0xEE,0x6E,0xCB,0x7D,0xB5,0x82,0xDB,
+  0xE4,0x8E,0x48,0x49,0x4F,0x5D,0x6A,0x78,0x70,0x88,0xE8,0x5F,0x5E,0x84,0x65,0xE2,
+  0xD8,0xE9,0xCC,0xED,0x40,0x2F,0x11,0x28,0x57,0xD2,0xAC,0xE3,0x4A,0x15,0x1B,0xB9,
+  0xB2,0x80,0x85,0xA6,0x2E,0x02,0x47,0x29,0x07,0x4B,0x0E,0xC1,0x51,0xAA,0x89,0xD4,
+  0xCA,0x01,0x46,0xB3,0xEF,0xDD,0x44,0x7B,0xC2,0x7F,0xBE,0xC3,0x9F,0x20,0x4C,0x64,
+  0x83,0xA2,0x68,0x42,0x13,0xB4,0x41,0xCD,0xBA,0xC6,0xBB,0x6D,0x4D,0x71,0x21,0xF4,
+  0x8D,0xB0,0xE5,0x93,0xFE,0x8F,0xE6,0xCF,0x43,0x45,0x31,0x22,0x37,0x36,0x96,0xFA,
+  0xBC,0x0F,0x08,0x52,0x1D,0x55,0x1A,0xC5,0x4E,0x23,0x69,0x7A,0x92,0xFF,0x5B,0x5A,
+  0xEB,0x9A,0x1C,0xA9,0xD1,0x7E,0x0D,0xFC,0x50,0x8A,0xB6,0x62,0xF5,0x0A,0xF8,0xDC,
+  0x03,0x3C,0x0C,0x39,0xF1,0xB8,0xF3,0x3D,0xF2,0xD5,0x97,0x66,0x81,0x32,0xA0,0x00,
+  0x06,0xCE,0xF6,0xEA,0xB7,0x17,0xF7,0x8C,0x79,0xD6,0xA7,0xBF,0x8B,0x3F,0x1F,0x53,
+  0x63,0x75,0x35,0x2C,0x60,0xFD,0x27,0xD3,0x94,0xA5,0x7C,0xA1,0x05,0x58,0x2D,0xBD,
+  0xD9,0xC7,0xAF,0x6B,0x54,0x0B,0xE0,0x38,0x04,0xC8,0x9D,0xE7,0x14,0xB1,0x87,0x9C,
+  0xDF,0x6F,0xF9,0xDA,0x2A,0xC4,0x59,0x16,0x74,0x91,0xAB,0x26,0x61,0x76,0x34,0x2B,
+  0xAD,0x99,0xFB,0x72,0xEC,0x33,0x12,0xDE,0x98,0x3B,0xC0,0x9B,0x3E,0x18,0x10,0x3A,
+  0x56,0xE1,0x77,0xC9,0x1E,0x9E,0x95,0xA3,0x90,0x19,0xA8,0x6C,0x09,0xD0,0xF0,0x86
+};
+
+static uint32_t       mul_alpha[256];
+static uint32_t       div_alpha[256];
+static uint32_t       s1_t[4][256];  // S1 output for each input byte, MSB first
+static uint32_t       s2_t[4][256];
+static bool           has_clmul;
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+
+/******************************************************************************
+ * Tables
+ *****************************************************************************/
+
+static uint8_t mul_x(uint8_t v, uint8_t c)
+{
+  return (uint8_t) ((v & 0x80) ? ((v << 1) ^ c) : (v << 1));
+}
+
+static uint8_t mul_x_pow(uint8_t v, uint32_t i, uint8_t c)
+{
+  while (i--) {
+    v = mul_x(v, c);
+  }
+  return v;
+}
+
+// Columns of the MixColumns-like matrix of S1 and S2, for input bytes w0 to w3
+static void sbox_table(const uint8_t *sbox, uint8_t c, uint32_t t[4][256])
+{
+  for (int i = 0; i < 256; i++) {
+    uint32_t s  = sbox[i];
+    uint32_t s2 = mul_x(sbox[i], c);
+    uint32_t s3 = s2 ^ s;
+    t[0][i] = (s2 << 24) | (s3 << 16) | (s  << 8) | s;
+    t[1][i] = (s  << 24) | (s2 << 16) | (s3 << 8) | s;
+    t[2][i] = (s  << 24) | (s  << 16) | (s2 << 8) | s3;
+    t[3][i] = (s3 << 24) | (s  << 16) | (s  << 8) | s2;
+  }
+}
+
+static void tables_init()
+{
+  for (int i = 0; i < 256; i++) {
+    uint8_t c = (uint8_t) i;
+    mul_alpha[i] = ((uint32_t) mul_x_pow(c, 23,  0xa9) << 24) | ((uint32_t) mul_x_pow(c, 245, 0xa9) << 16) |
+                   ((uint32_t) mul_x_pow(c, 48,  0xa9) << 8)  |  (uint32_t) mul_x_pow(c, 239, 0xa9);
+    div_alpha[i] = ((uint32_t) mul_x_pow(c, 16,  0xa9) << 24) | ((uint32_t) mul_x_pow(c, 39,  0xa9) << 16) |
+                   ((uint32_t) mul_x_pow(c, 6,   0xa9) << 8)  |  (uint32_t) mul_x_pow(c, 64,  0xa9);
+  }
+  sbox_table(SR, 0x1b, s1_t);
+  sbox_table(SQ, 0x69, s2_t);
+
+#ifdef SECURITY_SNOW3G_CLMUL
+  unsigned int eax, ebx, ecx, edx;
+  has_clmul = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & CPUID1_ECX_PCLMULQDQ);
+#endif
+}
+
+/******************************************************************************
+ * Keystream
+ *****************************************************************************/
+
+static inline uint32_t s1(uint32_t w)
+{
+  return s1_t[0][w >> 24] ^ s1_t[1][(w >> 16) & 0xff] ^ s1_t[2][(w >> 8) & 0xff] ^ s1_t[3][w & 0xff];
+}
+
+static inline uint32_t s2(uint32_t w)
+{
+  return s2_t[0][w >> 24] ^ s2_t[1][(w >> 16) & 0xff] ^ s2_t[2][(w >> 8) & 0xff] ^ s2_t[3][w & 0xff];
+}
+
+/* Clock t of a group of 16, where s_j is held in s[(t + j) % 16]. The new
+ * s15 replaces s0, so after 16 clocks every word is back in its place. In
+ * initialization mode the FSM output is fed into the LFSR, otherwise the
+ * keystream word is returned */
+__attribute__((always_inline))
+static inline uint32_t snow3g_clock(uint32_t *s, uint32_t &r1, uint32_t &r2, uint32_t &r3, const int t, const bool init)
+{
+  uint32_t f   = (s[(t + 15) & 15] + r1) ^ r2;
+  uint32_t r   = r2 + (r3 ^ s[(t + 5) & 15]);
+  r3 = s2(r2);
+  r2 = s1(r1);
+  r1 = r;
+
+  uint32_t s0  = s[t & 15];
+  uint32_t s11 = s[(t + 11) & 15];
+  s[t & 15] = (s0 << 8) ^ mul_alpha[s0 >> 24] ^ s[(t + 2) & 15] ^ (s11 >> 8) ^ div_alpha[s11 & 0xff] ^ (init ? f : 0);
+  return f ^ s0;
+}
+
+static void clock16(security_snow3g_t *q, uint32_t *z, const bool init)
+{
+  uint32_t s[16];
+  uint32_t r1 = q->r1, r2 = q->r2, r3 = q->r3;
+  memcpy(s, q->s, sizeof(s));
+  if (init) {
+    for (int t = 0; t < 16; t++) {
+      snow3g_clock(s, r1, r2, r3, t, true);
+    }
+  } else {
+    z[0]  = snow3g_clock(s, r1, r2, r3, 0,  false);
+    z[1]  = snow3g_clock(s, r1, r2, r3, 1,  false);
+    z[2]  = snow3g_clock(s, r1, r2, r3, 2,  false);
+    z[3]  = snow3g_clock(s, r1, r2, r3, 3,  false);
+    z[4]  = snow3g_clock(s, r1, r2, r3, 4,  false);
+    z[5]  = snow3g_clock(s, r1, r2, r3, 5,  false);
+    z[6]  = snow3g_clock(s, r1, r2, r3, 6,  false);
+    z[7]  = snow3g_clock(s, r1, r2, r3, 7,  false);
+    z[8]  = snow3g_clock(s, r1, r2, r3, 8,  false);
+    z[9]  = snow3g_clock(s, r1, r2, r3, 9,  false);
+    z[10] = snow3g_clock(s, r1, r2, r3, 10, false);
+    z[11] = snow3g_clock(s, r1, r2, r3, 11, false);
+    z[12] = snow3g_clock(s, r1, r2, r3, 12, false);
+    z[13] = snow3g_clock(s, r1, r2, r3, 13, false);
+    z[14] = snow3g_clock(s, r1, r2, r3, 14, false);
+    z[15] = snow3g_clock(s, r1, r2, r3, 15, false);
+  }
+  memcpy(q->s, s, sizeof(s));
+  q->r1 = r1;
+  q->r2 = r2;
+  q->r3 = r3;
+}
+
+void security_snow3g_init(security_snow3g_t *q, uint8_t *key, uint32_t iv[4])
+{
+  pthread_once(&tables_once, tables_init);
+
+  uint32_t k[4];
+  for (int i = 0; i < 4; i++) {
+    k[3-i] = ((uint32_t) key[4*i] << 24) | ((uint32_t) key[4*i+1] << 16) |
+             ((uint32_t) key[4*i+2] << 8) | (uint32_t) key[4*i+3];
+  }
+  q->s[15] = k[3] ^ iv[0];
+  q->s[14] = k[2];
+  q->s[13] = k[1];
+  q->s[12] = k[0] ^ iv[1];
+  q->s[11] = k[3] ^ 0xffffffff;
+  q->s[10] = k[2] ^ 0xffffffff ^ iv[2];
+  q->s[9]  = k[1] ^ 0xffffffff ^ iv[3];
+  q->s[8]  = k[0] ^ 0xffffffff;
+  q->s[7]  = k[3];
+  q->s[6]  = k[2];
+  q->s[5]  = k[1];
+  q->s[4]  = k[0];
+  q->s[3]  = k[3] ^ 0xffffffff;
+  q->s[2]  = k[2] ^ 0xffffffff;
+  q->s[1]  = k[1] ^ 0xffffffff;
+  q->s[0]  = k[0] ^ 0xffffffff;
+  q->r1    = 0;
+  q->r2    = 0;
+  q->r3    = 0;
+
+  // 32 clocks in initialization mode
+  clock16(q, NULL, true);
+  clock16(q, NULL, true);
+
+  // The first keystream clock is discarded. It moves the LFSR by one word, done here once
+  snow3g_clock(q->s, q->r1, q->r2, q->r3, 0, false);
+  uint32_t s15 = q->s[0];
+  memmove(q->s, &q->s[1], 15*sizeof(uint32_t));
+  q->s[15] = s15;
+
+  q->nof_z = 0;
+}
+
+void security_snow3g_keystream(security_snow3g_t *q, uint32_t *z, uint32_t n)
+{
+  // Words left from the previous call
+  uint32_t nof_z = (q->nof_z < n) ? q->nof_z : n;
+  memcpy(z, &q->z[16 - q->nof_z], nof_z*sizeof(uint32_t));
+  q->nof_z -= nof_z;
+  z += nof_z;
+  n -= nof_z;
+
+  while (n >= 16) {
+    clock16(q, z, false);
+    z += 16;
+    n -= 16;
+  }
+  if (n) {
+    clock16(q, q->z, false);
+    memcpy(z, q->z, n*sizeof(uint32_t));
+    q->nof_z = 16 - n;
+  }
+}
+
+void security_snow3g_f8(uint8_t  *key,
+                        uint32_t  count,
+                        uint32_t  bearer,
+                        uint32_t  dir,
+                        uint8_t  *msg,
+                        uint32_t  length,
+                        uint8_t  *out)
+{
+  security_snow3g_t q;
+  uint32_t iv[4];
+  uint32_t z[16];
+
+  iv[3] = count;
+  iv[2] = (bearer << 27) | ((dir & 0x1) << 26);
+  iv[1] = iv[3];
+  iv[0] = iv[2];
+  security_snow3g_init(&q, key, iv);
+
+  uint32_t nof_bytes = (length + 7) / 8;
+  for (uint32_t offset = 0; offset < nof_bytes; offset += 64) {
+    uint32_t len = (nof_bytes - offset < 64) ? nof_bytes - offset : 64;
+    clock16(&q, z, false);
+    for (uint32_t i = 0; i < len; i++) {
+      out[offset + i] = msg[offset + i] ^ (uint8_t) (z[i/4] >> (24 - 8*(i%4)));
+    }
+  }
+
+  if (length % 8) {
+    out[length/8] &= (uint8_t) (0xff << (8 - length % 8));
+  }
+}
+
+/******************************************************************************
+ * f9
+ *****************************************************************************/
+
+// Multiplication by x in GF(2^64), modulo x^64 + x^4 + x^3 + x + 1
+static inline uint64_t mul64_x(uint64_t v)
+{
+  return (v << 1) ^ ((v >> 63) ? 0x1b : 0);
+}
+
+// Block i of the message, with the bits beyond length cleared
+static inline uint64_t f9_block(const uint8_t *msg, uint32_t i, uint64_t length)
+{
+  uint64_t m = 0;
+  uint64_t nof_bits = (length - 64*(uint64_t) i < 64) ? length - 64*(uint64_t) i : 64;
+  for (uint32_t j = 0; j < (nof_bits + 7) / 8; j++) {
+    m |= (uint64_t) msg[8*i+j] << (56 - 8*j);
+  }
+  if (nof_bits < 64) {
+    m &= ~((uint64_t) -1 >> nof_bits);
+  }
+  return m;
+}
+
+static uint64_t mul64_soft(uint64_t v, uint64_t p)
+{
+  uint64_t r = 0;
+  for (int i = 0; i < 64; i++) {
+    r ^= ((p >> i) & 1) ? v : 0;
+    v  = mul64_x(v);
+  }
+  return r;
+}
+
+// EVAL = ((((M0 * P) ^ M1) * P ...) ^ LENGTH) * Q, Section 4.4 of the UIA2 specification
+static uint64_t f9_eval_soft(const uint8_t *msg, uint64_t length, uint64_t p, uint64_t q)
+{
+  // P times every nibble value at every nibble position
+  uint64_t p_x[64];
+  uint64_t t[16][16];
+  p_x[0] = p;
+  for (int i = 1; i < 64; i++) {
+    p_x[i] = mul64_x(p_x[i-1]);
+  }
+  for (int j = 0; j < 16; j++) {
+    t[j][0] = 0;
+    for (int n = 1; n < 16; n++) {
+      t[j][n] = t[j][n & (n - 1)] ^ p_x[4*j + __builtin_ctz(n)];
+    }
+  }
+
+  uint64_t eval = 0;
+  uint32_t nof_blocks = (uint32_t) ((length + 63) / 64);
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    uint64_t v = eval ^ f9_block(msg, i, length);
+    eval = 0;
+    for (int j = 0; j < 16; j++) {
+      eval ^= t[j][(v >> (4*j)) & 0xf];
+    }
+  }
+  return mul64_soft(eval ^ length, q);
+}
+
+#ifdef SECURITY_SNOW3G_CLMUL
+
+#define CLMUL_TARGET __attribute__((target("pclmul,sse2")))
+
+CLMUL_TARGET
+static inline uint64_t mul64_clmul(uint64_t v, __m128i p)
+{
+  const __m128i poly = _mm_cvtsi64_si128(0x1b);
+  __m128i  prod = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) v), p, 0x00);
+  uint64_t lo   = (uint64_t) _mm_cvtsi128_si64(prod);
+  // x^64 = x^4 + x^3 + x + 1, applied twice as the first reduction leaves up to 5 bits above x^63
+  __m128i  red  = _mm_clmulepi64_si128(_mm_srli_si128(prod, 8), poly, 0x00);
+  uint64_t hi   = (uint64_t) _mm_cvtsi128_si64(_mm_srli_si128(red, 8));
+  return lo ^ (uint64_t) _mm_cvtsi128_si64(red) ^ (hi << 4) ^ (hi << 3) ^ (hi << 1) ^ hi;
+}
+
+CLMUL_TARGET
+static uint64_t f9_eval_clmul(const uint8_t *msg, uint64_t length, uint64_t p, uint64_t q)
+{
+  __m128i  p128 = _mm_cvtsi64_si128((long long) p);
+  uint64_t eval = 0;
+  uint32_t nof_blocks = (uint32_t) ((length + 63) / 64);
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    eval = mul64_clmul(eval ^ f9_block(msg, i, length), p128);
+  }
+  return mul64_clmul(eval ^ length, _mm_cvtsi64_si128((long long) q));
+}
+
+#endif // SECURITY_SNOW3G_CLMUL
+
+void security_snow3g_f9(uint8_t  *key,
+                        uint32_t  count,
+                        uint32_t  fresh,
+                        uint32_t  dir,
+                        uint8_t  *msg,
+                        uint64_t  length,
+                        uint8_t  *mac)
+{
+  security_snow3g_t q;
+  uint32_t iv[4];
+  uint32_t z[5];
+
+  iv[3] = count;
+  iv[2] = fresh;
+  iv[1] = count ^ (dir << 31);
+  iv[0] = fresh ^ (dir << 15);
+  security_snow3g_init(&q, key, iv);
+  security_snow3g_keystream(&q, z, 5);
+
+  uint64_t p = ((uint64_t) z[0] << 32) | z[1];
+  uint64_t q64 = ((uint64_t) z[2] << 32) | z[3];
+  uint64_t eval;
+
+#ifdef SECURITY_SNOW3G_CLMUL
+  if (has_clmul) {
+    eval = f9_eval_clmul(msg, length, p, q64);
+  } else
+#endif
+  {
+    eval = f9_eval_soft(msg, length, p, q64);
+  }
+
+  uint32_t mac32 = (uint32_t) (eval >> 32) ^ z[4];
+  mac[0] = (uint8_t) (mac32 >> 24);
+  mac[1] = (uint8_t) (mac32 >> 16);
+  mac[2] = (uint8_t) (mac32 >> 8);
+  mac[3] = (uint8_t) mac32;
+}
+
+} // namespace srslte
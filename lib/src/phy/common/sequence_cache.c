@@ -0,0 +1,303 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <strings.h>
+
+#include "srslte/phy/common/sequence_cache.h"
+#include "srslte/phy/common/phy_common.h"
+
+#define NOF_BUCKETS 1024
+
+/* Length of the PUCCH format 2 sequences, see srslte_sequence_pucch() */
+#define PUCCH_SEQ_LEN 20
+
+#define KEY(type, rnti, cw, sf) (((type) << 21) | ((cw) << 20) | ((sf) << 16) | (rnti))
+#define KEY_TYPE(key)           ((key) >> 21)
+#define KEY_CW(key)             (((key) >> 20) & 0x1)
+#define KEY_SF(key)             (((key) >> 16) & 0xf)
+#define KEY_RNTI(key)           ((key) & 0xffff)
+#define HASH(key)               (((key) * 2654435761u) >> 22)
+
+struct srslte_sequence_cache_entry_s {
+  srslte_sequence_t seq; /* Must be the first member, see srslte_sequence_cache_put() */
+  uint32_t key;
+  uint32_t nof_bytes;
+  uint32_t refcnt;
+  bool linked;
+  struct srslte_sequence_cache_entry_s *hash_next;
+  struct srslte_sequence_cache_entry_s *lru_prev;
+  struct srslte_sequence_cache_entry_s *lru_next;
+};
+
+int srslte_sequence_cache_init(srslte_sequence_cache_t *q, uint64_t max_bytes)
+{
+  bzero(q, sizeof(srslte_sequence_cache_t));
+  q->buckets = calloc(NOF_BUCKETS, sizeof(srslte_sequence_cache_entry_t*));
+  if (!q->buckets) {
+    perror("calloc");
+    return SRSLTE_ERROR;
+  }
+  q->max_bytes = max_bytes;
+  pthread_mutex_init(&q->mutex, NULL);
+  return SRSLTE_SUCCESS;
+}
+
+static void entry_free(srslte_sequence_cache_entry_t *e)
+{
+  srslte_sequence_free(&e->seq);
+  free(e);
+}
+
+static srslte_sequence_cache_entry_t *lookup(srslte_sequence_cache_t *q, uint32_t key)
+{
+  srslte_sequence_cache_entry_t *e = q->buckets[HASH(key)];
+  while (e && e->key != key) {
+    e = e->hash_next;
+  }
+  return e;
+}
+
+static void lru_remove(srslte_sequence_cache_t *q, srslte_sequence_cache_entry_t *e)
+{
+  if (e->lru_prev) {
+    e->lru_prev->lru_next = e->lru_next;
+  } else {
+    q->lru_head = e->lru_next;
+  }
+  if (e->lru_next) {
+    e->lru_next->lru_prev = e->lru_prev;
+  } else {
+    q->lru_tail = e->lru_prev;
+  }
+  e->lru_prev = NULL;
+  e->lru_next = NULL;
+}
+
+static void lru_push_head(srslte_sequence_cache_t *q, srslte_sequence_cache_entry_t *e)
+{
+  e->lru_prev = NULL;
+  e->lru_next = q->lru_head;
+  if (q->lru_head) {
+    q->lru_head->lru_prev = e;
+  } else {
+    q->lru_tail = e;
+  }
+  q->lru_head = e;
+}
+
+static void link_entry(srslte_sequence_cache_t *q, srslte_sequence_cache_entry_t *e)
+{
+  uint32_t h = HASH(e->key);
+  e->hash_next = q->buckets[h];
+  q->buckets[h] = e;
+  lru_push_head(q, e);
+  e->linked = true;
+  q->nof_bytes += e->nof_bytes;
+  q->nof_entries++;
+}
+
+/* Removes the entry from the cache. It is freed now if nobody is using it or by the last
+ * call to srslte_sequence_cache_put() otherwise */
+static void unlink_entry(srslte_sequence_cache_t *q, srslte_sequence_cache_entry_t *e)
+{
+  srslte_sequence_cache_entry_t **p = &q->buckets[HASH(e->key)];
+  while (*p != e) {
+    p = &(*p)->hash_next;
+  }
+  *p = e->hash_next;
+  e->hash_next = NULL;
+  lru_remove(q, e);
+  e->linked = false;
+  q->nof_bytes -= e->nof_bytes;
+  q->nof_entries--;
+  if (!e->refcnt) {
+    entry_free(e);
+  }
+}
+
+static void evict(srslte_sequence_cache_t *q)
+{
+  srslte_sequence_cache_entry_t *e = q->lru_tail;
+  while (e && q->nof_bytes > q->max_bytes) {
+    srslte_sequence_cache_entry_t *prev = e->lru_prev;
+    if (!e->refcnt) {
+      unlink_entry(q, e);
+      q->nof_evictions++;
+    }
+    e = prev;
+  }
+}
+
+static void unlink_all(srslte_sequence_cache_t *q)
+{
+  while (q->lru_head) {
+    unlink_entry(q, q->lru_head);
+  }
+}
+
+void srslte_sequence_cache_free(srslte_sequence_cache_t *q)
+{
+  if (q->buckets) {
+    unlink_all(q);
+    free(q->buckets);
+    pthread_mutex_destroy(&q->mutex);
+  }
+  bzero(q, sizeof(srslte_sequence_cache_t));
+}
+
+void srslte_sequence_cache_set_cell(srslte_sequence_cache_t *q, uint32_t cell_id)
+{
+  pthread_mutex_lock(&q->mutex);
+  if (cell_id != q->cell_id) {
+    unlink_all(q);
+    q->cell_id = cell_id;
+  }
+  pthread_mutex_unlock(&q->mutex);
+}
+
+static int generate(srslte_sequence_t *seq, uint32_t key, uint32_t cell_id, uint32_t len)
+{
+  switch (KEY_TYPE(key)) {
+    case SRSLTE_SEQUENCE_CACHE_PDSCH:
+      return srslte_sequence_pdsch(seq, KEY_RNTI(key), KEY_CW(key), 2 * KEY_SF(key), cell_id, len);
+    case SRSLTE_SEQUENCE_CACHE_PUSCH:
+      return srslte_sequence_pusch(seq, KEY_RNTI(key), 2 * KEY_SF(key), cell_id, len);
+    case SRSLTE_SEQUENCE_CACHE_PUCCH:
+      return srslte_sequence_pucch(seq, KEY_RNTI(key), 2 * KEY_SF(key), cell_id);
+    default:
+      return SRSLTE_ERROR;
+  }
+}
+
+/* Returns the scrambling sequence for the given RNTI, subframe and codeword (PDSCH only), with at
+ * least len bits. The sequence is generated outside the lock, so workers asking for different
+ * users do not wait on each other. Returns NULL if the sequence could not be generated; the
+ * caller shall then generate it itself.
+ */
+srslte_sequence_t *srslte_sequence_cache_get(srslte_sequence_cache_t *q,
+                                             srslte_sequence_cache_type_t type,
+                                             uint16_t rnti,
+                                             uint32_t codeword_idx,
+                                             uint32_t sf_idx,
+                                             uint32_t len)
+{
+  if (!q->buckets || codeword_idx > 1 || sf_idx >= SRSLTE_NSUBFRAMES_X_FRAME) {
+    return NULL;
+  }
+  uint32_t key = KEY((uint32_t) type, (uint32_t) rnti, codeword_idx, sf_idx);
+  if (type == SRSLTE_SEQUENCE_CACHE_PUCCH) {
+    len = PUCCH_SEQ_LEN;
+  }
+
+  pthread_mutex_lock(&q->mutex);
+  srslte_sequence_cache_entry_t *e = lookup(q, key);
+  if (e && e->seq.cur_len >= len) {
+    e->refcnt++;
+    lru_remove(q, e);
+    lru_push_head(q, e);
+    q->nof_hits++;
+    pthread_mutex_unlock(&q->mutex);
+    return &e->seq;
+  }
+  q->nof_misses++;
+  uint32_t cell_id = q->cell_id;
+  pthread_mutex_unlock(&q->mutex);
+
+  srslte_sequence_cache_entry_t *new_e = calloc(1, sizeof(srslte_sequence_cache_entry_t));
+  if (!new_e) {
+    perror("calloc");
+    return NULL;
+  }
+  new_e->key = key;
+  if (generate(&new_e->seq, key, cell_id, len)) {
+    entry_free(new_e);
+    return NULL;
+  }
+  new_e->nof_bytes = new_e->seq.max_len * (sizeof(uint8_t) + sizeof(float) + sizeof(short)) +
+                     new_e->seq.max_len / 8 + 8;
+  new_e->refcnt = 1;
+
+  pthread_mutex_lock(&q->mutex);
+  if (cell_id != q->cell_id) {
+    pthread_mutex_unlock(&q->mutex);
+    entry_free(new_e);
+    return NULL;
+  }
+  e = lookup(q, key);
+  if (e && e->seq.cur_len >= len) {
+    // Another worker generated it in the meantime
+    e->refcnt++;
+    pthread_mutex_unlock(&q->mutex);
+    entry_free(new_e);
+    return &e->seq;
+  }
+  if (e) {
+    // Replace the shorter sequence
+    unlink_entry(q, e);
+  }
+  link_entry(q, new_e);
+  evict(q);
+  pthread_mutex_unlock(&q->mutex);
+
+  return &new_e->seq;
+}
+
+/* Releases a sequence returned by srslte_sequence_cache_get() */
+void srslte_sequence_cache_put(srslte_sequence_cache_t *q, srslte_sequence_t *seq)
+{
+  srslte_sequence_cache_entry_t *e = (srslte_sequence_cache_entry_t*) seq;
+
+  pthread_mutex_lock(&q->mutex);
+  if (e->refcnt > 0) {
+    e->refcnt--;
+  }
+  if (!e->refcnt && !e->linked) {
+    entry_free(e);
+  }
+  pthread_mutex_unlock(&q->mutex);
+}
+
+/* Removes all the sequences of this RNTI */
+void srslte_sequence_cache_free_rnti(srslte_sequence_cache_t *q, uint16_t rnti)
+{
+  if (!q->buckets) {
+    return;
+  }
+  pthread_mutex_lock(&q->mutex);
+  for (uint32_t type = 0; type <= SRSLTE_SEQUENCE_CACHE_PUCCH; type++) {
+    for (uint32_t cw = 0; cw < 2; cw++) {
+      for (uint32_t sf = 0; sf < SRSLTE_NSUBFRAMES_X_FRAME; sf++) {
+        srslte_sequence_cache_entry_t *e = lookup(q, KEY(type, (uint32_t) rnti, cw, sf));
+        if (e) {
+          unlink_entry(q, e);
+        }
+      }
+    }
+  }
+  pthread_mutex_unlock(&q->mutex);
+}
@@ -45,21 +45,161 @@
 #define FFTW_TYPE 0
 #endif
 
+/* Plans are shared by all DFT objects in the process. A plan is only created
+ * the first time a problem is seen and is run on the arrays of each object
+ * with the new-array execute functions, which FFTW allows from any thread as
+ * long as the arrays have the alignment and in-place property of the arrays
+ * the plan was created with. Plans are kept until srslte_dft_exit(). */
+#define DFT_MAX_SHARED_PLANS   512
+#define DFT_ALIGNMENT          64
+
+typedef struct {
+  fftwf_plan p;
+  srslte_dft_mode_t mode;
+  int sign;
+  int size;
+  bool is_guru;
+  int istride;
+  int ostride;
+  int how_many;
+  int idist;
+  int odist;
+  bool in_place;
+  int in_align;
+  int out_align;
+} dft_shared_plan_t;
+
+static dft_shared_plan_t dft_plans[DFT_MAX_SHARED_PLANS];
+static uint32_t nof_dft_plans = 0;
+static uint32_t nof_dft_requests = 0;
+
+static char wisdom_file[256] = FFTW_WISDOM_FILE;
+
 pthread_mutex_t fft_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+void srslte_dft_set_wisdom_file(const char *filename) {
+  pthread_mutex_lock(&fft_mutex);
+  if (filename) {
+    strncpy(wisdom_file, filename, sizeof(wisdom_file) - 1);
+    wisdom_file[sizeof(wisdom_file) - 1] = '\0';
+  } else {
+    wisdom_file[0] = '\0';
+  }
+  pthread_mutex_unlock(&fft_mutex);
+}
+
 void srslte_dft_load() {
-#ifdef FFTW_WISDOM_FILE
-  fftwf_import_wisdom_from_filename(FFTW_WISDOM_FILE);
-#else
-  printf("Warning: FFTW Wisdom file not defined\n");
-#endif
+  if (wisdom_file[0]) {
+    fftwf_import_wisdom_from_filename(wisdom_file);
+  } else {
+    printf("Warning: FFTW Wisdom file not defined\n");
+  }
 }
 
 void srslte_dft_exit() {
-#ifdef FFTW_WISDOM_FILE
-  fftwf_export_wisdom_to_filename(FFTW_WISDOM_FILE);
-#endif
+  pthread_mutex_lock(&fft_mutex);
+  if (wisdom_file[0]) {
+    fftwf_export_wisdom_to_filename(wisdom_file);
+  }
+  for (uint32_t i = 0; i < nof_dft_plans; i++) {
+    fftwf_destroy_plan(dft_plans[i].p);
+  }
+  bzero(dft_plans, sizeof(dft_shared_plan_t) * nof_dft_plans);
+  nof_dft_plans = 0;
   fftwf_cleanup();
+  pthread_mutex_unlock(&fft_mutex);
+}
+
+void srslte_dft_get_nof_plans(uint32_t *nof_plans, uint32_t *nof_requests) {
+  pthread_mutex_lock(&fft_mutex);
+  if (nof_plans) {
+    *nof_plans = nof_dft_plans;
+  }
+  if (nof_requests) {
+    *nof_requests = nof_dft_requests;
+  }
+  pthread_mutex_unlock(&fft_mutex);
+}
+
+static int dft_align(const void *ptr) {
+  return (int) (((uintptr_t) ptr) % DFT_ALIGNMENT);
+}
+
+static bool dft_shared_plan_match(dft_shared_plan_t *a, dft_shared_plan_t *b) {
+  return a->mode == b->mode && a->sign == b->sign && a->size == b->size &&
+         a->is_guru == b->is_guru && a->istride == b->istride && a->ostride == b->ostride &&
+         a->how_many == b->how_many && a->idist == b->idist && a->odist == b->odist &&
+         a->in_place == b->in_place && a->in_align == b->in_align && a->out_align == b->out_align;
+}
+
+/* Returns the plan for the problem in key, creating it on the in/out arrays if
+ * it is not in the registry. Sets *shared to false if the registry is full and
+ * the caller owns the plan. Call it with fft_mutex locked. */
+static fftwf_plan dft_shared_plan_get(dft_shared_plan_t *key, void *in, void *out, bool *shared) {
+  key->in_place  = (in == out);
+  key->in_align  = dft_align(in);
+  key->out_align = dft_align(out);
+
+  nof_dft_requests++;
+  for (uint32_t i = 0; i < nof_dft_plans; i++) {
+    if (dft_shared_plan_match(&dft_plans[i], key)) {
+      *shared = true;
+      return dft_plans[i].p;
+    }
+  }
+
+  if (key->is_guru) {
+    const fftwf_iodim iodim = {key->size, key->istride, key->ostride};
+    const fftwf_iodim howmany_dims = {key->how_many, key->idist, key->odist};
+    key->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in, out, key->sign, FFTW_TYPE);
+  } else if (key->mode == SRSLTE_DFT_COMPLEX) {
+    key->p = fftwf_plan_dft_1d(key->size, in, out, key->sign, FFTW_TYPE);
+  } else {
+    key->p = fftwf_plan_r2r_1d(key->size, in, out, (fftwf_r2r_kind) key->sign, FFTW_TYPE);
+  }
+
+  *shared = false;
+  if (key->p && nof_dft_plans < DFT_MAX_SHARED_PLANS) {
+    memcpy(&dft_plans[nof_dft_plans++], key, sizeof(dft_shared_plan_t));
+    *shared = true;
+  }
+  return key->p;
+}
+
+/* Replaces the plan of a DFT object by the shared plan for the problem in key */
+static int dft_set_plan(srslte_dft_plan_t *plan, dft_shared_plan_t *key) {
+  bool shared;
+  pthread_mutex_lock(&fft_mutex);
+  if (plan->p && !plan->is_shared) {
+    fftwf_destroy_plan(plan->p);
+  }
+  plan->p = dft_shared_plan_get(key, plan->in, plan->out, &shared);
+  plan->is_shared = shared;
+  pthread_mutex_unlock(&fft_mutex);
+
+  return plan->p ? 0 : -1;
+}
+
+static void dft_key_1d(dft_shared_plan_t *key, srslte_dft_mode_t mode, srslte_dft_dir_t dir, int size) {
+  bzero(key, sizeof(dft_shared_plan_t));
+  key->mode = mode;
+  if (mode == SRSLTE_DFT_COMPLEX) {
+    key->sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
+  } else {
+    key->sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
+  }
+  key->size = size;
+}
+
+static void dft_key_guru(dft_shared_plan_t *key, srslte_dft_dir_t dir, int size, int istride, int ostride,
+                         int how_many, int idist, int odist) {
+  dft_key_1d(key, SRSLTE_DFT_COMPLEX, dir, size);
+  key->is_guru  = true;
+  key->istride  = istride;
+  key->ostride  = ostride;
+  key->how_many = how_many;
+  key->idist    = idist;
+  key->odist    = odist;
 }
 
 int srslte_dft_plan(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir,
@@ -97,21 +237,12 @@ static void allocate(srslte_dft_plan_t *plan, int size_in, int size_out, int len
 int srslte_dft_replan_guru_c(srslte_dft_plan_t *plan, const int new_dft_points, cf_t *in_buffer,
                              cf_t *out_buffer, int istride, int ostride, int how_many,
                              int idist, int odist) {
-  int sign = (plan->forward) ? FFTW_FORWARD : FFTW_BACKWARD;
-
-  const fftwf_iodim iodim = {new_dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
-
-  pthread_mutex_lock(&fft_mutex);
+  dft_shared_plan_t key;
+  dft_key_guru(&key, plan->dir, new_dft_points, istride, ostride, how_many, idist, odist);
 
-  /* Destroy current plan */
-  fftwf_destroy_plan(plan->p);
-
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
-
-  pthread_mutex_unlock(&fft_mutex);
-
-  if (!plan->p) {
+  plan->in  = in_buffer;
+  plan->out = out_buffer;
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
   plan->size = new_dft_points;
@@ -121,17 +252,10 @@ int srslte_dft_replan_guru_c(srslte_dft_plan_t *plan, const int new_dft_points,
 }
 
 int srslte_dft_replan_c(srslte_dft_plan_t *plan, const int new_dft_points) {
-  int sign = (plan->dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-
-  pthread_mutex_lock(&fft_mutex);
-  if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
-  }
-  plan->p = fftwf_plan_dft_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
+  dft_shared_plan_t key;
+  dft_key_1d(&key, SRSLTE_DFT_COMPLEX, plan->dir, new_dft_points);
 
-  if (!plan->p) {
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
   plan->size = new_dft_points;
@@ -141,18 +265,15 @@ int srslte_dft_replan_c(srslte_dft_plan_t *plan, const int new_dft_points) {
 int srslte_dft_plan_guru_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir, cf_t *in_buffer,
                            cf_t *out_buffer, int istride, int ostride, int how_many,
                            int idist, int odist) {
-  int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-
-  const fftwf_iodim iodim = {dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
+  dft_shared_plan_t key;
+  dft_key_guru(&key, dir, dft_points, istride, ostride, how_many, idist, odist);
 
-  pthread_mutex_lock(&fft_mutex);
-
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
-  if (!plan->p) {
+  plan->p   = NULL;
+  plan->in  = in_buffer;
+  plan->out = out_buffer;
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
-  pthread_mutex_unlock(&fft_mutex);
 
   plan->size = dft_points;
   plan->init_size = plan->size;
@@ -169,16 +290,12 @@ int srslte_dft_plan_guru_c(srslte_dft_plan_t *plan, const int dft_points, srslte
 }
 
 int srslte_dft_plan_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir) {
-  allocate(plan,sizeof(fftwf_complex),sizeof(fftwf_complex), dft_points);
-
-  pthread_mutex_lock(&fft_mutex);
-
-  int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-  plan->p = fftwf_plan_dft_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
+  dft_shared_plan_t key;
+  dft_key_1d(&key, SRSLTE_DFT_COMPLEX, dir, dft_points);
 
-  pthread_mutex_unlock(&fft_mutex);
-
-  if (!plan->p) {
+  allocate(plan,sizeof(fftwf_complex),sizeof(fftwf_complex), dft_points);
+  plan->p = NULL;
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
   plan->size = dft_points;
@@ -196,17 +313,10 @@ int srslte_dft_plan_c(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_
 }
 
 int srslte_dft_replan_r(srslte_dft_plan_t *plan, const int new_dft_points) {
-  int sign = (plan->dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
+  dft_shared_plan_t key;
+  dft_key_1d(&key, SRSLTE_REAL, plan->dir, new_dft_points);
 
-  pthread_mutex_lock(&fft_mutex);
-  if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
-  }
-  plan->p = fftwf_plan_r2r_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
-
-  if (!plan->p) {
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
   plan->size = new_dft_points;
@@ -214,14 +324,12 @@ int srslte_dft_replan_r(srslte_dft_plan_t *plan, const int new_dft_points) {
 }
 
 int srslte_dft_plan_r(srslte_dft_plan_t *plan, const int dft_points, srslte_dft_dir_t dir) {
-  allocate(plan,sizeof(float),sizeof(float), dft_points);
-  int sign = (dir == SRSLTE_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
+  dft_shared_plan_t key;
+  dft_key_1d(&key, SRSLTE_REAL, dir, dft_points);
 
-  pthread_mutex_lock(&fft_mutex);
-  plan->p = fftwf_plan_r2r_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-  pthread_mutex_unlock(&fft_mutex);
-
-  if (!plan->p) {
+  allocate(plan,sizeof(float),sizeof(float), dft_points);
+  plan->p = NULL;
+  if (dft_set_plan(plan, &key)) {
     return -1;
   }
   plan->size = dft_points;
@@ -294,7 +402,7 @@ void srslte_dft_run_c(srslte_dft_plan_t *plan, const cf_t *in, cf_t *out) {
 
   copy_pre((uint8_t*)plan->in, (uint8_t*)in, sizeof(cf_t), plan->size,
            plan->forward, plan->mirror, plan->dc);
-  fftwf_execute(plan->p);
+  fftwf_execute_dft(plan->p, plan->in, plan->out);
   if (plan->norm) {
     norm = 1.0/sqrtf(plan->size);
     srslte_vec_sc_prod_cfc(f_out, norm, f_out, plan->size);    
@@ -310,7 +418,7 @@ void srslte_dft_run_c(srslte_dft_plan_t *plan, const cf_t *in, cf_t *out) {
 
 void srslte_dft_run_guru_c(srslte_dft_plan_t *plan) {
   if (plan->is_guru == true) {
-    fftwf_execute(plan->p);
+    fftwf_execute_dft(plan->p, plan->in, plan->out);
   } else {
     fprintf(stderr, "srslte_dft_run_guru_c: the selected plan is not guru!\n");
   }
@@ -323,7 +431,7 @@ void srslte_dft_run_r(srslte_dft_plan_t *plan, const float *in, float *out) {
   float *f_out = plan->out;
 
   memcpy(plan->in,in,sizeof(float)*plan->size);
-  fftwf_execute(plan->p);
+  fftwf_execute_r2r(plan->p, plan->in, plan->out);
   if (plan->norm) {
     norm = 1.0/plan->size;
     srslte_vec_sc_prod_fff(f_out, norm, f_out, plan->size);    
@@ -345,7 +453,7 @@ void srslte_dft_plan_free(srslte_dft_plan_t *plan) {
     if (plan->in) fftwf_free(plan->in);
     if (plan->out) fftwf_free(plan->out);
   }
-  if (plan->p) fftwf_destroy_plan(plan->p);
+  if (plan->p && !plan->is_shared) fftwf_destroy_plan(plan->p);
   pthread_mutex_unlock(&fft_mutex);
 
   bzero(plan, sizeof(srslte_dft_plan_t));
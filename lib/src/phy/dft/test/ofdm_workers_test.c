@@ -0,0 +1,210 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Initializes the OFDM and transform precoding of several workers, which
+ * share their DFT plans, and runs them concurrently */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+#define MAX_WORKERS 16
+
+int nof_prb = 25;
+int nof_workers = 4;
+int nof_repetitions = 100;
+
+typedef struct {
+  srslte_ofdm_t fft;
+  srslte_ofdm_t ifft;
+  srslte_dft_precoding_t precoding;
+  srslte_dft_precoding_t predecoding;
+  cf_t *input;
+  cf_t *precoded;
+  cf_t *time;
+  cf_t *output;
+  float mse;
+} worker_t;
+
+worker_t workers[MAX_WORKERS];
+
+void usage(char *prog) {
+  printf("Usage: %s\n", prog);
+  printf("\t-n nof_prb [Default %d]\n", nof_prb);
+  printf("\t-w nof_workers [Default %d]\n", nof_workers);
+  printf("\t-r nof_repetitions [Default %d]\n", nof_repetitions);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nwr")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_prb = atoi(argv[optind]);
+      break;
+    case 'w':
+      nof_workers = atoi(argv[optind]);
+      break;
+    case 'r':
+      nof_repetitions = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (nof_workers < 1 || nof_workers > MAX_WORKERS) {
+    usage(argv[0]);
+    exit(-1);
+  }
+}
+
+int worker_init(worker_t *w) {
+  uint32_t nof_re = SRSLTE_SF_LEN_RE(nof_prb, SRSLTE_CP_NORM);
+
+  w->input    = srslte_vec_malloc(sizeof(cf_t) * nof_re);
+  w->precoded = srslte_vec_malloc(sizeof(cf_t) * nof_re);
+  w->output   = srslte_vec_malloc(sizeof(cf_t) * nof_re);
+  w->time     = srslte_vec_malloc(sizeof(cf_t) * SRSLTE_SF_LEN_PRB(nof_prb));
+  if (!w->input || !w->precoded || !w->output || !w->time) {
+    perror("malloc");
+    return -1;
+  }
+  bzero(w->time, sizeof(cf_t) * SRSLTE_SF_LEN_PRB(nof_prb));
+
+  if (srslte_ofdm_tx_init(&w->ifft, SRSLTE_CP_NORM, w->precoded, w->time, nof_prb)) {
+    fprintf(stderr, "Error initializing iFFT\n");
+    return -1;
+  }
+  if (srslte_ofdm_rx_init(&w->fft, SRSLTE_CP_NORM, w->time, w->precoded, nof_prb)) {
+    fprintf(stderr, "Error initializing FFT\n");
+    return -1;
+  }
+  srslte_ofdm_set_normalize(&w->ifft, true);
+  srslte_ofdm_set_normalize(&w->fft, true);
+
+  if (srslte_dft_precoding_init_tx(&w->precoding, nof_prb) ||
+      srslte_dft_precoding_init_rx(&w->predecoding, nof_prb)) {
+    fprintf(stderr, "Error initializing transform precoding\n");
+    return -1;
+  }
+  for (uint32_t i = 0; i < nof_re; i++) {
+    w->input[i] = (float) rand() / RAND_MAX + I * ((float) rand() / RAND_MAX);
+  }
+  return 0;
+}
+
+void worker_free(worker_t *w) {
+  srslte_ofdm_tx_free(&w->ifft);
+  srslte_ofdm_rx_free(&w->fft);
+  srslte_dft_precoding_free(&w->precoding);
+  srslte_dft_precoding_free(&w->predecoding);
+  free(w->input);
+  free(w->precoded);
+  free(w->output);
+  free(w->time);
+}
+
+void *worker_run(void *arg) {
+  worker_t *w = (worker_t*) arg;
+  uint32_t nof_symb = SRSLTE_CP_NSYMB(SRSLTE_CP_NORM) * 2;
+  uint32_t nof_re = nof_prb * SRSLTE_NRE * nof_symb;
+
+  w->mse = 0;
+  for (int r = 0; r < nof_repetitions; r++) {
+    srslte_dft_precoding(&w->precoding, w->input, w->precoded, nof_prb, nof_symb);
+    srslte_ofdm_tx_sf(&w->ifft);
+    srslte_ofdm_rx_sf(&w->fft);
+    srslte_dft_precoding(&w->predecoding, w->precoded, w->output, nof_prb, nof_symb);
+
+    float mse = 0;
+    for (uint32_t i = 0; i < nof_re; i++) {
+      mse += cabsf(w->input[i] - w->output[i]);
+    }
+    mse /= nof_re;
+    if (mse > w->mse) {
+      w->mse = mse;
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  struct timeval t[3];
+  pthread_t threads[MAX_WORKERS];
+  uint32_t nof_plans[MAX_WORKERS], nof_requests;
+  int ret = 0;
+
+  parse_args(argc, argv);
+
+  for (int i = 0; i < nof_workers; i++) {
+    gettimeofday(&t[1], NULL);
+    if (worker_init(&workers[i])) {
+      exit(-1);
+    }
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    srslte_dft_get_nof_plans(&nof_plans[i], &nof_requests);
+    printf("Worker %d: initialized in %ld us, %d DFT plans for %d requests\n",
+           i, t[0].tv_sec * 1000000 + t[0].tv_usec, nof_plans[i], nof_requests);
+  }
+
+  // Every worker after the first one uses the plans of the first one
+  if (nof_plans[nof_workers - 1] != nof_plans[0]) {
+    printf("Workers did not share their DFT plans\n");
+    ret = -1;
+  }
+
+  for (int i = 0; i < nof_workers; i++) {
+    pthread_create(&threads[i], NULL, worker_run, &workers[i]);
+  }
+  for (int i = 0; i < nof_workers; i++) {
+    pthread_join(threads[i], NULL);
+    printf("Worker %d: error=%f\n", i, workers[i].mse);
+    if (workers[i].mse > 1e-3) {
+      ret = -1;
+    }
+  }
+
+  for (int i = 0; i < nof_workers; i++) {
+    worker_free(&workers[i]);
+  }
+  srslte_dft_exit();
+
+  if (ret) {
+    printf("Failed\n");
+  } else {
+    printf("Ok\n");
+  }
+  exit(ret);
+}
@@ -355,6 +355,11 @@ void srslte_enb_dl_rem_rnti(srslte_enb_dl_t *q, uint16_t rnti)
   srslte_pdsch_free_rnti(&q->pdsch, rnti);
 }
 
+void srslte_enb_dl_set_sequence_cache(srslte_enb_dl_t *q, srslte_sequence_cache_t *cache)
+{
+  srslte_pdsch_set_sequence_cache(&q->pdsch, cache);
+}
+
 int srslte_enb_dl_put_pdcch_dl(srslte_enb_dl_t *q, srslte_ra_dl_dci_t *grant, 
                                srslte_dci_format_t format, srslte_dci_location_t location,
                                uint16_t rnti, uint32_t sf_idx) 
@@ -221,10 +221,17 @@ void srslte_enb_ul_rem_rnti(srslte_enb_ul_t *q, uint16_t rnti)
   if (q->users[rnti]) {
     free(q->users[rnti]); 
     q->users[rnti] = NULL; 
+    srslte_pucch_clear_rnti(&q->pucch, rnti);
     srslte_pusch_free_rnti(&q->pusch, rnti);
   }
 }
 
+void srslte_enb_ul_set_sequence_cache(srslte_enb_ul_t *q, srslte_sequence_cache_t *cache)
+{
+  srslte_pucch_set_sequence_cache(&q->pucch, cache);
+  srslte_pusch_set_sequence_cache(&q->pusch, cache);
+}
+
 int srslte_enb_ul_cfg_ue(srslte_enb_ul_t *q, uint16_t rnti, 
                          srslte_uci_cfg_t *uci_cfg, 
                          srslte_pucch_sched_t *pucch_sched,
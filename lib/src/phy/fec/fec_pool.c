@@ -0,0 +1,190 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <strings.h>
+
+#include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/fec/fec_pool.h"
+#include "srslte/phy/utils/vector.h"
+
+int srslte_fec_ctx_init(srslte_fec_ctx_t *ctx)
+{
+  bzero(ctx, sizeof(srslte_fec_ctx_t));
+  if (srslte_crc_init(&ctx->crc_tb, SRSLTE_LTE_CRC24A, 24)) {
+    fprintf(stderr, "Error initiating CRC\n");
+    return SRSLTE_ERROR;
+  }
+  if (srslte_crc_init(&ctx->crc_cb, SRSLTE_LTE_CRC24B, 24)) {
+    fprintf(stderr, "Error initiating CRC\n");
+    return SRSLTE_ERROR;
+  }
+  if (srslte_tdec_init(&ctx->decoder, SRSLTE_TCOD_MAX_LEN_CB)) {
+    fprintf(stderr, "Error initiating Turbo Decoder\n");
+    return SRSLTE_ERROR;
+  }
+  ctx->cb_in = srslte_vec_malloc(sizeof(uint8_t) * (SRSLTE_TCOD_MAX_LEN_CB+8)/8);
+  if (!ctx->cb_in) {
+    srslte_tdec_free(&ctx->decoder);
+    return SRSLTE_ERROR;
+  }
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_fec_ctx_free(srslte_fec_ctx_t *ctx)
+{
+  if (ctx->cb_in) {
+    free(ctx->cb_in);
+    srslte_tdec_free(&ctx->decoder);
+  }
+  bzero(ctx, sizeof(srslte_fec_ctx_t));
+}
+
+static void *fec_pool_thread(void *arg)
+{
+  srslte_fec_ctx_t  *ctx = (srslte_fec_ctx_t*) arg;
+  srslte_fec_pool_t *q   = (srslte_fec_pool_t*) ctx->pool;
+
+  pthread_mutex_lock(&q->mutex);
+  while (q->running) {
+    if (q->count == 0) {
+      pthread_cond_wait(&q->cvar_task, &q->mutex);
+      continue;
+    }
+    srslte_fec_task_t task = q->queue[q->head];
+    q->head = (q->head + 1) % SRSLTE_FEC_POOL_QUEUE_LEN;
+    q->count--;
+    pthread_mutex_unlock(&q->mutex);
+
+    task.fn(task.arg, ctx);
+
+    pthread_mutex_lock(&q->mutex);
+    task.batch->nof_pending--;
+    if (task.batch->nof_pending == 0) {
+      pthread_cond_broadcast(&q->cvar_done);
+    }
+  }
+  pthread_mutex_unlock(&q->mutex);
+  return NULL;
+}
+
+int srslte_fec_pool_init(srslte_fec_pool_t *q, uint32_t nof_workers)
+{
+  if (q == NULL || nof_workers == 0 || nof_workers > SRSLTE_FEC_POOL_MAX_WORKERS) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  bzero(q, sizeof(srslte_fec_pool_t));
+  pthread_mutex_init(&q->mutex, NULL);
+  pthread_cond_init(&q->cvar_task, NULL);
+  pthread_cond_init(&q->cvar_done, NULL);
+  q->running = true;
+
+  for (uint32_t i = 0; i < nof_workers; i++) {
+    if (srslte_fec_ctx_init(&q->ctx[i])) {
+      srslte_fec_pool_free(q);
+      return SRSLTE_ERROR;
+    }
+    q->ctx[i].id   = i;
+    q->ctx[i].pool = q;
+    if (pthread_create(&q->threads[i], NULL, fec_pool_thread, &q->ctx[i])) {
+      perror("pthread_create");
+      srslte_fec_ctx_free(&q->ctx[i]);
+      srslte_fec_pool_free(q);
+      return SRSLTE_ERROR;
+    }
+    q->nof_workers++;
+  }
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_fec_pool_free(srslte_fec_pool_t *q)
+{
+  if (q == NULL || !q->running) {
+    return;
+  }
+
+  pthread_mutex_lock(&q->mutex);
+  q->running = false;
+  pthread_cond_broadcast(&q->cvar_task);
+  pthread_mutex_unlock(&q->mutex);
+
+  for (uint32_t i = 0; i < q->nof_workers; i++) {
+    pthread_join(q->threads[i], NULL);
+    srslte_fec_ctx_free(&q->ctx[i]);
+  }
+
+  pthread_mutex_destroy(&q->mutex);
+  pthread_cond_destroy(&q->cvar_task);
+  pthread_cond_destroy(&q->cvar_done);
+  bzero(q, sizeof(srslte_fec_pool_t));
+}
+
+uint32_t srslte_fec_pool_nof_workers(srslte_fec_pool_t *q)
+{
+  return q ? q->nof_workers : 0;
+}
+
+void srslte_fec_pool_batch_init(srslte_fec_batch_t *batch)
+{
+  batch->nof_pending = 0;
+}
+
+/* Queues a task. Returns SRSLTE_ERROR if the queue is full, in which case the caller is expected
+ * to run the task itself.
+ */
+int srslte_fec_pool_submit(srslte_fec_pool_t *q, srslte_fec_batch_t *batch, srslte_fec_task_fn_t fn, void *arg)
+{
+  int ret = SRSLTE_ERROR;
+
+  pthread_mutex_lock(&q->mutex);
+  if (q->running && q->count < SRSLTE_FEC_POOL_QUEUE_LEN) {
+    srslte_fec_task_t *task = &q->queue[(q->head + q->count) % SRSLTE_FEC_POOL_QUEUE_LEN];
+    task->fn    = fn;
+    task->arg   = arg;
+    task->batch = batch;
+    q->count++;
+    q->nof_tasks++;
+    batch->nof_pending++;
+    pthread_cond_signal(&q->cvar_task);
+    ret = SRSLTE_SUCCESS;
+  } else {
+    q->nof_rejected++;
+  }
+  pthread_mutex_unlock(&q->mutex);
+
+  return ret;
+}
+
+void srslte_fec_pool_wait(srslte_fec_pool_t *q, srslte_fec_batch_t *batch)
+{
+  pthread_mutex_lock(&q->mutex);
+  while (batch->nof_pending > 0) {
+    pthread_cond_wait(&q->cvar_done, &q->mutex);
+  }
+  pthread_mutex_unlock(&q->mutex);
+}
@@ -34,12 +34,14 @@
 #include "srslte/phy/fec/rm_turbo.h"
 #include "srslte/phy/utils/bit.h"
 #include "srslte/phy/utils/vector.h"
+#include "srslte/phy/utils/cpu.h"
 #include "srslte/phy/fec/cbsegm.h"
 
 #ifdef DEBUG_MODE
 #warning FIXME: Disabling SSE/AVX turbo rate matching 
 #undef LV_HAVE_SSE
 #undef LV_HAVE_AVX
+#undef HAVE_SIMD_AVX512
 #endif
 
 #ifdef LV_HAVE_SSE
@@ -52,6 +54,11 @@ int srslte_rm_turbo_rx_lut_sse(int16_t *input, int16_t *output, uint32_t in_len,
 int srslte_rm_turbo_rx_lut_avx(int16_t *input, int16_t *output, uint32_t in_len, uint32_t cb_idx, uint32_t rv_idx);
 #endif
 
+#ifdef HAVE_SIMD_AVX512
+void srslte_rm_turbo_rx_lut_avx512(int16_t *input, int16_t *output, uint16_t *deinter, uint16_t *inverse,
+                                   uint32_t shift, uint32_t in_len, uint32_t out_len);
+#endif
+
 #define NCOLS 32
 #define NROWS_MAX NCOLS
 
@@ -65,6 +72,11 @@ static srslte_bit_interleaver_t bit_interleavers_systematic_bits[192];
 static uint16_t interleaver_parity_bits[192][2*6160];
 static srslte_bit_interleaver_t bit_interleavers_parity_bits[192];
 static uint16_t deinterleaver[192][4][18448];
+#ifdef HAVE_SIMD_AVX512
+// Inverse of the rv 0 deinterleaver. The one of each rv is the same rotated by deinterleaver_shift
+static uint16_t deinterleaver_inverse[192][18448];
+static uint16_t deinterleaver_shift[192][4];
+#endif
 static int k0_vec[SRSLTE_NOF_TC_CB_SIZES][4][2];
 static bool rm_turbo_tables_generated = false; 
 
@@ -247,6 +259,14 @@ void srslte_rm_turbo_gentables() {
       for (int i=0;i<4;i++) {
         srslte_rm_turbo_gentable_receive(deinterleaver[cb_idx][i], in_len, i);  
       }      
+#ifdef HAVE_SIMD_AVX512
+      for (int i=0;i<in_len;i++) {
+        deinterleaver_inverse[cb_idx][deinterleaver[cb_idx][0][i]] = i;
+      }
+      for (int i=0;i<4;i++) {
+        deinterleaver_shift[cb_idx][i] = deinterleaver_inverse[cb_idx][deinterleaver[cb_idx][i][0]];
+      }
+#endif
     }
   }  
 }
@@ -329,26 +349,35 @@ int srslte_rm_turbo_tx_lut(uint8_t *w_buff, uint8_t *systematic, uint8_t *parity
  */
 int srslte_rm_turbo_rx_lut(int16_t *input, int16_t *output, uint32_t in_len, uint32_t cb_idx, uint32_t rv_idx) 
 { 
-  
+  if (rv_idx < 4 && cb_idx < SRSLTE_NOF_TC_CB_SIZES) {
+    uint32_t out_len = 3*srslte_cbsegm_cbsize(cb_idx)+12;
+    uint16_t *deinter = deinterleaver[cb_idx][rv_idx];
+
+    switch (srslte_cpu_select(SRSLTE_CPU_VARIANTS_RM_TURBO)) {
+#ifdef HAVE_SIMD_AVX512
+      case SRSLTE_CPU_AVX512:
+        srslte_rm_turbo_rx_lut_avx512(input, output, deinter, deinterleaver_inverse[cb_idx],
+                                      deinterleaver_shift[cb_idx][rv_idx], in_len, out_len);
+        return 0;
+#endif
 #ifdef LV_HAVE_AVX
-  return srslte_rm_turbo_rx_lut_avx(input, output, in_len, cb_idx, rv_idx);
-#else 
-  #ifdef LV_HAVE_SSE
-    return srslte_rm_turbo_rx_lut_sse(input, output, in_len, cb_idx, rv_idx);
-  #else
-    if (rv_idx < 4 && cb_idx < SRSLTE_NOF_TC_CB_SIZES) {
-      uint32_t out_len = 3*srslte_cbsegm_cbsize(cb_idx)+12;
-      uint16_t *deinter = deinterleaver[cb_idx][rv_idx];
-      for (int i=0;i<in_len;i++) {        
-        output[deinter[i%out_len]] += input[i];
-      }
-      return 0;    
-    } else {
-      printf("Invalid inputs rv_idx=%d, cb_idx=%d\n", rv_idx, cb_idx);
-      return SRSLTE_ERROR_INVALID_INPUTS; 
-    }
-  #endif
+      case SRSLTE_CPU_AVX:
+        return srslte_rm_turbo_rx_lut_avx(input, output, in_len, cb_idx, rv_idx);
+#endif
+#ifdef LV_HAVE_SSE
+      case SRSLTE_CPU_SSE:
+        return srslte_rm_turbo_rx_lut_sse(input, output, in_len, cb_idx, rv_idx);
 #endif
+      default:
+        for (int i=0;i<in_len;i++) {
+          output[deinter[i%out_len]] += input[i];
+        }
+        return 0;
+    }
+  } else {
+    printf("Invalid inputs rv_idx=%d, cb_idx=%d\n", rv_idx, cb_idx);
+    return SRSLTE_ERROR_INVALID_INPUTS; 
+  }
 }
 
 #ifdef LV_HAVE_SSE
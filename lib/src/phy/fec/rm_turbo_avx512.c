@@ -0,0 +1,75 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdint.h>
+
+#ifdef LV_HAVE_AVX512
+
+#include <immintrin.h>
+
+/* Undoes rate matching pulling the inputs of 16 outputs at a time instead of scattering each input.
+ * The input at position i (modulo out_len) goes to output deinter[i]. The deinterleavers of all
+ * rv are rotations of the one of rv 0, so the first input of output j is inverse[j]-shift, where inverse
+ * is the inverse permutation of the rv 0 deinterleaver. Inputs that wrap around the circular buffer
+ * are out_len positions apart. inverse must be readable up to out_len rounded up to 16.
+ */
+void srslte_rm_turbo_rx_lut_avx512(int16_t *input, int16_t *output, uint16_t *deinter, uint16_t *inverse,
+                                   uint32_t shift, uint32_t in_len, uint32_t out_len)
+{
+  __m512i zero   = _mm512_setzero_si512();
+  __m512i vshift = _mm512_set1_epi32(shift);
+  __m512i vlen   = _mm512_set1_epi32(out_len);
+
+  /* The 32-bit gathers read 2 inputs, so the last input is added apart */
+  __m512i last   = _mm512_set1_epi32(in_len - 1);
+
+  for (uint32_t j = 0; j < out_len; j += 16) {
+    __mmask16 valid = (out_len - j >= 16) ? 0xffff : (__mmask16) ((1 << (out_len - j)) - 1);
+
+    __m512i pos = _mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*) &inverse[j]));
+    pos = _mm512_sub_epi32(pos, vshift);
+    pos = _mm512_mask_add_epi32(pos, _mm512_cmplt_epi32_mask(pos, zero), pos, vlen);
+
+    /* The upper half of each gathered value belongs to the next input and is dropped when narrowing */
+    __m512i acc = zero;
+    __mmask16 m = valid & _mm512_cmplt_epi32_mask(pos, last);
+    while (m) {
+      acc = _mm512_add_epi32(acc, _mm512_mask_i32gather_epi32(zero, m, pos, input, 2));
+      pos = _mm512_add_epi32(pos, vlen);
+      m &= _mm512_cmplt_epi32_mask(pos, last);
+    }
+
+    __m512i out = _mm512_maskz_loadu_epi16((__mmask32) valid, &output[j]);
+    out = _mm512_add_epi16(out, _mm512_castsi256_si512(_mm512_cvtepi32_epi16(acc)));
+    _mm512_mask_storeu_epi16(&output[j], (__mmask32) valid, out);
+  }
+
+  if (in_len > 0) {
+    output[deinter[(in_len - 1)%out_len]] += input[in_len - 1];
+  }
+}
+
+#endif
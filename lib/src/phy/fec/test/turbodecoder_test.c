@@ -46,11 +46,19 @@ uint32_t seed = 0;
 int K = -1;
 
 #define MAX_ITERATIONS  10
-int nof_cb = 1; 
+int nof_cb = 0; 
 int nof_iterations = MAX_ITERATIONS;
 int test_known_data = 0;
 int test_errors = 0;
 int nof_repetitions = 1; 
+srslte_tdec_impl_t tdec_impl = SRSLTE_TDEC_AUTO;
+int test_all_impl = 0;
+
+/* With -t or -d all, the decoders must give the BER of the SSE one on the
+ * same frames within these relative tolerances. The windowed AVX-512
+ * decoder loses some accuracy at the window edges. */
+#define BER_TOLERANCE         0.01
+#define BER_TOLERANCE_WINDOW  0.15
 
 #define SNR_POINTS      4
 #define SNR_MIN         1.0
@@ -60,23 +68,40 @@ void usage(char *prog) {
   printf("Usage: %s [nlesv]\n", prog);
   printf(
       "\t-k Test with known data (ignores frame_length) [Default disabled]\n");
-  printf("\t-c nof_cb in parallel [Default %d]\n", nof_cb);
+  printf("\t-c nof_cb in parallel, up to the decoder parallelism [Default decoder parallelism]\n");
+  printf("\t-d decoder implementation: auto, sse, avx2, avx512, avx512win or all [Default %s]\n",
+         srslte_tdec_impl_string(tdec_impl));
   printf("\t-i nof_iterations [Default %d]\n", nof_iterations);
   printf("\t-n nof_frames [Default %d]\n", nof_frames);
   printf("\t-N nof_repetitions [Default %d]\n", nof_repetitions);
   printf("\t-l frame_length [Default %d]\n", frame_length);
   printf("\t-e ebno in dB [Default scan]\n");
-  printf("\t-t test: check errors on exit [Default disabled]\n");
+  printf("\t-t test: check errors against the SSE decoder on exit [Default disabled]\n");
   printf("\t-s seed [Default 0=time]\n");
 }
 
 void parse_args(int argc, char **argv) {
   int opt;
-  while ((opt = getopt(argc, argv, "cinNlstvekt")) != -1) {
+  while ((opt = getopt(argc, argv, "cdinNlstvekt")) != -1) {
     switch (opt) {
     case 'c':
       nof_cb = atoi(argv[optind]);
       break;
+    case 'd':
+      if (!strcmp(argv[optind], "all")) {
+        test_all_impl = 1;
+      } else {
+        for (tdec_impl = 0; tdec_impl < SRSLTE_TDEC_NOF_IMPL; tdec_impl++) {
+          if (!strcmp(argv[optind], srslte_tdec_impl_string(tdec_impl))) {
+            break;
+          }
+        }
+        if (tdec_impl == SRSLTE_TDEC_NOF_IMPL) {
+          usage(argv[0]);
+          exit(-1);
+        }
+      }
+      break;
     case 'n':
       nof_frames = atoi(argv[optind]);
       break;
@@ -125,7 +150,14 @@ int main(int argc, char **argv) {
   uint32_t coded_length;
   struct timeval tdata[3];
   float mean_usec;
+  double total_usec;
   srslte_tdec_t tdec;
+  srslte_tdec_impl_t impl, impls[SRSLTE_TDEC_NOF_IMPL];
+  uint32_t nof_impls, n;
+  float impl_ber[SRSLTE_TDEC_NOF_IMPL];
+  float impl_mbps[SRSLTE_TDEC_NOF_IMPL];
+  bool impl_run[SRSLTE_TDEC_NOF_IMPL];
+  int nof_cb_impl;
   srslte_tcod_t tcod;
   
   parse_args(argc, argv);
@@ -133,7 +165,6 @@ int main(int argc, char **argv) {
   if (!seed) {
     seed = time(NULL);
   }
-  srand(seed);
 
   if (test_known_data) {
     frame_length = KNOWN_DATA_LEN;
@@ -193,11 +224,6 @@ int main(int argc, char **argv) {
     exit(-1);
   }
 
-  if (srslte_tdec_init(&tdec, frame_length)) {
-    fprintf(stderr, "Error initiating Turbo decoder\n");
-    exit(-1);
-  }
-
   float ebno_inc, esno_db;
   ebno_inc = (SNR_MAX - SNR_MIN) / SNR_POINTS;
   if (ebno_db == 100.0) {
@@ -212,92 +238,164 @@ int main(int argc, char **argv) {
     var[0] = sqrt(1 / (pow(10, esno_db / 10)));
     snr_points = 1;
   }
-  for (i = 0; i < snr_points; i++) {
-
-    mean_usec = 0;
-    errors = 0; 
-    frame_cnt = 0;
-    while (frame_cnt < nof_frames) {
-      /* generate data_tx */
-      for (j = 0; j < frame_length; j++) {
+
+  nof_impls = 0;
+  if (test_all_impl) {
+    for (impl = SRSLTE_TDEC_GENERIC; impl < SRSLTE_TDEC_NOF_IMPL; impl++) {
+      impls[nof_impls++] = impl;
+    }
+  } else {
+    if (test_errors && tdec_impl != SRSLTE_TDEC_SSE) {
+      impls[nof_impls++] = SRSLTE_TDEC_SSE;
+    }
+    impls[nof_impls++] = tdec_impl;
+  }
+  bzero(impl_run, sizeof(impl_run));
+
+  for (n = 0; n < nof_impls; n++) {
+
+    if (srslte_tdec_init_manual(&tdec, frame_length, impls[n])) {
+      fprintf(stderr, "Error initiating Turbo decoder\n");
+      exit(-1);
+    }
+
+    /* Implementations not supported by the CPU fall back to a lower one,
+     * which is run only once */
+    impl = srslte_tdec_get_impl(&tdec);
+    if (impl_run[impl]) {
+      srslte_tdec_free(&tdec);
+      continue;
+    }
+
+    /* All implementations decode the same frames */
+    srand(seed);
+
+    nof_cb_impl = srslte_tdec_get_nof_parallel(&tdec);
+    if (nof_cb && nof_cb < nof_cb_impl) {
+      nof_cb_impl = nof_cb;
+    }
+    printf("  Decoder: %s, %d CB in parallel\n", srslte_tdec_impl_string(impl), nof_cb_impl);
+
+    for (i = 0; i < snr_points; i++) {
+
+      mean_usec = 0;
+      total_usec = 0;
+      errors = 0; 
+      frame_cnt = 0;
+      while (frame_cnt < nof_frames) {
+        /* generate data_tx */
+        for (j = 0; j < frame_length; j++) {
+          if (test_known_data) {
+            data_tx[j] = known_data[j];
+          } else {
+            data_tx[j] = rand() % 2;
+          }
+        }
+
+        /* coded BER */
         if (test_known_data) {
-          data_tx[j] = known_data[j];
+          for (j = 0; j < coded_length; j++) {
+            symbols[j] = known_data_encoded[j];
+          }
         } else {
-          data_tx[j] = rand() % 2;
+          srslte_tcod_encode(&tcod, data_tx, symbols, frame_length);
         }
-      }
 
-      /* coded BER */
-      if (test_known_data) {
         for (j = 0; j < coded_length; j++) {
-          symbols[j] = known_data_encoded[j];
+          llr[j] = symbols[j] ? 1 : -1;
         }
-      } else {
-        srslte_tcod_encode(&tcod, data_tx, symbols, frame_length);
-      }
+        srslte_ch_awgn_f(llr, llr, var[i], coded_length);
 
-      for (j = 0; j < coded_length; j++) {
-        llr[j] = symbols[j] ? 1 : -1;
-      }
-      srslte_ch_awgn_f(llr, llr, var[i], coded_length);
-
-      for (j=0;j<coded_length;j++) {
-        llr_s[j] = (int16_t) (100*llr[j]);
-      }
-      /* decoder */
-      srslte_tdec_reset(&tdec, frame_length);
+        for (j=0;j<coded_length;j++) {
+          llr_s[j] = (int16_t) (100*llr[j]);
+        }
+        /* decoder */
+        srslte_tdec_reset(&tdec, frame_length);
 
-      uint32_t t;
-      if (nof_iterations == -1) {
-        t = MAX_ITERATIONS;
-      } else {
-        t = nof_iterations;
-      }
+        uint32_t t;
+        if (nof_iterations == -1) {
+          t = MAX_ITERATIONS;
+        } else {
+          t = nof_iterations;
+        }
 
-      int16_t *input[SRSLTE_TDEC_MAX_NPAR];
-      uint8_t *output[SRSLTE_TDEC_MAX_NPAR];
+        int16_t *input[SRSLTE_TDEC_MAX_NPAR];
+        uint8_t *output[SRSLTE_TDEC_MAX_NPAR];
       
-      for (int n=0;n<SRSLTE_TDEC_MAX_NPAR;n++) {
-        if (n < nof_cb) {
-          input[n] = llr_s;         
-        } else {
-          input[n] = NULL; 
+        for (int n=0;n<SRSLTE_TDEC_MAX_NPAR;n++) {
+          if (n < nof_cb_impl) {
+            input[n] = llr_s;         
+          } else {
+            input[n] = NULL; 
+          }
+          output[n] = data_rx_bytes[n];           
         }
-        output[n] = data_rx_bytes[n];           
-      }
 
-      gettimeofday(&tdata[1], NULL); 
-      for (int k=0;k<nof_repetitions;k++) { 
-        srslte_tdec_run_all_par(&tdec, input, output, t, frame_length);        
-      }
-      gettimeofday(&tdata[2], NULL);
-      get_time_interval(tdata);
-      mean_usec = (float) mean_usec * 0.9 + (float) (tdata[0].tv_usec/nof_repetitions) * 0.1;
+        gettimeofday(&tdata[1], NULL); 
+        for (int k=0;k<nof_repetitions;k++) { 
+          srslte_tdec_run_all_par(&tdec, input, output, t, frame_length);        
+        }
+        gettimeofday(&tdata[2], NULL);
+        get_time_interval(tdata);
+        mean_usec = (float) mean_usec * 0.9 + (float) (tdata[0].tv_usec/nof_repetitions) * 0.1;
+        total_usec += 1e6 * tdata[0].tv_sec + tdata[0].tv_usec;
       
-      frame_cnt++;
-      uint32_t errors_this = 0; 
-      for (int cb=0;cb<nof_cb;cb++) {
-        srslte_bit_unpack_vector(data_rx_bytes[cb], data_rx, frame_length);
+        frame_cnt++;
+        uint32_t errors_this = 0; 
+        for (int cb=0;cb<nof_cb_impl;cb++) {
+          srslte_bit_unpack_vector(data_rx_bytes[cb], data_rx, frame_length);
         
-        errors_this=srslte_bit_diff(data_tx, data_rx, frame_length);
-        //printf("error[%d]=%d\n", cb, errors_this);
-        errors += errors_this;
-      }
-      printf("Eb/No: %2.2f %10d/%d   ", SNR_MIN + i * ebno_inc, frame_cnt, nof_frames);
-      printf("BER: %.2e  ", (float) errors / (nof_cb*frame_cnt * frame_length));
-      printf("%3.1f Mbps (%6.2f usec)", (float) (nof_cb*frame_length) / mean_usec, mean_usec);
-      printf("\r");        
+          errors_this=srslte_bit_diff(data_tx, data_rx, frame_length);
+          //printf("error[%d]=%d\n", cb, errors_this);
+          errors += errors_this;
+        }
+        printf("Eb/No: %2.2f %10d/%d   ", SNR_MIN + i * ebno_inc, frame_cnt, nof_frames);
+        printf("BER: %.2e  ", (float) errors / (nof_cb_impl*frame_cnt * frame_length));
+        printf("%3.1f Mbps (%6.2f usec)", (float) (nof_cb_impl*frame_length) / mean_usec, mean_usec);
+        printf("\r");        
+
+      }    
+      printf("\n");
+    }
 
-    }    
     printf("\n");
+    if (snr_points == 1) {
+      if (errors) {
+        printf("%d Errors\n", errors/nof_cb_impl);
+      }
+    }    
+
+    /* Last SNR point, the test runs in a single thread */
+    impl_run[impl]  = true;
+    impl_ber[impl]  = (float) errors / (nof_cb_impl*nof_frames*frame_length);
+    impl_mbps[impl] = (float) ((double) nof_cb_impl*frame_length*nof_frames*nof_repetitions / total_usec);
+
+    srslte_tdec_free(&tdec);
   }
 
-  printf("\n");
-  if (snr_points == 1) {
-    if (errors) {
-      printf("%d Errors\n", errors/nof_cb);
+  if (test_all_impl || test_errors) {
+    printf("\n  %-10s %10s %12s\n", "Decoder", "BER", "Mbps/core");
+    for (impl = 0; impl < SRSLTE_TDEC_NOF_IMPL; impl++) {
+      if (impl_run[impl]) {
+        printf("  %-10s %10.2e %12.1f\n", srslte_tdec_impl_string(impl), impl_ber[impl], impl_mbps[impl]);
+      }
     }
-  }    
+  }
+
+  int ret = 0;
+  if ((test_all_impl || test_errors) && impl_run[SRSLTE_TDEC_SSE]) {
+    float ber_sse = impl_ber[SRSLTE_TDEC_SSE];
+    /* One bit error of margin on top of the relative tolerance */
+    float ber_min = 1.0 / ((float) nof_frames * frame_length);
+    for (impl = 0; impl < SRSLTE_TDEC_NOF_IMPL; impl++) {
+      float tolerance = (impl == SRSLTE_TDEC_AVX512_WINDOW) ? BER_TOLERANCE_WINDOW : BER_TOLERANCE;
+      if (impl_run[impl] && fabsf(impl_ber[impl] - ber_sse) > tolerance * ber_sse + ber_min) {
+        printf("Error: %s BER %.2e differs from sse BER %.2e by more than %.0f%%\n",
+               srslte_tdec_impl_string(impl), impl_ber[impl], ber_sse, 100 * tolerance);
+        ret = -1;
+      }
+    }
+  }
 
 
   free(data_tx);
@@ -306,10 +404,13 @@ int main(int argc, char **argv) {
   free(llr_c);
   free(data_rx);
 
-  srslte_tdec_free(&tdec);
   srslte_tcod_free(&tcod);
 
   printf("\n");
-  printf("Done\n");
-  exit(0);
+  if (ret) {
+    printf("Failed\n");
+  } else {
+    printf("Done\n");
+  }
+  exit(ret);
 }
@@ -36,12 +36,6 @@
 
 #include "viterbi_test.h"
 
-#define VITERBI_16
-
-#ifndef LV_HAVE_AVX2
-#undef VITERBI_16
-#endif
-
 int frame_length = 1000, nof_frames = 256;
 float ebno_db = 100.0;
 uint32_t seed = 0;
@@ -226,11 +220,11 @@ int main(int argc, char **argv) {
   
       
       for (int i=0;i<M;i++) {
-#ifdef VITERBI_16
-        srslte_viterbi_decode_us(&dec, llr_s, data_rx, frame_length);
-#else
-        srslte_viterbi_decode_uc(&dec, llr_c, data_rx, frame_length);
-#endif
+        if (dec.decode_s) {
+          srslte_viterbi_decode_us(&dec, llr_s, data_rx, frame_length);
+        } else {
+          srslte_viterbi_decode_uc(&dec, llr_c, data_rx, frame_length);
+        }
       }
             
 #ifdef TEST_SSE
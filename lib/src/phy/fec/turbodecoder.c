@@ -41,9 +41,15 @@
 #include "srslte/phy/utils/vector.h"
 
 
+static const char *tdec_impl_text[SRSLTE_TDEC_NOF_IMPL] = {"auto", "generic", "sse", "avx2", "avx512", "avx512win"};
+
 int srslte_tdec_init(srslte_tdec_t * h, uint32_t max_long_cb) {
+  return srslte_tdec_init_manual(h, max_long_cb, SRSLTE_TDEC_AUTO);
+}
+
+int srslte_tdec_init_manual(srslte_tdec_t * h, uint32_t max_long_cb, srslte_tdec_impl_t impl) {
 #ifdef LV_HAVE_SSE
-  return srslte_tdec_simd_init(&h->tdec_simd, SRSLTE_TDEC_MAX_NPAR, max_long_cb);
+  return srslte_tdec_simd_init_manual(&h->tdec_simd, SRSLTE_TDEC_MAX_NPAR, max_long_cb, impl);
 #else
   h->input_conv = srslte_vec_malloc(sizeof(float) * (3*max_long_cb+12));
   if (!h->input_conv) {
@@ -101,7 +107,7 @@ void srslte_tdec_iteration_par(srslte_tdec_t * h, int16_t* input[SRSLTE_TDEC_MAX
 }
 
 void srslte_tdec_iteration(srslte_tdec_t * h, int16_t* input, uint32_t long_cb) {
-  int16_t *input_par[SRSLTE_TDEC_MAX_NPAR];
+  int16_t *input_par[SRSLTE_TDEC_MAX_NPAR] = {NULL};
   input_par[0] = input; 
   return srslte_tdec_iteration_par(h, input_par, long_cb);
 }
@@ -115,15 +121,27 @@ void srslte_tdec_decision_par(srslte_tdec_t * h, uint8_t *output[SRSLTE_TDEC_MAX
 }
 
 uint32_t srslte_tdec_get_nof_parallel(srslte_tdec_t *h) {
-#ifdef LV_HAVE_AVX2
-  return 2;
+#ifdef LV_HAVE_SSE
+  return h->tdec_simd.nof_par_cb;
 #else
   return 1;
 #endif
 }
 
+srslte_tdec_impl_t srslte_tdec_get_impl(srslte_tdec_t *h) {
+#ifdef LV_HAVE_SSE
+  return h->tdec_simd.impl;
+#else
+  return SRSLTE_TDEC_GENERIC;
+#endif
+}
+
+const char *srslte_tdec_impl_string(srslte_tdec_impl_t impl) {
+  return impl < SRSLTE_TDEC_NOF_IMPL ? tdec_impl_text[impl] : "unknown";
+}
+
 void srslte_tdec_decision(srslte_tdec_t * h, uint8_t *output, uint32_t long_cb) {
-  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR];
+  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR] = {NULL};
   output_par[0] = output; 
   srslte_tdec_decision_par(h, output_par, long_cb);
 }
@@ -145,7 +163,7 @@ void srslte_tdec_decision_byte_par_cb(srslte_tdec_t * h, uint8_t *output, uint32
 }
 
 void srslte_tdec_decision_byte(srslte_tdec_t * h, uint8_t *output, uint32_t long_cb) {
-  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR];
+  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR] = {NULL};
   output_par[0] = output; 
   srslte_tdec_decision_byte_par(h, output_par, long_cb);
 }
@@ -163,9 +181,9 @@ int srslte_tdec_run_all_par(srslte_tdec_t * h, int16_t * input[SRSLTE_TDEC_MAX_N
 
 int srslte_tdec_run_all(srslte_tdec_t * h, int16_t * input, uint8_t *output, uint32_t nof_iterations, uint32_t long_cb)
 {
-  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR];
+  uint8_t *output_par[SRSLTE_TDEC_MAX_NPAR] = {NULL};
   output_par[0] = output;   
-  int16_t *input_par[SRSLTE_TDEC_MAX_NPAR];
+  int16_t *input_par[SRSLTE_TDEC_MAX_NPAR] = {NULL};
   input_par[0] = input; 
  
   return srslte_tdec_run_all_par(h, input_par, output_par, nof_iterations, long_cb);
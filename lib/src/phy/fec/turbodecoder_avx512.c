@@ -0,0 +1,368 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+#include "srslte/phy/fec/turbodecoder_simd.h"
+#include "srslte/phy/utils/vector.h"
+
+#include <inttypes.h>
+
+#define NUMSTATES       8
+#define NINPUTS         2
+#define TAIL            3
+#define TOTALTAIL       12
+
+#define INF 10000
+#define ZERO 0
+
+
+#ifdef LV_HAVE_AVX512
+
+#include <immintrin.h>
+
+/* Each 128-bit lane holds the 8 states of a CB decoded in parallel, or of a window of a single CB.
+ * The shuffles work within each lane, so the constants are the ones of the SSE decoder in all 4 lanes. */
+#define NCB 4
+
+/* Branch metrics are stored in blocks of 4 steps (g0, g1 of each step) of one lane. The blocks of the
+ * 4 lanes are interleaved so that one load gets the next 4 steps of every lane */
+#define BRANCH_IDX(t, lane) ((((t)/4)*NCB + (lane))*8 + ((t)%4)*2)
+
+/* Once a block of branch metrics has been used by the beta recursion, it is overwritten with the LLR
+ * of its 4 steps in each lane */
+#define LLR_IDX(t, lane) (((t)/4)*NCB*8 + (lane)*4 + (t)%4)
+
+static inline __m512i set_lanes(__m128i x)
+{
+  return _mm512_maskz_broadcast_i32x4(0xffff, x);
+}
+
+/* Computes branch metrics (gamma) of nof_steps steps of one lane, starting at step start of the CB */
+static void map_avx512_gamma(map_gen_t * s, int16_t *input, int16_t *app, int16_t *parity, uint32_t lane,
+                             uint32_t start, uint32_t nof_steps, uint32_t long_cb)
+{
+  __m128i in, pa, g0, g1, res0, res1;
+
+  __m128i res00_mask = _mm_set_epi8(0xff,0xff,7,6,0xff,0xff,5,4,0xff,0xff,3,2,0xff,0xff,1,0);
+  __m128i res10_mask = _mm_set_epi8(0xff,0xff,15,14,0xff,0xff,13,12,0xff,0xff,11,10,0xff,0xff,9,8);
+  __m128i res01_mask = _mm_set_epi8(7,6,0xff,0xff,5,4,0xff,0xff,3,2,0xff,0xff,1,0,0xff,0xff);
+  __m128i res11_mask = _mm_set_epi8(15,14,0xff,0xff,13,12,0xff,0xff,11,10,0xff,0xff,9,8,0xff,0xff);
+
+  uint32_t nof_data = SRSLTE_MIN(nof_steps, long_cb - start);
+  uint32_t t = 0;
+
+  for (; t + 8 <= nof_data; t += 8) {
+    in = _mm_loadu_si128((__m128i*) &input[start + t]);
+    pa = _mm_loadu_si128((__m128i*) &parity[start + t]);
+    if (app) {
+      in = _mm_add_epi16(in, _mm_loadu_si128((__m128i*) &app[start + t]));
+    }
+
+    g0 = _mm_srai_epi16(_mm_sub_epi16(in, pa), 1);
+    g1 = _mm_srai_epi16(_mm_add_epi16(in, pa), 1);
+
+    res0 = _mm_or_si128(_mm_shuffle_epi8(g0, res00_mask), _mm_shuffle_epi8(g1, res01_mask));
+    res1 = _mm_or_si128(_mm_shuffle_epi8(g0, res10_mask), _mm_shuffle_epi8(g1, res11_mask));
+
+    _mm_store_si128((__m128i*) &s->branch[BRANCH_IDX(t, lane)], res0);
+    _mm_store_si128((__m128i*) &s->branch[BRANCH_IDX(t + 4, lane)], res1);
+  }
+
+  // Steps left over and the tail, which has no a priori information
+  for (; t < nof_steps; t++) {
+    uint32_t k = start + t;
+    int16_t *g = &s->branch[BRANCH_IDX(t, lane)];
+    if (k < long_cb) {
+      int16_t x = app ? input[k] + app[k] : input[k];
+      g[0] = (int16_t) (x - parity[k]) >> 1;
+      g[1] = (int16_t) (x + parity[k]) >> 1;
+    } else {
+      g[0] = (input[k] - parity[k]) / 2;
+      g[1] = (input[k] + parity[k]) / 2;
+    }
+  }
+}
+
+/* Computes alpha metrics of nof_steps steps, a multiple of 8, from alpha_k */
+static void map_avx512_alpha(map_gen_t * s, __m512i alpha_k, uint32_t nof_steps)
+{
+  uint32_t k;
+
+  /* Define the shuffle constant for the positive alpha */
+  __m512i shuf_ap = set_lanes(_mm_set_epi8(
+    15, 14, // 7
+    9,  8,  // 4
+    7,  6,  // 3
+    1,  0,  // 0
+    13, 12, // 6
+    11, 10, // 5
+    5,  4,  // 2
+    3,  2   // 1
+  ));
+
+  /* Define the shuffle constant for the negative alpha */
+  __m512i shuf_an = set_lanes(_mm_set_epi8(
+    13, 12, // 6
+    11, 10, // 5
+    5,  4,  // 2
+    3,  2,  // 1
+    15, 14, // 7
+    9,  8,  // 4
+    7,  6,  // 3
+    1,  0   // 0
+  ));
+
+  /* Define shuffle for branch costs */
+  __m512i shuf_g[4];
+  shuf_g[0] = set_lanes(_mm_set_epi8(3,2,3,2,1,0,1,0,1,0,1,0,3,2,3,2));
+  shuf_g[1] = set_lanes(_mm_set_epi8(7,6,7,6,5,4,5,4,5,4,5,4,7,6,7,6));
+  shuf_g[2] = set_lanes(_mm_set_epi8(11,10,11,10,9,8,9,8,9,8,9,8,11,10,11,10));
+  shuf_g[3] = set_lanes(_mm_set_epi8(15,14,15,14,13,12,13,12,13,12,13,12,15,14,15,14));
+
+  __m512i shuf_norm = set_lanes(_mm_set_epi8(1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0));
+
+  __m512i *alphaPtr = (__m512i*) s->alpha;
+  _mm512_store_si512(alphaPtr, alpha_k);
+  alphaPtr++;
+
+  __m512i gv;
+  __m512i *gPtr = (__m512i*) s->branch;
+  __m512i g, ap, an;
+
+  /* This defines a alpha computation step:
+   * Adds and substracts the branch metrics to the previous alpha step,
+   * shuffles the states according to the trellis path and selects maximum state
+   */
+#define ALPHA_STEP(c)  g = _mm512_shuffle_epi8(gv, shuf_g[c]); \
+  ap = _mm512_add_epi16(alpha_k, g);\
+  an = _mm512_sub_epi16(alpha_k, g);\
+  ap = _mm512_shuffle_epi8(ap, shuf_ap);\
+  an = _mm512_shuffle_epi8(an, shuf_an);\
+  alpha_k = _mm512_max_epi16(ap, an);\
+  _mm512_store_si512(alphaPtr, alpha_k);\
+  alphaPtr++;\
+
+  /* In this loop, we compute 8 steps and normalize twice for each branch metrics memory load */
+  __m512i norm;
+  for (k = 0; k < nof_steps/8; k++) {
+    gv = _mm512_load_si512(gPtr);
+    gPtr++;
+    ALPHA_STEP(0);
+    ALPHA_STEP(1);
+    ALPHA_STEP(2);
+    ALPHA_STEP(3);
+    norm = _mm512_shuffle_epi8(alpha_k, shuf_norm);
+    alpha_k = _mm512_sub_epi16(alpha_k, norm);
+    gv = _mm512_load_si512(gPtr);
+    gPtr++;
+    ALPHA_STEP(0);
+    ALPHA_STEP(1);
+    ALPHA_STEP(2);
+    ALPHA_STEP(3);
+    norm = _mm512_shuffle_epi8(alpha_k, shuf_norm);
+    alpha_k = _mm512_sub_epi16(alpha_k, norm);
+  }
+}
+
+/* Computes beta values of nof_steps steps from beta_k, and the LLR of all the lanes. The last
+ * nof_steps%8 steps are the tail, which has no LLR.
+ */
+static void map_avx512_beta(map_gen_t * s, __m512i beta_k, uint32_t nof_steps)
+{
+  int k = nof_steps - 1;
+  uint32_t nof_tail = nof_steps % 8;
+
+  /* Define the shuffle constant for the positive beta */
+  __m512i shuf_bp = set_lanes(_mm_set_epi8(
+    15, 14, // 7
+    7,  6,  // 3
+    5,  4,  // 2
+    13, 12, // 6
+    11, 10, // 5
+    3,  2,  // 1
+    1,  0,  // 0
+    9,  8   // 4
+  ));
+
+  /* Define the shuffle constant for the negative beta */
+  __m512i shuf_bn = set_lanes(_mm_set_epi8(
+    7,   6, // 3
+    15, 14, // 7
+    13, 12, // 6
+    5,  4,  // 2
+    3,  2,  // 1
+    11, 10, // 5
+    9,  8,  // 4
+    1,  0   // 0
+  ));
+
+  /* Define shuffle for branch costs */
+  __m512i shuf_g[4];
+  shuf_g[3] = set_lanes(_mm_set_epi8(3,2,1,0,1,0,3,2,3,2,1,0,1,0,3,2));
+  shuf_g[2] = set_lanes(_mm_set_epi8(7,6,5,4,5,4,7,6,7,6,5,4,5,4,7,6));
+  shuf_g[1] = set_lanes(_mm_set_epi8(11,10,9,8,9,8,11,10,11,10,9,8,9,8,11,10));
+  shuf_g[0] = set_lanes(_mm_set_epi8(15,14,13,12,13,12,15,14,15,14,13,12,13,12,15,14));
+
+  /* Define shuffle for beta normalization */
+  __m512i shuf_norm = set_lanes(_mm_set_epi8(1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0));
+
+  /* Packs the 4 LLR of each lane */
+  __m512i shuf_llr = _mm512_castsi256_si512(_mm256_set_epi16(27, 26, 25, 24, 19, 18, 17, 16,
+                                                             11, 10,  9,  8,  3,  2,  1,  0));
+
+  __m512i g, bp, bn, alpha_k, m, max_k, gv;
+  __m512i *gPtr = (__m512i*) s->branch + k/4;
+
+  /* This defines a beta computation step:
+   * Adds and substracts the branch metrics to the previous beta step,
+   * shuffles the states according to the trellis path and selects maximum state
+   */
+#define BETA_STEP(g)     bp = _mm512_add_epi16(beta_k, g);\
+    bn = _mm512_sub_epi16(beta_k, g);\
+    bp = _mm512_shuffle_epi8(bp, shuf_bp);\
+    bn = _mm512_shuffle_epi8(bn, shuf_bn);\
+    beta_k = _mm512_max_epi16(bp, bn);
+
+    /* Loads the alpha metrics from memory and adds them to the temporal bn and bp
+     * metrics. The maximum of bp goes to value c and the maximum of bn to value c+4 of each
+     * lane of max_k. The first half of the lane needs one shuffle, the rest are shifts.
+     */
+#define BETA_STEP_CNT(c,d) g = _mm512_shuffle_epi8(gv, shuf_g[c]);\
+    BETA_STEP(g)\
+    alpha_k = _mm512_load_si512(alphaPtr - d);\
+    bp = _mm512_add_epi16(bp, alpha_k);\
+    bn = _mm512_add_epi16(bn, alpha_k);\
+    m = _mm512_max_epi16(_mm512_alignr_epi8(bn, bp, 8), _mm512_mask_blend_epi64(0xAA, bp, bn));\
+    m = _mm512_max_epi16(m, _mm512_srli_epi64(m, 32));\
+    m = _mm512_max_epi16(m, _mm512_srli_epi32(m, 16));\
+    max_k = _mm512_mask_mov_epi16(max_k, 0x11111111 << (3 - c), _mm512_slli_epi64(m, 16*(3 - c)));
+
+  /* Stores the LLR of the 4 steps over the branch metrics block just used */
+#define BETA_STORE_LLR(ptr) _mm256_store_si256((__m256i*) (ptr), _mm512_castsi512_si256(\
+    _mm512_permutexvar_epi16(shuf_llr, _mm512_sub_epi16(max_k, _mm512_bsrli_epi128(max_k, 8)))));
+
+  /* The tail does not require to load alpha or produce outputs. Only update
+   * beta metrics accordingly */
+  if (nof_tail % 4) {
+    gv = _mm512_load_si512(gPtr);
+    gPtr--;
+    for (int j = nof_tail % 4 - 1; j >= 0; j--) {
+      g = _mm512_shuffle_epi8(gv, shuf_g[3 - j]);
+      BETA_STEP(g);
+      k--;
+    }
+  }
+
+  __m512i *alphaPtr = (__m512i*) s->alpha + k;
+
+  /* We inline 2 trelis steps for each normalization */
+  __m512i norm;
+  max_k = _mm512_setzero_si512();
+  for (; k >= 0; k-=8) {
+    gv = _mm512_load_si512(gPtr);
+    BETA_STEP_CNT(0,0);
+    BETA_STEP_CNT(1,1);
+    BETA_STEP_CNT(2,2);
+    BETA_STEP_CNT(3,3);
+    BETA_STORE_LLR(gPtr);
+    gPtr--;
+    norm = _mm512_shuffle_epi8(beta_k, shuf_norm);
+    beta_k = _mm512_sub_epi16(beta_k, norm);
+    gv = _mm512_load_si512(gPtr);
+    BETA_STEP_CNT(0,4);
+    BETA_STEP_CNT(1,5);
+    BETA_STEP_CNT(2,6);
+    BETA_STEP_CNT(3,7);
+    BETA_STORE_LLR(gPtr);
+    gPtr--;
+    norm = _mm512_shuffle_epi8(beta_k, shuf_norm);
+    beta_k = _mm512_sub_epi16(beta_k, norm);
+    alphaPtr -= 8;
+  }
+}
+
+/* Decodes 4 CB of the same length in parallel */
+void map_avx512_dec(map_gen_t * s, int16_t *input[NCB], int16_t *app[NCB], int16_t *parity[NCB],
+                    int16_t *output[NCB], uint32_t long_cb)
+{
+  __m512i state0 = set_lanes(_mm_set_epi16(-INF, -INF, -INF, -INF, -INF, -INF, -INF, 0));
+
+  for (int i = 0; i < NCB; i++) {
+    map_avx512_gamma(s, input[i], app[i], parity[i], i, 0, long_cb + TAIL, long_cb);
+  }
+
+  map_avx512_alpha(s, state0, long_cb);
+
+  map_avx512_beta(s, state0, long_cb + TAIL);
+
+  for (uint32_t k = 0; k < long_cb; k += 4) {
+    for (int i = 0; i < NCB; i++) {
+      _mm_storel_epi64((__m128i*) &output[i][k], _mm_loadl_epi64((__m128i*) &s->branch[LLR_IDX(k, i)]));
+    }
+  }
+}
+
+/* Decodes a CB, with a length multiple of 32, in 4 windows of long_cb/4 steps decoded in parallel.
+ * Each window is extended by SRSLTE_TDEC_WIN_GUARD steps at both sides (or 2*SRSLTE_TDEC_WIN_GUARD
+ * at the inner side for the first and last window) to train the state metrics at its edges, which
+ * start equiprobable. All lanes run the same number of steps; the last one includes the tail.
+ */
+void map_avx512_win_dec(map_gen_t * s, int16_t *input, int16_t *app, int16_t *parity, int16_t *output,
+                        uint32_t long_cb)
+{
+  __m512i state0 = set_lanes(_mm_set_epi16(-INF, -INF, -INF, -INF, -INF, -INF, -INF, 0));
+
+  uint32_t win_len   = long_cb / NCB;
+  uint32_t nof_steps = win_len + 2*SRSLTE_TDEC_WIN_GUARD;
+
+  // First step of each lane in the CB, and first step of its window in the lane
+  uint32_t start[NCB] = {0, win_len - SRSLTE_TDEC_WIN_GUARD, 2*win_len - SRSLTE_TDEC_WIN_GUARD,
+                         long_cb + TAIL - nof_steps};
+  uint32_t first[NCB] = {0, SRSLTE_TDEC_WIN_GUARD, SRSLTE_TDEC_WIN_GUARD, 3*win_len - start[3]};
+
+  for (int i = 0; i < NCB; i++) {
+    map_avx512_gamma(s, input, app, parity, i, start[i], nof_steps, long_cb);
+  }
+
+  // Only the first window starts in state 0 and only the last one ends in state 0
+  map_avx512_alpha(s, _mm512_maskz_mov_epi16(0x000000ff, state0), nof_steps);
+
+  map_avx512_beta(s, _mm512_maskz_mov_epi16(0xff000000, state0), nof_steps);
+
+  for (int i = 0; i < NCB; i++) {
+    for (uint32_t t = first[i]; t < first[i] + win_len; t++) {
+      output[start[i] + t] = s->branch[LLR_IDX(t, i)];
+    }
+  }
+}
+
+#endif
@@ -50,7 +50,7 @@ void srslte_filesource_free(srslte_filesource_t *q) {
 }
 
 void srslte_filesource_seek(srslte_filesource_t *q, int pos) {
-  if (!fseek(q->f, pos, SEEK_SET)){
+  if (fseek(q->f, pos, SEEK_SET)) {
     perror("srslte_filesource_seek");
   }
 }
@@ -0,0 +1,387 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "srslte/phy/io/iqfile.h"
+#include "srslte/phy/utils/vector.h"
+
+// Samples per channel staged by writers of interleaved files
+#define IQFILE_STAGING_LEN 4096
+
+static uint32_t iqfile_sample_size(uint32_t type) {
+  switch (type) {
+    case SRSLTE_IQFILE_CF32:
+      return sizeof(cf_t);
+    case SRSLTE_IQFILE_SC16:
+      return 2 * sizeof(int16_t);
+    default:
+      return 0;
+  }
+}
+
+static bool iqfile_interleaved(srslte_iqfile_t *q) {
+  return q->hdr.block_len == 1 && q->hdr.nof_channels > 1;
+}
+
+static uint8_t *iqfile_sample(srslte_iqfile_t *q, uint32_t channel, uint64_t n) {
+  uint64_t block = n / q->hdr.block_len;
+  uint64_t idx   = n % q->hdr.block_len;
+  return &q->data[((block * q->hdr.nof_channels + channel) * q->hdr.block_len + idx) * q->sample_size];
+}
+
+// Samples of one channel stored contiguously from sample n on
+static uint32_t iqfile_run(srslte_iqfile_t *q, uint64_t n, uint32_t nsamples) {
+  if (q->hdr.nof_channels > 1) {
+    uint32_t left = q->hdr.block_len - (uint32_t) (n % q->hdr.block_len);
+    if (nsamples > left) {
+      nsamples = left;
+    }
+  }
+  return nsamples;
+}
+
+static void iqfile_to_cf(srslte_iqfile_t *q, const uint8_t *src, cf_t *dst, uint32_t nsamples) {
+  if (q->hdr.type == SRSLTE_IQFILE_SC16) {
+    srslte_vec_convert_if((const int16_t*) src, SRSLTE_IQFILE_SC16_SCALE, (float*) dst, 2 * nsamples);
+  } else {
+    memcpy(dst, src, nsamples * sizeof(cf_t));
+  }
+}
+
+static void iqfile_from_cf(srslte_iqfile_t *q, const cf_t *src, uint8_t *dst, uint32_t nsamples) {
+  if (q->hdr.type == SRSLTE_IQFILE_SC16) {
+    srslte_vec_convert_fi((const float*) src, SRSLTE_IQFILE_SC16_SCALE, (int16_t*) dst, 2 * nsamples);
+  } else {
+    memcpy(dst, src, nsamples * sizeof(cf_t));
+  }
+}
+
+int srslte_iqfile_open(srslte_iqfile_t *q, char *filename, uint32_t raw_nof_channels) {
+  int ret = SRSLTE_ERROR_INVALID_INPUTS;
+
+  if (q != NULL && filename != NULL) {
+    ret = SRSLTE_ERROR;
+    bzero(q, sizeof(srslte_iqfile_t));
+    q->fd = open(filename, O_RDONLY);
+    if (q->fd < 0) {
+      perror("open");
+      return ret;
+    }
+    struct stat st;
+    if (fstat(q->fd, &st)) {
+      perror("fstat");
+      goto clean_exit;
+    }
+    uint64_t file_len = (uint64_t) st.st_size;
+
+    if (file_len < sizeof(srslte_iqfile_header_t) ||
+        pread(q->fd, &q->hdr, sizeof(srslte_iqfile_header_t), 0) != sizeof(srslte_iqfile_header_t) ||
+        q->hdr.magic != SRSLTE_IQFILE_MAGIC)
+    {
+      // Raw capture
+      bzero(&q->hdr, sizeof(srslte_iqfile_header_t));
+      q->hdr.type         = SRSLTE_IQFILE_CF32;
+      q->hdr.nof_channels = raw_nof_channels;
+      q->hdr.block_len    = 1;
+    } else if (q->hdr.version != SRSLTE_IQFILE_VERSION ||
+               q->hdr.header_len < sizeof(srslte_iqfile_header_t) ||
+               q->hdr.header_len > file_len)
+    {
+      fprintf(stderr, "Error opening %s: unsupported IQ file version %d\n", filename, q->hdr.version);
+      goto clean_exit;
+    }
+    q->sample_size = iqfile_sample_size(q->hdr.type);
+    if (!q->sample_size || !q->hdr.nof_channels || !q->hdr.block_len) {
+      fprintf(stderr, "Error opening %s: invalid IQ file header\n", filename);
+      goto clean_exit;
+    }
+
+    // Only whole samples of all channels, and whole blocks of planar files, are read
+    uint64_t frame_len = (uint64_t) q->hdr.nof_channels * q->sample_size * q->hdr.block_len;
+    uint64_t capacity  = (file_len - q->hdr.header_len) / frame_len * q->hdr.block_len;
+    q->nof_samples = q->hdr.nof_samples;
+    if (!q->nof_samples || q->nof_samples > capacity) {
+      q->nof_samples = capacity;
+    }
+
+    if (file_len > 0) {
+      q->map_len = (size_t) file_len;
+      q->map = mmap(NULL, q->map_len, PROT_READ, MAP_SHARED, q->fd, 0);
+      if (q->map == MAP_FAILED) {
+        q->map = NULL;
+        perror("mmap");
+        goto clean_exit;
+      }
+      madvise(q->map, q->map_len, MADV_SEQUENTIAL);
+      q->data = &q->map[q->hdr.header_len];
+    }
+    ret = SRSLTE_SUCCESS;
+  }
+
+clean_exit:
+  if (ret == SRSLTE_ERROR) {
+    srslte_iqfile_close(q);
+  }
+  return ret;
+}
+
+static void iqfile_header_init(srslte_iqfile_header_t *hdr, uint32_t nof_channels, srslte_iqfile_type_t type,
+                               uint32_t block_len, double srate, srslte_timestamp_t *start)
+{
+  bzero(hdr, sizeof(srslte_iqfile_header_t));
+  hdr->magic        = SRSLTE_IQFILE_MAGIC;
+  hdr->version      = SRSLTE_IQFILE_VERSION;
+  hdr->header_len   = sizeof(srslte_iqfile_header_t);
+  hdr->type         = type;
+  hdr->nof_channels = nof_channels;
+  hdr->block_len    = block_len;
+  hdr->srate        = srate;
+  if (start) {
+    hdr->start_full_secs = (uint64_t) start->full_secs;
+    hdr->start_frac_secs = start->frac_secs;
+  }
+}
+
+int srslte_iqfile_create(srslte_iqfile_t *q, char *filename, uint32_t nof_channels, srslte_iqfile_type_t type,
+                         uint32_t block_len, double srate, srslte_timestamp_t *start)
+{
+  int ret = SRSLTE_ERROR_INVALID_INPUTS;
+
+  if (q != NULL && filename != NULL && nof_channels > 0 && block_len > 0 && iqfile_sample_size(type)) {
+    ret = SRSLTE_ERROR;
+    bzero(q, sizeof(srslte_iqfile_t));
+    q->fd           = -1;
+    q->write_mode   = true;
+    q->sample_size  = iqfile_sample_size(type);
+
+    iqfile_header_init(&q->hdr, nof_channels, type, block_len, srate, start);
+
+    q->staging_len = block_len > 1 ? block_len : IQFILE_STAGING_LEN;
+    q->staging = srslte_vec_malloc(nof_channels * q->staging_len * q->sample_size);
+    if (!q->staging) {
+      perror("malloc");
+      goto clean_exit;
+    }
+
+    q->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (q->fd < 0) {
+      perror("open");
+      goto clean_exit;
+    }
+    if (write(q->fd, &q->hdr, sizeof(srslte_iqfile_header_t)) != sizeof(srslte_iqfile_header_t)) {
+      perror("write");
+      goto clean_exit;
+    }
+    ret = SRSLTE_SUCCESS;
+  }
+
+clean_exit:
+  if (ret == SRSLTE_ERROR) {
+    srslte_iqfile_close(q);
+  }
+  return ret;
+}
+
+static int iqfile_flush(srslte_iqfile_t *q) {
+  size_t len;
+  if (q->hdr.block_len > 1) {
+    // The last block of a planar file is padded with zeros
+    if (q->staging_count < q->staging_len) {
+      for (uint32_t i = 0; i < q->hdr.nof_channels; i++) {
+        bzero(&q->staging[(i * q->staging_len + q->staging_count) * q->sample_size],
+              (q->staging_len - q->staging_count) * q->sample_size);
+      }
+    }
+    len = q->hdr.nof_channels * q->staging_len * q->sample_size;
+  } else {
+    len = q->hdr.nof_channels * q->staging_count * q->sample_size;
+  }
+
+  size_t n = 0;
+  while (n < len) {
+    ssize_t w = write(q->fd, &q->staging[n], len - n);
+    if (w < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      perror("write");
+      return SRSLTE_ERROR;
+    }
+    n += w;
+  }
+  q->staging_count = 0;
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_iqfile_close(srslte_iqfile_t *q) {
+  if (q->write_mode && q->fd >= 0) {
+    if (q->staging_count) {
+      iqfile_flush(q);
+    }
+    q->hdr.nof_samples = q->nof_samples;
+    if (pwrite(q->fd, &q->hdr, sizeof(srslte_iqfile_header_t), 0) != sizeof(srslte_iqfile_header_t)) {
+      perror("pwrite");
+    }
+  }
+  if (q->map) {
+    munmap(q->map, q->map_len);
+  }
+  if (q->fd >= 0) {
+    close(q->fd);
+  }
+  if (q->staging) {
+    free(q->staging);
+  }
+  bzero(q, sizeof(srslte_iqfile_t));
+  q->fd = -1;
+}
+
+uint64_t srslte_iqfile_nof_samples(srslte_iqfile_t *q) {
+  return q->nof_samples;
+}
+
+void srslte_iqfile_get_start(srslte_iqfile_t *q, srslte_timestamp_t *start) {
+  srslte_timestamp_init(start, (time_t) q->hdr.start_full_secs, q->hdr.start_frac_secs);
+}
+
+int srslte_iqfile_seek(srslte_iqfile_t *q, uint64_t sample) {
+  if (q->write_mode || sample > q->nof_samples) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  q->pos = sample;
+  return SRSLTE_SUCCESS;
+}
+
+uint64_t srslte_iqfile_tell(srslte_iqfile_t *q) {
+  return q->pos;
+}
+
+int srslte_iqfile_read(srslte_iqfile_t *q, cf_t **buffer, int nsamples) {
+  if (q->write_mode || buffer == NULL || nsamples < 0) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  if ((uint64_t) nsamples > q->nof_samples - q->pos) {
+    nsamples = (int) (q->nof_samples - q->pos);
+  }
+
+  if (iqfile_interleaved(q)) {
+    uint32_t nof_channels = q->hdr.nof_channels;
+    for (uint32_t i = 0; i < nof_channels; i++) {
+      if (buffer[i]) {
+        if (q->hdr.type == SRSLTE_IQFILE_SC16) {
+          const int16_t *src = (const int16_t*) iqfile_sample(q, i, q->pos);
+          float *dst = (float*) buffer[i];
+          for (int j = 0; j < nsamples; j++) {
+            dst[2 * j]     = (float) src[2 * j * nof_channels] / SRSLTE_IQFILE_SC16_SCALE;
+            dst[2 * j + 1] = (float) src[2 * j * nof_channels + 1] / SRSLTE_IQFILE_SC16_SCALE;
+          }
+        } else {
+          const cf_t *src = (const cf_t*) iqfile_sample(q, i, q->pos);
+          for (int j = 0; j < nsamples; j++) {
+            buffer[i][j] = src[j * nof_channels];
+          }
+        }
+      }
+    }
+  } else {
+    int n = 0;
+    while (n < nsamples) {
+      uint32_t run = iqfile_run(q, q->pos + n, (uint32_t) (nsamples - n));
+      for (uint32_t i = 0; i < q->hdr.nof_channels; i++) {
+        if (buffer[i]) {
+          iqfile_to_cf(q, iqfile_sample(q, i, q->pos + n), &buffer[i][n], run);
+        }
+      }
+      n += run;
+    }
+  }
+  q->pos += nsamples;
+  return nsamples;
+}
+
+int srslte_iqfile_read_view(srslte_iqfile_t *q, void **ptr, int nsamples) {
+  if (q->write_mode || ptr == NULL || nsamples < 0 || iqfile_interleaved(q)) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  if ((uint64_t) nsamples > q->nof_samples - q->pos) {
+    nsamples = (int) (q->nof_samples - q->pos);
+  }
+  nsamples = (int) iqfile_run(q, q->pos, (uint32_t) nsamples);
+  for (uint32_t i = 0; i < q->hdr.nof_channels; i++) {
+    ptr[i] = iqfile_sample(q, i, q->pos);
+  }
+  q->pos += nsamples;
+  return nsamples;
+}
+
+int srslte_iqfile_write(srslte_iqfile_t *q, cf_t **buffer, int nsamples) {
+  if (!q->write_mode || buffer == NULL || nsamples < 0) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  uint32_t nof_channels = q->hdr.nof_channels;
+  int n = 0;
+  while (n < nsamples) {
+    uint32_t run = q->staging_len - q->staging_count;
+    if (run > (uint32_t) (nsamples - n)) {
+      run = (uint32_t) (nsamples - n);
+    }
+    for (uint32_t i = 0; i < nof_channels; i++) {
+      if (q->hdr.block_len > 1 || nof_channels == 1) {
+        iqfile_from_cf(q, &buffer[i][n], &q->staging[(i * q->staging_len + q->staging_count) * q->sample_size], run);
+      } else if (q->hdr.type == SRSLTE_IQFILE_SC16) {
+        const float *src = (const float*) &buffer[i][n];
+        int16_t *dst = (int16_t*) &q->staging[(q->staging_count * nof_channels + i) * q->sample_size];
+        for (uint32_t j = 0; j < run; j++) {
+          dst[2 * j * nof_channels]     = (int16_t) (src[2 * j] * SRSLTE_IQFILE_SC16_SCALE);
+          dst[2 * j * nof_channels + 1] = (int16_t) (src[2 * j + 1] * SRSLTE_IQFILE_SC16_SCALE);
+        }
+      } else {
+        cf_t *dst = (cf_t*) &q->staging[(q->staging_count * nof_channels + i) * q->sample_size];
+        for (uint32_t j = 0; j < run; j++) {
+          dst[j * nof_channels] = buffer[i][n + j];
+        }
+      }
+    }
+    q->staging_count += run;
+    q->nof_samples   += run;
+    n += run;
+    if (q->staging_count == q->staging_len) {
+      if (iqfile_flush(q)) {
+        return SRSLTE_ERROR;
+      }
+    }
+  }
+  return nsamples;
+}
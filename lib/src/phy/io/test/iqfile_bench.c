@@ -0,0 +1,213 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/io/iqfile.h"
+
+/* Replay throughput of IQ captures: the file source reading a raw capture
+ * against memory-mapped IQ files in the different layouts and types. The
+ * files are read once before timing, so they are served from page cache. */
+
+int nof_samples  = 30720;
+int nof_channels = 2;
+int nof_reads    = 200;
+int nof_passes   = 5;
+char *dir        = "/tmp";
+
+void usage(char *prog) {
+  printf("Usage: %s [ncrpd]\n", prog);
+  printf("\t-n samples per read and channel [Default %d]\n", nof_samples);
+  printf("\t-c number of channels [Default %d]\n", nof_channels);
+  printf("\t-r reads per capture [Default %d]\n", nof_reads);
+  printf("\t-p passes over each capture [Default %d]\n", nof_passes);
+  printf("\t-d directory for the captures [Default %s]\n", dir);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ncrpd")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_samples = atoi(argv[optind]);
+        break;
+      case 'c':
+        nof_channels = atoi(argv[optind]);
+        break;
+      case 'r':
+        nof_reads = atoi(argv[optind]);
+        break;
+      case 'p':
+        nof_passes = atoi(argv[optind]);
+        break;
+      case 'd':
+        dir = argv[optind];
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+cf_t *buffer[SRSLTE_MAX_PORTS];
+
+static void report(const char *name, struct timeval t[3], uint64_t nof_bytes) {
+  get_time_interval(t);
+  double secs = t[0].tv_sec + t[0].tv_usec * 1e-6;
+  double msps = (double) nof_passes * nof_reads * nof_samples / secs / 1e6;
+  printf("%-28s %8.1f Msps per channel %7.2f GB/s of file\n", name, msps,
+         (double) nof_passes * nof_bytes / secs / 1e9);
+}
+
+static void bench_filesource(char *filename) {
+  srslte_filesource_t src;
+  struct timeval t[3];
+  gettimeofday(&t[1], NULL);
+  for (int p = 0; p < nof_passes; p++) {
+    if (srslte_filesource_init(&src, filename, SRSLTE_COMPLEX_FLOAT_BIN)) {
+      exit(-1);
+    }
+    for (int i = 0; i < nof_reads; i++) {
+      srslte_filesource_read_multi(&src, (void**) buffer, nof_samples, nof_channels);
+    }
+    srslte_filesource_free(&src);
+  }
+  gettimeofday(&t[2], NULL);
+  report("filesource_read_multi", t, (uint64_t) nof_reads * nof_samples * nof_channels * sizeof(cf_t));
+}
+
+static void bench_iqfile(const char *name, char *filename, bool view) {
+  srslte_iqfile_t q;
+  struct timeval t[3];
+  void *ptr[SRSLTE_MAX_PORTS];
+  volatile float acc = 0;
+
+  if (srslte_iqfile_open(&q, filename, nof_channels)) {
+    exit(-1);
+  }
+  uint64_t nof_bytes = q.map_len;
+  gettimeofday(&t[1], NULL);
+  for (int p = 0; p < nof_passes; p++) {
+    srslte_iqfile_seek(&q, 0);
+    for (int i = 0; i < nof_reads; i++) {
+      if (view) {
+        // Touch the samples, as a receiver would
+        int n = srslte_iqfile_read_view(&q, ptr, nof_samples);
+        for (int j = 0; j < nof_channels; j++) {
+          acc += crealf(srslte_vec_acc_cc((cf_t*) ptr[j], n));
+        }
+      } else {
+        srslte_iqfile_read(&q, buffer, nof_samples);
+      }
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  srslte_iqfile_close(&q);
+  report(name, t, nof_bytes);
+}
+
+static void write_capture(char *filename, srslte_iqfile_type_t type, uint32_t block_len) {
+  srslte_iqfile_t q;
+  if (srslte_iqfile_create(&q, filename, nof_channels, type, block_len, 1000.0 * nof_samples, NULL)) {
+    exit(-1);
+  }
+  for (int i = 0; i < nof_reads; i++) {
+    srslte_iqfile_write(&q, buffer, nof_samples);
+  }
+  srslte_iqfile_close(&q);
+}
+
+static void warm_up(char *filename) {
+  srslte_iqfile_t q;
+  volatile uint8_t acc = 0;
+  if (!srslte_iqfile_open(&q, filename, nof_channels)) {
+    for (size_t i = 0; i < q.map_len; i += 4096) {
+      acc += q.map[i];
+    }
+    srslte_iqfile_close(&q);
+  }
+}
+
+int main(int argc, char **argv) {
+  char raw[256], interleaved[256], planar[256], planar_sc16[256];
+  srslte_filesink_t sink;
+
+  parse_args(argc, argv);
+  if (nof_channels < 1 || nof_channels > SRSLTE_MAX_PORTS) {
+    usage(argv[0]);
+    exit(-1);
+  }
+  for (int i = 0; i < nof_channels; i++) {
+    buffer[i] = srslte_vec_malloc(nof_samples * sizeof(cf_t));
+    for (int j = 0; j < nof_samples; j++) {
+      buffer[i][j] = ((float) rand() / RAND_MAX - 0.5f) + ((float) rand() / RAND_MAX - 0.5f) * _Complex_I;
+    }
+  }
+
+  snprintf(raw, sizeof(raw), "%s/iqfile_bench_raw.bin", dir);
+  snprintf(interleaved, sizeof(interleaved), "%s/iqfile_bench_interleaved.iq", dir);
+  snprintf(planar, sizeof(planar), "%s/iqfile_bench_planar.iq", dir);
+  snprintf(planar_sc16, sizeof(planar_sc16), "%s/iqfile_bench_planar_sc16.iq", dir);
+
+  if (srslte_filesink_init(&sink, raw, SRSLTE_COMPLEX_FLOAT_BIN)) {
+    exit(-1);
+  }
+  for (int i = 0; i < nof_reads; i++) {
+    srslte_filesink_write_multi(&sink, (void**) buffer, nof_samples, nof_channels);
+  }
+  srslte_filesink_free(&sink);
+  write_capture(interleaved, SRSLTE_IQFILE_CF32, 1);
+  write_capture(planar, SRSLTE_IQFILE_CF32, nof_samples);
+  write_capture(planar_sc16, SRSLTE_IQFILE_SC16, nof_samples);
+
+  warm_up(raw);
+  warm_up(interleaved);
+  warm_up(planar);
+  warm_up(planar_sc16);
+
+  printf("%d channels, %d reads of %d samples, %d passes\n", nof_channels, nof_reads, nof_samples, nof_passes);
+  bench_filesource(raw);
+  bench_iqfile("iqfile raw", raw, false);
+  bench_iqfile("iqfile interleaved cf32", interleaved, false);
+  bench_iqfile("iqfile planar cf32", planar, false);
+  bench_iqfile("iqfile planar cf32 view", planar, true);
+  bench_iqfile("iqfile planar sc16", planar_sc16, false);
+
+  unlink(raw);
+  unlink(interleaved);
+  unlink(planar);
+  unlink(planar_sc16);
+  for (int i = 0; i < nof_channels; i++) {
+    free(buffer[i]);
+  }
+  exit(0);
+}
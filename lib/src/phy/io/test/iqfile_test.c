@@ -0,0 +1,192 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <stdbool.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/io/iqfile.h"
+
+#define NOF_CHANNELS  3
+#define NOF_SAMPLES   10000
+#define CHUNK         1234
+
+#define CHECK(cond) if (!(cond)) { fprintf(stderr, "Failed: %s (line %d)\n", #cond, __LINE__); return false; }
+
+static cf_t *in[NOF_CHANNELS];
+static cf_t *out[NOF_CHANNELS];
+static char filename[] = "/tmp/iqfile_test_XXXXXX";
+
+static bool compare(srslte_iqfile_type_t type, uint32_t offset, uint32_t nsamples)
+{
+  for (int i = 0; i < NOF_CHANNELS; i++) {
+    for (uint32_t j = 0; j < nsamples; j++) {
+      float err = cabsf(out[i][j] - in[i][offset + j]);
+      if (type == SRSLTE_IQFILE_CF32 ? err != 0 : err > 2.0f / SRSLTE_IQFILE_SC16_SCALE) {
+        fprintf(stderr, "Failed: channel %d sample %d error %g\n", i, offset + j, err);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static bool test_roundtrip(srslte_iqfile_type_t type, uint32_t block_len)
+{
+  srslte_iqfile_t q;
+  srslte_timestamp_t start, t;
+  srslte_timestamp_init(&start, 1500000000, 0.25);
+
+  CHECK(!srslte_iqfile_create(&q, filename, NOF_CHANNELS, type, block_len, 23.04e6, &start));
+  for (int n = 0; n < NOF_SAMPLES; n += CHUNK) {
+    cf_t *ptr[NOF_CHANNELS];
+    int len = n + CHUNK > NOF_SAMPLES ? NOF_SAMPLES - n : CHUNK;
+    for (int i = 0; i < NOF_CHANNELS; i++) {
+      ptr[i] = &in[i][n];
+    }
+    CHECK(srslte_iqfile_write(&q, ptr, len) == len);
+  }
+  srslte_iqfile_close(&q);
+
+  CHECK(!srslte_iqfile_open(&q, filename, 1));
+  CHECK(q.hdr.nof_channels == NOF_CHANNELS);
+  CHECK(q.hdr.srate == 23.04e6);
+  CHECK(srslte_iqfile_nof_samples(&q) == NOF_SAMPLES);
+  srslte_iqfile_get_start(&q, &t);
+  CHECK(t.full_secs == start.full_secs && t.frac_secs == start.frac_secs);
+
+  // Read in chunks that do not match the blocks
+  int n = 0, len;
+  while ((len = srslte_iqfile_read(&q, out, 777)) > 0) {
+    CHECK(compare(type, n, len));
+    for (int i = 0; i < NOF_CHANNELS; i++) {
+      out[i] += len;
+    }
+    n += len;
+  }
+  for (int i = 0; i < NOF_CHANNELS; i++) {
+    out[i] -= n;
+  }
+  CHECK(n == NOF_SAMPLES);
+
+  // Seek and skip a channel
+  CHECK(!srslte_iqfile_seek(&q, 4321));
+  cf_t *skip[NOF_CHANNELS] = {out[0], NULL, out[2]};
+  out[1][0] = in[1][4321];
+  CHECK(srslte_iqfile_read(&q, skip, 1) == 1);
+  CHECK(compare(type, 4321, 1));
+  CHECK(srslte_iqfile_tell(&q) == 4322);
+  CHECK(srslte_iqfile_seek(&q, NOF_SAMPLES + 1));
+
+  // Views follow the blocks
+  CHECK(!srslte_iqfile_seek(&q, 0));
+  void *view[NOF_CHANNELS];
+  if (block_len == 1) {
+    CHECK(srslte_iqfile_read_view(&q, view, 100) < 0);
+  } else {
+    n = 0;
+    while ((len = srslte_iqfile_read_view(&q, view, 10 * block_len)) > 0) {
+      CHECK(len <= block_len);
+      for (int i = 0; i < NOF_CHANNELS; i++) {
+        if (type == SRSLTE_IQFILE_SC16) {
+          srslte_vec_convert_if(view[i], SRSLTE_IQFILE_SC16_SCALE, (float*) out[i], 2 * len);
+        } else {
+          memcpy(out[i], view[i], len * sizeof(cf_t));
+        }
+      }
+      CHECK(compare(type, n, len));
+      n += len;
+    }
+    CHECK(n == NOF_SAMPLES);
+  }
+  srslte_iqfile_close(&q);
+  return true;
+}
+
+static bool test_raw()
+{
+  srslte_filesink_t sink;
+  srslte_iqfile_t q;
+
+  // Captures without header written by the file sink
+  CHECK(!srslte_filesink_init(&sink, filename, SRSLTE_COMPLEX_FLOAT_BIN));
+  srslte_filesink_write_multi(&sink, (void**) in, NOF_SAMPLES, 2);
+  srslte_filesink_free(&sink);
+
+  CHECK(!srslte_iqfile_open(&q, filename, 2));
+  CHECK(q.hdr.nof_channels == 2);
+  CHECK(srslte_iqfile_nof_samples(&q) == NOF_SAMPLES);
+  cf_t *ptr[2] = {out[0], out[1]};
+  CHECK(srslte_iqfile_read(&q, ptr, NOF_SAMPLES + 10) == NOF_SAMPLES);
+  CHECK(srslte_iqfile_read(&q, ptr, 10) == 0);
+  srslte_iqfile_close(&q);
+  for (int i = 0; i < 2; i++) {
+    CHECK(!memcmp(in[i], out[i], NOF_SAMPLES * sizeof(cf_t)));
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  int fd = mkstemp(filename);
+  if (fd < 0) {
+    perror("mkstemp");
+    exit(-1);
+  }
+  close(fd);
+
+  for (int i = 0; i < NOF_CHANNELS; i++) {
+    in[i]  = srslte_vec_malloc(NOF_SAMPLES * sizeof(cf_t));
+    out[i] = srslte_vec_malloc(NOF_SAMPLES * sizeof(cf_t));
+    for (int j = 0; j < NOF_SAMPLES; j++) {
+      in[i][j] = ((float) rand() / RAND_MAX - 0.5f) + ((float) rand() / RAND_MAX - 0.5f) * _Complex_I;
+    }
+  }
+
+  bool passed = test_raw();
+  uint32_t block_len[] = {1, 64, 1920};
+  for (int i = 0; i < 3 && passed; i++) {
+    passed = test_roundtrip(SRSLTE_IQFILE_CF32, block_len[i]) && test_roundtrip(SRSLTE_IQFILE_SC16, block_len[i]);
+  }
+
+  unlink(filename);
+  for (int i = 0; i < NOF_CHANNELS; i++) {
+    free(in[i]);
+    free(out[i]);
+  }
+
+  if (passed) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(-1);
+  }
+}
@@ -35,6 +35,16 @@
 #include "srslte/phy/utils/debug.h"
 #include "srslte/phy/utils/mat.h"
 #include "srslte/phy/utils/simd.h"
+#include "srslte/phy/utils/cpu.h"
+#include "precoding_avx.h"
+
+/* Level of the kernels in precoding_avx.c, which are built with the flags of
+ * the AVX2 variant if the library is not built for AVX */
+#ifdef LV_HAVE_AVX
+#define PRECODING_AVX SRSLTE_CPU_AVX
+#elif defined(HAVE_SIMD_AVX2)
+#define PRECODING_AVX SRSLTE_CPU_AVX2
+#endif
 
 #ifdef LV_HAVE_SSE
 #include <immintrin.h>
@@ -42,14 +52,13 @@ int srslte_predecoding_single_sse(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_
 int srslte_predecoding_diversity2_sse(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], cf_t *x[SRSLTE_MAX_LAYERS], int nof_rxant, int nof_symbols, float scaling);
 #endif
 
-#ifdef LV_HAVE_AVX
-#include <immintrin.h>
-int srslte_predecoding_single_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS], cf_t *x, int nof_rxant, int nof_symbols, float scaling, float noise_estimate);
-#endif
-#include "srslte/phy/utils/mat.h"
-
 static srslte_mimo_decoder_t mimo_decoder = SRSLTE_MIMO_DECODER_MMSE;
 
+/* Variant of the SSE/AVX equalizers and precoders in use */
+static srslte_cpu_level_t precoding_simd() {
+  return srslte_cpu_select(SRSLTE_CPU_VARIANTS_PRECODING);
+}
+
 /************************************************
  * 
  * RECEIVER SIDE FUNCTIONS
@@ -145,101 +154,6 @@ int srslte_predecoding_single_sse(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_
 
 #endif
 
-#ifdef LV_HAVE_AVX
-
-#define PROD_AVX(a,b) _mm256_addsub_ps(_mm256_mul_ps(a,_mm256_moveldup_ps(b)),_mm256_mul_ps(_mm256_shuffle_ps(a,a,0xB1),_mm256_movehdup_ps(b)))
-
-
-
-int srslte_predecoding_single_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS], cf_t *x, int nof_rxant, int nof_symbols, float scaling, float noise_estimate) {
-  
-  float *xPtr = (float*) x;
-  const float *hPtr1 = (const float*) h[0];
-  const float *yPtr1 = (const float*) y[0];
-  const float *hPtr2 = (const float*) h[1];
-  const float *yPtr2 = (const float*) y[1];
-
-  __m256 conjugator = _mm256_setr_ps(0, -0.f, 0, -0.f, 0, -0.f, 0, -0.f);
-  
-  __m256 noise = _mm256_set1_ps(noise_estimate);
-  __m256 h1Val1, h2Val1, y1Val1, y2Val1, h12square, h1square, h2square, h1_p, h2_p, h1conj1, h2conj1, x1Val, x2Val;
-  __m256 h1Val2, h2Val2, y1Val2, y2Val2, h1conj2, h2conj2;
-  __m256 avx_scaling = _mm256_set1_ps(1/scaling);
-
-
-  for (int i=0;i<nof_symbols/8;i++) {
-    y1Val1 = _mm256_load_ps(yPtr1); yPtr1+=8;
-    y2Val1 = _mm256_load_ps(yPtr1); yPtr1+=8;
-    h1Val1 = _mm256_load_ps(hPtr1); hPtr1+=8;
-    h2Val1 = _mm256_load_ps(hPtr1); hPtr1+=8;
-
-    if (nof_rxant == 2) {
-      y1Val2 = _mm256_load_ps(yPtr2); yPtr2+=8;
-      y2Val2 = _mm256_load_ps(yPtr2); yPtr2+=8;
-      h1Val2 = _mm256_load_ps(hPtr2); hPtr2+=8;
-      h2Val2 = _mm256_load_ps(hPtr2); hPtr2+=8;      
-    }
-    
-    __m256 t1 = _mm256_mul_ps(h1Val1, h1Val1);
-    __m256 t2 = _mm256_mul_ps(h2Val1, h2Val1);
-    h12square = _mm256_hadd_ps(_mm256_permute2f128_ps(t1, t2, 0x20), _mm256_permute2f128_ps(t1, t2, 0x31)); 
-
-    if (nof_rxant == 2) {
-      t1 = _mm256_mul_ps(h1Val2, h1Val2);
-      t2 = _mm256_mul_ps(h2Val2, h2Val2);
-      h12square = _mm256_add_ps(h12square, _mm256_hadd_ps(_mm256_permute2f128_ps(t1, t2, 0x20), _mm256_permute2f128_ps(t1, t2, 0x31)));   
-    }
-
-    if (noise_estimate > 0) {
-      h12square  = _mm256_add_ps(h12square, noise);
-    }
-    
-    h1_p     = _mm256_permute_ps(h12square, _MM_SHUFFLE(1, 1, 0, 0));
-    h2_p     = _mm256_permute_ps(h12square, _MM_SHUFFLE(3, 3, 2, 2));
-    h1square = _mm256_permute2f128_ps(h1_p, h2_p, 2<<4);
-    h2square = _mm256_permute2f128_ps(h1_p, h2_p, 3<<4 | 1);
-    
-    /* Conjugate channel */
-    h1conj1 = _mm256_xor_ps(h1Val1, conjugator); 
-    h2conj1 = _mm256_xor_ps(h2Val1, conjugator); 
-
-    if (nof_rxant == 2) {
-      h1conj2 = _mm256_xor_ps(h1Val2, conjugator); 
-      h2conj2 = _mm256_xor_ps(h2Val2, conjugator);       
-    }
-    
-    /* Complex product */      
-    x1Val = PROD_AVX(y1Val1, h1conj1);
-    x2Val = PROD_AVX(y2Val1, h2conj1);
-
-    if (nof_rxant == 2) {
-      x1Val = _mm256_add_ps(x1Val, PROD_AVX(y1Val2, h1conj2));
-      x2Val = _mm256_add_ps(x2Val, PROD_AVX(y2Val2, h2conj2));  
-    }
-    
-    x1Val = _mm256_div_ps(x1Val, h1square);
-    x2Val = _mm256_div_ps(x2Val, h2square);
-
-    x1Val = _mm256_mul_ps(x1Val, avx_scaling);
-    x2Val = _mm256_mul_ps(x2Val, avx_scaling);
-
-    _mm256_store_ps(xPtr, x1Val); xPtr+=8;
-    _mm256_store_ps(xPtr, x2Val); xPtr+=8;
-  }
-  for (int i=16*(nof_symbols/16);i<nof_symbols;i++) {
-    cf_t r  = 0; 
-    cf_t hh = 0; 
-    for (int p=0;p<nof_rxant;p++) {
-      r  += y[p][i]*conj(h[p][i]);
-      hh += conj(h[p][i])*h[p][i];
-    }
-    x[i] = r/((hh+noise_estimate) * scaling);
-  }
-  return nof_symbols;
-}
-
-#endif
-
 int srslte_predecoding_single_gen(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS], cf_t *x, int nof_rxant, int nof_symbols, float scaling, float noise_estimate) {
   for (int i=0;i<nof_symbols;i++) {
     cf_t r  = 0; 
@@ -307,23 +221,17 @@ int srslte_predecoding_single(cf_t *y_, cf_t *h_, cf_t *x, float *csi, int nof_s
     return srslte_predecoding_single_csi(y, h, x, csi, nof_rxant, nof_symbols, scaling, noise_estimate);
   }
 
-#ifdef LV_HAVE_AVX
-  if (nof_symbols > 32 && nof_rxant <= 2) {
+#ifdef PRECODING_AVX
+  if (nof_symbols > 32 && nof_rxant <= 2 && precoding_simd() >= PRECODING_AVX) {
     return srslte_predecoding_single_avx(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-  } else {
-    return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
   }
-#else
-  #ifdef LV_HAVE_SSE
-    if (nof_symbols > 32 && nof_rxant <= 2) {
-      return srslte_predecoding_single_sse(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-    } else {
-      return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-    }
-  #else
-    return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-  #endif
-#endif
+#endif /* PRECODING_AVX */
+#ifdef LV_HAVE_SSE
+  if (nof_symbols > 32 && nof_rxant <= 2 && precoding_simd() >= SRSLTE_CPU_SSE) {
+    return srslte_predecoding_single_sse(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
+  }
+#endif /* LV_HAVE_SSE */
+  return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
 }
 
 /* ZF/MMSE SISO equalizer x=y(h'h+no)^(-1)h' (ZF if n0=0.0)*/
@@ -333,23 +241,17 @@ int srslte_predecoding_single_multi(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MA
     return srslte_predecoding_single_csi(y, h, x, csi, nof_rxant, nof_symbols, scaling, noise_estimate);
   }
 
-#ifdef LV_HAVE_AVX
-  if (nof_symbols > 32) {
+#ifdef PRECODING_AVX
+  if (nof_symbols > 32 && precoding_simd() >= PRECODING_AVX) {
     return srslte_predecoding_single_avx(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-  } else {
-    return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
   }
-#else
-  #ifdef LV_HAVE_SSE
-    if (nof_symbols > 32) {
-      return srslte_predecoding_single_sse(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-    } else {
-      return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-    }
-  #else
-    return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
-  #endif
-#endif
+#endif /* PRECODING_AVX */
+#ifdef LV_HAVE_SSE
+  if (nof_symbols > 32 && precoding_simd() >= SRSLTE_CPU_SSE) {
+    return srslte_predecoding_single_sse(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
+  }
+#endif /* LV_HAVE_SSE */
+  return srslte_predecoding_single_gen(y, h, x, nof_rxant, nof_symbols, scaling, noise_estimate);
 }
 
 /* C implementatino of the SFBC equalizer */
@@ -556,28 +458,22 @@ int srslte_predecoding_diversity(cf_t *y_, cf_t *h_[SRSLTE_MAX_PORTS], cf_t *x[S
   y[0] = y_; 
   
 #ifdef LV_HAVE_SSE
-  if (nof_symbols > 32 && nof_ports == 2) {
+  if (nof_symbols > 32 && nof_ports == 2 && precoding_simd() >= SRSLTE_CPU_SSE) {
     return srslte_predecoding_diversity2_sse(y, h, x, nof_rxant, nof_symbols, scaling);
-  } else {
-    return srslte_predecoding_diversity_gen(y, h, x, nof_rxant, nof_ports, nof_symbols, scaling);
   }
-#else
+#endif /* LV_HAVE_SSE */
   return srslte_predecoding_diversity_gen(y, h, x, nof_rxant, nof_ports, nof_symbols, scaling);
-#endif   
 }
 
 int srslte_predecoding_diversity_multi(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], cf_t *x[SRSLTE_MAX_LAYERS], 
                           int nof_rxant, int nof_ports, int nof_symbols, float scaling)
 {
 #ifdef LV_HAVE_SSE
-  if (nof_symbols > 32 && nof_ports == 2) {
+  if (nof_symbols > 32 && nof_ports == 2 && precoding_simd() >= SRSLTE_CPU_SSE) {
     return srslte_predecoding_diversity2_sse(y, h, x, nof_rxant, nof_symbols, scaling);
-  } else {
-    return srslte_predecoding_diversity_gen(y, h, x, nof_rxant, nof_ports, nof_symbols, scaling);
   }
-#else
+#endif /* LV_HAVE_SSE */
   return srslte_predecoding_diversity_gen(y, h, x, nof_rxant, nof_ports, nof_symbols, scaling);
-#endif   
 }
 
 int srslte_precoding_mimo_2x2_gen(cf_t W[2][2], cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], cf_t *x[SRSLTE_MAX_LAYERS], 
@@ -614,47 +510,6 @@ int srslte_precoding_mimo_2x2_gen(cf_t W[2][2], cf_t *y[SRSLTE_MAX_PORTS], cf_t
   return SRSLTE_SUCCESS; 
 }
 
-// AVX implementation of ZF 2x2 CCD equalizer
-#ifdef LV_HAVE_AVX
-
-int srslte_predecoding_ccd_2x2_zf_avx(cf_t *y[SRSLTE_MAX_PORTS],
-                                      cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
-                                      cf_t *x[SRSLTE_MAX_LAYERS],
-                                      uint32_t nof_symbols,
-                                      float scaling) {
-  uint32_t i = 0;
-
-  __m256 mask0 = _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f);
-  __m256 mask1 = _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f);
-
-  for (i = 0; i < nof_symbols - 3; i += 4) {
-    /* Load channel */
-    __m256 h00i = _mm256_load_ps((float *) &h[0][0][i]);
-    __m256 h01i = _mm256_load_ps((float *) &h[0][1][i]);
-    __m256 h10i = _mm256_load_ps((float *) &h[1][0][i]);
-    __m256 h11i = _mm256_load_ps((float *) &h[1][1][i]);
-
-    /* Apply precoding */
-    __m256 h00 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, mask0));
-    __m256 h10 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, mask0));
-    __m256 h01 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, mask1));
-    __m256 h11 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, mask1));
-
-    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
-    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
-
-    __m256 x0, x1;
-
-    srslte_mat_2x2_zf_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, 2.0f / scaling);
-
-    _mm256_store_ps((float *) &x[0][i], x0);
-    _mm256_store_ps((float *) &x[1][i], x1);
-  }
-
-  return nof_symbols;
-}
-#endif /* LV_HAVE_AVX */
-
 // SSE implementation of ZF 2x2 CCD equalizer
 #ifdef LV_HAVE_SSE
 
@@ -729,15 +584,18 @@ int srslte_predecoding_ccd_zf(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORT
 {
   if (nof_ports == 2 && nof_rxant == 2) {
     if (nof_layers == 2) {
-#ifdef LV_HAVE_AVX
-      return srslte_predecoding_ccd_2x2_zf_avx(y, h, x, nof_symbols, scaling);
-#else
+      switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+        case PRECODING_AVX:
+          return srslte_predecoding_ccd_2x2_zf_avx(y, h, x, nof_symbols, scaling);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-      return srslte_predecoding_ccd_2x2_zf_sse(y, h, x, nof_symbols, scaling);
-#else
-      return srslte_predecoding_ccd_2x2_zf_gen(y, h, x, nof_symbols, scaling);
+        case SRSLTE_CPU_SSE:
+          return srslte_predecoding_ccd_2x2_zf_sse(y, h, x, nof_symbols, scaling);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+        default:
+          return srslte_predecoding_ccd_2x2_zf_gen(y, h, x, nof_symbols, scaling);
+      }
     } else {
       DEBUG("Error predecoding CCD: Invalid number of layers %d\n", nof_layers);
       return -1;       
@@ -750,43 +608,6 @@ int srslte_predecoding_ccd_zf(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORT
   return SRSLTE_ERROR;
 }
 
-// AVX implementation of MMSE 2x2 CCD equalizer
-#ifdef LV_HAVE_AVX
-
-int srslte_predecoding_ccd_2x2_mmse_avx(cf_t *y[SRSLTE_MAX_PORTS],
-                                        cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
-                                        cf_t *x[SRSLTE_MAX_LAYERS],
-                                        uint32_t nof_symbols, float scaling, float noise_estimate) {
-  uint32_t i = 0;
-
-  for (i = 0; i < nof_symbols - 3; i += 4) {
-    /* Load channel */
-    __m256 h00i = _mm256_load_ps((float *) &h[0][0][i]);
-    __m256 h01i = _mm256_load_ps((float *) &h[0][1][i]);
-    __m256 h10i = _mm256_load_ps((float *) &h[1][0][i]);
-    __m256 h11i = _mm256_load_ps((float *) &h[1][1][i]);
-
-    /* Apply precoding */
-    __m256 h00 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f)));
-    __m256 h10 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f)));
-    __m256 h01 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f)));
-    __m256 h11 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f)));
-
-    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
-    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
-
-    __m256 x0, x1;
-
-    srslte_mat_2x2_mmse_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, noise_estimate, 2.0f / scaling);
-
-    _mm256_store_ps((float *) &x[0][i], x0);
-    _mm256_store_ps((float *) &x[1][i], x1);
-  }
-
-  return nof_symbols;
-}
-#endif /* LV_HAVE_AVX */
-
 // SSE implementation of ZF 2x2 CCD equalizer
 #ifdef LV_HAVE_SSE
 
@@ -856,15 +677,18 @@ int srslte_predecoding_ccd_mmse(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PO
 {
   if (nof_ports == 2 && nof_rxant == 2) {
     if (nof_layers == 2) {
-#ifdef LV_HAVE_AVX
-      return srslte_predecoding_ccd_2x2_mmse_avx(y, h, x, nof_symbols, scaling, noise_estimate);
-#else
+      switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+        case PRECODING_AVX:
+          return srslte_predecoding_ccd_2x2_mmse_avx(y, h, x, nof_symbols, scaling, noise_estimate);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-      return srslte_predecoding_ccd_2x2_mmse_sse(y, h, x, nof_symbols, scaling, noise_estimate);
-#else
-      return srslte_predecoding_ccd_2x2_mmse_gen(y, h, x, nof_symbols, scaling, noise_estimate);
+        case SRSLTE_CPU_SSE:
+          return srslte_predecoding_ccd_2x2_mmse_sse(y, h, x, nof_symbols, scaling, noise_estimate);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+        default:
+          return srslte_predecoding_ccd_2x2_mmse_gen(y, h, x, nof_symbols, scaling, noise_estimate);
+      }
     } else {
       DEBUG("Error predecoding CCD: Invalid number of layers %d\n", nof_layers);
       return -1;
@@ -877,74 +701,6 @@ int srslte_predecoding_ccd_mmse(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PO
   return SRSLTE_ERROR;
 }
 
-#ifdef LV_HAVE_AVX
-
-// Generic implementation of ZF 2x2 Spatial Multiplexity equalizer
-int srslte_predecoding_multiplex_2x2_zf_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
-                                        cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols, float scaling) {
-  float norm = 1.0;
-
-  switch(codebook_idx) {
-    case 0:
-      norm = (float) M_SQRT2 / scaling;
-      break;
-    case 1:
-    case 2:
-      norm = 2.0f / scaling;
-      break;
-    default:
-      DEBUG("Wrong codebook_idx=%d", codebook_idx);
-      return SRSLTE_ERROR;
-  }
-
-  for (int i = 0; i < nof_symbols - 3; i += 4) {
-    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
-    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
-    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
-    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
-
-    __m256 h00, h01, h10, h11;
-    switch (codebook_idx) {
-      case 0:
-        h00 = _h00;
-        h01 = _h10;
-        h10 = _h01;
-        h11 = _h11;
-        break;
-      case 1:
-        h00 = _mm256_add_ps(_h00, _h10);
-        h01 = _mm256_sub_ps(_h00, _h10);
-        h10 = _mm256_add_ps(_h01, _h11);
-        h11 = _mm256_sub_ps(_h01, _h11);
-        break;
-      case 2:
-        h00 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
-        h01 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
-        h10 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
-        h11 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
-        break;
-      default:
-        DEBUG("Wrong codebook_idx=%d\n", codebook_idx);
-        return SRSLTE_ERROR;
-    }
-
-    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
-    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
-
-    __m256 x0, x1;
-
-    srslte_mat_2x2_zf_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, norm);
-
-    _mm256_store_ps((float *) &x[0][i], x0);
-    _mm256_store_ps((float *) &x[1][i], x1);
-
-  }
-
-  return SRSLTE_SUCCESS;
-}
-
-#endif /* LV_HAVE_AVX */
-
 #ifdef LV_HAVE_SSE
 
 // SSE implementation of ZF 2x2 Spatial Multiplexity equalizer
@@ -1068,75 +824,6 @@ int srslte_predecoding_multiplex_2x2_zf_gen(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[S
   return SRSLTE_SUCCESS;
 }
 
-#ifdef LV_HAVE_AVX
-
-// AVX implementation of ZF 2x2 Spatial Multiplexity equalizer
-int srslte_predecoding_multiplex_2x2_mmse_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
-                                        cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols,
-                                        float scaling, float noise_estimate) {
-  float norm = 1.0;
-
-  switch(codebook_idx) {
-    case 0:
-      norm = (float) M_SQRT2 / scaling;
-      break;
-    case 1:
-    case 2:
-      norm = 2.0f / scaling;
-      break;
-    default:
-      fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
-      return SRSLTE_ERROR;
-  }
-
-  for (int i = 0; i < nof_symbols; i += 4) {
-    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
-    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
-    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
-    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
-
-    __m256 h00, h01, h10, h11;
-    switch (codebook_idx) {
-      case 0:
-        h00 = _h00;
-        h01 = _h10;
-        h10 = _h01;
-        h11 = _h11;
-        break;
-      case 1:
-        h00 = _mm256_add_ps(_h00, _h10);
-        h01 = _mm256_sub_ps(_h00, _h10);
-        h10 = _mm256_add_ps(_h01, _h11);
-        h11 = _mm256_sub_ps(_h01, _h11);
-        break;
-      case 2:
-        h00 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
-        h01 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
-        h10 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
-        h11 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
-        break;
-      default:
-        fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
-        return SRSLTE_ERROR;
-    }
-
-    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
-    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
-
-    __m256 x0, x1;
-
-    srslte_mat_2x2_mmse_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, noise_estimate, norm);
-
-    _mm256_store_ps((float *) &x[0][i], x0);
-    _mm256_store_ps((float *) &x[1][i], x1);
-
-  }
-
-  return SRSLTE_SUCCESS;
-}
-
-#endif /* LV_HAVE_AVX */
-
 
 #ifdef LV_HAVE_SSE
 
@@ -1257,64 +944,6 @@ int srslte_predecoding_multiplex_2x2_mmse_gen(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h
   return SRSLTE_SUCCESS;
 }
 
-#ifdef LV_HAVE_AVX
-
-// Generic implementation of MRC 2x1 (two antennas into one layer) Spatial Multiplexing equalizer
-int srslte_predecoding_multiplex_2x1_mrc_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
-                                             cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols, float scaling) {
-
-  for (int i = 0; i < nof_symbols - 3; i += 4) {
-    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
-    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
-    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
-    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
-
-    __m256 h0, h1;
-    switch (codebook_idx) {
-      case 0:
-        h0 = _mm256_add_ps(_h00, _h10);
-        h1 = _mm256_add_ps(_h01, _h11);
-        break;
-      case 1:
-        h0 = _mm256_sub_ps(_h00, _h10);
-        h1 = _mm256_sub_ps(_h01, _h11);
-        break;
-      case 2:
-        h0 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
-        h1 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
-        break;
-      case 3:
-        h0 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
-        h1 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
-        break;
-      default:
-        fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
-        return SRSLTE_ERROR;
-    }
-
-    __m256 h0_2 = _mm256_mul_ps(h0, h0);
-    __m256 h1_2 = _mm256_mul_ps(h1, h1);
-    __m256 hh0 = _mm256_add_ps(_mm256_movehdup_ps(h0_2), _mm256_moveldup_ps(h0_2));
-    __m256 hh1 = _mm256_add_ps(_mm256_movehdup_ps(h1_2), _mm256_moveldup_ps(h1_2));
-    __m256 hh = _mm256_add_ps(hh0, hh1);
-    __m256 hhrec = _mm256_rcp_ps(hh);
-
-    hhrec = _mm256_mul_ps(hhrec, _mm256_set1_ps((float) M_SQRT2 / scaling));
-    __m256 y0 = _mm256_load_ps((float*)&y[0][i]);
-    __m256 y1 = _mm256_load_ps((float*)&y[1][i]);
-
-    __m256 x0 = _mm256_add_ps(_MM256_PROD_PS(_MM256_CONJ_PS(h0), y0), _MM256_PROD_PS(_MM256_CONJ_PS(h1), y1));
-    x0 = _mm256_mul_ps(hhrec, x0);
-
-    _mm256_store_ps((float*)&x[0][i], x0);
-
-  }
-
-  return SRSLTE_SUCCESS;
-}
-
-#endif /* LV_HAVE_AVX */
-
 
 // SSE  implementation of MRC 2x1 (two antennas into one layer) Spatial Multiplexing equalizer
 #ifdef LV_HAVE_SSE
@@ -1421,38 +1050,47 @@ int srslte_predecoding_multiplex(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_P
     if (nof_layers == 2) {
       switch (mimo_decoder) {
         case SRSLTE_MIMO_DECODER_ZF:
-#ifdef LV_HAVE_AVX
-          return srslte_predecoding_multiplex_2x2_zf_avx(y, h, x, codebook_idx, nof_symbols, scaling);
-#else
+          switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+            case PRECODING_AVX:
+              return srslte_predecoding_multiplex_2x2_zf_avx(y, h, x, codebook_idx, nof_symbols, scaling);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-          return srslte_predecoding_multiplex_2x2_zf_sse(y, h, x, codebook_idx, nof_symbols, scaling);
-#else
-          return srslte_predecoding_multiplex_2x2_zf_gen(y, h, x, codebook_idx, nof_symbols, scaling);
+            case SRSLTE_CPU_SSE:
+              return srslte_predecoding_multiplex_2x2_zf_sse(y, h, x, codebook_idx, nof_symbols, scaling);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+            default:
+              return srslte_predecoding_multiplex_2x2_zf_gen(y, h, x, codebook_idx, nof_symbols, scaling);
+          }
           break;
         case SRSLTE_MIMO_DECODER_MMSE:
-#ifdef LV_HAVE_AVX
-          return srslte_predecoding_multiplex_2x2_mmse_avx(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
-#else
+          switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+            case PRECODING_AVX:
+              return srslte_predecoding_multiplex_2x2_mmse_avx(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-          return srslte_predecoding_multiplex_2x2_mmse_sse(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
-#else
-          return srslte_predecoding_multiplex_2x2_mmse_gen(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
+            case SRSLTE_CPU_SSE:
+              return srslte_predecoding_multiplex_2x2_mmse_sse(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+            default:
+              return srslte_predecoding_multiplex_2x2_mmse_gen(y, h, x, codebook_idx, nof_symbols, scaling, noise_estimate);
+          }
           break;
       }
     } else {
-#ifdef LV_HAVE_AVX
-      return srslte_predecoding_multiplex_2x1_mrc_avx(y, h, x, codebook_idx, nof_symbols, scaling);
-#else
+      switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+        case PRECODING_AVX:
+          return srslte_predecoding_multiplex_2x1_mrc_avx(y, h, x, codebook_idx, nof_symbols, scaling);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-      return srslte_predecoding_multiplex_2x1_mrc_sse(y, h, x, codebook_idx, nof_symbols, scaling);
-#else
-      return srslte_predecoding_multiplex_2x1_mrc_gen(y, h, x, codebook_idx, nof_symbols, scaling);
+        case SRSLTE_CPU_SSE:
+          return srslte_predecoding_multiplex_2x1_mrc_sse(y, h, x, codebook_idx, nof_symbols, scaling);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+        default:
+          return srslte_predecoding_multiplex_2x1_mrc_gen(y, h, x, codebook_idx, nof_symbols, scaling);
+      }
     }
   } else if (nof_ports == 4) {
     DEBUG("Error predecoding multiplex: not implemented for %d Tx ports", nof_ports);
@@ -1592,31 +1230,6 @@ int srslte_precoding_diversity(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PO
   }
 }
 
-#ifdef LV_HAVE_AVX
-
-int srslte_precoding_cdd_2x2_avx(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS], int nof_symbols, float scaling)
-{
-  __m256 norm_avx = _mm256_set1_ps(0.5f * scaling);
-  for (int i = 0; i < nof_symbols - 3; i += 4) {
-    __m256 x0 = _mm256_load_ps((float*) &x[0][i]);
-    __m256 x1 = _mm256_load_ps((float*) &x[1][i]);
-
-    __m256 y0 = _mm256_mul_ps(norm_avx, _mm256_add_ps(x0, x1));
-
-    x0 = _mm256_xor_ps(x0, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f));
-    x1 = _mm256_xor_ps(x1, _mm256_set_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f));
-
-    __m256 y1 = _mm256_mul_ps(norm_avx, _mm256_add_ps(x0, x1));
-
-    _mm256_store_ps((float*)&y[0][i], y0);
-    _mm256_store_ps((float*)&y[1][i], y1);
-  }
-
-  return 2*nof_symbols;
-}
-
-#endif /* LV_HAVE_AVX */
-
 #ifdef LV_HAVE_SSE
 
 int srslte_precoding_cdd_2x2_sse(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS], int nof_symbols, float scaling)
@@ -1663,15 +1276,18 @@ int srslte_precoding_cdd(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS],
       DEBUG("Invalid number of layers %d for 2 ports\n", nof_layers);
       return -1;
     }
-#ifdef LV_HAVE_AVX
-    return srslte_precoding_cdd_2x2_avx(x, y, nof_symbols, scaling);
-#else
+    switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+      case PRECODING_AVX:
+        return srslte_precoding_cdd_2x2_avx(x, y, nof_symbols, scaling);
+#endif /* PRECODING_AVX */
 #ifdef LV_HAVE_SSE
-    return srslte_precoding_cdd_2x2_sse(x, y, nof_symbols, scaling);
-#else
-    return srslte_precoding_cdd_2x2_gen(x, y, nof_symbols, scaling);
+      case SRSLTE_CPU_SSE:
+        return srslte_precoding_cdd_2x2_sse(x, y, nof_symbols, scaling);
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+      default:
+        return srslte_precoding_cdd_2x2_gen(x, y, nof_symbols, scaling);
+    }
   } else if (nof_ports == 4) {
     DEBUG("Not implemented\n");
     return -1;
@@ -1685,6 +1301,7 @@ int srslte_precoding_multiplex(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PO
                                int codebook_idx, uint32_t nof_symbols, float scaling)
 {
   int i = 0;
+  srslte_cpu_level_t simd = precoding_simd();
   if (nof_ports == 2) {
     if (nof_layers == 1) {
       scaling /= sqrtf(2.0f);
@@ -1719,21 +1336,14 @@ int srslte_precoding_multiplex(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PO
           break;
         case 1:
           scaling /= 2.0f;
-#ifdef LV_HAVE_AVX
-          for (; i < nof_symbols - 3; i += 4) {
-            __m256 x0 = _mm256_load_ps((float *) &x[0][i]);
-            __m256 x1 = _mm256_load_ps((float *) &x[1][i]);
-
-            __m256 y0 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_add_ps(x0, x1));
-            __m256 y1 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_sub_ps(x0, x1));
-
-            _mm256_store_ps((float *) &y[0][i], y0);
-            _mm256_store_ps((float *) &y[1][i], y1);
+#ifdef PRECODING_AVX
+          if (simd >= PRECODING_AVX) {
+            i = srslte_precoding_multiplex_2l_cb1_avx(x, y, nof_symbols, scaling);
           }
-#endif /* LV_HAVE_AVX */
+#endif /* PRECODING_AVX */
 
 #ifdef LV_HAVE_SSE
-          for (; i < nof_symbols - 1; i += 2) {
+          for (; i < nof_symbols - 1 && simd >= SRSLTE_CPU_SSE; i += 2) {
             __m128 x0 = _mm_load_ps((float *) &x[0][i]);
             __m128 x1 = _mm_load_ps((float *) &x[1][i]);
 
@@ -1752,21 +1362,14 @@ int srslte_precoding_multiplex(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PO
           break;
         case 2:
           scaling /= 2.0f;
-#ifdef LV_HAVE_AVX
-          for (; i < nof_symbols - 3; i += 4) {
-            __m256 x0 = _mm256_load_ps((float*)&x[0][i]);
-            __m256 x1 = _mm256_load_ps((float*)&x[1][i]);
-
-            __m256 y0 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_add_ps(x0, x1));
-            __m256 y1 = _mm256_mul_ps(_mm256_set1_ps(scaling), _MM256_MULJ_PS(_mm256_sub_ps(x0, x1)));
-
-            _mm256_store_ps((float*)&y[0][i], y0);
-            _mm256_store_ps((float*)&y[1][i], y1);
+#ifdef PRECODING_AVX
+          if (simd >= PRECODING_AVX) {
+            i = srslte_precoding_multiplex_2l_cb2_avx(x, y, nof_symbols, scaling);
           }
-#endif /* LV_HAVE_AVX */
+#endif /* PRECODING_AVX */
 
 #ifdef LV_HAVE_SSE
-          for (; i < nof_symbols - 1; i += 2) {
+          for (; i < nof_symbols - 1 && simd >= SRSLTE_CPU_SSE; i += 2) {
             __m128 x0 = _mm_load_ps((float*)&x[0][i]);
             __m128 x1 = _mm_load_ps((float*)&x[1][i]);
 
@@ -1841,8 +1444,6 @@ int srslte_precoding_type(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS],
   return SRSLTE_ERROR;
 }
 
-#define PMI_SEL_PRECISION 24
-
 /* PMI Select for 1 layer */
 int srslte_precoding_pmi_select_1l_gen(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
                                        float noise_estimate, uint32_t *pmi,
@@ -2028,140 +1629,24 @@ int srslte_precoding_pmi_select_1l_sse(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORT
 
 #endif /* LV_HAVE_SSE */
 
-#ifdef LV_HAVE_AVX
-
-/* PMI Select for 1 layer */
-int srslte_precoding_pmi_select_1l_avx(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
-                                       float noise_estimate, uint32_t *pmi,
-                                       float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
-  float max_sinr = 0.0;
-  uint32_t i, count;
-  __m256 avx_norm = _mm256_set1_ps(0.5f);
-
-  for (i = 0; i < 4; i++) {
-    sinr_list[i] = 0;
-    count = 0;
-
-    for (uint32_t j = 0; j < nof_symbols - PMI_SEL_PRECISION * 4 + 1; j += PMI_SEL_PRECISION * 4) {
-      /* 0. Load channel matrix */
-      __m256 h00 = _mm256_setr_ps(crealf(h[0][0][j]),
-                                 cimagf(h[0][0][j]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 3]));
-      __m256 h01 = _mm256_setr_ps(crealf(h[1][0][j]),
-                                 cimagf(h[1][0][j]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 3]));
-      __m256 h10 = _mm256_setr_ps(crealf(h[0][1][j]),
-                                 cimagf(h[0][1][j]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 3]));
-      __m256 h11 = _mm256_setr_ps(crealf(h[1][1][j]),
-                                 cimagf(h[1][1][j]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 3]));
-
-      /* 1. B = W'* H' */
-      __m256 a0, a1;
-      switch (i) {
-        case 0:
-          a0 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
-          a1 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
-          break;
-        case 1:
-          a0 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
-          a1 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
-          break;
-        case 2:
-          a0 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
-          a1 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
-          break;
-        default:
-          a0 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
-          a1 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
-          break;
-      }
-
-      /* 2. B = W' * H' * H = A * H */
-#ifdef  LV_HAVE_FMA
-      __m256 b0 = _MM256_PROD_ADD_PS(a0, h00, _MM256_PROD_PS(a1, h10));
-      __m256 b1 = _MM256_PROD_ADD_PS(a0, h01, _MM256_PROD_PS(a1, h11));
-#else
-      __m256 b0 = _mm256_add_ps(_MM256_PROD_PS(a0, h00), _MM256_PROD_PS(a1, h10));
-      __m256 b1 = _mm256_add_ps(_MM256_PROD_PS(a0, h01), _MM256_PROD_PS(a1, h11));
-#endif /* LV_HAVE_FMA */
-
-      /* 3. C = W' * H' * H * W' = B * W */
-      __m256 c;
-      switch (i) {
-        case 0:
-          c = _mm256_add_ps(b0, b1);
-          break;
-        case 1:
-          c = _mm256_sub_ps(b0, b1);
-          break;
-        case 2:
-          c = _mm256_add_ps(b0, _MM256_MULJ_PS(b1));
-          break;
-        case 3:
-          c = _mm256_sub_ps(b0, _MM256_MULJ_PS(b1));
-          break;
-        default:
-          return SRSLTE_ERROR;
-      }
-      c = _mm256_mul_ps(c, avx_norm);
-
-      /* Add for averaging */
-      __attribute__((aligned(256))) float gamma[8];
-      _mm256_store_ps(gamma, c);
-      sinr_list[i] += gamma[0] + gamma[2] + gamma[4] + gamma[6];
-
-      count += 4;
-    }
-
-    /* Divide average by noise */
-    sinr_list[i] /= noise_estimate * count;
-
-    if (sinr_list[i] > max_sinr) {
-      max_sinr = sinr_list[i];
-      *pmi = i;
-    }
-  }
-
-  return i;
-}
-
-#endif /* LV_HAVE_AVX */
-
 int srslte_precoding_pmi_select_1l(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
                                    float noise_estimate, uint32_t *pmi,
                                    float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
   int ret;
-#ifdef LV_HAVE_AVX
-  ret = srslte_precoding_pmi_select_1l_avx(h, nof_symbols, noise_estimate, pmi, sinr_list);
-#else
-  #ifdef LV_HAVE_SSE
-  ret = srslte_precoding_pmi_select_1l_sse(h, nof_symbols, noise_estimate, pmi, sinr_list);
-#else
-  ret = srslte_precoding_pmi_select_1l_gen(h, nof_symbols, noise_estimate, pmi, sinr_list);
-#endif
-#endif
+  switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+    case PRECODING_AVX:
+      ret = srslte_precoding_pmi_select_1l_avx(h, nof_symbols, noise_estimate, pmi, sinr_list);
+      break;
+#endif /* PRECODING_AVX */
+#ifdef LV_HAVE_SSE
+    case SRSLTE_CPU_SSE:
+      ret = srslte_precoding_pmi_select_1l_sse(h, nof_symbols, noise_estimate, pmi, sinr_list);
+      break;
+#endif /* LV_HAVE_SSE */
+    default:
+      ret = srslte_precoding_pmi_select_1l_gen(h, nof_symbols, noise_estimate, pmi, sinr_list);
+  }
   INFO("Precoder PMI Select for 1 layer SINR=[%.1fdB; %.1fdB; %.1fdB; %.1fdB] PMI=%d\n", 10 * log10(sinr_list[0]),
        10 * log10(sinr_list[1]), 10 * log10(sinr_list[2]), 10 * log10(sinr_list[3]), *pmi);
 
@@ -2393,170 +1878,26 @@ int srslte_precoding_pmi_select_2l_sse(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORT
 
 #endif /* LV_HAVE_SSE */
 
-#ifdef LV_HAVE_AVX
-
-int srslte_precoding_pmi_select_2l_avx(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
-                                       float noise_estimate, uint32_t *pmi,
-                                       float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
-
-  float max_sinr = 0.0;
-  uint32_t i, count;
-
-  __m256 avx_noise_estimate = _mm256_setr_ps(noise_estimate, 0.0f, noise_estimate, 0.0f,
-                                        noise_estimate, 0.0f, noise_estimate, 0.0f);
-  __m256 avx_norm = _mm256_set1_ps(0.25f);
-  __m256 avx_ones = _mm256_set1_ps(1.0f);
-
-  for (i = 0; i < 2; i++) {
-    sinr_list[i] = 0;
-    count = 0;
-
-    for (uint32_t j = 0; j < nof_symbols - PMI_SEL_PRECISION * 4 + 1; j += PMI_SEL_PRECISION * 4) {
-      /* 0. Load channel matrix */
-      __m256 h00 = _mm256_setr_ps(crealf(h[0][0][j]),
-                                 cimagf(h[0][0][j]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 3]));
-      __m256 h01 = _mm256_setr_ps(crealf(h[1][0][j]),
-                                 cimagf(h[1][0][j]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 3]));
-      __m256 h10 = _mm256_setr_ps(crealf(h[0][1][j]),
-                                 cimagf(h[0][1][j]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 3]));
-      __m256 h11 = _mm256_setr_ps(crealf(h[1][1][j]),
-                                 cimagf(h[1][1][j]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 2]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 2]),
-                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 3]),
-                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 3]));
-
-      /* 1. B = W'* H' */
-      __m256 a00, a01, a10, a11;
-      switch (i) {
-        case 0:
-          a00 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
-          a01 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
-          a10 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
-          a11 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
-          break;
-        case 1:
-          a00 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
-          a01 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
-          a10 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
-          a11 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
-          break;
-        default:
-          return SRSLTE_ERROR;
-      }
-
-      /* 2. B = W' * H' * H = A * H */
-#ifdef LV_HAVE_FMA
-      __m256 b00 = _MM256_PROD_ADD_PS(a00, h00, _MM256_PROD_PS(a01, h10));
-      __m256 b01 = _MM256_PROD_ADD_PS(a00, h01, _MM256_PROD_PS(a01, h11));
-      __m256 b10 = _MM256_PROD_ADD_PS(a10, h00, _MM256_PROD_PS(a11, h10));
-      __m256 b11 = _MM256_PROD_ADD_PS(a10, h01, _MM256_PROD_PS(a11, h11));
-#else
-      __m256 b00 = _mm256_add_ps(_MM256_PROD_PS(a00, h00), _MM256_PROD_PS(a01, h10));
-      __m256 b01 = _mm256_add_ps(_MM256_PROD_PS(a00, h01), _MM256_PROD_PS(a01, h11));
-      __m256 b10 = _mm256_add_ps(_MM256_PROD_PS(a10, h00), _MM256_PROD_PS(a11, h10));
-      __m256 b11 = _mm256_add_ps(_MM256_PROD_PS(a10, h01), _MM256_PROD_PS(a11, h11));
-#endif /* LV_HAVE_FMA */
-
-      /* 3. C = W' * H' * H * W' = B * W */
-      __m256 c00, c01, c10, c11;
-      switch (i) {
-        case 0:
-          c00 = _mm256_add_ps(b00, b01);
-          c01 = _mm256_sub_ps(b00, b01);
-          c10 = _mm256_add_ps(b10, b11);
-          c11 = _mm256_sub_ps(b10, b11);
-          break;
-        case 1:
-          c00 = _mm256_add_ps(b00, _MM256_MULJ_PS(b01));
-          c01 = _mm256_sub_ps(b00, _MM256_MULJ_PS(b01));
-          c10 = _mm256_add_ps(b10, _MM256_MULJ_PS(b11));
-          c11 = _mm256_sub_ps(b10, _MM256_MULJ_PS(b11));
-          break;
-        default:
-          return SRSLTE_ERROR;
-      }
-      c00 = _mm256_mul_ps(c00, avx_norm);
-      c01 = _mm256_mul_ps(c01, avx_norm);
-      c10 = _mm256_mul_ps(c10, avx_norm);
-      c11 = _mm256_mul_ps(c11, avx_norm);
-
-      /* 4. C += noise * I */
-      c00 = _mm256_add_ps(c00, avx_noise_estimate);
-      c11 = _mm256_add_ps(c11, avx_noise_estimate);
-
-      /* 5. detC */
-      __m256 detC = srslte_mat_2x2_det_avx(c00, c01, c10, c11);
-      __m256 inv_detC = srslte_mat_cf_recip_avx(detC);
-      inv_detC = _mm256_mul_ps(avx_noise_estimate, inv_detC);
-
-      __m256 den0 = _MM256_PROD_PS(c00, inv_detC);
-      __m256 den1 = _MM256_PROD_PS(c11, inv_detC);
-
-      __m256 gamma0 = _mm256_sub_ps(_mm256_rcp_ps(den0), avx_ones);
-      __m256 gamma1 = _mm256_sub_ps(_mm256_rcp_ps(den1), avx_ones);
-
-      /* Add for averaging */
-      __m256 sinr_avx = _mm256_permute_ps(_mm256_add_ps(gamma0, gamma1), 0b00101000);
-      __attribute__((aligned(256))) float sinr[8];
-      _mm256_store_ps(sinr, sinr_avx);
-
-      sinr_list[i] += sinr[0] + sinr[2] + sinr[4] + sinr[6];
-
-      count += 4;
-    }
-
-    /* Divide average by noise */
-    if (count) {
-      sinr_list[i] /= count;
-    }
-
-    if (sinr_list[i] > max_sinr) {
-      max_sinr = sinr_list[i];
-      *pmi = i;
-    }
-  }
-
-  return i;
-}
-
-#endif /* LV_HAVE_AVX */
-
 /* PMI Select for 2 layers */
 int srslte_precoding_pmi_select_2l(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
                                    float noise_estimate, uint32_t *pmi,
                                    float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
 
   int ret;
-#ifdef LV_HAVE_AVX
-  ret = srslte_precoding_pmi_select_2l_avx(h, nof_symbols, noise_estimate, pmi, sinr_list);
-#else
-  #ifdef LV_HAVE_SSE
-  ret = srslte_precoding_pmi_select_2l_sse(h, nof_symbols, noise_estimate, pmi, sinr_list);
-#else
-  ret = srslte_precoding_pmi_select_2l_gen(h, nof_symbols, noise_estimate, pmi, sinr_list);
+  switch (precoding_simd()) {
+#ifdef PRECODING_AVX
+    case PRECODING_AVX:
+      ret = srslte_precoding_pmi_select_2l_avx(h, nof_symbols, noise_estimate, pmi, sinr_list);
+      break;
+#endif /* PRECODING_AVX */
+#ifdef LV_HAVE_SSE
+    case SRSLTE_CPU_SSE:
+      ret = srslte_precoding_pmi_select_2l_sse(h, nof_symbols, noise_estimate, pmi, sinr_list);
+      break;
 #endif /* LV_HAVE_SSE */
-#endif /* LV_HAVE_AVX */
+    default:
+      ret = srslte_precoding_pmi_select_2l_gen(h, nof_symbols, noise_estimate, pmi, sinr_list);
+  }
 
   INFO("Precoder PMI Select for 2 layers SINR=[%.1fdB; %.1fdB] PMI=%d\n", 10 * log10(sinr_list[0]),
        10 * log10(sinr_list[1]), *pmi);
@@ -0,0 +1,704 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdlib.h>
+#include <complex.h>
+#include <string.h>
+#include <math.h>
+
+#include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/mimo/precoding.h"
+#include "srslte/phy/utils/vector.h"
+#include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/mat.h"
+#include "srslte/phy/utils/simd.h"
+#include "precoding_avx.h"
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+#define PROD_AVX(a,b) _mm256_addsub_ps(_mm256_mul_ps(a,_mm256_moveldup_ps(b)),_mm256_mul_ps(_mm256_shuffle_ps(a,a,0xB1),_mm256_movehdup_ps(b)))
+
+int srslte_predecoding_single_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS], cf_t *x, int nof_rxant, int nof_symbols, float scaling, float noise_estimate) {
+  
+  float *xPtr = (float*) x;
+  const float *hPtr1 = (const float*) h[0];
+  const float *yPtr1 = (const float*) y[0];
+  const float *hPtr2 = (const float*) h[1];
+  const float *yPtr2 = (const float*) y[1];
+
+  __m256 conjugator = _mm256_setr_ps(0, -0.f, 0, -0.f, 0, -0.f, 0, -0.f);
+  
+  __m256 noise = _mm256_set1_ps(noise_estimate);
+  __m256 h1Val1, h2Val1, y1Val1, y2Val1, h12square, h1square, h2square, h1_p, h2_p, h1conj1, h2conj1, x1Val, x2Val;
+  __m256 h1Val2, h2Val2, y1Val2, y2Val2, h1conj2, h2conj2;
+  __m256 avx_scaling = _mm256_set1_ps(1/scaling);
+
+
+  for (int i=0;i<nof_symbols/8;i++) {
+    y1Val1 = _mm256_load_ps(yPtr1); yPtr1+=8;
+    y2Val1 = _mm256_load_ps(yPtr1); yPtr1+=8;
+    h1Val1 = _mm256_load_ps(hPtr1); hPtr1+=8;
+    h2Val1 = _mm256_load_ps(hPtr1); hPtr1+=8;
+
+    if (nof_rxant == 2) {
+      y1Val2 = _mm256_load_ps(yPtr2); yPtr2+=8;
+      y2Val2 = _mm256_load_ps(yPtr2); yPtr2+=8;
+      h1Val2 = _mm256_load_ps(hPtr2); hPtr2+=8;
+      h2Val2 = _mm256_load_ps(hPtr2); hPtr2+=8;      
+    }
+    
+    __m256 t1 = _mm256_mul_ps(h1Val1, h1Val1);
+    __m256 t2 = _mm256_mul_ps(h2Val1, h2Val1);
+    h12square = _mm256_hadd_ps(_mm256_permute2f128_ps(t1, t2, 0x20), _mm256_permute2f128_ps(t1, t2, 0x31)); 
+
+    if (nof_rxant == 2) {
+      t1 = _mm256_mul_ps(h1Val2, h1Val2);
+      t2 = _mm256_mul_ps(h2Val2, h2Val2);
+      h12square = _mm256_add_ps(h12square, _mm256_hadd_ps(_mm256_permute2f128_ps(t1, t2, 0x20), _mm256_permute2f128_ps(t1, t2, 0x31)));   
+    }
+
+    if (noise_estimate > 0) {
+      h12square  = _mm256_add_ps(h12square, noise);
+    }
+    
+    h1_p     = _mm256_permute_ps(h12square, _MM_SHUFFLE(1, 1, 0, 0));
+    h2_p     = _mm256_permute_ps(h12square, _MM_SHUFFLE(3, 3, 2, 2));
+    h1square = _mm256_permute2f128_ps(h1_p, h2_p, 2<<4);
+    h2square = _mm256_permute2f128_ps(h1_p, h2_p, 3<<4 | 1);
+    
+    /* Conjugate channel */
+    h1conj1 = _mm256_xor_ps(h1Val1, conjugator); 
+    h2conj1 = _mm256_xor_ps(h2Val1, conjugator); 
+
+    if (nof_rxant == 2) {
+      h1conj2 = _mm256_xor_ps(h1Val2, conjugator); 
+      h2conj2 = _mm256_xor_ps(h2Val2, conjugator);       
+    }
+    
+    /* Complex product */      
+    x1Val = PROD_AVX(y1Val1, h1conj1);
+    x2Val = PROD_AVX(y2Val1, h2conj1);
+
+    if (nof_rxant == 2) {
+      x1Val = _mm256_add_ps(x1Val, PROD_AVX(y1Val2, h1conj2));
+      x2Val = _mm256_add_ps(x2Val, PROD_AVX(y2Val2, h2conj2));  
+    }
+    
+    x1Val = _mm256_div_ps(x1Val, h1square);
+    x2Val = _mm256_div_ps(x2Val, h2square);
+
+    x1Val = _mm256_mul_ps(x1Val, avx_scaling);
+    x2Val = _mm256_mul_ps(x2Val, avx_scaling);
+
+    _mm256_store_ps(xPtr, x1Val); xPtr+=8;
+    _mm256_store_ps(xPtr, x2Val); xPtr+=8;
+  }
+  for (int i=16*(nof_symbols/16);i<nof_symbols;i++) {
+    cf_t r  = 0; 
+    cf_t hh = 0; 
+    for (int p=0;p<nof_rxant;p++) {
+      r  += y[p][i]*conj(h[p][i]);
+      hh += conj(h[p][i])*h[p][i];
+    }
+    x[i] = r/((hh+noise_estimate) * scaling);
+  }
+  return nof_symbols;
+}
+
+// AVX implementation of ZF 2x2 CCD equalizer
+int srslte_predecoding_ccd_2x2_zf_avx(cf_t *y[SRSLTE_MAX_PORTS],
+                                      cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
+                                      cf_t *x[SRSLTE_MAX_LAYERS],
+                                      uint32_t nof_symbols,
+                                      float scaling) {
+  uint32_t i = 0;
+
+  __m256 mask0 = _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f);
+  __m256 mask1 = _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f);
+
+  for (i = 0; i < nof_symbols - 3; i += 4) {
+    /* Load channel */
+    __m256 h00i = _mm256_load_ps((float *) &h[0][0][i]);
+    __m256 h01i = _mm256_load_ps((float *) &h[0][1][i]);
+    __m256 h10i = _mm256_load_ps((float *) &h[1][0][i]);
+    __m256 h11i = _mm256_load_ps((float *) &h[1][1][i]);
+
+    /* Apply precoding */
+    __m256 h00 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, mask0));
+    __m256 h10 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, mask0));
+    __m256 h01 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, mask1));
+    __m256 h11 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, mask1));
+
+    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
+    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
+
+    __m256 x0, x1;
+
+    srslte_mat_2x2_zf_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, 2.0f / scaling);
+
+    _mm256_store_ps((float *) &x[0][i], x0);
+    _mm256_store_ps((float *) &x[1][i], x1);
+  }
+
+  return nof_symbols;
+}
+
+// AVX implementation of MMSE 2x2 CCD equalizer
+int srslte_predecoding_ccd_2x2_mmse_avx(cf_t *y[SRSLTE_MAX_PORTS],
+                                        cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
+                                        cf_t *x[SRSLTE_MAX_LAYERS],
+                                        uint32_t nof_symbols, float scaling, float noise_estimate) {
+  uint32_t i = 0;
+
+  for (i = 0; i < nof_symbols - 3; i += 4) {
+    /* Load channel */
+    __m256 h00i = _mm256_load_ps((float *) &h[0][0][i]);
+    __m256 h01i = _mm256_load_ps((float *) &h[0][1][i]);
+    __m256 h10i = _mm256_load_ps((float *) &h[1][0][i]);
+    __m256 h11i = _mm256_load_ps((float *) &h[1][1][i]);
+
+    /* Apply precoding */
+    __m256 h00 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f)));
+    __m256 h10 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f)));
+    __m256 h01 = _mm256_add_ps(h00i, _mm256_xor_ps(h10i, _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f)));
+    __m256 h11 = _mm256_add_ps(h01i, _mm256_xor_ps(h11i, _mm256_setr_ps(-0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f)));
+
+    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
+    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
+
+    __m256 x0, x1;
+
+    srslte_mat_2x2_mmse_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, noise_estimate, 2.0f / scaling);
+
+    _mm256_store_ps((float *) &x[0][i], x0);
+    _mm256_store_ps((float *) &x[1][i], x1);
+  }
+
+  return nof_symbols;
+}
+
+// Generic implementation of ZF 2x2 Spatial Multiplexity equalizer
+int srslte_predecoding_multiplex_2x2_zf_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
+                                        cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols, float scaling) {
+  float norm = 1.0;
+
+  switch(codebook_idx) {
+    case 0:
+      norm = (float) M_SQRT2 / scaling;
+      break;
+    case 1:
+    case 2:
+      norm = 2.0f / scaling;
+      break;
+    default:
+      DEBUG("Wrong codebook_idx=%d", codebook_idx);
+      return SRSLTE_ERROR;
+  }
+
+  for (int i = 0; i < nof_symbols - 3; i += 4) {
+    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
+    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
+    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
+    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
+
+    __m256 h00, h01, h10, h11;
+    switch (codebook_idx) {
+      case 0:
+        h00 = _h00;
+        h01 = _h10;
+        h10 = _h01;
+        h11 = _h11;
+        break;
+      case 1:
+        h00 = _mm256_add_ps(_h00, _h10);
+        h01 = _mm256_sub_ps(_h00, _h10);
+        h10 = _mm256_add_ps(_h01, _h11);
+        h11 = _mm256_sub_ps(_h01, _h11);
+        break;
+      case 2:
+        h00 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
+        h01 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
+        h10 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
+        h11 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
+        break;
+      default:
+        DEBUG("Wrong codebook_idx=%d\n", codebook_idx);
+        return SRSLTE_ERROR;
+    }
+
+    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
+    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
+
+    __m256 x0, x1;
+
+    srslte_mat_2x2_zf_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, norm);
+
+    _mm256_store_ps((float *) &x[0][i], x0);
+    _mm256_store_ps((float *) &x[1][i], x1);
+
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+// AVX implementation of ZF 2x2 Spatial Multiplexity equalizer
+int srslte_predecoding_multiplex_2x2_mmse_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
+                                        cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols,
+                                        float scaling, float noise_estimate) {
+  float norm = 1.0;
+
+  switch(codebook_idx) {
+    case 0:
+      norm = (float) M_SQRT2 / scaling;
+      break;
+    case 1:
+    case 2:
+      norm = 2.0f / scaling;
+      break;
+    default:
+      fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
+      return SRSLTE_ERROR;
+  }
+
+  for (int i = 0; i < nof_symbols; i += 4) {
+    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
+    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
+    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
+    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
+
+    __m256 h00, h01, h10, h11;
+    switch (codebook_idx) {
+      case 0:
+        h00 = _h00;
+        h01 = _h10;
+        h10 = _h01;
+        h11 = _h11;
+        break;
+      case 1:
+        h00 = _mm256_add_ps(_h00, _h10);
+        h01 = _mm256_sub_ps(_h00, _h10);
+        h10 = _mm256_add_ps(_h01, _h11);
+        h11 = _mm256_sub_ps(_h01, _h11);
+        break;
+      case 2:
+        h00 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
+        h01 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
+        h10 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
+        h11 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
+        break;
+      default:
+        fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
+        return SRSLTE_ERROR;
+    }
+
+    __m256 y0 = _mm256_load_ps((float *) &y[0][i]);
+    __m256 y1 = _mm256_load_ps((float *) &y[1][i]);
+
+    __m256 x0, x1;
+
+    srslte_mat_2x2_mmse_avx(y0, y1, h00, h01, h10, h11, &x0, &x1, noise_estimate, norm);
+
+    _mm256_store_ps((float *) &x[0][i], x0);
+    _mm256_store_ps((float *) &x[1][i], x1);
+
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+// Generic implementation of MRC 2x1 (two antennas into one layer) Spatial Multiplexing equalizer
+int srslte_predecoding_multiplex_2x1_mrc_avx(cf_t *y[SRSLTE_MAX_PORTS], cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS],
+                                             cf_t *x[SRSLTE_MAX_LAYERS], int codebook_idx, int nof_symbols, float scaling) {
+
+  for (int i = 0; i < nof_symbols - 3; i += 4) {
+    __m256 _h00 = _mm256_load_ps((float*)&(h[0][0][i]));
+    __m256 _h01 = _mm256_load_ps((float*)&(h[0][1][i]));
+    __m256 _h10 = _mm256_load_ps((float*)&(h[1][0][i]));
+    __m256 _h11 = _mm256_load_ps((float*)&(h[1][1][i]));
+
+    __m256 h0, h1;
+    switch (codebook_idx) {
+      case 0:
+        h0 = _mm256_add_ps(_h00, _h10);
+        h1 = _mm256_add_ps(_h01, _h11);
+        break;
+      case 1:
+        h0 = _mm256_sub_ps(_h00, _h10);
+        h1 = _mm256_sub_ps(_h01, _h11);
+        break;
+      case 2:
+        h0 = _mm256_add_ps(_h00, _MM256_MULJ_PS(_h10));
+        h1 = _mm256_add_ps(_h01, _MM256_MULJ_PS(_h11));
+        break;
+      case 3:
+        h0 = _mm256_sub_ps(_h00, _MM256_MULJ_PS(_h10));
+        h1 = _mm256_sub_ps(_h01, _MM256_MULJ_PS(_h11));
+        break;
+      default:
+        fprintf(stderr, "Wrong codebook_idx=%d\n", codebook_idx);
+        return SRSLTE_ERROR;
+    }
+
+    __m256 h0_2 = _mm256_mul_ps(h0, h0);
+    __m256 h1_2 = _mm256_mul_ps(h1, h1);
+    __m256 hh0 = _mm256_add_ps(_mm256_movehdup_ps(h0_2), _mm256_moveldup_ps(h0_2));
+    __m256 hh1 = _mm256_add_ps(_mm256_movehdup_ps(h1_2), _mm256_moveldup_ps(h1_2));
+    __m256 hh = _mm256_add_ps(hh0, hh1);
+    __m256 hhrec = _mm256_rcp_ps(hh);
+
+    hhrec = _mm256_mul_ps(hhrec, _mm256_set1_ps((float) M_SQRT2 / scaling));
+    __m256 y0 = _mm256_load_ps((float*)&y[0][i]);
+    __m256 y1 = _mm256_load_ps((float*)&y[1][i]);
+
+    __m256 x0 = _mm256_add_ps(_MM256_PROD_PS(_MM256_CONJ_PS(h0), y0), _MM256_PROD_PS(_MM256_CONJ_PS(h1), y1));
+    x0 = _mm256_mul_ps(hhrec, x0);
+
+    _mm256_store_ps((float*)&x[0][i], x0);
+
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+int srslte_precoding_cdd_2x2_avx(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS], int nof_symbols, float scaling)
+{
+  __m256 norm_avx = _mm256_set1_ps(0.5f * scaling);
+  for (int i = 0; i < nof_symbols - 3; i += 4) {
+    __m256 x0 = _mm256_load_ps((float*) &x[0][i]);
+    __m256 x1 = _mm256_load_ps((float*) &x[1][i]);
+
+    __m256 y0 = _mm256_mul_ps(norm_avx, _mm256_add_ps(x0, x1));
+
+    x0 = _mm256_xor_ps(x0, _mm256_setr_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f));
+    x1 = _mm256_xor_ps(x1, _mm256_set_ps(+0.0f, +0.0f, -0.0f, -0.0f, +0.0f, +0.0f, -0.0f, -0.0f));
+
+    __m256 y1 = _mm256_mul_ps(norm_avx, _mm256_add_ps(x0, x1));
+
+    _mm256_store_ps((float*)&y[0][i], y0);
+    _mm256_store_ps((float*)&y[1][i], y1);
+  }
+
+  return 2*nof_symbols;
+}
+
+// AVX implementation of the 2 layer precoder with codebook 1. Returns the number of symbols precoded
+int srslte_precoding_multiplex_2l_cb1_avx(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS], int nof_symbols, float scaling)
+{
+  int i = 0;
+  for (; i < nof_symbols - 3; i += 4) {
+    __m256 x0 = _mm256_load_ps((float *) &x[0][i]);
+    __m256 x1 = _mm256_load_ps((float *) &x[1][i]);
+
+    __m256 y0 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_add_ps(x0, x1));
+    __m256 y1 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_sub_ps(x0, x1));
+
+    _mm256_store_ps((float *) &y[0][i], y0);
+    _mm256_store_ps((float *) &y[1][i], y1);
+  }
+  return i;
+}
+
+// AVX implementation of the 2 layer precoder with codebook 2. Returns the number of symbols precoded
+int srslte_precoding_multiplex_2l_cb2_avx(cf_t *x[SRSLTE_MAX_LAYERS], cf_t *y[SRSLTE_MAX_PORTS], int nof_symbols, float scaling)
+{
+  int i = 0;
+  for (; i < nof_symbols - 3; i += 4) {
+    __m256 x0 = _mm256_load_ps((float*)&x[0][i]);
+    __m256 x1 = _mm256_load_ps((float*)&x[1][i]);
+
+    __m256 y0 = _mm256_mul_ps(_mm256_set1_ps(scaling), _mm256_add_ps(x0, x1));
+    __m256 y1 = _mm256_mul_ps(_mm256_set1_ps(scaling), _MM256_MULJ_PS(_mm256_sub_ps(x0, x1)));
+
+    _mm256_store_ps((float*)&y[0][i], y0);
+    _mm256_store_ps((float*)&y[1][i], y1);
+  }
+  return i;
+}
+
+/* PMI Select for 1 layer */
+int srslte_precoding_pmi_select_1l_avx(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
+                                       float noise_estimate, uint32_t *pmi,
+                                       float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
+  float max_sinr = 0.0;
+  uint32_t i, count;
+  __m256 avx_norm = _mm256_set1_ps(0.5f);
+
+  for (i = 0; i < 4; i++) {
+    sinr_list[i] = 0;
+    count = 0;
+
+    for (uint32_t j = 0; j < nof_symbols - PMI_SEL_PRECISION * 4 + 1; j += PMI_SEL_PRECISION * 4) {
+      /* 0. Load channel matrix */
+      __m256 h00 = _mm256_setr_ps(crealf(h[0][0][j]),
+                                 cimagf(h[0][0][j]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 3]));
+      __m256 h01 = _mm256_setr_ps(crealf(h[1][0][j]),
+                                 cimagf(h[1][0][j]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 3]));
+      __m256 h10 = _mm256_setr_ps(crealf(h[0][1][j]),
+                                 cimagf(h[0][1][j]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 3]));
+      __m256 h11 = _mm256_setr_ps(crealf(h[1][1][j]),
+                                 cimagf(h[1][1][j]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 3]));
+
+      /* 1. B = W'* H' */
+      __m256 a0, a1;
+      switch (i) {
+        case 0:
+          a0 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
+          a1 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
+          break;
+        case 1:
+          a0 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
+          a1 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
+          break;
+        case 2:
+          a0 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
+          a1 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
+          break;
+        default:
+          a0 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
+          a1 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
+          break;
+      }
+
+      /* 2. B = W' * H' * H = A * H */
+#ifdef  LV_HAVE_FMA
+      __m256 b0 = _MM256_PROD_ADD_PS(a0, h00, _MM256_PROD_PS(a1, h10));
+      __m256 b1 = _MM256_PROD_ADD_PS(a0, h01, _MM256_PROD_PS(a1, h11));
+#else
+      __m256 b0 = _mm256_add_ps(_MM256_PROD_PS(a0, h00), _MM256_PROD_PS(a1, h10));
+      __m256 b1 = _mm256_add_ps(_MM256_PROD_PS(a0, h01), _MM256_PROD_PS(a1, h11));
+#endif /* LV_HAVE_FMA */
+
+      /* 3. C = W' * H' * H * W' = B * W */
+      __m256 c;
+      switch (i) {
+        case 0:
+          c = _mm256_add_ps(b0, b1);
+          break;
+        case 1:
+          c = _mm256_sub_ps(b0, b1);
+          break;
+        case 2:
+          c = _mm256_add_ps(b0, _MM256_MULJ_PS(b1));
+          break;
+        case 3:
+          c = _mm256_sub_ps(b0, _MM256_MULJ_PS(b1));
+          break;
+        default:
+          return SRSLTE_ERROR;
+      }
+      c = _mm256_mul_ps(c, avx_norm);
+
+      /* Add for averaging */
+      __attribute__((aligned(256))) float gamma[8];
+      _mm256_store_ps(gamma, c);
+      sinr_list[i] += gamma[0] + gamma[2] + gamma[4] + gamma[6];
+
+      count += 4;
+    }
+
+    /* Divide average by noise */
+    sinr_list[i] /= noise_estimate * count;
+
+    if (sinr_list[i] > max_sinr) {
+      max_sinr = sinr_list[i];
+      *pmi = i;
+    }
+  }
+
+  return i;
+}
+
+int srslte_precoding_pmi_select_2l_avx(cf_t *h[SRSLTE_MAX_PORTS][SRSLTE_MAX_PORTS], uint32_t nof_symbols,
+                                       float noise_estimate, uint32_t *pmi,
+                                       float sinr_list[SRSLTE_MAX_CODEBOOKS]) {
+
+  float max_sinr = 0.0;
+  uint32_t i, count;
+
+  __m256 avx_noise_estimate = _mm256_setr_ps(noise_estimate, 0.0f, noise_estimate, 0.0f,
+                                        noise_estimate, 0.0f, noise_estimate, 0.0f);
+  __m256 avx_norm = _mm256_set1_ps(0.25f);
+  __m256 avx_ones = _mm256_set1_ps(1.0f);
+
+  for (i = 0; i < 2; i++) {
+    sinr_list[i] = 0;
+    count = 0;
+
+    for (uint32_t j = 0; j < nof_symbols - PMI_SEL_PRECISION * 4 + 1; j += PMI_SEL_PRECISION * 4) {
+      /* 0. Load channel matrix */
+      __m256 h00 = _mm256_setr_ps(crealf(h[0][0][j]),
+                                 cimagf(h[0][0][j]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[0][0][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[0][0][j + PMI_SEL_PRECISION * 3]));
+      __m256 h01 = _mm256_setr_ps(crealf(h[1][0][j]),
+                                 cimagf(h[1][0][j]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[1][0][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[1][0][j + PMI_SEL_PRECISION * 3]));
+      __m256 h10 = _mm256_setr_ps(crealf(h[0][1][j]),
+                                 cimagf(h[0][1][j]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[0][1][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[0][1][j + PMI_SEL_PRECISION * 3]));
+      __m256 h11 = _mm256_setr_ps(crealf(h[1][1][j]),
+                                 cimagf(h[1][1][j]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 2]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 2]),
+                                 crealf(h[1][1][j + PMI_SEL_PRECISION * 3]),
+                                 cimagf(h[1][1][j + PMI_SEL_PRECISION * 3]));
+
+      /* 1. B = W'* H' */
+      __m256 a00, a01, a10, a11;
+      switch (i) {
+        case 0:
+          a00 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
+          a01 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
+          a10 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_CONJ_PS(h01));
+          a11 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_CONJ_PS(h11));
+          break;
+        case 1:
+          a00 = _mm256_sub_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
+          a01 = _mm256_sub_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
+          a10 = _mm256_add_ps(_MM256_CONJ_PS(h00), _MM256_MULJ_PS(_MM256_CONJ_PS(h01)));
+          a11 = _mm256_add_ps(_MM256_CONJ_PS(h10), _MM256_MULJ_PS(_MM256_CONJ_PS(h11)));
+          break;
+        default:
+          return SRSLTE_ERROR;
+      }
+
+      /* 2. B = W' * H' * H = A * H */
+#ifdef LV_HAVE_FMA
+      __m256 b00 = _MM256_PROD_ADD_PS(a00, h00, _MM256_PROD_PS(a01, h10));
+      __m256 b01 = _MM256_PROD_ADD_PS(a00, h01, _MM256_PROD_PS(a01, h11));
+      __m256 b10 = _MM256_PROD_ADD_PS(a10, h00, _MM256_PROD_PS(a11, h10));
+      __m256 b11 = _MM256_PROD_ADD_PS(a10, h01, _MM256_PROD_PS(a11, h11));
+#else
+      __m256 b00 = _mm256_add_ps(_MM256_PROD_PS(a00, h00), _MM256_PROD_PS(a01, h10));
+      __m256 b01 = _mm256_add_ps(_MM256_PROD_PS(a00, h01), _MM256_PROD_PS(a01, h11));
+      __m256 b10 = _mm256_add_ps(_MM256_PROD_PS(a10, h00), _MM256_PROD_PS(a11, h10));
+      __m256 b11 = _mm256_add_ps(_MM256_PROD_PS(a10, h01), _MM256_PROD_PS(a11, h11));
+#endif /* LV_HAVE_FMA */
+
+      /* 3. C = W' * H' * H * W' = B * W */
+      __m256 c00, c01, c10, c11;
+      switch (i) {
+        case 0:
+          c00 = _mm256_add_ps(b00, b01);
+          c01 = _mm256_sub_ps(b00, b01);
+          c10 = _mm256_add_ps(b10, b11);
+          c11 = _mm256_sub_ps(b10, b11);
+          break;
+        case 1:
+          c00 = _mm256_add_ps(b00, _MM256_MULJ_PS(b01));
+          c01 = _mm256_sub_ps(b00, _MM256_MULJ_PS(b01));
+          c10 = _mm256_add_ps(b10, _MM256_MULJ_PS(b11));
+          c11 = _mm256_sub_ps(b10, _MM256_MULJ_PS(b11));
+          break;
+        default:
+          return SRSLTE_ERROR;
+      }
+      c00 = _mm256_mul_ps(c00, avx_norm);
+      c01 = _mm256_mul_ps(c01, avx_norm);
+      c10 = _mm256_mul_ps(c10, avx_norm);
+      c11 = _mm256_mul_ps(c11, avx_norm);
+
+      /* 4. C += noise * I */
+      c00 = _mm256_add_ps(c00, avx_noise_estimate);
+      c11 = _mm256_add_ps(c11, avx_noise_estimate);
+
+      /* 5. detC */
+      __m256 detC = srslte_mat_2x2_det_avx(c00, c01, c10, c11);
+      __m256 inv_detC = srslte_mat_cf_recip_avx(detC);
+      inv_detC = _mm256_mul_ps(avx_noise_estimate, inv_detC);
+
+      __m256 den0 = _MM256_PROD_PS(c00, inv_detC);
+      __m256 den1 = _MM256_PROD_PS(c11, inv_detC);
+
+      __m256 gamma0 = _mm256_sub_ps(_mm256_rcp_ps(den0), avx_ones);
+      __m256 gamma1 = _mm256_sub_ps(_mm256_rcp_ps(den1), avx_ones);
+
+      /* Add for averaging */
+      __m256 sinr_avx = _mm256_permute_ps(_mm256_add_ps(gamma0, gamma1), 0b00101000);
+      __attribute__((aligned(256))) float sinr[8];
+      _mm256_store_ps(sinr, sinr_avx);
+
+      sinr_list[i] += sinr[0] + sinr[2] + sinr[4] + sinr[6];
+
+      count += 4;
+    }
+
+    /* Divide average by noise */
+    if (count) {
+      sinr_list[i] /= count;
+    }
+
+    if (sinr_list[i] > max_sinr) {
+      max_sinr = sinr_list[i];
+      *pmi = i;
+    }
+  }
+
+  return i;
+}
+
+#endif /* LV_HAVE_AVX */
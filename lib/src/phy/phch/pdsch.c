@@ -364,6 +364,11 @@ int srslte_pdsch_set_cell(srslte_pdsch_t *q, srslte_cell_t cell)
 int srslte_pdsch_set_rnti(srslte_pdsch_t *q, uint16_t rnti) {
   uint32_t rnti_idx = q->is_ue?0:rnti;
 
+  // Sequences are generated on first use by the shared cache
+  if (q->seq_cache && !q->is_ue) {
+    return SRSLTE_SUCCESS;
+  }
+
   if (!q->users[rnti_idx] || q->is_ue) {
     if (!q->users[rnti_idx]) {
       q->users[rnti_idx] = calloc(1, sizeof(srslte_pdsch_user_t));
@@ -392,6 +397,15 @@ int srslte_pdsch_set_rnti(srslte_pdsch_t *q, uint16_t rnti) {
   return SRSLTE_SUCCESS;
 }
 
+/* Uses a sequence cache shared with other PDSCH objects of the same cell instead of 
+ * pregenerating the sequences for every RNTI in srslte_pdsch_set_rnti(). eNodeB only. 
+ */
+void srslte_pdsch_set_sequence_cache(srslte_pdsch_t *q, srslte_sequence_cache_t *cache) {
+  if (q && !q->is_ue) {
+    q->seq_cache = cache;
+  }
+}
+
 void srslte_pdsch_set_power_allocation(srslte_pdsch_t *q, float rho_a) {
   if (q) {
     q->rho_a = rho_a;
@@ -417,6 +431,9 @@ int srslte_pdsch_enable_csi(srslte_pdsch_t *q, bool enable) {
 void srslte_pdsch_free_rnti(srslte_pdsch_t* q, uint16_t rnti)
 {
   uint32_t rnti_idx = q->is_ue?0:rnti;
+  if (q->seq_cache && !q->is_ue) {
+    srslte_sequence_cache_free_rnti(q->seq_cache, rnti);
+  }
   if (q->users[rnti_idx]) {
     for (int i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
       for (int j = 0; j < SRSLTE_MAX_CODEWORDS; j++) {
@@ -557,6 +574,14 @@ static srslte_sequence_t *get_user_sequence(srslte_pdsch_t *q, uint16_t rnti,
 {
   uint32_t rnti_idx = q->is_ue?0:rnti;
 
+  if (q->seq_cache && q->seq_cache->cell_id == q->cell.id && !q->is_ue) {
+    srslte_sequence_t *seq = srslte_sequence_cache_get(q->seq_cache, SRSLTE_SEQUENCE_CACHE_PDSCH, rnti,
+                                                       codeword_idx, sf_idx, len);
+    if (seq) {
+      return seq;
+    }
+  }
+
   // The scrambling sequence is pregenerated for all RNTIs in the eNodeB but only for C-RNTI in the UE
   if (q->users[rnti_idx] && q->users[rnti_idx]->sequence_generated &&
       q->users[rnti_idx]->cell_id == q->cell.id                    &&
@@ -570,6 +595,13 @@ static srslte_sequence_t *get_user_sequence(srslte_pdsch_t *q, uint16_t rnti,
   }
 }
 
+static void put_user_sequence(srslte_pdsch_t *q, srslte_sequence_t *seq)
+{
+  if (q->seq_cache && !q->is_ue && seq != &q->tmp_seq) {
+    srslte_sequence_cache_put(q->seq_cache, seq);
+  }
+}
+
 static int srslte_pdsch_codeword_encode(srslte_pdsch_t *q, srslte_pdsch_cfg_t *cfg,
                                                srslte_softbuffer_tx_t *softbuffer, uint16_t rnti, uint8_t *data,
                                                uint32_t codeword_idx, uint32_t tb_idx) {
@@ -599,6 +631,7 @@ static int srslte_pdsch_codeword_encode(srslte_pdsch_t *q, srslte_pdsch_cfg_t *c
 
     /* Bit scrambling */
     srslte_scrambling_bytes(seq, (uint8_t *) q->e[codeword_idx], nbits->nof_bits);
+    put_user_sequence(q, seq);
 
     /* Bit mapping */
     srslte_mod_modulate_bytes(&q->mod[mcs->mod],
@@ -636,6 +669,7 @@ static int srslte_pdsch_codeword_decode(srslte_pdsch_t *q, srslte_pdsch_cfg_t *c
 
     /* Bit scrambling */
     srslte_scrambling_s_offset(seq, q->e[codeword_idx], 0, nbits->nof_bits);
+    put_user_sequence(q, seq);
 
     uint32_t qm = nbits->nof_bits/nbits->nof_re;
     switch(cfg->grant.mcs[tb_idx].mod) {
@@ -928,6 +962,10 @@ void srslte_pdsch_set_max_noi(srslte_pdsch_t *q, uint32_t max_iter) {
   srslte_sch_set_max_noi(&q->dl_sch, max_iter);
 }
 
+void srslte_pdsch_set_fec_pool(srslte_pdsch_t *q, srslte_fec_pool_t *pool) {
+  srslte_sch_set_fec_pool(&q->dl_sch, pool);
+}
+
 float srslte_pdsch_last_noi(srslte_pdsch_t *q) {
   return srslte_pdsch_last_noi_cw(q, 0);
 }
@@ -64,6 +64,9 @@ uint32_t prach_Ncs_unrestricted[16] = {0, 13, 15, 18, 22, 26, 32, 38, 46, 59, 76
 
 #define MAX_N_zc 839
 
+// Correlation rows are padded to a multiple of 8 samples so that all of them are aligned alike
+#define CORR_STRIDE(N_zc) ((((N_zc) + 7) / 8) * 8)
+
 // Table 5.7.2-2 - N_cs values for restricted sets
 uint32_t prach_Ncs_restricted[15] = {15, 18, 22, 26, 32, 38, 46, 55, 68, 82, 100, 128, 158, 202, 237};
 
@@ -327,6 +330,55 @@ int srslte_prach_gen_seqs(srslte_prach_t *p) {
   return 0;
 }
 
+/* Roots are split in nof_groups groups of consecutive roots whose sizes differ at most by one */
+static void prach_group_roots(srslte_prach_t *p, uint32_t group, uint32_t *first_root, uint32_t *nof_roots) {
+  uint32_t q = p->N_roots / p->nof_groups;
+  uint32_t r = p->N_roots % p->nof_groups;
+  *first_root = group * q + SRSLTE_MIN(group, r);
+  *nof_roots  = q + (group < r ? 1 : 0);
+}
+
+/* One group for the calling thread and one for each thread of the FEC pool. The IFFT of each group
+ * runs in place over its rows of corr_spec. Plans of groups of the same size share the FFTW plan. */
+static int prach_plan_groups(srslte_prach_t *p) {
+  uint32_t nof_groups = 0;
+  if (p->N_roots) {
+    nof_groups = 1;
+    if (p->fec_pool) {
+      nof_groups = SRSLTE_MIN(p->N_roots, srslte_fec_pool_nof_workers(p->fec_pool) + 1);
+    }
+  }
+
+  for (uint32_t g = nof_groups; g < p->nof_groups; g++) {
+    srslte_dft_plan_free(&p->zc_ifft_group[g]);
+  }
+  p->nof_groups = nof_groups;
+
+  for (uint32_t g = 0; g < nof_groups; g++) {
+    uint32_t first_root, nof_roots;
+    prach_group_roots(p, g, &first_root, &nof_roots);
+
+    cf_t *rows = &p->corr_spec[first_root * p->corr_stride];
+    int ret;
+    if (p->zc_ifft_group[g].size) {
+      ret = srslte_dft_replan_guru_c(&p->zc_ifft_group[g], p->N_zc, rows, rows,
+                                     1, 1, nof_roots, p->corr_stride, p->corr_stride);
+    } else {
+      ret = srslte_dft_plan_guru_c(&p->zc_ifft_group[g], p->N_zc, SRSLTE_DFT_BACKWARD, rows, rows,
+                                   1, 1, nof_roots, p->corr_stride, p->corr_stride);
+    }
+    if (ret) {
+      return SRSLTE_ERROR;
+    }
+  }
+  return SRSLTE_SUCCESS;
+}
+
+int srslte_prach_set_fec_pool(srslte_prach_t *p, srslte_fec_pool_t *pool) {
+  p->fec_pool = pool;
+  return prach_plan_groups(p);
+}
+
 int srslte_prach_init_cfg(srslte_prach_t *p, srslte_prach_cfg_t *cfg, uint32_t nof_prb) {
   if (srslte_prach_init(p, srslte_symbol_sz(nof_prb))) {
     return -1;
@@ -349,8 +401,12 @@ int srslte_prach_init(srslte_prach_t *p, uint32_t max_N_ifft_ul) {
 
     // Set up containers
     p->prach_bins = srslte_vec_malloc(sizeof(cf_t) * MAX_N_zc);
-    p->corr_spec = srslte_vec_malloc(sizeof(cf_t) * MAX_N_zc);
-    p->corr = srslte_vec_malloc(sizeof(float) * MAX_N_zc);
+    p->corr_spec = srslte_vec_malloc(sizeof(cf_t) * N_SEQS * CORR_STRIDE(MAX_N_zc));
+    p->corr = srslte_vec_malloc(sizeof(float) * N_SEQS * CORR_STRIDE(MAX_N_zc));
+    if (!p->prach_bins || !p->corr_spec || !p->corr) {
+      fprintf(stderr, "Error allocating memory\n");
+      return SRSLTE_ERROR;
+    }
 
     // Set up ZC FFTS
     if (srslte_dft_plan(&p->zc_fft, MAX_N_zc, SRSLTE_DFT_FORWARD, SRSLTE_DFT_COMPLEX)) {
@@ -359,12 +415,6 @@ int srslte_prach_init(srslte_prach_t *p, uint32_t max_N_ifft_ul) {
     srslte_dft_plan_set_mirror(&p->zc_fft, false);
     srslte_dft_plan_set_norm(&p->zc_fft, true);
 
-    if (srslte_dft_plan(&p->zc_ifft, MAX_N_zc, SRSLTE_DFT_BACKWARD, SRSLTE_DFT_COMPLEX)) {
-      return SRSLTE_ERROR;
-    }
-    srslte_dft_plan_set_mirror(&p->zc_ifft, false);
-    srslte_dft_plan_set_norm(&p->zc_ifft, false);
-
     uint32_t fft_size_alloc = max_N_ifft_ul * DELTA_F / DELTA_F_RA;
 
     p->ifft_in = (cf_t *) srslte_vec_malloc(fft_size_alloc * sizeof(cf_t));
@@ -456,15 +506,18 @@ int srslte_prach_set_cell(srslte_prach_t *p,
       if (srslte_dft_replan(&p->zc_fft, p->N_zc)) {
         return SRSLTE_ERROR;
       }
-      if (srslte_dft_replan(&p->zc_ifft, p->N_zc)) {
-        return SRSLTE_ERROR;
-      }
     }
 
     // Generate our 64 sequences
     p->N_roots = 0;
     srslte_prach_gen_seqs(p);
 
+    p->corr_stride = CORR_STRIDE(p->N_zc);
+    if (prach_plan_groups(p)) {
+      fprintf(stderr, "Error creating DFT plan\n");
+      return SRSLTE_ERROR;
+    }
+
     // Generate sequence FFTs
     for (int i = 0; i < N_SEQS; i++) {
       srslte_dft_run(&p->zc_fft, p->seqs[i], p->dft_seqs[i]);
@@ -566,6 +619,66 @@ int srslte_prach_detect(srslte_prach_t *p,
   return srslte_prach_detect_offset(p, freq_offset, signal, sig_len, indices, NULL, NULL, n_indices);
 }
 
+typedef struct {
+  srslte_prach_t *p;
+  uint32_t next_group;
+} prach_detect_args_t;
+
+/* Correlates the received bins with the roots of a group with a single batched IFFT, then finds
+ * the peak of every cyclic shift window of each root */
+static void prach_correlate_group(srslte_prach_t *p, uint32_t group) {
+  uint32_t first_root, nof_roots;
+  prach_group_roots(p, group, &first_root, &nof_roots);
+
+  for (uint32_t i = first_root; i < first_root + nof_roots; i++) {
+    cf_t *root_spec = p->dft_seqs[p->root_seqs_idx[i]];
+    srslte_vec_prod_conj_ccc(p->prach_bins, root_spec, &p->corr_spec[i * p->corr_stride], p->N_zc);
+  }
+
+  srslte_dft_run_guru_c(&p->zc_ifft_group[group]);
+
+  uint32_t winsize = 0;
+  if (p->N_cs != 0) {
+    winsize = p->N_cs;
+  } else {
+    winsize = p->N_zc;
+  }
+  uint32_t n_wins = p->N_zc / winsize;
+
+  for (uint32_t i = first_root; i < first_root + nof_roots; i++) {
+    float *corr = &p->corr[i * p->corr_stride];
+
+    srslte_vec_abs_square_cf(&p->corr_spec[i * p->corr_stride], corr, p->N_zc);
+
+    p->corr_ave[i] = srslte_vec_acc_ff(corr, p->N_zc) / p->N_zc;
+
+    for (int j = 0; j < n_wins; j++) {
+      uint32_t start = (p->N_zc - (j * p->N_cs)) % p->N_zc;
+      uint32_t end = start + winsize;
+      if (end > p->deadzone) {
+        end -= p->deadzone;
+      }
+      start += p->deadzone;
+      uint32_t k = srslte_vec_max_fi(&corr[start], end - start);
+      p->peak_values[i][j]  = corr[start + k];
+      p->peak_offsets[i][j] = k;
+    }
+  }
+}
+
+/* Claims groups of roots until all have been correlated. Runs both in the calling thread and in
+ * the threads of the FEC pool. */
+static void prach_correlate_groups(prach_detect_args_t *a) {
+  uint32_t group;
+  while ((group = __sync_fetch_and_add(&a->next_group, 1)) < a->p->nof_groups) {
+    prach_correlate_group(a->p, group);
+  }
+}
+
+static void prach_correlate_task(void *arg, srslte_fec_ctx_t *ctx) {
+  prach_correlate_groups((prach_detect_args_t*) arg);
+}
+
 int srslte_prach_detect_offset(srslte_prach_t *p,
                                uint32_t freq_offset,
                                cf_t *signal,
@@ -598,57 +711,47 @@ int srslte_prach_detect_offset(srslte_prach_t *p,
 
     memcpy(p->prach_bins, &p->signal_fft[begin], p->N_zc * sizeof(cf_t));
 
-    for (int i = 0; i < p->N_roots; i++) {
-      cf_t *root_spec = p->dft_seqs[p->root_seqs_idx[i]];
-
-      srslte_vec_prod_conj_ccc(p->prach_bins, root_spec, p->corr_spec, p->N_zc);
-
-      srslte_dft_run(&p->zc_ifft, p->corr_spec, p->corr_spec);
-
-      srslte_vec_abs_square_cf(p->corr_spec, p->corr, p->N_zc);
-
-      float corr_ave = srslte_vec_acc_ff(p->corr, p->N_zc) / p->N_zc;
-
-      uint32_t winsize = 0;
-      if (p->N_cs != 0) {
-        winsize = p->N_cs;
-      } else {
-        winsize = p->N_zc;
+    // Correlate with all the roots, spread by groups across the FEC pool
+    prach_detect_args_t a;
+    a.p          = p;
+    a.next_group = 0;
+    if (p->fec_pool && p->nof_groups > 1) {
+      srslte_fec_batch_t batch;
+      srslte_fec_pool_batch_init(&batch);
+      for (uint32_t g = 1; g < p->nof_groups; g++) {
+        if (srslte_fec_pool_submit(p->fec_pool, &batch, prach_correlate_task, &a)) {
+          break;
+        }
       }
-      uint32_t n_wins = p->N_zc / winsize;
+      prach_correlate_groups(&a);
+      srslte_fec_pool_wait(p->fec_pool, &batch);
+    } else {
+      prach_correlate_groups(&a);
+    }
+
+    uint32_t n_wins = p->N_zc / (p->N_cs ? p->N_cs : p->N_zc);
+    for (int i = 0; i < p->N_roots; i++) {
+      float corr_ave = p->corr_ave[i];
 
       float max_peak = 0;
       for (int j = 0; j < n_wins; j++) {
-        uint32_t start = (p->N_zc - (j * p->N_cs)) % p->N_zc;
-        uint32_t end = start + winsize;
-        if (end > p->deadzone) {
-          end -= p->deadzone;
-        }
-        start += p->deadzone;
-        p->peak_values[j] = 0;
-        for (int k = start; k < end; k++) {
-          if (p->corr[k] > p->peak_values[j]) {
-            p->peak_values[j] = p->corr[k];
-            p->peak_offsets[j] = k - start;
-            if (p->peak_values[j] > max_peak) {
-              max_peak = p->peak_values[j];
-            }
-          }
+        if (p->peak_values[i][j] > max_peak) {
+          max_peak = p->peak_values[i][j];
         }
       }
       if (max_peak > p->detect_factor * corr_ave) {
         for (int j = 0; j < n_wins; j++) {
-          if (p->peak_values[j] > p->detect_factor * corr_ave) {
+          if (p->peak_values[i][j] > p->detect_factor * corr_ave) {
             //printf("saving prach correlation\n");
             //memcpy(save_corr, p->corr, p->N_zc*sizeof(float));
             if (indices) {
               indices[*n_indices] = (i * n_wins) + j;
             }
             if (peak_to_avg) {
-              peak_to_avg[*n_indices] = p->peak_values[j] / corr_ave;
+              peak_to_avg[*n_indices] = p->peak_values[i][j] / corr_ave;
             }
             if (t_offsets) {
-              t_offsets[*n_indices] = (float) p->peak_offsets[j] * p->T_seq / p->N_zc;
+              t_offsets[*n_indices] = (float) p->peak_offsets[i][j] * p->T_seq / p->N_zc;
             }
             (*n_indices)++;
           }
@@ -670,7 +773,9 @@ int srslte_prach_free(srslte_prach_t *p) {
   free(p->ifft_out);
   srslte_dft_plan_free(&p->fft);
   srslte_dft_plan_free(&p->zc_fft);
-  srslte_dft_plan_free(&p->zc_ifft);
+  for (uint32_t g = 0; g < p->nof_groups; g++) {
+    srslte_dft_plan_free(&p->zc_ifft_group[g]);
+  }
 
   if (p->signal_fft) {
     free(p->signal_fft);
@@ -497,6 +497,9 @@ int srslte_pucch_set_cell(srslte_pucch_t *q, srslte_cell_t cell) {
 
 
 void srslte_pucch_clear_rnti(srslte_pucch_t *q, uint16_t rnti) {
+  if (q->seq_cache) {
+    srslte_sequence_cache_free_rnti(q->seq_cache, rnti);
+  }
   if (q->users[rnti]) {
     for (int i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
       srslte_sequence_free(&q->users[rnti]->seq_f2[i]);
@@ -507,6 +510,10 @@ void srslte_pucch_clear_rnti(srslte_pucch_t *q, uint16_t rnti) {
 }
 
 int srslte_pucch_set_crnti(srslte_pucch_t *q, uint16_t rnti) {
+  // Sequences are generated on first use by the shared cache
+  if (q->seq_cache) {
+    return SRSLTE_SUCCESS;
+  }
   if (!q->users[rnti]) {
     q->users[rnti] = calloc(1, sizeof(srslte_pucch_user_t));
     if (q->users[rnti]) {
@@ -524,6 +531,35 @@ int srslte_pucch_set_crnti(srslte_pucch_t *q, uint16_t rnti) {
   return SRSLTE_SUCCESS; 
 }
 
+/* Uses a sequence cache shared with other PUCCH objects of the same cell instead of 
+ * pregenerating the format 2 sequences in srslte_pucch_set_crnti(). eNodeB only. 
+ */
+void srslte_pucch_set_sequence_cache(srslte_pucch_t *q, srslte_sequence_cache_t *cache) {
+  q->seq_cache = cache;
+}
+
+static srslte_sequence_t *get_f2_sequence(srslte_pucch_t *q, uint32_t sf_idx, uint16_t rnti)
+{
+  if (q->seq_cache && q->seq_cache->cell_id == q->cell.id) {
+    srslte_sequence_t *seq = srslte_sequence_cache_get(q->seq_cache, SRSLTE_SEQUENCE_CACHE_PUCCH, rnti, 
+                                                       0, sf_idx, SRSLTE_PUCCH2_NOF_BITS);
+    if (seq) {
+      return seq;
+    }
+  }
+  if (q->users[rnti] && q->users[rnti]->sequence_generated) {
+    return &q->users[rnti]->seq_f2[sf_idx];
+  }
+  return NULL;
+}
+
+static void put_f2_sequence(srslte_pucch_t *q, uint32_t sf_idx, uint16_t rnti, srslte_sequence_t *seq)
+{
+  if (q->seq_cache && !(q->users[rnti] && seq == &q->users[rnti]->seq_f2[sf_idx])) {
+    srslte_sequence_cache_put(q->seq_cache, seq);
+  }
+}
+
 bool srslte_pucch_set_cfg(srslte_pucch_t *q, srslte_pucch_cfg_t *cfg, bool group_hopping_en)
 {
   q->group_hopping_en = group_hopping_en; 
@@ -596,6 +632,7 @@ int srslte_pucch_format2ab_mod_bits(srslte_pucch_format_t format, uint8_t bits[2
 static int uci_mod_bits(srslte_pucch_t *q, srslte_pucch_format_t format, uint8_t bits[SRSLTE_PUCCH_MAX_BITS], uint32_t sf_idx, uint16_t rnti)
 {  
   uint8_t tmp[2];
+  srslte_sequence_t *seq;
   
   switch(format) {
     case SRSLTE_PUCCH_FORMAT_1:
@@ -612,9 +649,11 @@ static int uci_mod_bits(srslte_pucch_t *q, srslte_pucch_format_t format, uint8_t
     case SRSLTE_PUCCH_FORMAT_2:
     case SRSLTE_PUCCH_FORMAT_2A:
     case SRSLTE_PUCCH_FORMAT_2B:
-      if (q->users[rnti] && q->users[rnti]->sequence_generated) {
+      seq = get_f2_sequence(q, sf_idx, rnti);
+      if (seq) {
         memcpy(q->bits_scram, bits, SRSLTE_PUCCH2_NOF_BITS*sizeof(uint8_t));
-        srslte_scrambling_b(&q->users[rnti]->seq_f2[sf_idx], q->bits_scram);
+        srslte_scrambling_b(seq, q->bits_scram);
+        put_f2_sequence(q, sf_idx, rnti, seq);
         srslte_mod_modulate(&q->mod, q->bits_scram, q->d, SRSLTE_PUCCH2_NOF_BITS);
       } else {
         fprintf(stderr, "Error modulating PUCCH2 bits: rnti not set\n");
@@ -760,6 +799,7 @@ int srslte_pucch_decode(srslte_pucch_t* q, srslte_pucch_format_t format,
     ret = SRSLTE_ERROR; 
     cf_t ref[SRSLTE_PUCCH_MAX_SYMBOLS]; 
     int16_t llr_pucch2[32];
+    srslte_sequence_t *seq;
     
     // Shortened PUCCH happen in every cell-specific SRS subframes for Format 1/1a/1b
     if (q->pucch_cfg.srs_configured && format < SRSLTE_PUCCH_FORMAT_2) {
@@ -851,7 +891,8 @@ int srslte_pucch_decode(srslte_pucch_t* q, srslte_pucch_format_t format,
       case SRSLTE_PUCCH_FORMAT_2:
       case SRSLTE_PUCCH_FORMAT_2A:
       case SRSLTE_PUCCH_FORMAT_2B:
-        if (q->users[rnti] && q->users[rnti]->sequence_generated) {
+        seq = get_f2_sequence(q, sf_idx, rnti);
+        if (seq) {
           pucch_encode_(q, format, n_pucch, sf_idx, rnti, NULL, ref, true);
           srslte_vec_prod_conj_ccc(q->z, ref, q->z_tmp, SRSLTE_PUCCH_MAX_SYMBOLS);
           for (int i=0;i<SRSLTE_PUCCH2_NOF_BITS/2;i++) {
@@ -861,7 +902,8 @@ int srslte_pucch_decode(srslte_pucch_t* q, srslte_pucch_format_t format,
             }
           }
           srslte_demod_soft_demodulate_s(SRSLTE_MOD_QPSK, q->z, llr_pucch2, SRSLTE_PUCCH2_NOF_BITS/2);
-          srslte_scrambling_s(&q->users[rnti]->seq_f2[sf_idx], llr_pucch2);  
+          srslte_scrambling_s(seq, llr_pucch2);  
+          put_f2_sequence(q, sf_idx, rnti, seq);
           q->last_corr = (float) srslte_uci_decode_cqi_pucch(&q->cqi, llr_pucch2, bits, nof_bits)/2000;
           ret = 1; 
         } else {
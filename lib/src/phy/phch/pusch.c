@@ -436,6 +436,11 @@ int srslte_pusch_set_rnti(srslte_pusch_t *q, uint16_t rnti) {
 
   uint32_t rnti_idx = q->is_ue?0:rnti;
 
+  // Sequences are generated on first use by the shared cache
+  if (q->seq_cache && !q->is_ue) {
+    return SRSLTE_SUCCESS;
+  }
+
   if (!q->users[rnti_idx] || q->is_ue) {
     if (!q->users[rnti_idx]) {
       q->users[rnti_idx] = calloc(1, sizeof(srslte_pusch_user_t));
@@ -462,10 +467,23 @@ int srslte_pusch_set_rnti(srslte_pusch_t *q, uint16_t rnti) {
   return SRSLTE_SUCCESS;
 }
 
+/* Uses a sequence cache shared with other PUSCH objects of the same cell instead of 
+ * pregenerating the sequences for every RNTI in srslte_pusch_set_rnti(). eNodeB only. 
+ */
+void srslte_pusch_set_sequence_cache(srslte_pusch_t *q, srslte_sequence_cache_t *cache) {
+  if (q && !q->is_ue) {
+    q->seq_cache = cache;
+  }
+}
+
 void srslte_pusch_free_rnti(srslte_pusch_t *q, uint16_t rnti) {
 
   uint32_t rnti_idx = q->is_ue?0:rnti;
 
+  if (q->seq_cache && !q->is_ue) {
+    srslte_sequence_cache_free_rnti(q->seq_cache, rnti);
+  }
+
   if (q->users[rnti_idx]) {
     for (int i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
       srslte_sequence_free(&q->users[rnti_idx]->seq[i]);
@@ -480,6 +498,14 @@ static srslte_sequence_t *get_user_sequence(srslte_pusch_t *q, uint16_t rnti, ui
 {
   uint32_t rnti_idx = q->is_ue?0:rnti;
 
+  if (q->seq_cache && q->seq_cache->cell_id == q->cell.id && !q->is_ue) {
+    srslte_sequence_t *seq = srslte_sequence_cache_get(q->seq_cache, SRSLTE_SEQUENCE_CACHE_PUSCH, rnti,
+                                                       0, sf_idx, len);
+    if (seq) {
+      return seq;
+    }
+  }
+
   // The scrambling sequence is pregenerated for all RNTIs in the eNodeB but only for C-RNTI in the UE
   if (q->users[rnti_idx] && q->users[rnti_idx]->sequence_generated &&
       q->users[rnti_idx]->cell_id == q->cell.id                    &&
@@ -493,6 +519,13 @@ static srslte_sequence_t *get_user_sequence(srslte_pusch_t *q, uint16_t rnti, ui
   }
 }
 
+static void put_user_sequence(srslte_pusch_t *q, srslte_sequence_t *seq)
+{
+  if (q->seq_cache && !q->is_ue && seq != &q->tmp_seq) {
+    srslte_sequence_cache_put(q->seq_cache, seq);
+  }
+}
+
 /** Converts the PUSCH data bits to symbols mapped to the slot ready for transmission
  */
 int srslte_pusch_encode(srslte_pusch_t *q, srslte_pusch_cfg_t *cfg, srslte_softbuffer_tx_t *softbuffer,
@@ -526,6 +559,7 @@ int srslte_pusch_encode(srslte_pusch_t *q, srslte_pusch_cfg_t *cfg, srslte_softb
 
     // Run scrambling
     srslte_scrambling_bytes(seq, (uint8_t*) q->q, cfg->nbits.nof_bits);
+    put_user_sequence(q, seq);
 
     // Correct UCI placeholder/repetition bits
     uint8_t *d = q->q; 
@@ -619,6 +653,7 @@ int srslte_pusch_decode(srslte_pusch_t *q,
     // Decode RI/HARQ bits before descrambling
     if (srslte_ulsch_uci_decode_ri_ack(&q->ul_sch, cfg, softbuffer, q->q, seq->c, uci_data)) {
       fprintf(stderr, "Error decoding RI/HARQ bits\n");
+      put_user_sequence(q, seq);
       return SRSLTE_ERROR; 
     }
 
@@ -632,6 +667,7 @@ int srslte_pusch_decode(srslte_pusch_t *q,
     
     // Descrambling
     srslte_scrambling_s_offset(seq, q->q, 0, cfg->nbits.nof_bits);
+    put_user_sequence(q, seq);
 
     // Decode
     ret = srslte_ulsch_uci_decode(&q->ul_sch, cfg, softbuffer, q->q, q->g, data, uci_data);
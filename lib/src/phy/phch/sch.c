@@ -172,6 +172,13 @@ void srslte_sch_set_max_noi(srslte_sch_t *q, uint32_t max_iterations) {
   q->max_iterations = max_iterations;
 }
 
+/* Decode the code blocks of a transport block in the threads of the pool, in addition to the
+ * calling thread. Set to NULL to decode in the calling thread only.
+ */
+void srslte_sch_set_fec_pool(srslte_sch_t *q, srslte_fec_pool_t *pool) {
+  q->fec_pool = pool;
+}
+
 uint32_t srslte_sch_last_noi(srslte_sch_t *q) {
   return q->nof_iterations;
 }
@@ -304,34 +311,49 @@ static int encode_tb(srslte_sch_t *q,
   return encode_tb_off(q, soft_buffer, cb_segm, Qm, rv, nof_e_bits, data, e_bits, 0);
 }
 
-bool decode_tb_cb(srslte_sch_t *q, 
-                     srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm, 
-                     uint32_t Qm, uint32_t rv, uint32_t nof_e_bits, 
-                     int16_t *e_bits, uint8_t *data,
-                     uint32_t cb_size_group) 
+/* Parameters of the code blocks decoded by decode_cb_range(). Code blocks are handed out in chunks
+ * of srslte_tdec_get_nof_parallel() blocks to the calling thread and to the threads of the FEC pool.
+ */
+typedef struct {
+  srslte_softbuffer_rx_t *softbuffer;
+  srslte_cbsegm_t        *cb_segm;
+  int16_t                *e_bits;
+  uint32_t                Qm;
+  uint32_t                rv;
+  uint32_t                n_e;
+  uint32_t                gamma;
+  uint32_t                cb_len;
+  uint32_t                cb_len_idx;
+  uint32_t                rlen;
+  uint32_t                max_iterations;
+  uint32_t                first_cb;
+  uint32_t                nof_cb;
+  uint32_t                chunk_len;
+
+  /* Shared between the threads decoding the group */
+  uint32_t                next_chunk;
+  uint32_t                nof_iterations;
+  int                     ret;
+} decode_cb_args_t;
+
+/* Decodes the code blocks first_cb...first_cb+nof_cb-1 with the given decoder. Each code block is
+ * decoded until its CRC is correct or the maximum number of iterations is reached. Returns the sum
+ * of iterations of all the code blocks or a negative value if rate matching failed.
+ */
+static int decode_cb_range(decode_cb_args_t *a, srslte_tdec_t *decoder, srslte_crc_t *crc_tb,
+                           srslte_crc_t *crc_cb, uint8_t *cb_in, uint32_t first_cb, uint32_t nof_cb)
 {
-
   bool cb_map[SRSLTE_MAX_CODEBLOCKS];
-    
+
   uint32_t cb_idx[SRSLTE_TDEC_MAX_NPAR];
   int16_t *decoder_input[SRSLTE_TDEC_MAX_NPAR];
-  
-  uint32_t nof_cb     = cb_size_group?cb_segm->C2:cb_segm->C1;
-  uint32_t first_cb   = cb_size_group?cb_segm->C1:0;
-  uint32_t cb_len     = cb_size_group?cb_segm->K2:cb_segm->K1;
-  uint32_t cb_len_idx = cb_size_group?cb_segm->K2_idx:cb_segm->K1_idx;
 
-  uint32_t rlen       = cb_segm->C==1?cb_len:(cb_len-24);
-  uint32_t Gp         = nof_e_bits / Qm;
-  uint32_t gamma      = cb_segm->C>0?Gp%cb_segm->C:Gp;
-  uint32_t n_e        = Qm * (Gp/cb_segm->C);
-  
-  if (nof_cb > SRSLTE_MAX_CODEBLOCKS) {
-    fprintf(stderr, "Error SRSLTE_MAX_CODEBLOCKS=%d\n", SRSLTE_MAX_CODEBLOCKS);
-    return false; 
-  }
-  
-  for (int i=0;i<srslte_tdec_get_nof_parallel(&q->decoder);i++) {
+  srslte_softbuffer_rx_t *softbuffer = a->softbuffer;
+  srslte_cbsegm_t        *cb_segm    = a->cb_segm;
+  uint32_t                cb_len     = a->cb_len;
+  uint32_t                nof_iterations = 0;
+
+  for (int i=0;i<srslte_tdec_get_nof_parallel(decoder);i++) {
     cb_idx[i]        = i+first_cb; 
     decoder_input[i] = NULL;
   }
@@ -339,20 +361,18 @@ bool decode_tb_cb(srslte_sch_t *q,
   uint32_t remaining_cb = 0;
   for (int i=0;i<nof_cb;i++) {
     /* Do not process blocks with CRC Ok */
-    cb_map[i] = softbuffer->cb_crc[i];
-    if (softbuffer->cb_crc[i] == false) {
+    cb_map[first_cb+i] = softbuffer->cb_crc[first_cb+i];
+    if (softbuffer->cb_crc[first_cb+i] == false) {
       remaining_cb ++;
     }
   }
     
-  srslte_tdec_reset(&q->decoder, cb_len);
+  srslte_tdec_reset(decoder, cb_len);
   
-  q->nof_iterations = 0;
-
   while(remaining_cb>0) {
         
     // Unratematch the codeblocks left to decode 
-    for (int i=0;i<srslte_tdec_get_nof_parallel(&q->decoder);i++) {
+    for (int i=0;i<srslte_tdec_get_nof_parallel(decoder);i++) {
       
       if (!decoder_input[i] && remaining_cb > 0) {        
         // Find an unprocessed CB 
@@ -363,16 +383,16 @@ bool decode_tb_cb(srslte_sch_t *q,
         if (cb_map[cb_idx[i]] == false) {
           cb_map[cb_idx[i]] = true; 
           
-          uint32_t rp   = cb_idx[i]*n_e;  
-          uint32_t n_e2 = n_e;
+          uint32_t rp   = cb_idx[i]*a->n_e;  
+          uint32_t n_e2 = a->n_e;
           
-          if (cb_idx[i] > cb_segm->C - gamma) {
-            n_e2 = n_e+Qm;
-            rp   = (cb_segm->C - gamma)*n_e + (cb_idx[i]-(cb_segm->C - gamma))*n_e2;
+          if (cb_idx[i] > cb_segm->C - a->gamma) {
+            n_e2 = a->n_e+a->Qm;
+            rp   = (cb_segm->C - a->gamma)*a->n_e + (cb_idx[i]-(cb_segm->C - a->gamma))*n_e2;
           }
 
           INFO("CB %d: rp=%d, n_e=%d, i=%d\n", cb_idx[i], rp, n_e2, i);
-          if (srslte_rm_turbo_rx_lut(&e_bits[rp], softbuffer->buffer_f[cb_idx[i]], n_e2, cb_len_idx, rv)) {
+          if (srslte_rm_turbo_rx_lut(&a->e_bits[rp], softbuffer->buffer_f[cb_idx[i]], n_e2, a->cb_len_idx, a->rv)) {
             fprintf(stderr, "Error in rate matching\n");
             return SRSLTE_ERROR;
           }
@@ -383,46 +403,46 @@ bool decode_tb_cb(srslte_sch_t *q,
     }
         
     // Run 1 iteration for the codeblocks in queue
-    srslte_tdec_iteration_par(&q->decoder, decoder_input, cb_len);
+    srslte_tdec_iteration_par(decoder, decoder_input, cb_len);
 
     // Decide output bits and compute CRC 
-    for (int i=0;i<srslte_tdec_get_nof_parallel(&q->decoder);i++) {
+    for (int i=0;i<srslte_tdec_get_nof_parallel(decoder);i++) {
       if (decoder_input[i]) {        
-        srslte_tdec_decision_byte_par_cb(&q->decoder, q->cb_in, i, cb_len);
+        srslte_tdec_decision_byte_par_cb(decoder, cb_in, i, cb_len);
 
         uint32_t len_crc; 
         srslte_crc_t *crc_ptr; 
         
         if (cb_segm->C > 1) {
           len_crc = cb_len; 
-          crc_ptr = &q->crc_cb; 
+          crc_ptr = crc_cb; 
         } else {
           len_crc = cb_segm->tbs+24; 
-          crc_ptr = &q->crc_tb; 
+          crc_ptr = crc_tb; 
         }
 
         // CRC is OK
-        if (!srslte_crc_checksum_byte(crc_ptr, q->cb_in, len_crc)) {
+        if (!srslte_crc_checksum_byte(crc_ptr, cb_in, len_crc)) {
 
-          memcpy(softbuffer->data[cb_idx[i]], q->cb_in, rlen/8 * sizeof(uint8_t));
+          memcpy(softbuffer->data[cb_idx[i]], cb_in, a->rlen/8 * sizeof(uint8_t));
           softbuffer->cb_crc[cb_idx[i]] = true;
 
-          q->nof_iterations += srslte_tdec_get_nof_iterations_cb(&q->decoder, i);
+          nof_iterations += srslte_tdec_get_nof_iterations_cb(decoder, i);
 
           // Reset number of iterations for that CB in the decoder 
-          srslte_tdec_reset_cb(&q->decoder, i);
+          srslte_tdec_reset_cb(decoder, i);
           remaining_cb--;        
           decoder_input[i] = NULL; 
           cb_idx[i] = 0; 
 
         // CRC is error and exceeded maximum iterations for this CB.
         // Early stop the whole transport block.
-        } else if (srslte_tdec_get_nof_iterations_cb(&q->decoder, i) >= q->max_iterations) {
+        } else if (srslte_tdec_get_nof_iterations_cb(decoder, i) >= a->max_iterations) {
           INFO("CB %d: Error. CB is erroneous. remaining_cb=%d, i=%d, first_cb=%d, nof_cb=%d\n", 
                 cb_idx[i], remaining_cb, i, first_cb, nof_cb);
 
-          q->nof_iterations += q->max_iterations;
-          srslte_tdec_reset_cb(&q->decoder, i);
+          nof_iterations += a->max_iterations;
+          srslte_tdec_reset_cb(decoder, i);
           remaining_cb--;
           decoder_input[i] = NULL;
           cb_idx[i] = 0;
@@ -431,18 +451,114 @@ bool decode_tb_cb(srslte_sch_t *q,
     }    
   }
 
+  return nof_iterations;
+}
+
+/* Claims chunks of code blocks until all the code blocks of the group have been decoded. Runs both
+ * in the calling thread and in the threads of the FEC pool.
+ */
+static void decode_cb_chunks(decode_cb_args_t *a, srslte_tdec_t *decoder, srslte_crc_t *crc_tb,
+                             srslte_crc_t *crc_cb, uint8_t *cb_in)
+{
+  uint32_t chunk;
+  while ((chunk = __sync_fetch_and_add(&a->next_chunk, 1)) * a->chunk_len < a->nof_cb) {
+    uint32_t first_cb = a->first_cb + chunk * a->chunk_len;
+    uint32_t nof_cb   = SRSLTE_MIN(a->chunk_len, a->first_cb + a->nof_cb - first_cb);
+
+    int n = decode_cb_range(a, decoder, crc_tb, crc_cb, cb_in, first_cb, nof_cb);
+    if (n < 0) {
+      a->ret = SRSLTE_ERROR;
+    } else {
+      __sync_fetch_and_add(&a->nof_iterations, (uint32_t) n);
+    }
+  }
+}
+
+static void decode_cb_task(void *arg, srslte_fec_ctx_t *ctx)
+{
+  decode_cb_chunks((decode_cb_args_t*) arg, &ctx->decoder, &ctx->crc_tb, &ctx->crc_cb, ctx->cb_in);
+}
+
+bool decode_tb_cb(srslte_sch_t *q, 
+                     srslte_softbuffer_rx_t *softbuffer, srslte_cbsegm_t *cb_segm, 
+                     uint32_t Qm, uint32_t rv, uint32_t nof_e_bits, 
+                     int16_t *e_bits, uint8_t *data,
+                     uint32_t cb_size_group) 
+{
+  decode_cb_args_t a;
+
+  uint32_t nof_cb     = cb_size_group?cb_segm->C2:cb_segm->C1;
+  uint32_t first_cb   = cb_size_group?cb_segm->C1:0;
+  uint32_t cb_len     = cb_size_group?cb_segm->K2:cb_segm->K1;
+  uint32_t cb_len_idx = cb_size_group?cb_segm->K2_idx:cb_segm->K1_idx;
+
+  uint32_t rlen       = cb_segm->C==1?cb_len:(cb_len-24);
+  uint32_t Gp         = nof_e_bits / Qm;
+  uint32_t gamma      = cb_segm->C>0?Gp%cb_segm->C:Gp;
+  uint32_t n_e        = Qm * (Gp/cb_segm->C);
+  uint32_t wp         = cb_size_group?cb_segm->C1*(cb_segm->K1-24)/8:0;
+  
+  if (first_cb + nof_cb > SRSLTE_MAX_CODEBLOCKS) {
+    fprintf(stderr, "Error SRSLTE_MAX_CODEBLOCKS=%d\n", SRSLTE_MAX_CODEBLOCKS);
+    return false; 
+  }
+
+  a.softbuffer     = softbuffer;
+  a.cb_segm        = cb_segm;
+  a.e_bits         = e_bits;
+  a.Qm             = Qm;
+  a.rv             = rv;
+  a.n_e            = n_e;
+  a.gamma          = gamma;
+  a.cb_len         = cb_len;
+  a.cb_len_idx     = cb_len_idx;
+  a.rlen           = rlen;
+  a.max_iterations = q->max_iterations;
+  a.first_cb       = first_cb;
+  a.nof_cb         = nof_cb;
+  a.chunk_len      = nof_cb;
+  a.next_chunk     = 0;
+  a.nof_iterations = 0;
+  a.ret            = SRSLTE_SUCCESS;
+
+  uint32_t nof_par = srslte_tdec_get_nof_parallel(&q->decoder);
+
+  if (q->fec_pool && nof_cb > nof_par) {
+    // Spread chunks of nof_par code blocks across the FEC pool and decode in this thread too
+    srslte_fec_batch_t batch;
+    srslte_fec_pool_batch_init(&batch);
+
+    a.chunk_len = nof_par;
+
+    uint32_t nof_chunks  = (nof_cb + nof_par - 1) / nof_par;
+    uint32_t nof_helpers = SRSLTE_MIN(nof_chunks - 1, srslte_fec_pool_nof_workers(q->fec_pool));
+    for (uint32_t i = 0; i < nof_helpers; i++) {
+      if (srslte_fec_pool_submit(q->fec_pool, &batch, decode_cb_task, &a)) {
+        break;
+      }
+    }
+    decode_cb_chunks(&a, &q->decoder, &q->crc_tb, &q->crc_cb, q->cb_in);
+    srslte_fec_pool_wait(q->fec_pool, &batch);
+  } else {
+    decode_cb_chunks(&a, &q->decoder, &q->crc_tb, &q->crc_cb, q->cb_in);
+  }
+
+  if (a.ret) {
+    return false;
+  }
+
   softbuffer->tb_crc = true;
   for (int i = 0; i < nof_cb && softbuffer->tb_crc; i++) {
     /* If one CB failed return false */
-    softbuffer->tb_crc = softbuffer->cb_crc[i];
+    softbuffer->tb_crc = softbuffer->cb_crc[first_cb + i];
   }
   if (softbuffer->tb_crc) {
     for (int i = 0; i < nof_cb; i++) {
-      memcpy(&data[i * rlen / 8], softbuffer->data[i], rlen/8 * sizeof(uint8_t));
+      memcpy(&data[wp + i * rlen / 8], softbuffer->data[first_cb + i], rlen/8 * sizeof(uint8_t));
     }
   }
 
-  q->nof_iterations /= nof_cb;
+  q->nof_iterations = a.nof_iterations / nof_cb;
   return softbuffer->tb_crc;
 }
 
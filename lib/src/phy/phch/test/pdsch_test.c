@@ -62,9 +62,14 @@ uint32_t nof_rx_antennas = 1;
 bool tb_cw_swap = false;
 uint32_t pmi = 0;
 char *input_file = NULL; 
+bool use_sequence_cache = false;
+srslte_sequence_cache_t sequence_cache;
+uint32_t nof_fec_threads = 0;
+int nof_repetitions = 1;
+srslte_fec_pool_t fec_pool;
 
 void usage(char *prog) {
-  printf("Usage: %s [fmMcsrtRFpnwav] \n", prog);
+  printf("Usage: %s [fmMcsrtRFpnwavCTN] \n", prog);
   printf("\t-f read signal from file [Default generate it with pdsch_encode()]\n");
   printf("\t-m MCS [Default %d]\n", mcs[0]);
   printf("\t-M MCS2 [Default %d]\n", mcs[1]);
@@ -79,13 +84,25 @@ void usage(char *prog) {
   printf("\t-a nof_rx_antennas [Default %d]\n", nof_rx_antennas);
   printf("\t-p pmi (multiplex only)  [Default %d]\n", pmi);
   printf("\t-w Swap Transport Blocks\n");
+  printf("\t-C Use a sequence cache in the transmitter\n");
+  printf("\t-T Number of FEC threads decoding code blocks in parallel [Default %d]\n", nof_fec_threads);
+  printf("\t-N Number of decoding repetitions [Default %d]\n", nof_repetitions);
   printf("\t-v [set srslte_verbose to debug, default none]\n");
 }
 
 void parse_args(int argc, char **argv) {
   int opt;
-  while ((opt = getopt(argc, argv, "fmMcsrtRFpnawvx")) != -1) {
+  while ((opt = getopt(argc, argv, "fmMcsrtRFpnawvxCTN")) != -1) {
     switch(opt) {
+    case 'C':
+      use_sequence_cache = true;
+      break;
+    case 'T':
+      nof_fec_threads = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'N':
+      nof_repetitions = atoi(argv[optind]);
+      break;
     case 'f':
       input_file = argv[optind];
       break;
@@ -159,10 +176,11 @@ int main(int argc, char **argv) {
   int ret = -1;
   struct timeval t[3];
   srslte_softbuffer_tx_t *softbuffers_tx[SRSLTE_MAX_CODEWORDS];
-  int M=1;
+  int M;
   bool acks[SRSLTE_MAX_CODEWORDS] = {false};
 
   parse_args(argc,argv);
+  M = nof_repetitions;
 
   /* Initialise to zeros */
   bzero(&pdsch_tx, sizeof(srslte_pdsch_t));
@@ -288,6 +306,14 @@ int main(int argc, char **argv) {
 
   srslte_pdsch_set_rnti(&pdsch_rx, rnti);
 
+  if (nof_fec_threads) {
+    if (srslte_fec_pool_init(&fec_pool, nof_fec_threads)) {
+      fprintf(stderr, "Error creating FEC pool\n");
+      goto quit;
+    }
+    srslte_pdsch_set_fec_pool(&pdsch_rx, &fec_pool);
+  }
+
   for (i = 0; i < SRSLTE_MAX_CODEWORDS; i++) {
     softbuffers_rx[i] = calloc(sizeof(srslte_softbuffer_rx_t), 1);
     if (!softbuffers_rx[i]) {
@@ -362,6 +388,12 @@ int main(int argc, char **argv) {
       goto quit;
     }
 
+    if (use_sequence_cache) {
+      srslte_sequence_cache_init(&sequence_cache, 16*1024*1024);
+      srslte_sequence_cache_set_cell(&sequence_cache, cell.id);
+      srslte_pdsch_set_sequence_cache(&pdsch_tx, &sequence_cache);
+    }
+
     srslte_pdsch_set_rnti(&pdsch_tx, rnti);
 
     for (i = 0; i < SRSLTE_MAX_CODEWORDS; i++) {
@@ -474,6 +506,10 @@ int main(int argc, char **argv) {
   printf("DECODED %s in %.2f (PHY bitrate=%.2f Mbps. Processing bitrate=%.2f Mbps)\n", r?"Error":"OK",
          (float) t[0].tv_usec/M, (float) (grant.mcs[0].tbs + grant.mcs[1].tbs)/1000.0f,
          (float) (grant.mcs[0].tbs + grant.mcs[1].tbs)*M/t[0].tv_usec);
+  if (nof_fec_threads) {
+    printf("FEC pool: %d threads, %ld tasks, %ld rejected\n", nof_fec_threads,
+           (long) fec_pool.nof_tasks, (long) fec_pool.nof_rejected);
+  }
 
   /* If there is an error in PDSCH decode */
   if (r) {
@@ -508,6 +544,12 @@ int main(int argc, char **argv) {
 quit:
   srslte_pdsch_free(&pdsch_tx);
   srslte_pdsch_free(&pdsch_rx);
+  if (nof_fec_threads) {
+    srslte_fec_pool_free(&fec_pool);
+  }
+  if (use_sequence_cache) {
+    srslte_sequence_cache_free(&sequence_cache);
+  }
   for (i = 0; i < SRSLTE_MAX_CODEWORDS; i++) {
     srslte_softbuffer_tx_free(softbuffers_tx[i]);
     if (softbuffers_tx[i]) {
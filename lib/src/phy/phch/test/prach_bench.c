@@ -0,0 +1,145 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+/* Latency of srslte_prach_detect_offset() for every zero correlation zone
+ * configuration of preamble format 0, which sets the number of roots
+ * correlated per opportunity, with 0 up to nof_threads FEC pool threads
+ * helping the calling thread. */
+
+#define MAX_LEN  70176
+
+uint32_t N_ifft_ul   = 512;
+uint32_t nof_threads = 3;
+uint32_t nof_reps    = 200;
+
+void usage(char *prog) {
+  printf("Usage: %s [Ntr]\n", prog);
+  printf("\t-N Uplink IFFT size [Default %d]\n", N_ifft_ul);
+  printf("\t-t Maximum number of FEC pool threads [Default %d]\n", nof_threads);
+  printf("\t-r Detections per configuration [Default %d]\n", nof_reps);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "Ntr")) != -1) {
+    switch (opt) {
+      case 'N':
+        N_ifft_ul = atoi(argv[optind]);
+        break;
+      case 't':
+        nof_threads = atoi(argv[optind]);
+        break;
+      case 'r':
+        nof_reps = atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (nof_threads > SRSLTE_FEC_POOL_MAX_WORKERS) {
+    nof_threads = SRSLTE_FEC_POOL_MAX_WORKERS;
+  }
+
+  srslte_prach_t *p = (srslte_prach_t*) malloc(sizeof(srslte_prach_t));
+  srslte_fec_pool_t *pools = (srslte_fec_pool_t*) calloc(nof_threads + 1, sizeof(srslte_fec_pool_t));
+  cf_t *signal = srslte_vec_malloc(sizeof(cf_t) * MAX_LEN);
+  if (!p || !pools || !signal) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  for (uint32_t k = 1; k <= nof_threads; k++) {
+    if (srslte_fec_pool_init(&pools[k], k)) {
+      fprintf(stderr, "Error initiating FEC pool\n");
+      exit(-1);
+    }
+  }
+
+  if (srslte_prach_init(p, N_ifft_ul)) {
+    exit(-1);
+  }
+
+  uint32_t indices[64];
+  float t_offsets[64];
+  float peak_to_avg[64];
+  uint32_t n_indices;
+
+  printf("zczc  N_cs roots");
+  for (uint32_t k = 0; k <= nof_threads; k++) {
+    printf("   %2d thr", k + 1);
+  }
+  printf("  (us per detection)\n");
+
+  for (uint32_t zczc = 0; zczc < 16; zczc++) {
+    if (srslte_prach_set_cell(p, N_ifft_ul, 0, 0, false, zczc)) {
+      exit(-1);
+    }
+
+    // Last preamble of the last root in noise
+    bzero(signal, sizeof(cf_t) * MAX_LEN);
+    srslte_prach_gen(p, 63, 0, signal);
+    srslte_ch_awgn_c(signal, signal, 0.1, p->N_cp + p->N_seq);
+
+    printf("%4d %5d %5d", zczc, p->N_cs, p->N_roots);
+    for (uint32_t k = 0; k <= nof_threads; k++) {
+      srslte_prach_set_fec_pool(p, k ? &pools[k] : NULL);
+
+      struct timeval t[3];
+      gettimeofday(&t[1], NULL);
+      for (uint32_t r = 0; r < nof_reps; r++) {
+        srslte_prach_detect_offset(p, 0, &signal[p->N_cp], p->N_seq, indices, t_offsets, peak_to_avg, &n_indices);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      printf(" %8.1f", (t[0].tv_sec * 1e6 + t[0].tv_usec) / nof_reps);
+    }
+    printf("\n");
+  }
+
+  srslte_prach_free(p);
+  for (uint32_t k = 1; k <= nof_threads; k++) {
+    srslte_fec_pool_free(&pools[k]);
+  }
+  free(pools);
+  free(signal);
+  free(p);
+
+  exit(0);
+}
@@ -33,6 +33,7 @@
 #include <complex.h>
 
 #include "srslte/phy/phch/prach.h"
+#include "srslte/phy/channel/ch_awgn.h"
 
 #define MAX_LEN  70176
 
@@ -42,6 +43,8 @@ uint32_t preamble_format  = 0;
 uint32_t root_seq_idx     = 0;
 uint32_t zero_corr_zone   = 1;
 uint32_t n_seqs           = 64;
+uint32_t nof_threads      = 0;
+uint32_t nof_noise        = 10;
 
 void usage(char *prog) {
   printf("Usage: %s\n", prog);
@@ -50,11 +53,13 @@ void usage(char *prog) {
   printf("\t-r Root sequence index [Default 0]\n");
   printf("\t-z Zero correlation zone config [Default 1]\n");
   printf("\t-n Number of sequences used for each test [Default 64]\n");
+  printf("\t-t Number of FEC pool threads helping the detector [Default 0]\n");
+  printf("\t-a Number of noise only detections for false alarms [Default 10]\n");
 }
 
 void parse_args(int argc, char **argv) {
   int opt;
-  while ((opt = getopt(argc, argv, "Nfrzn")) != -1) {
+  while ((opt = getopt(argc, argv, "Nfrznta")) != -1) {
     switch (opt) {
     case 'N':
       N_ifft_ul = atoi(argv[optind]);
@@ -71,6 +76,12 @@ void parse_args(int argc, char **argv) {
     case 'n':
       n_seqs = atoi(argv[optind]);
       break;
+    case 't':
+      nof_threads = atoi(argv[optind]);
+      break;
+    case 'a':
+      nof_noise = atoi(argv[optind]);
+      break;
     default:
       usage(argv[0]);
       exit(-1);
@@ -99,6 +110,15 @@ int main(int argc, char **argv) {
                          high_speed_flag,
                          zero_corr_zone);
 
+  srslte_fec_pool_t pool;
+  if (nof_threads) {
+    if (srslte_fec_pool_init(&pool, nof_threads)) {
+      fprintf(stderr, "Error initiating FEC pool\n");
+      exit(-1);
+    }
+    srslte_prach_set_fec_pool(p, &pool);
+  }
+
   uint32_t seq_index = 0;
   uint32_t frequency_offset = 0;
 
@@ -127,16 +147,37 @@ int main(int argc, char **argv) {
     prach_len /= 2;
   srslte_prach_detect(p, 0, &preamble_sum[p->N_cp], prach_len, indices, &n_indices);
 
-  if(n_indices != n_seqs)
+  if(n_indices != n_seqs) {
+    printf("Missed detections: %d of %d preambles detected\n", n_indices, n_seqs);
     return -1;
+  }
 
   for(int i=0;i<n_seqs;i++)
   {
-    if(indices[i] != i)
+    if(indices[i] != i) {
+      printf("Detected preamble %d instead of %d\n", indices[i], i);
       return -1;
+    }
+  }
+
+  // Noise only, with the default detection threshold
+  srslte_prach_set_detect_factor(p, 18);
+  uint32_t nof_false = 0;
+  for (int i = 0; i < nof_noise; i++) {
+    memset(preamble_sum, 0, sizeof(cf_t)*MAX_LEN);
+    srslte_ch_awgn_c(preamble_sum, preamble_sum, 1.0, prach_len);
+    srslte_prach_detect(p, 0, preamble_sum, prach_len, indices, &n_indices);
+    nof_false += n_indices;
+  }
+  if (nof_false) {
+    printf("False alarms: %d in %d noise only detections\n", nof_false, nof_noise);
+    return -1;
   }
 
   srslte_prach_free(p);
+  if (nof_threads) {
+    srslte_fec_pool_free(&pool);
+  }
   free(p);
 
 	printf("Done\n");
@@ -0,0 +1,261 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+
+srslte_cell_t cell = {
+  100,                // nof_prb
+  1,                  // nof_ports
+  1,                  // cell_id
+  SRSLTE_CP_NORM,     // cyclic prefix
+  SRSLTE_PHICH_R_1_6, // PHICH resources
+  SRSLTE_PHICH_NORM   // PHICH length
+};
+
+uint32_t nof_ues = 16;
+
+void usage(char *prog) {
+  printf("Usage: %s [cnu]\n", prog);
+  printf("\t-c cell id [Default %d]\n", cell.id);
+  printf("\t-n nof_prb [Default %d]\n", cell.nof_prb);
+  printf("\t-u number of UEs attached for the memory and latency report [Default %d]\n", nof_ues);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "cnu")) != -1) {
+    switch(opt) {
+    case 'c':
+      cell.id = atoi(argv[optind]);
+      break;
+    case 'n':
+      cell.nof_prb = atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_ues = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+static uint32_t sequence_bytes(srslte_sequence_t *seq) {
+  return seq->max_len * (sizeof(uint8_t) + sizeof(float) + sizeof(short)) + seq->max_len / 8 + 8;
+}
+
+static int compare(srslte_sequence_t *seq, srslte_sequence_cache_type_t type, uint16_t rnti,
+                   uint32_t cw, uint32_t sf_idx, uint32_t len) {
+  srslte_sequence_t ref;
+  bzero(&ref, sizeof(srslte_sequence_t));
+  switch (type) {
+    case SRSLTE_SEQUENCE_CACHE_PDSCH:
+      srslte_sequence_pdsch(&ref, rnti, cw, 2 * sf_idx, cell.id, len);
+      break;
+    case SRSLTE_SEQUENCE_CACHE_PUSCH:
+      srslte_sequence_pusch(&ref, rnti, 2 * sf_idx, cell.id, len);
+      break;
+    default:
+      srslte_sequence_pucch(&ref, rnti, 2 * sf_idx, cell.id);
+      len = SRSLTE_PUCCH2_NOF_BITS;
+      break;
+  }
+  int ret = (seq->cur_len >= len && !memcmp(seq->c, ref.c, len) && !memcmp(seq->c_short, ref.c_short, len * sizeof(short))) ? 0 : -1;
+  srslte_sequence_free(&ref);
+  return ret;
+}
+
+int test_cache(void) {
+  srslte_sequence_cache_t cache;
+  uint32_t len = 1200;
+
+  if (srslte_sequence_cache_init(&cache, 64 * 1024 * 1024)) {
+    return -1;
+  }
+  srslte_sequence_cache_set_cell(&cache, cell.id);
+
+  // Sequences match the ones generated directly and are reused
+  for (uint32_t type = 0; type <= SRSLTE_SEQUENCE_CACHE_PUCCH; type++) {
+    for (uint16_t rnti = 0x46; rnti < 0x49; rnti++) {
+      for (uint32_t sf_idx = 0; sf_idx < SRSLTE_NSUBFRAMES_X_FRAME; sf_idx++) {
+        for (uint32_t cw = 0; cw < (type == SRSLTE_SEQUENCE_CACHE_PDSCH ? 2 : 1); cw++) {
+          srslte_sequence_t *seq = srslte_sequence_cache_get(&cache, type, rnti, cw, sf_idx, len);
+          if (!seq || compare(seq, type, rnti, cw, sf_idx, len)) {
+            fprintf(stderr, "Wrong sequence type=%d, rnti=0x%x, sf_idx=%d, cw=%d\n", type, rnti, sf_idx, cw);
+            return -1;
+          }
+          srslte_sequence_t *seq2 = srslte_sequence_cache_get(&cache, type, rnti, cw, sf_idx, len);
+          if (seq2 != seq) {
+            fprintf(stderr, "Sequence was not reused\n");
+            return -1;
+          }
+          srslte_sequence_cache_put(&cache, seq2);
+          srslte_sequence_cache_put(&cache, seq);
+        }
+      }
+    }
+  }
+  if (cache.nof_entries != 3 * 40 || cache.nof_hits != 3 * 40) {
+    fprintf(stderr, "Wrong number of entries %d or hits %d\n", cache.nof_entries, (int) cache.nof_hits);
+    return -1;
+  }
+
+  // A longer sequence replaces the cached one
+  srslte_sequence_t *seq = srslte_sequence_cache_get(&cache, SRSLTE_SEQUENCE_CACHE_PDSCH, 0x46, 1, 3, 4 * len);
+  if (!seq || compare(seq, SRSLTE_SEQUENCE_CACHE_PDSCH, 0x46, 1, 3, 4 * len)) {
+    fprintf(stderr, "Wrong sequence after growing\n");
+    return -1;
+  }
+  srslte_sequence_cache_put(&cache, seq);
+
+  // Removing a user removes all of its sequences
+  srslte_sequence_cache_free_rnti(&cache, 0x47);
+  if (cache.nof_entries != 2 * 40) {
+    fprintf(stderr, "Wrong number of entries %d after removing rnti\n", cache.nof_entries);
+    return -1;
+  }
+
+  // Entries in use survive eviction and removal
+  cache.max_bytes = 256 * 1024;
+  srslte_sequence_t *held = srslte_sequence_cache_get(&cache, SRSLTE_SEQUENCE_CACHE_PUSCH, 0x46, 0, 7, len);
+  srslte_sequence_cache_free_rnti(&cache, 0x46);
+  for (uint16_t rnti = 0x100; rnti < 0x200; rnti++) {
+    seq = srslte_sequence_cache_get(&cache, SRSLTE_SEQUENCE_CACHE_PDSCH, rnti, 0, rnti % 10, len);
+    srslte_sequence_cache_put(&cache, seq);
+  }
+  if (cache.nof_bytes > cache.max_bytes || !cache.nof_evictions) {
+    fprintf(stderr, "Cache exceeds budget: %" PRIu64 " > %" PRIu64 " bytes\n", cache.nof_bytes, cache.max_bytes);
+    return -1;
+  }
+  if (compare(held, SRSLTE_SEQUENCE_CACHE_PUSCH, 0x46, 0, 7, len)) {
+    fprintf(stderr, "Sequence in use was evicted\n");
+    return -1;
+  }
+  srslte_sequence_cache_put(&cache, held);
+
+  srslte_sequence_cache_free(&cache);
+  return 0;
+}
+
+/* Compares the memory and time used to attach nof_ues users with sequences pregenerated in
+ * srslte_pdsch_set_rnti()/srslte_pusch_set_rnti() and with a shared cache, where every user
+ * is then scheduled in all subframes with a full bandwidth allocation */
+int report(void) {
+  srslte_pdsch_t pdsch;
+  srslte_pusch_t pusch;
+  srslte_sequence_cache_t cache;
+  struct timeval t[3];
+
+  for (int use_cache = 0; use_cache < 2; use_cache++) {
+    if (srslte_pdsch_init_enb(&pdsch, cell.nof_prb) || srslte_pdsch_set_cell(&pdsch, cell) ||
+        srslte_pusch_init_enb(&pusch, cell.nof_prb) || srslte_pusch_set_cell(&pusch, cell)) {
+      fprintf(stderr, "Error initiating PDSCH/PUSCH\n");
+      return -1;
+    }
+    if (use_cache) {
+      srslte_sequence_cache_init(&cache, 1024 * 1024 * 1024);
+      srslte_sequence_cache_set_cell(&cache, cell.id);
+      srslte_pdsch_set_sequence_cache(&pdsch, &cache);
+      srslte_pusch_set_sequence_cache(&pusch, &cache);
+    }
+
+    gettimeofday(&t[1], NULL);
+    for (uint32_t i = 0; i < nof_ues; i++) {
+      srslte_pdsch_set_rnti(&pdsch, 0x46 + i);
+      srslte_pusch_set_rnti(&pusch, 0x46 + i);
+    }
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    float attach_us = (float) (t[0].tv_sec * 1000000 + t[0].tv_usec) / nof_ues;
+
+    uint64_t nof_bytes = 0;
+    if (use_cache) {
+      uint32_t len = pdsch.max_re * srslte_mod_bits_x_symbol(SRSLTE_MOD_64QAM);
+      for (uint32_t i = 0; i < nof_ues; i++) {
+        for (uint32_t sf_idx = 0; sf_idx < SRSLTE_NSUBFRAMES_X_FRAME; sf_idx++) {
+          for (uint32_t cw = 0; cw < SRSLTE_MAX_CODEWORDS; cw++) {
+            srslte_sequence_cache_put(&cache, srslte_sequence_cache_get(&cache, SRSLTE_SEQUENCE_CACHE_PDSCH,
+                                                                        0x46 + i, cw, sf_idx, len));
+          }
+          srslte_sequence_cache_put(&cache, srslte_sequence_cache_get(&cache, SRSLTE_SEQUENCE_CACHE_PUSCH,
+                                                                      0x46 + i, 0, sf_idx, len));
+        }
+      }
+      nof_bytes = cache.nof_bytes;
+    } else {
+      for (uint32_t i = 0; i < nof_ues; i++) {
+        for (uint32_t sf_idx = 0; sf_idx < SRSLTE_NSUBFRAMES_X_FRAME; sf_idx++) {
+          for (uint32_t cw = 0; cw < SRSLTE_MAX_CODEWORDS; cw++) {
+            nof_bytes += sequence_bytes(&pdsch.users[0x46 + i]->seq[cw][sf_idx]);
+          }
+          nof_bytes += sequence_bytes(&pusch.users[0x46 + i]->seq[sf_idx]);
+        }
+      }
+    }
+
+    printf("%-12s attach %8.1f us/UE, %6.2f MB/UE %s\n", use_cache ? "cache" : "pregenerated", attach_us,
+           (float) nof_bytes / nof_ues / 1024 / 1024, use_cache ? "once per cell (at full load)" : "per PHY worker");
+
+    for (uint32_t i = 0; i < nof_ues; i++) {
+      srslte_pdsch_free_rnti(&pdsch, 0x46 + i);
+      srslte_pusch_free_rnti(&pusch, 0x46 + i);
+    }
+    srslte_pdsch_free(&pdsch);
+    srslte_pusch_free(&pusch);
+    if (use_cache) {
+      if (cache.nof_entries) {
+        fprintf(stderr, "Cache not empty after removing all users\n");
+        return -1;
+      }
+      srslte_sequence_cache_free(&cache);
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  if (test_cache()) {
+    printf("Failed\n");
+    exit(-1);
+  }
+  if (report()) {
+    printf("Failed\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
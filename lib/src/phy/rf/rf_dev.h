@@ -184,6 +184,46 @@ static rf_dev_t dev_soapy = {
 
 #endif
 
+/* Define implementation for the shared memory loopback device */
+#ifdef ENABLE_SHM
+
+#include "rf_shm_imp.h"
+
+static rf_dev_t dev_shm = {
+  "shm",
+  rf_shm_devname,
+  rf_shm_rx_wait_lo_locked,
+  rf_shm_start_rx_stream,
+  rf_shm_stop_rx_stream,
+  rf_shm_flush_buffer,
+  rf_shm_has_rssi,
+  rf_shm_get_rssi,
+  rf_shm_suppress_stdout,
+  rf_shm_register_error_handler,
+  rf_shm_open,
+  rf_shm_open_multi,
+  rf_shm_close,
+  rf_shm_set_master_clock_rate,
+  rf_shm_is_master_clock_dynamic,
+  rf_shm_set_rx_srate,
+  rf_shm_set_rx_gain,
+  rf_shm_set_tx_gain,
+  rf_shm_get_rx_gain,
+  rf_shm_get_tx_gain,
+  rf_shm_set_rx_freq,
+  rf_shm_set_tx_srate,
+  rf_shm_set_tx_freq,
+  rf_shm_get_time,
+  rf_shm_recv_with_time,
+  rf_shm_recv_with_time_multi,
+  rf_shm_send_timed,
+  .srslte_rf_send_timed_multi = rf_shm_send_timed_multi,
+  rf_shm_set_tx_cal,
+  rf_shm_set_rx_cal
+};
+
+#endif
+
 //#define ENABLE_DUMMY_DEV
 
 #ifdef ENABLE_DUMMY_DEV
@@ -239,6 +279,9 @@ static rf_dev_t *available_devices[] = {
 #endif
 #ifdef ENABLE_DUMMY_DEV
   &dev_dummy,
+#endif
+#ifdef ENABLE_SHM
+  &dev_shm,
 #endif
   NULL
 };
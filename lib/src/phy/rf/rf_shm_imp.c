@@ -0,0 +1,872 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "srslte/srslte.h"
+#include "rf_shm_imp.h"
+
+#define SHM_MAGIC         0x73686d31
+#define SHM_MAX_PORTS     SRSLTE_MAX_PORTS
+#define SHM_RING_SAMPLES  (1<<19)
+#define SHM_WAIT_MS       100
+#define SHM_TX_TIMEOUT_MS 1000
+#define SHM_DEFAULT_NAME  "srslte"
+
+#define SHM_ROLE_ENB      0
+#define SHM_ROLE_UE       1
+
+/* One direction of the loopback. Link i is written by role i and read by the other role.
+ * Timestamps are absolute sample counts at the writer's sample rate. The reader zeroes
+ * the samples it consumes, so anything in [rd_time, rd_time+SHM_RING_SAMPLES) is either
+ * pending transmission or silence.
+ */
+typedef struct {
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+  double          srate;        // Sample rate of the ring, set by the writer
+  uint32_t        epoch;        // Incremented on every sample rate change
+  uint64_t        horizon;      // The writer will not transmit before this timestamp
+  uint64_t        rd_time;      // The reader has consumed every sample before this timestamp
+  uint64_t        nof_late;
+  uint64_t        nof_overflow;
+  cf_t            ring[SHM_MAX_PORTS][SHM_RING_SAMPLES];
+} rf_shm_link_t;
+
+typedef struct {
+  uint32_t        magic;
+  pid_t           pid[2];       // Process attached to each role, 0 if none
+  struct timespec origin;       // CLOCK_MONOTONIC time of sample 0 in real-time mode
+  rf_shm_link_t   link[2];
+} rf_shm_mem_t;
+
+typedef struct {
+  char           *devname;
+  char            path[80];
+  uint32_t        role;
+  uint32_t        nof_channels;
+  bool            realtime;
+  rf_shm_mem_t   *mem;
+  rf_shm_link_t  *tx;
+  rf_shm_link_t  *rx;
+
+  double          tx_srate;
+  double          rx_srate;
+  double          tx_gain;
+  double          rx_gain;
+  double          tx_freq;
+  double          rx_freq;
+
+  uint64_t        rx_time;      // Timestamp of the next received sample, in rx link samples
+  uint64_t        tx_time;      // End of the last transmission, in tx link samples
+  uint32_t        rx_epoch;
+  bool            rx_sync;
+  bool            ratio_warned;
+
+  // Channel impairments applied on receive
+  bool            awgn_en;
+  float           awgn_std;
+  float           cfo_hz;
+  cf_t            cfo_phase;
+  uint32_t        delay;
+
+  cf_t           *buffer[SHM_MAX_PORTS];
+  cf_t           *cfo_buffer;
+  uint32_t        buffer_len;
+
+  srslte_rf_error_handler_t error_handler;
+} rf_shm_handler_t;
+
+
+static void shm_lock(rf_shm_link_t *link)
+{
+  if (pthread_mutex_lock(&link->mutex) == EOWNERDEAD) {
+    // The peer died while holding the lock; the ring is still consistent
+    pthread_mutex_consistent(&link->mutex);
+  }
+}
+
+static void shm_unlock(rf_shm_link_t *link)
+{
+  pthread_mutex_unlock(&link->mutex);
+}
+
+static void shm_wait(rf_shm_link_t *link, uint32_t ms)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ts.tv_sec  += ms / 1000;
+  ts.tv_nsec += (ms % 1000) * 1000000;
+  if (ts.tv_nsec >= 1000000000) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000;
+  }
+  if (pthread_cond_timedwait(&link->cvar, &link->mutex, &ts) == EOWNERDEAD) {
+    pthread_mutex_consistent(&link->mutex);
+  }
+}
+
+static bool shm_pid_alive(pid_t pid)
+{
+  return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+static bool shm_peer_alive(rf_shm_handler_t *handler)
+{
+  return shm_pid_alive(handler->mem->pid[1 - handler->role]);
+}
+
+static double shm_now(rf_shm_mem_t *mem)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) (ts.tv_sec - mem->origin.tv_sec) + 1e-9 * (ts.tv_nsec - mem->origin.tv_nsec);
+}
+
+static void shm_ring_write(cf_t *ring, uint64_t t, const cf_t *x, uint32_t n)
+{
+  uint32_t idx = (uint32_t) (t % SHM_RING_SAMPLES);
+  uint32_t n1  = SRSLTE_MIN(n, SHM_RING_SAMPLES - idx);
+  memcpy(&ring[idx], x, sizeof(cf_t) * n1);
+  if (n1 < n) {
+    memcpy(ring, &x[n1], sizeof(cf_t) * (n - n1));
+  }
+}
+
+/* Copies n samples starting at t into y (if not NULL) and clears them from the ring */
+static void shm_ring_read(cf_t *ring, uint64_t t, cf_t *y, uint32_t n)
+{
+  uint32_t idx = (uint32_t) (t % SHM_RING_SAMPLES);
+  uint32_t n1  = SRSLTE_MIN(n, SHM_RING_SAMPLES - idx);
+  if (y) {
+    memcpy(y, &ring[idx], sizeof(cf_t) * n1);
+  }
+  bzero(&ring[idx], sizeof(cf_t) * n1);
+  if (n1 < n) {
+    if (y) {
+      memcpy(&y[n1], ring, sizeof(cf_t) * (n - n1));
+    }
+    bzero(ring, sizeof(cf_t) * (n - n1));
+  }
+}
+
+static void shm_link_clear(rf_shm_link_t *link, uint64_t from, uint64_t to)
+{
+  uint32_t n = (uint32_t) SRSLTE_MIN(to - from, (uint64_t) SHM_RING_SAMPLES);
+  for (int p = 0; p < SHM_MAX_PORTS; p++) {
+    shm_ring_read(link->ring[p], from, NULL, n);
+  }
+}
+
+static void shm_error(rf_shm_handler_t *handler, int type)
+{
+  if (handler->error_handler) {
+    srslte_rf_error_t error;
+    bzero(&error, sizeof(srslte_rf_error_t));
+    error.type = type;
+    handler->error_handler(error);
+  }
+}
+
+static void shm_init_mem(rf_shm_mem_t *mem)
+{
+  pthread_mutexattr_t mattr;
+  pthread_condattr_t  cattr;
+
+  pthread_mutexattr_init(&mattr);
+  pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+  pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+  pthread_condattr_init(&cattr);
+  pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+  pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+
+  for (int i = 0; i < 2; i++) {
+    pthread_mutex_init(&mem->link[i].mutex, &mattr);
+    pthread_cond_init(&mem->link[i].cvar, &cattr);
+  }
+  pthread_mutexattr_destroy(&mattr);
+  pthread_condattr_destroy(&cattr);
+
+  clock_gettime(CLOCK_MONOTONIC, &mem->origin);
+}
+
+/* Opens the shared memory object, creating and initializing it if this is the first process */
+static rf_shm_mem_t* shm_attach(const char *path)
+{
+  bool created = false;
+  int fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0666);
+  if (fd >= 0) {
+    created = true;
+    if (ftruncate(fd, sizeof(rf_shm_mem_t))) {
+      perror("ftruncate");
+      close(fd);
+      shm_unlink(path);
+      return NULL;
+    }
+  } else if (errno == EEXIST) {
+    fd = shm_open(path, O_RDWR, 0666);
+  }
+  if (fd < 0) {
+    perror("shm_open");
+    return NULL;
+  }
+
+  if (!created) {
+    // The creator may not have sized the object yet
+    struct stat st;
+    int i = 0;
+    while ((fstat(fd, &st) || st.st_size == 0) && i++ < 100) {
+      usleep(10000);
+    }
+    if (st.st_size != sizeof(rf_shm_mem_t)) {
+      fprintf(stderr, "[shm] %s has an unexpected size. Remove /dev/shm%s and try again\n", path, path);
+      close(fd);
+      return NULL;
+    }
+  }
+
+  rf_shm_mem_t *mem = mmap(NULL, sizeof(rf_shm_mem_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) {
+    perror("mmap");
+    return NULL;
+  }
+
+  if (created) {
+    shm_init_mem(mem);
+    __sync_synchronize();
+    mem->magic = SHM_MAGIC;
+  } else {
+    int i = 0;
+    while (mem->magic != SHM_MAGIC && i++ < 100) {
+      usleep(10000);
+    }
+    if (mem->magic != SHM_MAGIC) {
+      fprintf(stderr, "[shm] %s was not initialized\n", path);
+      munmap(mem, sizeof(rf_shm_mem_t));
+      return NULL;
+    }
+    __sync_synchronize();
+  }
+  return mem;
+}
+
+/* Rate of the samples in the rx ring. Falls back to our own rate if the peer never set one */
+static double shm_rx_link_srate(rf_shm_handler_t *handler)
+{
+  return handler->rx->srate > 0 ? handler->rx->srate : handler->rx_srate;
+}
+
+/* Places the receive cursor where the peer is about to transmit (fast mode) or at the
+ * current wall clock time (real-time mode). Must be called with the rx link locked.
+ */
+static void shm_sync_rx(rf_shm_handler_t *handler, double srate)
+{
+  rf_shm_link_t *rx = handler->rx;
+  uint64_t start = rx->rd_time;
+
+  if (handler->realtime) {
+    uint64_t now = (uint64_t) (shm_now(handler->mem) * srate);
+    if (now > start) {
+      start = now;
+    }
+  } else if (shm_peer_alive(handler) && rx->horizon > start) {
+    start = rx->horizon;
+  }
+  if (start > rx->rd_time) {
+    shm_link_clear(rx, rx->rd_time, start);
+  }
+  rx->rd_time       = start;
+  handler->rx_time  = start + handler->delay;
+  handler->rx_epoch = rx->epoch;
+  handler->rx_sync  = false;
+}
+
+/* Tells the peer we will not transmit before time t (in seconds), so that it can receive
+ * up to that point without waiting for us in fast mode.
+ */
+static void shm_advance_horizon(rf_shm_handler_t *handler, double t)
+{
+  rf_shm_link_t *tx = handler->tx;
+  shm_lock(tx);
+  if (tx->srate > 0) {
+    uint64_t horizon = (uint64_t) ceil(t * tx->srate);
+    if (horizon > tx->horizon) {
+      tx->horizon = horizon;
+      pthread_cond_broadcast(&tx->cvar);
+    }
+  }
+  shm_unlock(tx);
+}
+
+static int shm_resize_buffers(rf_shm_handler_t *handler, uint32_t len)
+{
+  if (len > handler->buffer_len) {
+    for (int p = 0; p < SHM_MAX_PORTS; p++) {
+      if (handler->buffer[p]) {
+        free(handler->buffer[p]);
+      }
+      handler->buffer[p] = srslte_vec_malloc(sizeof(cf_t) * len);
+      if (!handler->buffer[p]) {
+        return SRSLTE_ERROR;
+      }
+    }
+    if (handler->cfo_buffer) {
+      free(handler->cfo_buffer);
+    }
+    handler->cfo_buffer = srslte_vec_malloc(sizeof(cf_t) * len);
+    if (!handler->cfo_buffer) {
+      return SRSLTE_ERROR;
+    }
+    handler->buffer_len = len;
+  }
+  return SRSLTE_SUCCESS;
+}
+
+static void shm_decimate(const cf_t *x, cf_t *y, uint32_t ratio, uint32_t nsamples)
+{
+  float scale = 1.0f / ratio;
+  for (uint32_t i = 0; i < nsamples; i++) {
+    cf_t acc = 0;
+    for (uint32_t k = 0; k < ratio; k++) {
+      acc += x[i * ratio + k];
+    }
+    y[i] = acc * scale;
+  }
+}
+
+/* Rotates all ports by a phase-continuous carrier offset */
+static void shm_apply_cfo(rf_shm_handler_t *handler, void **data, uint32_t nsamples)
+{
+  cf_t rot   = cexpf(_Complex_I * 2 * M_PI * handler->cfo_hz / handler->rx_srate);
+  cf_t phase = handler->cfo_phase;
+  for (uint32_t i = 0; i < nsamples; i++) {
+    handler->cfo_buffer[i] = phase;
+    phase *= rot;
+  }
+  handler->cfo_phase = phase / cabsf(phase);
+
+  for (uint32_t p = 0; p < handler->nof_channels; p++) {
+    if (data[p]) {
+      srslte_vec_prod_ccc(handler->cfo_buffer, data[p], data[p], nsamples);
+    }
+  }
+}
+
+static void shm_time_to_secs(uint64_t t, double srate, time_t *secs, double *frac_secs)
+{
+  double s = srate > 0 ? (double) t / srate : 0;
+  if (secs) {
+    *secs = (time_t) s;
+  }
+  if (frac_secs) {
+    *frac_secs = s - (time_t) s;
+  }
+}
+
+
+char* rf_shm_devname(void *h)
+{
+  return DEVNAME_SHM;
+}
+
+bool rf_shm_rx_wait_lo_locked(void *h)
+{
+  return true;
+}
+
+void rf_shm_set_tx_cal(void *h, srslte_rf_cal_t *cal)
+{
+  // not supported
+}
+
+void rf_shm_set_rx_cal(void *h, srslte_rf_cal_t *cal)
+{
+  // not supported
+}
+
+int rf_shm_start_rx_stream(void *h, bool now)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_sync = true;
+  return SRSLTE_SUCCESS;
+}
+
+int rf_shm_stop_rx_stream(void *h)
+{
+  return SRSLTE_SUCCESS;
+}
+
+void rf_shm_flush_buffer(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_sync = true;
+}
+
+bool rf_shm_has_rssi(void *h)
+{
+  return false;
+}
+
+float rf_shm_get_rssi(void *h)
+{
+  return 0.0;
+}
+
+void rf_shm_suppress_stdout(void *h)
+{
+  // not supported
+}
+
+void rf_shm_register_error_handler(void *h, srslte_rf_error_handler_t error_handler)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->error_handler = error_handler;
+}
+
+int rf_shm_open(char *args, void **h)
+{
+  return rf_shm_open_multi(args, h, 1);
+}
+
+int rf_shm_open_multi(char *args, void **h, uint32_t nof_channels)
+{
+  char name[64] = SHM_DEFAULT_NAME;
+  char *arg;
+
+  *h = NULL;
+  if (args == NULL || !strstr(args, "role=")) {
+    fprintf(stderr, "[shm] Device arguments must include role=enb or role=ue\n");
+    return SRSLTE_ERROR;
+  }
+  if (nof_channels > SHM_MAX_PORTS) {
+    fprintf(stderr, "[shm] Up to %d channels are supported\n", SHM_MAX_PORTS);
+    return SRSLTE_ERROR;
+  }
+
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) calloc(1, sizeof(rf_shm_handler_t));
+  if (!handler) {
+    perror("calloc");
+    return SRSLTE_ERROR;
+  }
+  handler->devname      = DEVNAME_SHM;
+  handler->nof_channels = nof_channels;
+  handler->cfo_phase    = 1;
+  handler->rx_sync      = true;
+
+  if (strstr(args, "role=enb")) {
+    handler->role = SHM_ROLE_ENB;
+  } else if (strstr(args, "role=ue")) {
+    handler->role = SHM_ROLE_UE;
+  } else {
+    fprintf(stderr, "[shm] Invalid role. Options are enb or ue\n");
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  if ((arg = strstr(args, "name="))) {
+    sscanf(&arg[5], "%63[^,]", name);
+  }
+  if (strstr(args, "mode=rt")) {
+    handler->realtime = true;
+  }
+  if ((arg = strstr(args, "n0="))) {
+    float n0_db = 0;
+    if (sscanf(&arg[3], "%f", &n0_db) == 1) {
+      handler->awgn_en  = true;
+      handler->awgn_std = sqrtf(powf(10, n0_db / 10) / 2);
+    }
+  }
+  if ((arg = strstr(args, "cfo="))) {
+    sscanf(&arg[4], "%f", &handler->cfo_hz);
+  }
+  if ((arg = strstr(args, "delay="))) {
+    sscanf(&arg[6], "%u", &handler->delay);
+  }
+
+  snprintf(handler->path, sizeof(handler->path), "/srslte_shm_%s", name);
+  handler->mem = shm_attach(handler->path);
+  if (!handler->mem) {
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+
+  pid_t old = handler->mem->pid[handler->role];
+  if ((shm_pid_alive(old) && old != getpid()) ||
+      !__sync_bool_compare_and_swap(&handler->mem->pid[handler->role], old, getpid()))
+  {
+    fprintf(stderr, "[shm] Role %s of %s is already in use\n",
+            handler->role == SHM_ROLE_ENB ? "enb" : "ue", handler->path);
+    munmap(handler->mem, sizeof(rf_shm_mem_t));
+    free(handler);
+    return SRSLTE_ERROR;
+  }
+  handler->tx = &handler->mem->link[handler->role];
+  handler->rx = &handler->mem->link[1 - handler->role];
+
+  printf("Opening shared memory device %s as %s in %s mode\n", handler->path,
+         handler->role == SHM_ROLE_ENB ? "enb" : "ue", handler->realtime ? "real-time" : "fast");
+
+  *h = handler;
+  return SRSLTE_SUCCESS;
+}
+
+int rf_shm_close(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+
+  __sync_bool_compare_and_swap(&handler->mem->pid[handler->role], getpid(), 0);
+
+  // Wake up a peer waiting on us, it will notice we are gone
+  for (int i = 0; i < 2; i++) {
+    shm_lock(&handler->mem->link[i]);
+    pthread_cond_broadcast(&handler->mem->link[i].cvar);
+    shm_unlock(&handler->mem->link[i]);
+  }
+  if (!shm_peer_alive(handler)) {
+    shm_unlink(handler->path);
+  }
+  munmap(handler->mem, sizeof(rf_shm_mem_t));
+
+  for (int p = 0; p < SHM_MAX_PORTS; p++) {
+    if (handler->buffer[p]) {
+      free(handler->buffer[p]);
+    }
+  }
+  if (handler->cfo_buffer) {
+    free(handler->cfo_buffer);
+  }
+  free(handler);
+  return SRSLTE_SUCCESS;
+}
+
+void rf_shm_set_master_clock_rate(void *h, double rate)
+{
+  // not supported
+}
+
+bool rf_shm_is_master_clock_dynamic(void *h)
+{
+  return false;
+}
+
+double rf_shm_set_rx_srate(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_srate = freq;
+  return freq;
+}
+
+double rf_shm_set_tx_srate(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  rf_shm_link_t *tx = handler->tx;
+
+  shm_lock(tx);
+  if (tx->srate != freq) {
+    if (tx->srate > 0) {
+      // Keep the link time unchanged, in the new units
+      tx->horizon      = (uint64_t) ceil(tx->horizon * freq / tx->srate);
+      tx->rd_time      = (uint64_t) (tx->rd_time * freq / tx->srate);
+      handler->tx_time = (uint64_t) (handler->tx_time * freq / tx->srate);
+    } else {
+      double rx_srate  = shm_rx_link_srate(handler);
+      double t         = rx_srate > 0 ? handler->rx_time / rx_srate : 0;
+      tx->horizon      = (uint64_t) ceil(t * freq);
+      handler->tx_time = tx->horizon;
+    }
+    shm_link_clear(tx, 0, SHM_RING_SAMPLES);
+    tx->srate = freq;
+    tx->epoch++;
+    pthread_cond_broadcast(&tx->cvar);
+  }
+  shm_unlock(tx);
+
+  handler->tx_srate = freq;
+  return freq;
+}
+
+double rf_shm_set_rx_gain(void *h, double gain)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_gain = gain;
+  return gain;
+}
+
+double rf_shm_set_tx_gain(void *h, double gain)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->tx_gain = gain;
+  return gain;
+}
+
+double rf_shm_get_rx_gain(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->rx_gain;
+}
+
+double rf_shm_get_tx_gain(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->tx_gain;
+}
+
+double rf_shm_set_rx_freq(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->rx_freq = freq;
+  return freq;
+}
+
+double rf_shm_set_tx_freq(void *h, double freq)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  handler->tx_freq = freq;
+  return freq;
+}
+
+void rf_shm_get_time(void *h, time_t *secs, double *frac_secs)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  shm_time_to_secs(handler->rx_time, shm_rx_link_srate(handler), secs, frac_secs);
+}
+
+int rf_shm_recv_with_time(void *h, void *data, uint32_t nsamples,
+                          bool blocking, time_t *secs, double *frac_secs)
+{
+  void *data_multi[SHM_MAX_PORTS] = {data, NULL, NULL, NULL};
+  return rf_shm_recv_with_time_multi(h, data_multi, nsamples, blocking, secs, frac_secs);
+}
+
+int rf_shm_recv_with_time_multi(void *h, void **data, uint32_t nsamples,
+                                bool blocking, time_t *secs, double *frac_secs)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  rf_shm_link_t *rx = handler->rx;
+  bool overflow = false;
+
+  shm_lock(rx);
+  double srate = shm_rx_link_srate(handler);
+  if (srate <= 0) {
+    shm_unlock(rx);
+    fprintf(stderr, "[shm] Receive sample rate not set\n");
+    return SRSLTE_ERROR;
+  }
+  if (handler->rx_sync || handler->rx_epoch != rx->epoch) {
+    shm_sync_rx(handler, srate);
+  }
+  shm_unlock(rx);
+
+  // The ring runs at the peer's rate, decimate if we receive at an integer fraction of it
+  uint32_t ratio = 1;
+  if (handler->rx_srate > 0 && srate > handler->rx_srate) {
+    ratio = (uint32_t) round(srate / handler->rx_srate);
+    if (fabs(ratio * handler->rx_srate - srate) > 1 && !handler->ratio_warned) {
+      fprintf(stderr, "[shm] Receive rate %.2f MHz is not an integer fraction of %.2f MHz\n",
+              handler->rx_srate / 1e6, srate / 1e6);
+      handler->ratio_warned = true;
+    }
+  }
+  uint32_t nof_link = nsamples * ratio;
+  if (shm_resize_buffers(handler, nof_link)) {
+    return SRSLTE_ERROR;
+  }
+
+  // Whatever we transmit next goes after this block, the peer may receive up to its end
+  shm_advance_horizon(handler, (handler->rx_time + nof_link) / srate);
+
+  uint64_t rd  = handler->rx_time - handler->delay;
+  uint64_t end = rd + nof_link;
+
+  if (handler->realtime) {
+    double t = shm_now(handler->mem);
+    double t_end = end / srate;
+    if (t > t_end + (double) SHM_RING_SAMPLES / 2 / srate) {
+      // Fell too far behind the wall clock, the ring may have been overwritten
+      overflow = true;
+      handler->rx_sync = true;
+    } else if (t < t_end) {
+      struct timespec ts;
+      double target = t_end + handler->mem->origin.tv_sec + 1e-9 * handler->mem->origin.tv_nsec;
+      ts.tv_sec  = (time_t) target;
+      ts.tv_nsec = (long) ((target - ts.tv_sec) * 1e9);
+      while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+    }
+  }
+
+  shm_lock(rx);
+  if (!handler->realtime) {
+    // Lockstep: wait until the peer has written, or promised not to write, up to the block end
+    while (rx->srate > 0 && rx->horizon < end && rx->epoch == handler->rx_epoch && shm_peer_alive(handler)) {
+      shm_wait(rx, SHM_WAIT_MS);
+    }
+  }
+  for (uint32_t p = 0; p < SHM_MAX_PORTS; p++) {
+    cf_t *y = NULL;
+    if (p < handler->nof_channels && data[p]) {
+      y = ratio > 1 ? handler->buffer[p] : (cf_t*) data[p];
+    }
+    shm_ring_read(rx->ring[p], rd, y, nof_link);
+  }
+  rx->rd_time = end;
+  pthread_cond_broadcast(&rx->cvar);
+  shm_unlock(rx);
+
+  for (uint32_t p = 0; p < handler->nof_channels; p++) {
+    if (data[p]) {
+      if (ratio > 1) {
+        shm_decimate(handler->buffer[p], (cf_t*) data[p], ratio, nsamples);
+      }
+      if (handler->awgn_en) {
+        srslte_ch_awgn_c((cf_t*) data[p], (cf_t*) data[p], handler->awgn_std, nsamples);
+      }
+    }
+  }
+  if (handler->cfo_hz != 0 && handler->rx_srate > 0) {
+    shm_apply_cfo(handler, data, nsamples);
+  }
+
+  shm_time_to_secs(handler->rx_time, srate, secs, frac_secs);
+  handler->rx_time += nof_link;
+
+  if (overflow) {
+    shm_error(handler, SRSLTE_RF_ERROR_OVERFLOW);
+  }
+  return nsamples;
+}
+
+int rf_shm_send_timed(void *h, void *data, int nsamples,
+                      time_t secs, double frac_secs, bool has_time_spec,
+                      bool blocking, bool is_start_of_burst, bool is_end_of_burst)
+{
+  void *data_multi[SHM_MAX_PORTS] = {data, NULL, NULL, NULL};
+  return rf_shm_send_timed_multi(h, data_multi, nsamples, secs, frac_secs, has_time_spec,
+                                 blocking, is_start_of_burst, is_end_of_burst);
+}
+
+int rf_shm_send_timed_multi(void *h, void *data[4], int nsamples,
+                            time_t secs, double frac_secs, bool has_time_spec,
+                            bool blocking, bool is_start_of_burst, bool is_end_of_burst)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  rf_shm_link_t *tx = handler->tx;
+  bool late = false;
+  bool overflow = false;
+
+  if (nsamples <= 0) {
+    return 0;
+  }
+
+  shm_lock(tx);
+  double srate = tx->srate;
+  if (srate <= 0) {
+    shm_unlock(tx);
+    fprintf(stderr, "[shm] Transmit sample rate not set\n");
+    return SRSLTE_ERROR;
+  }
+
+  uint64_t t;
+  if (has_time_spec) {
+    t = (uint64_t) llround(((double) secs + frac_secs) * srate);
+  } else {
+    t = handler->tx_time;
+    if (is_start_of_burst) {
+      double rx_srate = shm_rx_link_srate(handler);
+      uint64_t now = rx_srate > 0 ? (uint64_t) ceil(handler->rx_time / rx_srate * srate) : 0;
+      t = SRSLTE_MAX(t, now);
+    }
+  }
+  handler->tx_time = t + nsamples;
+
+  uint32_t offset = 0;
+  uint32_t n = (uint32_t) nsamples;
+  if (shm_peer_alive(handler)) {
+    if (t < tx->rd_time) {
+      // The peer already received this time, drop the late part
+      offset = (uint32_t) SRSLTE_MIN(tx->rd_time - t, (uint64_t) n);
+      n -= offset;
+      t += offset;
+      tx->nof_late++;
+      late = true;
+    }
+    if (n > 0 && !handler->realtime) {
+      // Lockstep: wait for the peer to make room instead of dropping samples
+      uint32_t waited = 0;
+      while (t + n > tx->rd_time + SHM_RING_SAMPLES && waited < SHM_TX_TIMEOUT_MS &&
+             shm_peer_alive(handler))
+      {
+        shm_wait(tx, SHM_WAIT_MS);
+        waited += SHM_WAIT_MS;
+      }
+    }
+    if (n > 0 && t + n > tx->rd_time + SHM_RING_SAMPLES) {
+      tx->nof_overflow++;
+      overflow = true;
+    } else if (n > 0) {
+      for (uint32_t p = 0; p < handler->nof_channels; p++) {
+        if (data[p]) {
+          shm_ring_write(tx->ring[p], t, &((cf_t*) data[p])[offset], n);
+        }
+      }
+    }
+  }
+  if (t + n > tx->horizon) {
+    tx->horizon = t + n;
+  }
+  pthread_cond_broadcast(&tx->cvar);
+  shm_unlock(tx);
+
+  if (late) {
+    shm_error(handler, SRSLTE_RF_ERROR_LATE);
+  }
+  if (overflow) {
+    shm_error(handler, SRSLTE_RF_ERROR_UNDERFLOW);
+  }
+  return nsamples;
+}
+
+uint64_t rf_shm_get_nof_late(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->tx->nof_late;
+}
+
+uint64_t rf_shm_get_nof_overflow(void *h)
+{
+  rf_shm_handler_t *handler = (rf_shm_handler_t*) h;
+  return handler->tx->nof_overflow;
+}
@@ -0,0 +1,153 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         rf_shm_imp.h
+ *
+ *  Description:  Loopback RF device that carries timestamped baseband samples
+ *                between two processes (eNodeB and UE) over shared-memory
+ *                ring buffers. Supports up to SRSLTE_MAX_PORTS ports, integer
+ *                decimation on receive and optional AWGN, CFO and delay.
+ *
+ *                Device arguments (comma separated):
+ *                  role=enb|ue      Side of the link (mandatory)
+ *                  name=<string>    Shared memory object name (default "srslte")
+ *                  mode=fast|rt     Sample-accurate lockstep (default) or
+ *                                   paced by the wall clock
+ *                  n0=<dB>          Receive noise power (AWGN disabled if absent)
+ *                  cfo=<Hz>         Receive carrier frequency offset
+ *                  delay=<samples>  Receive delay, in link samples
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "srslte/config.h"
+#include "srslte/phy/rf/rf.h"
+
+#define DEVNAME_SHM "shm"
+
+SRSLTE_API int rf_shm_open(char *args,
+                           void **handler);
+
+SRSLTE_API int rf_shm_open_multi(char *args,
+                                 void **handler,
+                                 uint32_t nof_channels);
+
+SRSLTE_API char* rf_shm_devname(void *h);
+
+SRSLTE_API int rf_shm_close(void *h);
+
+SRSLTE_API void rf_shm_set_tx_cal(void *h, srslte_rf_cal_t *cal);
+
+SRSLTE_API void rf_shm_set_rx_cal(void *h, srslte_rf_cal_t *cal);
+
+SRSLTE_API int rf_shm_start_rx_stream(void *h, bool now);
+
+SRSLTE_API int rf_shm_stop_rx_stream(void *h);
+
+SRSLTE_API void rf_shm_flush_buffer(void *h);
+
+SRSLTE_API bool rf_shm_has_rssi(void *h);
+
+SRSLTE_API float rf_shm_get_rssi(void *h);
+
+SRSLTE_API bool rf_shm_rx_wait_lo_locked(void *h);
+
+SRSLTE_API void rf_shm_set_master_clock_rate(void *h,
+                                             double rate);
+
+SRSLTE_API bool rf_shm_is_master_clock_dynamic(void *h);
+
+SRSLTE_API double rf_shm_set_rx_srate(void *h,
+                                      double freq);
+
+SRSLTE_API double rf_shm_set_rx_gain(void *h,
+                                     double gain);
+
+SRSLTE_API double rf_shm_get_rx_gain(void *h);
+
+SRSLTE_API double rf_shm_set_tx_gain(void *h,
+                                     double gain);
+
+SRSLTE_API double rf_shm_get_tx_gain(void *h);
+
+SRSLTE_API void rf_shm_suppress_stdout(void *h);
+
+SRSLTE_API void rf_shm_register_error_handler(void *h, srslte_rf_error_handler_t error_handler);
+
+SRSLTE_API double rf_shm_set_rx_freq(void *h,
+                                     double freq);
+
+SRSLTE_API int rf_shm_recv_with_time(void *h,
+                                     void *data,
+                                     uint32_t nsamples,
+                                     bool blocking,
+                                     time_t *secs,
+                                     double *frac_secs);
+
+SRSLTE_API int rf_shm_recv_with_time_multi(void *h,
+                                           void **data,
+                                           uint32_t nsamples,
+                                           bool blocking,
+                                           time_t *secs,
+                                           double *frac_secs);
+
+SRSLTE_API double rf_shm_set_tx_srate(void *h,
+                                      double freq);
+
+SRSLTE_API double rf_shm_set_tx_freq(void *h,
+                                     double freq);
+
+SRSLTE_API void rf_shm_get_time(void *h,
+                                time_t *secs,
+                                double *frac_secs);
+
+SRSLTE_API int rf_shm_send_timed(void *h,
+                                 void *data,
+                                 int nsamples,
+                                 time_t secs,
+                                 double frac_secs,
+                                 bool has_time_spec,
+                                 bool blocking,
+                                 bool is_start_of_burst,
+                                 bool is_end_of_burst);
+
+SRSLTE_API int rf_shm_send_timed_multi(void *h,
+                                       void *data[4],
+                                       int nsamples,
+                                       time_t secs,
+                                       double frac_secs,
+                                       bool has_time_spec,
+                                       bool blocking,
+                                       bool is_start_of_burst,
+                                       bool is_end_of_burst);
+
+/* Statistics, mainly for testing */
+SRSLTE_API uint64_t rf_shm_get_nof_late(void *h);
+
+SRSLTE_API uint64_t rf_shm_get_nof_overflow(void *h);
@@ -0,0 +1,236 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "srslte/srslte.h"
+#include "../rf_shm_imp.h"
+
+#define NOF_PORTS    2
+#define TX_LEAD_MS   4
+
+double srate = 1.92e6;
+int nof_subframes = 500;
+int ratio = 1;
+int delay = 0;
+bool realtime = false;
+
+void usage(char *prog) {
+  printf("Usage: %s [nrdt]\n", prog);
+  printf("\t-n number of subframes [Default %d]\n", nof_subframes);
+  printf("\t-r UE receive decimation ratio [Default %d]\n", ratio);
+  printf("\t-d receive delay in samples [Default %d]\n", delay);
+  printf("\t-t run in real-time mode [Default fast]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nrdt")) != -1) {
+    switch (opt) {
+    case 'n':
+      nof_subframes = atoi(argv[optind]);
+      break;
+    case 'r':
+      ratio = atoi(argv[optind]);
+      break;
+    case 'd':
+      delay = atoi(argv[optind]);
+      break;
+    case 't':
+      realtime = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  void    *h;
+  bool     is_enb;
+  double   rx_srate;
+  double   tx_srate;
+  uint32_t tx_ratio;   // Samples in each constant step of the transmitted pattern
+  uint32_t nof_match;
+  uint32_t nof_error;
+} side_t;
+
+/* Sample value for link timestamp t. Constant over tx_ratio samples so that it survives decimation */
+static cf_t pattern(uint64_t t, uint32_t tx_ratio, uint32_t port) {
+  return (float) ((t / tx_ratio) % 10007 + 1) + I * (float) port;
+}
+
+static void* run_side(void *arg) {
+  side_t *s = (side_t*) arg;
+  uint32_t rx_len = (uint32_t) (s->rx_srate / 1000);
+  uint32_t tx_len = (uint32_t) (s->tx_srate / 1000);
+  uint32_t rx_ratio = s->is_enb ? 1 : ratio;
+  double   link_srate = rx_len * rx_ratio * 1000;
+  cf_t *rx[SRSLTE_MAX_PORTS] = {NULL, NULL, NULL, NULL};
+  cf_t *tx[SRSLTE_MAX_PORTS] = {NULL, NULL, NULL, NULL};
+  bool started[SRSLTE_MAX_PORTS] = {false, false, false, false};
+
+  for (int p = 0; p < NOF_PORTS; p++) {
+    rx[p] = srslte_vec_malloc(sizeof(cf_t) * rx_len);
+    tx[p] = srslte_vec_malloc(sizeof(cf_t) * tx_len);
+  }
+
+  for (int sf = 0; sf < nof_subframes; sf++) {
+    time_t secs;
+    double frac_secs;
+    if (rf_shm_recv_with_time_multi(s->h, (void**) rx, rx_len, true, &secs, &frac_secs) != rx_len) {
+      fprintf(stderr, "Error receiving\n");
+      s->nof_error++;
+      break;
+    }
+
+    /* Every sample after the peer started transmitting must be the peer's pattern at the same time */
+    uint64_t rx_ts = (uint64_t) llround((secs + frac_secs) * link_srate);
+    for (int p = 0; p < NOF_PORTS; p++) {
+      for (uint32_t i = 0; i < rx_len; i++) {
+        uint64_t t = rx_ts + i * rx_ratio;
+        if (!started[p] && rx[p][i] != 0) {
+          started[p] = true;
+        }
+        if (started[p] && t >= (uint64_t) delay) {
+          if (rx[p][i] == pattern(t - delay, rx_ratio, p)) {
+            s->nof_match++;
+          } else {
+            s->nof_error++;
+          }
+        }
+      }
+    }
+
+    /* Transmit TX_LEAD_MS after the received subframe, as the eNodeB and UE do */
+    uint64_t tx_ts = (uint64_t) llround((secs + frac_secs + TX_LEAD_MS * 1e-3) * s->tx_srate);
+    for (int p = 0; p < NOF_PORTS; p++) {
+      for (uint32_t i = 0; i < tx_len; i++) {
+        tx[p][i] = pattern(tx_ts + i, s->tx_ratio, p);
+      }
+    }
+    double tx_time = (double) tx_ts / s->tx_srate;
+    rf_shm_send_timed_multi(s->h, (void**) tx, tx_len, (time_t) tx_time, tx_time - (time_t) tx_time,
+                            true, true, true, true);
+  }
+
+  for (int p = 0; p < NOF_PORTS; p++) {
+    free(rx[p]);
+    free(tx[p]);
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  char args[128];
+  side_t enb, ue;
+  pthread_t enb_thread, ue_thread;
+  struct timeval t[3];
+
+  parse_args(argc, argv);
+
+  bzero(&enb, sizeof(side_t));
+  bzero(&ue, sizeof(side_t));
+
+  snprintf(args, sizeof(args), "role=enb,name=test%d,mode=%s,delay=%d", getpid(), realtime ? "rt" : "fast", delay);
+  if (rf_shm_open_multi(args, &enb.h, NOF_PORTS)) {
+    fprintf(stderr, "Error opening eNB side\n");
+    exit(-1);
+  }
+  snprintf(args, sizeof(args), "role=ue,name=test%d,mode=%s,delay=%d", getpid(), realtime ? "rt" : "fast", delay);
+  if (rf_shm_open_multi(args, &ue.h, NOF_PORTS)) {
+    fprintf(stderr, "Error opening UE side\n");
+    exit(-1);
+  }
+
+  /* The eNodeB runs at the full rate. The UE receives at an integer fraction of it */
+  enb.is_enb   = true;
+  enb.rx_srate = srate / ratio;
+  enb.tx_srate = srate;
+  enb.tx_ratio = ratio;
+  ue.rx_srate  = srate / ratio;
+  ue.tx_srate  = srate / ratio;
+  ue.tx_ratio  = 1;
+
+  rf_shm_set_tx_srate(enb.h, enb.tx_srate);
+  rf_shm_set_rx_srate(enb.h, enb.rx_srate);
+  rf_shm_set_tx_srate(ue.h, ue.tx_srate);
+  rf_shm_set_rx_srate(ue.h, ue.rx_srate);
+  rf_shm_start_rx_stream(enb.h, true);
+  rf_shm_start_rx_stream(ue.h, true);
+
+  gettimeofday(&t[1], NULL);
+  pthread_create(&enb_thread, NULL, run_side, &enb);
+  pthread_create(&ue_thread, NULL, run_side, &ue);
+  pthread_join(enb_thread, NULL);
+  pthread_join(ue_thread, NULL);
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_ms = t[0].tv_sec * 1e3 + t[0].tv_usec / 1e3;
+  uint64_t nof_late = rf_shm_get_nof_late(enb.h) + rf_shm_get_nof_late(ue.h);
+  uint64_t nof_overflow = rf_shm_get_nof_overflow(enb.h) + rf_shm_get_nof_overflow(ue.h);
+
+  printf("%d subframes in %.1f ms. DL: %d ok, %d errors. UL: %d ok, %d errors. Late: %d, overflow: %d\n",
+         nof_subframes, elapsed_ms, ue.nof_match, ue.nof_error, enb.nof_match, enb.nof_error,
+         (int) nof_late, (int) nof_overflow);
+
+  rf_shm_close(enb.h);
+  rf_shm_close(ue.h);
+
+  bool ok;
+  uint32_t min_match = (uint32_t) (NOF_PORTS * (nof_subframes - TX_LEAD_MS - 2) * (srate / ratio / 1000));
+  if (realtime) {
+    /* Paced by the wall clock. On a loaded machine a side may send a few subframes late, and the
+     * peer misses them, but any other wrong sample is an error */
+    uint64_t max_late  = nof_subframes / 10;
+    uint64_t max_error = nof_late * NOF_PORTS * (uint64_t) (srate / 1000);
+    ok = elapsed_ms > 0.9 * nof_subframes && nof_late <= max_late && nof_overflow == 0 &&
+         ue.nof_error + enb.nof_error <= max_error &&
+         ue.nof_match >= min_match / 2 && enb.nof_match >= min_match / 2;
+  } else {
+    /* Lockstep: every sample after the first transmission must arrive */
+    ok = ue.nof_error == 0 && enb.nof_error == 0 && nof_late == 0 && nof_overflow == 0 &&
+         ue.nof_match >= min_match && enb.nof_match >= min_match;
+  }
+
+  if (ok) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(-1);
+  }
+}
@@ -0,0 +1,446 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Receives a PDSCH capture through the UE DL chain split in the stages of the
+ * UE PHY: a sync thread hands every subframe to the next of several workers,
+ * which run the FFT and channel estimation and then decode the PDCCH and the
+ * PDSCH, with the code blocks spread over a FEC pool. The capture is generated
+ * with enb_dl and replayed from an IQ file until the requested number of
+ * subframes has been received. Reports the sustained subframe rate and the
+ * time taken by each stage. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/time.h>
+#include <math.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/io/iqfile.h"
+
+#define MAX_WORKERS 8
+#define MAX_TB_BYTES 100000
+
+srslte_cell_t cell = {
+  100,                  // nof_prb
+  1,                    // nof_ports
+  1,                    // cell_id
+  SRSLTE_CP_NORM,       // cyclic prefix
+  SRSLTE_PHICH_R_1,     // PHICH resources
+  SRSLTE_PHICH_NORM     // PHICH length
+};
+
+uint32_t cfi             = 2;
+uint16_t rnti            = 0x1234;
+uint32_t mcs_idx         = 20;
+uint32_t nof_subframes   = 200;
+uint32_t nof_workers     = 2;
+uint32_t nof_fec_threads = 0;
+char    *input_file_name = NULL;
+
+static char filename[] = "/tmp/ue_dl_pipeline_test_XXXXXX";
+
+/* Payloads of the 10 subframes of the generated frame */
+static uint8_t *payload[SRSLTE_NSUBFRAMES_X_FRAME];
+static uint32_t tbs;
+
+typedef struct {
+  uint32_t        id;
+  srslte_ue_dl_t  ue_dl;
+  cf_t           *buffer[SRSLTE_MAX_PORTS];
+  uint8_t        *data[SRSLTE_MAX_CODEWORDS];
+  pthread_t       thread;
+  sem_t           start;
+  sem_t           done;
+
+  uint32_t        sf_idx;
+  bool            quit;
+  struct timeval  rx_end;
+
+  uint32_t        nof_sf;
+  uint32_t        nof_errors;
+  uint64_t        fft_us;
+  uint64_t        decode_us;
+  uint32_t        max_finish_us;
+} worker_t;
+
+static worker_t workers[MAX_WORKERS];
+static srslte_fec_pool_t fec_pool;
+
+void usage(char *prog) {
+  printf("Usage: %s [nmswfiv]\n", prog);
+  printf("\t-n cell.nof_prb [Default %d]\n", cell.nof_prb);
+  printf("\t-m MCS index [Default %d]\n", mcs_idx);
+  printf("\t-s number of subframes [Default %d]\n", nof_subframes);
+  printf("\t-w number of workers [Default %d]\n", nof_workers);
+  printf("\t-f number of FEC threads [Default %d]\n", nof_fec_threads);
+  printf("\t-i keep the generated capture in this file [Default temporary file]\n");
+  printf("\t-v [set srslte_verbose to debug, default none]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nmswfiv")) != -1) {
+    switch(opt) {
+    case 'n':
+      cell.nof_prb = atoi(argv[optind]);
+      break;
+    case 'm':
+      mcs_idx = atoi(argv[optind]);
+      break;
+    case 's':
+      nof_subframes = atoi(argv[optind]);
+      break;
+    case 'w':
+      nof_workers = atoi(argv[optind]);
+      break;
+    case 'f':
+      nof_fec_threads = atoi(argv[optind]);
+      break;
+    case 'i':
+      input_file_name = argv[optind];
+      break;
+    case 'v':
+      srslte_verbose++;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (nof_workers < 1 || nof_workers > MAX_WORKERS) {
+    usage(argv[0]);
+    exit(-1);
+  }
+}
+
+static uint32_t elapsed_us(struct timeval *t0, struct timeval *t1)
+{
+  return (uint32_t) ((t1->tv_sec - t0->tv_sec)*1000000 + (t1->tv_usec - t0->tv_usec));
+}
+
+/* Generates one frame with a PDSCH grant over the whole bandwidth in every subframe */
+static int generate_capture(char *name)
+{
+  srslte_enb_dl_t enb_dl;
+  srslte_softbuffer_tx_t softbuffer;
+  srslte_softbuffer_tx_t *softbuffers[SRSLTE_MAX_CODEWORDS] = {&softbuffer, NULL};
+  srslte_iqfile_t file;
+  srslte_timestamp_t start = {0, 0};
+  cf_t *sf_buffer[SRSLTE_MAX_PORTS] = {NULL};
+  int ret = -1;
+
+  uint32_t sf_len = SRSLTE_SF_LEN_PRB(cell.nof_prb);
+  sf_buffer[0] = srslte_vec_malloc(sizeof(cf_t)*sf_len);
+  if (!sf_buffer[0]) {
+    perror("malloc");
+    return -1;
+  }
+
+  if (srslte_enb_dl_init(&enb_dl, sf_buffer, cell.nof_prb)) {
+    fprintf(stderr, "Error initiating eNB DL\n");
+    return -1;
+  }
+  if (srslte_enb_dl_set_cell(&enb_dl, cell)) {
+    fprintf(stderr, "Error setting eNB DL cell\n");
+    goto clean;
+  }
+  srslte_enb_dl_set_cfi(&enb_dl, cfi);
+  if (srslte_enb_dl_add_rnti(&enb_dl, rnti)) {
+    fprintf(stderr, "Error adding RNTI\n");
+    goto clean;
+  }
+  if (srslte_softbuffer_tx_init(&softbuffer, cell.nof_prb)) {
+    fprintf(stderr, "Error initiating softbuffer\n");
+    goto clean;
+  }
+  if (srslte_iqfile_create(&file, name, 1, SRSLTE_IQFILE_CF32, 1, srslte_sampling_freq_hz(cell.nof_prb), &start)) {
+    fprintf(stderr, "Error creating file %s\n", name);
+    goto clean;
+  }
+
+  srslte_ra_dl_dci_t ra_dl;
+  bzero(&ra_dl, sizeof(srslte_ra_dl_dci_t));
+  ra_dl.mcs_idx    = mcs_idx;
+  ra_dl.alloc_type = SRSLTE_RA_ALLOC_TYPE0;
+  uint32_t nof_rbg = (uint32_t) ceilf((float) cell.nof_prb/srslte_ra_type0_P(cell.nof_prb));
+  ra_dl.type0_alloc.rbg_bitmask = (1<<nof_rbg)-1;
+  ra_dl.tb_en[0]   = 1;
+
+  for (uint32_t sf_idx = 0; sf_idx < SRSLTE_NSUBFRAMES_X_FRAME; sf_idx++) {
+    srslte_dci_location_t locations[30];
+    srslte_ra_dl_grant_t grant;
+    int rv[SRSLTE_MAX_CODEWORDS] = {0, 0};
+    uint8_t *data[SRSLTE_MAX_CODEWORDS] = {payload[sf_idx], NULL};
+
+    if (!srslte_pdcch_ue_locations(&enb_dl.pdcch, locations, 30, sf_idx, cfi, rnti)) {
+      fprintf(stderr, "No PDCCH location for subframe %d\n", sf_idx);
+      goto close;
+    }
+    if (srslte_ra_dl_dci_to_grant(&ra_dl, cell.nof_prb, rnti, &grant)) {
+      fprintf(stderr, "Error computing grant\n");
+      goto close;
+    }
+    tbs = grant.mcs[0].tbs;
+    for (uint32_t i = 0; i < tbs/8; i++) {
+      payload[sf_idx][i] = (uint8_t) rand();
+    }
+
+    srslte_softbuffer_tx_reset(&softbuffer);
+    srslte_enb_dl_clear_sf(&enb_dl);
+    srslte_enb_dl_put_base(&enb_dl, sf_idx);
+    if (srslte_enb_dl_put_pdcch_dl(&enb_dl, &ra_dl, SRSLTE_DCI_FORMAT1, locations[0], rnti, sf_idx)) {
+      fprintf(stderr, "Error putting PDCCH\n");
+      goto close;
+    }
+    if (srslte_enb_dl_put_pdsch(&enb_dl, &grant, softbuffers, rnti, rv, sf_idx, data, SRSLTE_MIMO_TYPE_SINGLE_ANTENNA)) {
+      fprintf(stderr, "Error putting PDSCH\n");
+      goto close;
+    }
+    srslte_enb_dl_gen_signal(&enb_dl);
+    srslte_iqfile_write(&file, sf_buffer, sf_len);
+  }
+  ret = 0;
+
+close:
+  srslte_iqfile_close(&file);
+  srslte_softbuffer_tx_free(&softbuffer);
+clean:
+  srslte_enb_dl_free(&enb_dl);
+  free(sf_buffer[0]);
+  return ret;
+}
+
+static void *worker_thread(void *arg)
+{
+  worker_t *w = (worker_t*) arg;
+  srslte_ue_dl_t *q = &w->ue_dl;
+
+  while (1) {
+    sem_wait(&w->start);
+    if (w->quit) {
+      break;
+    }
+    struct timeval t_fft, t_dec;
+    uint32_t sf_idx = w->sf_idx;
+    uint32_t cfi_rx = 0;
+    bool acks[SRSLTE_MAX_CODEWORDS] = {false, false};
+
+    /* FFT, channel estimation and PDCCH LLR */
+    int n = srslte_ue_dl_decode_fft_estimate(q, sf_idx, &cfi_rx);
+    float noise_estimate = srslte_chest_dl_get_noise_estimate(&q->chest);
+    if (n >= 0) {
+      n = srslte_pdcch_extract_llr_multi(&q->pdcch, q->sf_symbols_m, q->ce_m, noise_estimate, sf_idx, cfi_rx);
+    }
+    gettimeofday(&t_fft, NULL);
+
+    /* PDCCH search and PDSCH decoding */
+    srslte_dci_msg_t dci_msg;
+    srslte_ra_dl_dci_t dci_unpacked;
+    srslte_ra_dl_grant_t grant;
+    int rv[SRSLTE_MAX_CODEWORDS] = {0, 0};
+    if (n >= 0 && srslte_ue_dl_find_dl_dci(q, 1, cfi_rx, sf_idx, rnti, &dci_msg) == 1 &&
+        !srslte_dci_msg_to_dl_grant(&dci_msg, rnti, cell.nof_prb, cell.nof_ports, &dci_unpacked, &grant) &&
+        !srslte_ue_dl_cfg_grant(q, &grant, cfi_rx, sf_idx, rv, SRSLTE_MIMO_TYPE_SINGLE_ANTENNA))
+    {
+      srslte_softbuffer_rx_reset_tbs(q->softbuffers[0], (uint32_t) grant.mcs[0].tbs);
+      srslte_pdsch_decode(&q->pdsch, &q->pdsch_cfg, q->softbuffers, q->sf_symbols_m, q->ce_m,
+                          noise_estimate, rnti, w->data, acks);
+    }
+    gettimeofday(&t_dec, NULL);
+
+    if (!acks[0] || grant.mcs[0].tbs != (int) tbs || memcmp(w->data[0], payload[sf_idx], tbs/8)) {
+      w->nof_errors++;
+    }
+    w->nof_sf++;
+    w->fft_us    += elapsed_us(&w->rx_end, &t_fft);
+    w->decode_us += elapsed_us(&t_fft, &t_dec);
+    uint32_t finish_us = elapsed_us(&w->rx_end, &t_dec);
+    if (finish_us > w->max_finish_us) {
+      w->max_finish_us = finish_us;
+    }
+
+    sem_post(&w->done);
+  }
+  return NULL;
+}
+
+static int worker_init(worker_t *w, uint32_t id)
+{
+  bzero(w, sizeof(worker_t));
+  w->id = id;
+  w->buffer[0] = srslte_vec_malloc(sizeof(cf_t)*SRSLTE_SF_LEN_PRB(cell.nof_prb));
+  w->data[0]   = srslte_vec_malloc(sizeof(uint8_t)*MAX_TB_BYTES);
+  if (!w->buffer[0] || !w->data[0]) {
+    perror("malloc");
+    return -1;
+  }
+  if (srslte_ue_dl_init(&w->ue_dl, w->buffer, cell.nof_prb, 1)) {
+    fprintf(stderr, "Error initiating UE DL\n");
+    return -1;
+  }
+  if (srslte_ue_dl_set_cell(&w->ue_dl, cell)) {
+    fprintf(stderr, "Error setting UE DL cell\n");
+    return -1;
+  }
+  srslte_ue_dl_set_rnti(&w->ue_dl, rnti);
+  if (nof_fec_threads) {
+    srslte_pdsch_set_fec_pool(&w->ue_dl.pdsch, &fec_pool);
+  }
+  sem_init(&w->start, 0, 0);
+  sem_init(&w->done, 0, 1);
+  if (pthread_create(&w->thread, NULL, worker_thread, w)) {
+    perror("pthread_create");
+    return -1;
+  }
+  return 0;
+}
+
+static void worker_free(worker_t *w)
+{
+  sem_wait(&w->done);
+  w->quit = true;
+  sem_post(&w->start);
+  pthread_join(w->thread, NULL);
+  sem_destroy(&w->start);
+  sem_destroy(&w->done);
+  srslte_ue_dl_free(&w->ue_dl);
+  free(w->buffer[0]);
+  free(w->data[0]);
+}
+
+int main(int argc, char **argv) {
+  struct timeval t[3];
+  srslte_iqfile_t file;
+  int ret = -1;
+
+  parse_args(argc, argv);
+
+  for (int i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
+    payload[i] = srslte_vec_malloc(sizeof(uint8_t)*MAX_TB_BYTES);
+    if (!payload[i]) {
+      perror("malloc");
+      exit(-1);
+    }
+  }
+
+  char *name = input_file_name;
+  if (!name) {
+    int fd = mkstemp(filename);
+    if (fd < 0) {
+      perror("mkstemp");
+      exit(-1);
+    }
+    close(fd);
+    name = filename;
+  }
+  if (generate_capture(name)) {
+    exit(-1);
+  }
+  if (srslte_iqfile_open(&file, name, 1)) {
+    fprintf(stderr, "Error opening file %s\n", name);
+    exit(-1);
+  }
+
+  if (nof_fec_threads && srslte_fec_pool_init(&fec_pool, nof_fec_threads)) {
+    fprintf(stderr, "Error initiating FEC pool\n");
+    exit(-1);
+  }
+  for (uint32_t i = 0; i < nof_workers; i++) {
+    if (worker_init(&workers[i], i)) {
+      exit(-1);
+    }
+  }
+
+  /* Sync thread: hands the subframes to the workers in turn, as fast as they take them */
+  uint32_t sf_len = SRSLTE_SF_LEN_PRB(cell.nof_prb);
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i = 0; i < nof_subframes; i++) {
+    worker_t *w = &workers[i%nof_workers];
+    uint32_t sf_idx = i%SRSLTE_NSUBFRAMES_X_FRAME;
+    sem_wait(&w->done);
+    if (sf_idx == 0) {
+      srslte_iqfile_seek(&file, 0);
+    }
+    if (srslte_iqfile_read(&file, w->buffer, sf_len) != (int) sf_len) {
+      fprintf(stderr, "Error reading subframe %d\n", i);
+      exit(-1);
+    }
+    w->sf_idx = sf_idx;
+    gettimeofday(&w->rx_end, NULL);
+    sem_post(&w->start);
+  }
+  for (uint32_t i = 0; i < nof_workers; i++) {
+    sem_wait(&workers[i].done);
+    sem_post(&workers[i].done);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  uint32_t nof_sf = 0, nof_errors = 0, max_finish_us = 0;
+  uint64_t fft_us = 0, decode_us = 0;
+  for (uint32_t i = 0; i < nof_workers; i++) {
+    worker_t *w = &workers[i];
+    nof_sf     += w->nof_sf;
+    nof_errors += w->nof_errors;
+    fft_us     += w->fft_us;
+    decode_us  += w->decode_us;
+    if (w->max_finish_us > max_finish_us) {
+      max_finish_us = w->max_finish_us;
+    }
+    worker_free(w);
+  }
+  if (nof_fec_threads) {
+    srslte_fec_pool_free(&fec_pool);
+  }
+  srslte_iqfile_close(&file);
+  if (!input_file_name) {
+    unlink(filename);
+  }
+  for (int i = 0; i < SRSLTE_NSUBFRAMES_X_FRAME; i++) {
+    free(payload[i]);
+  }
+
+  float total_us = t[0].tv_sec*1e6 + t[0].tv_usec;
+  printf("%d PRB, MCS %d, TBS %d bits, %d workers, %d FEC threads\n",
+         cell.nof_prb, mcs_idx, tbs, nof_workers, nof_fec_threads);
+  printf("Received %d subframes in %.1f ms: %.0f subframes/s (%.1f Mbps), %d errors\n",
+         nof_sf, total_us/1000, nof_sf*1e6/total_us, (float) nof_sf*tbs/total_us, nof_errors);
+  printf("Stage average: FFT %.0f us, decode %.0f us. Maximum time from RX to decoded: %d us\n",
+         nof_sf ? (float) fft_us/nof_sf : 0, nof_sf ? (float) decode_us/nof_sf : 0, max_finish_us);
+
+  if (nof_sf == nof_subframes && nof_errors == 0) {
+    printf("Ok\n");
+    ret = 0;
+  } else {
+    printf("Failed\n");
+  }
+  exit(ret);
+}
@@ -34,7 +34,7 @@
 
 #include "srslte/phy/ue/ue_sync.h"
 
-#include "srslte/phy/io/filesource.h"
+#include "srslte/phy/io/iqfile.h"
 #include "srslte/phy/utils/debug.h"
 #include "srslte/phy/utils/vector.h"
 
@@ -82,26 +82,25 @@ int srslte_ue_sync_init_file_multi(srslte_ue_sync_t *q, uint32_t nof_prb, char *
     q->cfo_correct_enable_find  = false;
     q->cfo_correct_enable_track = true;
 
-    if (srslte_cfo_init(&q->file_cfo_correct, 2*q->sf_len)) {
-      fprintf(stderr, "Error initiating CFO\n");
+    if (srslte_iqfile_open(&q->file_source, file_name, nof_rx_ant)) {
+      fprintf(stderr, "Error opening file %s\n", file_name);
       goto clean_exit; 
     }
+    if (q->file_source.hdr.nof_channels < nof_rx_ant || q->file_source.hdr.nof_channels > SRSLTE_MAX_PORTS) {
+      fprintf(stderr, "Error file %s has %d channels, %d antennas needed\n", file_name,
+              q->file_source.hdr.nof_channels, nof_rx_ant);
+      goto clean_exit;
+    }
     
-    if (srslte_filesource_init(&q->file_source, file_name, SRSLTE_COMPLEX_FLOAT_BIN)) {
-      fprintf(stderr, "Error opening file %s\n", file_name);
+    if (srslte_cfo_init(&q->file_cfo_correct, 2*q->sf_len)) {
+      fprintf(stderr, "Error initiating CFO\n");
       goto clean_exit; 
     }
     
     INFO("Offseting input file by %d samples and %.1f kHz\n", offset_time, offset_freq/1000);
 
     if (offset_time) {
-      cf_t *file_offset_buffer = srslte_vec_malloc(offset_time * nof_rx_ant * sizeof(cf_t));
-      if (!file_offset_buffer) {
-        perror("malloc");
-        goto clean_exit;
-      }
-      srslte_filesource_read(&q->file_source, file_offset_buffer, offset_time * nof_rx_ant);
-      free(file_offset_buffer);
+      srslte_iqfile_seek(&q->file_source, (uint64_t) offset_time);
     }
 
     srslte_ue_sync_cfo_reset(q);
@@ -301,7 +300,7 @@ void srslte_ue_sync_free(srslte_ue_sync_t *q) {
     srslte_sync_free(&q->sfind);
     srslte_sync_free(&q->strack);
   } else {
-    srslte_filesource_free(&q->file_source);
+    srslte_iqfile_close(&q->file_source);
   }
   bzero(q, sizeof(srslte_ue_sync_t));
 }
@@ -682,16 +681,21 @@ int srslte_ue_sync_zerocopy_multi(srslte_ue_sync_t *q, cf_t *input_buffer[SRSLTE
   {
     
     if (q->file_mode) {
-      int n = srslte_filesource_read_multi(&q->file_source, (void **) input_buffer, q->sf_len, q->nof_rx_antennas);
+      // Channels of the file beyond the receive antennas are skipped
+      cf_t *file_buffer[SRSLTE_MAX_PORTS];
+      for (int i = 0; i < SRSLTE_MAX_PORTS; i++) {
+        file_buffer[i] = i < q->nof_rx_antennas ? input_buffer[i] : NULL;
+      }
+      int n = srslte_iqfile_read(&q->file_source, file_buffer, q->sf_len);
       if (n < 0) {
         fprintf(stderr, "Error reading input file\n");
         return SRSLTE_ERROR;
       }
       if (n == 0) {
         if (q->file_wrap_enable) {
-          srslte_filesource_seek(&q->file_source, 0);
+          srslte_iqfile_seek(&q->file_source, 0);
           q->sf_idx = 9;
-          n = srslte_filesource_read_multi(&q->file_source, (void **) input_buffer, q->sf_len, q->nof_rx_antennas);
+          n = srslte_iqfile_read(&q->file_source, file_buffer, q->sf_len);
           if (n < 0) {
             fprintf(stderr, "Error reading input file\n");
             return SRSLTE_ERROR;
@@ -0,0 +1,185 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "srslte/phy/utils/cpu.h"
+#include "srslte/phy/utils/vector_simd.h"
+
+// CPUID feature bits
+#define CPUID1_ECX_SSE41     (1 << 19)
+#define CPUID1_ECX_OSXSAVE   (1 << 27)
+#define CPUID1_ECX_AVX       (1 << 28)
+#define CPUID7_EBX_AVX2      (1 << 5)
+#define CPUID7_EBX_AVX512F   (1 << 16)
+#define CPUID7_EBX_AVX512DQ  (1 << 17)
+#define CPUID7_EBX_AVX512BW  (1 << 30)
+
+// XCR0 state components enabled by the operating system
+#define XCR0_SSE_AVX         0x06
+#define XCR0_AVX512          0xe0
+
+static const char srslte_cpu_level_text[SRSLTE_CPU_NOF_LEVELS][8] = {"generic", "sse", "avx", "avx2", "avx512"};
+
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+static srslte_cpu_level_t cpu_detected; // CPUID traps to the hypervisor on VMs, so it is read once
+static srslte_cpu_level_t cpu_level;
+static const char *cpu_env;
+
+static srslte_cpu_level_t cpu_detect()
+{
+  srslte_cpu_level_t level = SRSLTE_CPU_GENERIC;
+#if defined(__x86_64__) || defined(__i386__)
+  uint32_t eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & CPUID1_ECX_SSE41)) {
+    return level;
+  }
+  level = SRSLTE_CPU_SSE;
+
+  // AVX also needs the operating system to save the YMM/ZMM registers
+  if (!(ecx & CPUID1_ECX_OSXSAVE) || !(ecx & CPUID1_ECX_AVX)) {
+    return level;
+  }
+  uint32_t xcr0_lo, xcr0_hi;
+  __asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+  if ((xcr0_lo & XCR0_SSE_AVX) != XCR0_SSE_AVX) {
+    return level;
+  }
+  level = SRSLTE_CPU_AVX;
+
+  if (__get_cpuid_max(0, NULL) < 7) {
+    return level;
+  }
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  if (!(ebx & CPUID7_EBX_AVX2)) {
+    return level;
+  }
+  level = SRSLTE_CPU_AVX2;
+
+  if ((xcr0_lo & XCR0_AVX512) == XCR0_AVX512 &&
+      (ebx & CPUID7_EBX_AVX512F) && (ebx & CPUID7_EBX_AVX512DQ) &&
+      (ebx & CPUID7_EBX_AVX512BW)) {
+    level = SRSLTE_CPU_AVX512;
+  }
+#endif
+  return level;
+}
+
+static void cpu_init()
+{
+  cpu_detected = cpu_detect();
+  cpu_level    = cpu_detected;
+
+  cpu_env = getenv("SRSLTE_SIMD");
+  if (cpu_env && strcasecmp(cpu_env, "auto")) {
+    srslte_cpu_level_t level;
+    if (srslte_cpu_level_parse(cpu_env, &level)) {
+      fprintf(stderr, "Invalid SRSLTE_SIMD=%s, using %s\n", cpu_env, srslte_cpu_level_text[cpu_level]);
+    } else if (level < cpu_level) {
+      cpu_level = level;
+    }
+  }
+}
+
+srslte_cpu_level_t srslte_cpu_detect()
+{
+  pthread_once(&cpu_once, cpu_init);
+  return cpu_detected;
+}
+
+srslte_cpu_level_t srslte_cpu_level()
+{
+  pthread_once(&cpu_once, cpu_init);
+  return cpu_level;
+}
+
+srslte_cpu_level_t srslte_cpu_set_level(srslte_cpu_level_t level)
+{
+  pthread_once(&cpu_once, cpu_init);
+  if (level < SRSLTE_CPU_NOF_LEVELS) {
+    cpu_level = level < cpu_detected ? level : cpu_detected;
+    srslte_vec_simd_bind();
+  }
+  return cpu_level;
+}
+
+srslte_cpu_level_t srslte_cpu_select(uint32_t variants)
+{
+  srslte_cpu_level_t level = srslte_cpu_level();
+  for (int i = level; i >= 0; i--) {
+    if (variants & SRSLTE_CPU_MASK(i)) {
+      return (srslte_cpu_level_t) i;
+    }
+  }
+  for (int i = level + 1; i < SRSLTE_CPU_NOF_LEVELS; i++) {
+    if (variants & SRSLTE_CPU_MASK(i)) {
+      return (srslte_cpu_level_t) i;
+    }
+  }
+  return SRSLTE_CPU_GENERIC;
+}
+
+int srslte_cpu_level_parse(const char *str, srslte_cpu_level_t *level)
+{
+  if (!strcasecmp(str, "auto")) {
+    *level = srslte_cpu_detect();
+    return 0;
+  }
+  for (int i = 0; i < SRSLTE_CPU_NOF_LEVELS; i++) {
+    if (!strcasecmp(str, srslte_cpu_level_text[i])) {
+      *level = (srslte_cpu_level_t) i;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+const char *srslte_cpu_level_string(srslte_cpu_level_t level)
+{
+  return level < SRSLTE_CPU_NOF_LEVELS ? srslte_cpu_level_text[level] : "unknown";
+}
+
+void srslte_cpu_report(FILE *f)
+{
+  srslte_cpu_level_t level = srslte_cpu_level();
+  fprintf(f, "SIMD: CPU supports %s, using %s", srslte_cpu_level_text[cpu_detected], srslte_cpu_level_text[level]);
+  if (cpu_env) {
+    fprintf(f, " (SRSLTE_SIMD=%s)", cpu_env);
+  }
+  fprintf(f, "\n");
+  fprintf(f, "  vector:        %s\n", srslte_vec_simd()->name);
+  fprintf(f, "  turbo decoder: %s\n", srslte_cpu_level_text[srslte_cpu_select(SRSLTE_CPU_VARIANTS_TDEC)]);
+  fprintf(f, "  viterbi:       %s\n", srslte_cpu_level_text[srslte_cpu_select(SRSLTE_CPU_VARIANTS_VITERBI)]);
+  fprintf(f, "  precoding:     %s\n", srslte_cpu_level_text[srslte_cpu_select(SRSLTE_CPU_VARIANTS_PRECODING)]);
+  fprintf(f, "  rate matching: %s\n", srslte_cpu_level_text[srslte_cpu_select(SRSLTE_CPU_VARIANTS_RM_TURBO)]);
+}
@@ -1,23 +1,106 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
 
 #include "srslte/phy/utils/ringbuffer.h"
 #include "srslte/phy/utils/vector.h"
 
-int srslte_ringbuffer_init(srslte_ringbuffer_t *q, int capacity)
+/* Positions run over [0, 2*capacity), so that a full and an empty buffer
+ * differ for any capacity. Each one is written by its own side only: the
+ * producer publishes data by advancing wpm after writing it, the consumer
+ * frees space by advancing rpm after reading it. */
+
+static int ringbuffer_count(srslte_ringbuffer_t *q, int wpm, int rpm)
+{
+  int count = wpm - rpm;
+  return count < 0 ? count + 2*q->capacity : count;
+}
+
+static int ringbuffer_offset(srslte_ringbuffer_t *q, int pos)
+{
+  return pos < q->capacity ? pos : pos - q->capacity;
+}
+
+static int ringbuffer_advance(srslte_ringbuffer_t *q, int pos, int nof_bytes)
+{
+  pos += nof_bytes;
+  return pos < 2*q->capacity ? pos : pos - 2*q->capacity;
+}
+
+// Maps a shared memory file twice in a row
+static uint8_t *ringbuffer_map_mirror(int capacity)
 {
-  q->buffer = srslte_vec_malloc(capacity);
+  int fd = -1;
+#ifdef SYS_memfd_create
+  fd = syscall(SYS_memfd_create, "srslte_ringbuffer", 0);
+#endif
+  if (fd < 0) {
+    char path[] = "/dev/shm/srslte_ringbuffer_XXXXXX";
+    fd = mkstemp(path);
+    if (fd < 0) {
+      return NULL;
+    }
+    unlink(path);
+  }
+  if (ftruncate(fd, capacity)) {
+    close(fd);
+    return NULL;
+  }
+
+  uint8_t *base = mmap(NULL, 2*capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) {
+    close(fd);
+    return NULL;
+  }
+  if (mmap(base, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+      mmap(base + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+    munmap(base, 2*capacity);
+    close(fd);
+    return NULL;
+  }
+  close(fd);
+  return base;
+}
+
+static int ringbuffer_init(srslte_ringbuffer_t *q, int capacity, bool mirrored)
+{
+  bzero(q, sizeof(srslte_ringbuffer_t));
+  if (mirrored) {
+    int page = (int) sysconf(_SC_PAGESIZE);
+    capacity = ((capacity + page - 1) / page) * page;
+    q->buffer = ringbuffer_map_mirror(capacity);
+    if (!q->buffer) {
+      fprintf(stderr, "Error mapping mirrored ring buffer, using a plain buffer\n");
+    }
+  }
+  q->mirrored = (q->buffer != NULL);
   if (!q->buffer) {
-    return -1; 
+    q->buffer = srslte_vec_malloc(capacity);
+    if (!q->buffer) {
+      return -1;
+    }
   }
   q->active     = true;
   q->capacity   = capacity;
-  pthread_mutex_init(&q->mutex, NULL); 
+  pthread_mutex_init(&q->mutex, NULL);
   pthread_cond_init(&q->cvar, NULL);
   srslte_ringbuffer_reset(q);
 
-  return 0; 
+  return 0;
+}
+
+int srslte_ringbuffer_init(srslte_ringbuffer_t *q, int capacity)
+{
+  return ringbuffer_init(q, capacity, false);
+}
+
+int srslte_ringbuffer_init_mirrored(srslte_ringbuffer_t *q, int capacity)
+{
+  return ringbuffer_init(q, capacity, true);
 }
 
 void srslte_ringbuffer_free(srslte_ringbuffer_t *q)
@@ -25,93 +108,157 @@ void srslte_ringbuffer_free(srslte_ringbuffer_t *q)
   if (q) {
     srslte_ringbuffer_stop(q);
     if (q->buffer) {
-      free(q->buffer);
-      q->buffer = NULL; 
+      if (q->mirrored) {
+        munmap(q->buffer, 2*q->capacity);
+      } else {
+        free(q->buffer);
+      }
+      q->buffer = NULL;
     }
-    pthread_mutex_destroy(&q->mutex); 
+    pthread_mutex_destroy(&q->mutex);
     pthread_cond_destroy(&q->cvar);
   }
 }
 
 void srslte_ringbuffer_reset(srslte_ringbuffer_t *q)
 {
-  pthread_mutex_lock(&q->mutex);
-  q->count = 0;
-  q->wpm   = 0;
-  q->rpm   = 0;
-  pthread_mutex_unlock(&q->mutex);
+  // Moving the read position forward drops the data the consumer has not read
+  __sync_synchronize();
+  q->rpm = q->wpm;
+  __sync_synchronize();
 }
 
 int srslte_ringbuffer_status(srslte_ringbuffer_t *q)
 {
-  return q->count;
+  return ringbuffer_count(q, q->wpm, q->rpm);
 }
 
 int srslte_ringbuffer_space(srslte_ringbuffer_t *q)
 {
-  return q->capacity - q->count;
+  return q->capacity - srslte_ringbuffer_status(q);
+}
+
+int srslte_ringbuffer_write_acquire(srslte_ringbuffer_t *q, void **ptr)
+{
+  int space  = q->capacity - ringbuffer_count(q, q->wpm, q->rpm);
+  int offset = ringbuffer_offset(q, q->wpm);
+  // Space freed by the consumer is not written before it has been read
+  __sync_synchronize();
+  *ptr = &q->buffer[offset];
+  if (!q->mirrored && space > q->capacity - offset) {
+    space = q->capacity - offset;
+  }
+  return space;
+}
+
+void srslte_ringbuffer_write_commit(srslte_ringbuffer_t *q, int nof_bytes)
+{
+  // Data is visible before the position that publishes it
+  __sync_synchronize();
+  q->wpm = ringbuffer_advance(q, q->wpm, nof_bytes);
+  __sync_synchronize();
+  if (q->reader_waiting) {
+    pthread_mutex_lock(&q->mutex);
+    pthread_cond_broadcast(&q->cvar);
+    pthread_mutex_unlock(&q->mutex);
+  }
 }
 
 int srslte_ringbuffer_write(srslte_ringbuffer_t *q, void *p, int nof_bytes)
 {
   uint8_t *ptr = (uint8_t*) p;
-  int w_bytes = nof_bytes;
-  pthread_mutex_lock(&q->mutex);
   if (!q->active) {
-    pthread_mutex_unlock(&q->mutex);
     return 0;
   }
-  if (q->count + w_bytes > q->capacity) {
-    w_bytes = q->capacity - q->count; 
-    fprintf(stderr, "Buffer overrun: lost %d bytes\n", nof_bytes - w_bytes);
+  void *dst;
+  int space = srslte_ringbuffer_write_acquire(q, &dst);
+  int w_bytes = nof_bytes;
+  if (w_bytes > space) {
+    int total_space = srslte_ringbuffer_space(q);
+    if (w_bytes > total_space) {
+      w_bytes = total_space;
+      q->nof_overrun += nof_bytes - w_bytes;
+    }
   }
-  if (w_bytes > q->capacity - q->wpm) {
-    int x = q->capacity - q->wpm; 
-    memcpy(&q->buffer[q->wpm], ptr, x);    
-    memcpy(q->buffer, &ptr[x], w_bytes - x);    
+  if (w_bytes > space) {
+    // Wrap-around of a buffer without mirror
+    memcpy(dst, ptr, space);
+    memcpy(q->buffer, &ptr[space], w_bytes - space);
   } else {
-    memcpy(&q->buffer[q->wpm], ptr, w_bytes);    
-  }
-  q->wpm += w_bytes; 
-  if (q->wpm >= q->capacity) {
-    q->wpm -= q->capacity; 
+    memcpy(dst, ptr, w_bytes);
   }
-  q->count += w_bytes; 
-  pthread_cond_broadcast(&q->cvar);
-  pthread_mutex_unlock(&q->mutex);
-  return w_bytes; 
+  srslte_ringbuffer_write_commit(q, w_bytes);
+  return w_bytes;
 }
 
-int srslte_ringbuffer_read(srslte_ringbuffer_t *q, void *p, int nof_bytes)
+// Waits until at least nof_bytes are buffered or the buffer is stopped
+static int ringbuffer_wait(srslte_ringbuffer_t *q, int nof_bytes)
 {
-  uint8_t *ptr = (uint8_t*) p;
+  int count = ringbuffer_count(q, q->wpm, q->rpm);
+  if (count >= nof_bytes || !q->active) {
+    return count;
+  }
+  q->nof_underrun++;
   pthread_mutex_lock(&q->mutex);
-  while(q->count < nof_bytes && q->active) {
+  q->reader_waiting = true;
+  __sync_synchronize();
+  while ((count = ringbuffer_count(q, q->wpm, q->rpm)) < nof_bytes && q->active) {
     pthread_cond_wait(&q->cvar, &q->mutex);
   }
+  q->reader_waiting = false;
+  pthread_mutex_unlock(&q->mutex);
+  return count;
+}
+
+int srslte_ringbuffer_read_acquire(srslte_ringbuffer_t *q, void **ptr, int min_bytes)
+{
+  if (min_bytes > q->capacity) {
+    return -1;
+  }
+  int count = ringbuffer_wait(q, min_bytes);
   if (!q->active) {
-    pthread_mutex_unlock(&q->mutex);
     return 0;
   }
-  if (nof_bytes + q->rpm > q->capacity) {
-    int x = q->capacity - q->rpm; 
-    memcpy(ptr, &q->buffer[q->rpm], x);
-    memcpy(&ptr[x], q->buffer, nof_bytes - x);
-  } else {         
-    memcpy(ptr, &q->buffer[q->rpm], nof_bytes);
+  // Data is read after the position that published it
+  __sync_synchronize();
+  int offset = ringbuffer_offset(q, q->rpm);
+  *ptr = &q->buffer[offset];
+  if (!q->mirrored && count > q->capacity - offset) {
+    count = q->capacity - offset;
   }
-  q->rpm += nof_bytes; 
-  if (q->rpm >= q->capacity) {
-    q->rpm -= q->capacity; 
+  return count;
+}
+
+void srslte_ringbuffer_read_commit(srslte_ringbuffer_t *q, int nof_bytes)
+{
+  // Data is read before the space is handed back to the producer
+  __sync_synchronize();
+  q->rpm = ringbuffer_advance(q, q->rpm, nof_bytes);
+}
+
+int srslte_ringbuffer_read(srslte_ringbuffer_t *q, void *p, int nof_bytes)
+{
+  uint8_t *ptr = (uint8_t*) p;
+  void *src;
+  int count = srslte_ringbuffer_read_acquire(q, &src, nof_bytes);
+  if (count <= 0) {
+    return count;
   }
-  q->count -= nof_bytes; 
-  pthread_mutex_unlock(&q->mutex);
-  return nof_bytes; 
+  if (count < nof_bytes) {
+    // Wrap-around of a buffer without mirror
+    memcpy(ptr, src, count);
+    memcpy(&ptr[count], q->buffer, nof_bytes - count);
+  } else {
+    memcpy(ptr, src, nof_bytes);
+  }
+  srslte_ringbuffer_read_commit(q, nof_bytes);
+  return nof_bytes;
 }
 
 void srslte_ringbuffer_stop(srslte_ringbuffer_t *q) {
+  q->active = false;
+  __sync_synchronize();
   pthread_mutex_lock(&q->mutex);
   pthread_cond_broadcast(&q->cvar);
   pthread_mutex_unlock(&q->mutex);
 }
-
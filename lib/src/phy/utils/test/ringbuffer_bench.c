@@ -0,0 +1,347 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Ring buffer throughput moving chunks of complex samples, as between the RF
+ * and PHY threads. Compares the previous mutex and condition variable ring
+ * buffer with the lock-free one, copying in and out and with zero-copy views
+ * on a mirrored buffer. Every configuration runs once with a producer and a
+ * consumer thread, and once with both sides alternating in one thread, which
+ * measures the cost of the buffer itself without scheduling effects.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/utils/ringbuffer.h"
+
+int nof_samples = 0;    // Per chunk. 0 runs the default sizes
+int nof_chunks  = 4;    // Ring buffer capacity in chunks
+int total_mb    = 1024;
+
+void usage(char *prog) {
+  printf("Usage: %s [nct]\n", prog);
+  printf("\t-n samples per chunk [Default 30720 and 1920]\n");
+  printf("\t-c ring buffer capacity in chunks [Default %d]\n", nof_chunks);
+  printf("\t-t MBytes moved per run [Default %d]\n", total_mb);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nct")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_samples = atoi(argv[optind]);
+        break;
+      case 'c':
+        nof_chunks = atoi(argv[optind]);
+        break;
+      case 't':
+        total_mb = atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+/* Previous implementation, for reference */
+typedef struct {
+  uint8_t *buffer;
+  bool active;
+  int capacity;
+  int count;
+  int wpm;
+  int rpm;
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar;
+} legacy_ringbuffer_t;
+
+static int legacy_init(legacy_ringbuffer_t *q, int capacity)
+{
+  q->buffer = srslte_vec_malloc(capacity);
+  if (!q->buffer) {
+    return -1;
+  }
+  q->active   = true;
+  q->capacity = capacity;
+  q->count    = 0;
+  q->wpm      = 0;
+  q->rpm      = 0;
+  pthread_mutex_init(&q->mutex, NULL);
+  pthread_cond_init(&q->cvar, NULL);
+  return 0;
+}
+
+static void legacy_free(legacy_ringbuffer_t *q)
+{
+  free(q->buffer);
+  pthread_mutex_destroy(&q->mutex);
+  pthread_cond_destroy(&q->cvar);
+}
+
+static int legacy_write(legacy_ringbuffer_t *q, void *p, int nof_bytes)
+{
+  uint8_t *ptr = (uint8_t*) p;
+  int w_bytes = nof_bytes;
+  pthread_mutex_lock(&q->mutex);
+  if (!q->active) {
+    pthread_mutex_unlock(&q->mutex);
+    return 0;
+  }
+  if (q->count + w_bytes > q->capacity) {
+    w_bytes = q->capacity - q->count;
+    fprintf(stderr, "Buffer overrun: lost %d bytes\n", nof_bytes - w_bytes);
+  }
+  if (w_bytes > q->capacity - q->wpm) {
+    int x = q->capacity - q->wpm;
+    memcpy(&q->buffer[q->wpm], ptr, x);
+    memcpy(q->buffer, &ptr[x], w_bytes - x);
+  } else {
+    memcpy(&q->buffer[q->wpm], ptr, w_bytes);
+  }
+  q->wpm += w_bytes;
+  if (q->wpm >= q->capacity) {
+    q->wpm -= q->capacity;
+  }
+  q->count += w_bytes;
+  pthread_cond_broadcast(&q->cvar);
+  pthread_mutex_unlock(&q->mutex);
+  return w_bytes;
+}
+
+static int legacy_read(legacy_ringbuffer_t *q, void *p, int nof_bytes)
+{
+  uint8_t *ptr = (uint8_t*) p;
+  pthread_mutex_lock(&q->mutex);
+  while(q->count < nof_bytes && q->active) {
+    pthread_cond_wait(&q->cvar, &q->mutex);
+  }
+  if (!q->active) {
+    pthread_mutex_unlock(&q->mutex);
+    return 0;
+  }
+  if (nof_bytes + q->rpm > q->capacity) {
+    int x = q->capacity - q->rpm;
+    memcpy(ptr, &q->buffer[q->rpm], x);
+    memcpy(&ptr[x], q->buffer, nof_bytes - x);
+  } else {
+    memcpy(ptr, &q->buffer[q->rpm], nof_bytes);
+  }
+  q->rpm += nof_bytes;
+  if (q->rpm >= q->capacity) {
+    q->rpm -= q->capacity;
+  }
+  q->count -= nof_bytes;
+  pthread_mutex_unlock(&q->mutex);
+  return nof_bytes;
+}
+
+typedef enum {
+  MODE_LEGACY = 0,
+  MODE_COPY,
+  MODE_VIEWS
+} mode_t_;
+
+static const char *mode_names[] = {"mutex, copy", "lock-free, copy", "lock-free, mirrored views"};
+
+typedef struct {
+  mode_t_              mode;
+  legacy_ringbuffer_t  legacy;
+  srslte_ringbuffer_t  ring;
+  int                  chunk_len;
+  uint32_t             nof_chunks;
+  cf_t                *src;
+  cf_t                *dst;
+  bool                 passed;
+} bench_t;
+
+// Every chunk starts with its sequence number
+static void produce(bench_t *b, uint32_t n)
+{
+  memcpy(b->src, &n, sizeof(uint32_t));
+  switch (b->mode) {
+    case MODE_LEGACY:
+      while (b->legacy.capacity - b->legacy.count < b->chunk_len) {
+        sched_yield();
+      }
+      legacy_write(&b->legacy, b->src, b->chunk_len);
+      break;
+    case MODE_COPY:
+      while (srslte_ringbuffer_space(&b->ring) < b->chunk_len) {
+        sched_yield();
+      }
+      srslte_ringbuffer_write(&b->ring, b->src, b->chunk_len);
+      break;
+    case MODE_VIEWS: {
+      void *ptr;
+      while (srslte_ringbuffer_write_acquire(&b->ring, &ptr) < b->chunk_len) {
+        sched_yield();
+      }
+      // Stands for the RF driver receiving into the buffer
+      memcpy(ptr, b->src, b->chunk_len);
+      srslte_ringbuffer_write_commit(&b->ring, b->chunk_len);
+      break;
+    }
+  }
+}
+
+static bool consume(bench_t *b, uint32_t n)
+{
+  uint32_t seq = 0;
+  switch (b->mode) {
+    case MODE_LEGACY:
+      legacy_read(&b->legacy, b->dst, b->chunk_len);
+      memcpy(&seq, b->dst, sizeof(uint32_t));
+      break;
+    case MODE_COPY:
+      srslte_ringbuffer_read(&b->ring, b->dst, b->chunk_len);
+      memcpy(&seq, b->dst, sizeof(uint32_t));
+      break;
+    case MODE_VIEWS: {
+      void *ptr;
+      srslte_ringbuffer_read_acquire(&b->ring, &ptr, b->chunk_len);
+      memcpy(&seq, ptr, sizeof(uint32_t));
+      srslte_ringbuffer_read_commit(&b->ring, b->chunk_len);
+      break;
+    }
+  }
+  if (seq != n) {
+    fprintf(stderr, "Received chunk %d, expected %d\n", seq, n);
+    b->passed = false;
+    return false;
+  }
+  return true;
+}
+
+static void *producer(void *arg)
+{
+  bench_t *b = (bench_t*) arg;
+  for (uint32_t n = 0; n < b->nof_chunks; n++) {
+    produce(b, n);
+  }
+  return NULL;
+}
+
+static void *consumer(void *arg)
+{
+  bench_t *b = (bench_t*) arg;
+  for (uint32_t n = 0; n < b->nof_chunks && consume(b, n); n++);
+  return NULL;
+}
+
+static bool run(mode_t_ mode, int samples, bool threads)
+{
+  bench_t b;
+  bzero(&b, sizeof(bench_t));
+  b.mode       = mode;
+  b.chunk_len  = samples*sizeof(cf_t);
+  b.nof_chunks = (uint32_t) (((uint64_t) total_mb*1024*1024)/b.chunk_len);
+  b.src        = srslte_vec_malloc(b.chunk_len);
+  b.dst        = srslte_vec_malloc(b.chunk_len);
+  b.passed     = true;
+  bzero(b.src, b.chunk_len);
+
+  int ret;
+  switch (mode) {
+    case MODE_LEGACY:
+      ret = legacy_init(&b.legacy, nof_chunks*b.chunk_len);
+      break;
+    case MODE_COPY:
+      ret = srslte_ringbuffer_init(&b.ring, nof_chunks*b.chunk_len);
+      break;
+    default:
+      ret = srslte_ringbuffer_init_mirrored(&b.ring, nof_chunks*b.chunk_len);
+      break;
+  }
+  if (ret) {
+    fprintf(stderr, "Error initiating ring buffer\n");
+    return false;
+  }
+
+  struct timeval t[3];
+  pthread_t p, c;
+  gettimeofday(&t[1], NULL);
+  if (threads) {
+    pthread_create(&c, NULL, consumer, &b);
+    pthread_create(&p, NULL, producer, &b);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+  } else {
+    for (uint32_t n = 0; n < b.nof_chunks; n++) {
+      produce(&b, n);
+      if (!consume(&b, n)) {
+        break;
+      }
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double secs = t[0].tv_sec + t[0].tv_usec*1e-6;
+  printf("%6d samples  %-9s %-26s %8.1f MB/s  %8.1f Msps\n", samples, threads ? "2 threads" : "1 thread", mode_names[mode],
+         (double) b.nof_chunks*b.chunk_len/secs/1e6, (double) b.nof_chunks*samples/secs/1e6);
+
+  if (mode == MODE_LEGACY) {
+    legacy_free(&b.legacy);
+  } else {
+    srslte_ringbuffer_free(&b.ring);
+  }
+  free(b.src);
+  free(b.dst);
+  return b.passed;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  int sizes[2] = {30720, 1920};
+  int nof_sizes = 2;
+  if (nof_samples > 0) {
+    sizes[0]  = nof_samples;
+    nof_sizes = 1;
+  }
+
+  bool passed = true;
+  for (int i = 0; i < nof_sizes; i++) {
+    for (int threads = 0; threads < 2; threads++) {
+      for (int mode = MODE_LEGACY; mode <= MODE_VIEWS; mode++) {
+        passed &= run((mode_t_) mode, sizes[i], threads);
+      }
+    }
+  }
+
+  printf("%s\n", passed ? "Ok" : "Failed");
+  exit(passed ? 0 : -1);
+}
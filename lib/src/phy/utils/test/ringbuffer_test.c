@@ -0,0 +1,231 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsLTE library.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/utils/ringbuffer.h"
+
+#define NOF_WORDS (4*1024*1024)
+
+#define CHECK(cond) if (!(cond)) { fprintf(stderr, "Failed: %s (line %d)\n", #cond, __LINE__); return false; }
+
+static bool test_wrap(bool mirrored, int capacity)
+{
+  srslte_ringbuffer_t q;
+  static uint8_t in[16384];
+  static uint8_t out[16384];
+  void *ptr;
+
+  CHECK(!(mirrored ? srslte_ringbuffer_init_mirrored(&q, capacity) : srslte_ringbuffer_init(&q, capacity)));
+  capacity = q.capacity;
+  for (int i = 0; i < 16384; i++) {
+    in[i] = (uint8_t) rand();
+  }
+
+  // Fill up to 3/4 and read 1/2, so that the next write wraps around
+  int n = 3*capacity/4;
+  CHECK(srslte_ringbuffer_write(&q, in, n) == n);
+  CHECK(srslte_ringbuffer_read(&q, out, capacity/2) == capacity/2);
+  CHECK(!memcmp(in, out, capacity/2));
+  CHECK(srslte_ringbuffer_status(&q) == n - capacity/2);
+
+  // Overrun drops what does not fit
+  int space = srslte_ringbuffer_space(&q);
+  CHECK(srslte_ringbuffer_write(&q, in, space + 10) == space);
+  CHECK(q.nof_overrun == 10);
+  CHECK(srslte_ringbuffer_space(&q) == 0);
+  CHECK(srslte_ringbuffer_write_acquire(&q, &ptr) == 0);
+
+  // The buffered data wraps around. Views are contiguous only with the mirror
+  int count = srslte_ringbuffer_read_acquire(&q, &ptr, 0);
+  CHECK(count == (mirrored ? capacity : capacity - capacity/2));
+  CHECK(!memcmp(ptr, &in[capacity/2], n - capacity/2));
+  CHECK(!memcmp((uint8_t*) ptr + n - capacity/2, in, count - (n - capacity/2)));
+  srslte_ringbuffer_read_commit(&q, n - capacity/2);
+  CHECK(srslte_ringbuffer_read(&q, out, space) == space);
+  CHECK(!memcmp(in, out, space));
+  CHECK(srslte_ringbuffer_status(&q) == 0);
+  CHECK(q.nof_underrun == 0);
+
+  // Write through a view and read it back, then reset
+  count = srslte_ringbuffer_write_acquire(&q, &ptr);
+  CHECK(count > 0);
+  memcpy(ptr, in, count < 100 ? count : 100);
+  srslte_ringbuffer_write_commit(&q, count < 100 ? count : 100);
+  CHECK(srslte_ringbuffer_status(&q) == (count < 100 ? count : 100));
+  srslte_ringbuffer_reset(&q);
+  CHECK(srslte_ringbuffer_status(&q) == 0);
+
+  srslte_ringbuffer_free(&q);
+  return true;
+}
+
+typedef struct {
+  srslte_ringbuffer_t *q;
+  bool                 views;
+  bool                 passed;
+} args_t;
+
+// Sends a counter in chunks of random length
+static void *producer(void *arg)
+{
+  args_t *a = (args_t*) arg;
+  uint32_t chunk[1000];
+  uint32_t next = 0;
+  while (next < NOF_WORDS) {
+    int n = 1 + rand() % 1000;
+    if (n > NOF_WORDS - next) {
+      n = NOF_WORDS - next;
+    }
+    if (a->views) {
+      void *ptr;
+      int space = srslte_ringbuffer_write_acquire(a->q, &ptr) / sizeof(uint32_t);
+      if (space == 0) {
+        usleep(10);
+        continue;
+      }
+      n = n < space ? n : space;
+      for (int i = 0; i < n; i++) {
+        ((uint32_t*) ptr)[i] = next++;
+      }
+      srslte_ringbuffer_write_commit(a->q, n*sizeof(uint32_t));
+    } else {
+      if (srslte_ringbuffer_space(a->q) < (int) (n*sizeof(uint32_t))) {
+        usleep(10);
+        continue;
+      }
+      for (int i = 0; i < n; i++) {
+        chunk[i] = next++;
+      }
+      if (srslte_ringbuffer_write(a->q, chunk, n*sizeof(uint32_t)) != (int) (n*sizeof(uint32_t))) {
+        a->passed = false;
+        return NULL;
+      }
+    }
+  }
+  return NULL;
+}
+
+static void *consumer(void *arg)
+{
+  args_t *a = (args_t*) arg;
+  uint32_t chunk[1000];
+  uint32_t next = 0;
+  while (next < NOF_WORDS) {
+    int n = 1 + rand() % 1000;
+    if (n > NOF_WORDS - next) {
+      n = NOF_WORDS - next;
+    }
+    uint32_t *data = chunk;
+    if (a->views) {
+      void *ptr;
+      int count = srslte_ringbuffer_read_acquire(a->q, &ptr, sizeof(uint32_t)) / sizeof(uint32_t);
+      n = n < count ? n : count;
+      data = (uint32_t*) ptr;
+    } else if (srslte_ringbuffer_read(a->q, chunk, n*sizeof(uint32_t)) != (int) (n*sizeof(uint32_t))) {
+      a->passed = false;
+      return NULL;
+    }
+    for (int i = 0; i < n; i++) {
+      if (data[i] != next++) {
+        fprintf(stderr, "Received %d, expected %d\n", data[i], next - 1);
+        a->passed = false;
+        return NULL;
+      }
+    }
+    if (a->views) {
+      srslte_ringbuffer_read_commit(a->q, n*sizeof(uint32_t));
+    }
+  }
+  return NULL;
+}
+
+static bool test_threads(bool mirrored, bool views)
+{
+  srslte_ringbuffer_t q;
+  pthread_t p, c;
+  CHECK(!(mirrored ? srslte_ringbuffer_init_mirrored(&q, 16384) : srslte_ringbuffer_init(&q, 10000)));
+  args_t a = {&q, views, true};
+  pthread_create(&c, NULL, consumer, &a);
+  pthread_create(&p, NULL, producer, &a);
+  pthread_join(p, NULL);
+  pthread_join(c, NULL);
+  CHECK(q.nof_overrun == 0);
+  srslte_ringbuffer_free(&q);
+  return a.passed;
+}
+
+typedef struct {
+  srslte_ringbuffer_t *q;
+  int                  ret;
+} reader_t;
+
+static void *blocked_reader(void *arg)
+{
+  reader_t *r = (reader_t*) arg;
+  uint8_t data[16];
+  r->ret = srslte_ringbuffer_read(r->q, data, 16);
+  return NULL;
+}
+
+static bool test_stop()
+{
+  srslte_ringbuffer_t q;
+  pthread_t t;
+  reader_t r = {&q, -1};
+  CHECK(!srslte_ringbuffer_init(&q, 1024));
+  pthread_create(&t, NULL, blocked_reader, &r);
+  usleep(10000);
+  srslte_ringbuffer_stop(&q);
+  pthread_join(t, NULL);
+  CHECK(r.ret == 0);
+  CHECK(q.nof_underrun == 1);
+  srslte_ringbuffer_free(&q);
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  bool passed = true;
+  passed &= test_wrap(false, 1000);
+  passed &= test_wrap(false, 4096);
+  passed &= test_wrap(true, 1000);
+  passed &= test_wrap(true, 3*4096);
+  passed &= test_threads(false, false);
+  passed &= test_threads(false, true);
+  passed &= test_threads(true, false);
+  passed &= test_threads(true, true);
+  passed &= test_stop();
+
+  printf("%s\n", passed ? "Ok" : "Failed");
+  exit(passed ? 0 : -1);
+}
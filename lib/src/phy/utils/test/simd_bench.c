@@ -0,0 +1,202 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Runs the kernels bound by srslte_cpu_set_level() at every level the CPU
+ * supports, side by side: the vector kernels, the single antenna equalizer,
+ * the Viterbi decoder and the turbo decoder.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <complex.h>
+#include <sys/time.h>
+
+#include "srslte/srslte.h"
+#include "srslte/phy/utils/cpu.h"
+#include "srslte/phy/utils/vector_simd.h"
+
+#define MAX_ROWS 16
+
+int nof_samples = 2048;
+int nof_reps    = 2000;
+
+void usage(char *prog) {
+  printf("Usage: %s [nr]\n", prog);
+  printf("\t-n vector length [Default %d]\n", nof_samples);
+  printf("\t-r repetitions of each vector kernel [Default %d]\n", nof_reps);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nr")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_samples = atoi(argv[optind]);
+        break;
+      case 'r':
+        nof_reps = atoi(argv[optind]);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (end->tv_sec - start->tv_sec) * 1e6 + (end->tv_usec - start->tv_usec);
+}
+
+#define BENCH(NAME, UNITS, REPS, CODE) do {\
+    struct timeval start, end;\
+    gettimeofday(&start, NULL);\
+    for (int r = 0; r < (REPS); r++) { CODE; }\
+    gettimeofday(&end, NULL);\
+    names[nof_rows] = NAME;\
+    result[nof_rows][col] = (double) (UNITS) * (REPS) / elapsed_us(&start, &end);\
+    nof_rows++;\
+  } while (0)
+
+int main(int argc, char **argv) {
+  const char *names[MAX_ROWS];
+  double result[MAX_ROWS][SRSLTE_CPU_NOF_LEVELS];
+  srslte_cpu_level_t levels[SRSLTE_CPU_NOF_LEVELS];
+  int nof_rows = 0;
+  int nof_cols = 0;
+
+  parse_args(argc, argv);
+
+  cf_t *x = srslte_vec_malloc(sizeof(cf_t) * nof_samples);
+  cf_t *y = srslte_vec_malloc(sizeof(cf_t) * nof_samples);
+  cf_t *z = srslte_vec_malloc(sizeof(cf_t) * nof_samples);
+  float *f = srslte_vec_malloc(sizeof(float) * nof_samples);
+  int16_t *s = srslte_vec_malloc(sizeof(int16_t) * 2 * nof_samples);
+  if (!x || !y || !z || !f || !s) {
+    perror("srslte_vec_malloc");
+    exit(-1);
+  }
+  for (int i = 0; i < nof_samples; i++) {
+    x[i] = (float) rand() / RAND_MAX + _Complex_I * (float) rand() / RAND_MAX;
+    y[i] = (float) rand() / RAND_MAX + _Complex_I * (float) rand() / RAND_MAX;
+  }
+
+  // Viterbi decoder, PDCCH sized tail-biting code
+  const uint32_t vit_bits = 72;
+  int poly[3] = {0x6D, 0x4F, 0x57};
+  float vit_llr[3 * 72];
+  uint8_t vit_data[72];
+  for (int i = 0; i < 3 * vit_bits; i++) {
+    vit_llr[i] = (rand() & 1) ? 1.0f : -1.0f;
+  }
+
+  // Turbo decoder, largest code block
+  const uint32_t long_cb = SRSLTE_TCOD_MAX_LEN_CB;
+  int16_t *tdec_in[SRSLTE_TDEC_MAX_NPAR];
+  uint8_t *tdec_out[SRSLTE_TDEC_MAX_NPAR];
+  for (int i = 0; i < SRSLTE_TDEC_MAX_NPAR; i++) {
+    tdec_in[i]  = srslte_vec_malloc(sizeof(int16_t) * SRSLTE_TCOD_MAX_LEN_CODED);
+    tdec_out[i] = srslte_vec_malloc(long_cb);
+    if (!tdec_in[i] || !tdec_out[i]) {
+      perror("srslte_vec_malloc");
+      exit(-1);
+    }
+    for (int j = 0; j < SRSLTE_TCOD_MAX_LEN_CODED; j++) {
+      tdec_in[i][j] = (int16_t) ((rand() & 0xff) - 128);
+    }
+  }
+
+  srslte_cpu_level_t detected = srslte_cpu_detect();
+  for (int level = SRSLTE_CPU_GENERIC; level <= detected; level++) {
+    if (srslte_cpu_set_level((srslte_cpu_level_t) level) != level) {
+      continue;
+    }
+    int col = nof_cols++;
+    levels[col] = (srslte_cpu_level_t) level;
+    nof_rows = 0;
+    srslte_cpu_report(stdout);
+
+    // Vector kernels, in MSamples/s
+    int n = nof_samples;
+    BENCH("vec_prod_ccc", n, nof_reps, srslte_vec_prod_ccc(x, y, z, n));
+    BENCH("vec_prod_conj_ccc", n, nof_reps, srslte_vec_prod_conj_ccc(x, y, z, n));
+    BENCH("vec_sc_prod_cfc", n, nof_reps, srslte_vec_sc_prod_cfc(x, 0.5f, z, n));
+    BENCH("vec_dot_prod_conj_ccc", n, nof_reps, z[0] = srslte_vec_dot_prod_conj_ccc(x, y, n));
+    BENCH("vec_abs_square_cf", n, nof_reps, srslte_vec_abs_square_cf(x, f, n));
+    BENCH("vec_div_ccc", n, nof_reps, srslte_vec_div_ccc(x, y, z, n));
+    BENCH("vec_convert_fi", 2 * n, nof_reps, srslte_vec_convert_fi((float *) x, 1024.0f, s, 2 * n));
+    BENCH("vec_sum_sss", 2 * n, nof_reps, srslte_vec_sum_sss(s, s, s, 2 * n));
+    BENCH("vec_max_fi", n, nof_reps, s[0] = srslte_vec_max_fi(f, n));
+
+    // Single antenna equalizer, in MSamples/s
+    BENCH("predecoding_single", n, nof_reps, srslte_predecoding_single(x, y, z, NULL, n, 1.0f, 0.01f));
+
+    // Decoders, in Mbps
+    srslte_viterbi_t viterbi;
+    if (srslte_viterbi_init(&viterbi, SRSLTE_VITERBI_37, poly, vit_bits, true)) {
+      fprintf(stderr, "Error initiating Viterbi decoder\n");
+      exit(-1);
+    }
+    BENCH("viterbi_decode_f", vit_bits, 20 * nof_reps, srslte_viterbi_decode_f(&viterbi, vit_llr, vit_data, vit_bits));
+    srslte_viterbi_free(&viterbi);
+
+    srslte_tdec_t tdec;
+    if (srslte_tdec_init(&tdec, long_cb)) {
+      fprintf(stderr, "Error initiating turbo decoder\n");
+      exit(-1);
+    }
+    uint32_t nof_par = srslte_tdec_get_nof_parallel(&tdec);
+    srslte_tdec_reset(&tdec, long_cb);
+    BENCH("tdec_run_all (4 it)", nof_par * long_cb, nof_reps / 50 + 1,
+          srslte_tdec_run_all_par(&tdec, tdec_in, tdec_out, 4, long_cb));
+    srslte_tdec_free(&tdec);
+  }
+
+  printf("\n%24s |", "MSamples/s, Mbps");
+  for (int j = 0; j < nof_cols; j++) {
+    printf(" %9s", srslte_cpu_level_string(levels[j]));
+  }
+  printf("\n");
+  for (int i = 0; i < nof_rows; i++) {
+    printf("%24s |", names[i]);
+    for (int j = 0; j < nof_cols; j++) {
+      printf(" %9.1f", result[i][j]);
+    }
+    printf("\n");
+  }
+
+  for (int i = 0; i < SRSLTE_TDEC_MAX_NPAR; i++) {
+    free(tdec_in[i]);
+    free(tdec_out[i]);
+  }
+  free(x);
+  free(y);
+  free(z);
+  free(f);
+  free(s);
+  exit(0);
+}
@@ -35,27 +35,70 @@
 #include "srslte/phy/utils/vector_simd.h"
 #include "srslte/phy/utils/bit.h"
 
+/* Variant of the SIMD kernels in use. It starts with the portable variant, in
+ * case vectors are used before the constructor below runs */
+#ifdef HAVE_SIMD_GENERIC
+static const srslte_vec_simd_t *vec_simd = &srslte_vec_simd_generic;
+#else
+static const srslte_vec_simd_t *vec_simd = &srslte_vec_simd_native;
+#endif
 
+const srslte_vec_simd_t *srslte_vec_simd_get(srslte_cpu_level_t level) {
+  switch (level) {
+#ifdef HAVE_SIMD_GENERIC
+    case SRSLTE_CPU_GENERIC:
+      return &srslte_vec_simd_generic;
+#endif
+#ifdef HAVE_SIMD_SSE
+    case SRSLTE_CPU_SSE:
+      return &srslte_vec_simd_sse;
+#endif
+#ifdef HAVE_SIMD_AVX2
+    case SRSLTE_CPU_AVX2:
+      return &srslte_vec_simd_avx2;
+#endif
+#ifdef HAVE_SIMD_AVX512
+    case SRSLTE_CPU_AVX512:
+      return &srslte_vec_simd_avx512;
+#endif
+    default:
+      return NULL;
+  }
+}
+
+const srslte_vec_simd_t *srslte_vec_simd() {
+  return vec_simd;
+}
+
+__attribute__((constructor))
+void srslte_vec_simd_bind() {
+#ifndef HAVE_SIMD_NATIVE
+  const srslte_vec_simd_t *simd = srslte_vec_simd_get(srslte_cpu_select(SRSLTE_CPU_VARIANTS_VEC));
+  if (simd) {
+    vec_simd = simd;
+  }
+#endif /* HAVE_SIMD_NATIVE */
+}
 
 void srslte_vec_xor_bbb(int8_t *x,int8_t *y,int8_t *z, const uint32_t len) {
-  srslte_vec_xor_bbb_simd(x, y, z, len);
+  vec_simd->xor_bbb(x, y, z, len);
 }
 
 // Used in PRACH detector, AGC and chest_dl for noise averaging
 float srslte_vec_acc_ff(const float *x, const uint32_t len) {
-  return srslte_vec_acc_ff_simd(x, len);
+  return vec_simd->acc_ff(x, len);
 }
 
 cf_t srslte_vec_acc_cc(const cf_t *x, const uint32_t len) {
-  return srslte_vec_acc_cc_simd(x, len);
+  return vec_simd->acc_cc(x, len);
 }
 
 void srslte_vec_sub_fff(const float *x, const float *y, float *z, const uint32_t len) {
-  srslte_vec_sub_fff_simd(x, y, z, len);
+  vec_simd->sub_fff(x, y, z, len);
 }
 
 void srslte_vec_sub_sss(const int16_t *x, const int16_t *y, int16_t *z, const uint32_t len) {
-  srslte_vec_sub_sss_simd(x, y, z, len);
+  vec_simd->sub_sss(x, y, z, len);
 }
 
 // Noise estimation in chest_dl, interpolation 
@@ -65,11 +108,11 @@ void srslte_vec_sub_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t le
 
 // Used in PSS/SSS and sum_ccc
 void srslte_vec_sum_fff(const float *x, const float *y, float *z, const uint32_t len) {
-  srslte_vec_add_fff_simd(x, y, z, len);
+  vec_simd->add_fff(x, y, z, len);
 }
 
 void srslte_vec_sum_sss(const int16_t *x, const int16_t *y, int16_t *z, const uint32_t len) {
-  srslte_vec_sum_sss_simd(x, y, z, len);
+  vec_simd->sum_sss(x, y, z, len);
 }
 
 void srslte_vec_sum_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t len) {
@@ -78,30 +121,30 @@ void srslte_vec_sum_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t le
 
 // PSS, PBCH, DEMOD, FFTW, etc.
 void srslte_vec_sc_prod_fff(const float *x, const float h, float *z, const uint32_t len) {
-  srslte_vec_sc_prod_fff_simd(x, h, z, len);
+  vec_simd->sc_prod_fff(x, h, z, len);
 }
 
 // Used throughout 
 void srslte_vec_sc_prod_cfc(const cf_t *x, const float h, cf_t *z, const uint32_t len) {
-  srslte_vec_sc_prod_cfc_simd(x,h,z,len);
+  vec_simd->sc_prod_cfc(x,h,z,len);
 }
 
 // Chest UL 
 void srslte_vec_sc_prod_ccc(const cf_t *x, const cf_t h, cf_t *z, const uint32_t len) {
-  srslte_vec_sc_prod_ccc_simd(x,h,z,len);
+  vec_simd->sc_prod_ccc(x,h,z,len);
 }
 
 // Used in turbo decoder 
 void srslte_vec_convert_if(const int16_t *x, const float scale, float *z, const uint32_t len) {
-  srslte_vec_convert_if_simd(x, z, scale, len);
+  vec_simd->convert_if(x, z, scale, len);
 }
 
 void srslte_vec_convert_fi(const float *x, const float scale, int16_t *z, const uint32_t len) {
-  srslte_vec_convert_fi_simd(x, z, scale, len);
+  vec_simd->convert_fi(x, z, scale, len);
 }
 
 void srslte_vec_lut_sss(const short *x, const unsigned short *lut, short *y, const uint32_t len) {
-  srslte_vec_lut_sss_simd(x, lut, y, len);
+  vec_simd->lut_sss(x, lut, y, len);
 }
 
 void *srslte_vec_malloc(uint32_t size) {
@@ -257,53 +300,53 @@ void srslte_vec_conj_cc(const cf_t *x, cf_t *y, const uint32_t len) {
 
 // Used in scrambling complex 
 void srslte_vec_prod_cfc(const cf_t *x, const float *y, cf_t *z, const uint32_t len) {
-  srslte_vec_prod_cfc_simd(x, y, z, len);
+  vec_simd->prod_cfc(x, y, z, len);
 }
 
 // Used in scrambling float
 void srslte_vec_prod_fff(const float *x, const float *y, float *z, const uint32_t len) {
-  srslte_vec_prod_fff_simd(x, y, z, len);
+  vec_simd->prod_fff(x, y, z, len);
 }
 
 // Scrambling Short
 void srslte_vec_prod_sss(const int16_t *x, const int16_t *y, int16_t *z, const uint32_t len) {
-  srslte_vec_prod_sss_simd(x,y,z,len);
+  vec_simd->prod_sss(x,y,z,len);
 }
 
 // CFO and OFDM processing
 void srslte_vec_prod_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t len) {
-  srslte_vec_prod_ccc_simd(x,y,z,len);
+  vec_simd->prod_ccc(x,y,z,len);
 }
 
 void srslte_vec_prod_ccc_split(const float *x_re, const float *x_im, const float *y_re, const float *y_im,
                                float *z_re, float *z_im, const uint32_t len) {
-  srslte_vec_prod_ccc_split_simd(x_re, x_im, y_re , y_im, z_re,z_im, len);
+  vec_simd->prod_ccc_split(x_re, x_im, y_re , y_im, z_re,z_im, len);
 }
 
 // PRACH, CHEST UL, etc. 
 void srslte_vec_prod_conj_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t len) {
-  srslte_vec_prod_conj_ccc_simd(x,y,z,len);
+  vec_simd->prod_conj_ccc(x,y,z,len);
 }
 
 //#define DIV_USE_VEC
 
 // Used in SSS 
 void srslte_vec_div_ccc(const cf_t *x, const cf_t *y, cf_t *z, const uint32_t len) {
-  srslte_vec_div_ccc_simd(x, y, z, len);
+  vec_simd->div_ccc(x, y, z, len);
 }
 
 /* Complex division by float z=x/y */
 void srslte_vec_div_cfc(const cf_t *x, const float *y, cf_t *z, const uint32_t len) {
-  srslte_vec_div_cfc_simd(x, y, z, len);
+  vec_simd->div_cfc(x, y, z, len);
 }
 
 void srslte_vec_div_fff(const float *x, const float *y, float *z, const uint32_t len) {
-  srslte_vec_div_fff_simd(x, y, z, len);
+  vec_simd->div_fff(x, y, z, len);
 }
 
 // PSS. convolution 
 cf_t srslte_vec_dot_prod_ccc(const cf_t *x, const cf_t *y, const uint32_t len) {
-  return srslte_vec_dot_prod_ccc_simd(x, y, len);
+  return vec_simd->dot_prod_ccc(x, y, len);
 }
 
 // Convolution filter and in SSS search 
@@ -318,7 +361,7 @@ cf_t srslte_vec_dot_prod_cfc(const cf_t *x, const float *y, const uint32_t len)
 
 // SYNC 
 cf_t srslte_vec_dot_prod_conj_ccc(const cf_t *x, const cf_t *y, const uint32_t len) {
-  return srslte_vec_dot_prod_conj_ccc_simd(x, y, len);
+  return vec_simd->dot_prod_conj_ccc(x, y, len);
 }
 
 // PHICH 
@@ -332,7 +375,7 @@ float srslte_vec_dot_prod_fff(const float *x, const float *y, const uint32_t len
 }
 
 int32_t srslte_vec_dot_prod_sss(const int16_t *x, const int16_t *y, const uint32_t len) {
-  return srslte_vec_dot_prod_sss_simd(x, y, len);
+  return vec_simd->dot_prod_sss(x, y, len);
 }
 
 float srslte_vec_avg_power_cf(const cf_t *x, const uint32_t len) {
@@ -350,21 +393,21 @@ float srslte_vec_corr_ccc(const cf_t *x, cf_t *y, const uint32_t len) {
 
 // PSS (disabled and using abs_square )
 void srslte_vec_abs_cf(const cf_t *x, float *abs, const uint32_t len) {
-  srslte_vec_abs_cf_simd(x, abs, len);
+  vec_simd->abs_cf(x, abs, len);
 }
 
 // PRACH 
 void srslte_vec_abs_square_cf(const cf_t *x, float *abs_square, const uint32_t len) {
-  srslte_vec_abs_square_cf_simd(x,abs_square,len);
+  vec_simd->abs_square_cf(x,abs_square,len);
 }
 
 uint32_t srslte_vec_max_fi(const float *x, const uint32_t len) {
-  return srslte_vec_max_fi_simd(x, len);
+  return vec_simd->max_fi(x, len);
 }
 
 // CP autocorr
 uint32_t srslte_vec_max_abs_ci(const cf_t *x, const uint32_t len) {
-  return srslte_vec_max_ci_simd(x, len);
+  return vec_simd->max_ci(x, len);
 }
 
 void srslte_vec_quant_fus(float *in, uint16_t *out, float gain, float offset, float clip, uint32_t len) {
@@ -422,13 +465,13 @@ void srslte_vec_quant_sus(const int16_t *in, uint16_t *out, const float gain, co
 }
 
 void srs_vec_cf_cpy(const cf_t *dst, cf_t *src, int len) {
-  srslte_vec_cp_simd(dst, src, len);
+  vec_simd->cp(dst, src, len);
 }
 
 void srslte_vec_interleave(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
-  srslte_vec_interleave_simd(x, y, z, len);
+  vec_simd->interleave(x, y, z, len);
 }
 
 void srslte_vec_interleave_add(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
-  srslte_vec_interleave_add_simd(x, y, z, len);
+  vec_simd->interleave_add(x, y, z, len);
 }
\ No newline at end of file
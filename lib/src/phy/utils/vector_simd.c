@@ -37,7 +37,7 @@
 #include "srslte/phy/utils/simd.h"
 
 
-void srslte_vec_xor_bbb_simd(const int8_t *x, const int8_t *y, int8_t *z, const int len) {
+static void srslte_vec_xor_bbb_simd(const int8_t *x, const int8_t *y, int8_t *z, const int len) {
   int i = 0;
 #if SRSLTE_SIMD_B_SIZE
   if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(y) && SRSLTE_IS_ALIGNED(z)) {
@@ -66,7 +66,7 @@ void srslte_vec_xor_bbb_simd(const int8_t *x, const int8_t *y, int8_t *z, const
   }
 }
 
-int srslte_vec_dot_prod_sss_simd(const int16_t *x, const int16_t *y, const int len) {
+static int srslte_vec_dot_prod_sss_simd(const int16_t *x, const int16_t *y, const int len) {
   int i = 0;
   int result = 0;
 #if SRSLTE_SIMD_S_SIZE
@@ -104,7 +104,7 @@ int srslte_vec_dot_prod_sss_simd(const int16_t *x, const int16_t *y, const int l
   return result; 
 }
 
-void srslte_vec_sum_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
+static void srslte_vec_sum_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
   int i = 0;
 #if SRSLTE_SIMD_S_SIZE
   if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(y) && SRSLTE_IS_ALIGNED(z)) {
@@ -133,7 +133,7 @@ void srslte_vec_sum_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, con
   }
 }
 
-void srslte_vec_sub_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
+static void srslte_vec_sub_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
   int i = 0;
 #if SRSLTE_SIMD_S_SIZE
   if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(y) && SRSLTE_IS_ALIGNED(z)) {
@@ -162,7 +162,7 @@ void srslte_vec_sub_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, con
   }
 }
 
-void srslte_vec_prod_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
+static void srslte_vec_prod_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, const int len) {
   int i = 0;
 #if SRSLTE_SIMD_S_SIZE
   if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(y) && SRSLTE_IS_ALIGNED(z)) {
@@ -192,7 +192,7 @@ void srslte_vec_prod_sss_simd(const int16_t *x, const int16_t *y, int16_t *z, co
 }
 
 /* No improvement with AVX */
-void srslte_vec_lut_sss_simd(const short *x, const unsigned short *lut, short *y, const int len) {
+static void srslte_vec_lut_sss_simd(const short *x, const unsigned short *lut, short *y, const int len) {
   int i = 0;
 #ifdef LV_HAVE_SSE
 #if CMAKE_BUILD_TYPE!=Debug
@@ -228,37 +228,37 @@ void srslte_vec_lut_sss_simd(const short *x, const unsigned short *lut, short *y
   }
 }
 
-void srslte_vec_convert_if_simd(const int16_t *x, float *z, const float scale, const int len) {
+static void srslte_vec_convert_if_simd(const int16_t *x, float *z, const float scale, const int len) {
   int i = 0;
   const float gain = 1.0f / scale;
 
-#ifdef LV_HAVE_SSE
-  __m128 s = _mm_set1_ps(gain);
-  if (SRSLTE_IS_ALIGNED(z)) {
-    for (; i < len - 3; i += 4) {
-      __m64 *ptr = (__m64 *) &x[i];
-      __m128 fl = _mm_cvtpi16_ps(*ptr);
-      __m128 v = _mm_mul_ps(fl, s);
+#if SRSLTE_SIMD_F_SIZE && SRSLTE_SIMD_S_SIZE
+  simd_f_t s = srslte_simd_f_set1(gain);
+  if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(z)) {
+    for (; i < len - SRSLTE_SIMD_S_SIZE + 1; i += SRSLTE_SIMD_S_SIZE) {
+      simd_f_t a, b;
+      srslte_simd_convert_s_2f(srslte_simd_s_load(&x[i]), &a, &b);
 
-      _mm_store_ps(&z[i], v);
+      srslte_simd_f_store(&z[i], srslte_simd_f_mul(a, s));
+      srslte_simd_f_store(&z[i + SRSLTE_SIMD_F_SIZE], srslte_simd_f_mul(b, s));
     }
   } else {
-    for (; i < len - 3; i += 4) {
-      __m64 *ptr = (__m64 *) &x[i];
-      __m128 fl = _mm_cvtpi16_ps(*ptr);
-      __m128 v = _mm_mul_ps(fl, s);
+    for (; i < len - SRSLTE_SIMD_S_SIZE + 1; i += SRSLTE_SIMD_S_SIZE) {
+      simd_f_t a, b;
+      srslte_simd_convert_s_2f(srslte_simd_s_loadu(&x[i]), &a, &b);
 
-      _mm_storeu_ps(&z[i], v);
+      srslte_simd_f_storeu(&z[i], srslte_simd_f_mul(a, s));
+      srslte_simd_f_storeu(&z[i + SRSLTE_SIMD_F_SIZE], srslte_simd_f_mul(b, s));
     }
   }
-#endif /* LV_HAVE_SSE */
+#endif /* SRSLTE_SIMD_F_SIZE && SRSLTE_SIMD_S_SIZE */
 
   for (; i < len; i++) {
     z[i] = ((float) x[i]) * gain;
   }
 }
 
-void srslte_vec_convert_fi_simd(const float *x, int16_t *z, const float scale, const int len) {
+static void srslte_vec_convert_fi_simd(const float *x, int16_t *z, const float scale, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE && SRSLTE_SIMD_S_SIZE
@@ -295,7 +295,7 @@ void srslte_vec_convert_fi_simd(const float *x, int16_t *z, const float scale, c
   }
 }
 
-float srslte_vec_acc_ff_simd(const float *x, const int len) {
+static float srslte_vec_acc_ff_simd(const float *x, const int len) {
   int i = 0;
   float acc_sum = 0.0f;
 
@@ -330,7 +330,7 @@ float srslte_vec_acc_ff_simd(const float *x, const int len) {
   return acc_sum;
 }
 
-cf_t srslte_vec_acc_cc_simd(const cf_t *x, const int len) {
+static cf_t srslte_vec_acc_cc_simd(const cf_t *x, const int len) {
   int i = 0;
   cf_t acc_sum = 0.0f;
 
@@ -364,7 +364,7 @@ cf_t srslte_vec_acc_cc_simd(const cf_t *x, const int len) {
   return acc_sum;
 }
 
-void srslte_vec_add_fff_simd(const float *x, const float *y, float *z, const int len) {
+static void srslte_vec_add_fff_simd(const float *x, const float *y, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -394,7 +394,7 @@ void srslte_vec_add_fff_simd(const float *x, const float *y, float *z, const int
   }
 }
 
-void srslte_vec_sub_fff_simd(const float *x, const float *y, float *z, const int len) {
+static void srslte_vec_sub_fff_simd(const float *x, const float *y, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -424,7 +424,7 @@ void srslte_vec_sub_fff_simd(const float *x, const float *y, float *z, const int
   }
 }
 
-cf_t srslte_vec_dot_prod_ccc_simd(const cf_t *x, const cf_t *y, const int len) {
+static cf_t srslte_vec_dot_prod_ccc_simd(const cf_t *x, const cf_t *y, const int len) {
   int i = 0;
   cf_t result = 0;
 
@@ -464,7 +464,7 @@ cf_t srslte_vec_dot_prod_ccc_simd(const cf_t *x, const cf_t *y, const int len) {
 }
 
 #ifdef ENABLE_C16
-c16_t srslte_vec_dot_prod_ccc_c16i_simd(const c16_t *x, const c16_t *y, const int len) {
+static c16_t srslte_vec_dot_prod_ccc_c16i_simd(const c16_t *x, const c16_t *y, const int len) {
   int i = 0;
   c16_t result = 0;
 
@@ -493,7 +493,7 @@ c16_t srslte_vec_dot_prod_ccc_c16i_simd(const c16_t *x, const c16_t *y, const in
 }
 #endif /* ENABLE_C16 */
 
-cf_t srslte_vec_dot_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, const int len)
+static cf_t srslte_vec_dot_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, const int len)
 {
   int i = 0;
   cf_t result = 0;
@@ -531,7 +531,7 @@ cf_t srslte_vec_dot_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, const int l
   return result;
 }
 
-void srslte_vec_prod_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len) {
+static void srslte_vec_prod_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_CF_SIZE
@@ -559,7 +559,7 @@ void srslte_vec_prod_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int
   }
 }
 
-void srslte_vec_prod_fff_simd(const float *x, const float *y, float *z, const int len) {
+static void srslte_vec_prod_fff_simd(const float *x, const float *y, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -589,7 +589,7 @@ void srslte_vec_prod_fff_simd(const float *x, const float *y, float *z, const in
   }
 }
 
-void srslte_vec_prod_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
+static void srslte_vec_prod_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_CF_SIZE
@@ -619,7 +619,7 @@ void srslte_vec_prod_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int l
   }
 }
 
-void srslte_vec_prod_ccc_split_simd(const float *a_re, const float *a_im, const float *b_re, const float *b_im,
+static void srslte_vec_prod_ccc_split_simd(const float *a_re, const float *a_im, const float *b_re, const float *b_im,
                                     float *r_re, float *r_im, const int len) {
   int i = 0;
 
@@ -653,7 +653,7 @@ void srslte_vec_prod_ccc_split_simd(const float *a_re, const float *a_im, const
 }
 
 #ifdef ENABLE_C16
-void srslte_vec_prod_ccc_c16_simd(const int16_t *a_re, const int16_t *a_im, const int16_t *b_re, const int16_t *b_im,
+static void srslte_vec_prod_ccc_c16_simd(const int16_t *a_re, const int16_t *a_im, const int16_t *b_re, const int16_t *b_im,
                                   int16_t *r_re, int16_t *r_im, const int len) {
   int i = 0;
 
@@ -687,7 +687,7 @@ void srslte_vec_prod_ccc_c16_simd(const int16_t *a_re, const int16_t *a_im, cons
 }
 #endif /* ENABLE_C16 */
 
-void srslte_vec_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
+static void srslte_vec_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_CF_SIZE
@@ -717,7 +717,7 @@ void srslte_vec_prod_conj_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const
   }
 }
 
-void srslte_vec_div_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
+static void srslte_vec_div_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_CF_SIZE
@@ -750,7 +750,7 @@ void srslte_vec_div_ccc_simd(const cf_t *x, const cf_t *y, cf_t *z, const int le
 }
 
 
-void srslte_vec_div_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len) {
+static void srslte_vec_div_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_CF_SIZE && SRSLTE_SIMD_CF_SIZE == SRSLTE_SIMD_F_SIZE
@@ -782,7 +782,7 @@ void srslte_vec_div_cfc_simd(const cf_t *x, const float *y, cf_t *z, const int l
   }
 }
 
-void srslte_vec_div_fff_simd(const float *x, const float *y, float *z, const int len) {
+static void srslte_vec_div_fff_simd(const float *x, const float *y, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -816,11 +816,11 @@ void srslte_vec_div_fff_simd(const float *x, const float *y, float *z, const int
 
 
 
-int  srslte_vec_sc_prod_ccc_simd2(const cf_t *x, const cf_t h, cf_t *z, const int len)
+#ifdef HAVE_NEON
+static int srslte_vec_sc_prod_ccc_simd2(const cf_t *x, const cf_t h, cf_t *z, const int len)
 {     
    int i = 0;
    const unsigned int loops = len / 4;
-#ifdef HAVE_NEON
   simd_cf_t h_vec; 
     h_vec.val[0] = srslte_simd_f_set1(__real__ h);
     h_vec.val[1] = srslte_simd_f_set1(__imag__ h);
@@ -831,12 +831,12 @@ int  srslte_vec_sc_prod_ccc_simd2(const cf_t *x, const cf_t h, cf_t *z, const in
     srslte_simd_cfi_store(&z[i*4], temp);
   }
           
-#endif  
   i = loops * 4;
 return i;
 }
+#endif
 
-void srslte_vec_sc_prod_ccc_simd(const cf_t *x, const cf_t h, cf_t *z, const int len) {
+static void srslte_vec_sc_prod_ccc_simd(const cf_t *x, const cf_t h, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -879,7 +879,7 @@ void srslte_vec_sc_prod_ccc_simd(const cf_t *x, const cf_t h, cf_t *z, const int
   
 }
 
-void srslte_vec_sc_prod_fff_simd(const float *x, const float h, float *z, const int len) {
+static void srslte_vec_sc_prod_fff_simd(const float *x, const float h, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -908,7 +908,7 @@ void srslte_vec_sc_prod_fff_simd(const float *x, const float h, float *z, const
   }
 }
 
-void srslte_vec_abs_cf_simd(const cf_t *x, float *z, const int len) {
+static void srslte_vec_abs_cf_simd(const cf_t *x, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -945,7 +945,7 @@ void srslte_vec_abs_cf_simd(const cf_t *x, float *z, const int len) {
   }
 }
 
-void srslte_vec_abs_square_cf_simd(const cf_t *x, float *z, const int len) {
+static void srslte_vec_abs_square_cf_simd(const cf_t *x, float *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -982,7 +982,7 @@ void srslte_vec_abs_square_cf_simd(const cf_t *x, float *z, const int len) {
 }
 
 
-void srslte_vec_sc_prod_cfc_simd(const cf_t *x, const float h, cf_t *z, const int len) {
+static void srslte_vec_sc_prod_cfc_simd(const cf_t *x, const float h, cf_t *z, const int len) {
   int i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -1012,7 +1012,7 @@ void srslte_vec_sc_prod_cfc_simd(const cf_t *x, const float h, cf_t *z, const in
   }
 }
 
-void srslte_vec_cp_simd(const cf_t *src, cf_t *dst, const int len) {
+static void srslte_vec_cp_simd(const cf_t *src, cf_t *dst, const int len) {
   uint32_t i = 0;
 
 #if SRSLTE_SIMD_F_SIZE
@@ -1036,7 +1036,7 @@ void srslte_vec_cp_simd(const cf_t *src, cf_t *dst, const int len) {
   }
 }
 
-uint32_t srslte_vec_max_fi_simd(const float *x, const int len) {
+static uint32_t srslte_vec_max_fi_simd(const float *x, const int len) {
   int i = 0;
 
   float max_value = -INFINITY;
@@ -1092,7 +1092,7 @@ uint32_t srslte_vec_max_fi_simd(const float *x, const int len) {
   return max_index;
 }
 
-uint32_t srslte_vec_max_ci_simd(const cf_t *x, const int len) {
+static uint32_t srslte_vec_max_ci_simd(const cf_t *x, const int len) {
   int i = 0;
 
   float max_value = -INFINITY;
@@ -1166,7 +1166,7 @@ uint32_t srslte_vec_max_ci_simd(const cf_t *x, const int len) {
   return max_index;
 }
 
-void srslte_vec_interleave_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
+static void srslte_vec_interleave_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
   uint32_t i = 0, k = 0;
 
 #ifdef LV_HAVE_SSE
@@ -1205,7 +1205,7 @@ void srslte_vec_interleave_simd(const cf_t *x, const cf_t *y, cf_t *z, const int
   }
 }
 
-void srslte_vec_interleave_add_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
+static void srslte_vec_interleave_add_simd(const cf_t *x, const cf_t *y, cf_t *z, const int len) {
   uint32_t i = 0, k = 0;
 
 #ifdef LV_HAVE_SSE
@@ -1251,3 +1251,56 @@ void srslte_vec_interleave_add_simd(const cf_t *x, const cf_t *y, cf_t *z, const
     z[k++] += y[i];
   }
 }
+
+/* This file is built once per variant, with SRSLTE_SIMD_VARIANT set to the
+ * variant name and the LV_HAVE_* flags of its instruction set */
+#ifndef SRSLTE_SIMD_VARIANT
+#define SRSLTE_SIMD_VARIANT native
+#endif
+
+#define VEC_SIMD_STR_(v) #v
+#define VEC_SIMD_STR(v) VEC_SIMD_STR_(v)
+#define VEC_SIMD_TABLE_(v) srslte_vec_simd_ ## v
+#define VEC_SIMD_TABLE(v) VEC_SIMD_TABLE_(v)
+
+const srslte_vec_simd_t VEC_SIMD_TABLE(SRSLTE_SIMD_VARIANT) = {
+    .name              = VEC_SIMD_STR(SRSLTE_SIMD_VARIANT),
+    .xor_bbb           = srslte_vec_xor_bbb_simd,
+    .sum_sss           = srslte_vec_sum_sss_simd,
+    .sub_sss           = srslte_vec_sub_sss_simd,
+    .acc_ff            = srslte_vec_acc_ff_simd,
+    .acc_cc            = srslte_vec_acc_cc_simd,
+    .add_fff           = srslte_vec_add_fff_simd,
+    .sub_fff           = srslte_vec_sub_fff_simd,
+    .sc_prod_cfc       = srslte_vec_sc_prod_cfc_simd,
+    .sc_prod_fff       = srslte_vec_sc_prod_fff_simd,
+    .sc_prod_ccc       = srslte_vec_sc_prod_ccc_simd,
+    .prod_ccc_split    = srslte_vec_prod_ccc_split_simd,
+#ifdef ENABLE_C16
+    .prod_ccc_c16      = srslte_vec_prod_ccc_c16_simd,
+#endif /* ENABLE_C16 */
+    .prod_sss          = srslte_vec_prod_sss_simd,
+    .prod_cfc          = srslte_vec_prod_cfc_simd,
+    .prod_fff          = srslte_vec_prod_fff_simd,
+    .prod_ccc          = srslte_vec_prod_ccc_simd,
+    .prod_conj_ccc     = srslte_vec_prod_conj_ccc_simd,
+    .div_ccc           = srslte_vec_div_ccc_simd,
+    .div_cfc           = srslte_vec_div_cfc_simd,
+    .div_fff           = srslte_vec_div_fff_simd,
+    .dot_prod_conj_ccc = srslte_vec_dot_prod_conj_ccc_simd,
+    .dot_prod_ccc      = srslte_vec_dot_prod_ccc_simd,
+#ifdef ENABLE_C16
+    .dot_prod_ccc_c16i = srslte_vec_dot_prod_ccc_c16i_simd,
+#endif /* ENABLE_C16 */
+    .dot_prod_sss      = srslte_vec_dot_prod_sss_simd,
+    .abs_cf            = srslte_vec_abs_cf_simd,
+    .abs_square_cf     = srslte_vec_abs_square_cf_simd,
+    .lut_sss           = srslte_vec_lut_sss_simd,
+    .convert_if        = srslte_vec_convert_if_simd,
+    .convert_fi        = srslte_vec_convert_fi_simd,
+    .cp                = srslte_vec_cp_simd,
+    .interleave        = srslte_vec_interleave_simd,
+    .interleave_add    = srslte_vec_interleave_add_simd,
+    .max_fi            = srslte_vec_max_fi_simd,
+    .max_ci            = srslte_vec_max_ci_simd,
+};
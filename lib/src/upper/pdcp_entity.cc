@@ -44,8 +44,6 @@ pdcp_entity::pdcp_entity()
   do_integrity = false;
   do_encryption = false;
   rx_count = 0;
-  cipher_algo = CIPHERING_ALGORITHM_ID_EEA0;
-  integ_algo = INTEGRITY_ALGORITHM_ID_EIA0;
 }
 
 void pdcp_entity::init(srsue::rlc_interface_pdcp      *rlc_,
@@ -143,13 +141,8 @@ void pdcp_entity::config_security(uint8_t *k_enc_,
                                   CIPHERING_ALGORITHM_ID_ENUM cipher_algo_,
                                   INTEGRITY_ALGORITHM_ID_ENUM integ_algo_)
 {
-  for(int i=0; i<32; i++)
-  {
-    k_enc[i] = k_enc_[i];
-    k_int[i] = k_int_[i];
-  }
-  cipher_algo = cipher_algo_;
-  integ_algo  = integ_algo_;
+  // Expands the AES key schedules once for all the PDUs of the bearer
+  sec_ctx.config(k_enc_, k_int_, cipher_algo_, integ_algo_);
 }
 
 void pdcp_entity::enable_integrity()
@@ -218,33 +211,12 @@ void pdcp_entity::integrity_generate( uint8_t  *msg,
                                       uint32_t  msg_len,
                                       uint8_t  *mac)
 {
-  uint8_t bearer;
-
-  switch(integ_algo)
-  {
-  case INTEGRITY_ALGORITHM_ID_EIA0:
-    break;
-  case INTEGRITY_ALGORITHM_ID_128_EIA1:
-    security_128_eia1(&k_int[16],
-                      tx_count,
-                      get_bearer_id(lcid),
-                      cfg.direction,
-                      msg,
-                      msg_len,
-                      mac);
-    break;
-  case INTEGRITY_ALGORITHM_ID_128_EIA2:
-    security_128_eia2(&k_int[16],
-                      tx_count,
-                      get_bearer_id(lcid),
-                      cfg.direction,
-                      msg,
-                      msg_len,
-                      mac);
-    break;
-  default:
-    break;
-  }
+  sec_ctx.integrity(tx_count,
+                    get_bearer_id(lcid),
+                    cfg.direction,
+                    msg,
+                    msg_len,
+                    mac);
 }
 
 bool pdcp_entity::integrity_verify(uint8_t  *msg,
@@ -256,33 +228,14 @@ bool pdcp_entity::integrity_verify(uint8_t  *msg,
   uint8_t i = 0;
   bool isValid = true;
 
-  switch(integ_algo)
-  {
-  case INTEGRITY_ALGORITHM_ID_EIA0:
-    break;
-  case INTEGRITY_ALGORITHM_ID_128_EIA1:
-    security_128_eia1(&k_int[16],
-                      count,
-                      get_bearer_id(lcid),
-                      (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
-                      msg,
-                      msg_len,
-                      mac_exp);
-    break;
-  case INTEGRITY_ALGORITHM_ID_128_EIA2:
-    security_128_eia2(&k_int[16],
-                      count,
-                      get_bearer_id(lcid),
-                      (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
-                      msg,
-                      msg_len,
-                      mac_exp);
-    break;
-  default:
-    break;
-  }
+  sec_ctx.integrity(count,
+                    get_bearer_id(lcid),
+                    (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
+                    msg,
+                    msg_len,
+                    mac_exp);
 
-  switch(integ_algo)
+  switch(sec_ctx.get_integ_algo())
   {
   case INTEGRITY_ALGORITHM_ID_EIA0:
     break;
@@ -312,34 +265,13 @@ void pdcp_entity::cipher_encrypt(uint8_t  *msg,
                                  uint32_t  msg_len,
                                  uint8_t  *ct)
 {
-  byte_buffer_t ct_tmp;
-  switch(cipher_algo)
-  {
-  case CIPHERING_ALGORITHM_ID_EEA0:
-    break;
-  case CIPHERING_ALGORITHM_ID_128_EEA1:
-    security_128_eea1(&(k_enc[16]),
-                      tx_count,
-                      get_bearer_id(lcid),
-                      cfg.direction,
-                      msg,
-                      msg_len,
-                      ct_tmp.msg);
-    memcpy(ct, ct_tmp.msg, msg_len);
-    break;
-  case CIPHERING_ALGORITHM_ID_128_EEA2:
-    security_128_eea2(&(k_enc[16]),
-                      tx_count,
-                      get_bearer_id(lcid),
-                      cfg.direction,
-                      msg,
-                      msg_len,
-                      ct_tmp.msg);
-    memcpy(ct, ct_tmp.msg, msg_len);
-    break;
-  default:
-    break;
-  }
+  // EEA1 and EEA2 are stream ciphers and may run in place (ct == msg)
+  sec_ctx.cipher(tx_count,
+                 get_bearer_id(lcid),
+                 cfg.direction,
+                 msg,
+                 msg_len,
+                 ct);
 }
 
 void pdcp_entity::cipher_decrypt(uint8_t  *ct,
@@ -347,34 +279,13 @@ void pdcp_entity::cipher_decrypt(uint8_t  *ct,
                                  uint32_t  ct_len,
                                  uint8_t  *msg)
 {
-  byte_buffer_t msg_tmp;
-  switch(cipher_algo)
-  {
-  case CIPHERING_ALGORITHM_ID_EEA0:
-    break;
-  case CIPHERING_ALGORITHM_ID_128_EEA1:
-    security_128_eea1(&(k_enc[16]),
-                      count,
-                      get_bearer_id(lcid),
-                      (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
-                      ct,
-                      ct_len,
-                      msg_tmp.msg);
-    memcpy(msg, msg_tmp.msg, ct_len);
-    break;
-  case CIPHERING_ALGORITHM_ID_128_EEA2:
-    security_128_eea2(&(k_enc[16]),
-                      count,
-                      get_bearer_id(lcid),
-                      (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
-                      ct,
-                      ct_len,
-                      msg_tmp.msg);
-    memcpy(msg, msg_tmp.msg, ct_len);
-    break;
-  default:
-    break;
-  }
+  // EEA1 and EEA2 are stream ciphers and may run in place (msg == ct)
+  sec_ctx.cipher(count,
+                 get_bearer_id(lcid),
+                 (cfg.direction == SECURITY_DIRECTION_DOWNLINK) ? (SECURITY_DIRECTION_UPLINK) : (SECURITY_DIRECTION_DOWNLINK),
+                 ct,
+                 ct_len,
+                 msg);
 }
 
 
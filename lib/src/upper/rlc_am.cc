@@ -34,6 +34,10 @@
 #define RX_MOD_BASE(x) ((x-vr_r)%1024)
 #define TX_MOD_BASE(x) ((x-vt_a)%1024)
 
+// SDU segments shorter than this are copied into the PDU rather than
+// referenced, so that many small SDUs do not hold many pool buffers
+#define RLC_AM_MIN_SDU_REF_BYTES 256
+
 namespace srslte {
 
 rlc_am::rlc_am() : tx_sdu_queue(16)
@@ -174,7 +178,7 @@ void rlc_am::reset()
   // Drop all messages in TX window
   std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
   for(txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-    pool->deallocate(txit->second.buf);
+    txit->second.buf.clear();
   }
   tx_window.clear();
 
@@ -286,7 +290,7 @@ uint32_t rlc_am::get_buffer_state()
         rlc_amd_retx_t retx;
         retx.is_segment = false;
         retx.so_start = 0;
-        retx.so_end = tx_window[vt_s - 1].buf->N_bytes;
+        retx.so_end = tx_window[vt_s - 1].buf.N_bytes;
         retx.sn = vt_s - 1;
         retx_queue.push_back(retx);
       } else {
@@ -354,12 +358,12 @@ int rlc_am::read_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   // if tx_window is full and retx_queue empty, retransmit next PDU to be ack'ed
   if (tx_window.size() >= RLC_AM_WINDOW_SIZE && retx_queue.size() == 0) {
-    if (tx_window[vt_a].buf != NULL) {
+    if (tx_window[vt_a].buf.N_bytes > 0) {
       log->warning("Full Tx window, ReTx'ing first outstanding PDU\n");
       rlc_amd_retx_t retx;
       retx.is_segment = false;
       retx.so_start   = 0;
-      retx.so_end     = tx_window[vt_a].buf->N_bytes;
+      retx.so_end     = tx_window[vt_a].buf.N_bytes;
       retx.sn         = vt_a;
       retx_queue.push_back(retx);
     } else {
@@ -551,7 +555,7 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   // Set poll bit
   pdu_without_poll++;
-  byte_without_poll += (tx_window[retx.sn].buf->N_bytes + rlc_am_packed_length(&new_header));
+  byte_without_poll += (tx_window[retx.sn].buf.N_bytes + rlc_am_packed_length(&new_header));
   log->info("%s pdu_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), pdu_without_poll);
   log->info("%s byte_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), byte_without_poll);
   if(poll_required())
@@ -565,7 +569,7 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&new_header, &ptr);
-  memcpy(ptr, tx_window[retx.sn].buf->msg, tx_window[retx.sn].buf->N_bytes);
+  tx_window[retx.sn].buf.read(ptr, 0, tx_window[retx.sn].buf.N_bytes);
 
   retx_queue.pop_front();
   tx_window[retx.sn].retx_count++;
@@ -575,18 +579,18 @@ int  rlc_am::build_retx_pdu(uint8_t *payload, uint32_t nof_bytes)
             rrc->get_rb_name(lcid).c_str(), retx.sn, tx_window[retx.sn].retx_count);
 
   debug_state();
-  return (ptr-payload) + tx_window[retx.sn].buf->N_bytes;
+  return (ptr-payload) + tx_window[retx.sn].buf.N_bytes;
 }
 
 int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t retx)
 {
-  if (!tx_window[retx.sn].buf) {
+  if (tx_window[retx.sn].buf.N_bytes == 0) {
     log->error("In build_segment: retx.sn=%d has null buffer\n", retx.sn);
     return 0;
   }
   if(!retx.is_segment){
     retx.so_start = 0;
-    retx.so_end   = tx_window[retx.sn].buf->N_bytes;
+    retx.so_end   = tx_window[retx.sn].buf.N_bytes;
   }
 
   // Construct new header
@@ -594,7 +598,7 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
   rlc_amd_pdu_header_t old_header = tx_window[retx.sn].header;
 
   pdu_without_poll++;
-  byte_without_poll += (tx_window[retx.sn].buf->N_bytes + rlc_am_packed_length(&new_header));
+  byte_without_poll += (tx_window[retx.sn].buf.N_bytes + rlc_am_packed_length(&new_header));
   log->info("%s pdu_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), pdu_without_poll);
   log->info("%s byte_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), byte_without_poll);
 
@@ -671,7 +675,7 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
   }
 
   // Update retx_queue
-  if(tx_window[retx.sn].buf->N_bytes == retx.so_end) {
+  if(tx_window[retx.sn].buf.N_bytes == retx.so_end) {
     retx_queue.pop_front();
     new_header.lsf = 1;
     if(rlc_am_end_aligned(old_header.fi))
@@ -688,9 +692,8 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
   // Write header and pdu
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&new_header, &ptr);
-  uint8_t* data = &tx_window[retx.sn].buf->msg[retx.so_start];
   uint32_t len  = retx.so_end - retx.so_start;
-  memcpy(ptr, data, len);
+  tx_window[retx.sn].buf.read(ptr, retx.so_start, len);
 
   log->info("%s Retx PDU segment scheduled for tx. SN: %d, SO: %d\n",
             rrc->get_rb_name(lcid).c_str(), retx.sn, retx.so_start);
@@ -707,6 +710,14 @@ int rlc_am::build_segment(uint8_t *payload, uint32_t nof_bytes, rlc_amd_retx_t r
 
 }
 
+void rlc_am::append_sdu_segment(byte_buffer_list_t *pdu, uint32_t len)
+{
+  if (len < RLC_AM_MIN_SDU_REF_BYTES && pdu->append_copy(tx_sdu->msg, len)) {
+    return;
+  }
+  pdu->append(tx_sdu, tx_sdu->msg, len);
+}
+
 int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 {
   if(!tx_sdu && tx_sdu_queue.size() == 0)
@@ -721,26 +732,6 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate;
-  if (!pdu) {
-#ifdef RLC_AM_BUFFER_DEBUG
-    log->console("Fatal Error: Could not allocate PDU in build_data_pdu()\n");
-    log->console("tx_window size: %d PDUs\n", tx_window.size());
-    log->console("vt_a = %d, vt_ms = %d, vt_s = %d, poll_sn = %d "
-                 "vr_r = %d, vr_mr = %d, vr_x = %d, vr_ms = %d, vr_h = %d\n",
-                 vt_a, vt_ms, vt_s, poll_sn,
-                 vr_r, vr_mr, vr_x, vr_ms, vr_h);
-    log->console("retx_queue size: %d PDUs\n", retx_queue.size());
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
-    for(txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-      log->console("tx_window - SN: %d\n", txit->first);
-    }
-    exit(-1);
-#else
-    log->error("Fatal Error: Couldn't allocate PDU in build_data_pdu().\n");
-    return 0;
-#endif
-  }
   rlc_amd_pdu_header_t header;
   header.dc   = RLC_DC_FIELD_DATA_PDU;
   header.rf   = 0;
@@ -755,13 +746,12 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   uint32_t to_move   = 0;
   uint32_t last_li   = 0;
   uint32_t pdu_space = nof_bytes;
-  uint8_t *pdu_ptr   = pdu->msg;
+  byte_buffer_list_t pdu;
 
   if(pdu_space <= head_len + 1)
   {
     log->warning("%s Cannot build a PDU - %d bytes available, %d bytes required for header\n",
                  rrc->get_rb_name(lcid).c_str(), nof_bytes, head_len);
-    pool->deallocate(pdu);
     return 0;
   }
 
@@ -772,10 +762,8 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   if(tx_sdu)
   {
     to_move = ((pdu_space-head_len) >= tx_sdu->N_bytes) ? tx_sdu->N_bytes : pdu_space-head_len;
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+    append_sdu_segment(&pdu, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
     tx_sdu->N_bytes -= to_move;
     tx_sdu->msg     += to_move;
     if(tx_sdu->N_bytes == 0)
@@ -807,10 +795,8 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     }
     tx_sdu_queue.read(&tx_sdu);
     to_move = ((pdu_space-head_len) >= tx_sdu->N_bytes) ? tx_sdu->N_bytes : pdu_space-head_len;
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+    append_sdu_segment(&pdu, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
     tx_sdu->N_bytes -= to_move;
     tx_sdu->msg     += to_move;
     if(tx_sdu->N_bytes == 0)
@@ -830,7 +816,7 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   }
 
   // Make sure, at least one SDU (segment) has been added until this point
-  if (pdu->N_bytes == 0) {
+  if (pdu.N_bytes == 0) {
     log->error("Generated empty RLC PDU.\n");
     return 0;
   }
@@ -840,7 +826,7 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   // Set Poll bit
   pdu_without_poll++;
-  byte_without_poll += (pdu->N_bytes + head_len);
+  byte_without_poll += (pdu.N_bytes + head_len);
   log->debug("%s pdu_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), pdu_without_poll);
   log->debug("%s byte_without_poll: %d\n", rrc->get_rb_name(lcid).c_str(), byte_without_poll);
   if(poll_required())
@@ -857,19 +843,21 @@ int  rlc_am::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   header.sn = vt_s;
   vt_s = (vt_s + 1)%MOD;
 
-  // Place PDU in tx_window, write header and TX
-  tx_window[header.sn].buf        = pdu;
-  tx_window[header.sn].header     = header;
-  tx_window[header.sn].is_acked   = false;
-  tx_window[header.sn].retx_count = 0;
+  // Place PDU in tx_window, write header and gather the SDU segments into
+  // the MAC payload. This is the only copy of the data on the TX path.
+  rlc_amd_tx_pdu_t *tx_pdu = &tx_window[header.sn];
+  tx_pdu->buf.swap(pdu);
+  tx_pdu->header     = header;
+  tx_pdu->is_acked   = false;
+  tx_pdu->retx_count = 0;
 
   uint8_t *ptr = payload;
   rlc_am_write_data_pdu_header(&header, &ptr);
-  memcpy(ptr, pdu->msg, pdu->N_bytes);
-  log->info_hex(payload, pdu->N_bytes, "%s PDU scheduled for tx. SN: %d (%d B)\n", rrc->get_rb_name(lcid).c_str(), header.sn, pdu->N_bytes);
+  tx_pdu->buf.read(ptr, 0, tx_pdu->buf.N_bytes);
+  log->info_hex(payload, tx_pdu->buf.N_bytes, "%s PDU scheduled for tx. SN: %d (%d B)\n", rrc->get_rb_name(lcid).c_str(), header.sn, tx_pdu->buf.N_bytes);
 
   debug_state();
-  return (ptr-payload) + pdu->N_bytes;
+  return (ptr-payload) + tx_pdu->buf.N_bytes;
 }
 
 void rlc_am::handle_data_pdu(uint8_t *payload, uint32_t nof_bytes, rlc_amd_pdu_header_t &header)
@@ -1092,32 +1080,32 @@ void rlc_am::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
             rlc_amd_retx_t retx;
             retx.is_segment = false;
             retx.so_start   = 0;
-            retx.so_end     = it->second.buf->N_bytes;
+            retx.so_end     = it->second.buf.N_bytes;
 
             if(status.nacks[j].has_so) {
               // sanity check
-              if (status.nacks[j].so_start >= it->second.buf->N_bytes) {
+              if (status.nacks[j].so_start >= it->second.buf.N_bytes) {
                 // print error but try to send original PDU again
                 log->error("SO_start is larger than original PDU (%d >= %d)\n",
                            status.nacks[j].so_start,
-                           it->second.buf->N_bytes);
+                           it->second.buf.N_bytes);
                 status.nacks[j].so_start = 0;
               }
 
               // check for special SO_end value
               if(status.nacks[j].so_end == 0x7FFF) {
-                status.nacks[j].so_end = it->second.buf->N_bytes;
+                status.nacks[j].so_end = it->second.buf.N_bytes;
               }else{
                 retx.so_end = status.nacks[j].so_end + 1;
               }
 
-              if(status.nacks[j].so_start <  it->second.buf->N_bytes &&
-                 status.nacks[j].so_end   <= it->second.buf->N_bytes) {
+              if(status.nacks[j].so_start <  it->second.buf.N_bytes &&
+                 status.nacks[j].so_end   <= it->second.buf.N_bytes) {
                   retx.is_segment = true;
                   retx.so_start = status.nacks[j].so_start;
               } else {
                 log->warning("%s invalid segment NACK received for SN %d. so_start: %d, so_end: %d, N_bytes: %d\n",
-                             rrc->get_rb_name(lcid).c_str(), i, status.nacks[j].so_start, status.nacks[j].so_end, it->second.buf->N_bytes);
+                             rrc->get_rb_name(lcid).c_str(), i, status.nacks[j].so_start, status.nacks[j].so_end, it->second.buf.N_bytes);
               }
             }
 
@@ -1134,10 +1122,6 @@ void rlc_am::handle_control_pdu(uint8_t *payload, uint32_t nof_bytes)
         it = tx_window.find(i);
         if (it != tx_window.end()) {
           if(update_vt_a) {
-            if(it->second.buf) {
-              pool->deallocate(it->second.buf);
-              it->second.buf = 0;
-            }
             tx_window.erase(it);
             vt_a = (vt_a + 1)%MOD;
             vt_ms = (vt_ms + 1)%MOD;
@@ -1379,8 +1363,8 @@ int rlc_am::required_buffer_size(rlc_amd_retx_t retx)
 {
   if(!retx.is_segment){
     if (tx_window.count(retx.sn)) {
-      if (tx_window[retx.sn].buf) {
-        return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].buf->N_bytes;
+      if (tx_window[retx.sn].buf.N_bytes > 0) {
+        return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].buf.N_bytes;
       } else {
         log->warning("retx.sn=%d has null ptr in required_buffer_size()\n", retx.sn);
         return -1;
@@ -1439,7 +1423,7 @@ int rlc_am::required_buffer_size(rlc_amd_retx_t retx)
     lower += old_header.li[i];
   }
 
-//  if(tx_window[retx.sn].buf->N_bytes != retx.so_end) {
+//  if(tx_window[retx.sn].buf.N_bytes != retx.so_end) {
 //    if(new_header.N_li > 0)
 //      new_header.N_li--; // No li for last segment
 //  }
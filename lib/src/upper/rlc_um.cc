@@ -277,12 +277,6 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     return 0;
   }
 
-  byte_buffer_t *pdu = pool_allocate;
-  if(!pdu || pdu->N_bytes != 0)
-  {
-    log->error("Failed to allocate PDU buffer\n");
-    return 0;
-  }
   rlc_umd_pdu_header_t header;
   header.fi   = RLC_FI_FIELD_START_AND_END_ALIGNED;
   header.sn   = vt_us;
@@ -291,14 +285,12 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
 
   uint32_t to_move   = 0;
   uint32_t last_li   = 0;
-  uint8_t *pdu_ptr   = pdu->msg;
 
   int head_len  = rlc_um_packed_length(&header);
   int pdu_space = nof_bytes;
 
   if(pdu_space <= head_len + 1)
   {
-    pool->deallocate(pdu);
     log->warning("%s Cannot build a PDU - %d bytes available, %d bytes required for header\n",
                  rrc->get_rb_name(lcid).c_str(), nof_bytes, head_len);
     return 0;
@@ -311,10 +303,8 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     to_move = space >= tx_sdu->N_bytes ? tx_sdu->N_bytes : space;
     log->debug("%s adding remainder of SDU segment - %d bytes of %d remaining\n",
                rrc->get_rb_name(lcid).c_str(), to_move, tx_sdu->N_bytes);
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+    tx_pdu.append(tx_sdu, tx_sdu->msg, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
     tx_sdu->N_bytes -= to_move;
     tx_sdu->msg     += to_move;
     if(tx_sdu->N_bytes == 0)
@@ -340,10 +330,8 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
     to_move = space >= tx_sdu->N_bytes ? tx_sdu->N_bytes : space;
     log->debug("%s adding new SDU segment - %d bytes of %d remaining\n",
                rrc->get_rb_name(lcid).c_str(), to_move, tx_sdu->N_bytes);
-    memcpy(pdu_ptr, tx_sdu->msg, to_move);
+    tx_pdu.append(tx_sdu, tx_sdu->msg, to_move);
     last_li          = to_move;
-    pdu_ptr         += to_move;
-    pdu->N_bytes    += to_move;
     tx_sdu->N_bytes -= to_move;
     tx_sdu->msg     += to_move;
     if(tx_sdu->N_bytes == 0)
@@ -363,13 +351,14 @@ int  rlc_um::build_data_pdu(uint8_t *payload, uint32_t nof_bytes)
   header.sn = vt_us;
   vt_us = (vt_us + 1)%cfg.tx_mod;
 
-  // Add header and TX
-  log->debug("%s packing PDU with length %d\n", rrc->get_rb_name(lcid).c_str(), pdu->N_bytes);
-  rlc_um_write_data_pdu_header(&header, pdu);
-  memcpy(payload, pdu->msg, pdu->N_bytes);
-  uint32_t ret = pdu->N_bytes;
-  log->debug("%s returning length %d\n", rrc->get_rb_name(lcid).c_str(), pdu->N_bytes);
-  pool->deallocate(pdu);
+  // Write header and gather the SDU segments straight into the MAC payload
+  log->debug("%s packing PDU with length %d\n", rrc->get_rb_name(lcid).c_str(), tx_pdu.N_bytes);
+  uint8_t *ptr = payload;
+  rlc_um_write_data_pdu_header(&header, &ptr);
+  ptr += tx_pdu.read(ptr, 0, tx_pdu.N_bytes);
+  uint32_t ret = ptr - payload;
+  log->debug("%s returning length %d\n", rrc->get_rb_name(lcid).c_str(), ret);
+  tx_pdu.clear();
 
   debug_state();
   return ret;
@@ -667,13 +656,20 @@ void rlc_um_read_data_pdu_header(uint8_t *payload, uint32_t nof_bytes, rlc_umd_s
 
 void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *pdu)
 {
-  uint32_t i;
-  uint8_t ext = (header->N_li > 0) ? 1 : 0;
-
   // Make room for the header
   uint32_t len = rlc_um_packed_length(header);
   pdu->msg -= len;
   uint8_t *ptr = pdu->msg;
+  rlc_um_write_data_pdu_header(header, &ptr);
+  pdu->N_bytes += ptr-pdu->msg;
+}
+
+// Write header to pointer & move pointer
+void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, uint8_t **payload)
+{
+  uint32_t i;
+  uint8_t ext = (header->N_li > 0) ? 1 : 0;
+  uint8_t *ptr = *payload;
 
   // Fixed part
   if(RLC_UMD_SN_SIZE_5_BITS == header->sn_size)
@@ -716,7 +712,7 @@ void rlc_um_write_data_pdu_header(rlc_umd_pdu_header_t *header, byte_buffer_t *p
   if(header->N_li%2 == 1)
     ptr++;
 
-  pdu->N_bytes += ptr-pdu->msg;
+  *payload = ptr;
 }
 
 uint32_t rlc_um_packed_length(rlc_umd_pdu_header_t *header)
@@ -0,0 +1,271 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/asn1/liblte_s1ap.h"
+#include "srslte/asn1/liblte_rrc.h"
+
+/* Measures the messages per second that can be unpacked and packed for S1AP
+ * and RRC CCCH/DCCH messages of an attach, as done by the MME, the eNodeB
+ * and the UE for every received and sent message.
+ */
+
+uint32_t nof_reps = 20000;
+
+void usage(char *prog) {
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n number of repetitions [Default %d]\n", nof_reps);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "n")) != -1) {
+    switch(opt) {
+    case 'n':
+      nof_reps = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+static const uint8_t initialuemessage[] = {
+  0x00, 0x0c, 0x40, 0x5c, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x1a, 0x00, 0x2a, 0x29, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0,
+  0xe5, 0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c,
+  0xa1, 0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38,
+  0x5d, 0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0x00,
+  0x43, 0x00, 0x06, 0x00, 0x00, 0xf1, 0x10, 0x00, 0x07, 0x00, 0x64, 0x40,
+  0x08, 0x00, 0x00, 0xf1, 0x10, 0x00, 0x19, 0xb0, 0x10, 0x00, 0x86, 0x40,
+  0x01, 0x30, 0x00, 0x60, 0x00, 0x06, 0x06, 0x80, 0xc0, 0x00, 0x00, 0x01,};
+
+static const uint8_t uplinknastransport[] = {
+  0x00, 0x0d, 0x40, 0x81, 0x5a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04,
+  0x80, 0x01, 0x11, 0x70, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1a,
+  0x00, 0x81, 0x2e, 0x81, 0x2c, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0, 0xe5,
+  0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c, 0xa1,
+  0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38, 0x5d,
+  0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0xf4, 0x19,
+  0x3e, 0x63, 0x88, 0xad, 0xd2, 0xf7, 0x1c, 0x41, 0x66, 0x8b, 0xb0, 0xd5,
+  0xfa, 0x1f, 0x44, 0x69, 0x8e, 0xb3, 0xd8, 0xfd, 0x22, 0x47, 0x6c, 0x91,
+  0xb6, 0xdb, 0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb9, 0xde, 0x03, 0x28, 0x4d,
+  0x72, 0x97, 0xbc, 0xe1, 0x06, 0x2b, 0x50, 0x75, 0x9a, 0xbf, 0xe4, 0x09,
+  0x2e, 0x53, 0x78, 0x9d, 0xc2, 0xe7, 0x0c, 0x31, 0x56, 0x7b, 0xa0, 0xc5,
+  0xea, 0x0f, 0x34, 0x59, 0x7e, 0xa3, 0xc8, 0xed, 0x12, 0x37, 0x5c, 0x81,
+  0xa6, 0xcb, 0xf0, 0x15, 0x3a, 0x5f, 0x84, 0xa9, 0xce, 0xf3, 0x18, 0x3d,
+  0x62, 0x87, 0xac, 0xd1, 0xf6, 0x1b, 0x40, 0x65, 0x8a, 0xaf, 0xd4, 0xf9,
+  0x1e, 0x43, 0x68, 0x8d, 0xb2, 0xd7, 0xfc, 0x21, 0x46, 0x6b, 0x90, 0xb5,
+  0xda, 0xff, 0x24, 0x49, 0x6e, 0x93, 0xb8, 0xdd, 0x02, 0x27, 0x4c, 0x71,
+  0x96, 0xbb, 0xe0, 0x05, 0x2a, 0x4f, 0x74, 0x99, 0xbe, 0xe3, 0x08, 0x2d,
+  0x52, 0x77, 0x9c, 0xc1, 0xe6, 0x0b, 0x30, 0x55, 0x7a, 0x9f, 0xc4, 0xe9,
+  0x0e, 0x33, 0x58, 0x7d, 0xa2, 0xc7, 0xec, 0x11, 0x36, 0x5b, 0x80, 0xa5,
+  0xca, 0xef, 0x14, 0x39, 0x5e, 0x83, 0xa8, 0xcd, 0xf2, 0x17, 0x3c, 0x61,
+  0x86, 0xab, 0xd0, 0xf5, 0x1a, 0x3f, 0x64, 0x89, 0xae, 0xd3, 0xf8, 0x1d,
+  0x42, 0x67, 0x8c, 0xb1, 0xd6, 0xfb, 0x20, 0x45, 0x6a, 0x8f, 0xb4, 0xd9,
+  0xfe, 0x23, 0x48, 0x6d, 0x92, 0xb7, 0xdc, 0x01, 0x26, 0x4b, 0x70, 0x95,
+  0xba, 0xdf, 0x04, 0x29, 0x4e, 0x73, 0x98, 0xbd, 0xe2, 0x07, 0x2c, 0x51,
+  0x76, 0x9b, 0xc0, 0xe5, 0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d,
+  0x32, 0x57, 0x7c, 0xa1, 0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9,
+  0xee, 0x13, 0x38, 0x5d, 0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85,
+  0xaa, 0xcf, 0xf4, 0x19, 0x3e, 0x00, 0x64, 0x40, 0x08, 0x00, 0x00, 0xf1,
+  0x10, 0x00, 0x19, 0xb0, 0x10, 0x00, 0x43, 0x40, 0x06, 0x00, 0x00, 0xf1,
+  0x10, 0x00, 0x07,};
+
+static const uint8_t initialcontextsetuprequest[] = {
+  0x00, 0x09, 0x00, 0x80, 0xde, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
+  0x80, 0x01, 0x11, 0x70, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x42,
+  0x00, 0x0a, 0x18, 0x3b, 0x9a, 0xca, 0x00, 0x60, 0x02, 0xfa, 0xf0, 0x80,
+  0x00, 0x18, 0x00, 0x80, 0x8d, 0x00, 0x00, 0x34, 0x00, 0x80, 0x87, 0x45,
+  0x00, 0x09, 0x3d, 0x0f, 0x80, 0x7f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x78, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0, 0xe5, 0x0a, 0x2f, 0x54,
+  0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c, 0xa1, 0xc6, 0xeb, 0x10,
+  0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38, 0x5d, 0x82, 0xa7, 0xcc,
+  0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0xf4, 0x19, 0x3e, 0x63, 0x88,
+  0xad, 0xd2, 0xf7, 0x1c, 0x41, 0x66, 0x8b, 0xb0, 0xd5, 0xfa, 0x1f, 0x44,
+  0x69, 0x8e, 0xb3, 0xd8, 0xfd, 0x22, 0x47, 0x6c, 0x91, 0xb6, 0xdb, 0x00,
+  0x25, 0x4a, 0x6f, 0x94, 0xb9, 0xde, 0x03, 0x28, 0x4d, 0x72, 0x97, 0xbc,
+  0xe1, 0x06, 0x2b, 0x50, 0x75, 0x9a, 0xbf, 0xe4, 0x09, 0x2e, 0x53, 0x78,
+  0x9d, 0xc2, 0xe7, 0x0c, 0x31, 0x56, 0x7b, 0xa0, 0xc5, 0xea, 0x0f, 0x34,
+  0x59, 0x7e, 0xa3, 0xc8, 0xed, 0x12, 0x37, 0x5c, 0x81, 0xa6, 0xcb, 0xf0,
+  0x15, 0x3a, 0x00, 0x6b, 0x00, 0x05, 0x18, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x20, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7,
+  0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7,
+  0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71,};
+
+static const uint8_t rrcconnectionrequest[] = {
+  0x41, 0xac, 0x00, 0x00, 0x00, 0x16,};
+
+static const uint8_t rrcconnectionsetup[] = {
+  0x68, 0x12, 0x9b, 0x2e, 0x66, 0x1e, 0x82, 0xf2, 0x60, 0xcc, 0xc8, 0x60,
+  0xd3, 0x00, 0x10, 0x78, 0x80, 0x22, 0x38,};
+
+static const uint8_t rrcconnectionsetupcomplete[] = {
+  0x22, 0x21, 0x80, 0x08, 0x06, 0x00, 0x04, 0x68, 0xa4, 0x1c, 0xb1, 0x45,
+  0xda, 0x6f, 0x03, 0x94, 0x28, 0xbd, 0x51, 0xe6, 0x7b, 0x0f, 0xa0, 0x34,
+  0xc9, 0x5d, 0xf2, 0x87, 0x1b, 0xac, 0x40, 0xd5, 0x69, 0xfe, 0x93, 0x27,
+  0xb8, 0x4c, 0xe1, 0x76, 0x0a, 0x9f, 0x33, 0xc4, 0x58, 0xed, 0x82, 0x16,
+  0xab, 0x3c,};
+
+static const uint8_t measurementreport[] = {
+  0x08, 0x10, 0x49, 0x3C, 0x0D, 0x97, 0x89, 0x83, 0xC0, 0x84, 0x20, 0x82,
+  0x08, 0x21, 0x00, 0x01, 0xBC, 0x48};
+
+static const uint8_t rrcconnectionreconfiguration[] = {
+  0x24, 0x06, 0x0b, 0xc0, 0x39, 0x62, 0x8b, 0xb4, 0xde, 0x07, 0x28, 0x51,
+  0x7a, 0xa3, 0xcc, 0xf6, 0x1f, 0x40, 0x69, 0x92, 0xbb, 0xe5, 0x0e, 0x37,
+  0x58, 0x81, 0xaa, 0xd3, 0xfd, 0x26, 0x4f, 0x70, 0x99, 0xc2, 0xec, 0x15,
+  0x3e, 0x67, 0x88, 0xb1, 0xdb, 0x04, 0x2d, 0x56, 0x7f, 0xa0, 0xc9, 0xf3,
+  0x1c, 0x45, 0x6e, 0x97, 0xb8, 0xe2, 0x0b, 0x34, 0x5d, 0x86, 0xaf, 0xd0,
+  0xfa, 0x23, 0x4c, 0x75, 0x9e, 0xc7, 0xe9, 0x12, 0x3b, 0x64, 0x8d, 0xb6,
+  0xd8, 0x01, 0x2a, 0x53, 0x7c, 0xa5, 0xce, 0xf0, 0x19, 0x42, 0x6b, 0x94,
+  0xbd, 0xe7, 0x08, 0x31, 0x5a, 0x83, 0xac, 0xd5, 0xff, 0x20, 0x49, 0x72,
+  0x9b, 0xc4, 0xee, 0x17, 0x38, 0x61, 0x8a, 0xb3, 0xdd, 0x06, 0x2f, 0x50,
+  0x79, 0xa2, 0xcb, 0xf5, 0x1e, 0x47, 0x68, 0x91, 0xba, 0xe4, 0x0d, 0x36,
+  0x5f, 0x80, 0xa9, 0xd1, 0x20, 0x39, 0x62, 0x8b, 0xb4, 0xde, 0x07, 0x28,
+  0x51, 0x7a, 0xa3, 0xcc, 0xf6, 0x1f, 0x40, 0x69, 0x92, 0xbb, 0xe5, 0x0e,
+  0x37, 0x58, 0x81, 0xaa, 0xd3, 0xfd, 0x26, 0x4f, 0x70, 0x99, 0xc2, 0xec,
+  0x15, 0x3e, 0x67, 0x88, 0xb3, 0x13, 0xe2, 0xfa, 0x81, 0xb8, 0x0f, 0x89,
+  0xe0, 0x60, 0x74, 0xe7, 0x7d, 0x82, 0xdc, 0x07, 0xc4, 0xf0, 0x30, 0xba,
+  0x73, 0xbc, 0x98, 0x33, 0x32, 0x18, 0x34, 0xc0, 0x04, 0x1e, 0x20, 0x08,
+  0x8e, 0x00,};
+
+static double elapsed_us(struct timeval *t) {
+  return (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+}
+
+static void print_rate(const char *name, uint32_t len, struct timeval *t)
+{
+  double us_unpack = elapsed_us(&t[0]);
+  double us_pack   = elapsed_us(&t[1]);
+  printf("%-30s %5d %12.0f %12.0f\n", name, len, nof_reps/us_unpack*1e6, nof_reps/us_pack*1e6);
+}
+
+static void bench_s1ap(const char *name, const uint8_t *ref, uint32_t len)
+{
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = new LIBLTE_S1AP_S1AP_PDU_STRUCT;
+  LIBLTE_BYTE_MSG_STRUCT       msg;
+  struct timeval               t[3];
+
+  memcpy(msg.msg, ref, len);
+  msg.N_bytes = len;
+  gettimeofday(&t[0], NULL);
+  for (uint32_t i=0;i<nof_reps;i++) {
+    liblte_s1ap_unpack_s1ap_pdu(&msg, pdu);
+  }
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i=0;i<nof_reps;i++) {
+    liblte_s1ap_pack_s1ap_pdu(pdu, &msg);
+  }
+  gettimeofday(&t[2], NULL);
+  if (msg.N_bytes != len || memcmp(msg.msg, ref, len)) {
+    printf("%s: packed message differs\n", name);
+    exit(-1);
+  }
+  print_rate(name, len, t);
+  delete pdu;
+}
+
+typedef enum {
+  UL_CCCH = 0,
+  DL_CCCH,
+  UL_DCCH,
+  DL_DCCH
+}rrc_channel_t;
+
+typedef struct {
+  LIBLTE_RRC_UL_CCCH_MSG_STRUCT ul_ccch;
+  LIBLTE_RRC_DL_CCCH_MSG_STRUCT dl_ccch;
+  LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch;
+  LIBLTE_RRC_DL_DCCH_MSG_STRUCT dl_dcch;
+}rrc_msg_t;
+
+static void rrc_unpack(rrc_channel_t channel, LIBLTE_BYTE_MSG_STRUCT *bytes, rrc_msg_t *m)
+{
+  switch(channel) {
+  case UL_CCCH: liblte_rrc_unpack_ul_ccch_msg(bytes, &m->ul_ccch); break;
+  case DL_CCCH: liblte_rrc_unpack_dl_ccch_msg(bytes, &m->dl_ccch); break;
+  case UL_DCCH: liblte_rrc_unpack_ul_dcch_msg(bytes, &m->ul_dcch); break;
+  case DL_DCCH: liblte_rrc_unpack_dl_dcch_msg(bytes, &m->dl_dcch); break;
+  }
+}
+
+static void rrc_pack(rrc_channel_t channel, rrc_msg_t *m, LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+  switch(channel) {
+  case UL_CCCH: liblte_rrc_pack_ul_ccch_msg(&m->ul_ccch, bytes); break;
+  case DL_CCCH: liblte_rrc_pack_dl_ccch_msg(&m->dl_ccch, bytes); break;
+  case UL_DCCH: liblte_rrc_pack_ul_dcch_msg(&m->ul_dcch, bytes); break;
+  case DL_DCCH: liblte_rrc_pack_dl_dcch_msg(&m->dl_dcch, bytes); break;
+  }
+}
+
+static void bench_rrc(const char *name, rrc_channel_t channel, const uint8_t *ref, uint32_t len)
+{
+  rrc_msg_t              *msg = new rrc_msg_t;
+  LIBLTE_BYTE_MSG_STRUCT  byte_buf;
+  struct timeval          t[3];
+
+  // On the PDCP SDU bytes, as done by srsenb
+  memcpy(byte_buf.msg, ref, len);
+  byte_buf.N_bytes = len;
+  gettimeofday(&t[0], NULL);
+  for (uint32_t i=0;i<nof_reps;i++) {
+    rrc_unpack(channel, &byte_buf, msg);
+  }
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i=0;i<nof_reps;i++) {
+    rrc_pack(channel, msg, &byte_buf);
+  }
+  gettimeofday(&t[2], NULL);
+  if (byte_buf.N_bytes != len || memcmp(byte_buf.msg, ref, len)) {
+    printf("%s: packed message differs\n", name);
+    exit(-1);
+  }
+  print_rate(name, len, t);
+  delete msg;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  printf("%-30s %5s %12s %12s\n", "message", "bytes", "unpack/s", "pack/s");
+  bench_s1ap("S1AP InitialUEMessage",           initialuemessage,           sizeof(initialuemessage));
+  bench_s1ap("S1AP UplinkNASTransport",         uplinknastransport,         sizeof(uplinknastransport));
+  bench_s1ap("S1AP InitialContextSetupRequest", initialcontextsetuprequest, sizeof(initialcontextsetuprequest));
+  bench_rrc("RRC ConnectionRequest",            UL_CCCH, rrcconnectionrequest,         sizeof(rrcconnectionrequest));
+  bench_rrc("RRC ConnectionSetup",              DL_CCCH, rrcconnectionsetup,           sizeof(rrcconnectionsetup));
+  bench_rrc("RRC ConnectionSetupComplete",      UL_DCCH, rrcconnectionsetupcomplete,   sizeof(rrcconnectionsetupcomplete));
+  bench_rrc("RRC MeasurementReport",            UL_DCCH, measurementreport,            sizeof(measurementreport));
+  bench_rrc("RRC ConnectionReconfiguration",    DL_DCCH, rrcconnectionreconfiguration, sizeof(rrcconnectionreconfiguration));
+  exit(0);
+}
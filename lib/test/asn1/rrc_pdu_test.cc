@@ -0,0 +1,730 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "srslte/asn1/liblte_rrc.h"
+
+/* Packs the RRC messages exchanged on the CCCH, DCCH, BCCH and PCCH during
+ * an attach and compares them with the encoding produced by the
+ * bit-per-byte LIBLTE_BIT_MSG_STRUCT codec, then unpacks the reference
+ * encodings and packs them again. CCCH and DCCH messages are also packed
+ * and unpacked through the LIBLTE_BYTE_MSG_STRUCT overloads, which must
+ * give the same bytes and the same unpacked structures.
+ */
+
+typedef enum {
+  UL_CCCH = 0,
+  DL_CCCH,
+  UL_DCCH,
+  DL_DCCH,
+  BCCH_DLSCH,
+  BCCH_BCH,
+  PCCH
+}rrc_channel_t;
+
+typedef struct {
+  LIBLTE_RRC_UL_CCCH_MSG_STRUCT    ul_ccch;
+  LIBLTE_RRC_DL_CCCH_MSG_STRUCT    dl_ccch;
+  LIBLTE_RRC_UL_DCCH_MSG_STRUCT    ul_dcch;
+  LIBLTE_RRC_DL_DCCH_MSG_STRUCT    dl_dcch;
+  LIBLTE_RRC_BCCH_DLSCH_MSG_STRUCT bcch_dlsch;
+  LIBLTE_RRC_MIB_STRUCT            mib;
+  LIBLTE_RRC_PCCH_MSG_STRUCT       pcch;
+}rrc_msg_t;
+
+static void fill_nas(LIBLTE_SIMPLE_BYTE_MSG_STRUCT *nas, uint32_t len)
+{
+  nas->N_bytes = len;
+  for (uint32_t i=0;i<len;i++) {
+    nas->msg[i] = (i*37 + 7) & 0xFF;
+  }
+}
+
+static void fill_phy_cnfg_ded(LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT *phy_cfg)
+{
+  phy_cfg->pusch_cnfg_ded_present = true;
+  phy_cfg->pusch_cnfg_ded.beta_offset_ack_idx = 6;
+  phy_cfg->pusch_cnfg_ded.beta_offset_ri_idx  = 6;
+  phy_cfg->pusch_cnfg_ded.beta_offset_cqi_idx = 6;
+  phy_cfg->sched_request_cnfg_present = true;
+  phy_cfg->sched_request_cnfg.setup_present = true;
+  phy_cfg->sched_request_cnfg.dsr_trans_max = LIBLTE_RRC_DSR_TRANS_MAX_N64;
+  phy_cfg->sched_request_cnfg.sr_cnfg_idx = 35;
+  phy_cfg->sched_request_cnfg.sr_pucch_resource_idx = 2;
+  phy_cfg->antenna_info_default_value = true;
+  phy_cfg->ul_pwr_ctrl_ded_present = true;
+  phy_cfg->ul_pwr_ctrl_ded.delta_mcs_en = LIBLTE_RRC_DELTA_MCS_ENABLED_EN0;
+  phy_cfg->ul_pwr_ctrl_ded.accumulation_en = true;
+  phy_cfg->ul_pwr_ctrl_ded.p_srs_offset = 3;
+  phy_cfg->pdsch_cnfg_ded_present = true;
+  phy_cfg->pdsch_cnfg_ded = LIBLTE_RRC_PDSCH_CONFIG_P_A_DB_0;
+  phy_cfg->pucch_cnfg_ded_present = true;
+  phy_cfg->cqi_report_cnfg_present = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_present = true;
+  phy_cfg->cqi_report_cnfg.report_periodic_setup_present = true;
+  phy_cfg->cqi_report_cnfg.report_periodic.format_ind_periodic = LIBLTE_RRC_CQI_FORMAT_INDICATOR_PERIODIC_WIDEBAND_CQI;
+  phy_cfg->cqi_report_cnfg.report_periodic.pmi_cnfg_idx = 30;
+  phy_cfg->cqi_report_cnfg.report_periodic.pucch_resource_idx = 1;
+}
+
+static void fill_srb(LIBLTE_RRC_SRB_TO_ADD_MOD_STRUCT *srb, uint8_t id)
+{
+  srb->srb_id = id;
+  srb->lc_cnfg_present = true;
+  srb->lc_default_cnfg_present = true;
+  srb->rlc_cnfg_present = true;
+  srb->rlc_default_cnfg_present = true;
+}
+
+static void fill_drb(LIBLTE_RRC_DRB_TO_ADD_MOD_STRUCT *drb, uint8_t id)
+{
+  drb->drb_id = id;
+  drb->lc_id = id + 2;
+  drb->lc_id_present = true;
+  drb->eps_bearer_id = id + 4;
+  drb->eps_bearer_id_present = true;
+  drb->lc_cnfg_present = true;
+  drb->lc_cnfg.ul_specific_params_present = true;
+  drb->lc_cnfg.ul_specific_params.priority = 11;
+  drb->lc_cnfg.ul_specific_params.prioritized_bit_rate = LIBLTE_RRC_PRIORITIZED_BIT_RATE_INFINITY;
+  drb->lc_cnfg.ul_specific_params.bucket_size_duration = LIBLTE_RRC_BUCKET_SIZE_DURATION_MS100;
+  drb->lc_cnfg.ul_specific_params.log_chan_group_present = true;
+  drb->lc_cnfg.ul_specific_params.log_chan_group = 3;
+  drb->pdcp_cnfg_present = true;
+  drb->pdcp_cnfg.discard_timer_present = true;
+  drb->pdcp_cnfg.discard_timer = LIBLTE_RRC_DISCARD_TIMER_INFINITY;
+  drb->pdcp_cnfg.rlc_am_status_report_required_present = true;
+  drb->pdcp_cnfg.rlc_am_status_report_required = false;
+  drb->rlc_cnfg_present = true;
+  drb->rlc_cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
+  drb->rlc_cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS80;
+  drb->rlc_cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P64;
+  drb->rlc_cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB125;
+  drb->rlc_cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T32;
+  drb->rlc_cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS80;
+  drb->rlc_cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS60;
+}
+
+static void msg_rrcconnectionrequest(rrc_msg_t *m)
+{
+  m->ul_ccch.msg_type = LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REQ;
+  m->ul_ccch.msg.rrc_con_req.ue_id_type = LIBLTE_RRC_CON_REQ_UE_ID_TYPE_S_TMSI;
+  m->ul_ccch.msg.rrc_con_req.ue_id.s_tmsi.mmec = 0x1A;
+  m->ul_ccch.msg.rrc_con_req.ue_id.s_tmsi.m_tmsi = 0xC0000001;
+  m->ul_ccch.msg.rrc_con_req.cause = LIBLTE_RRC_CON_REQ_EST_CAUSE_MO_SIGNALLING;
+}
+
+static void msg_rrcconnectionreestablishmentrequest(rrc_msg_t *m)
+{
+  m->ul_ccch.msg_type = LIBLTE_RRC_UL_CCCH_MSG_TYPE_RRC_CON_REEST_REQ;
+  m->ul_ccch.msg.rrc_con_reest_req.ue_id.c_rnti = 0x46;
+  m->ul_ccch.msg.rrc_con_reest_req.ue_id.phys_cell_id = 357;
+  m->ul_ccch.msg.rrc_con_reest_req.ue_id.short_mac_i = 0xA55A;
+  m->ul_ccch.msg.rrc_con_reest_req.cause = LIBLTE_RRC_CON_REEST_REQ_CAUSE_OTHER_FAILURE;
+}
+
+static void msg_rrcconnectionsetup(rrc_msg_t *m)
+{
+  m->dl_ccch.msg_type = LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_SETUP;
+  m->dl_ccch.msg.rrc_con_setup.rrc_transaction_id = 1;
+  LIBLTE_RRC_RR_CONFIG_DEDICATED_STRUCT *rr_cfg = &m->dl_ccch.msg.rrc_con_setup.rr_cnfg;
+  rr_cfg->srb_to_add_mod_list_size = 1;
+  fill_srb(&rr_cfg->srb_to_add_mod_list[0], 1);
+  rr_cfg->mac_main_cnfg_present = true;
+  LIBLTE_RRC_MAC_MAIN_CONFIG_STRUCT *mac_cfg = &rr_cfg->mac_main_cnfg.explicit_value;
+  mac_cfg->ulsch_cnfg_present = true;
+  mac_cfg->ulsch_cnfg.max_harq_tx_present = true;
+  mac_cfg->ulsch_cnfg.max_harq_tx = LIBLTE_RRC_MAX_HARQ_TX_N4;
+  mac_cfg->ulsch_cnfg.periodic_bsr_timer_present = true;
+  mac_cfg->ulsch_cnfg.periodic_bsr_timer = LIBLTE_RRC_PERIODIC_BSR_TIMER_SF20;
+  mac_cfg->ulsch_cnfg.retx_bsr_timer = LIBLTE_RRC_RETRANSMISSION_BSR_TIMER_SF320;
+  mac_cfg->phr_cnfg_present = true;
+  mac_cfg->phr_cnfg.setup_present = true;
+  mac_cfg->phr_cnfg.periodic_phr_timer = LIBLTE_RRC_PERIODIC_PHR_TIMER_SF50;
+  mac_cfg->phr_cnfg.prohibit_phr_timer = LIBLTE_RRC_PROHIBIT_PHR_TIMER_SF0;
+  mac_cfg->phr_cnfg.dl_pathloss_change = LIBLTE_RRC_DL_PATHLOSS_CHANGE_DB3;
+  mac_cfg->time_alignment_timer = LIBLTE_RRC_TIME_ALIGNMENT_TIMER_INFINITY;
+  rr_cfg->phy_cnfg_ded_present = true;
+  fill_phy_cnfg_ded(&rr_cfg->phy_cnfg_ded);
+}
+
+static void msg_rrcconnectionreject(rrc_msg_t *m)
+{
+  m->dl_ccch.msg_type = LIBLTE_RRC_DL_CCCH_MSG_TYPE_RRC_CON_REJ;
+  m->dl_ccch.msg.rrc_con_rej.wait_time = 10;
+}
+
+static void msg_rrcconnectionsetupcomplete(rrc_msg_t *m)
+{
+  m->ul_dcch.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_SETUP_COMPLETE;
+  LIBLTE_RRC_CONNECTION_SETUP_COMPLETE_STRUCT *c = &m->ul_dcch.msg.rrc_con_setup_complete;
+  c->rrc_transaction_id = 1;
+  c->selected_plmn_id = 1;
+  c->registered_mme_present = true;
+  c->registered_mme.plmn_id_present = true;
+  c->registered_mme.plmn_id.mcc = 0xF001;
+  c->registered_mme.plmn_id.mnc = 0xFF01;
+  c->registered_mme.mmegi = 0x8001;
+  c->registered_mme.mmec = 0x1A;
+  fill_nas(&c->dedicated_info_nas, 41);
+}
+
+static void msg_uecapabilityinformation(rrc_msg_t *m)
+{
+  m->ul_dcch.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_UE_CAPABILITY_INFO;
+  LIBLTE_RRC_UE_CAPABILITY_INFORMATION_STRUCT *info = &m->ul_dcch.msg.ue_capability_info;
+  info->rrc_transaction_id = 2;
+  info->N_ue_caps = 1;
+  info->ue_capability_rat[0].rat_type = LIBLTE_RRC_RAT_TYPE_EUTRA;
+  LIBLTE_RRC_UE_EUTRA_CAPABILITY_STRUCT *cap = &info->ue_capability_rat[0].eutra_capability;
+  cap->access_stratum_release = LIBLTE_RRC_ACCESS_STRATUM_RELEASE_REL8;
+  cap->ue_category = 4;
+  cap->rf_params.N_supported_band_eutras = 2;
+  cap->meas_params.N_band_list_eutra = 2;
+  for (uint32_t i=0;i<2;i++) {
+    cap->rf_params.supported_band_eutra[i].band_eutra = 3 + 4*i;
+    cap->meas_params.band_list_eutra[i].N_inter_freq_need_for_gaps = 1;
+    cap->meas_params.band_list_eutra[i].inter_freq_need_for_gaps[0] = true;
+  }
+  cap->feature_group_indicator_present = true;
+  cap->feature_group_indicator = 0xE6041000;
+}
+
+static void msg_ulinformationtransfer(rrc_msg_t *m)
+{
+  m->ul_dcch.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_UL_INFO_TRANSFER;
+  m->ul_dcch.msg.ul_info_transfer.dedicated_info_type = LIBLTE_RRC_UL_INFORMATION_TRANSFER_TYPE_NAS;
+  fill_nas(&m->ul_dcch.msg.ul_info_transfer.dedicated_info, 300);
+}
+
+static void msg_securitymodecomplete(rrc_msg_t *m)
+{
+  m->ul_dcch.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_SECURITY_MODE_COMPLETE;
+  m->ul_dcch.msg.security_mode_complete.rrc_transaction_id = 3;
+}
+
+static void msg_rrcconnectionreconfigurationcomplete(rrc_msg_t *m)
+{
+  m->ul_dcch.msg_type = LIBLTE_RRC_UL_DCCH_MSG_TYPE_RRC_CON_RECONFIG_COMPLETE;
+  m->ul_dcch.msg.rrc_con_reconfig_complete.rrc_transaction_id = 0;
+}
+
+static void msg_rrcconnectionreconfiguration(rrc_msg_t *m)
+{
+  m->dl_dcch.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RECONFIG;
+  LIBLTE_RRC_CONNECTION_RECONFIGURATION_STRUCT *r = &m->dl_dcch.msg.rrc_con_reconfig;
+  r->rrc_transaction_id = 2;
+  r->rr_cnfg_ded_present = true;
+  r->rr_cnfg_ded.srb_to_add_mod_list_size = 1;
+  fill_srb(&r->rr_cnfg_ded.srb_to_add_mod_list[0], 2);
+  r->rr_cnfg_ded.drb_to_add_mod_list_size = 2;
+  fill_drb(&r->rr_cnfg_ded.drb_to_add_mod_list[0], 1);
+  fill_drb(&r->rr_cnfg_ded.drb_to_add_mod_list[1], 2);
+  r->rr_cnfg_ded.phy_cnfg_ded_present = true;
+  fill_phy_cnfg_ded(&r->rr_cnfg_ded.phy_cnfg_ded);
+  r->N_ded_info_nas = 2;
+  fill_nas(&r->ded_info_nas_list[0], 120);
+  fill_nas(&r->ded_info_nas_list[1], 36);
+}
+
+static void msg_securitymodecommand(rrc_msg_t *m)
+{
+  m->dl_dcch.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_SECURITY_MODE_COMMAND;
+  m->dl_dcch.msg.security_mode_cmd.rrc_transaction_id = 3;
+  m->dl_dcch.msg.security_mode_cmd.sec_algs.cipher_alg = LIBLTE_RRC_CIPHERING_ALGORITHM_EEA2;
+  m->dl_dcch.msg.security_mode_cmd.sec_algs.int_alg = LIBLTE_RRC_INTEGRITY_PROT_ALGORITHM_EIA2;
+}
+
+static void msg_uecapabilityenquiry(rrc_msg_t *m)
+{
+  m->dl_dcch.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_UE_CAPABILITY_ENQUIRY;
+  m->dl_dcch.msg.ue_cap_enquiry.rrc_transaction_id = 0;
+  m->dl_dcch.msg.ue_cap_enquiry.N_ue_cap_reqs = 1;
+  m->dl_dcch.msg.ue_cap_enquiry.ue_capability_request[0] = LIBLTE_RRC_RAT_TYPE_EUTRA;
+}
+
+static void msg_dlinformationtransfer(rrc_msg_t *m)
+{
+  m->dl_dcch.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_DL_INFO_TRANSFER;
+  m->dl_dcch.msg.dl_info_transfer.rrc_transaction_id = 1;
+  m->dl_dcch.msg.dl_info_transfer.dedicated_info_type = LIBLTE_RRC_DL_INFORMATION_TRANSFER_TYPE_NAS;
+  fill_nas(&m->dl_dcch.msg.dl_info_transfer.dedicated_info, 36);
+}
+
+static void msg_rrcconnectionrelease(rrc_msg_t *m)
+{
+  m->dl_dcch.msg_type = LIBLTE_RRC_DL_DCCH_MSG_TYPE_RRC_CON_RELEASE;
+  m->dl_dcch.msg.rrc_con_release.rrc_transaction_id = 1;
+  m->dl_dcch.msg.rrc_con_release.release_cause = LIBLTE_RRC_RELEASE_CAUSE_OTHER;
+}
+
+static void msg_sib1(rrc_msg_t *m)
+{
+  m->bcch_dlsch.N_sibs = 1;
+  m->bcch_dlsch.sibs[0].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1;
+  LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_1_STRUCT *sib1 = &m->bcch_dlsch.sibs[0].sib.sib1;
+  sib1->N_plmn_ids = 1;
+  sib1->plmn_id[0].id.mcc = 0xF001;
+  sib1->plmn_id[0].id.mnc = 0xFF01;
+  sib1->plmn_id[0].resv_for_oper = LIBLTE_RRC_NOT_RESV_FOR_OPER;
+  sib1->tracking_area_code = 7;
+  sib1->cell_id = 0x19B01;
+  sib1->cell_barred = LIBLTE_RRC_CELL_NOT_BARRED;
+  sib1->intra_freq_reselection = LIBLTE_RRC_INTRA_FREQ_RESELECTION_ALLOWED;
+  sib1->q_rx_lev_min = -130;
+  sib1->p_max_present = true;
+  sib1->p_max = 23;
+  sib1->freq_band_indicator = 7;
+  sib1->N_sched_info = 2;
+  sib1->sched_info[0].si_periodicity = LIBLTE_RRC_SI_PERIODICITY_RF16;
+  sib1->sched_info[1].si_periodicity = LIBLTE_RRC_SI_PERIODICITY_RF32;
+  sib1->sched_info[1].N_sib_mapping_info = 1;
+  sib1->sched_info[1].sib_mapping_info[0].sib_type = LIBLTE_RRC_SIB_TYPE_3;
+  sib1->si_window_length = LIBLTE_RRC_SI_WINDOW_LENGTH_MS20;
+  sib1->system_info_value_tag = 4;
+}
+
+static void msg_sib2_sib3(rrc_msg_t *m)
+{
+  m->bcch_dlsch.N_sibs = 2;
+  m->bcch_dlsch.sibs[0].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2;
+  LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_2_STRUCT *sib2 = &m->bcch_dlsch.sibs[0].sib.sib2;
+  sib2->ac_barring_info_present = true;
+  sib2->ac_barring_for_mo_data.enabled = true;
+  sib2->ac_barring_for_mo_data.factor = LIBLTE_RRC_AC_BARRING_FACTOR_P95;
+  sib2->ac_barring_for_mo_data.time = LIBLTE_RRC_AC_BARRING_TIME_S64;
+  sib2->ac_barring_for_mo_data.for_special_ac = 0x1F;
+  sib2->rr_config_common_sib.rach_cnfg.num_ra_preambles = LIBLTE_RRC_NUMBER_OF_RA_PREAMBLES_N52;
+  sib2->rr_config_common_sib.rach_cnfg.max_harq_msg3_tx = 4;
+  sib2->rr_config_common_sib.prach_cnfg.root_sequence_index = 128;
+  sib2->rr_config_common_sib.prach_cnfg.prach_cnfg_info.prach_config_index = 3;
+  sib2->rr_config_common_sib.prach_cnfg.prach_cnfg_info.zero_correlation_zone_config = 5;
+  sib2->rr_config_common_sib.pdsch_cnfg.rs_power = 20;
+  sib2->rr_config_common_sib.pusch_cnfg.n_sb = 1;
+  sib2->rr_config_common_sib.pusch_cnfg.ul_rs.group_hopping_enabled = true;
+  sib2->rr_config_common_sib.pucch_cnfg.n_rb_cqi = 1;
+  sib2->rr_config_common_sib.pucch_cnfg.n1_pucch_an = 12;
+  sib2->rr_config_common_sib.ul_pwr_ctrl.p0_nominal_pusch = -85;
+  sib2->rr_config_common_sib.ul_pwr_ctrl.p0_nominal_pucch = -107;
+  sib2->rr_config_common_sib.ul_pwr_ctrl.delta_preamble_msg3 = 6;
+  sib2->arfcn_value_eutra.present = true;
+  sib2->arfcn_value_eutra.value = 21400;
+  sib2->ul_bw.present = true;
+  sib2->ul_bw.bw = LIBLTE_RRC_UL_BW_N25;
+  sib2->additional_spectrum_emission = 1;
+  sib2->time_alignment_timer = LIBLTE_RRC_TIME_ALIGNMENT_TIMER_INFINITY;
+  m->bcch_dlsch.sibs[1].sib_type = LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3;
+  LIBLTE_RRC_SYS_INFO_BLOCK_TYPE_3_STRUCT *sib3 = &m->bcch_dlsch.sibs[1].sib.sib3;
+  sib3->q_hyst = LIBLTE_RRC_Q_HYST_DB_2;
+  sib3->s_non_intra_search_present = true;
+  sib3->s_non_intra_search = 3;
+  sib3->thresh_serving_low = 2;
+  sib3->cell_resel_prio = 6;
+  sib3->q_rx_lev_min = -122;
+  sib3->p_max_present = true;
+  sib3->p_max = 23;
+  sib3->s_intra_search_present = true;
+  sib3->s_intra_search = 31;
+  sib3->presence_ant_port_1 = true;
+  sib3->neigh_cell_cnfg = 1;
+  sib3->t_resel_eutra = 1;
+}
+
+static void msg_mib(rrc_msg_t *m)
+{
+  m->mib.dl_bw = LIBLTE_RRC_DL_BANDWIDTH_25;
+  m->mib.phich_config.dur = LIBLTE_RRC_PHICH_DURATION_NORMAL;
+  m->mib.phich_config.res = LIBLTE_RRC_PHICH_RESOURCE_1;
+  m->mib.sfn_div_4 = 0x9B;
+}
+
+static void msg_paging(rrc_msg_t *m)
+{
+  m->pcch.paging_record_list_size = 2;
+  for (uint32_t i=0;i<2;i++) {
+    m->pcch.paging_record_list[i].ue_identity.ue_identity_type = LIBLTE_RRC_PAGING_UE_IDENTITY_TYPE_S_TMSI;
+    m->pcch.paging_record_list[i].ue_identity.s_tmsi.mmec = 0x1A;
+    m->pcch.paging_record_list[i].ue_identity.s_tmsi.m_tmsi = 0xC0000001 + i;
+    m->pcch.paging_record_list[i].cn_domain = LIBLTE_RRC_CN_DOMAIN_PS;
+  }
+  m->pcch.system_info_modification_present = true;
+  m->pcch.system_info_modification = LIBLTE_RRC_SYSTEM_INFO_MODIFICATION_TRUE;
+}
+
+// Reference encodings
+static const uint8_t rrcconnectionrequest[] = {
+  0x41, 0xac, 0x00, 0x00, 0x00, 0x16,};
+
+static const uint8_t rrcconnectionreestablishmentrequest[] = {
+  0x00, 0x08, 0xd6, 0x5a, 0x55, 0xa8,};
+
+static const uint8_t rrcconnectionsetup[] = {
+  0x68, 0x12, 0x9b, 0x2e, 0x66, 0x1e, 0x82, 0xf2, 0x60, 0xcc, 0xc8, 0x60,
+  0xd3, 0x00, 0x10, 0x78, 0x80, 0x22, 0x38,};
+
+static const uint8_t rrcconnectionreject[] = {
+  0x41, 0x20,};
+
+static const uint8_t rrcconnectionsetupcomplete[] = {
+  0x22, 0x21, 0x80, 0x08, 0x06, 0x00, 0x04, 0x68, 0xa4, 0x1c, 0xb1, 0x45,
+  0xda, 0x6f, 0x03, 0x94, 0x28, 0xbd, 0x51, 0xe6, 0x7b, 0x0f, 0xa0, 0x34,
+  0xc9, 0x5d, 0xf2, 0x87, 0x1b, 0xac, 0x40, 0xd5, 0x69, 0xfe, 0x93, 0x27,
+  0xb8, 0x4c, 0xe1, 0x76, 0x0a, 0x9f, 0x33, 0xc4, 0x58, 0xed, 0x82, 0x16,
+  0xab, 0x3c,};
+
+static const uint8_t uecapabilityinformation[] = {
+  0x3c, 0x01, 0x00, 0xd8, 0x18, 0x00, 0x01, 0x08, 0x30, 0x10, 0x10, 0x1e,
+  0x60, 0x41, 0x00, 0x00, 0x00,};
+
+static const uint8_t ulinformationtransfer[] = {
+  0x48, 0x10, 0x25, 0x80, 0xe5, 0x8a, 0x2e, 0xd3, 0x78, 0x1c, 0xa1, 0x45,
+  0xea, 0x8f, 0x33, 0xd8, 0x7d, 0x01, 0xa6, 0x4a, 0xef, 0x94, 0x38, 0xdd,
+  0x62, 0x06, 0xab, 0x4f, 0xf4, 0x99, 0x3d, 0xc2, 0x67, 0x0b, 0xb0, 0x54,
+  0xf9, 0x9e, 0x22, 0xc7, 0x6c, 0x10, 0xb5, 0x59, 0xfe, 0x83, 0x27, 0xcc,
+  0x71, 0x15, 0xba, 0x5e, 0xe3, 0x88, 0x2c, 0xd1, 0x76, 0x1a, 0xbf, 0x43,
+  0xe8, 0x8d, 0x31, 0xd6, 0x7b, 0x1f, 0xa4, 0x48, 0xed, 0x92, 0x36, 0xdb,
+  0x60, 0x04, 0xa9, 0x4d, 0xf2, 0x97, 0x3b, 0xc0, 0x65, 0x09, 0xae, 0x52,
+  0xf7, 0x9c, 0x20, 0xc5, 0x6a, 0x0e, 0xb3, 0x57, 0xfc, 0x81, 0x25, 0xca,
+  0x6f, 0x13, 0xb8, 0x5c, 0xe1, 0x86, 0x2a, 0xcf, 0x74, 0x18, 0xbd, 0x41,
+  0xe6, 0x8b, 0x2f, 0xd4, 0x79, 0x1d, 0xa2, 0x46, 0xeb, 0x90, 0x34, 0xd9,
+  0x7e, 0x02, 0xa7, 0x4b, 0xf0, 0x95, 0x39, 0xde, 0x63, 0x07, 0xac, 0x50,
+  0xf5, 0x9a, 0x3e, 0xc3, 0x68, 0x0c, 0xb1, 0x55, 0xfa, 0x9f, 0x23, 0xc8,
+  0x6d, 0x11, 0xb6, 0x5a, 0xff, 0x84, 0x28, 0xcd, 0x72, 0x16, 0xbb, 0x5f,
+  0xe4, 0x89, 0x2d, 0xd2, 0x77, 0x1b, 0xa0, 0x44, 0xe9, 0x8e, 0x32, 0xd7,
+  0x7c, 0x00, 0xa5, 0x49, 0xee, 0x93, 0x37, 0xdc, 0x61, 0x05, 0xaa, 0x4e,
+  0xf3, 0x98, 0x3c, 0xc1, 0x66, 0x0a, 0xaf, 0x53, 0xf8, 0x9d, 0x21, 0xc6,
+  0x6b, 0x0f, 0xb4, 0x58, 0xfd, 0x82, 0x26, 0xcb, 0x70, 0x14, 0xb9, 0x5d,
+  0xe2, 0x87, 0x2b, 0xd0, 0x75, 0x19, 0xbe, 0x42, 0xe7, 0x8c, 0x30, 0xd5,
+  0x7a, 0x1e, 0xa3, 0x47, 0xec, 0x91, 0x35, 0xda, 0x7f, 0x03, 0xa8, 0x4c,
+  0xf1, 0x96, 0x3a, 0xdf, 0x64, 0x08, 0xad, 0x51, 0xf6, 0x9b, 0x3f, 0xc4,
+  0x69, 0x0d, 0xb2, 0x56, 0xfb, 0x80, 0x24, 0xc9, 0x6e, 0x12, 0xb7, 0x5b,
+  0xe0, 0x85, 0x29, 0xce, 0x73, 0x17, 0xbc, 0x40, 0xe5, 0x8a, 0x2e, 0xd3,
+  0x78, 0x1c, 0xa1, 0x45, 0xea, 0x8f, 0x33, 0xd8, 0x7d, 0x01, 0xa6, 0x4a,
+  0xef, 0x94, 0x38, 0xdd, 0x62, 0x06, 0xab, 0x4f, 0xf4, 0x99, 0x3d, 0xc2,
+  0x67, 0x0b, 0xb0, 0x54, 0xf9, 0x9e, 0x22, 0xc7, 0x6c, 0x10, 0xb5, 0x59,
+  0xfe, 0x83, 0x27, 0xc0,};
+
+static const uint8_t securitymodecomplete[] = {
+  0x2e, 0x00,};
+
+static const uint8_t rrcconnectionreconfigurationcomplete[] = {
+  0x10, 0x00,};
+
+static const uint8_t rrcconnectionreconfiguration[] = {
+  0x24, 0x06, 0x0b, 0xc0, 0x39, 0x62, 0x8b, 0xb4, 0xde, 0x07, 0x28, 0x51,
+  0x7a, 0xa3, 0xcc, 0xf6, 0x1f, 0x40, 0x69, 0x92, 0xbb, 0xe5, 0x0e, 0x37,
+  0x58, 0x81, 0xaa, 0xd3, 0xfd, 0x26, 0x4f, 0x70, 0x99, 0xc2, 0xec, 0x15,
+  0x3e, 0x67, 0x88, 0xb1, 0xdb, 0x04, 0x2d, 0x56, 0x7f, 0xa0, 0xc9, 0xf3,
+  0x1c, 0x45, 0x6e, 0x97, 0xb8, 0xe2, 0x0b, 0x34, 0x5d, 0x86, 0xaf, 0xd0,
+  0xfa, 0x23, 0x4c, 0x75, 0x9e, 0xc7, 0xe9, 0x12, 0x3b, 0x64, 0x8d, 0xb6,
+  0xd8, 0x01, 0x2a, 0x53, 0x7c, 0xa5, 0xce, 0xf0, 0x19, 0x42, 0x6b, 0x94,
+  0xbd, 0xe7, 0x08, 0x31, 0x5a, 0x83, 0xac, 0xd5, 0xff, 0x20, 0x49, 0x72,
+  0x9b, 0xc4, 0xee, 0x17, 0x38, 0x61, 0x8a, 0xb3, 0xdd, 0x06, 0x2f, 0x50,
+  0x79, 0xa2, 0xcb, 0xf5, 0x1e, 0x47, 0x68, 0x91, 0xba, 0xe4, 0x0d, 0x36,
+  0x5f, 0x80, 0xa9, 0xd1, 0x20, 0x39, 0x62, 0x8b, 0xb4, 0xde, 0x07, 0x28,
+  0x51, 0x7a, 0xa3, 0xcc, 0xf6, 0x1f, 0x40, 0x69, 0x92, 0xbb, 0xe5, 0x0e,
+  0x37, 0x58, 0x81, 0xaa, 0xd3, 0xfd, 0x26, 0x4f, 0x70, 0x99, 0xc2, 0xec,
+  0x15, 0x3e, 0x67, 0x88, 0xb3, 0x13, 0xe2, 0xfa, 0x81, 0xb8, 0x0f, 0x89,
+  0xe0, 0x60, 0x74, 0xe7, 0x7d, 0x82, 0xdc, 0x07, 0xc4, 0xf0, 0x30, 0xba,
+  0x73, 0xbc, 0x98, 0x33, 0x32, 0x18, 0x34, 0xc0, 0x04, 0x1e, 0x20, 0x08,
+  0x8e, 0x00,};
+
+static const uint8_t securitymodecommand[] = {
+  0x36, 0x02, 0x20,};
+
+static const uint8_t uecapabilityenquiry[] = {
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00,};
+
+static const uint8_t dlinformationtransfer[] = {
+  0x0a, 0x01, 0x20, 0x39, 0x62, 0x8b, 0xb4, 0xde, 0x07, 0x28, 0x51, 0x7a,
+  0xa3, 0xcc, 0xf6, 0x1f, 0x40, 0x69, 0x92, 0xbb, 0xe5, 0x0e, 0x37, 0x58,
+  0x81, 0xaa, 0xd3, 0xfd, 0x26, 0x4f, 0x70, 0x99, 0xc2, 0xec, 0x15, 0x3e,
+  0x67, 0x88, 0xb0,};
+
+static const uint8_t rrcconnectionrelease[] = {
+  0x2a, 0x02,};
+
+static const uint8_t sib1[] = {
+  0x60, 0x40, 0x04, 0x03, 0x00, 0x07, 0x00, 0x19, 0xb0, 0x18, 0x17, 0x51,
+  0x82, 0x40, 0x82, 0x0a, 0x40,};
+
+static const uint8_t sib2_sib3[] = {
+  0x00, 0x81, 0x2f, 0x9f, 0x18, 0x00, 0x00, 0xc0, 0x10, 0x01, 0x94, 0x05,
+  0x00, 0x00, 0x40, 0x00, 0x10, 0x03, 0x05, 0x22, 0x80, 0x04, 0x00, 0x00,
+  0x0d, 0x4e, 0x61, 0x03, 0x84, 0x28, 0x43, 0xb0, 0x9d, 0x5f, 0x48,};
+
+static const uint8_t mib[] = {
+  0x4a, 0x6c, 0x00,};
+
+static const uint8_t paging[] = {
+  0x60, 0x81, 0xac, 0x00, 0x00, 0x00, 0x10, 0x1a, 0xc0, 0x00, 0x00, 0x02,
+  0x00,};
+
+// Captured from a live network, only unpacked and packed again
+static const uint8_t measurementreport[] = {
+  0x08, 0x10, 0x49, 0x3C, 0x0D, 0x97, 0x89, 0x83, 0xC0, 0x84, 0x20, 0x82,
+  0x08, 0x21, 0x00, 0x01, 0xBC, 0x48};
+
+static const uint8_t rrcconnectionreconfiguration_live[] = {
+  0x22, 0x16, 0x95, 0xa0, 0x18, 0x00, 0x05, 0xaa, 0x50, 0x36, 0x00, 0x61,
+  0x08, 0x9c, 0xe3, 0x40, 0xb0, 0x84, 0x4e, 0x71, 0xc0, 0x30, 0x84, 0x6e,
+  0x71, 0xe0, 0x70, 0x84, 0x6e, 0x70, 0x6c, 0x63, 0x1a, 0xc6, 0xb9, 0x8e,
+  0x7b, 0x1e, 0x84, 0xc0, 0x01, 0x24, 0x9d, 0x3e, 0xaf, 0xbd, 0x64, 0x04,
+  0x1d, 0x08, 0x05, 0x24, 0x19, 0x00, 0x03, 0xc4, 0x40, 0xc4, 0xc8, 0x00,
+  0x89, 0x48, 0x07, 0x04, 0x14, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x2d,
+  0xd9, 0xe9, 0xdd, 0xa5, 0xb9, 0xd1, 0x95, 0xc9, 0xb9, 0x95, 0xd0, 0x14,
+  0x04, 0x38, 0x38, 0x38, 0x05, 0x78, 0x13, 0xfb, 0xfa, 0x05, 0x39, 0x40,
+  0x2f, 0xd8, 0x03, 0xc4, 0x40, 0x00, 0x08, 0x04, 0x04, 0x00, 0x01, 0x88,
+  0x5c, 0xb1, 0x65, 0x25, 0x90, 0x04, 0x0d, 0xa9, 0xc0, 0x2a, 0x9a, 0x01,
+  0x99, 0x3b, 0x01, 0xf5, 0x12, 0xf0, 0x85, 0x0d, 0x85, 0xef, 0xc0, 0x01,
+  0xf2, 0x20, 0x60, 0x18, 0x07, 0x97, 0x09, 0x1f, 0xc3, 0x06, 0x00, 0x81,
+  0x00, 0x00, 0x11};
+
+// Packed again after unpacking, without the fields not supported by the codec
+static const uint8_t rrcconnectionreconfiguration_live_repacked[] = {
+  0x22, 0x16, 0x15, 0xa0, 0x18, 0x00, 0x05, 0xaa, 0x50, 0x36, 0x00, 0xc2,
+  0x11, 0x39, 0xc6, 0x82, 0xc2, 0x11, 0x39, 0xc7, 0x01, 0x84, 0x23, 0x73,
+  0x8f, 0x07, 0x08, 0x46, 0xe7, 0x06, 0xc6, 0x31, 0xac, 0x6b, 0x98, 0xe7,
+  0xb1, 0xe8, 0x01, 0x80, 0x02, 0x49, 0x3a, 0x7d, 0x5f, 0x7a, 0xc8, 0x08,
+  0x3a, 0x10, 0x0a, 0x48, 0x32, 0x00, 0x07, 0x88, 0x81, 0x89, 0x90, 0x01,
+  0x12, 0x90, 0x0e, 0x08, 0x28, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x5b,
+  0xb3, 0xd3, 0xbb, 0x4b, 0x73, 0xa3, 0x2b, 0x93, 0x73, 0x2b, 0xa0, 0x28,
+  0x08, 0x70, 0x70, 0x70, 0x0a, 0xf0, 0x27, 0xf7, 0xf4, 0x0a, 0x72, 0x80,
+  0x5f, 0xb0, 0x07, 0x88, 0x80, 0x00, 0x10, 0x08, 0x08, 0x00, 0x03, 0x10,
+  0xb9, 0x62, 0xca, 0x4b, 0x20, 0x08, 0x1b, 0x53, 0x80, 0x55, 0x34, 0x03,
+  0x32, 0x76, 0x03, 0xea, 0x25, 0xe1, 0x0a, 0x1b, 0x0b, 0xcf, 0x80, 0x03,
+  0xe4, 0x5e, 0x5c, 0x24, 0x7f, 0x0c, 0x18, 0x02, 0x04, 0x00, 0x00, 0x40,};
+
+typedef struct {
+  const char    *name;
+  rrc_channel_t  channel;
+  void         (*fill)(rrc_msg_t*);
+  const uint8_t *ref;
+  uint32_t       ref_len;
+  uint32_t       ref_bits;
+  const uint8_t *repacked;
+  uint32_t       repacked_len;
+}test_msg_t;
+
+#define TEST_MSG(ch, x, bits) {#x, ch, msg_##x, x, sizeof(x), bits, x, sizeof(x)}
+#define PACK_MSG(ch, x, bits) {#x, ch, msg_##x, x, sizeof(x), bits, NULL, 0}
+#define LIVE_MSG(ch, x, y)    {#x, ch, NULL, x, sizeof(x), 0, y, sizeof(y)}
+
+static test_msg_t test_msgs[] = {
+  TEST_MSG(UL_CCCH,    rrcconnectionrequest,                 48),
+  TEST_MSG(UL_CCCH,    rrcconnectionreestablishmentrequest,  48),
+  TEST_MSG(DL_CCCH,    rrcconnectionsetup,                   152),
+  TEST_MSG(DL_CCCH,    rrcconnectionreject,                  11),
+  TEST_MSG(UL_DCCH,    rrcconnectionsetupcomplete,           398),
+  PACK_MSG(UL_DCCH,    uecapabilityinformation,              132),
+  TEST_MSG(UL_DCCH,    ulinformationtransfer,                2427),
+  TEST_MSG(UL_DCCH,    securitymodecomplete,                 9),
+  TEST_MSG(UL_DCCH,    rrcconnectionreconfigurationcomplete, 9),
+  TEST_MSG(DL_DCCH,    rrcconnectionreconfiguration,         1546),
+  TEST_MSG(DL_DCCH,    securitymodecommand,                  20),
+  TEST_MSG(DL_DCCH,    uecapabilityenquiry,                  46),
+  TEST_MSG(DL_DCCH,    dlinformationtransfer,                309),
+  TEST_MSG(DL_DCCH,    rrcconnectionrelease,                 15),
+  TEST_MSG(BCCH_DLSCH, sib1,                                 132),
+  TEST_MSG(BCCH_DLSCH, sib2_sib3,                            277),
+  TEST_MSG(BCCH_BCH,   mib,                                  24),
+  TEST_MSG(PCCH,       paging,                               98),
+  LIVE_MSG(UL_DCCH,    measurementreport,                    measurementreport),
+  LIVE_MSG(DL_DCCH,    rrcconnectionreconfiguration_live,    rrcconnectionreconfiguration_live_repacked)
+};
+
+static LIBLTE_ERROR_ENUM pack(rrc_channel_t channel, rrc_msg_t *m, LIBLTE_BIT_MSG_STRUCT *bits)
+{
+  switch(channel) {
+  case UL_CCCH:    return liblte_rrc_pack_ul_ccch_msg(&m->ul_ccch, bits);
+  case DL_CCCH:    return liblte_rrc_pack_dl_ccch_msg(&m->dl_ccch, bits);
+  case UL_DCCH:    return liblte_rrc_pack_ul_dcch_msg(&m->ul_dcch, bits);
+  case DL_DCCH:    return liblte_rrc_pack_dl_dcch_msg(&m->dl_dcch, bits);
+  case BCCH_DLSCH: return liblte_rrc_pack_bcch_dlsch_msg(&m->bcch_dlsch, bits);
+  case BCCH_BCH:   return liblte_rrc_pack_bcch_bch_msg(&m->mib, bits);
+  default:         return liblte_rrc_pack_pcch_msg(&m->pcch, bits);
+  }
+}
+
+static LIBLTE_ERROR_ENUM unpack(rrc_channel_t channel, LIBLTE_BIT_MSG_STRUCT *bits, rrc_msg_t *m)
+{
+  switch(channel) {
+  case UL_CCCH:    return liblte_rrc_unpack_ul_ccch_msg(bits, &m->ul_ccch);
+  case DL_CCCH:    return liblte_rrc_unpack_dl_ccch_msg(bits, &m->dl_ccch);
+  case UL_DCCH:    return liblte_rrc_unpack_ul_dcch_msg(bits, &m->ul_dcch);
+  case DL_DCCH:    return liblte_rrc_unpack_dl_dcch_msg(bits, &m->dl_dcch);
+  case BCCH_DLSCH: return liblte_rrc_unpack_bcch_dlsch_msg(bits, &m->bcch_dlsch);
+  case BCCH_BCH:   return liblte_rrc_unpack_bcch_bch_msg(bits, &m->mib);
+  default:         return liblte_rrc_unpack_pcch_msg(bits, &m->pcch);
+  }
+}
+
+static bool has_bytes(rrc_channel_t channel)
+{
+  return channel <= DL_DCCH;
+}
+
+static LIBLTE_ERROR_ENUM pack(rrc_channel_t channel, rrc_msg_t *m, LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+  switch(channel) {
+  case UL_CCCH:    return liblte_rrc_pack_ul_ccch_msg(&m->ul_ccch, bytes);
+  case DL_CCCH:    return liblte_rrc_pack_dl_ccch_msg(&m->dl_ccch, bytes);
+  case UL_DCCH:    return liblte_rrc_pack_ul_dcch_msg(&m->ul_dcch, bytes);
+  default:         return liblte_rrc_pack_dl_dcch_msg(&m->dl_dcch, bytes);
+  }
+}
+
+static LIBLTE_ERROR_ENUM unpack(rrc_channel_t channel, LIBLTE_BYTE_MSG_STRUCT *bytes, rrc_msg_t *m)
+{
+  switch(channel) {
+  case UL_CCCH:    return liblte_rrc_unpack_ul_ccch_msg(bytes, &m->ul_ccch);
+  case DL_CCCH:    return liblte_rrc_unpack_dl_ccch_msg(bytes, &m->dl_ccch);
+  case UL_DCCH:    return liblte_rrc_unpack_ul_dcch_msg(bytes, &m->ul_dcch);
+  default:         return liblte_rrc_unpack_dl_dcch_msg(bytes, &m->dl_dcch);
+  }
+}
+
+// Packs a bit array MSB first and zero pads the last byte, as srsenb and
+// srsue do before handing a PDU to PDCP
+static void bits_to_bytes(LIBLTE_BIT_MSG_STRUCT *bits, LIBLTE_BYTE_MSG_STRUCT *bytes)
+{
+  bytes->N_bytes = (bits->N_bits+7)/8;
+  memset(bytes->msg, 0, bytes->N_bytes);
+  for (uint32_t i=0;i<bits->N_bits;i++) {
+    bytes->msg[i/8] |= bits->msg[i] << (7-i%8);
+  }
+}
+
+static void bytes_to_bits(const uint8_t *bytes, uint32_t len, LIBLTE_BIT_MSG_STRUCT *bits)
+{
+  bits->N_bits = len*8;
+  for (uint32_t i=0;i<bits->N_bits;i++) {
+    bits->msg[i] = (bytes[i/8] >> (7-i%8)) & 1;
+  }
+}
+
+static bool compare(const char *name, const char *step, LIBLTE_BYTE_MSG_STRUCT *msg, const uint8_t *ref, uint32_t ref_len)
+{
+  if (msg->N_bytes != ref_len || memcmp(msg->msg, ref, ref_len)) {
+    printf("%s: %s differs from the reference (%d bytes, expected %d)\n", name, step, msg->N_bytes, ref_len);
+    return false;
+  }
+  return true;
+}
+
+static bool test_msg(test_msg_t *t, rrc_msg_t *m, rrc_msg_t *m2)
+{
+  LIBLTE_BIT_MSG_STRUCT  bits;
+  LIBLTE_BYTE_MSG_STRUCT bytes;
+
+  // Pack must match the reference bit for bit
+  if (t->fill) {
+    bzero(m, sizeof(rrc_msg_t));
+    t->fill(m);
+    if (pack(t->channel, m, &bits) != LIBLTE_SUCCESS) {
+      printf("%s: pack failed\n", t->name);
+      return false;
+    }
+    bits_to_bytes(&bits, &bytes);
+    if (bits.N_bits != t->ref_bits) {
+      printf("%s: pack used %d bits, expected %d\n", t->name, bits.N_bits, t->ref_bits);
+      return false;
+    }
+    if (!compare(t->name, "pack", &bytes, t->ref, t->ref_len)) {
+      return false;
+    }
+    if (has_bytes(t->channel)) {
+      if (pack(t->channel, m, &bytes) != LIBLTE_SUCCESS) {
+        printf("%s: byte pack failed\n", t->name);
+        return false;
+      }
+      if (!compare(t->name, "byte pack", &bytes, t->ref, t->ref_len)) {
+        return false;
+      }
+    }
+  }
+
+  // Unpack the reference, padded to bytes as received from PDCP, and pack it again
+  if (t->repacked) {
+    bytes_to_bits(t->ref, t->ref_len, &bits);
+    bzero(m, sizeof(rrc_msg_t));
+    if (unpack(t->channel, &bits, m) != LIBLTE_SUCCESS) {
+      printf("%s: unpack failed\n", t->name);
+      return false;
+    }
+    if (pack(t->channel, m, &bits) != LIBLTE_SUCCESS) {
+      printf("%s: repack failed\n", t->name);
+      return false;
+    }
+    bits_to_bytes(&bits, &bytes);
+    if (!compare(t->name, "repack", &bytes, t->repacked, t->repacked_len)) {
+      return false;
+    }
+  }
+
+  // The byte overloads must unpack the same structure and repack it identically
+  if (t->repacked && has_bytes(t->channel)) {
+    bytes.N_bytes = t->ref_len;
+    memcpy(bytes.msg, t->ref, t->ref_len);
+    bzero(m2, sizeof(rrc_msg_t));
+    if (unpack(t->channel, &bytes, m2) != LIBLTE_SUCCESS) {
+      printf("%s: byte unpack failed\n", t->name);
+      return false;
+    }
+    if (memcmp(m, m2, sizeof(rrc_msg_t))) {
+      printf("%s: byte unpack differs from bit unpack\n", t->name);
+      return false;
+    }
+    if (pack(t->channel, m2, &bytes) != LIBLTE_SUCCESS) {
+      printf("%s: byte repack failed\n", t->name);
+      return false;
+    }
+    if (!compare(t->name, "byte repack", &bytes, t->repacked, t->repacked_len)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  rrc_msg_t *m  = new rrc_msg_t;
+  rrc_msg_t *m2 = new rrc_msg_t;
+
+  for (uint32_t i=0;i<sizeof(test_msgs)/sizeof(test_msg_t);i++) {
+    if (!test_msg(&test_msgs[i], m, m2)) {
+      printf("Failed\n");
+      exit(-1);
+    }
+  }
+
+  delete m;
+  delete m2;
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,415 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "srslte/asn1/liblte_s1ap.h"
+
+/* Packs the S1AP messages exchanged during an attach and compares them with
+ * the encoding produced by the bit-per-byte LIBLTE_BIT_MSG_STRUCT codec, then
+ * unpacks the reference encodings and packs them again.
+ */
+
+// Writes and reads random fields with both bit representations
+static bool test_cursor()
+{
+  LIBLTE_BIT_MSG_STRUCT    bits;
+  LIBLTE_BYTE_MSG_STRUCT   ref;
+  LIBLTE_BYTE_MSG_STRUCT   packed;
+  LIBLTE_BIT_CURSOR_STRUCT cursor;
+  uint32_t                 values[1000];
+  uint32_t                 widths[1000];
+  uint8_t                 *ptr = bits.msg;
+
+  srand(0);
+  memset(packed.msg, 0xA5, 1000);
+  liblte_bit_cursor_init(&cursor, packed.msg);
+  for (uint32_t i=0;i<1000;i++) {
+    widths[i] = rand()%33;
+    values[i] = ((uint32_t) rand() << 16 ^ rand()) & (widths[i] < 32 ? (1u << widths[i]) - 1 : 0xFFFFFFFF);
+    if (i%50 == 0) {
+      liblte_align_up_zero(&ptr, 8);
+      liblte_align_up_zero(&cursor, 8);
+    }
+    liblte_value_2_bits(values[i], &ptr, widths[i]);
+    liblte_value_2_bits(values[i], &cursor, widths[i]);
+  }
+  liblte_align_up_zero(&ptr, 8);
+  liblte_align_up_zero(&cursor, 8);
+  bits.N_bits = ptr - bits.msg;
+  liblte_pack(&bits, &ref);
+  if (cursor.N_bits != bits.N_bits || memcmp(ref.msg, packed.msg, ref.N_bytes)) {
+    printf("Bit cursor write differs\n");
+    return false;
+  }
+
+  liblte_bit_cursor_init(&cursor, packed.msg);
+  for (uint32_t i=0;i<1000;i++) {
+    if (i%50 == 0) {
+      liblte_align_up(&cursor, 8);
+    }
+    if (liblte_bits_2_value(&cursor, widths[i]) != values[i]) {
+      printf("Bit cursor read differs\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+static void fill_bits(uint8_t *bits, uint32_t value, uint32_t n)
+{
+  for (uint32_t i=0;i<n;i++) {
+    bits[i] = (value >> (n-i-1)) & 1;
+  }
+}
+
+static void fill_tai_cgi(LIBLTE_S1AP_TAI_STRUCT *tai, LIBLTE_S1AP_EUTRAN_CGI_STRUCT *cgi)
+{
+  uint8_t plmn[3] = {0x00, 0xF1, 0x10};
+  memcpy(tai->pLMNidentity.buffer, plmn, 3);
+  tai->tAC.buffer[0] = 0x00;
+  tai->tAC.buffer[1] = 0x07;
+  memcpy(cgi->pLMNidentity.buffer, plmn, 3);
+  fill_bits(cgi->cell_ID.buffer, 0x19B01, LIBLTE_S1AP_CELLIDENTITY_BIT_STRING_LEN);
+}
+
+static void fill_nas(LIBLTE_S1AP_NAS_PDU_STRUCT *nas, uint32_t len)
+{
+  nas->n_octets = len;
+  for (uint32_t i=0;i<len;i++) {
+    nas->buffer[i] = (i*37 + 7) & 0xFF;
+  }
+}
+
+static void msg_s1setuprequest(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_S1SETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_S1SETUPREQUEST;
+  LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT *s = &init->choice.S1SetupRequest;
+  uint8_t plmn[3] = {0x00, 0xF1, 0x10};
+  memcpy(s->Global_ENB_ID.pLMNidentity.buffer, plmn, 3);
+  s->Global_ENB_ID.eNB_ID.choice_type = LIBLTE_S1AP_ENB_ID_CHOICE_MACROENB_ID;
+  fill_bits(s->Global_ENB_ID.eNB_ID.choice.macroENB_ID.buffer, 0x19B, LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN);
+  s->eNBname_present = true;
+  s->eNBname.n_octets = 8;
+  memcpy(s->eNBname.buffer, "srsenb01", 8);
+  s->SupportedTAs.len = 1;
+  s->SupportedTAs.buffer[0].tAC.buffer[1] = 0x07;
+  s->SupportedTAs.buffer[0].broadcastPLMNs.len = 1;
+  memcpy(s->SupportedTAs.buffer[0].broadcastPLMNs.buffer[0].buffer, plmn, 3);
+  s->DefaultPagingDRX.e = LIBLTE_S1AP_PAGINGDRX_V128;
+}
+
+static void msg_initialuemessage(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALUEMESSAGE;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE;
+  LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *m = &init->choice.InitialUEMessage;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  fill_nas(&m->NAS_PDU, 41);
+  fill_tai_cgi(&m->TAI, &m->EUTRAN_CGI);
+  m->RRC_Establishment_Cause.e = LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING;
+  m->S_TMSI_present = true;
+  m->S_TMSI.mMEC.buffer[0] = 0x1A;
+  m->S_TMSI.m_TMSI.buffer[0] = 0xC0;
+  m->S_TMSI.m_TMSI.buffer[3] = 0x01;
+}
+
+static void msg_downlinknastransport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_DOWNLINKNASTRANSPORT;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_DOWNLINKNASTRANSPORT;
+  LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT *m = &init->choice.DownlinkNASTransport;
+  m->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 70000;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  fill_nas(&m->NAS_PDU, 36);
+}
+
+static void msg_uplinknastransport(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_UPLINKNASTRANSPORT;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UPLINKNASTRANSPORT;
+  LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT *m = &init->choice.UplinkNASTransport;
+  m->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 70000;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  fill_nas(&m->NAS_PDU, 300);
+  fill_tai_cgi(&m->TAI, &m->EUTRAN_CGI);
+}
+
+static void msg_initialcontextsetuprequest(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST;
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *m = &init->choice.InitialContextSetupRequest;
+  m->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 70000;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  m->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateDL.BitRate = 1000000000;
+  m->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateUL.BitRate = 50000000;
+  m->E_RABToBeSetupListCtxtSUReq.len = 1;
+  LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT *e = &m->E_RABToBeSetupListCtxtSUReq.buffer[0];
+  e->e_RAB_ID.E_RAB_ID = 5;
+  e->e_RABlevelQoSParameters.qCI.QCI = 9;
+  e->e_RABlevelQoSParameters.allocationRetentionPriority.priorityLevel.PriorityLevel = 15;
+  e->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionCapability = LIBLTE_S1AP_PRE_EMPTIONCAPABILITY_SHALL_NOT_TRIGGER_PRE_EMPTION;
+  e->e_RABlevelQoSParameters.allocationRetentionPriority.pre_emptionVulnerability = LIBLTE_S1AP_PRE_EMPTIONVULNERABILITY_PRE_EMPTABLE;
+  e->transportLayerAddress.n_bits = 32;
+  fill_bits(e->transportLayerAddress.buffer, 0x7F000001, 32);
+  e->gTP_TEID.buffer[3] = 0x01;
+  e->nAS_PDU_present = true;
+  fill_nas(&e->nAS_PDU, 120);
+  m->UESecurityCapabilities.encryptionAlgorithms.buffer[0] = 1;
+  m->UESecurityCapabilities.encryptionAlgorithms.buffer[1] = 1;
+  m->UESecurityCapabilities.integrityProtectionAlgorithms.buffer[0] = 1;
+  m->UESecurityCapabilities.integrityProtectionAlgorithms.buffer[1] = 1;
+  for (uint32_t i=0;i<LIBLTE_S1AP_SECURITYKEY_BIT_STRING_LEN;i++) {
+    m->SecurityKey.buffer[i] = (i*7/3) & 1;
+  }
+}
+
+static void msg_initialcontextsetupresponse(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_INITIALCONTEXTSETUPRESPONSE;
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT *m = &succ->choice.InitialContextSetupResponse;
+  m->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 70000;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+  m->E_RABSetupListCtxtSURes.len = 1;
+  m->E_RABSetupListCtxtSURes.buffer[0].e_RAB_ID.E_RAB_ID = 5;
+  m->E_RABSetupListCtxtSURes.buffer[0].transportLayerAddress.n_bits = 32;
+  fill_bits(m->E_RABSetupListCtxtSURes.buffer[0].transportLayerAddress.buffer, 0xC0A80002, 32);
+  m->E_RABSetupListCtxtSURes.buffer[0].gTP_TEID.buffer[3] = 0x02;
+}
+
+static void msg_uecontextreleasecomplete(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_UECONTEXTRELEASE;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_UECONTEXTRELEASECOMPLETE;
+  LIBLTE_S1AP_MESSAGE_UECONTEXTRELEASECOMPLETE_STRUCT *m = &succ->choice.UEContextReleaseComplete;
+  m->MME_UE_S1AP_ID.MME_UE_S1AP_ID = 70000;
+  m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = 1;
+}
+
+// Reference encodings
+static const uint8_t s1setuprequest[] = {
+  0x00, 0x11, 0x00, 0x2d, 0x00, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x08, 0x00,
+  0x00, 0xf1, 0x10, 0x00, 0x00, 0x19, 0xb0, 0x00, 0x3c, 0x40, 0x0a, 0x03,
+  0x80, 0x73, 0x72, 0x73, 0x65, 0x6e, 0x62, 0x30, 0x31, 0x00, 0x40, 0x00,
+  0x07, 0x00, 0x00, 0x01, 0xc0, 0x00, 0xf1, 0x10, 0x00, 0x89, 0x40, 0x01,
+  0x40,};
+
+static const uint8_t initialuemessage[] = {
+  0x00, 0x0c, 0x40, 0x5c, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x02, 0x00,
+  0x01, 0x00, 0x1a, 0x00, 0x2a, 0x29, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0,
+  0xe5, 0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c,
+  0xa1, 0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38,
+  0x5d, 0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0x00,
+  0x43, 0x00, 0x06, 0x00, 0x00, 0xf1, 0x10, 0x00, 0x07, 0x00, 0x64, 0x40,
+  0x08, 0x00, 0x00, 0xf1, 0x10, 0x00, 0x19, 0xb0, 0x10, 0x00, 0x86, 0x40,
+  0x01, 0x30, 0x00, 0x60, 0x00, 0x06, 0x06, 0x80, 0xc0, 0x00, 0x00, 0x01,};
+
+static const uint8_t downlinknastransport[] = {
+  0x00, 0x0b, 0x40, 0x3a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x80,
+  0x01, 0x11, 0x70, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1a, 0x00,
+  0x25, 0x24, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0, 0xe5, 0x0a, 0x2f, 0x54,
+  0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c, 0xa1, 0xc6, 0xeb, 0x10,
+  0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38, 0x5d, 0x82, 0xa7, 0xcc,
+  0xf1, 0x16,};
+
+static const uint8_t uplinknastransport[] = {
+  0x00, 0x0d, 0x40, 0x81, 0x5a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04,
+  0x80, 0x01, 0x11, 0x70, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1a,
+  0x00, 0x81, 0x2e, 0x81, 0x2c, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0, 0xe5,
+  0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c, 0xa1,
+  0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38, 0x5d,
+  0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0xf4, 0x19,
+  0x3e, 0x63, 0x88, 0xad, 0xd2, 0xf7, 0x1c, 0x41, 0x66, 0x8b, 0xb0, 0xd5,
+  0xfa, 0x1f, 0x44, 0x69, 0x8e, 0xb3, 0xd8, 0xfd, 0x22, 0x47, 0x6c, 0x91,
+  0xb6, 0xdb, 0x00, 0x25, 0x4a, 0x6f, 0x94, 0xb9, 0xde, 0x03, 0x28, 0x4d,
+  0x72, 0x97, 0xbc, 0xe1, 0x06, 0x2b, 0x50, 0x75, 0x9a, 0xbf, 0xe4, 0x09,
+  0x2e, 0x53, 0x78, 0x9d, 0xc2, 0xe7, 0x0c, 0x31, 0x56, 0x7b, 0xa0, 0xc5,
+  0xea, 0x0f, 0x34, 0x59, 0x7e, 0xa3, 0xc8, 0xed, 0x12, 0x37, 0x5c, 0x81,
+  0xa6, 0xcb, 0xf0, 0x15, 0x3a, 0x5f, 0x84, 0xa9, 0xce, 0xf3, 0x18, 0x3d,
+  0x62, 0x87, 0xac, 0xd1, 0xf6, 0x1b, 0x40, 0x65, 0x8a, 0xaf, 0xd4, 0xf9,
+  0x1e, 0x43, 0x68, 0x8d, 0xb2, 0xd7, 0xfc, 0x21, 0x46, 0x6b, 0x90, 0xb5,
+  0xda, 0xff, 0x24, 0x49, 0x6e, 0x93, 0xb8, 0xdd, 0x02, 0x27, 0x4c, 0x71,
+  0x96, 0xbb, 0xe0, 0x05, 0x2a, 0x4f, 0x74, 0x99, 0xbe, 0xe3, 0x08, 0x2d,
+  0x52, 0x77, 0x9c, 0xc1, 0xe6, 0x0b, 0x30, 0x55, 0x7a, 0x9f, 0xc4, 0xe9,
+  0x0e, 0x33, 0x58, 0x7d, 0xa2, 0xc7, 0xec, 0x11, 0x36, 0x5b, 0x80, 0xa5,
+  0xca, 0xef, 0x14, 0x39, 0x5e, 0x83, 0xa8, 0xcd, 0xf2, 0x17, 0x3c, 0x61,
+  0x86, 0xab, 0xd0, 0xf5, 0x1a, 0x3f, 0x64, 0x89, 0xae, 0xd3, 0xf8, 0x1d,
+  0x42, 0x67, 0x8c, 0xb1, 0xd6, 0xfb, 0x20, 0x45, 0x6a, 0x8f, 0xb4, 0xd9,
+  0xfe, 0x23, 0x48, 0x6d, 0x92, 0xb7, 0xdc, 0x01, 0x26, 0x4b, 0x70, 0x95,
+  0xba, 0xdf, 0x04, 0x29, 0x4e, 0x73, 0x98, 0xbd, 0xe2, 0x07, 0x2c, 0x51,
+  0x76, 0x9b, 0xc0, 0xe5, 0x0a, 0x2f, 0x54, 0x79, 0x9e, 0xc3, 0xe8, 0x0d,
+  0x32, 0x57, 0x7c, 0xa1, 0xc6, 0xeb, 0x10, 0x35, 0x5a, 0x7f, 0xa4, 0xc9,
+  0xee, 0x13, 0x38, 0x5d, 0x82, 0xa7, 0xcc, 0xf1, 0x16, 0x3b, 0x60, 0x85,
+  0xaa, 0xcf, 0xf4, 0x19, 0x3e, 0x00, 0x64, 0x40, 0x08, 0x00, 0x00, 0xf1,
+  0x10, 0x00, 0x19, 0xb0, 0x10, 0x00, 0x43, 0x40, 0x06, 0x00, 0x00, 0xf1,
+  0x10, 0x00, 0x07,};
+
+static const uint8_t initialcontextsetuprequest[] = {
+  0x00, 0x09, 0x00, 0x80, 0xde, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
+  0x80, 0x01, 0x11, 0x70, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x42,
+  0x00, 0x0a, 0x18, 0x3b, 0x9a, 0xca, 0x00, 0x60, 0x02, 0xfa, 0xf0, 0x80,
+  0x00, 0x18, 0x00, 0x80, 0x8d, 0x00, 0x00, 0x34, 0x00, 0x80, 0x87, 0x45,
+  0x00, 0x09, 0x3d, 0x0f, 0x80, 0x7f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x78, 0x07, 0x2c, 0x51, 0x76, 0x9b, 0xc0, 0xe5, 0x0a, 0x2f, 0x54,
+  0x79, 0x9e, 0xc3, 0xe8, 0x0d, 0x32, 0x57, 0x7c, 0xa1, 0xc6, 0xeb, 0x10,
+  0x35, 0x5a, 0x7f, 0xa4, 0xc9, 0xee, 0x13, 0x38, 0x5d, 0x82, 0xa7, 0xcc,
+  0xf1, 0x16, 0x3b, 0x60, 0x85, 0xaa, 0xcf, 0xf4, 0x19, 0x3e, 0x63, 0x88,
+  0xad, 0xd2, 0xf7, 0x1c, 0x41, 0x66, 0x8b, 0xb0, 0xd5, 0xfa, 0x1f, 0x44,
+  0x69, 0x8e, 0xb3, 0xd8, 0xfd, 0x22, 0x47, 0x6c, 0x91, 0xb6, 0xdb, 0x00,
+  0x25, 0x4a, 0x6f, 0x94, 0xb9, 0xde, 0x03, 0x28, 0x4d, 0x72, 0x97, 0xbc,
+  0xe1, 0x06, 0x2b, 0x50, 0x75, 0x9a, 0xbf, 0xe4, 0x09, 0x2e, 0x53, 0x78,
+  0x9d, 0xc2, 0xe7, 0x0c, 0x31, 0x56, 0x7b, 0xa0, 0xc5, 0xea, 0x0f, 0x34,
+  0x59, 0x7e, 0xa3, 0xc8, 0xed, 0x12, 0x37, 0x5c, 0x81, 0xa6, 0xcb, 0xf0,
+  0x15, 0x3a, 0x00, 0x6b, 0x00, 0x05, 0x18, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x49, 0x00, 0x20, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7,
+  0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7,
+  0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71,};
+
+static const uint8_t initialcontextsetupresponse[] = {
+  0x20, 0x09, 0x00, 0x24, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x04, 0x80,
+  0x01, 0x11, 0x70, 0x00, 0x08, 0x40, 0x02, 0x00, 0x01, 0x00, 0x33, 0x40,
+  0x0f, 0x00, 0x00, 0x32, 0x40, 0x0a, 0x0a, 0x1f, 0xc0, 0xa8, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x02,};
+
+static const uint8_t uecontextreleasecomplete[] = {
+  0x20, 0x17, 0x00, 0x11, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x04, 0x80,
+  0x01, 0x11, 0x70, 0x00, 0x08, 0x40, 0x02, 0x00, 0x01,};
+
+typedef struct {
+  const char    *name;
+  void         (*fill)(LIBLTE_S1AP_S1AP_PDU_STRUCT*);
+  const uint8_t *ref;
+  uint32_t       ref_len;
+}test_msg_t;
+
+#define TEST_MSG(x) {#x, msg_##x, x, sizeof(x)}
+
+static test_msg_t test_msgs[] = {
+  TEST_MSG(s1setuprequest),
+  TEST_MSG(initialuemessage),
+  TEST_MSG(downlinknastransport),
+  TEST_MSG(uplinknastransport),
+  TEST_MSG(initialcontextsetuprequest),
+  TEST_MSG(initialcontextsetupresponse),
+  TEST_MSG(uecontextreleasecomplete)
+};
+
+static bool compare(const char *name, const char *step, LIBLTE_BYTE_MSG_STRUCT *msg, const uint8_t *ref, uint32_t ref_len)
+{
+  if (msg->N_bytes != ref_len || memcmp(msg->msg, ref, ref_len)) {
+    printf("%s: %s differs from the reference (%d bytes, expected %d)\n", name, step, msg->N_bytes, ref_len);
+    return false;
+  }
+  return true;
+}
+
+// Checks a few fields decoded from the reference encodings
+static bool check_fields(LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu)
+{
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  if (pdu->choice_type != LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE) {
+    return true;
+  }
+  if (init->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE) {
+    LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *m = &init->choice.InitialUEMessage;
+    return m->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID == 1 && m->NAS_PDU.n_octets == 41 &&
+           m->NAS_PDU.buffer[40] == ((40*37 + 7) & 0xFF) && m->S_TMSI_present &&
+           m->S_TMSI.mMEC.buffer[0] == 0x1A;
+  }
+  if (init->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST) {
+    LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *m = &init->choice.InitialContextSetupRequest;
+    LIBLTE_S1AP_E_RABTOBESETUPITEMCTXTSUREQ_STRUCT *e = &m->E_RABToBeSetupListCtxtSUReq.buffer[0];
+    return m->MME_UE_S1AP_ID.MME_UE_S1AP_ID == 70000 &&
+           m->uEaggregateMaximumBitrate.uEaggregateMaximumBitRateDL.BitRate == 1000000000 &&
+           m->E_RABToBeSetupListCtxtSUReq.len == 1 && e->e_RAB_ID.E_RAB_ID == 5 &&
+           e->transportLayerAddress.n_bits == 32 && e->nAS_PDU.n_octets == 120;
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = new LIBLTE_S1AP_S1AP_PDU_STRUCT;
+  LIBLTE_BYTE_MSG_STRUCT       msg;
+  LIBLTE_BYTE_MSG_STRUCT       ref_msg;
+
+  if (!test_cursor()) {
+    printf("Failed\n");
+    exit(-1);
+  }
+
+  for (uint32_t i=0;i<sizeof(test_msgs)/sizeof(test_msg_t);i++) {
+    test_msg_t *t = &test_msgs[i];
+
+    // Pack must match the reference byte for byte
+    bzero(pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+    t->fill(pdu);
+    msg.reset();
+    if (liblte_s1ap_pack_s1ap_pdu(pdu, &msg) != LIBLTE_SUCCESS ||
+        !compare(t->name, "pack", &msg, t->ref, t->ref_len)) {
+      printf("Failed\n");
+      exit(-1);
+    }
+
+    // Unpack the reference and pack it again
+    ref_msg.reset();
+    memcpy(ref_msg.msg, t->ref, t->ref_len);
+    ref_msg.N_bytes = t->ref_len;
+    bzero(pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+    if (liblte_s1ap_unpack_s1ap_pdu(&ref_msg, pdu) != LIBLTE_SUCCESS || !check_fields(pdu)) {
+      printf("%s: unpack failed\n", t->name);
+      printf("Failed\n");
+      exit(-1);
+    }
+    msg.reset();
+    if (liblte_s1ap_pack_s1ap_pdu(pdu, &msg) != LIBLTE_SUCCESS ||
+        !compare(t->name, "repack", &msg, t->ref, t->ref_len)) {
+      printf("Failed\n");
+      exit(-1);
+    }
+  }
+  delete pdu;
+  printf("Ok\n");
+  exit(0);
+}
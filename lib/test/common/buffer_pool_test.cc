@@ -0,0 +1,142 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTHREADS 4
+#define NITERS   1000000
+#define NINFLIGHT 64
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "srslte/common/buffer_pool.h"
+
+using namespace srslte;
+
+typedef struct {
+  buffer_pool<byte_buffer_t> *pool;
+  uint32_t                    id;
+  bool                        error;
+}args_t;
+
+void* alloc_thread(void *a) {
+  args_t *args = (args_t*)a;
+  byte_buffer_t *inflight[NINFLIGHT];
+  bzero(inflight, sizeof(inflight));
+
+  for(uint32_t i=0;i<NITERS;i++)
+  {
+    uint32_t k = (i*7 + args->id) % NINFLIGHT;
+    if (inflight[k]) {
+      uint32_t v;
+      memcpy(&v, inflight[k]->msg, 4);
+      if (v != i - NINFLIGHT || inflight[k]->N_bytes != args->id) {
+        args->error = true;
+      }
+      if (!args->pool->deallocate(inflight[k])) {
+        args->error = true;
+      }
+    }
+    inflight[k] = args->pool->allocate("alloc_thread");
+    if (!inflight[k]) {
+      args->error = true;
+      return NULL;
+    }
+    memcpy(inflight[k]->msg, &i, 4);
+    inflight[k]->N_bytes = args->id;
+  }
+  for (uint32_t k=0;k<NINFLIGHT;k++) {
+    if (inflight[k]) {
+      args->pool->deallocate(inflight[k]);
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  bool           result = true;
+  pthread_t      threads[NTHREADS];
+  args_t         args[NTHREADS];
+  struct timeval t[3];
+
+  buffer_pool<byte_buffer_t> pool(NTHREADS*NINFLIGHT*2, 16);
+
+  // Foreign buffers and double frees must be rejected
+  byte_buffer_t foreign;
+  if (pool.deallocate(&foreign)) {
+    result = false;
+  }
+  byte_buffer_t *b = pool.allocate();
+  if (!pool.deallocate(b) || pool.deallocate(b)) {
+    result = false;
+  }
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i=0;i<NTHREADS;i++) {
+    args[i].pool  = &pool;
+    args[i].id    = i;
+    args[i].error = false;
+    pthread_create(&threads[i], NULL, &alloc_thread, &args[i]);
+  }
+  for (uint32_t i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+    if (args[i].error) {
+      result = false;
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  buffer_pool<byte_buffer_t>::stats_t stats = pool.get_stats();
+  if (stats.nof_used != 0 || stats.high_watermark > stats.capacity) {
+    result = false;
+  }
+  printf("%d threads x %d alloc/free in %ld us (%.1f Mops/s). high_watermark=%d, hits=%ld, misses=%ld\n",
+         NTHREADS, NITERS, t[0].tv_sec*1000000+t[0].tv_usec,
+         (float) NTHREADS*NITERS/(t[0].tv_sec*1000000+t[0].tv_usec),
+         stats.high_watermark, (long) stats.nof_hits, (long) stats.nof_misses);
+
+  // All buffers must be reachable again, regardless of which thread cached them
+  std::vector<byte_buffer_t*> all;
+  for (uint32_t i=0;i<stats.capacity;i++) {
+    byte_buffer_t *x = pool.allocate();
+    if (!x) {
+      result = false;
+      break;
+    }
+    all.push_back(x);
+  }
+  for (uint32_t i=0;i<all.size();i++) {
+    pool.deallocate(all[i]);
+  }
+
+  if(result) {
+    printf("Passed\n");
+    exit(0);
+  }else{
+    printf("Failed\n");
+    exit(1);
+  }
+}
@@ -0,0 +1,149 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/common/logger_file.h"
+#include "srslte/common/logger_binary.h"
+
+using namespace srslte;
+
+/* Measures the log calls per second that the worker threads can issue with
+ * logger_file, where log_filter formats every message on the calling thread,
+ * and with logger_binary writing text or binary files. Each thread logs
+ * info() messages with a few arguments and debug_hex() messages with a
+ * 64-byte dump, as the PHY and MAC workers do.
+ */
+
+uint32_t nof_threads = 4;
+uint32_t nof_msgs    = 100000;
+
+void usage(char *prog) {
+  printf("Usage: %s [tn]\n", prog);
+  printf("\t-t number of logging threads [Default %d]\n", nof_threads);
+  printf("\t-n messages per thread [Default %d]\n", nof_msgs);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "tn")) != -1) {
+    switch(opt) {
+    case 't':
+      nof_threads = atoi(argv[optind]);
+      break;
+    case 'n':
+      nof_msgs = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  logger *l;
+  int     thread_id;
+  double  elapsed_us;
+}args_t;
+
+void* thread_loop(void *a) {
+  args_t *args = (args_t*)a;
+  struct timeval t[2];
+  char    buf[16];
+  uint8_t hex[64];
+
+  for(int i=0;i<64;i++)
+    hex[i] = i;
+  sprintf(buf, "PHY%d", args->thread_id);
+  log_filter filter(buf, args->l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(64);
+
+  gettimeofday(&t[0], NULL);
+  for(uint32_t i=0;i<nof_msgs/2;i++) {
+    filter.step(i%10240);
+    filter.info("PDSCH: rnti=0x%x, mcs=%d, tbs=%d, snr=%.1f dB, crc=%s\n", 0x46, i%29, 1000+i, 10.5, "OK");
+    filter.debug_hex(hex, 64, "MAC PDU rnti=0x%x, len=%d\n", 0x46, 64);
+  }
+  gettimeofday(&t[1], NULL);
+  args->elapsed_us = (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+  return NULL;
+}
+
+double run(logger *l) {
+  pthread_t *threads = new pthread_t[nof_threads];
+  args_t    *args    = new args_t[nof_threads];
+  double     max_us  = 0;
+
+  for(uint32_t i=0;i<nof_threads;i++) {
+    args[i].l = l;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &thread_loop, &args[i]);
+  }
+  for(uint32_t i=0;i<nof_threads;i++) {
+    pthread_join(threads[i], NULL);
+    if (args[i].elapsed_us > max_us) {
+      max_us = args[i].elapsed_us;
+    }
+  }
+  delete [] threads;
+  delete [] args;
+  return (double) nof_threads*(nof_msgs/2)*2/max_us*1e6;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  printf("%d threads, %d messages each\n", nof_threads, nof_msgs);
+  {
+    logger_file l;
+    l.init("logger_bench_file.log");
+    printf("%-22s %12.0f calls/s\n", "logger_file", run(&l));
+  }
+  {
+    logger_binary l;
+    l.init("logger_bench_text.log", true);
+    double r = run(&l);
+    l.stop();
+    printf("%-22s %12.0f calls/s (%lu dropped)\n", "logger_binary text", r, l.get_nof_dropped());
+  }
+  {
+    logger_binary l;
+    l.init("logger_bench_binary.log");
+    double r = run(&l);
+    l.stop();
+    printf("%-22s %12.0f calls/s (%lu dropped)\n", "logger_binary binary", r, l.get_nof_dropped());
+  }
+  remove("logger_bench_file.log");
+  remove("logger_bench_text.log");
+  remove("logger_bench_binary.log");
+  exit(0);
+}
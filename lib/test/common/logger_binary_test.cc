@@ -0,0 +1,280 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTHREADS 8
+#define NMSGS    500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/common/logger_binary.h"
+
+using namespace srslte;
+
+typedef struct {
+  logger_binary *l;
+  int thread_id;
+}args_t;
+
+static const char *names[4] = {"a", "bcd", "", "long string argument"};
+
+void expected(char *buf, int len, int t, int i) {
+  snprintf(buf, len, "Thread %d: %d %s %.3f %llu %c %5x|%-4s|%hhd|%%|%ld\n",
+           t, i, names[i%4], i*0.5, 1ULL<<(i%64), 'a'+i%26, i, names[(i+1)%4], (char) (i+250), -1L*i);
+}
+
+void* thread_loop(void *a) {
+  args_t *args = (args_t*)a;
+  char    buf[100];
+  uint8_t hex[100];
+
+  for(int i=0;i<100;i++)
+    hex[i] = i & 0xFF;
+  sprintf(buf, "LAYER%d", args->thread_id);
+  log_filter filter(buf, args->l, true);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(32);
+
+  int t = args->thread_id;
+  for(int i=0;i<NMSGS;i++)
+  {
+    filter.step(i);
+    filter.info("Thread %d: %d %s %.3f %llu %c %5x|%-4s|%hhd|%%|%ld\n",
+                t, i, names[i%4], i*0.5, 1ULL<<(i%64), 'a'+i%26, i, names[(i+1)%4], (char) (i+250), -1L*i);
+    filter.debug_hex(hex, 100, "Thread %d: %d %s %.3f %llu %c %5x|%-4s|%hhd|%%|%ld\n",
+                     t, i, names[i%4], i*0.5, 1ULL<<(i%64), 'a'+i%26, i, names[(i+1)%4], (char) (i+250), -1L*i);
+  }
+  return NULL;
+}
+
+bool check_output(FILE *f)
+{
+  static bool written[NTHREADS][NMSGS][2];
+  char line[1024];
+  char exp[256];
+  int  nof_hex = 0;
+
+  bzero(written, sizeof(written));
+  while (fgets(line, sizeof(line), f)) {
+    if (!strncmp(line, "             ", 13)) {
+      nof_hex++;
+      continue;
+    }
+    char *m = strstr(line, "Thread ");
+    int t, i;
+    if (!m || sscanf(m, "Thread %d: %d", &t, &i) != 2 || t >= NTHREADS || i >= NMSGS) {
+      printf("Unexpected line: %s", line);
+      return false;
+    }
+    expected(exp, sizeof(exp), t, i);
+    if (strncmp(m, exp, strlen(exp))) {
+      printf("Expected %s, got %s", exp, m);
+      return false;
+    }
+    char tti[16];
+    snprintf(tti, sizeof(tti), "[%05d] ", i);
+    bool is_hex = strstr(line, "[D]") != NULL;
+    if (!strstr(line, tti) || (!is_hex && !strstr(line, "[I]"))) {
+      printf("Wrong header: %s", line);
+      return false;
+    }
+    written[t][i][is_hex ? 1 : 0] = true;
+  }
+  for (int t=0;t<NTHREADS;t++) {
+    for (int i=0;i<NMSGS;i++) {
+      if (!written[t][i][0] || !written[t][i][1]) {
+        printf("Missing message %d from thread %d\n", i, t);
+        return false;
+      }
+    }
+  }
+  // 32 bytes of hex are two lines per message
+  return nof_hex == 2*NTHREADS*NMSGS;
+}
+
+bool test_threads(bool text)
+{
+  const char *filename = "logger_binary_test.log";
+  logger_binary l;
+  l.init(filename, text);
+
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  for(int i=0;i<NTHREADS;i++) {
+    args[i].l = &l;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &thread_loop, &args[i]);
+  }
+  for(int i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+  }
+  l.stop();
+
+  if (l.get_nof_dropped()) {
+    printf("Dropped %lu records\n", l.get_nof_dropped());
+    return false;
+  }
+  // The rings of the exited threads are freed but their records still counted
+  if (l.get_nof_records() != 2*NTHREADS*NMSGS) {
+    printf("Counted %lu records\n", l.get_nof_records());
+    return false;
+  }
+
+  FILE *f = fopen(filename, "r");
+  if (!f) {
+    return false;
+  }
+  FILE *out = f;
+  if (!text) {
+    out = tmpfile();
+    int n = logger_binary::decode(f, out);
+    fclose(f);
+    if (n != 2*NTHREADS*NMSGS) {
+      printf("Decoded %d records\n", n);
+      fclose(out);
+      return false;
+    }
+    rewind(out);
+  }
+  bool ret = check_output(out);
+  fclose(out);
+  remove(filename);
+  return ret;
+}
+
+// A small ring must drop records rather than block, and count them
+bool test_overflow()
+{
+  const char *filename = "logger_binary_test.log";
+  const int   N        = 20000;
+  uint8_t     hex[1024];
+
+  bzero(hex, sizeof(hex));
+  logger_binary l;
+  l.init(filename, false, -1, 1);
+
+  log_filter filter("OVERFLOW", &l);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(1024);
+  for (int i=0;i<N;i++) {
+    filter.debug_hex(hex, sizeof(hex), "Message %d", i);
+  }
+  l.stop();
+
+  printf("Overflow: %lu records, %lu dropped\n", l.get_nof_records(), l.get_nof_dropped());
+  if (l.get_nof_records() + l.get_nof_dropped() != N) {
+    return false;
+  }
+  FILE *f = fopen(filename, "r");
+  if (!f) {
+    return false;
+  }
+  FILE *out = fopen("/dev/null", "w");
+  int n = logger_binary::decode(f, out);
+  fclose(out);
+  fclose(f);
+  remove(filename);
+  return n == (int) l.get_nof_records();
+}
+
+// Long string arguments and hex dumps are cut to the record size
+bool test_long_args()
+{
+  const char *filename = "logger_binary_test.log";
+  char        str[256];
+  uint8_t     hex[4096];
+
+  memset(str, 'x', sizeof(str) - 1);
+  str[sizeof(str) - 1] = 0;
+  memset(hex, 0xab, sizeof(hex));
+  logger_binary l;
+  l.init(filename, true);
+
+  log_filter filter("LONG", &l);
+  filter.set_level(LOG_LEVEL_DEBUG);
+  filter.set_hex_limit(sizeof(hex));
+  filter.debug_hex(hex, sizeof(hex), "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s\n",
+                   str, str, str, str, str, str, str, str, str, str, str, str, str, str, str, str);
+  filter.debug_hex(hex, sizeof(hex), "%s%s%s%s\n", str, str, str, str);
+  l.stop();
+
+  FILE *f = fopen(filename, "r");
+  if (!f) {
+    return false;
+  }
+  char line[4096];
+  int  nof_x[2]   = {0, 0};
+  int  nof_hex[2] = {0, 0};
+  int  msg        = -1;
+  while (fgets(line, sizeof(line), f)) {
+    if (!strncmp(line, "             ", 13)) {
+      if (msg >= 0) {
+        for (char *c = line + 18; (c = strstr(c, "ab ")); c += 3) {
+          nof_hex[msg]++;
+        }
+      }
+    } else if (++msg < 2) {
+      for (char *c = line; *c; c++) {
+        nof_x[msg] += *c == 'x';
+      }
+    }
+  }
+  fclose(f);
+  remove(filename);
+
+  // 16 argument slots leave 1888 bytes, which hold 14 full strings and a cut one. The last
+  // argument is dropped and its slot leaves room for 8 bytes of hex
+  int max      = SRSLTE_LOGGER_BINARY_MAX_RECORD - (int) sizeof(log_record_t) - 16*8;
+  int full_len = SRSLTE_LOGGER_BINARY_MAX_STR - 1;
+  printf("Long args: %d/%d string bytes, %d/%d hex bytes\n", nof_x[0], nof_x[1], nof_hex[0], nof_hex[1]);
+  return msg == 1 &&
+         nof_x[0] == 14*full_len + (max - 14*(full_len + 1) - 1) && nof_hex[0] == 8 &&
+         nof_x[1] == 4*full_len &&
+         nof_hex[1] == SRSLTE_LOGGER_BINARY_MAX_RECORD - (int) sizeof(log_record_t) - 4*8 - 4*(full_len + 1);
+}
+
+int main(int argc, char **argv) {
+  if (!test_threads(false)) {
+    printf("Binary mode Failed\n");
+    exit(-1);
+  }
+  if (!test_threads(true)) {
+    printf("Text mode Failed\n");
+    exit(-1);
+  }
+  if (!test_overflow()) {
+    printf("Overflow Failed\n");
+    exit(-1);
+  }
+  if (!test_long_args()) {
+    printf("Long args Failed\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
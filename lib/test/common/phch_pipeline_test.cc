@@ -0,0 +1,202 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTHREADS  4
+#define NSECTIONS 3
+#define NSEQ      400
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "srslte/common/phch_pipeline.h"
+
+using namespace srslte;
+
+typedef struct {
+  phch_pipeline *p;
+  int            thread_id;
+}args_t;
+
+// Sequence numbers in the order each section was entered
+static uint32_t order[NSECTIONS][NSEQ];
+static uint32_t nof_order[NSECTIONS];
+
+// Dropped subframes skip every section, or all but the first
+static bool is_skipped(uint32_t seq, uint32_t section) {
+  return seq%7 == 3 || (seq%11 == 5 && section > 0);
+}
+
+void* worker_loop(void *a) {
+  args_t  *args = (args_t*)a;
+  uint32_t seed = args->thread_id;
+
+  // Workers take subframes round-robin and finish their stages at random times
+  for (uint32_t seq=args->thread_id;seq<NSEQ;seq+=NTHREADS) {
+    usleep(rand_r(&seed)%500);
+    for (uint32_t i=0;i<NSECTIONS;i++) {
+      if (is_skipped(seq, i)) {
+        args->p->skip(seq, i);
+        break;
+      }
+      if (!args->p->enter(i, seq)) {
+        return NULL;
+      }
+      order[i][nof_order[i]++] = seq;
+      usleep(rand_r(&seed)%50);
+      args->p->leave(i, seq);
+    }
+  }
+  return NULL;
+}
+
+// Sections are entered in sequence order, whatever the order in which the workers get to them
+bool test_order()
+{
+  phch_pipeline p;
+  float         share[1] = {1.0};
+  p.init(1, share, NSECTIONS, 0);
+
+  bzero(order, sizeof(order));
+  bzero(nof_order, sizeof(nof_order));
+
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  for(int i=0;i<NTHREADS;i++) {
+    args[i].p = &p;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &worker_loop, &args[i]);
+  }
+  for(int i=0;i<NTHREADS;i++) {
+    pthread_join(threads[i], NULL);
+  }
+  p.stop();
+
+  for (uint32_t i=0;i<NSECTIONS;i++) {
+    uint32_t n = 0;
+    for (uint32_t seq=0;seq<NSEQ;seq++) {
+      if (is_skipped(seq, i)) {
+        continue;
+      }
+      if (n >= nof_order[i] || order[i][n] != seq) {
+        printf("Section %d: expected subframe %d in position %d\n", i, seq, n);
+        return false;
+      }
+      n++;
+    }
+    if (n != nof_order[i]) {
+      printf("Section %d: entered %d times, expected %d\n", i, nof_order[i], n);
+      return false;
+    }
+  }
+  return true;
+}
+
+void* enter_loop(void *a) {
+  args_t *args = (args_t*)a;
+  // Subframe 0 never arrives, so this blocks until the pipeline is stopped
+  bool *ret = new bool;
+  *ret = args->p->enter(0, 1 + args->thread_id);
+  return ret;
+}
+
+// stop() wakes up every worker waiting for its turn
+bool test_stop()
+{
+  phch_pipeline p;
+  float         share[1] = {1.0};
+  p.init(1, share, 1, 0);
+
+  pthread_t threads[NTHREADS];
+  args_t    args[NTHREADS];
+  for(int i=0;i<NTHREADS;i++) {
+    args[i].p = &p;
+    args[i].thread_id = i;
+    pthread_create(&threads[i], NULL, &enter_loop, &args[i]);
+  }
+  usleep(20000);
+  p.stop();
+
+  bool ok = true;
+  for(int i=0;i<NTHREADS;i++) {
+    void *ret;
+    pthread_join(threads[i], &ret);
+    if (*(bool*) ret) {
+      printf("Worker %d entered a stopped pipeline\n", i);
+      ok = false;
+    }
+    delete (bool*) ret;
+  }
+  // Once stopped, nothing blocks
+  if (p.enter(0, 0) || p.enter(0, 100)) {
+    printf("Entered a stopped pipeline\n");
+    ok = false;
+  }
+  return ok;
+}
+
+// A stage that ends after its share of the budget is counted as late
+bool test_metrics()
+{
+  phch_pipeline p;
+  float         share[2] = {0.5, 1.0};
+  p.init(2, share, 1, 2000);
+  if (p.get_budget_us(0) != 1000 || p.get_budget_us(1) != 2000) {
+    return false;
+  }
+
+  struct timeval t_rx;
+  uint32_t       finish_us;
+  gettimeofday(&t_rx, NULL);
+  bool late_0 = p.stage_end(0, &t_rx, &finish_us);
+  t_rx.tv_sec -= 1;
+  bool late_1 = p.stage_end(1, &t_rx, &finish_us);
+  p.stop();
+
+  pipeline_stage_metrics_t m[2];
+  p.get_metrics(m);
+  return !late_0 && late_1 && finish_us >= 1000000 &&
+         m[0].nof_ttis == 1 && m[0].nof_late == 0 && m[0].hist[0] == 1 && m[0].budget_us == 1000 &&
+         m[1].nof_ttis == 1 && m[1].nof_late == 1 && m[1].hist[SRSLTE_PIPELINE_HIST_SZ-1] == 1;
+}
+
+int main(int argc, char **argv) {
+  if (!test_order()) {
+    printf("Order Failed\n");
+    exit(-1);
+  }
+  if (!test_stop()) {
+    printf("Stop Failed\n");
+    exit(-1);
+  }
+  if (!test_metrics()) {
+    printf("Metrics Failed\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -0,0 +1,150 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/security.h"
+#include "srslte/common/security_aes.h"
+
+using namespace srslte;
+
+/* Measures the EEA2 and EIA2 throughput of one core with each AES
+ * implementation supported by the CPU, against the per-PDU functions that
+ * expand the key schedule on every call. PDUs are processed in batches of
+ * nof_pdus, as a PDCP entity with several SDUs queued would do.
+ */
+
+uint32_t nof_pdus  = 32;
+uint32_t nof_bytes = 1000000000;
+
+const uint32_t pdu_sizes[] = {40, 100, 300, 1500, 9000};
+#define NOF_SIZES (sizeof(pdu_sizes)/sizeof(pdu_sizes[0]))
+
+void usage(char *prog) {
+  printf("Usage: %s [nb]\n", prog);
+  printf("\t-n PDUs per batch [Default %d]\n", nof_pdus);
+  printf("\t-b bytes processed per measurement [Default %d]\n", nof_bytes);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nb")) != -1) {
+    switch(opt) {
+    case 'n':
+      nof_pdus = atoi(argv[optind]);
+      break;
+    case 'b':
+      nof_bytes = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+double elapsed_us(struct timeval *t) {
+  return (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+}
+
+// Returns Gbit/s. impl is SECURITY_AES_IMPL_N_ITEMS for the per-PDU functions
+double run(security_aes_impl_t impl, bool integrity, uint32_t pdu_len, uint8_t *buf, uint8_t *mac) {
+  security_aes_t  aes;
+  security_pdu_t *pdus = new security_pdu_t[nof_pdus];
+  uint8_t         key[16];
+  struct timeval  t[2];
+
+  for (int i = 0; i < 16; i++) {
+    key[i] = rand();
+  }
+  if (impl != SECURITY_AES_IMPL_N_ITEMS) {
+    security_aes_init(&aes, key, impl);
+  }
+  for (uint32_t i = 0; i < nof_pdus; i++) {
+    pdus[i].count     = i;
+    pdus[i].bearer    = 1;
+    pdus[i].direction = SECURITY_DIRECTION_DOWNLINK;
+    pdus[i].msg       = &buf[i*pdu_len];
+    pdus[i].msg_len   = pdu_len;
+    pdus[i].out       = integrity ? &mac[4*i] : pdus[i].msg;
+  }
+
+  uint32_t nof_batches = nof_bytes/(pdu_len*nof_pdus) + 1;
+  gettimeofday(&t[0], NULL);
+  for (uint32_t b = 0; b < nof_batches; b++) {
+    if (impl == SECURITY_AES_IMPL_N_ITEMS) {
+      for (uint32_t i = 0; i < nof_pdus; i++) {
+        if (integrity) {
+          security_128_eia2(key, pdus[i].count, pdus[i].bearer, pdus[i].direction, pdus[i].msg, pdu_len, pdus[i].out);
+        } else {
+          security_128_eea2(key, pdus[i].count, pdus[i].bearer, pdus[i].direction, pdus[i].msg, pdu_len, pdus[i].out);
+        }
+      }
+    } else if (integrity) {
+      security_aes_eia2(&aes, pdus, nof_pdus);
+    } else {
+      security_aes_eea2(&aes, pdus, nof_pdus);
+    }
+  }
+  gettimeofday(&t[1], NULL);
+  delete [] pdus;
+  return (double) nof_batches*nof_pdus*pdu_len*8/elapsed_us(t)/1e3;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  uint8_t *buf = (uint8_t*) malloc(nof_pdus*pdu_sizes[NOF_SIZES-1]);
+  uint8_t *mac = (uint8_t*) malloc(4*nof_pdus);
+  for (uint32_t i = 0; i < nof_pdus*pdu_sizes[NOF_SIZES-1]; i++) {
+    buf[i] = rand();
+  }
+
+  printf("Batches of %d PDUs, throughput in Gbit/s on one core\n", nof_pdus);
+  printf("%-8s %-10s", "", "");
+  for (uint32_t s = 0; s < NOF_SIZES; s++) {
+    printf(" %7d B", pdu_sizes[s]);
+  }
+  printf("\n");
+  for (int integrity = 0; integrity < 2; integrity++) {
+    for (int i = SECURITY_AES_IMPL_N_ITEMS; i >= 0; i--) {
+      if (i != SECURITY_AES_IMPL_N_ITEMS && i > security_aes_get_impl()) {
+        continue;
+      }
+      printf("%-8s %-10s", integrity ? "EIA2" : "EEA2",
+             i == SECURITY_AES_IMPL_N_ITEMS ? "per-PDU" : security_aes_impl_text[i]);
+      for (uint32_t s = 0; s < NOF_SIZES; s++) {
+        printf(" %9.2f", run((security_aes_impl_t) i, integrity, pdu_sizes[s], buf, mac));
+      }
+      printf("\n");
+    }
+  }
+  free(buf);
+  free(mac);
+  exit(0);
+}
@@ -0,0 +1,223 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "srslte/common/security_aes.h"
+#include "srslte/common/liblte_security.h"
+
+using namespace srslte;
+
+#define MAX_LEN    1600
+#define NOF_PDUS   37
+
+/* Checks every AES implementation supported by this CPU against the
+ * reference vectors, against each other and against the bit-oriented EIA2 of
+ * liblte, and the batch functions against one call per PDU. */
+
+static void hex_to_bytes(const char *hex, uint8_t *bytes)
+{
+  for (uint32_t i = 0; i < strlen(hex)/2; i++) {
+    unsigned int b;
+    sscanf(&hex[2*i], "%2x", &b);
+    bytes[i] = (uint8_t) b;
+  }
+}
+
+static bool check(const char *name, security_aes_impl_t impl, uint8_t *out, const char *expected_hex)
+{
+  uint8_t expected[MAX_LEN];
+  uint32_t len = strlen(expected_hex)/2;
+  hex_to_bytes(expected_hex, expected);
+  if (memcmp(out, expected, len)) {
+    printf("%s (%s) failed\n", name, security_aes_impl_text[impl]);
+    return false;
+  }
+  return true;
+}
+
+static bool test_vectors(security_aes_impl_t impl)
+{
+  security_aes_t aes;
+  uint8_t key[16];
+  uint8_t msg[64];
+  uint8_t out[64];
+  bool    ok = true;
+
+  // FIPS-197 Appendix C.1
+  hex_to_bytes("000102030405060708090a0b0c0d0e0f", key);
+  hex_to_bytes("00112233445566778899aabbccddeeff", msg);
+  security_aes_init(&aes, key, impl);
+  security_aes_encrypt_block(&aes, msg, out);
+  ok &= check("AES-128", impl, out, "69c4e0d86a7b0430d8cdb78070b4c55a");
+
+  // RFC 4493 Section 4
+  hex_to_bytes("2b7e151628aed2a6abf7158809cf4f3c", key);
+  hex_to_bytes("6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+               "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710", msg);
+  security_aes_init(&aes, key, impl);
+  security_aes_cmac(&aes, msg, 0, out);
+  ok &= check("CMAC 0", impl, out, "bb1d6929e95937287fa37d129b756746");
+  security_aes_cmac(&aes, msg, 16, out);
+  ok &= check("CMAC 16", impl, out, "070a16b46b4d4144f79bdd9dd04a287c");
+  security_aes_cmac(&aes, msg, 40, out);
+  ok &= check("CMAC 40", impl, out, "dfa66747de9ae63030ca32611497c827");
+  security_aes_cmac(&aes, msg, 64, out);
+  ok &= check("CMAC 64", impl, out, "51f0bebf7e3b9d92fc49741779363cfe");
+
+  // 33.401 Annex C.2 Test Set 1
+  security_pdu_t pdu;
+  hex_to_bytes("d3c5d592327fb11c4035c6680af8c6d1", key);
+  hex_to_bytes("484583d5afe082ae", msg);
+  security_aes_init(&aes, key, impl);
+  pdu.count     = 0x398a59b4;
+  pdu.bearer    = 0x1a;
+  pdu.direction = 1;
+  pdu.msg       = msg;
+  pdu.msg_len   = 8;
+  pdu.out       = out;
+  security_aes_eia2(&aes, &pdu, 1);
+  ok &= check("EIA2 set 1", impl, out, "b93787e6");
+
+  // 33.401 Annex C.1 Test Set 2
+  hex_to_bytes("2bd6459f82c440e0952c49104805ff48", key);
+  hex_to_bytes("7ec61272743bf1614726446a6c38ced166f6ca76eb5430044286346cef130f92"
+               "922b03450d3a9975e5bd2ea0eb55ad8e1b199e3ec4316020e9a1b285e7627953"
+               "59b7bdfd39bef4b2484583d5afe082aee638bf5fd5a606193901a08f4ab41aab"
+               "9b134880", msg);
+  security_aes_init(&aes, key, impl);
+  pdu.count     = 0xc675a64b;
+  pdu.bearer    = 0x0c;
+  pdu.direction = 1;
+  pdu.msg       = msg;
+  pdu.msg_len   = 100;
+  uint8_t ct[100];
+  pdu.out       = ct;
+  security_aes_eea2(&aes, &pdu, 1);
+  ok &= check("EEA2 set 2", impl, ct,
+              "5961605353c64bdca15b195e288553a910632506d6200aa790c4c806c99904cf"
+              "2445cc50bb1cf168a49673734e081b57e324ce5259c0e78d4cd97b870976503c"
+              "0943f2cb5ae8f052c7b7d392239587b8956086bcab18836042e2e6ce42432a17"
+              "105c53");  // 798 bits
+  return ok;
+}
+
+static void random_pdus(security_pdu_t *pdus, uint8_t *msg, uint8_t *out, uint32_t nof_pdus)
+{
+  for (uint32_t i = 0; i < nof_pdus; i++) {
+    pdus[i].count     = (uint32_t) rand();
+    pdus[i].bearer    = (uint8_t) (rand() % 32);
+    pdus[i].direction = (uint8_t) (rand() % 2);
+    pdus[i].msg       = &msg[i*MAX_LEN];
+    pdus[i].msg_len   = (i < 20) ? i : (uint32_t) (rand() % MAX_LEN);
+    pdus[i].out       = &out[i*MAX_LEN];
+    for (uint32_t j = 0; j < pdus[i].msg_len; j++) {
+      pdus[i].msg[j] = (uint8_t) rand();
+    }
+  }
+}
+
+static bool test_random(security_aes_impl_t impl)
+{
+  security_aes_t aes, ref;
+  security_pdu_t pdus[NOF_PDUS];
+  uint8_t        key[16];
+  uint8_t       *msg = (uint8_t*) malloc(NOF_PDUS*MAX_LEN);
+  uint8_t       *out = (uint8_t*) malloc(NOF_PDUS*MAX_LEN);
+  uint8_t        exp[MAX_LEN];
+  bool           ok  = true;
+  LIBLTE_BIT_MSG_STRUCT *bits = new LIBLTE_BIT_MSG_STRUCT;
+
+  for (int i = 0; i < 16; i++) {
+    key[i] = (uint8_t) rand();
+  }
+  security_aes_init(&aes, key, impl);
+  security_aes_init(&ref, key, SECURITY_AES_IMPL_SOFT);
+  random_pdus(pdus, msg, out, NOF_PDUS);
+
+  // EEA2 batch against one software call per PDU
+  security_aes_eea2(&aes, pdus, NOF_PDUS);
+  for (uint32_t i = 0; i < NOF_PDUS && ok; i++) {
+    security_pdu_t pdu = pdus[i];
+    pdu.out = exp;
+    security_aes_eea2(&ref, &pdu, 1);
+    if (memcmp(exp, pdus[i].out, pdus[i].msg_len)) {
+      printf("EEA2 batch (%s) failed for PDU %d of %d bytes\n", security_aes_impl_text[impl], i, pdus[i].msg_len);
+      ok = false;
+    }
+  }
+
+  // In place
+  for (uint32_t i = 0; i < NOF_PDUS; i++) {
+    pdus[i].out = pdus[i].msg;
+  }
+  security_aes_eea2(&aes, pdus, NOF_PDUS);
+  for (uint32_t i = 0; i < NOF_PDUS && ok; i++) {
+    if (memcmp(&out[i*MAX_LEN], pdus[i].msg, pdus[i].msg_len)) {
+      printf("EEA2 in place (%s) failed for PDU %d\n", security_aes_impl_text[impl], i);
+      ok = false;
+    }
+    pdus[i].out = &out[i*MAX_LEN];
+  }
+
+  // EIA2 batch against the bit-oriented implementation
+  security_aes_eia2(&aes, pdus, NOF_PDUS);
+  for (uint32_t i = 0; i < NOF_PDUS && ok; i++) {
+    bits->N_bits = pdus[i].msg_len*8;
+    for (uint32_t j = 0; j < bits->N_bits; j++) {
+      bits->msg[j] = (pdus[i].msg[j/8] >> (7 - j%8)) & 1;
+    }
+    liblte_security_128_eia2(key, pdus[i].count, pdus[i].bearer, pdus[i].direction, bits, exp);
+    if (memcmp(exp, pdus[i].out, 4)) {
+      printf("EIA2 batch (%s) failed for PDU %d of %d bytes\n", security_aes_impl_text[impl], i, pdus[i].msg_len);
+      ok = false;
+    }
+  }
+
+  delete bits;
+  free(msg);
+  free(out);
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  bool ok = true;
+  srand(0);
+  printf("Fastest implementation: %s\n", security_aes_impl_text[security_aes_get_impl()]);
+  for (int i = 0; i <= security_aes_get_impl(); i++) {
+    ok &= test_vectors((security_aes_impl_t) i);
+    ok &= test_random((security_aes_impl_t) i);
+  }
+  if (ok) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(-1);
+  }
+}
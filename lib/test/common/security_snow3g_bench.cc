@@ -0,0 +1,144 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/security_snow3g.h"
+#include "srslte/common/snow_3g.h"
+
+using namespace srslte;
+
+/* Measures the SNOW 3G keystream rate and the EEA1 (f8) and EIA1 (f9)
+ * throughput of one core, with the context in security_snow3g.h and with
+ * the reference implementation in snow_3g.h.
+ */
+
+uint32_t nof_bytes = 20000000;
+
+const uint32_t pdu_sizes[] = {40, 100, 300, 1500, 9000};
+#define NOF_SIZES (sizeof(pdu_sizes)/sizeof(pdu_sizes[0]))
+
+void usage(char *prog) {
+  printf("Usage: %s [b]\n", prog);
+  printf("\t-b bytes processed per measurement [Default %d]\n", nof_bytes);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "b")) != -1) {
+    switch(opt) {
+    case 'b':
+      nof_bytes = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+double elapsed_us(struct timeval *t) {
+  return (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+}
+
+// Returns Mbit/s
+double run(bool reference, bool integrity, uint32_t pdu_len, uint8_t *buf) {
+  uint8_t        key[16];
+  uint8_t        mac[4];
+  struct timeval t[2];
+
+  for (int i = 0; i < 16; i++) {
+    key[i] = rand();
+  }
+  uint32_t nof_pdus = nof_bytes/pdu_len + 1;
+  if (reference) {
+    // The reference code is much slower
+    nof_pdus = nof_pdus/10 + 1;
+  }
+  gettimeofday(&t[0], NULL);
+  for (uint32_t i = 0; i < nof_pdus; i++) {
+    if (reference && integrity) {
+      snow3g_f9(key, i, 1 << 27, 1, buf, pdu_len*8);
+    } else if (reference) {
+      snow3g_f8(key, i, 1, 1, buf, pdu_len*8);
+    } else if (integrity) {
+      security_snow3g_f9(key, i, 1 << 27, 1, buf, pdu_len*8, mac);
+    } else {
+      security_snow3g_f8(key, i, 1, 1, buf, pdu_len*8, buf);
+    }
+  }
+  gettimeofday(&t[1], NULL);
+  return (double) nof_pdus*pdu_len*8/elapsed_us(t);
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  uint8_t *buf = (uint8_t*) malloc(pdu_sizes[NOF_SIZES-1]);
+  for (uint32_t i = 0; i < pdu_sizes[NOF_SIZES-1]; i++) {
+    buf[i] = rand();
+  }
+
+  // Keystream words per second, after initialization
+  uint32_t  nof_words = nof_bytes/4;
+  uint32_t *z = (uint32_t*) malloc(4*nof_words);
+  uint32_t  k[4] = {1, 2, 3, 4}, iv[4] = {5, 6, 7, 8};
+  uint8_t   key[16] = {0};
+  struct timeval t[2];
+  security_snow3g_t q;
+
+  security_snow3g_init(&q, key, iv);
+  gettimeofday(&t[0], NULL);
+  security_snow3g_keystream(&q, z, nof_words);
+  gettimeofday(&t[1], NULL);
+  double rate = nof_words/elapsed_us(t);
+  snow3g_initialize(k, iv);
+  gettimeofday(&t[0], NULL);
+  snow3g_generate_keystream(nof_words/10, z);
+  gettimeofday(&t[1], NULL);
+  printf("Keystream: %.1f Mwords/s, reference %.1f Mwords/s\n", rate, nof_words/10/elapsed_us(t));
+
+  printf("Throughput in Mbit/s on one core\n");
+  printf("%-14s", "");
+  for (uint32_t s = 0; s < NOF_SIZES; s++) {
+    printf(" %7d B", pdu_sizes[s]);
+  }
+  printf("\n");
+  for (int integrity = 0; integrity < 2; integrity++) {
+    for (int reference = 1; reference >= 0; reference--) {
+      printf("%-4s %-9s", integrity ? "EIA1" : "EEA1", reference ? "reference" : "context");
+      for (uint32_t s = 0; s < NOF_SIZES; s++) {
+        printf(" %9.1f", run(reference, integrity, pdu_sizes[s], buf));
+      }
+      printf("\n");
+    }
+  }
+  free(z);
+  free(buf);
+  exit(0);
+}
@@ -0,0 +1,194 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "srslte/common/security_snow3g.h"
+#include "srslte/common/snow_3g.h"
+
+using namespace srslte;
+
+/* Checks the SNOW 3G context against the reference implementation in
+ * snow_3g.cc: the keystream, and f8 and f9 on random messages of any bit
+ * length. The reference results are computed first, then several threads
+ * run the context on the same inputs at once and must reproduce them. */
+
+#define MAX_LEN     700
+#define NOF_CASES   200
+
+uint32_t nof_threads = 4;
+uint32_t nof_loops   = 20;
+
+typedef struct {
+  uint8_t  key[16];
+  uint32_t count;
+  uint32_t bearer;
+  uint32_t dir;
+  uint32_t length;  // Bits
+  uint8_t  msg[MAX_LEN];
+  uint8_t  ct[MAX_LEN];
+  uint8_t  mac[4];
+}test_case_t;
+
+test_case_t cases[NOF_CASES];
+
+void usage(char *prog) {
+  printf("Usage: %s [tn]\n", prog);
+  printf("\t-t number of threads [Default %d]\n", nof_threads);
+  printf("\t-n passes over the test cases per thread [Default %d]\n", nof_loops);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "tn")) != -1) {
+    switch(opt) {
+    case 't':
+      nof_threads = atoi(argv[optind]);
+      break;
+    case 'n':
+      nof_loops = atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+bool test_keystream() {
+  uint8_t  key[16];
+  u32      k[4], iv[4];
+  uint32_t z_ref[100], z[100];
+  security_snow3g_t q;
+
+  for (int i = 0; i < 16; i++) {
+    key[i] = rand();
+  }
+  for (int i = 0; i < 4; i++) {
+    k[3-i] = (key[4*i] << 24) | (key[4*i+1] << 16) | (key[4*i+2] << 8) | key[4*i+3];
+    iv[i]  = rand();
+  }
+  snow3g_initialize(k, iv);
+  snow3g_generate_keystream(100, z_ref);
+
+  // Read in pieces that do not align with the groups of 16 clocks
+  security_snow3g_init(&q, key, iv);
+  uint32_t n = 0;
+  for (uint32_t len = 1; n < 100; len += 3) {
+    len = (n + len > 100) ? 100 - n : len;
+    security_snow3g_keystream(&q, &z[n], len);
+    n += len;
+  }
+  if (memcmp(z, z_ref, sizeof(z))) {
+    printf("Keystream mismatch\n");
+    return false;
+  }
+  return true;
+}
+
+// Runs every test case once, returns the number of mismatches
+uint32_t run_cases() {
+  uint32_t nof_errors = 0;
+  uint8_t  out[MAX_LEN];
+  uint8_t  mac[4];
+  for (uint32_t i = 0; i < NOF_CASES; i++) {
+    test_case_t *c = &cases[i];
+    security_snow3g_f8(c->key, c->count, c->bearer, c->dir, c->msg, c->length, out);
+    if (memcmp(out, c->ct, (c->length + 7) / 8)) {
+      nof_errors++;
+    }
+    security_snow3g_f9(c->key, c->count, c->bearer << 27, c->dir, c->msg, c->length, mac);
+    if (memcmp(mac, c->mac, 4)) {
+      nof_errors++;
+    }
+  }
+  return nof_errors;
+}
+
+void* thread_loop(void *arg) {
+  uint32_t *nof_errors = (uint32_t*) arg;
+  for (uint32_t l = 0; l < nof_loops; l++) {
+    *nof_errors += run_cases();
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  srand(0);
+
+  bool ok = test_keystream();
+
+  // Reference results
+  for (uint32_t i = 0; i < NOF_CASES; i++) {
+    test_case_t *c = &cases[i];
+    for (int j = 0; j < 16; j++) {
+      c->key[j] = rand();
+    }
+    c->count  = rand();
+    c->bearer = rand() % 32;
+    c->dir    = rand() % 2;
+    c->length = (i < 130) ? i + 1 : 1 + rand() % (8*MAX_LEN - 1);
+    for (int j = 0; j < MAX_LEN; j++) {
+      c->msg[j] = rand();
+    }
+    memcpy(c->ct, c->msg, MAX_LEN);
+    snow3g_f8(c->key, c->count, c->bearer, c->dir, c->ct, c->length);
+    memcpy(c->mac, snow3g_f9(c->key, c->count, c->bearer << 27, c->dir, c->msg, c->length), 4);
+  }
+
+  if (run_cases()) {
+    printf("Mismatch with the reference implementation\n");
+    ok = false;
+  }
+
+  pthread_t *threads    = new pthread_t[nof_threads];
+  uint32_t  *nof_errors = new uint32_t[nof_threads];
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    nof_errors[i] = 0;
+    pthread_create(&threads[i], NULL, thread_loop, &nof_errors[i]);
+  }
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    pthread_join(threads[i], NULL);
+    if (nof_errors[i]) {
+      printf("Thread %d: %d mismatches\n", i, nof_errors[i]);
+      ok = false;
+    }
+  }
+  delete [] threads;
+  delete [] nof_errors;
+
+  if (ok) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(-1);
+  }
+}
@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#undef NDEBUG
 #include <assert.h>
 
 #include "srslte/common/liblte_security.h"
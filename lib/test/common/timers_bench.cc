@@ -0,0 +1,122 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTICKS 2000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+#include "srslte/common/timers.h"
+
+using namespace srslte;
+
+/* Compares the per-tick cost of the timing wheel of srslte::timers with
+ * incrementing every timer, as done by the previous implementation of
+ * step_all(). All timers are running with timeouts between 5 and 500 ticks
+ * and are restarted when they expire, as the RLC and PDCP timers do.
+ */
+class restart_cb : public timer_callback
+{
+public:
+  restart_cb() : wheel(NULL), ref(NULL), nof_expired(0) {}
+  void timer_expired(uint32_t timer_id) {
+    nof_expired++;
+    if (wheel) {
+      wheel->get(timer_id)->reset();
+      wheel->get(timer_id)->run();
+    } else {
+      (*ref)[timer_id].reset();
+      (*ref)[timer_id].run();
+    }
+  }
+  srslte::timers                      *wheel;
+  std::vector<srslte::timers::timer>  *ref;
+  uint64_t                             nof_expired;
+};
+
+static double elapsed_us(struct timeval *t) {
+  return (t[1].tv_sec - t[0].tv_sec)*1e6 + (t[1].tv_usec - t[0].tv_usec);
+}
+
+int main(int argc, char **argv) {
+  uint32_t nof_timers[] = {10000, 30000, 100000};
+  struct timeval t[2];
+
+  printf("%8s %14s %16s %16s %13s\n", "timers", "alloc (ns/id)", "wheel (us/tick)", "linear (us/tick)", "expired/tick");
+  for (uint32_t n=0;n<sizeof(nof_timers)/sizeof(uint32_t);n++) {
+    uint32_t N = nof_timers[n];
+
+    srslte::timers wheel(N);
+    std::vector<srslte::timers::timer> ref(N);
+    restart_cb wheel_cb, ref_cb;
+    wheel_cb.wheel = &wheel;
+    ref_cb.ref     = &ref;
+
+    gettimeofday(&t[0], NULL);
+    for (uint32_t i=0;i<N;i++) {
+      wheel.get_unique_id();
+    }
+    gettimeofday(&t[1], NULL);
+    double alloc_ns = elapsed_us(t)*1000/N;
+
+    srand(0);
+    for (uint32_t i=0;i<N;i++) {
+      uint32_t timeout = 5 + rand() % 496;
+      wheel.get(i)->set(&wheel_cb, timeout);
+      wheel.get(i)->run();
+      ref[i].id = i;
+      ref[i].set(&ref_cb, timeout);
+      ref[i].run();
+    }
+
+    gettimeofday(&t[0], NULL);
+    for (uint32_t tti=0;tti<NTICKS;tti++) {
+      wheel.step_all();
+    }
+    gettimeofday(&t[1], NULL);
+    double wheel_us = elapsed_us(t)/NTICKS;
+
+    gettimeofday(&t[0], NULL);
+    for (uint32_t tti=0;tti<NTICKS;tti++) {
+      for (uint32_t i=0;i<N;i++) {
+        ref[i].step();
+      }
+    }
+    gettimeofday(&t[1], NULL);
+    double ref_us = elapsed_us(t)/NTICKS;
+
+    if (wheel_cb.nof_expired != ref_cb.nof_expired) {
+      printf("Error: %ld timers expired in the wheel, %ld expected\n",
+             (long) wheel_cb.nof_expired, (long) ref_cb.nof_expired);
+      exit(-1);
+    }
+
+    printf("%8d %14.1f %16.2f %16.2f %13.1f\n", N, alloc_ns, wheel_us, ref_us,
+           (float) wheel_cb.nof_expired/NTICKS);
+  }
+  exit(0);
+}
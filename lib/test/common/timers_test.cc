@@ -0,0 +1,182 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#define NTIMERS  128
+#define NTICKS   1200000
+#define NQUIET   16
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include "srslte/common/timers.h"
+
+using namespace srslte;
+
+/* Checks the timing wheel of srslte::timers against stand-alone timers, which
+ * are incremented one by one, under a random sequence of operations.
+ */
+class counter : public timer_callback
+{
+public:
+  counter(srslte::timers *wheel_, srslte::timers::timer *ref_) : wheel(wheel_), ref(ref_) {
+    bzero(nof_expired, sizeof(nof_expired));
+  }
+  void timer_expired(uint32_t timer_id) {
+    nof_expired[timer_id]++;
+    // Restart some timers from within the callback
+    if (timer_id % 8 == 0) {
+      if (wheel) {
+        wheel->get(timer_id)->reset();
+        wheel->get(timer_id)->run();
+      } else {
+        ref[timer_id].reset();
+        ref[timer_id].run();
+      }
+    }
+  }
+  uint32_t nof_expired[NTIMERS];
+private:
+  srslte::timers        *wheel;
+  srslte::timers::timer *ref;
+};
+
+uint32_t random_timeout() {
+  uint32_t r = rand() % 100;
+  if (r < 70) {
+    return rand() % 300;
+  } else if (r < 95) {
+    return 300 + rand() % 20000;
+  } else {
+    return 20000 + rand() % 2000000;
+  }
+}
+
+int main(int argc, char **argv) {
+  bool result = true;
+
+  srslte::timers        wheel(NTIMERS);
+  srslte::timers::timer ref[NTIMERS];
+
+  counter wheel_cb(&wheel, NULL);
+  counter ref_cb(NULL, ref);
+
+  srand(1234);
+
+  // Ids are handed out lowest first and released ids are reused
+  for (uint32_t i=0;i<NTIMERS;i++) {
+    if (wheel.get_unique_id() != i) {
+      result = false;
+    }
+    ref[i].id = i;
+  }
+  wheel.release_id(5);
+  if (wheel.get_unique_id() != 5) {
+    result = false;
+  }
+  wheel.release_id(3);
+  wheel.release_id(7);
+  if (wheel.get_unique_id() != 3 || wheel.get_unique_id() != 7) {
+    result = false;
+  }
+  wheel.release_id(NTIMERS-1);
+  wheel.release_id(100);
+  wheel.release_id(65);
+  if (wheel.get_unique_id() != 65 || wheel.get_unique_id() != 100 || wheel.get_unique_id() != NTIMERS-1) {
+    result = false;
+  }
+
+  // The first timers are rarely touched so that long timeouts go through every level of the wheel
+  for (uint32_t i=0;i<NQUIET;i++) {
+    uint32_t timeout = 1000000 + i*10000;
+    wheel.get(i)->set(&wheel_cb, timeout);
+    wheel.get(i)->run();
+    ref[i].set(&ref_cb, timeout);
+    ref[i].run();
+  }
+
+  for (uint32_t tti=0;tti<NTICKS && result;tti++) {
+    for (uint32_t k=0;k<4;k++) {
+      uint32_t i = rand() % NTIMERS;
+      if (i < NQUIET && rand() % 65536) {
+        continue;
+      }
+      switch(rand() % 8) {
+        case 0:
+        case 1: {
+          uint32_t timeout = random_timeout();
+          wheel.get(i)->set(&wheel_cb, timeout);
+          ref[i].set(&ref_cb, timeout);
+          break;
+        }
+        case 2:
+        case 3:
+        case 4:
+          wheel.get(i)->run();
+          ref[i].run();
+          break;
+        case 5:
+          wheel.get(i)->stop();
+          ref[i].stop();
+          break;
+        case 6:
+          wheel.get(i)->reset();
+          ref[i].reset();
+          break;
+        default:
+          break;
+      }
+    }
+
+    wheel.step_all();
+    for (uint32_t i=0;i<NTIMERS;i++) {
+      ref[i].step();
+    }
+
+    // Mismatches persist, checking every few ticks is enough
+    for (uint32_t i=0;i<NTIMERS && tti%8 == 0;i++) {
+      srslte::timers::timer *t = wheel.get(i);
+      if (t->value()        != ref[i].value()      ||
+          t->is_running()   != ref[i].is_running() ||
+          t->is_expired()   != ref[i].is_expired() ||
+          wheel_cb.nof_expired[i] != ref_cb.nof_expired[i])
+      {
+        printf("Timer %d mismatch at tick %d: value=%d/%d, running=%d/%d, expired=%d/%d, nof_expired=%d/%d\n",
+               i, tti, t->value(), ref[i].value(), t->is_running(), ref[i].is_running(),
+               t->is_expired(), ref[i].is_expired(), wheel_cb.nof_expired[i], ref_cb.nof_expired[i]);
+        result = false;
+        break;
+      }
+    }
+  }
+
+  if (result) {
+    printf("Ok\n");
+    exit(0);
+  } else {
+    printf("Failed\n");
+    exit(-1);
+  }
+}
@@ -0,0 +1,328 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2015 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of the srsUE library.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "srslte/common/log_filter.h"
+#include "srslte/common/pdu.h"
+#include "srslte/common/timers.h"
+#include "srslte/upper/pdcp_entity.h"
+#include "srslte/upper/rlc_am.h"
+#include "srslte/upper/rlc_um.h"
+
+using namespace srsue;
+using namespace srslte;
+
+/* Pushes PDCP SDUs through PDCP (EEA2 ciphering), RLC and the MAC multiplexer
+ * at the peak TBS of a single codeword, and back through a peer MAC, RLC and
+ * PDCP. RLC status PDUs of the peer are fed back every TTI. Reports the
+ * time per TTI and the throughput of the whole path.
+ */
+
+#define LCID 3
+
+uint32_t nof_tti  = 20000;
+uint32_t tbs      = 9422;   // 100 PRB, MCS 28, 1 layer
+uint32_t sdu_size = 1400;
+bool     use_um   = false;
+bool     cipher   = true;
+
+void usage(char *prog) {
+  printf("Usage: %s [ntsue]\n", prog);
+  printf("\t-n number of TTIs [Default %d]\n", nof_tti);
+  printf("\t-t TBS in bytes [Default %d]\n", tbs);
+  printf("\t-s SDU size in bytes [Default %d]\n", sdu_size);
+  printf("\t-u use RLC UM instead of AM, without ciphering [Default %s]\n", use_um?"UM":"AM");
+  printf("\t-e disable ciphering [Default %s]\n", cipher?"EEA2":"EEA0");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "ntsue")) != -1) {
+    switch(opt) {
+    case 'n':
+      nof_tti = atoi(argv[optind]);
+      break;
+    case 't':
+      tbs = atoi(argv[optind]);
+      break;
+    case 's':
+      sdu_size = atoi(argv[optind]);
+      break;
+    case 'u':
+      use_um = true;
+      // PDCP counts received SDUs to get the RX COUNT and UM may lose some
+      cipher = false;
+      break;
+    case 'e':
+      cipher = false;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+class mac_timers
+    :public srslte::mac_interface_timers
+{
+public:
+  mac_timers() : t(64) {}
+  srslte::timers::timer* timer_get(uint32_t timer_id)
+  {
+    return t.get(timer_id);
+  }
+  uint32_t timer_get_unique_id()
+  {
+    return t.get_unique_id();
+  }
+  void timer_release_id(uint32_t timer_id)
+  {
+    t.release_id(timer_id);
+  }
+  void step()
+  {
+    t.step_all();
+  }
+private:
+  srslte::timers t;
+};
+
+// Connects a PDCP entity and an RLC entity, and RLC to the MAC
+class bearer
+    :public rlc_interface_pdcp
+    ,public pdcp_interface_rlc
+    ,public rrc_interface_rlc
+    ,public read_pdu_interface
+{
+public:
+  bearer() : rlc(NULL), rlc_log(NULL) {}
+
+  // PDCP interface for RLC
+  void write_sdu(uint32_t lcid, byte_buffer_t *sdu)
+  {
+    rlc->write_sdu(sdu);
+  }
+  bool rb_is_um(uint32_t lcid)
+  {
+    return use_um;
+  }
+
+  // RLC interface for PDCP
+  void write_pdu(uint32_t lcid, byte_buffer_t *pdu)
+  {
+    pdcp.write_pdu(pdu);
+  }
+  void write_pdu_bcch_bch(byte_buffer_t *sdu) {}
+  void write_pdu_bcch_dlsch(byte_buffer_t *sdu) {}
+  void write_pdu_pcch(byte_buffer_t *sdu) {}
+
+  // RRC interface for RLC
+  void max_retx_attempted() {}
+  std::string get_rb_name(uint32_t lcid) { return std::string("DRB1"); }
+
+  // RLC interface for MAC
+  int read_pdu(uint32_t lcid, uint8_t *payload, uint32_t nof_bytes)
+  {
+    return rlc->read_pdu(payload, nof_bytes);
+  }
+
+  pdcp_entity  pdcp;
+  rlc_common  *rlc;
+  srslte::log *rlc_log;
+  mac_timers   timers;
+};
+
+// Receives the PDCP SDUs on the peer side
+class gw_dummy
+    :public gw_interface_pdcp
+    ,public rrc_interface_pdcp
+{
+public:
+  gw_dummy() : nof_sdus(0), nof_bytes(0), nof_errors(0) {}
+  void write_pdu(uint32_t lcid, byte_buffer_t *pdu)
+  {
+    // UM may lose the first SDUs, so only check each SDU is intact
+    if (pdu->N_bytes != sdu_size || pdu->msg[0] != pdu->msg[sdu_size-1]) {
+      nof_errors++;
+    }
+    nof_sdus++;
+    nof_bytes += pdu->N_bytes;
+    byte_buffer_pool::get_instance()->deallocate(pdu);
+  }
+  void write_pdu_bcch_bch(byte_buffer_t *pdu) {}
+  void write_pdu_bcch_dlsch(byte_buffer_t *pdu) {}
+  void write_pdu_pcch(byte_buffer_t *pdu) {}
+  std::string get_rb_name(uint32_t lcid) { return std::string("DRB1"); }
+
+  uint32_t nof_sdus;
+  uint64_t nof_bytes;
+  uint32_t nof_errors;
+};
+
+// Demultiplexes a MAC PDU into the RLC entity of the receiving side
+void mac_rx(sch_pdu *mac_pdu, uint8_t *payload, uint32_t len, rlc_common *rlc)
+{
+  mac_pdu->init_rx(len);
+  mac_pdu->parse_packet(payload);
+  while (mac_pdu->next()) {
+    if (mac_pdu->get()->is_sdu() && mac_pdu->get()->get_sdu_lcid() == LCID) {
+      rlc->write_pdu(mac_pdu->get()->get_sdu_ptr(), mac_pdu->get()->get_payload_size());
+    }
+  }
+}
+
+// Multiplexes one RLC PDU of up to len bytes into a MAC PDU. Returns its start
+uint8_t* mac_tx(sch_pdu *mac_pdu, uint8_t *payload, uint32_t len, bearer *b)
+{
+  mac_pdu->init_tx(payload, len);
+  uint32_t buffer_state = b->rlc->get_buffer_state();
+  if (buffer_state > 0 && mac_pdu->new_subh()) {
+    uint32_t sdu_len = SRSLTE_MIN(buffer_state, (uint32_t) mac_pdu->get_sdu_space());
+    if (mac_pdu->get()->set_sdu(LCID, sdu_len, b) <= 0) {
+      mac_pdu->del_subh();
+    }
+  }
+  return mac_pdu->write_packet(b->rlc_log);
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  srslte::log_filter log_tx("TX");
+  srslte::log_filter log_rx("RX");
+  log_tx.set_level(srslte::LOG_LEVEL_NONE);
+  log_rx.set_level(srslte::LOG_LEVEL_NONE);
+
+  byte_buffer_pool *pool = byte_buffer_pool::get_instance();
+  bearer   tx, rx;
+  gw_dummy gw;
+
+  rlc_am am_tx, am_rx;
+  rlc_um um_tx, um_rx;
+  tx.rlc = use_um ? (rlc_common*) &um_tx : (rlc_common*) &am_tx;
+  rx.rlc = use_um ? (rlc_common*) &um_rx : (rlc_common*) &am_rx;
+  tx.rlc_log = &log_tx;
+  rx.rlc_log = &log_rx;
+  tx.rlc->init(&log_tx, LCID, &tx, &tx, &tx.timers);
+  rx.rlc->init(&log_rx, LCID, &rx, &rx, &rx.timers);
+
+  LIBLTE_RRC_RLC_CONFIG_STRUCT cnfg;
+  bzero(&cnfg, sizeof(LIBLTE_RRC_RLC_CONFIG_STRUCT));
+  if (use_um) {
+    cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_UM_BI;
+    cnfg.dl_um_bi_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS5;
+    cnfg.dl_um_bi_rlc.sn_field_len = LIBLTE_RRC_SN_FIELD_LENGTH_SIZE10;
+    cnfg.ul_um_bi_rlc.sn_field_len = LIBLTE_RRC_SN_FIELD_LENGTH_SIZE10;
+  } else {
+    cnfg.rlc_mode = LIBLTE_RRC_RLC_MODE_AM;
+    cnfg.dl_am_rlc.t_reordering = LIBLTE_RRC_T_REORDERING_MS35;
+    cnfg.dl_am_rlc.t_status_prohibit = LIBLTE_RRC_T_STATUS_PROHIBIT_MS0;
+    cnfg.ul_am_rlc.max_retx_thresh = LIBLTE_RRC_MAX_RETX_THRESHOLD_T32;
+    cnfg.ul_am_rlc.poll_byte = LIBLTE_RRC_POLL_BYTE_KB25;
+    cnfg.ul_am_rlc.poll_pdu = LIBLTE_RRC_POLL_PDU_P4;
+    cnfg.ul_am_rlc.t_poll_retx = LIBLTE_RRC_T_POLL_RETRANSMIT_MS45;
+  }
+  tx.rlc->configure(&cnfg);
+  rx.rlc->configure(&cnfg);
+
+  tx.pdcp.init(&tx, &gw, &gw, &log_tx, LCID, srslte_pdcp_config_t(false, true, SECURITY_DIRECTION_DOWNLINK));
+  rx.pdcp.init(&rx, &gw, &gw, &log_rx, LCID, srslte_pdcp_config_t(false, true, SECURITY_DIRECTION_UPLINK));
+  if (cipher) {
+    uint8_t k_enc[32], k_int[32];
+    for (int i=0;i<32;i++) {
+      k_enc[i] = i;
+      k_int[i] = 32-i;
+    }
+    tx.pdcp.config_security(k_enc, k_int, CIPHERING_ALGORITHM_ID_128_EEA2, INTEGRITY_ALGORITHM_ID_128_EIA2);
+    rx.pdcp.config_security(k_enc, k_int, CIPHERING_ALGORITHM_ID_128_EEA2, INTEGRITY_ALGORITHM_ID_128_EIA2);
+    tx.pdcp.enable_encryption();
+    rx.pdcp.enable_encryption();
+  }
+
+  sch_pdu mac_dl(16), mac_ul(16);
+  uint8_t *dl_payload = (uint8_t*) malloc(tbs + SRSLTE_BUFFER_HEADER_OFFSET);
+  uint8_t *ul_payload = (uint8_t*) malloc(tbs + SRSLTE_BUFFER_HEADER_OFFSET);
+  if (!dl_payload || !ul_payload) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  uint32_t nof_sdus_tx = 0;
+  struct timeval t[3];
+  gettimeofday(&t[1], NULL);
+  for (uint32_t tti=0;tti<nof_tti;tti++) {
+    // Keep about one TB worth of SDUs queued. The RLC SDU queue holds 16 SDUs
+    // and blocks when full.
+    for (uint32_t i=0;i<16 && tx.rlc->get_buffer_state() < tbs;i++) {
+      byte_buffer_t *sdu = pool->allocate("pdcp_rlc_mac_bench");
+      if (!sdu) {
+        break;
+      }
+      memset(sdu->msg, (uint8_t) nof_sdus_tx, sdu_size);
+      sdu->N_bytes = sdu_size;
+      tx.pdcp.write_sdu(sdu);
+      nof_sdus_tx++;
+    }
+
+    // DL data
+    uint8_t *ptr = mac_tx(&mac_dl, dl_payload, tbs, &tx);
+    mac_rx(&mac_dl, ptr, tbs, rx.rlc);
+
+    // UL status reports
+    if (!use_um) {
+      ptr = mac_tx(&mac_ul, ul_payload, 512, &rx);
+      mac_rx(&mac_ul, ptr, 512, tx.rlc);
+    }
+    tx.timers.step();
+    rx.timers.step();
+
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_us = t[0].tv_sec*1e6 + t[0].tv_usec;
+  printf("RLC %s, TBS=%d, SDU=%d bytes, %s, %d TTIs\n",
+         use_um?"UM":"AM", tbs, sdu_size, cipher?"EEA2":"EEA0", nof_tti);
+  printf("SDUs tx=%d rx=%d, errors=%d\n", nof_sdus_tx, gw.nof_sdus, gw.nof_errors);
+  printf("%.1f us/TTI, %.1f Mbps goodput (%.1f Mbps air)\n",
+         elapsed_us/nof_tti, gw.nof_bytes*8/elapsed_us, (float) nof_tti*tbs*8/elapsed_us);
+
+  tx.rlc->stop();
+  rx.rlc->stop();
+  free(dl_payload);
+  free(ul_payload);
+
+  if (gw.nof_errors || gw.nof_sdus == 0) {
+    printf("Failed\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
@@ -51,6 +51,7 @@
 #include "srslte/common/buffer_pool.h"
 #include "srslte/interfaces/ue_interfaces.h"
 #include "srslte/common/logger_file.h"
+#include "srslte/common/logger_binary.h"
 #include "srslte/common/log_filter.h"
 #include "srslte/common/mac_pcap.h"
 #include "srslte/interfaces/sched_interface.h"
@@ -115,6 +116,7 @@ typedef struct {
   int           all_hex_limit;
   int           file_max_size;
   std::string   filename;
+  std::string   mode;
 }log_args_t;
 
 typedef struct {
@@ -126,6 +128,8 @@ typedef struct {
   mac_args_t mac; 
   uint32_t   rrc_inactivity_timer;
   float      metrics_period_secs;
+  std::string fftw_wisdom_file;
+  std::string simd;
 }expert_args_t;
 
 typedef struct { 
@@ -185,6 +189,7 @@ private:
 
   srslte::logger_stdout logger_stdout;
   srslte::logger_file   logger_file;
+  srslte::logger_binary logger_binary;
   srslte::logger        *logger;
 
   srslte::log_filter  rf_log;
@@ -51,6 +51,8 @@ public:
 
 typedef struct {
   sched_interface::sched_args_t sched; 
+  sched_metric_t sched_metric; 
+  uint32_t pf_window_ms; 
   int link_failure_nof_err; 
 } mac_args_t; 
 
@@ -141,6 +143,8 @@ private:
   sched            scheduler; 
   dl_metric_rr     sched_metric_dl_rr;
   ul_metric_rr     sched_metric_ul_rr;
+  dl_metric_pf     sched_metric_dl_pf;
+  ul_metric_pf     sched_metric_ul_pf;
 
   /* Map of active UEs */
   std::map<uint16_t, ue*> ue_db;   
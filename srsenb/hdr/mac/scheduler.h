@@ -32,7 +32,9 @@
 #include "srslte/interfaces/enb_interfaces.h"
 #include "srslte/interfaces/sched_interface.h"
 #include "scheduler_ue.h"
+#include "scheduler_ue_db.h"
 #include "scheduler_harq.h"
+#include "scheduler_pdcch.h"
 #include <pthread.h>
 
 namespace srsenb {
@@ -56,7 +58,7 @@ public:
   public: 
 
     /* Virtual methods for user metric calculation */
-    virtual void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti) = 0;
+    virtual void            new_tti(sched_ue_db &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti) = 0;
     virtual dl_harq_proc*   get_user_allocation(sched_ue *user) = 0;
   };
 
@@ -66,7 +68,7 @@ public:
   public: 
 
     /* Virtual methods for user metric calculation */
-    virtual void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti) = 0;
+    virtual void           new_tti(sched_ue_db &ue_db, uint32_t nof_rb, uint32_t tti) = 0;
     virtual ul_harq_proc*  get_user_allocation(sched_ue *user) = 0; 
     virtual void           update_allocation(ul_harq_proc::ul_alloc_t alloc) = 0;
   };
@@ -126,6 +128,12 @@ public:
   void tpc_inc(uint16_t rnti); 
   void tpc_dec(uint16_t rnti);
 
+  /* PDCCH allocation statistics. Backtracking moves earlier DCIs of the TTI 
+   * when a new one does not fit, it is enabled by default. 
+   */
+  void get_pdcch_metrics(sched_pdcch::metrics_t *m); 
+  void set_pdcch_backtracking(bool enable); 
+
 
   
   static uint32_t get_rvidx(uint32_t retx_idx) {
@@ -150,11 +158,10 @@ private:
 
   const static int MAX_PRB = 100; 
   const static int MAX_RBG = 25; 
-  const static int MAX_CCE = 128; 
 
   // This is for computing DCI locations
   srslte_regs_t regs; 
-  bool used_cce[MAX_CCE]; 
+  sched_pdcch pdcch; 
     
   typedef struct {
     int buf_rar; 
@@ -176,10 +183,11 @@ private:
     
   
   int  generate_format1a(uint32_t rb_start, uint32_t l_crb, uint32_t tbs, uint32_t rv, srslte_ra_dl_dci_t *dci);
-  bool generate_dci(srslte_dci_location_t *sched_location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, sched_ue *user = NULL); 
+  bool generate_dci(srslte_dci_location_t *sched_location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, 
+                    sched_ue *user = NULL, dl_harq_proc *h = NULL); 
  
 
-  std::map<uint16_t, sched_ue>   ue_db;
+  sched_ue_db ue_db;
 
   sched_sib_t pending_sibs[MAX_SIBS];
   
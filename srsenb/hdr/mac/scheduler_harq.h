@@ -83,6 +83,7 @@ public:
   bool     has_pending_retx(uint32_t tb_idx, uint32_t tti);
   int      get_tbs(uint32_t tb_idx);
   uint32_t get_n_cce();
+  void     set_n_cce(uint32_t n_cce);
 private:
   uint32_t rbgmask;     
   uint32_t nof_rbg; 
@@ -27,6 +27,7 @@
 #ifndef SRSENB_SCHEDULER_METRIC_H
 #define SRSENB_SCHEDULER_METRIC_H
 
+#include <vector>
 #include "scheduler.h"
 
 namespace srsenb {
@@ -34,12 +35,13 @@ namespace srsenb {
 class dl_metric_rr : public sched::metric_dl
 {
 public:
-  void            new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti);
+  void            new_tti(sched_ue_db &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti);
   dl_harq_proc*   get_user_allocation(sched_ue *user); 
-private:
+protected:
   
   const static int MAX_RBG = 25; 
   
+  dl_harq_proc* allocate_user(sched_ue *user);
   bool new_allocation(uint32_t nof_rbg, uint32_t* rbgmask); 
   void update_allocation(uint32_t new_mask); 
   bool allocation_is_valid(uint32_t mask); 
@@ -63,13 +65,14 @@ private:
 class ul_metric_rr : public sched::metric_ul
 {
 public:
-  void           new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb, uint32_t tti);
+  void           new_tti(sched_ue_db &ue_db, uint32_t nof_rb, uint32_t tti);
   ul_harq_proc*  get_user_allocation(sched_ue *user); 
   void           update_allocation(ul_harq_proc::ul_alloc_t alloc);
-private:
+protected:
   
   const static int MAX_PRB = 100; 
   
+  ul_harq_proc* allocate_user(sched_ue *user);
   bool new_allocation(uint32_t L, ul_harq_proc::ul_alloc_t *alloc);
   bool allocation_is_valid(ul_harq_proc::ul_alloc_t alloc); 
 
@@ -81,6 +84,77 @@ private:
   uint32_t available_rb;
 };
 
+/* Frequency-domain schedulers that serve several users per TTI, in descending 
+ * order of priority. With METRIC_PF the priority is the expected rate divided by the 
+ * user's average served rate (exponential average over fairness_window TTIs). 
+ * With METRIC_MT it is the expected rate only (max C/I). 
+ * Pending retransmissions are always served first. 
+ */
+typedef enum {
+  METRIC_RR = 0, 
+  METRIC_PF, 
+  METRIC_MT, 
+} sched_metric_t; 
+
+class dl_metric_pf : public dl_metric_rr
+{
+public:
+  dl_metric_pf(); 
+  void            set_params(sched_metric_t type, uint32_t fairness_window); 
+  void            new_tti(sched_ue_db &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols, uint32_t tti);
+  dl_harq_proc*   get_user_allocation(sched_ue *user); 
+private:
+  
+  typedef struct {
+    bool      is_retx; 
+    float     priority; 
+    sched_ue *user; 
+  } candidate_t; 
+  
+  // Each allocated user needs a PDCCH and a data element in the result 
+  const static uint32_t MAX_UE_TTI = sched_interface::MAX_DATA_LIST; 
+  
+  static bool     candidate_cmp(const candidate_t &a, const candidate_t &b); 
+  void            plan_allocations(); 
+  
+  sched_ue_db *ue_db; 
+  std::vector<candidate_t>     candidates; 
+  std::vector<std::pair<sched_ue*, dl_harq_proc*> > allocations; 
+  
+  sched_metric_t type; 
+  float          alpha; 
+  bool           planned; 
+};
+
+class ul_metric_pf : public ul_metric_rr
+{
+public:
+  ul_metric_pf(); 
+  void           set_params(sched_metric_t type, uint32_t fairness_window); 
+  void           new_tti(sched_ue_db &ue_db, uint32_t nof_rb, uint32_t tti);
+  ul_harq_proc*  get_user_allocation(sched_ue *user); 
+private:
+  
+  typedef struct {
+    bool      is_retx; 
+    float     priority; 
+    sched_ue *user; 
+  } candidate_t; 
+  
+  // Each allocated user gets a PHICH in HARQ_DELAY_MS, leave room for Msg3 
+  const static uint32_t MAX_UE_TTI = sched_interface::MAX_PHICH_LIST-1; 
+  
+  static bool     candidate_cmp(const candidate_t &a, const candidate_t &b); 
+  void            plan_allocations(); 
+  
+  sched_ue_db *ue_db; 
+  std::vector<candidate_t>     candidates; 
+  std::vector<std::pair<sched_ue*, ul_harq_proc*> > allocations; 
+  
+  sched_metric_t type; 
+  float          alpha; 
+  bool           planned; 
+};
   
 }
 
@@ -0,0 +1,108 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSENB_SCHEDULER_PDCCH_H
+#define SRSENB_SCHEDULER_PDCCH_H
+
+#include <stdint.h>
+#include "srslte/interfaces/sched_interface.h"
+#include "scheduler_ue.h"
+
+namespace srsenb {
+
+/* PDCCH CCE allocation for one TTI. 
+ * 
+ * Each DCI takes one of the candidates of its search space, and the CCEs in 
+ * use are kept in an occupancy bitmap. When a new DCI does not fit, the DCIs 
+ * allocated before it in the same TTI are moved to other candidates of their 
+ * search spaces with a backtracking search bounded to MAX_NODES candidate 
+ * tests. The new location of a moved DCI is written back to the scheduling 
+ * result and to the DL HARQ process, which uses it for the PUCCH resource. 
+ * DCIs pinned with fix() are never moved. 
+ */
+class sched_pdcch
+{
+public: 
+  
+  const static uint32_t MAX_CCE   = 128; 
+  const static uint32_t MAX_ALLOC = 2*sched_interface::MAX_BC_LIST + 2*sched_interface::MAX_DATA_LIST; 
+  const static uint32_t MAX_NODES = 128; 
+  
+  typedef struct {
+    uint64_t nof_req;       // DCIs requested 
+    uint64_t nof_blocked;   // DCIs that found no free candidate 
+    uint64_t nof_moved;     // DCIs moved to make room for a later one 
+  } metrics_t; 
+  
+  sched_pdcch(); 
+  
+  void new_tti(uint32_t nof_cce); 
+  
+  // A user is given for DL DCIs, whose candidates must not collide with its PUCCH SR resource at this TTI 
+  bool alloc(srslte_dci_location_t *location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, 
+             uint32_t tti, sched_ue *user = NULL, dl_harq_proc *h = NULL); 
+  
+  // Releases the last allocation, after its grant could not be generated 
+  void rem_last(); 
+  
+  // Pins the allocations made so far, once their scheduling result has been handed out 
+  void fix(); 
+  
+  void set_backtracking(bool enable); 
+  void get_metrics(metrics_t *m); 
+  
+private: 
+  
+  typedef struct {
+    srslte_dci_location_t     *location; 
+    sched_ue::sched_dci_cce_t *locations; 
+    dl_harq_proc              *h; 
+    uint32_t                   L; 
+    uint32_t                   cand_mask;   // Candidates free of PUCCH SR collisions 
+    uint32_t                   cand; 
+  } alloc_t; 
+  
+  bool fits(uint64_t *used, alloc_t *a, uint32_t cand); 
+  void set(uint64_t *used, alloc_t *a, uint32_t cand, bool value); 
+  bool search(uint32_t idx, uint64_t *used, uint32_t *nof_nodes); 
+  void place(alloc_t *a, uint32_t cand); 
+  
+  bool      backtracking; 
+  uint64_t  used[MAX_CCE/64]; 
+  uint64_t  fixed_used[MAX_CCE/64]; 
+  alloc_t   allocs[MAX_ALLOC]; 
+  uint32_t  trial[MAX_ALLOC]; 
+  uint32_t  order[MAX_ALLOC]; 
+  uint32_t  nof_allocs; 
+  uint32_t  nof_fixed; 
+  uint32_t  nof_cce; 
+  uint32_t  nof_used_cce; 
+  metrics_t metrics; 
+};
+
+}
+
+#endif // SRSENB_SCHEDULER_PDCCH_H
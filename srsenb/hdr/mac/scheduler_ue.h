@@ -41,6 +41,8 @@ public:
   
   // used by sched_metric
   uint32_t ue_idx;
+  float    dl_avg_rate;
+  float    ul_avg_rate;
 
   bool has_pucch;
   
@@ -98,6 +100,9 @@ public:
   uint32_t   get_pending_dl_new_data(uint32_t tti);
   uint32_t   get_pending_ul_new_data(uint32_t tti);
 
+  float      get_dl_spectral_eff();
+  float      get_ul_spectral_eff();
+
   dl_harq_proc *get_pending_dl_harq(uint32_t tti);
   dl_harq_proc *get_empty_dl_harq();   
   ul_harq_proc *get_ul_harq(uint32_t tti);   
@@ -0,0 +1,84 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSENB_SCHEDULER_UE_DB_H
+#define SRSENB_SCHEDULER_UE_DB_H
+
+#include <vector>
+#include <stdint.h>
+#include "scheduler_ue.h"
+
+namespace srsenb {
+
+/* Flat table of scheduler UEs keyed by RNTI. 
+ * 
+ * sched_ue objects live in fixed blocks that are never reallocated, so a 
+ * sched_ue* stays valid until the RNTI is removed. Active users are kept in a 
+ * dense vector of (rnti, sched_ue*) pairs that is iterated contiguously every TTI, 
+ * and a direct RNTI-indexed array maps each RNTI to its position in that vector. 
+ * Lookup, insertion and removal are O(1). Iteration order is not sorted by RNTI. 
+ */
+class sched_ue_db
+{
+public: 
+  
+  typedef std::pair<uint16_t, sched_ue*>   entry_t; 
+  typedef std::vector<entry_t>::iterator   iterator; 
+  
+  sched_ue_db();
+  ~sched_ue_db();
+  
+  iterator  begin() { return active.begin(); }
+  iterator  end()   { return active.end(); }
+  uint32_t  size()  { return active.size(); }
+  
+  uint32_t  count(uint16_t rnti)  { return position[rnti] ? 1 : 0; }
+  sched_ue* find(uint16_t rnti)   { return position[rnti] ? active[position[rnti]-1].second : NULL; }
+  
+  // Returns the UE for this RNTI, adding a default-constructed one if not present 
+  sched_ue& operator[](uint16_t rnti); 
+  
+  void      erase(uint16_t rnti); 
+  void      clear(); 
+  
+private: 
+  
+  const static uint32_t NOF_RNTI        = 1<<16; 
+  const static uint32_t SLOTS_PER_BLOCK = 32; 
+  
+  // Not copyable: the entries point into blocks owned by this object 
+  sched_ue_db(const sched_ue_db&);
+  sched_ue_db& operator=(const sched_ue_db&);
+  
+  std::vector<entry_t>   active;     // dense list of active users 
+  std::vector<uint32_t>  position;   // RNTI -> index in active plus one, 0 if not present 
+  std::vector<sched_ue*> blocks;     // owned storage, never moved 
+  std::vector<sched_ue*> free_slots; 
+};
+
+}
+
+#endif // SRSENB_SCHEDULER_UE_DB_H
@@ -54,6 +54,7 @@ public:
 
 private:
   void        print_metrics();
+  void        print_pipeline();
   void        print_disconnect();
   std::string float_to_string(float f, int digits);
   std::string float_to_eng_string(float f, int digits);
@@ -35,6 +35,7 @@
 #include "srslte/common/threads.h"
 #include "srslte/common/thread_pool.h"
 #include "srslte/radio/radio.h"
+#include "srslte/common/phch_pipeline.h"
 
 namespace srsenb {
 
@@ -46,36 +47,44 @@ typedef struct {
   std::string equalizer_mode; 
   float estimator_fil_w;   
   bool       pregenerate_signals;
+  uint32_t   sequence_cache_mb; 
+  uint32_t   pipeline_budget_us; 
+  uint32_t   nof_fec_threads; 
 } phy_args_t; 
 
 class phch_common
 {
 public:
  
+  // Pipeline sections that must follow the TTI order
+  typedef enum {
+    SECTION_DL_SCHED = 0,
+    SECTION_TX,
+    NOF_SECTIONS
+  } section_t;
   
-  phch_common(uint32_t max_mutex_) : tx_mutex(max_mutex_) {
-    nof_mutex = 0;
-    max_mutex = max_mutex_; 
+  phch_common() {
     params.max_prach_offset_us = 20;
+    params.sequence_cache_mb = 0;
+    params.pipeline_budget_us = 0;
+    params.nof_fec_threads = 0;
     radio = NULL;
     mac = NULL;
-    is_first_tx = false;
-    is_first_of_burst = false;
     pdsch_p_b = 0;
     nof_workers = 0;
     bzero(&pusch_cfg, sizeof(pusch_cfg));
     bzero(&hopping_cfg, sizeof(hopping_cfg));
     bzero(&pucch_cfg, sizeof(pucch_cfg));
     bzero(&ul_grants, sizeof(ul_grants));
+    bzero(&seq_cache, sizeof(seq_cache));
+    bzero(&fec_pool, sizeof(fec_pool));
   }
   
   bool init(srslte_cell_t *cell, srslte::radio *radio_handler, mac_interface_phy *mac);  
   void reset(); 
   void stop();
   
-  void set_nof_mutex(uint32_t nof_mutex); 
-
-  void worker_end(uint32_t tx_mutex_cnt, cf_t *buffer[SRSLTE_MAX_PORTS], uint32_t nof_samples, srslte_timestamp_t tx_time);
+  void worker_end(uint32_t sf_seq, cf_t *buffer[SRSLTE_MAX_PORTS], uint32_t nof_samples, srslte_timestamp_t tx_time);
 
   // Common objects
   srslte_cell_t                     cell; 
@@ -84,6 +93,15 @@ public:
   srslte_pucch_cfg_t                pucch_cfg; 
   uint8_t                           pdsch_p_b;
   phy_args_t                        params; 
+  
+  // Scrambling sequences shared by all workers 
+  srslte_sequence_cache_t           seq_cache; 
+
+  // Threads decoding PUSCH code blocks in parallel for all workers 
+  srslte_fec_pool_t                 fec_pool; 
+
+  // Orders and times the subframe processing stages of all workers 
+  srslte::phch_pipeline             pipeline; 
 
   srslte::radio     *radio;
   mac_interface_phy *mac; 
@@ -121,13 +139,7 @@ public:
   int ue_db_get_last_ul_tbs(uint16_t rnti, uint32_t tti);
 
 private:
-  std::vector<pthread_mutex_t>    tx_mutex; 
-  bool            is_first_tx;
-  bool            is_first_of_burst; 
-
   uint32_t        nof_workers;
-  uint32_t        nof_mutex;
-  uint32_t        max_mutex;
   
 };
 
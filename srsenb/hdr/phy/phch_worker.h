@@ -46,7 +46,7 @@ public:
   void  reset();
   
   cf_t *get_buffer_rx(uint32_t antenna_idx);
-  void set_time(uint32_t tti, uint32_t tx_mutex_cnt, srslte_timestamp_t tx_time);
+  void set_time(uint32_t tti, uint32_t sf_seq, srslte_timestamp_t tx_time, struct timeval rx_end);
   
   int  add_rnti(uint16_t rnti);
   void rem_rnti(uint16_t rnti);
@@ -74,6 +74,7 @@ private:
   const static float PUCCH_RL_CORR_TH = 0.1; 
   
   void work_imp();
+  void stage_end(phy_stage_t stage);
   
   int encode_pdsch(srslte_enb_dl_pdsch_t *grants, uint32_t nof_grants);
   int decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch);
@@ -92,12 +93,13 @@ private:
   cf_t          *signal_buffer_rx[SRSLTE_MAX_PORTS];
   cf_t          *signal_buffer_tx[SRSLTE_MAX_PORTS];
   uint32_t       tti_rx, tti_tx_dl, tti_tx_ul;
-  uint32_t       sf_rx, sf_tx, tx_mutex_cnt;
+  uint32_t       sf_rx, sf_tx, sf_seq;
   uint32_t       t_rx, t_tx_dl, t_tx_ul;
   srslte_enb_dl_t enb_dl;
   srslte_enb_ul_t enb_ul;
   
   srslte_timestamp_t tx_time;
+  struct timeval     rx_end;
 
   // Class to store user information 
   class ue {
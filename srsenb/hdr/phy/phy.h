@@ -71,6 +71,7 @@ public:
   void set_config_dedicated(uint16_t rnti, LIBLTE_RRC_PHYSICAL_CONFIG_DEDICATED_STRUCT* dedicated);
   
   void get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  void get_pipeline_metrics(phy_pipeline_metrics_t *metrics);
   
 private:
     
@@ -27,6 +27,8 @@
 #ifndef SRSENB_PHY_METRICS_H
 #define SRSENB_PHY_METRICS_H
 
+#include <stdint.h>
+#include "srslte/common/phch_pipeline.h"
 
 namespace srsenb {
 
@@ -54,6 +56,23 @@ struct phy_metrics_t
   ul_metrics_t   ul;
 };
 
+// PHY pipeline metrics. Finish times are measured from the end of the subframe reception
+
+typedef enum {
+  PHY_STAGE_UL_FFT = 0,  // OFDM demodulation and channel estimation
+  PHY_STAGE_UL_DECODE,   // PUSCH and PUCCH decoding
+  PHY_STAGE_DL_ENCODE,   // DL scheduling, encoding and OFDM modulation
+  PHY_STAGE_TX,          // Subframe handed to the radio
+  PHY_NOF_STAGES
+} phy_stage_t;
+
+typedef srslte::pipeline_stage_metrics_t phy_stage_metrics_t;
+
+struct phy_pipeline_metrics_t
+{
+  phy_stage_metrics_t stage[PHY_NOF_STAGES];
+};
+
 } // namespace srsenb
 
 #endif // SRSENB_PHY_METRICS_H
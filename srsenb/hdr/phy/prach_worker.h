@@ -54,6 +54,7 @@ public:
   int  init(srslte_cell_t *cell, srslte_prach_cfg_t *prach_cfg, mac_interface_phy *mac, srslte::log *log_h, int priority);
   int  new_tti(uint32_t tti, cf_t *buffer);
   void set_max_prach_offset_us(float delay_us);
+  void set_fec_pool(srslte_fec_pool_t *pool);
   void stop();
   
 private:
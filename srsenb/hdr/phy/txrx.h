@@ -49,8 +49,6 @@ public:
             srslte::log *log_h, 
             uint32_t prio);
   void stop();
-    
-  const static int MUTEX_X_WORKER = 4; 
   
 private:
     
@@ -62,8 +60,8 @@ private:
   prach_worker         *prach; 
   phch_common          *worker_com;
     
-  uint32_t tx_mutex_cnt; 
-  uint32_t nof_tx_mutex; 
+  // Subframe sequence number in the processing pipeline
+  uint32_t sf_seq; 
   
   // Main system TTI counter   
   uint32_t tti; 
@@ -25,7 +25,8 @@
  */
 
 #include <string.h>
-#include <map>
+#include <sys/socket.h>
+#include <netinet/in.h>
 
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log.h"
@@ -70,7 +71,8 @@ class gtpu
     ,public thread
 {
 public: 
-  
+  gtpu();
+
   bool init(std::string gtp_bind_addr_, std::string mme_addr_, pdcp_interface_gtpu *pdcp_, srslte::log *gtpu_log_);
   void stop();
   
@@ -82,10 +84,13 @@ public:
   // gtpu_interface_pdcp
   void write_pdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *pdu); 
 
-  
+  // Sends the queued uplink PDUs now, called every TTI by tx_flusher
+  void flush();
+
 private:
   static const int THREAD_PRIO = 65;
   static const int GTPU_PORT   = 2152;
+  static const uint32_t BATCH_SIZE = 32;
   srslte::byte_buffer_pool     *pool;
   bool                         running;
   bool                         run_enable;
@@ -95,12 +100,30 @@ private:
   srsenb::pdcp_interface_gtpu *pdcp;
   srslte::log                 *gtpu_log;
 
-  typedef struct{
-    uint32_t teids_in[SRSENB_N_RADIO_BEARERS];
-    uint32_t teids_out[SRSENB_N_RADIO_BEARERS];
-    uint32_t spgw_addrs[SRSENB_N_RADIO_BEARERS];
-  }bearer_map;
-  std::map<uint16_t, bearer_map> rnti_bearers;
+  /* RNTI/LCID to S1-U tunnel table. Two-level array indexed by RNTI whose
+   * pages are allocated on first use and only freed by the destructor, so
+   * lookups from the PDCP and receive threads take no lock. Each entry packs
+   * the SPGW address and the outgoing TEID in one aligned 64-bit word, 0 when
+   * there is no tunnel. Writers must be serialized by the caller.
+   */
+  class tunnel_table
+  {
+  public:
+    tunnel_table();
+    ~tunnel_table();
+    bool add(uint16_t rnti, uint32_t lcid, uint32_t addr, uint32_t teid_out);
+    void rem(uint16_t rnti, uint32_t lcid);
+    void rem_user(uint16_t rnti);
+    bool find(uint16_t rnti, uint32_t lcid, uint32_t *addr, uint32_t *teid_out);
+  private:
+    static const uint32_t PAGE_SIZE = 256;
+    static const uint32_t NOF_PAGES = 65536/PAGE_SIZE;
+    typedef struct {
+      volatile uint64_t tunnels[SRSENB_N_RADIO_BEARERS];
+    } user_t;
+    user_t *volatile pages[NOF_PAGES];
+  };
+  tunnel_table tunnels;
 
   // Socket file descriptors
   int snk_fd;
@@ -110,6 +133,35 @@ private:
   
   pthread_mutex_t mutex; 
 
+  // Uplink PDUs queued by write_pdu() and sent with one sendmmsg() per TTI
+  static const int TX_FLUSH_PERIOD_US = 1000;
+  class tx_flush_thread : public periodic_thread
+  {
+  public:
+    tx_flush_thread(gtpu *parent_) : parent(parent_), started(false) {}
+    void start() { started = true; start_periodic(TX_FLUSH_PERIOD_US); }
+    // Does nothing if it was never started
+    void stop()  { if (started) { started = false; periodic_thread::stop(); } }
+  private:
+    gtpu *parent;
+    bool  started;
+    void run_period() { parent->flush(); }
+  };
+  // Flushes the queue every TTI
+  tx_flush_thread        tx_flusher;
+  pthread_mutex_t        tx_mutex;
+  uint32_t               tx_nof_pdus;
+  srslte::byte_buffer_t *tx_pdus[BATCH_SIZE];
+  struct mmsghdr         tx_msg[BATCH_SIZE];
+  struct iovec           tx_iov[BATCH_SIZE];
+  struct sockaddr_in     tx_addr[BATCH_SIZE];
+  void flush_tx();
+
+  // Downlink PDUs received with one recvmmsg()
+  srslte::byte_buffer_t *rx_pdus[BATCH_SIZE];
+  struct mmsghdr         rx_msg[BATCH_SIZE];
+  struct iovec           rx_iov[BATCH_SIZE];
+
   /****************************************************************************
    * Header pack/unpack helper functions
    * Ref: 3GPP TS 29.281 v10.1.0 Section 5
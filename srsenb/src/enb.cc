@@ -54,7 +54,6 @@ void enb::cleanup(void)
 }
 
 enb::enb() : started(false) {
-  srslte_dft_load();
   pool = srslte::byte_buffer_pool::get_instance();
 
   logger = NULL;
@@ -74,8 +73,27 @@ bool enb::init(all_args_t *args_)
 {
   args     = args_;
 
+  // Select the SIMD kernels before the PHY objects are created
+  if (!args->expert.simd.empty()) {
+    srslte_cpu_level_t simd_level;
+    if (srslte_cpu_level_parse(args->expert.simd.c_str(), &simd_level)) {
+      printf("Invalid SIMD level %s\n", args->expert.simd.c_str());
+      return false;
+    }
+    srslte_cpu_set_level(simd_level);
+  }
+  srslte_cpu_report(stdout);
+
+  // Load FFTW wisdom before the PHY plans its DFTs
+  srslte_dft_set_wisdom_file(args->expert.fftw_wisdom_file.c_str());
+  srslte_dft_load();
+
   if (!args->log.filename.compare("stdout")) {
     logger = &logger_stdout;
+  } else if (!args->log.mode.compare("async") || !args->log.mode.compare("binary")) {
+    logger_binary.init(args->log.filename, !args->log.mode.compare("async"), args->log.file_max_size);
+    logger_binary.log("\n\n");
+    logger = &logger_binary;
   } else {
     logger_file.init(args->log.filename, args->log.file_max_size);
     logger_file.log("\n\n");
@@ -248,6 +266,7 @@ void enb::stop()
        mac_pcap.close();
     }
     radio.stop();
+    logger_binary.stop();
     started = false;
   }
 }
@@ -263,6 +282,7 @@ bool enb::get_metrics(enb_metrics_t &m)
   rf_metrics.rf_error = false; // Reset error flag
 
   phy.get_metrics(m.phy);
+  phy.get_pipeline_metrics(&m.phy_pipeline);
   mac.get_metrics(m.mac);
   rrc.get_metrics(m.rrc);
   s1ap.get_metrics(m.s1ap);
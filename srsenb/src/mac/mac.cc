@@ -78,8 +78,17 @@ bool mac::init(mac_args_t *args_, srslte_cell_t *cell_, phy_interface_mac *phy,
     memcpy(&cell, cell_, sizeof(srslte_cell_t));
     
     scheduler.init(rrc, log_h);
-    // Set default scheduler (RR)
-    scheduler.set_metric(&sched_metric_dl_rr, &sched_metric_ul_rr);
+    // Set scheduler metric (RR by default)
+    switch(args.sched_metric) {
+      case METRIC_PF:
+      case METRIC_MT:
+        sched_metric_dl_pf.set_params(args.sched_metric, args.pf_window_ms);
+        sched_metric_ul_pf.set_params(args.sched_metric, args.pf_window_ms);
+        scheduler.set_metric(&sched_metric_dl_pf, &sched_metric_ul_pf);
+        break;
+      default:
+        scheduler.set_metric(&sched_metric_dl_rr, &sched_metric_ul_rr);
+    }
     
     // Set default scheduler configuration 
     scheduler.set_sched_cfg(&args.sched);
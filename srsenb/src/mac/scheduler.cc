@@ -53,7 +53,6 @@ sched::sched() : bc_aggr_level(0), rar_aggr_level(0), avail_rbg(0), P(0), start_
 
   bzero(&cfg, sizeof(cfg));
   bzero(&regs, sizeof(regs));
-  bzero(&used_cce, sizeof(used_cce));
   bzero(&sched_cfg, sizeof(sched_cfg));
   bzero(&common_locations, sizeof(common_locations));
   bzero(&pdsch_re, sizeof(pdsch_re));
@@ -267,7 +266,7 @@ uint32_t sched::get_ul_buffer(uint16_t rnti)
  * with the FAPI interface
  *
  * We add a new mutex used only in ue_rem to avoid the UE being removed in between the access to
- * ue_db.count() and the access to the std::map.
+ * ue_db.count() and the access to the UE table.
  */
 int sched::dl_rlc_buffer_state(uint16_t rnti, uint32_t lc_id, uint32_t tx_queue, uint32_t retx_queue)
 {
@@ -485,6 +484,20 @@ void sched::tpc_dec(uint16_t rnti)
   }
 }
 
+void sched::get_pdcch_metrics(sched_pdcch::metrics_t *m)
+{
+  pthread_mutex_lock(&mutex);
+  pdcch.get_metrics(m);
+  pthread_mutex_unlock(&mutex);
+}
+
+void sched::set_pdcch_backtracking(bool enable)
+{
+  pthread_mutex_lock(&mutex);
+  pdcch.set_backtracking(enable);
+  pthread_mutex_unlock(&mutex);
+}
+
 /*******************************************************
  * 
  * Main sched functions 
@@ -565,6 +578,7 @@ int sched::dl_sched_bc(dl_sched_bc_t bc[MAX_BC_LIST])
             avail_rbg -= si_n_rbg;
             start_rbg += si_n_rbg;                   
           } else {
+            pdcch.rem_last();
             Error("Could not allocate DCI Format1A for SIB%d, len=%d\n", i+1, cfg.sibs[i].len);
           }
         } else {
@@ -593,6 +607,8 @@ int sched::dl_sched_bc(dl_sched_bc_t bc[MAX_BC_LIST])
             avail_rbg -= si_n_rbg;
             start_rbg += si_n_rbg;                   
             
+          } else {
+            pdcch.rem_last();
           }
         }
       }    
@@ -667,6 +683,7 @@ int sched::dl_sched_rar(dl_sched_rar_t rar[MAX_RAR_LIST])
             avail_rbg -= rar_n_rb;
             start_rbg += rar_n_rb;           
           } else {
+            pdcch.rem_last();
             Error("SCHED: Allocating Format1A grant\n");
           }
                               
@@ -691,8 +708,8 @@ int sched::dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST])
   dl_metric->new_tti(ue_db, start_rbg, avail_rbg, nof_ctrl_symbols, current_tti); 
   
   int nof_data_elems = 0; 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user = iter->second;
     uint16_t rnti  = (uint16_t) iter->first;
 
     uint32_t data_before = user->get_pending_dl_new_data(current_tti);
@@ -705,7 +722,7 @@ int sched::dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST])
       // Try to schedule DCI first 
       if (generate_dci(&data[nof_data_elems].dci_location, 
                        user->get_locations(current_cfi, sf_idx),
-                       aggr_level, user))
+                       aggr_level, user, h))
       {     
         bool is_newtx = h->is_empty(0) && h->is_empty(1) ;
         int tbs = 0;
@@ -732,6 +749,7 @@ int sched::dl_sched_data(dl_sched_data_t data[MAX_DATA_LIST])
                       data[nof_data_elems].dci.tb_en[1]?"y":"n");
           nof_data_elems++;
         } else {
+          pdcch.rem_last();
           log_h->warning("SCHED: Error DL %s rnti=0x%x, pid=%d, mask=0x%x, dci=%d,%d, tbs=%d, buffer=%d\n", 
                       !is_newtx?"retx":"tx", rnti, h->get_id(), h->get_rbgmask(), 
                       data[nof_data_elems].dci_location.L, data[nof_data_elems].dci_location.ncce,
@@ -757,9 +775,11 @@ int sched::dl_sched(uint32_t tti, sched_interface::dl_sched_res_t* sched_result)
   }
   pthread_mutex_lock(&mutex);
 
-  /* If ul_sched() not yet called this tti, reset CCE state */
+  /* If ul_sched() not yet called this tti, reset CCE state. Otherwise its DCIs keep their location */
   if (current_tti != tti) {
-    bzero(used_cce, MAX_CCE*sizeof(bool));    
+    pdcch.new_tti(srslte_regs_pdcch_ncce(&regs, sched_cfg.nof_ctrl_symbols));
+  } else {
+    pdcch.fix();
   }
 
   /* Initialize variables */
@@ -798,9 +818,11 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
 
   pthread_mutex_lock(&mutex);
 
-  /* If dl_sched() not yet called this tti (this tti is +4ms advanced), reset CCE state */
+  /* If dl_sched() not yet called this tti (this tti is +4ms advanced), reset CCE state. Otherwise its DCIs keep their location */
   if (TTI_TX(current_tti) != tti) {
-    bzero(used_cce, MAX_CCE*sizeof(bool));    
+    pdcch.new_tti(srslte_regs_pdcch_ncce(&regs, sched_cfg.nof_ctrl_symbols));
+  } else {
+    pdcch.fix();
   }
   
   /* Initialize variables */
@@ -818,8 +840,8 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
   bzero(sched_result, sizeof(sched_interface::ul_sched_res_t));
 
   // Get HARQ process for this TTI 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user = iter->second;
     uint16_t rnti  = (uint16_t) iter->first; 
 
     user->has_pucch = false;
@@ -843,8 +865,8 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
   }
 
   // Allocate PUCCH resources 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user = iter->second;
     uint16_t rnti  = (uint16_t) iter->first; 
     uint32_t prb_idx[2] = {0, 0}; 
     if (user->get_pucch_sched(current_tti, prb_idx)) {
@@ -858,8 +880,8 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
   }
   
   // Now allocate PUSCH 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user = iter->second;
     uint16_t rnti  = (uint16_t) iter->first; 
 
     ul_harq_proc *h = NULL; 
@@ -937,6 +959,9 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
 
           nof_dci_elems++;          
         } else {
+          if (needs_pdcch) {
+            pdcch.rem_last();
+          }
           log_h->warning("SCHED: Error %s %s rnti=0x%x, pid=%d, dci=%d,%d, grant=(%d,%d), tbs=%d, bsr=%d\n",
                       is_rar?"RAR":"UL",
                       is_newtx?"tx":"retx",                
@@ -950,8 +975,8 @@ int sched::ul_sched(uint32_t tti, srsenb::sched_interface::ul_sched_res_t* sched
   }
 
   // Update pending data counters after this TTI
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user = (sched_ue *) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user = iter->second;
     uint16_t rnti = (uint16_t) iter->first;
 
     user->get_ul_harq(current_tti)->reset_pending_data();
@@ -999,45 +1024,13 @@ void sched::generate_cce_location(srslte_regs_t *regs_, sched_ue::sched_dci_cce_
 }
 
 
-#define NCCE(L) (1<<L)
-
-bool sched::generate_dci(srslte_dci_location_t *sched_location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, sched_ue *user) 
+bool sched::generate_dci(srslte_dci_location_t *sched_location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, 
+                         sched_ue *user, dl_harq_proc *h) 
 {
-  uint32_t nof_cand  = 0;
-  uint32_t test_cand = rand()%locations->nof_loc[aggr_level];
-  bool allocated=false;
-
-  while(nof_cand<locations->nof_loc[aggr_level] && !allocated) {
-    uint32_t ncce = locations->cce_start[aggr_level][test_cand];
-    bool used = false;
-    if (user) {
-      used = user->pucch_sr_collision(current_tti, ncce);
-    }
-    for (int j=0;j<NCCE(aggr_level) && !used;j++) {
-      if (used_cce[ncce+j]) {
-        used = true; 
-      }
-    }
-    if (used) {
-      test_cand++;
-      if (test_cand==locations->nof_loc[aggr_level]) {
-        test_cand = 0;
-      }
-      nof_cand++;
-    } else {
-      for (int j=0;j<NCCE(aggr_level) && !used;j++) {
-        used_cce[ncce+j] = true; 
-      }
-      allocated = true; 
-      Debug("SCHED: Allocated DCI L=%d, ncce=%d\n", aggr_level, ncce);
-    }
+  bool allocated = pdcch.alloc(sched_location, locations, aggr_level, current_tti, user, h); 
+  if (allocated) {
+    Debug("SCHED: Allocated DCI L=%d, ncce=%d\n", aggr_level, sched_location?sched_location->ncce:0);
   }
-  
-  if (allocated && sched_location) {
-    sched_location->L = aggr_level; 
-    sched_location->ncce = locations->cce_start[aggr_level][test_cand];
-  }
-    
   return allocated; 
 }
 
@@ -166,6 +166,11 @@ uint32_t dl_harq_proc::get_n_cce()
   return n_cce; 
 }
 
+void dl_harq_proc::set_n_cce(uint32_t n_cce_)
+{
+  n_cce = n_cce_; 
+}
+
 uint32_t dl_harq_proc::get_rbgmask()
 {
   return rbgmask;
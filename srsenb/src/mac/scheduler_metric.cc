@@ -25,6 +25,7 @@
  */
 
 #include <string.h>
+#include <algorithm>
 #include "srsenb/hdr/mac/scheduler_harq.h"
 #include "srsenb/hdr/mac/scheduler_metric.h"
 
@@ -76,7 +77,7 @@ uint32_t dl_metric_rr::get_required_rbg(sched_ue *user, uint32_t tti)
   return user->get_required_prb_dl(pending_data, nof_ctrl_symbols); 
 }
 
-void dl_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols_, uint32_t tti)
+void dl_metric_rr::new_tti(sched_ue_db &ue_db, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols_, uint32_t tti)
 {
   
   total_rb = start_rb+nof_rb; 
@@ -93,8 +94,8 @@ void dl_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t start_rb
   nof_ctrl_symbols = nof_ctrl_symbols_; 
   
   nof_users_with_data = 0; 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user      = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user      = iter->second;
     if (user->get_pending_dl_new_data(current_tti) || user->get_pending_dl_harq(current_tti)) {
       user->ue_idx = nof_users_with_data;
       nof_users_with_data++; 
@@ -153,7 +154,14 @@ dl_harq_proc* dl_metric_rr::get_user_allocation(sched_ue *user)
       }    
     }
   }
-  
+  return allocate_user(user);
+}
+
+dl_harq_proc* dl_metric_rr::allocate_user(sched_ue *user)
+{
+  uint32_t pending_data = user->get_pending_dl_new_data(current_tti); 
+  dl_harq_proc *h = user->get_pending_dl_harq(current_tti);
+
   // Schedule retx if we have space 
 #if ASYNC_DL_SCHED
   if (h) {
@@ -212,7 +220,7 @@ dl_harq_proc* dl_metric_rr::get_user_allocation(sched_ue *user)
  *
  *****************************************************************/  
 
-void ul_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb_, uint32_t tti)
+void ul_metric_rr::new_tti(sched_ue_db &ue_db, uint32_t nof_rb_, uint32_t tti)
 {
   current_tti  = tti; 
   nof_rb       = nof_rb_; 
@@ -220,8 +228,8 @@ void ul_metric_rr::new_tti(std::map<uint16_t,sched_ue> &ue_db, uint32_t nof_rb_,
   bzero(used_rb, nof_rb*sizeof(bool));
   
   nof_users_with_data = 0; 
-  for(std::map<uint16_t, sched_ue>::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
-    sched_ue *user      = (sched_ue*) &iter->second;
+  for(sched_ue_db::iterator iter=ue_db.begin(); iter!=ue_db.end(); ++iter) {
+    sched_ue *user      = iter->second;
     if (user->get_pending_ul_new_data(current_tti) || !user->get_ul_harq(current_tti)->is_empty(0)) {
       user->ue_idx    = nof_users_with_data;
       nof_users_with_data++;
@@ -301,6 +309,13 @@ ul_harq_proc*  ul_metric_rr::get_user_allocation(sched_ue *user)
       }    
     }    
   }
+  return allocate_user(user);
+}
+
+ul_harq_proc* ul_metric_rr::allocate_user(sched_ue *user)
+{
+  uint32_t pending_data = user->get_pending_ul_new_data(current_tti); 
+  ul_harq_proc *h = user->get_ul_harq(current_tti);
 
   // Schedule retx if we have space 
   
@@ -340,4 +355,184 @@ ul_harq_proc*  ul_metric_rr::get_user_allocation(sched_ue *user)
 
 
 
+/*****************************************************************
+ *
+ * Proportional-fair / max-throughput Downlink Metric 
+ *
+ *****************************************************************/  
+
+dl_metric_pf::dl_metric_pf() : ue_db(NULL), type(METRIC_PF), alpha(0.01), planned(false)
+{
+}
+
+void dl_metric_pf::set_params(sched_metric_t type_, uint32_t fairness_window)
+{
+  type  = type_; 
+  alpha = 1.0/SRSLTE_MAX(fairness_window, 1); 
+}
+
+bool dl_metric_pf::candidate_cmp(const candidate_t &a, const candidate_t &b)
+{
+  if (a.is_retx != b.is_retx) {
+    return a.is_retx; 
+  }
+  return a.priority > b.priority; 
+}
+
+void dl_metric_pf::new_tti(sched_ue_db &ue_db_, uint32_t start_rb, uint32_t nof_rb, uint32_t nof_ctrl_symbols_, uint32_t tti)
+{
+  total_rb = start_rb+nof_rb; 
+  for (uint32_t i=0;i<total_rb;i++) {
+    used_rb[i] = i<start_rb; 
+  }
+  available_rb = nof_rb; 
+  used_rb_mask = calc_rbg_mask(used_rb);
+  current_tti = tti; 
+  nof_ctrl_symbols = nof_ctrl_symbols_; 
+  
+  // Allocations are computed on the first call to get_user_allocation() 
+  ue_db   = &ue_db_; 
+  planned = false; 
+}
+
+void dl_metric_pf::plan_allocations()
+{
+  planned = true; 
+  candidates.clear(); 
+  allocations.clear(); 
+  
+  for(sched_ue_db::iterator iter=ue_db->begin(); iter!=ue_db->end(); ++iter) {
+    sched_ue *user = iter->second;
+    user->dl_avg_rate *= (1-alpha); 
+    
+    dl_harq_proc *h = user->get_pending_dl_harq(current_tti);
+#if ASYNC_DL_SCHED
+    bool is_retx = h != NULL; 
+#else
+    bool is_retx = h && !h->is_empty(0); 
+#endif
+    if (is_retx || user->get_pending_dl_new_data(current_tti)) {
+      candidate_t c; 
+      c.is_retx  = is_retx; 
+      c.priority = user->get_dl_spectral_eff(); 
+      if (type == METRIC_PF) {
+        c.priority /= SRSLTE_MAX(user->dl_avg_rate, 1e-6); 
+      }
+      c.user = user; 
+      candidates.push_back(c); 
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), candidate_cmp); 
+  
+  uint32_t full_mask = (1<<total_rb)-1; 
+  for (uint32_t i=0;i<candidates.size() && allocations.size() < MAX_UE_TTI;i++) {
+    if ((used_rb_mask & full_mask) == full_mask) {
+      break; 
+    }
+    sched_ue *user  = candidates[i].user; 
+    dl_harq_proc *h = allocate_user(user); 
+    if (h) {
+      user->ue_idx = allocations.size(); 
+      allocations.push_back(std::make_pair(user, h)); 
+      user->dl_avg_rate += alpha*count_rbg(h->get_rbgmask())*user->get_dl_spectral_eff(); 
+    }
+  }
+}
+
+dl_harq_proc* dl_metric_pf::get_user_allocation(sched_ue *user)
+{
+  if (!planned) {
+    plan_allocations(); 
+  }
+  if (user->ue_idx < allocations.size() && allocations[user->ue_idx].first == user) {
+    return allocations[user->ue_idx].second; 
+  }
+  return NULL; 
+}
+
+
+
+/*****************************************************************
+ *
+ * Proportional-fair / max-throughput Uplink Metric 
+ *
+ *****************************************************************/  
+
+ul_metric_pf::ul_metric_pf() : ue_db(NULL), type(METRIC_PF), alpha(0.01), planned(false)
+{
+}
+
+void ul_metric_pf::set_params(sched_metric_t type_, uint32_t fairness_window)
+{
+  type  = type_; 
+  alpha = 1.0/SRSLTE_MAX(fairness_window, 1); 
+}
+
+bool ul_metric_pf::candidate_cmp(const candidate_t &a, const candidate_t &b)
+{
+  if (a.is_retx != b.is_retx) {
+    return a.is_retx; 
+  }
+  return a.priority > b.priority; 
+}
+
+void ul_metric_pf::new_tti(sched_ue_db &ue_db_, uint32_t nof_rb_, uint32_t tti)
+{
+  current_tti  = tti; 
+  nof_rb       = nof_rb_; 
+  available_rb = nof_rb_; 
+  bzero(used_rb, nof_rb*sizeof(bool));
+
+  // Allocations are computed on the first call to get_user_allocation(), after
+  // the scheduler has reserved PUCCH and Msg3 resources 
+  ue_db   = &ue_db_; 
+  planned = false; 
+}
+
+void ul_metric_pf::plan_allocations()
+{
+  planned = true; 
+  candidates.clear(); 
+  allocations.clear(); 
+  
+  for(sched_ue_db::iterator iter=ue_db->begin(); iter!=ue_db->end(); ++iter) {
+    sched_ue *user = iter->second;
+    user->ul_avg_rate *= (1-alpha); 
+    
+    bool is_retx = !user->get_ul_harq(current_tti)->is_empty(0); 
+    if (is_retx || user->get_pending_ul_new_data(current_tti)) {
+      candidate_t c; 
+      c.is_retx  = is_retx; 
+      c.priority = user->get_ul_spectral_eff(); 
+      if (type == METRIC_PF) {
+        c.priority /= SRSLTE_MAX(user->ul_avg_rate, 1e-6); 
+      }
+      c.user = user; 
+      candidates.push_back(c); 
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), candidate_cmp); 
+  
+  for (uint32_t i=0;i<candidates.size() && allocations.size() < MAX_UE_TTI && available_rb > 0;i++) {
+    sched_ue *user  = candidates[i].user; 
+    ul_harq_proc *h = allocate_user(user); 
+    if (h) {
+      user->ue_idx = allocations.size(); 
+      allocations.push_back(std::make_pair(user, h)); 
+      user->ul_avg_rate += alpha*h->get_alloc().L*user->get_ul_spectral_eff(); 
+    }
+  }
+}
+
+ul_harq_proc* ul_metric_pf::get_user_allocation(sched_ue *user)
+{
+  if (!planned) {
+    plan_allocations(); 
+  }
+  if (user->ue_idx < allocations.size() && allocations[user->ue_idx].first == user) {
+    return allocations[user->ue_idx].second; 
+  }
+  return NULL; 
+}
+
 }
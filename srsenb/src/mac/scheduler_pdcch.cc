@@ -0,0 +1,208 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+
+#include "srsenb/hdr/mac/scheduler.h"
+#include "srsenb/hdr/mac/scheduler_pdcch.h"
+
+namespace srsenb {
+
+sched_pdcch::sched_pdcch()
+{
+  backtracking = true; 
+  bzero(&metrics, sizeof(metrics_t));
+  new_tti(MAX_CCE); 
+}
+
+void sched_pdcch::new_tti(uint32_t nof_cce_)
+{
+  nof_cce      = nof_cce_; 
+  nof_used_cce = 0; 
+  nof_allocs   = 0; 
+  nof_fixed    = 0; 
+  bzero(used, sizeof(used));
+  bzero(fixed_used, sizeof(fixed_used));
+}
+
+void sched_pdcch::set_backtracking(bool enable)
+{
+  backtracking = enable; 
+}
+
+void sched_pdcch::get_metrics(metrics_t *m)
+{
+  memcpy(m, &metrics, sizeof(metrics_t));
+}
+
+/* Candidates start at a multiple of their size of at most 8 CCEs, so the 
+ * CCEs of one candidate never straddle two words of the bitmap */
+bool sched_pdcch::fits(uint64_t *used_, alloc_t *a, uint32_t cand)
+{
+  uint32_t ncce = a->locations->cce_start[a->L][cand]; 
+  uint64_t mask = ((1ULL<<(1<<a->L))-1) << (ncce%64); 
+  return (used_[ncce/64] & mask) == 0; 
+}
+
+void sched_pdcch::set(uint64_t *used_, alloc_t *a, uint32_t cand, bool value)
+{
+  uint32_t ncce = a->locations->cce_start[a->L][cand]; 
+  uint64_t mask = ((1ULL<<(1<<a->L))-1) << (ncce%64); 
+  if (value) {
+    used_[ncce/64] |= mask; 
+  } else {
+    used_[ncce/64] &= ~mask; 
+  }
+}
+
+void sched_pdcch::place(alloc_t *a, uint32_t cand)
+{
+  uint32_t ncce = a->locations->cce_start[a->L][cand]; 
+  a->cand = cand; 
+  if (a->location) {
+    a->location->L    = a->L; 
+    a->location->ncce = ncce; 
+  }
+  if (a->h) {
+    a->h->set_n_cce(ncce); 
+  }
+}
+
+bool sched_pdcch::alloc(srslte_dci_location_t *location, sched_ue::sched_dci_cce_t *locations, uint32_t aggr_level, 
+                        uint32_t tti, sched_ue *user, dl_harq_proc *h)
+{
+  metrics.nof_req++; 
+  
+  uint32_t nof_loc = locations->nof_loc[aggr_level]; 
+  if (nof_allocs == MAX_ALLOC || nof_loc == 0) {
+    metrics.nof_blocked++; 
+    return false; 
+  }
+  
+  alloc_t *a   = &allocs[nof_allocs]; 
+  a->location  = location; 
+  a->locations = locations; 
+  a->h         = h; 
+  a->L         = aggr_level; 
+  a->cand_mask = 0; 
+  for (uint32_t i=0;i<nof_loc;i++) {
+    if (!user || !user->pucch_sr_collision(tti, locations->cce_start[aggr_level][i])) {
+      a->cand_mask |= 1<<i; 
+    }
+  }
+  
+  // First free candidate, from a random one to spread the DCIs over the search spaces 
+  uint32_t start = rand()%nof_loc; 
+  for (uint32_t i=0;i<nof_loc;i++) {
+    uint32_t c = (start+i)%nof_loc; 
+    if ((a->cand_mask & (1<<c)) && fits(used, a, c)) {
+      set(used, a, c, true); 
+      place(a, c); 
+      nof_allocs++; 
+      nof_used_cce += 1<<aggr_level; 
+      return true; 
+    }
+  }
+  
+  // Moving DCIs does not help if there are not enough free CCEs left 
+  if (backtracking && nof_allocs > nof_fixed && nof_used_cce + (1<<aggr_level) <= nof_cce) {
+    // Place the new DCI first, it is the one known not to fit 
+    uint32_t n = 0; 
+    order[n++] = nof_allocs; 
+    for (uint32_t i=nof_fixed;i<nof_allocs;i++) {
+      order[n++] = i; 
+    }
+    uint64_t trial_used[MAX_CCE/64]; 
+    memcpy(trial_used, fixed_used, sizeof(trial_used)); 
+    uint32_t nof_nodes = 0; 
+    if (search(0, trial_used, &nof_nodes)) {
+      for (uint32_t i=nof_fixed;i<nof_allocs;i++) {
+        if (trial[i] != allocs[i].cand) {
+          place(&allocs[i], trial[i]); 
+          metrics.nof_moved++; 
+        }
+      }
+      place(a, trial[nof_allocs]); 
+      memcpy(used, trial_used, sizeof(used)); 
+      nof_allocs++; 
+      nof_used_cce += 1<<aggr_level; 
+      return true; 
+    }
+  }
+  
+  metrics.nof_blocked++; 
+  return false; 
+}
+
+bool sched_pdcch::search(uint32_t k, uint64_t *used_, uint32_t *nof_nodes)
+{
+  if (k == nof_allocs - nof_fixed + 1) {
+    return true; 
+  }
+  uint32_t idx     = order[k]; 
+  alloc_t *a       = &allocs[idx]; 
+  uint32_t nof_loc = a->locations->nof_loc[a->L]; 
+  
+  // DCIs already allocated try their current candidate first, so that few of them move 
+  uint32_t start = idx < nof_allocs ? a->cand : 0; 
+  for (uint32_t i=0;i<nof_loc;i++) {
+    uint32_t c = (start+i)%nof_loc; 
+    if (!(a->cand_mask & (1<<c))) {
+      continue; 
+    }
+    if (++(*nof_nodes) > MAX_NODES) {
+      return false; 
+    }
+    if (fits(used_, a, c)) {
+      set(used_, a, c, true); 
+      trial[idx] = c; 
+      if (search(k+1, used_, nof_nodes)) {
+        return true; 
+      }
+      set(used_, a, c, false); 
+    }
+  }
+  return false; 
+}
+
+void sched_pdcch::rem_last()
+{
+  if (nof_allocs > nof_fixed) {
+    nof_allocs--; 
+    set(used, &allocs[nof_allocs], allocs[nof_allocs].cand, false); 
+    nof_used_cce -= 1<<allocs[nof_allocs].L; 
+  }
+}
+
+void sched_pdcch::fix()
+{
+  nof_fixed = nof_allocs; 
+  memcpy(fixed_used, used, sizeof(used)); 
+}
+
+}
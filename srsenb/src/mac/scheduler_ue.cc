@@ -49,7 +49,7 @@ namespace srsenb {
  * 
  *******************************************************/
 
-sched_ue::sched_ue() : ue_idx(0), has_pucch(false), power_headroom(0), rnti(0), max_mcs_dl(0), max_mcs_ul(0),
+sched_ue::sched_ue() : ue_idx(0), dl_avg_rate(0), ul_avg_rate(0), has_pucch(false), power_headroom(0), rnti(0), max_mcs_dl(0), max_mcs_ul(0),
                        fixed_mcs_ul(0), fixed_mcs_dl(0), phy_config_dedicated_enabled(false)
 {
   log_h = NULL;
@@ -68,6 +68,9 @@ void sched_ue::set_cfg(uint16_t rnti_, sched_interface::ue_cfg_t *cfg_, sched_in
 {
   reset();
   
+  // Search spaces depend on the RNTI only, they are kept across reconfigurations 
+  bool new_rnti = rnti != rnti_; 
+  
   rnti  = rnti_; 
   log_h = log_h_; 
   memcpy(&cell, &cell_cfg->cell, sizeof(srslte_cell_t));
@@ -91,11 +94,13 @@ void sched_ue::set_cfg(uint16_t rnti_, sched_interface::ue_cfg_t *cfg_, sched_in
   }
   
   // Generate allowed CCE locations   
-  for (int cfi=0;cfi<3;cfi++) {
-    for (int sf_idx=0;sf_idx<10;sf_idx++) {
-      sched::generate_cce_location(regs, &dci_locations[cfi][sf_idx], cfi+1, sf_idx, rnti);
-    }
-  }    
+  if (new_rnti) {
+    for (int cfi=0;cfi<3;cfi++) {
+      for (int sf_idx=0;sf_idx<10;sf_idx++) {
+        sched::generate_cce_location(regs, &dci_locations[cfi][sf_idx], cfi+1, sf_idx, rnti);
+      }
+    }    
+  }
 }
 
 void sched_ue::reset()
@@ -116,6 +121,8 @@ void sched_ue::reset()
   dl_pmi = 0;
   dl_pmi_tti = 0;
   cqi_request_tti = 0;
+  dl_avg_rate = 0;
+  ul_avg_rate = 0;
   for (int i=0;i<SCHED_MAX_HARQ_PROC;i++) {
     for(uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
       dl_harq[i].reset(tb);
@@ -737,6 +744,27 @@ uint32_t sched_ue::get_pending_ul_new_data(uint32_t tti)
   return pending_data; 
 }
 
+/* Expected bits per RE from the last CQI/RI reports, used by throughput-aware metrics */
+float sched_ue::get_dl_spectral_eff()
+{
+  if (fixed_mcs_dl >= 0) {
+    return 1.0;
+  }
+  float eff = srslte_cqi_to_coderate(SRSLTE_MAX(dl_cqi, 1));
+  if (dl_ri > 0 && (get_dci_format() == SRSLTE_DCI_FORMAT2 || get_dci_format() == SRSLTE_DCI_FORMAT2A)) {
+    eff *= 2;
+  }
+  return eff;
+}
+
+float sched_ue::get_ul_spectral_eff()
+{
+  if (fixed_mcs_ul >= 0) {
+    return 1.0;
+  }
+  return srslte_cqi_to_coderate(SRSLTE_MAX(ul_cqi, 1));
+}
+
 uint32_t sched_ue::get_pending_ul_old_data()
 {
   uint32_t pending_data = 0; 
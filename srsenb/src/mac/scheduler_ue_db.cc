@@ -0,0 +1,93 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/mac/scheduler.h"
+#include "srsenb/hdr/mac/scheduler_ue_db.h"
+
+namespace srsenb {
+
+sched_ue_db::sched_ue_db() : position(NOF_RNTI, 0)
+{
+}
+
+sched_ue_db::~sched_ue_db()
+{
+  for (uint32_t i=0;i<blocks.size();i++) {
+    delete [] blocks[i];
+  }
+}
+
+sched_ue& sched_ue_db::operator[](uint16_t rnti)
+{
+  if (position[rnti]) {
+    return *active[position[rnti]-1].second; 
+  }
+  
+  if (free_slots.empty()) {
+    sched_ue *block = new sched_ue[SLOTS_PER_BLOCK]; 
+    blocks.push_back(block);
+    for (int i=SLOTS_PER_BLOCK-1;i>=0;i--) {
+      free_slots.push_back(&block[i]);
+    }
+  } 
+  sched_ue *user = free_slots.back(); 
+  free_slots.pop_back();
+  
+  // Start from a clean state, as a newly inserted std::map element would 
+  *user = sched_ue(); 
+  
+  active.push_back(entry_t(rnti, user));
+  position[rnti] = active.size(); 
+  return *user; 
+}
+
+void sched_ue_db::erase(uint16_t rnti)
+{
+  uint32_t pos = position[rnti]; 
+  if (!pos) {
+    return; 
+  }
+  free_slots.push_back(active[pos-1].second);
+  
+  // Move the last entry into the hole to keep the list dense
+  if (pos < active.size()) {
+    active[pos-1] = active.back(); 
+    position[active[pos-1].first] = pos; 
+  }
+  active.pop_back();
+  position[rnti] = 0; 
+}
+
+void sched_ue_db::clear()
+{
+  for (uint32_t i=0;i<active.size();i++) {
+    position[active[i].first] = 0; 
+    free_slots.push_back(active[i].second);
+  }
+  active.clear();
+}
+
+}
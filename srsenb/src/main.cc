@@ -55,6 +55,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
   string tac;
   string mcc;
   string mnc;
+  string sched_metric;
 
   // Command line only options
   bpo::options_description general("General options");
@@ -123,6 +124,7 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
 
     ("log.filename",      bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"),"Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.mode",          bpo::value<string>(&args->log.mode)->default_value("file"), "Log writer: file, async (formatted by a background thread) or binary (decode with log_decoder)")
 
     /* MCS section */
     ("scheduler.pdsch_mcs",
@@ -140,6 +142,12 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
     ("scheduler.nof_ctrl_symbols",
         bpo::value<int>(&args->expert.mac.sched.nof_ctrl_symbols)->default_value(3),
         "Number of control symbols")
+    ("scheduler.metric",
+        bpo::value<string>(&sched_metric)->default_value("rr"),
+        "Scheduling metric: rr, pf (proportional-fair) or mt (max throughput)")
+    ("scheduler.pf_window_ms",
+        bpo::value<uint32_t>(&args->expert.mac.pf_window_ms)->default_value(100),
+        "Averaging window of the served rate for the pf metric (in TTIs)")
 
     
     /* Expert section */
@@ -152,10 +160,30 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
         bpo::value<bool>(&args->expert.phy.pregenerate_signals)->default_value(false),
         "Pregenerate uplink signals after attach. Improves CPU performance.")
 
+    ("expert.fftw_wisdom_file",
+        bpo::value<string>(&args->expert.fftw_wisdom_file)->default_value(".fftw_wisdom"),
+        "FFTW wisdom file loaded at startup and saved at exit. Empty disables it.")
+
+    ("expert.simd",
+        bpo::value<string>(&args->expert.simd)->default_value(""),
+        "SIMD kernels: generic, sse, avx, avx2, avx512 or auto. Empty uses SRSLTE_SIMD or the CPU features")
+
+    ("expert.sequence_cache_mb",
+        bpo::value<uint32_t>(&args->expert.phy.sequence_cache_mb)->default_value(64),
+        "Memory budget in MB for the scrambling sequence cache shared by PHY threads. 0 pregenerates them per thread")
+
+    ("expert.pipeline_budget_us",
+        bpo::value<uint32_t>(&args->expert.phy.pipeline_budget_us)->default_value(3000),
+        "Time from the end of a subframe reception to its transmission by which the PHY must be done")
+
     ("expert.pusch_max_its",
         bpo::value<int>(&args->expert.phy.pusch_max_its)->default_value(4),
         "Maximum number of turbo decoder iterations")
 
+    ("expert.nof_fec_threads",
+        bpo::value<uint32_t>(&args->expert.phy.nof_fec_threads)->default_value(0),
+        "Number of threads shared by the PHY threads to decode PUSCH code blocks in parallel and to correlate the PRACH roots. 0 does both in the PHY and PRACH threads")
+
     ("expert.tx_amplitude",
         bpo::value<float>(&args->expert.phy.tx_amplitude)->default_value(0.6),
         "Transmit amplitude factor")
@@ -269,6 +297,19 @@ void parse_args(all_args_t *args, int argc, char* argv[]) {
     cout << "Error parsing enb.mnc:" << mnc << " - must be a 2 or 3-digit string." << endl;
   }
 
+  // Convert scheduler metric string
+  if (!sched_metric.compare("pf")) {
+    args->expert.mac.sched_metric = METRIC_PF;
+  } else if (!sched_metric.compare("mt")) {
+    args->expert.mac.sched_metric = METRIC_MT;
+  } else {
+    if (sched_metric.compare("rr")) {
+      cout << "Error parsing scheduler.metric:" << sched_metric << " - must be rr, pf or mt. Using rr." << endl;
+    }
+    args->expert.mac.sched_metric = METRIC_RR;
+  }
+
+
 
   // Apply all_level to any unset layers
   if (vm.count("log.all_level")) {
@@ -160,10 +160,30 @@ void metrics_stdout::print_metrics()
   if(metrics.rf.rf_error) {
     printf("RF status: O=%d, U=%d, L=%d\n", metrics.rf.rf_o, metrics.rf.rf_u, metrics.rf.rf_l);
   }
+  print_pipeline();
 
   cout.flags(f); // For avoiding Coverity defect: Not restoring ostream format
 }
 
+void metrics_stdout::print_pipeline()
+{
+  const char *stage_names[PHY_NOF_STAGES] = {"fft", "ul", "dl", "tx"};
+  uint32_t nof_late = 0;
+  for (int i=0;i<PHY_NOF_STAGES;i++) {
+    nof_late += metrics.phy_pipeline.stage[i].nof_late;
+  }
+  if (nof_late == 0) {
+    return;
+  }
+  printf("PHY late TTIs:");
+  for (int i=0;i<PHY_NOF_STAGES;i++) {
+    phy_stage_metrics_t *m = &metrics.phy_pipeline.stage[i];
+    printf(" %s=%d/%d (avg=%.0f max=%.0f budget=%d us)", stage_names[i], m->nof_late, m->nof_ttis,
+           m->avg_us, m->max_us, m->budget_us);
+  }
+  printf("\n");
+}
+
 void metrics_stdout::print_disconnect()
 {
   if(do_print) {
@@ -29,8 +29,6 @@
 
 #include "srsenb/hdr/phy/txrx.h"
 
-#include <assert.h>
-
 #define Error(fmt, ...)   if (SRSLTE_DEBUG_ENABLED) log_h->error(fmt, ##__VA_ARGS__)
 #define Warning(fmt, ...) if (SRSLTE_DEBUG_ENABLED) log_h->warning(fmt, ##__VA_ARGS__)
 #define Info(fmt, ...)    if (SRSLTE_DEBUG_ENABLED) log_h->info(fmt, ##__VA_ARGS__)
@@ -41,10 +39,8 @@ using namespace std;
 
 namespace srsenb {
 
-void phch_common::set_nof_mutex(uint32_t nof_mutex_) {
-  nof_mutex = nof_mutex_; 
-  assert(nof_mutex <= max_mutex);
-}
+// Share of the processing budget by which each stage of phy_stage_t has to end
+static const float stage_budget_share[PHY_NOF_STAGES] = {0.25, 0.6, 0.9, 1.0};
 
 void phch_common::reset() {
   bzero(ul_grants, sizeof(mac_interface_phy::ul_sched_t)*TTIMOD_SZ);
@@ -57,37 +53,39 @@ bool phch_common::init(srslte_cell_t *cell_, srslte::radio* radio_h_, mac_interf
   mac   = mac_; 
   memcpy(&cell, cell_, sizeof(srslte_cell_t));
 
-  is_first_of_burst = true; 
-  is_first_tx = true; 
-  for (uint32_t i=0;i<max_mutex;i++) {
-    pthread_mutex_init(&tx_mutex[i], NULL);
+  pipeline.init(PHY_NOF_STAGES, stage_budget_share, NOF_SECTIONS, params.pipeline_budget_us);
+  if (params.sequence_cache_mb) {
+    uint64_t max_bytes = (uint64_t) params.sequence_cache_mb*1024*1024;
+    srslte_sequence_cache_init(&seq_cache, max_bytes);
+    srslte_sequence_cache_set_cell(&seq_cache, cell.id);
+  }
+  if (params.nof_fec_threads) {
+    if (srslte_fec_pool_init(&fec_pool, params.nof_fec_threads)) {
+      fprintf(stderr, "Error initiating FEC pool with %d threads\n", params.nof_fec_threads);
+      return false;
+    }
   }
   reset(); 
   return true; 
 }
 
 void phch_common::stop() {
-  for (uint32_t i=0;i<nof_mutex;i++) {
-    pthread_mutex_trylock(&tx_mutex[i]);
-    pthread_mutex_unlock(&tx_mutex[i]);
-  }
+  pipeline.stop();
 }
 
-void phch_common::worker_end(uint32_t tx_mutex_cnt, cf_t* buffer[SRSLTE_MAX_PORTS], uint32_t nof_samples, srslte_timestamp_t tx_time)
+void phch_common::worker_end(uint32_t sf_seq, cf_t* buffer[SRSLTE_MAX_PORTS], uint32_t nof_samples, srslte_timestamp_t tx_time)
 {
 
   // Wait previous TTIs to be transmitted 
-  if (is_first_tx) {
-    is_first_tx = false; 
-  } else {
-    pthread_mutex_lock(&tx_mutex[tx_mutex_cnt%nof_mutex]);
+  if (!pipeline.enter(SECTION_TX, sf_seq)) {
+    return;
   }
 
-  radio->set_tti(tx_mutex_cnt);
+  radio->set_tti(sf_seq);
   radio->tx((void **) buffer, nof_samples, tx_time);
   
   // Trigger next transmission 
-  pthread_mutex_unlock(&tx_mutex[(tx_mutex_cnt+1)%nof_mutex]);
+  pipeline.leave(SECTION_TX, sf_seq);
 
   // Trigger MAC clock
   mac->tti_clock();
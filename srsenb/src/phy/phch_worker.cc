@@ -77,6 +77,7 @@ phch_worker::phch_worker()
   bzero(&enb_dl, sizeof(enb_dl));
   bzero(&enb_ul, sizeof(enb_ul));
   bzero(&tx_time, sizeof(tx_time));
+  bzero(&rx_end, sizeof(rx_end));
 
   reset();  
 }
@@ -129,6 +130,10 @@ void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
     fprintf(stderr, "Error initiating ENB UL\n");
     return;
   }
+  if (phy->params.sequence_cache_mb) {
+    srslte_enb_dl_set_sequence_cache(&enb_dl, &phy->seq_cache);
+    srslte_enb_ul_set_sequence_cache(&enb_ul, &phy->seq_cache);
+  }
   
   /* Setup SI-RNTI in PHY */
   add_rnti(SRSLTE_SIRNTI);
@@ -143,6 +148,9 @@ void phch_worker::init(phch_common* phy_, srslte::log *log_h_)
 
   srslte_pucch_set_threshold(&enb_ul.pucch, 0.8);
   srslte_sch_set_max_noi(&enb_ul.pusch.ul_sch, phy->params.pusch_max_its);
+  if (phy->params.nof_fec_threads) {
+    srslte_sch_set_fec_pool(&enb_ul.pusch.ul_sch, &phy->fec_pool);
+  }
   srslte_enb_dl_set_amp(&enb_dl, phy->params.tx_amplitude);
   
   Info("Worker %d configured cell %d PRB\n", get_id(), phy->cell.nof_prb);
@@ -184,7 +192,7 @@ cf_t* phch_worker::get_buffer_rx(uint32_t antenna_idx)
   return signal_buffer_rx[antenna_idx];
 }
 
-void phch_worker::set_time(uint32_t tti_, uint32_t tx_mutex_cnt_, srslte_timestamp_t tx_time_)
+void phch_worker::set_time(uint32_t tti_, uint32_t sf_seq_, srslte_timestamp_t tx_time_, struct timeval rx_end_)
 {
   tti_rx       = tti_; 
   tti_tx_dl    = TTI_TX(tti_rx);
@@ -197,8 +205,9 @@ void phch_worker::set_time(uint32_t tti_, uint32_t tx_mutex_cnt_, srslte_timesta
   t_rx         = TTIMOD(tti_rx);
   t_tx_ul      = TTIMOD(tti_tx_ul);
 
-  tx_mutex_cnt = tx_mutex_cnt_;
+  sf_seq       = sf_seq_;
   memcpy(&tx_time, &tx_time_, sizeof(srslte_timestamp_t));
+  rx_end       = rx_end_;
 }
 
 int phch_worker::add_rnti(uint16_t rnti)
@@ -365,43 +374,38 @@ void phch_worker::work_imp()
 
   // Process UL signal
   srslte_enb_ul_fft(&enb_ul);
+  stage_end(PHY_STAGE_UL_FFT);
 
   // Decode pending UL grants for the tti they were scheduled
   decode_pusch(ul_grants[t_rx].sched_grants, ul_grants[t_rx].nof_grants);
 
   // Decode remaining PUCCH ACKs not associated with PUSCH transmission and SR signals
   decode_pucch();
+  stage_end(PHY_STAGE_UL_DECODE);
+
+  // MAC scheduling and pending ACKs follow the TTI order. The rest of the DL
+  // processing overlaps with the other workers
+  if (!phy->pipeline.enter(phch_common::SECTION_DL_SCHED, sf_seq)) {
+    goto unlock;
+  }
 
   // Get DL scheduling for the TX TTI from MAC
   if (mac->get_dl_sched(tti_tx_dl, &dl_grants[t_tx_dl]) < 0) {
     Error("Getting DL scheduling from MAC\n");
-    goto unlock;
+    goto drop;
   }
 
   if (dl_grants[t_tx_dl].cfi < 1 || dl_grants[t_tx_dl].cfi > 3) {
     Error("Invalid CFI=%d\n", dl_grants[t_tx_dl].cfi);
-    goto unlock;
+    goto drop;
   }
 
   // Get UL scheduling for the TX TTI from MAC
   if (mac->get_ul_sched(tti_tx_ul, &ul_grants[t_tx_ul]) < 0) {
     Error("Getting UL scheduling from MAC\n");
-    goto unlock;
+    goto drop;
   }
 
-  // Put base signals (references, PBCH, PCFICH and PSS/SSS) into the resource grid
-  srslte_enb_dl_clear_sf(&enb_dl);
-  srslte_enb_dl_set_cfi(&enb_dl, dl_grants[t_tx_dl].cfi);
-  srslte_enb_dl_put_base(&enb_dl, tti_tx_dl);
-
-  // Put UL/DL grants to resource grid. PDSCH data will be encoded as well.
-  encode_pdcch_dl(dl_grants[t_tx_dl].sched_grants, dl_grants[t_tx_dl].nof_grants);
-  encode_pdcch_ul(ul_grants[t_tx_ul].sched_grants, ul_grants[t_tx_ul].nof_grants);
-  encode_pdsch(dl_grants[t_tx_dl].sched_grants, dl_grants[t_tx_dl].nof_grants);
-
-  // Put pending PHICH HARQ ACK/NACK indications into subframe
-  encode_phich(ul_grants[t_tx_ul].phich, ul_grants[t_tx_ul].nof_phich);
-
   // Prepare for receive ACK for DL grants in t_tx_dl+4
   phy->ue_db_clear(TTIMOD(TTI_TX(t_tx_dl)));
   for (uint32_t i=0;i<dl_grants[t_tx_dl].nof_grants;i++) {
@@ -420,11 +424,27 @@ void phch_worker::work_imp()
       }
     }
   }
+  phy->pipeline.leave(phch_common::SECTION_DL_SCHED, sf_seq);
+
+  // Put base signals (references, PBCH, PCFICH and PSS/SSS) into the resource grid
+  srslte_enb_dl_clear_sf(&enb_dl);
+  srslte_enb_dl_set_cfi(&enb_dl, dl_grants[t_tx_dl].cfi);
+  srslte_enb_dl_put_base(&enb_dl, tti_tx_dl);
+
+  // Put UL/DL grants to resource grid. PDSCH data will be encoded as well.
+  encode_pdcch_dl(dl_grants[t_tx_dl].sched_grants, dl_grants[t_tx_dl].nof_grants);
+  encode_pdcch_ul(ul_grants[t_tx_ul].sched_grants, ul_grants[t_tx_ul].nof_grants);
+  encode_pdsch(dl_grants[t_tx_dl].sched_grants, dl_grants[t_tx_dl].nof_grants);
+
+  // Put pending PHICH HARQ ACK/NACK indications into subframe
+  encode_phich(ul_grants[t_tx_ul].phich, ul_grants[t_tx_ul].nof_phich);
 
   // Generate signal and transmit
   srslte_enb_dl_gen_signal(&enb_dl);
+  stage_end(PHY_STAGE_DL_ENCODE);
   Debug("Sending to radio\n");
-  phy->worker_end(tx_mutex_cnt, signal_buffer_tx, SRSLTE_SF_LEN_PRB(phy->cell.nof_prb), tx_time);
+  phy->worker_end(sf_seq, signal_buffer_tx, SRSLTE_SF_LEN_PRB(phy->cell.nof_prb), tx_time);
+  stage_end(PHY_STAGE_TX);
 
 #ifdef DEBUG_WRITE_FILE
   fwrite(signal_buffer_tx, SRSLTE_SF_LEN_PRB(phy->cell.nof_prb)*sizeof(cf_t), 1, f);
@@ -444,11 +464,28 @@ void phch_worker::work_imp()
   }
 #endif
 
+  goto unlock;
+
+drop:
+  // Do not transmit this subframe but let the following ones through
+  phy->pipeline.leave(phch_common::SECTION_DL_SCHED, sf_seq);
+  phy->pipeline.skip(sf_seq, phch_common::SECTION_TX);
+
 unlock:
   pthread_mutex_unlock(&mutex);
 
 }
 
+void phch_worker::stage_end(phy_stage_t stage)
+{
+  const static char *stage_names[PHY_NOF_STAGES] = {"UL FFT", "UL decode", "DL encode", "TX"};
+  uint32_t finish_us = 0;
+  if (phy->pipeline.stage_end(stage, &rx_end, &finish_us)) {
+    Warning("TTI %d: %s finished %d us after RX, budget %d us\n",
+            tti_rx, stage_names[stage], finish_us, phy->pipeline.get_budget_us(stage));
+  }
+}
+
 
 int phch_worker::decode_pusch(srslte_enb_ul_pusch_t *grants, uint32_t nof_pusch)
 {
@@ -48,7 +48,6 @@ namespace srsenb {
 
 phy::phy() : workers_pool(MAX_WORKERS), 
              workers(MAX_WORKERS), 
-             workers_common(txrx::MUTEX_X_WORKER*MAX_WORKERS),
              nof_workers(0)
 {
   radio_handler = NULL;
@@ -129,6 +128,9 @@ bool phy::init(phy_args_t *args,
   
   prach.init(&cfg->cell, &prach_cfg, mac, (srslte::log*) log_vec[0], PRACH_WORKER_THREAD_PRIO);
   prach.set_max_prach_offset_us(args->max_prach_offset_us);
+  if (workers_common.params.nof_fec_threads) {
+    prach.set_fec_pool(&workers_common.fec_pool);
+  }
   
   // Warning this must be initialized after all workers have been added to the pool
   tx_rx.init(radio_handler, &workers_pool, &workers_common, &prach, (srslte::log*) log_vec[0], SF_RECV_THREAD_PRIO);
@@ -145,6 +147,8 @@ void phy::stop()
   }
   workers_pool.stop();
   prach.stop();
+  srslte_sequence_cache_free(&workers_common.seq_cache);
+  srslte_fec_pool_free(&workers_common.fec_pool);
 }
 
 uint32_t phy::tti_to_SFN(uint32_t tti) {
@@ -179,6 +183,11 @@ void phy::rem_rnti(uint16_t rnti)
   }
 }
 
+void phy::get_pipeline_metrics(phy_pipeline_metrics_t *metrics)
+{
+  workers_common.pipeline.get_metrics(metrics->stage);
+}
+
 void phy::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
 {
   phy_metrics_t metrics_tmp[ENB_METRICS_MAX_USERS];
@@ -86,6 +86,13 @@ void prach_worker::set_max_prach_offset_us(float delay_us)
   max_prach_offset_us = delay_us; 
 }
 
+void prach_worker::set_fec_pool(srslte_fec_pool_t *pool)
+{
+  if (srslte_prach_set_fec_pool(&prach, pool)) {
+    fprintf(stderr, "Error setting PRACH FEC pool\n");
+  }
+}
+
 int prach_worker::new_tti(uint32_t tti_rx, cf_t* buffer_rx)
 {
   // Save buffer only if it's a PRACH TTI
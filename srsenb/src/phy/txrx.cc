@@ -42,7 +42,7 @@ using namespace std;
 
 namespace srsenb {
 
-txrx::txrx() : tx_mutex_cnt(0), nof_tx_mutex(0), tti(0) {
+txrx::txrx() : sf_seq(0), tti(0) {
   running = false;   
   radio_h = NULL; 
   log_h   = NULL; 
@@ -58,11 +58,8 @@ bool txrx::init(srslte::radio* radio_h_, srslte::thread_pool* workers_pool_, phc
   workers_pool = workers_pool_;
   worker_com   = worker_com_;
   prach        = prach_; 
-  tx_mutex_cnt = 0; 
+  sf_seq       = 0; 
   running      = true; 
-  
-  nof_tx_mutex = MUTEX_X_WORKER*workers_pool->get_nof_workers();
-  worker_com->set_nof_mutex(nof_tx_mutex);
     
   start(prio_);
   return true; 
@@ -79,6 +76,7 @@ void txrx::run_thread()
   phch_worker *worker = NULL;
   cf_t *buffer[SRSLTE_MAX_PORTS] = {NULL};
   srslte_timestamp_t rx_time, tx_time; 
+  struct timeval rx_end; 
   uint32_t sf_len = SRSLTE_SF_LEN_PRB(worker_com->cell.nof_prb);
   
   float samp_rate = srslte_sampling_freq_hz(worker_com->cell.nof_prb);
@@ -120,18 +118,19 @@ void txrx::run_thread()
       }
       
       radio_h->rx_now((void **) buffer, sf_len, &rx_time);
+      gettimeofday(&rx_end, NULL);
                     
       /* Compute TX time: Any transmission happens in TTI+4 thus advance 4 ms the reception time */
       srslte_timestamp_copy(&tx_time, &rx_time);
       srslte_timestamp_add(&tx_time, 0, HARQ_DELAY_MS*1e-3);
       
-      Debug("Settting TTI=%d, tx_mutex=%d, tx_time=%ld:%f to worker %d\n", 
-            tti, tx_mutex_cnt, 
+      Debug("Settting TTI=%d, sf_seq=%d, tx_time=%ld:%f to worker %d\n", 
+            tti, sf_seq, 
             tx_time.full_secs, tx_time.frac_secs,
             worker->get_id());
       
-      worker->set_time(tti, tx_mutex_cnt, tx_time);
-      tx_mutex_cnt = (tx_mutex_cnt+1)%nof_tx_mutex;
+      worker->set_time(tti, sf_seq, tx_time, rx_end);
+      sf_seq++;
       
       // Trigger phy worker execution
       workers_pool->start_worker(worker);       
@@ -29,11 +29,31 @@
 #include <sys/socket.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <stdlib.h>
+#include <arpa/inet.h>
 
 using namespace srslte;
 
 namespace srsenb {
-  
+
+gtpu::gtpu() : pool(NULL), running(false), run_enable(false), pdcp(NULL), gtpu_log(NULL),
+               snk_fd(0), src_fd(0), tx_flusher(this), tx_nof_pdus(0)
+{
+  bzero(tx_msg, sizeof(tx_msg));
+  bzero(tx_addr, sizeof(tx_addr));
+  bzero(rx_msg, sizeof(rx_msg));
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    tx_pdus[i] = NULL;
+    tx_msg[i].msg_hdr.msg_name    = &tx_addr[i];
+    tx_msg[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+    tx_msg[i].msg_hdr.msg_iov     = &tx_iov[i];
+    tx_msg[i].msg_hdr.msg_iovlen  = 1;
+    rx_pdus[i] = NULL;
+    rx_msg[i].msg_hdr.msg_iov     = &rx_iov[i];
+    rx_msg[i].msg_hdr.msg_iovlen  = 1;
+  }
+}
+
 bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, srsenb::pdcp_interface_gtpu* pdcp_, srslte::log* gtpu_log_)
 {
   pdcp          = pdcp_;
@@ -42,6 +62,7 @@ bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, srsenb::pdcp_
   mme_addr      = mme_addr_;
 
   pthread_mutex_init(&mutex, NULL); 
+  pthread_mutex_init(&tx_mutex, NULL);
   
   pool          = byte_buffer_pool::get_instance();
 
@@ -92,7 +113,8 @@ bool gtpu::init(std::string gtp_bind_addr_, std::string mme_addr_, srsenb::pdcp_
     return false;
   }
 
-  // Setup a thread to receive packets from the src socket
+  // Setup a thread to receive packets from the src socket and one to flush the uplink queue
+  tx_flusher.start();
   start(THREAD_PRIO);
   return true;
 
@@ -114,6 +136,12 @@ void gtpu::stop()
     wait_thread_finish();
   }
 
+  // Send whatever is still queued
+  tx_flusher.stop();
+  pthread_mutex_lock(&tx_mutex);
+  flush_tx();
+  pthread_mutex_unlock(&tx_mutex);
+
   if (snk_fd) {
     close(snk_fd);
   }
@@ -125,24 +153,67 @@ void gtpu::stop()
 // gtpu_interface_pdcp
 void gtpu::write_pdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t* pdu)
 {
-  gtpu_log->info_hex(pdu->msg, pdu->N_bytes, "TX PDU, RNTI: 0x%x, LCID: %d, n_bytes=%d", rnti, lcid, pdu->N_bytes);
+  gtpu_log->debug_hex(pdu->msg, pdu->N_bytes, "TX PDU, RNTI: 0x%x, LCID: %d, n_bytes=%d", rnti, lcid, pdu->N_bytes);
+
+  uint32_t addr     = 0;
+  uint32_t teid_out = 0;
+  if (!tunnels.find(rnti, lcid, &addr, &teid_out)) {
+    gtpu_log->warning("No tunnel for UL PDU rnti=0x%x, lcid=%d - dropping packet\n", rnti, lcid);
+    pool->deallocate(pdu);
+    return;
+  }
+
   gtpu_header_t header;
   header.flags        = 0x30;
   header.message_type = 0xFF;
   header.length       = pdu->N_bytes;
-  header.teid         = rnti_bearers[rnti].teids_out[lcid];
+  header.teid         = teid_out;
+  if (!gtpu_write_header(&header, pdu)) {
+    pool->deallocate(pdu);
+    return;
+  }
 
-  struct sockaddr_in servaddr;
-  servaddr.sin_family      = AF_INET;
-  servaddr.sin_addr.s_addr = htonl(rnti_bearers[rnti].spgw_addrs[lcid]);
-  servaddr.sin_port        = htons(GTPU_PORT);
+  // Queue the PDU, it is sent within a TTI or as soon as the batch is full
+  pthread_mutex_lock(&tx_mutex);
+  uint32_t i = tx_nof_pdus++;
+  tx_pdus[i]                 = pdu;
+  tx_addr[i].sin_family      = AF_INET;
+  tx_addr[i].sin_addr.s_addr = htonl(addr);
+  tx_addr[i].sin_port        = htons(GTPU_PORT);
+  tx_iov[i].iov_base         = pdu->msg;
+  tx_iov[i].iov_len          = pdu->N_bytes;
+  if (tx_nof_pdus == BATCH_SIZE) {
+    flush_tx();
+  }
+  pthread_mutex_unlock(&tx_mutex);
+}
 
-  gtpu_write_header(&header, pdu);
-  if (sendto(snk_fd, pdu->msg, pdu->N_bytes, MSG_EOR, (struct sockaddr*)&servaddr, sizeof(struct sockaddr_in))<0) {
-    perror("sendto");
+void gtpu::flush()
+{
+  pthread_mutex_lock(&tx_mutex);
+  if (tx_nof_pdus > 0) {
+    flush_tx();
   }
+  pthread_mutex_unlock(&tx_mutex);
+}
 
-  pool->deallocate(pdu);
+// Must be called with tx_mutex locked
+void gtpu::flush_tx()
+{
+  uint32_t nof_sent = 0;
+  while (nof_sent < tx_nof_pdus) {
+    int n = sendmmsg(snk_fd, &tx_msg[nof_sent], tx_nof_pdus - nof_sent, 0);
+    if (n <= 0) {
+      gtpu_log->error("Failed to send %d UL PDUs: %s\n", tx_nof_pdus - nof_sent, strerror(errno));
+      break;
+    }
+    nof_sent += n;
+  }
+  for (uint32_t i = 0; i < tx_nof_pdus; i++) {
+    pool->deallocate(tx_pdus[i]);
+    tx_pdus[i] = NULL;
+  }
+  tx_nof_pdus = 0;
 }
 
 // gtpu_interface_rrc
@@ -152,106 +223,179 @@ void gtpu::add_bearer(uint16_t rnti, uint32_t lcid, uint32_t addr, uint32_t teid
   rntilcid_to_teidin(rnti, lcid, teid_in);
   gtpu_log->info("Adding bearer for rnti: 0x%x, lcid: %d, addr: 0x%x, teid_out: 0x%x, teid_in: 0x%x\n", rnti, lcid, addr, teid_out, *teid_in);
 
-  // Initialize maps if it's a new RNTI
-  if(rnti_bearers.count(rnti) == 0) {
-    for(int i=0;i<SRSENB_N_RADIO_BEARERS;i++) {
-      rnti_bearers[rnti].teids_in[i]  = 0;
-      rnti_bearers[rnti].teids_out[i] = 0;
-      rnti_bearers[rnti].spgw_addrs[i] = 0;
-    }
+  pthread_mutex_lock(&mutex);
+  if (!tunnels.add(rnti, lcid, addr, teid_out)) {
+    gtpu_log->error("Failed to add bearer for rnti: 0x%x, lcid: %d\n", rnti, lcid);
   }
-
-  rnti_bearers[rnti].teids_in[lcid]  = *teid_in;
-  rnti_bearers[rnti].teids_out[lcid] = teid_out;
-  rnti_bearers[rnti].spgw_addrs[lcid] = addr;
+  pthread_mutex_unlock(&mutex);
 }
 
 void gtpu::rem_bearer(uint16_t rnti, uint32_t lcid)
 {
   gtpu_log->info("Removing bearer for rnti: 0x%x, lcid: %d\n", rnti, lcid);
 
-  rnti_bearers[rnti].teids_in[lcid]  = 0;
-  rnti_bearers[rnti].teids_out[lcid] = 0;
-
-  // Remove RNTI if all bearers are removed
-  bool rem = true;
-  for(int i=0;i<SRSENB_N_RADIO_BEARERS; i++) {
-    if(rnti_bearers[rnti].teids_in[i] != 0) {
-      rem = false;
-    }
-  }
-  if(rem) {
-    rnti_bearers.erase(rnti);
-  }
+  pthread_mutex_lock(&mutex);
+  tunnels.rem(rnti, lcid);
+  pthread_mutex_unlock(&mutex);
 }
 
 void gtpu::rem_user(uint16_t rnti)
 {
   pthread_mutex_lock(&mutex); 
-  rnti_bearers.erase(rnti);
+  tunnels.rem_user(rnti);
   pthread_mutex_unlock(&mutex); 
 }
 
 void gtpu::run_thread()
 {
-  byte_buffer_t *pdu = pool_allocate;
-  if (!pdu) {
-    gtpu_log->error("Fatal Error: Couldn't allocate buffer in gtpu::run_thread().\n");
-    return;
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    rx_pdus[i] = pool_allocate;
+    if (!rx_pdus[i]) {
+      gtpu_log->error("Fatal Error: Couldn't allocate buffer in gtpu::run_thread().\n");
+      return;
+    }
+    rx_iov[i].iov_base = rx_pdus[i]->msg;
+    rx_iov[i].iov_len  = SRSENB_MAX_BUFFER_SIZE_BYTES - SRSENB_BUFFER_HEADER_OFFSET;
   }
   run_enable = true;
 
   running=true; 
   while(run_enable) {
 
-    pdu->reset();
     gtpu_log->debug("Waiting for read...\n");
     int n = 0;
     do{
-      n = recv(src_fd, pdu->msg, SRSENB_MAX_BUFFER_SIZE_BYTES - SRSENB_BUFFER_HEADER_OFFSET, 0);
+      n = recvmmsg(src_fd, rx_msg, BATCH_SIZE, MSG_WAITFORONE, NULL);
     } while (n == -1 && errno == EAGAIN);
 
     if (n < 0) {
-        gtpu_log->error("Failed to read from socket\n");
-    }
-
-    pdu->N_bytes = (uint32_t) n;
-    
-    gtpu_header_t header;
-    gtpu_read_header(pdu, &header);
-
-    uint16_t rnti = 0;
-    uint16_t lcid = 0;
-    teidin_to_rntilcid(header.teid, &rnti, &lcid);
-
-    pthread_mutex_lock(&mutex); 
-    bool user_exists = (rnti_bearers.count(rnti) > 0);
-    pthread_mutex_unlock(&mutex); 
-    
-    if(!user_exists) {
-      gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti);
+      gtpu_log->error("Failed to read from socket\n");
       continue;
     }
 
-    if(lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
-      gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
-      continue;
-    }
+    for (int i = 0; i < n; i++) {
+      byte_buffer_t *pdu = rx_pdus[i];
+      pdu->N_bytes = rx_msg[i].msg_len;
+
+      gtpu_header_t header;
+      if (pdu->N_bytes < GTPU_HEADER_LEN || !gtpu_read_header(pdu, &header)) {
+        continue;
+      }
+
+      uint16_t rnti = 0;
+      uint16_t lcid = 0;
+      teidin_to_rntilcid(header.teid, &rnti, &lcid);
 
-    gtpu_log->info_hex(pdu->msg, pdu->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d, n_bytes=%d", rnti, lcid, pdu->N_bytes);
+      if(lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
+        gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
+        continue;
+      }
 
-    pdcp->write_sdu(rnti, lcid, pdu);
-    do {
-      pdu = pool_allocate;
-      if (!pdu) {
-        gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
-        usleep(10000);
+      if(!tunnels.find(rnti, lcid, NULL, NULL)) {
+        gtpu_log->error("Unrecognized RNTI for DL PDU: 0x%x - dropping packet\n", rnti);
+        continue;
       }
-    } while(!pdu); 
+
+      gtpu_log->debug_hex(pdu->msg, pdu->N_bytes, "RX GTPU PDU rnti=0x%x, lcid=%d, n_bytes=%d", rnti, lcid, pdu->N_bytes);
+
+      pdcp->write_sdu(rnti, lcid, pdu);
+      do {
+        rx_pdus[i] = pool_allocate;
+        if (!rx_pdus[i]) {
+          gtpu_log->console("GTPU Buffer pool empty. Trying again...\n");
+          usleep(10000);
+        }
+      } while(!rx_pdus[i]);
+    }
+
+    // Rearm the buffers used by this batch
+    for (int i = 0; i < n; i++) {
+      rx_pdus[i]->reset();
+      rx_iov[i].iov_base = rx_pdus[i]->msg;
+    }
+  }
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    pool->deallocate(rx_pdus[i]);
+    rx_pdus[i] = NULL;
   }
   running=false;
 }
 
+/****************************************************************************
+ * RNTI/LCID to tunnel table
+ ***************************************************************************/
+gtpu::tunnel_table::tunnel_table()
+{
+  for (uint32_t i = 0; i < NOF_PAGES; i++) {
+    pages[i] = NULL;
+  }
+}
+
+gtpu::tunnel_table::~tunnel_table()
+{
+  for (uint32_t i = 0; i < NOF_PAGES; i++) {
+    if (pages[i]) {
+      free(pages[i]);
+    }
+  }
+}
+
+bool gtpu::tunnel_table::add(uint16_t rnti, uint32_t lcid, uint32_t addr, uint32_t teid_out)
+{
+  if (lcid >= SRSENB_N_RADIO_BEARERS) {
+    return false;
+  }
+  uint32_t p = rnti / PAGE_SIZE;
+  if (!pages[p]) {
+    user_t *page = (user_t*) calloc(PAGE_SIZE, sizeof(user_t));
+    if (!page) {
+      return false;
+    }
+    // Make the zeroed page visible before the pointer to it
+    __sync_synchronize();
+    pages[p] = page;
+  }
+  pages[p][rnti % PAGE_SIZE].tunnels[lcid] = ((uint64_t) teid_out << 32) | addr;
+  return true;
+}
+
+void gtpu::tunnel_table::rem(uint16_t rnti, uint32_t lcid)
+{
+  user_t *page = pages[rnti / PAGE_SIZE];
+  if (page && lcid < SRSENB_N_RADIO_BEARERS) {
+    page[rnti % PAGE_SIZE].tunnels[lcid] = 0;
+  }
+}
+
+void gtpu::tunnel_table::rem_user(uint16_t rnti)
+{
+  user_t *page = pages[rnti / PAGE_SIZE];
+  if (page) {
+    for (uint32_t i = 0; i < SRSENB_N_RADIO_BEARERS; i++) {
+      page[rnti % PAGE_SIZE].tunnels[i] = 0;
+    }
+  }
+}
+
+bool gtpu::tunnel_table::find(uint16_t rnti, uint32_t lcid, uint32_t *addr, uint32_t *teid_out)
+{
+  user_t *page = pages[rnti / PAGE_SIZE];
+  if (!page || lcid >= SRSENB_N_RADIO_BEARERS) {
+    return false;
+  }
+  uint64_t e = page[rnti % PAGE_SIZE].tunnels[lcid];
+  if (!e) {
+    return false;
+  }
+  if (addr) {
+    *addr = (uint32_t) (e & 0xFFFFFFFF);
+  }
+  if (teid_out) {
+    *teid_out = (uint32_t) (e >> 32);
+  }
+  return true;
+}
+
 /****************************************************************************
  * Header pack/unpack helper functions
  * Ref: 3GPP TS 29.281 v10.1.0 Section 5
@@ -557,9 +557,7 @@ void rrc::parse_ul_ccch(uint16_t rnti, byte_buffer_t *pdu)
     LIBLTE_RRC_UL_CCCH_MSG_STRUCT ul_ccch_msg;
     bzero(&ul_ccch_msg, sizeof(LIBLTE_RRC_UL_CCCH_MSG_STRUCT));
 
-    srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-    bit_buf.N_bits = pdu->N_bytes * 8;
-    liblte_rrc_unpack_ul_ccch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &ul_ccch_msg);
+    liblte_rrc_unpack_ul_ccch_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &ul_ccch_msg);
 
     rrc_log->info_hex(pdu->msg, pdu->N_bytes,
                       "SRB0 - Rx: %s",
@@ -818,9 +816,7 @@ void rrc::ue::parse_ul_dcch(uint32_t lcid, byte_buffer_t *pdu)
   LIBLTE_RRC_UL_DCCH_MSG_STRUCT ul_dcch_msg;
   bzero(&ul_dcch_msg, sizeof(LIBLTE_RRC_UL_DCCH_MSG_STRUCT));
   
-  srslte_bit_unpack_vector(pdu->msg, parent->bit_buf.msg, pdu->N_bytes*8);
-  parent->bit_buf.N_bits = pdu->N_bytes*8;
-  liblte_rrc_unpack_ul_dcch_msg((LIBLTE_BIT_MSG_STRUCT*)&parent->bit_buf, &ul_dcch_msg);
+  liblte_rrc_unpack_ul_dcch_msg((LIBLTE_BYTE_MSG_STRUCT*)pdu, &ul_dcch_msg);
 
   parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                       "%s - Rx %s\n", 
@@ -1586,9 +1582,7 @@ void rrc::ue::send_dl_ccch(LIBLTE_RRC_DL_CCCH_MSG_STRUCT *dl_ccch_msg)
   // Allocate a new PDU buffer, pack the message and send to PDCP 
   byte_buffer_t *pdu = parent->pool->allocate(__FUNCTION__);
   if (pdu) {
-    liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    liblte_rrc_pack_dl_ccch_msg(dl_ccch_msg, (LIBLTE_BYTE_MSG_STRUCT*) pdu);
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB0 - rnti=0x%x, Sending: %s\n",
                           rnti,
@@ -1607,9 +1601,7 @@ void rrc::ue::send_dl_dcch(LIBLTE_RRC_DL_DCCH_MSG_STRUCT *dl_dcch_msg, byte_buff
     pdu = parent->pool->allocate(__FUNCTION__);
   }
   if (pdu) {
-    liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, (LIBLTE_BIT_MSG_STRUCT*) &parent->bit_buf);
-    srslte_bit_pack_vector(parent->bit_buf.msg, pdu->msg, parent->bit_buf.N_bits);
-    pdu->N_bytes = 1+(parent->bit_buf.N_bits-1)/8;
+    liblte_rrc_pack_dl_dcch_msg(dl_dcch_msg, (LIBLTE_BYTE_MSG_STRUCT*) pdu);
     parent->rrc_log->info_hex(pdu->msg, pdu->N_bytes, 
                           "SRB1 - rnti=0x%x, Sending: %s\n",
                           rnti,
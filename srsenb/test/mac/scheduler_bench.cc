@@ -0,0 +1,349 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Drives sched::dl_sched()/ul_sched() with many synthetic full-buffer UEs and
+ * reports cell throughput, Jain's fairness index and per-TTI scheduling time
+ * for each scheduling metric. With -s the per-TTI scheduling time is measured
+ * for an increasing number of connected UEs. With -c only the PDCCH allocator
+ * is run, allocating DCIs of random UEs each TTI, to compare the PDCCH blocking
+ * rate and allocation time of the greedy and the backtracking allocation.
+ */
+
+#include <unistd.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "srsenb/hdr/mac/mac.h"
+#include "srslte/interfaces/sched_interface.h"
+#include "srslte/common/log_filter.h"
+#include "srslte/phy/utils/debug.h"
+
+uint32_t nof_ues  = 100;
+uint32_t nof_ttis = 10000;
+uint32_t nof_prb  = 25;
+char    *metric   = NULL;
+bool     sweep    = false;
+uint32_t nof_dci  = 0;
+
+void usage(char *prog) {
+  printf("Usage: %s [upmts]\n", prog);
+  printf("\t-u number of UEs [Default %d]\n", nof_ues);
+  printf("\t-t number of TTIs [Default %d]\n", nof_ttis);
+  printf("\t-p number of PRB [Default %d]\n", nof_prb);
+  printf("\t-m metric rr, pf or mt [Default all]\n");
+  printf("\t-s sweep the number of UEs and report scheduling time only\n");
+  printf("\t-c DCIs per TTI, runs the PDCCH allocator only [Default off]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "upmtsc")) != -1) {
+    switch(opt) {
+    case 'u':
+      nof_ues = (uint32_t) atoi(argv[optind]);
+      break;
+    case 't':
+      nof_ttis = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'p':
+      nof_prb = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'm':
+      metric = argv[optind];
+      break;
+    case 's':
+      sweep = true;
+      break;
+    case 'c':
+      nof_dci = (uint32_t) atoi(argv[optind]);
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  float    dl_mbps;
+  float    ul_mbps;
+  float    dl_fairness;
+  float    ul_fairness;
+  float    mean_tti_us;
+  uint32_t max_tti_us;
+  float    pdcch_blocking;
+} bench_result_t;
+
+// Jain's fairness index
+float fairness(std::vector<uint64_t> &bits)
+{
+  double sum = 0, sum2 = 0;
+  for (uint32_t i=0;i<bits.size();i++) {
+    sum  += bits[i];
+    sum2 += (double) bits[i]*bits[i];
+  }
+  return sum2>0?(float) (sum*sum/(bits.size()*sum2)):0;
+}
+
+void run_bench(srsenb::sched::metric_dl *dl_metric, srsenb::sched::metric_ul *ul_metric, bench_result_t *res)
+{
+  srslte::log_filter log_out("SCHED");
+  log_out.set_level(srslte::LOG_LEVEL_NONE);
+
+  srsenb::sched my_sched;
+
+  srsenb::sched_interface::cell_cfg_t cell_cfg;
+  bzero(&cell_cfg, sizeof(srsenb::sched_interface::cell_cfg_t));
+  cell_cfg.cell.id              = 1;
+  cell_cfg.cell.cp              = SRSLTE_CP_NORM;
+  cell_cfg.cell.nof_ports       = 1;
+  cell_cfg.cell.nof_prb         = nof_prb;
+  cell_cfg.cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell_cfg.cell.phich_resources = SRSLTE_PHICH_R_1;
+  cell_cfg.si_window_ms         = 40;
+  cell_cfg.maxharq_msg3tx       = 4;
+
+  srsenb::sched_interface::sched_args_t sched_args;
+  sched_args.pdsch_mcs        = -1;
+  sched_args.pdsch_max_mcs    = -1;
+  sched_args.pusch_mcs        = -1;
+  sched_args.pusch_max_mcs    = -1;
+  sched_args.nof_ctrl_symbols = 3;
+
+  my_sched.init(NULL, &log_out);
+  my_sched.set_metric(dl_metric, ul_metric);
+  my_sched.set_sched_cfg(&sched_args);
+  my_sched.cell_cfg(&cell_cfg);
+
+  srsenb::sched_interface::ue_cfg_t ue_cfg;
+  bzero(&ue_cfg, sizeof(srsenb::sched_interface::ue_cfg_t));
+  ue_cfg.maxharq_tx = 4;
+
+  srsenb::sched_interface::ue_bearer_cfg_t bearer_cfg;
+  bzero(&bearer_cfg, sizeof(srsenb::sched_interface::ue_bearer_cfg_t));
+  bearer_cfg.direction = srsenb::sched_interface::ue_bearer_cfg_t::BOTH;
+
+  // UEs with a static random channel quality
+  srand(0);
+  std::vector<uint16_t> rntis(nof_ues);
+  for (uint32_t i=0;i<nof_ues;i++) {
+    rntis[i] = 0x46 + i;
+    my_sched.ue_cfg(rntis[i], &ue_cfg);
+    my_sched.bearer_ue_cfg(rntis[i], 3, &bearer_cfg);
+    my_sched.dl_cqi_info(0, rntis[i], 1 + rand()%15);
+    my_sched.ul_cqi_info(0, rntis[i], 1 + rand()%15, 0);
+  }
+
+  std::map<uint16_t, uint32_t> ue_index;
+  for (uint32_t i=0;i<nof_ues;i++) {
+    ue_index[rntis[i]] = i;
+  }
+
+  std::vector<uint64_t> dl_bits(nof_ues, 0);
+  std::vector<uint64_t> ul_bits(nof_ues, 0);
+  srsenb::sched_interface::dl_sched_res_t dl_res;
+  srsenb::sched_interface::ul_sched_res_t ul_res;
+  struct timeval t[3];
+  uint64_t total_us = 0;
+  res->max_tti_us   = 0;
+
+  for (uint32_t tti=0;tti<nof_ttis;tti++) {
+    // Keep all buffers full
+    for (uint32_t i=0;i<nof_ues;i++) {
+      my_sched.dl_rlc_buffer_state(rntis[i], 3, 1000000, 0);
+      my_sched.ul_bsr(rntis[i], 3, 1000000);
+    }
+
+    gettimeofday(&t[1], NULL);
+    my_sched.dl_sched(tti, &dl_res);
+    my_sched.ul_sched(tti, &ul_res);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    uint32_t us = t[0].tv_sec*1000000+t[0].tv_usec;
+    total_us += us;
+    if (us > res->max_tti_us) {
+      res->max_tti_us = us;
+    }
+
+    // Account throughput and acknowledge all transmissions
+    for (uint32_t i=0;i<dl_res.nof_data_elems;i++) {
+      uint16_t rnti = dl_res.data[i].rnti;
+      for (uint32_t tb=0;tb<SRSLTE_MAX_TB;tb++) {
+        if (dl_res.data[i].tbs[tb] > 0) {
+          dl_bits[ue_index[rnti]] += 8*dl_res.data[i].tbs[tb];
+          my_sched.dl_ack_info(TTI_TX(tti), rnti, tb, true);
+        }
+      }
+    }
+    for (uint32_t i=0;i<ul_res.nof_dci_elems;i++) {
+      uint16_t rnti = ul_res.pusch[i].rnti;
+      ul_bits[ue_index[rnti]] += 8*ul_res.pusch[i].tbs;
+      my_sched.ul_crc_info(tti, rnti, true);
+    }
+  }
+
+  uint64_t dl_total = 0, ul_total = 0;
+  for (uint32_t i=0;i<nof_ues;i++) {
+    dl_total += dl_bits[i];
+    ul_total += ul_bits[i];
+  }
+  res->dl_mbps     = (float) dl_total/nof_ttis/1000;
+  res->ul_mbps     = (float) ul_total/nof_ttis/1000;
+  res->dl_fairness = fairness(dl_bits);
+  res->ul_fairness = fairness(ul_bits);
+  res->mean_tti_us = (float) total_us/nof_ttis;
+
+  srsenb::sched_pdcch::metrics_t pdcch_metrics;
+  my_sched.get_pdcch_metrics(&pdcch_metrics);
+  res->pdcch_blocking = pdcch_metrics.nof_req?(float) pdcch_metrics.nof_blocked/pdcch_metrics.nof_req:0;
+}
+
+void run_pdcch_bench(uint32_t cfi, bool backtracking, float *blocking, float *moved, float *mean_us)
+{
+  srslte_cell_t cell;
+  bzero(&cell, sizeof(srslte_cell_t));
+  cell.id              = 1;
+  cell.cp              = SRSLTE_CP_NORM;
+  cell.nof_ports       = 1;
+  cell.nof_prb         = nof_prb;
+  cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell.phich_resources = SRSLTE_PHICH_R_1;
+
+  srslte_regs_t regs;
+  if (srslte_regs_init(&regs, cell)) {
+    exit(-1);
+  }
+
+  // UE search spaces and aggregation levels, 1 to 8 CCEs from the best to the worst channel
+  std::vector<srsenb::sched_ue::sched_dci_cce_t> locations(nof_ues*10);
+  std::vector<uint32_t> aggr_level(nof_ues);
+  srand(0);
+  for (uint32_t i=0;i<nof_ues;i++) {
+    for (uint32_t sf_idx=0;sf_idx<10;sf_idx++) {
+      srsenb::sched::generate_cce_location(&regs, &locations[i*10+sf_idx], cfi, sf_idx, 0x46 + i);
+    }
+    uint32_t r = rand()%10;
+    aggr_level[i] = r<4?0:(r<7?1:(r<9?2:3));
+  }
+
+  // The same DCI requests for both allocators
+  std::vector<uint32_t> requests(nof_ttis*nof_dci);
+  for (uint32_t i=0;i<requests.size();i++) {
+    requests[i] = rand()%nof_ues;
+  }
+
+  srsenb::sched_pdcch pdcch;
+  pdcch.set_backtracking(backtracking);
+  srslte_dci_location_t dci_location[srsenb::sched_pdcch::MAX_ALLOC];
+  struct timeval t[3];
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t tti=0;tti<nof_ttis;tti++) {
+    pdcch.new_tti(srslte_regs_pdcch_ncce(&regs, cfi));
+    for (uint32_t i=0;i<nof_dci && i<srsenb::sched_pdcch::MAX_ALLOC;i++) {
+      uint32_t ue = requests[tti*nof_dci+i];
+      pdcch.alloc(&dci_location[i], &locations[ue*10+tti%10], aggr_level[ue], tti);
+    }
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  srsenb::sched_pdcch::metrics_t m;
+  pdcch.get_metrics(&m);
+  *blocking = (float) m.nof_blocked/m.nof_req;
+  *moved    = (float) m.nof_moved/m.nof_req;
+  *mean_us  = (float) (t[0].tv_sec*1000000+t[0].tv_usec)/nof_ttis;
+  srslte_regs_free(&regs);
+}
+
+int main(int argc, char *argv[])
+{
+  parse_args(argc, argv);
+
+  const char *names[3] = {"rr", "pf", "mt"};
+  srsenb::dl_metric_rr dl_rr;
+  srsenb::ul_metric_rr ul_rr;
+  srsenb::dl_metric_pf dl_pf[2];
+  srsenb::ul_metric_pf ul_pf[2];
+  dl_pf[0].set_params(srsenb::METRIC_PF, 100);
+  ul_pf[0].set_params(srsenb::METRIC_PF, 100);
+  dl_pf[1].set_params(srsenb::METRIC_MT, 100);
+  ul_pf[1].set_params(srsenb::METRIC_MT, 100);
+
+  if (nof_dci) {
+    printf("%d UEs, %d PRB, %d TTIs, %d DCIs per TTI\n", nof_ues, nof_prb, nof_ttis, nof_dci);
+    printf("cfi  allocator     blocking  moved/DCI  mean us/TTI\n");
+    for (uint32_t cfi=1;cfi<=3;cfi++) {
+      for (uint32_t b=0;b<2;b++) {
+        float blocking, moved, mean_us;
+        run_pdcch_bench(cfi, b>0, &blocking, &moved, &mean_us);
+        printf("%3d  %-12s  %7.2f%%  %9.3f  %11.2f\n", cfi, b?"backtracking":"greedy",
+               100*blocking, moved, mean_us);
+      }
+    }
+    exit(0);
+  }
+
+  if (sweep) {
+    const uint32_t sweep_ues[] = {1, 10, 50, 100, 200, 400, 800};
+    printf("%d PRB, %d TTIs\n", nof_prb, nof_ttis);
+    printf("metric   UEs  mean us/TTI  max us/TTI\n");
+    for (uint32_t m=0;m<3;m++) {
+      if (metric && strcmp(metric, names[m])) {
+        continue;
+      }
+      for (uint32_t n=0;n<sizeof(sweep_ues)/sizeof(uint32_t);n++) {
+        bench_result_t res;
+        nof_ues = sweep_ues[n];
+        if (m == 0) {
+          run_bench(&dl_rr, &ul_rr, &res);
+        } else {
+          run_bench(&dl_pf[m-1], &ul_pf[m-1], &res);
+        }
+        printf("%-6s  %4d  %11.1f  %10d\n", names[m], nof_ues, res.mean_tti_us, res.max_tti_us);
+      }
+    }
+    exit(0);
+  }
+
+  printf("%d UEs, %d PRB, %d TTIs\n", nof_ues, nof_prb, nof_ttis);
+  printf("metric  DL Mbps  UL Mbps  DL fairness  UL fairness  mean us/TTI  max us/TTI  PDCCH blocking\n");
+  for (uint32_t m=0;m<3;m++) {
+    if (metric && strcmp(metric, names[m])) {
+      continue;
+    }
+    bench_result_t res;
+    if (m == 0) {
+      run_bench(&dl_rr, &ul_rr, &res);
+    } else {
+      run_bench(&dl_pf[m-1], &ul_pf[m-1], &res);
+    }
+    printf("%-6s  %7.2f  %7.2f  %11.3f  %11.3f  %11.1f  %10d  %13.2f%%\n", names[m],
+           res.dl_mbps, res.ul_mbps, res.dl_fairness, res.ul_fairness, res.mean_tti_us, res.max_tti_us,
+           100*res.pdcch_blocking);
+  }
+  exit(0);
+}
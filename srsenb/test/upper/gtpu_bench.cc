@@ -0,0 +1,197 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsUE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsUE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Loopback benchmark of the eNB S1-U path. Uplink PDUs are written to
+ * gtpu::write_pdu() and sent to the SP-GW address, which is the eNB's own
+ * GTP-U socket. Each bearer's outgoing TEID is its incoming TEID, so every
+ * packet comes back as a downlink PDU and is counted by a PDCP stub. Reports
+ * packets per second and CPU seconds per Gbit of payload. PDUs are written
+ * in groups of -t per TTI, each group followed by flush().
+ */
+
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "srsenb/hdr/upper/gtpu.h"
+#include "srslte/common/log_filter.h"
+#include "srslte/common/logger_file.h"
+
+uint32_t nof_pkts = 1000000;
+uint32_t pkt_size = 1400;
+uint32_t nof_ues  = 16;
+uint32_t pkts_tti = 32;
+uint32_t window   = 1024;
+bool     log_info = false;
+
+void usage(char *prog) {
+  printf("Usage: %s [nsutwi]\n", prog);
+  printf("\t-n number of packets [Default %d]\n", nof_pkts);
+  printf("\t-s PDU size [Default %d]\n", pkt_size);
+  printf("\t-u number of UEs [Default %d]\n", nof_ues);
+  printf("\t-t packets per TTI [Default %d]\n", pkts_tti);
+  printf("\t-w maximum packets in flight [Default %d]\n", window);
+  printf("\t-i log at info level to /dev/null, as with the default all_level [Default warning]\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nsutwi")) != -1) {
+    switch(opt) {
+    case 'n':
+      nof_pkts = (uint32_t) atoi(argv[optind]);
+      break;
+    case 's':
+      pkt_size = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_ues = (uint32_t) atoi(argv[optind]);
+      break;
+    case 't':
+      pkts_tti = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'w':
+      window = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'i':
+      log_info = true;
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (pkts_tti == 0) {
+    pkts_tti = 1;
+  }
+}
+
+class pdcp_dummy : public srsenb::pdcp_interface_gtpu
+{
+public:
+  pdcp_dummy() : nof_pkts(0), nof_bytes(0) {
+    pool = srslte::byte_buffer_pool::get_instance();
+  }
+  void write_sdu(uint16_t rnti, uint32_t lcid, srslte::byte_buffer_t *sdu) {
+    nof_bytes += sdu->N_bytes;
+    __sync_synchronize();
+    nof_pkts++;
+    pool->deallocate(sdu);
+  }
+  volatile uint32_t nof_pkts;
+  uint64_t          nof_bytes;
+private:
+  srslte::byte_buffer_pool *pool;
+};
+
+static double cpu_time(long *nof_csw) {
+  struct rusage r;
+  getrusage(RUSAGE_SELF, &r);
+  *nof_csw = r.ru_nvcsw + r.ru_nivcsw;
+  return r.ru_utime.tv_sec + r.ru_stime.tv_sec + 1e-6 * (r.ru_utime.tv_usec + r.ru_stime.tv_usec);
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  srslte::logger_file logger;
+  srslte::log_filter  log_out;
+  logger.init("/dev/null");
+  log_out.init("GTPU", &logger);
+  log_out.set_level(log_info ? srslte::LOG_LEVEL_INFO : srslte::LOG_LEVEL_WARNING);
+  log_out.set_hex_limit(32);
+
+  srslte::byte_buffer_pool *pool = srslte::byte_buffer_pool::get_instance();
+  pdcp_dummy pdcp;
+  srsenb::gtpu gtpu;
+  if (!gtpu.init("127.0.0.1", "127.0.0.1", &pdcp, &log_out)) {
+    printf("Failed to start GTP-U\n");
+    exit(-1);
+  }
+
+  // Outgoing TEID equal to the incoming one makes every UL packet come back as DL
+  uint32_t addr = 0x7F000001;
+  for (uint32_t i = 0; i < nof_ues; i++) {
+    uint32_t teid_in = 0;
+    uint16_t rnti    = 0x46 + i;
+    gtpu.add_bearer(rnti, 3, addr, (rnti << 16) | 3, &teid_in);
+  }
+  usleep(100000);
+
+  struct timespec t[2];
+  clock_gettime(CLOCK_MONOTONIC, &t[0]);
+  long   csw_start = 0;
+  double cpu_start = cpu_time(&csw_start);
+
+  uint32_t nof_sent = 0;
+  while (nof_sent < nof_pkts) {
+    while (nof_sent - pdcp.nof_pkts >= window) {
+      usleep(100);
+    }
+    for (uint32_t i = 0; i < pkts_tti && nof_sent < nof_pkts; i++) {
+      srslte::byte_buffer_t *pdu = pool_allocate;
+      if (!pdu) {
+        printf("Buffer pool empty\n");
+        exit(-1);
+      }
+      memset(pdu->msg, 0xAB, pkt_size);
+      pdu->N_bytes = pkt_size;
+      gtpu.write_pdu(0x46 + nof_sent % nof_ues, 3, pdu);
+      nof_sent++;
+    }
+    gtpu.flush();
+  }
+
+  // Wait for the packets in flight, loopback UDP may still drop some
+  uint32_t last = pdcp.nof_pkts;
+  uint32_t idle = 0;
+  clock_gettime(CLOCK_MONOTONIC, &t[1]);
+  while (pdcp.nof_pkts < nof_sent && idle < 100) {
+    usleep(1000);
+    if (pdcp.nof_pkts != last) {
+      last = pdcp.nof_pkts;
+      idle = 0;
+      clock_gettime(CLOCK_MONOTONIC, &t[1]);
+    } else {
+      idle++;
+    }
+  }
+
+  long   csw_end = 0;
+  double cpu_s  = cpu_time(&csw_end) - cpu_start;
+  double wall_s = (t[1].tv_sec - t[0].tv_sec) + 1e-9 * (t[1].tv_nsec - t[0].tv_nsec);
+  double gbit   = 8e-9 * pdcp.nof_bytes;
+
+  printf("Sent %d PDUs of %d bytes, received %d\n", nof_sent, pkt_size, pdcp.nof_pkts);
+  printf("Rate: %.0f pps, %.2f Gbit/s, CPU: %.2f s per Gbit, %.2f context switches per packet\n",
+         pdcp.nof_pkts / wall_s, gbit / wall_s, gbit > 0 ? cpu_s / gbit : 0,
+         pdcp.nof_pkts > 0 ? (double) (csw_end - csw_start) / pdcp.nof_pkts : 0);
+
+  gtpu.stop();
+  exit(pdcp.nof_pkts > 0 ? 0 : -1);
+}
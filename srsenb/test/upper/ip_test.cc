@@ -583,11 +583,14 @@ int main(int argc, char *argv[])
   srsenb::phy_args_t phy_args; 
   
   mac_args.link_failure_nof_err = 10; 
+  mac_args.sched_metric = srsenb::METRIC_RR; 
   phy_args.equalizer_mode  = "mmse"; 
   phy_args.estimator_fil_w = 0.2;
   phy_args.max_prach_offset_us = 50; 
   phy_args.nof_phy_threads = 1; 
   phy_args.pusch_max_its   = 5; 
+  phy_args.sequence_cache_mb = 64; 
+  phy_args.pipeline_budget_us = 3000; 
   
   generate_cell_configuration(&mac_cfg, &phy_cfg);
   
@@ -18,31 +18,31 @@ void rrc_plmn_test()
   plmn_in.mnc = 0xFF45;
 
   // 2-digit MNC test
-  uint8_t bit_buf[32];
-  uint8_t *ie_ptr = bit_buf;
+  uint8_t byte_buf[4];
+  LIBLTE_BIT_CURSOR_STRUCT ie_ptr;
+  liblte_bit_cursor_init(&ie_ptr, byte_buf);
 
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  uint8_t byte_buf[4];
-  liblte_pack(bit_buf, 22, byte_buf);
-  uint8_t ref[3] = {0x89, 0x19, 0x05};
+  liblte_align_up_zero(&ie_ptr, 8);
+  uint8_t ref[3] = {0x89, 0x19, 0x14};
   for(int i=0;i<3;i++) {
     assert(ref[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  liblte_bit_cursor_init(&ie_ptr, byte_buf);
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
 
   // 3-digit MNC test
   plmn_in.mnc = 0xF456;
-  ie_ptr = bit_buf;
+  liblte_bit_cursor_init(&ie_ptr, byte_buf);
   liblte_rrc_pack_plmn_identity_ie(&plmn_in, &ie_ptr);
-  liblte_pack(bit_buf, 26, byte_buf);
-  uint8_t ref2[4] = {0x89, 0x1D, 0x15, 0x02};
-  for(int i=0;i<3;i++) {
+  liblte_align_up_zero(&ie_ptr, 8);
+  uint8_t ref2[4] = {0x89, 0x1D, 0x15, 0x80};
+  for(int i=0;i<4;i++) {
     assert(ref2[i] == byte_buf[i]);
   }
-  ie_ptr = bit_buf;
+  liblte_bit_cursor_init(&ie_ptr, byte_buf);
   liblte_rrc_unpack_plmn_identity_ie(&ie_ptr, &plmn_out);
   assert(plmn_in.mcc == plmn_out.mcc);
   assert(plmn_in.mnc == plmn_out.mnc);
@@ -38,8 +38,11 @@
 #include "srslte/common/logger_file.h"
 #include "srslte/common/log_filter.h"
 #include "srslte/common/buffer_pool.h"
+#include "srslte/common/block_queue.h"
+#include "srslte/common/threads.h"
 #include "srslte/interfaces/epc_interfaces.h"
-#include <fstream>
+#include "srsepc/hdr/hss/hss_db.h"
+#include <deque>
 #include <map>
 
 namespace srsepc{
@@ -49,17 +52,23 @@ typedef struct{
   std::string db_file;
   uint16_t mcc;
   uint16_t mnc;
+  uint32_t av_batch;      // Auth vectors precomputed per IMSI. 0 computes them on request only
+  uint32_t av_cache_size; // IMSIs with precomputed auth vectors
 }hss_args_t;
 
 typedef struct{
-    std::string name;
-    uint64_t imsi;
-    uint8_t key[16];
-    uint8_t op[16];
-    uint8_t amf[2];
-    uint8_t sqn[6];
-    uint8_t last_rand[16];
-}hss_ue_ctx_t;
+  uint8_t rand[16];
+  uint8_t xres[16];
+  uint8_t autn[16];
+  uint8_t k_asme[32];
+}hss_auth_vector_t;
+
+typedef struct{
+  uint64_t cached;    // Answers with a precomputed auth vector
+  uint64_t computed;  // Answers computed on request
+  uint64_t batches;   // Batches precomputed in the background
+  uint64_t discarded; // Batches dropped because the SQN moved on meanwhile
+}hss_av_metrics_t;
 
 enum hss_auth_algo {
   HSS_ALGO_XOR,
@@ -77,49 +86,78 @@ public:
   bool gen_auth_info_answer(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres);
   bool resync_sqn(uint64_t imsi, uint8_t *auts);
 
+  uint64_t get_nof_users();
+  void get_av_metrics(hss_av_metrics_t *m);
+
 private:
 
+  /*
+   * Precomputes batches of auth vectors with consecutive SQNs, like an HSS
+   * answering an MME with several vectors at once. An IMSI is queued when
+   * its cached vectors run out, so Milenage runs outside of the S1AP
+   * procedures of the UE's next authentications.
+   */
+  class av_generator : public thread
+  {
+  public:
+    av_generator();
+    void init(hss *hss_);
+    void request(uint64_t imsi);
+    void stop();
+
+  private:
+    void run_thread();
+
+    hss                          *m_hss;
+    srslte::block_queue<uint64_t> m_queue; // IMSI 0 stops the thread
+  };
+
+  typedef struct{
+    uint64_t generation; // Changes whenever vectors of a pending batch would be out of order
+    bool     refill_pending;
+    std::deque<hss_auth_vector_t> avs;
+  }av_cache_entry_t;
+
   hss();
   virtual ~hss();
   static hss *m_instance;
 
   srslte::byte_buffer_pool *m_pool;
 
-  std::map<uint64_t,hss_ue_ctx_t*> m_imsi_to_ue_ctx;
-
+  hss_db m_db;
+  pthread_mutex_t m_mutex; // Auth vectors are requested by several S1AP workers
 
   void gen_rand(uint8_t rand_[16]);
-  bool get_k_amf_op_sqn(uint64_t imsi, uint8_t *k, uint8_t *amf, uint8_t *op, uint8_t *sqn);
+  void gen_auth_vector(const uint8_t *k, const uint8_t *op, const uint8_t *amf, const uint8_t *sqn, hss_auth_vector_t *av);
+  void gen_auth_vector_milenage(const uint8_t *k, const uint8_t *op, const uint8_t *amf, const uint8_t *sqn, hss_auth_vector_t *av);
+  void gen_auth_vector_xor(const uint8_t *k, const uint8_t *op, const uint8_t *amf, const uint8_t *sqn, hss_auth_vector_t *av);
 
-  bool gen_auth_info_answer_milenage(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres);
-  bool gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres);
+  bool resync_sqn_milenage(hss_db::record_t *ue, uint8_t *auts);
+  bool resync_sqn_xor(hss_db::record_t *ue, uint8_t *auts);
 
-  bool resync_sqn_milenage(uint64_t imsi, uint8_t *auts);
-  bool resync_sqn_xor(uint64_t imsi, uint8_t *auts);
+  hss_db::record_t* get_ue(uint64_t imsi);
+  void increment_sqn(hss_db::record_t *ue, uint32_t n);
 
-  std::vector<std::string> split_string(const std::string &str, char delimiter);
-  void get_uint_vec_from_hex_str(const std::string &key_str, uint8_t *key, uint len);
-
-  void increment_sqn(uint64_t imsi);
-  void set_sqn(uint64_t imsi, uint8_t *sqn);
-
-  void set_last_rand(uint64_t imsi, uint8_t *rand);
-  void get_last_rand(uint64_t imsi, uint8_t *rand);
+  av_cache_entry_t* get_av_cache_entry(uint64_t imsi);
+  void request_av_refill(uint64_t imsi, av_cache_entry_t *entry);
+  void refill_av_cache(uint64_t imsi);
 
   bool set_auth_algo(std::string auth_algo);
-  bool read_db_file(std::string db_file);
-  bool write_db_file(std::string db_file);
-  bool get_ue_ctx(uint64_t imsi, hss_ue_ctx_t **ue_ctx);
-  
-  std::string hex_string(uint8_t *hex, int size);
 
   enum hss_auth_algo m_auth_algo;
-  std::string db_file;
   /*Logs*/
   srslte::log_filter       *m_hss_log;
-  
+
   uint16_t mcc;
   uint16_t mnc;
+
+  uint32_t                            m_av_batch;
+  uint32_t                            m_av_cache_size;
+  std::map<uint64_t,av_cache_entry_t> m_av_cache;
+  std::deque<uint64_t>                m_av_cache_order; // Oldest entry is evicted first
+  uint64_t                            m_av_generation;
+  hss_av_metrics_t                    m_av_metrics;
+  av_generator                        m_av_generator;
 };
 
 } // namespace srsepc
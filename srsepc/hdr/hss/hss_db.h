@@ -0,0 +1,138 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        hss_db.h
+ * Description: Memory-mapped, IMSI-indexed subscriber database of the HSS.
+ *****************************************************************************/
+
+#ifndef SRSEPC_HSS_DB_H
+#define SRSEPC_HSS_DB_H
+
+#include <stdint.h>
+#include <string>
+#include "srslte/common/log.h"
+
+namespace srsepc{
+
+/*
+ * Subscriber database. The user CSV file is compiled once into an index
+ * file: an open addressing hash table of fixed-size records keyed by IMSI,
+ * which is memory-mapped on start, so startup does not depend on the number
+ * of subscribers and a lookup touches a single record. The index is rebuilt
+ * when the CSV file changes, keeping the SQNs stored in the old index.
+ *
+ * SQN and RAND updates are written in place in the mapping, which survives
+ * a crash of srsepc. SQN updates are also appended to a journal in batches
+ * of JOURNAL_SYNC_INTERVAL entries, each synced to disk, so a power loss
+ * does not depend on when the kernel writes back random table pages. The
+ * journal is replayed into the table on open. The table is synced and the
+ * journal truncated on close and whenever the journal grows past
+ * MAX_JOURNAL_ENTRIES. A lost SQN update only costs one SQN
+ * resynchronization with the UE.
+ *
+ * Not thread-safe, the HSS serializes all accesses.
+ */
+class hss_db
+{
+public:
+  typedef struct {
+    uint64_t imsi;          // 0 marks an empty slot
+    uint8_t  key[16];
+    uint8_t  op[16];
+    uint8_t  amf[2];
+    uint8_t  sqn[6];
+    uint8_t  last_rand[16];
+  } record_t;
+
+  static const uint32_t JOURNAL_SYNC_INTERVAL = 1024;
+  static const uint32_t MAX_JOURNAL_ENTRIES   = 1<<20;
+
+  hss_db();
+  ~hss_db();
+
+  // Index file defaults to <csv_file>.idx. Either file may be missing, but not both
+  bool open(std::string csv_file, std::string index_file, srslte::log *log);
+  void close();
+
+  record_t* find(uint64_t imsi);
+  void      set_sqn(record_t *rec, const uint8_t *sqn);
+  uint64_t  size();
+
+  // Syncs the table to disk and truncates the journal
+  void      checkpoint();
+
+private:
+  static const uint64_t MAGIC   = 0x4244535348535253ULL; // "SRSHSSDB"
+  static const uint32_t VERSION = 1;
+
+  typedef struct {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t nof_slots;     // power of two
+    uint64_t nof_records;
+    int64_t  csv_mtime;     // CSV file the index was built from
+    int64_t  csv_size;
+    uint8_t  reserved[16];
+  } header_t;
+
+  typedef struct {
+    uint64_t imsi;
+    uint8_t  sqn[6];
+    uint16_t check;
+  } journal_entry_t;
+
+  typedef struct {
+    int       fd;
+    uint8_t  *map;
+    size_t    map_len;
+    header_t *hdr;
+    record_t *records;
+  } mapping_t;
+
+  bool      map_index(std::string file, mapping_t *m);
+  void      unmap_index(mapping_t *m);
+  bool      build_index(std::string csv_file, int64_t csv_mtime, int64_t csv_size, std::string tmp_file, mapping_t *old);
+  bool      parse_csv_line(const std::string &line, record_t *rec);
+  uint64_t  replay_journal(mapping_t *m);
+  void      flush_journal();
+
+  static record_t* lookup(mapping_t *m, uint64_t imsi, bool insert);
+  static uint16_t  journal_check(const journal_entry_t *e);
+
+  srslte::log *m_log;
+  mapping_t    m_index;
+  std::string  m_journal_file;
+  int          m_journal_fd;
+  uint32_t     m_journal_entries;
+  uint32_t     m_journal_buf_len;
+  journal_entry_t m_journal_buf[JOURNAL_SYNC_INTERVAL];
+};
+
+} // namespace srsepc
+
+#endif // SRSEPC_HSS_DB_H
@@ -39,6 +39,7 @@
 #include "srslte/common/log_filter.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/threads.h"
+#include "srslte/common/block_queue.h"
 #include "s1ap.h"
 
 
@@ -55,6 +56,7 @@ typedef struct {
 
 typedef struct{
   s1ap_args_t s1ap_args;
+  uint32_t    nof_workers; // S1AP worker threads. 0 handles S1AP in the MME thread
   //diameter_args_t diameter_args;
   //gtpc_args_t gtpc_args;
 } mme_args_t;
@@ -64,6 +66,8 @@ class mme:
   public thread
 {
 public:
+  static const uint32_t MAX_WORKERS = 16;
+
   static mme* get_instance(void);
   static void cleanup(void);
   int init(mme_args_t* args, srslte::log_filter *s1ap_log, srslte::log_filter *mme_gtpc_log, hss_interface_s1ap * hss_);
@@ -73,6 +77,42 @@ public:
 
 private:
 
+  /*
+   * S1AP worker. PDUs are dispatched by SCTP association, so every eNB, and
+   * with it every UE, is always served by the same worker and its procedures
+   * stay in order. Workers share the sharded UE context store of the S1AP.
+   */
+  class worker : public thread
+  {
+  public:
+    worker();
+    void init(uint32_t id, s1ap *s1ap_, srslte::log *log);
+    void push_pdu(srslte::byte_buffer_t *pdu, struct sctp_sndrcvinfo *sri);
+    void push_shutdown(struct sctp_sndrcvinfo *sri);
+    void stop();
+
+  private:
+    typedef enum {
+      WORK_PDU = 0,
+      WORK_SHUTDOWN,
+      WORK_EXIT
+    } work_type_t;
+
+    typedef struct {
+      work_type_t            type;
+      srslte::byte_buffer_t *pdu;
+      struct sctp_sndrcvinfo sri;
+    } work_t;
+
+    void run_thread();
+
+    s1ap                        *m_s1ap;
+    srslte::log                 *m_log;
+    srslte::byte_buffer_pool    *m_pool;
+    uint32_t                     m_id;
+    srslte::block_queue<work_t>  m_queue;
+  };
+
   mme();
   virtual ~mme();
   static mme *m_instance;
@@ -82,6 +122,9 @@ private:
   bool m_running;
   srslte::byte_buffer_pool *m_pool;
 
+  uint32_t m_nof_workers;
+  worker   m_workers[MAX_WORKERS];
+
   /*Logs*/
   srslte::log_filter  *m_s1ap_log;
   srslte::log_filter  *m_mme_gtpc_log;
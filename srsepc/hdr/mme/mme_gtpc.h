@@ -71,7 +71,11 @@ private:
   spgw* m_spgw;
   in_addr_t m_mme_gtpc_ip;
 
-  uint32_t m_next_ctrl_teid;
+  volatile uint32_t m_next_ctrl_teid;
+
+  // Serializes GTP-C transactions from the S1AP workers. The SP-GW answers
+  // synchronously, so the response handlers run with the mutex held.
+  pthread_mutex_t m_mutex;
   std::map<uint32_t,uint64_t> m_mme_ctr_teid_to_imsi;
   std::map<uint64_t,struct gtpc_ctx> m_imsi_to_gtpc_ctx;
 
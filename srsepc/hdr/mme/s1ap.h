@@ -38,6 +38,7 @@
 #include <sys/socket.h>
 #include <netinet/sctp.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <map>
 #include <set>
 #include "s1ap_common.h"
@@ -104,6 +105,7 @@ public:
   //bool get_tmp_ue_emm_ctx(uint32_t mme_ue_s1ap_id, ue_emm_ctx_t* ue_emm_ptr);
 
   uint32_t allocate_m_tmsi(uint64_t imsi);
+  bool find_imsi_from_m_tmsi(uint32_t m_tmsi, uint64_t *imsi);
 
   s1ap_args_t                    m_s1ap_args;
   srslte::log_filter            *m_s1ap_log;
@@ -112,8 +114,6 @@ public:
   s1ap_nas_transport*            m_s1ap_nas_transport;
   s1ap_ctx_mngmt_proc*           m_s1ap_ctx_mngmt_proc;
 
-  std::map<uint32_t, uint64_t>                      m_tmsi_to_imsi;
-
 private:
   s1ap();
   virtual ~s1ap();
@@ -125,20 +125,37 @@ private:
 
   hss_interface_s1ap *m_hss;
   int m_s1mme;
+
+  // eNB contexts. Only touched on S1 setup, association shutdown and UE release.
+  pthread_mutex_t                                   m_enb_mutex;
   std::map<uint16_t, enb_ctx_t*>                    m_active_enbs;
   std::map<int32_t, uint16_t>                       m_sctp_to_enb_id;
   std::map<uint16_t,std::set<uint32_t> >            m_enb_id_to_ue_ids;
 
-
-  std::map<uint64_t, ue_ctx_t*>                     m_imsi_to_ue_ctx;
-  std::map<uint32_t, ue_ctx_t*>                     m_mme_ue_s1ap_id_to_ue_ctx;
+  /*
+   * UE context store. S1AP workers serving different eNBs look up UE contexts
+   * concurrently, so every key is hashed to one of NOF_UE_SHARDS shards, each
+   * with its own lock. A UE context itself is only modified by the worker that
+   * serves the UE's current eNB association.
+   */
+  static const uint32_t NOF_UE_SHARDS_LOG2 = 6;
+  static const uint32_t NOF_UE_SHARDS      = 1 << NOF_UE_SHARDS_LOG2;
+  typedef struct {
+    pthread_mutex_t                                 mutex;
+    std::map<uint64_t, ue_ctx_t*>                   imsi_to_ue_ctx;
+    std::map<uint32_t, ue_ctx_t*>                   mme_ue_s1ap_id_to_ue_ctx;
+    std::map<uint32_t, uint64_t>                    tmsi_to_imsi;
+  } ue_shard_t;
+  ue_shard_t                                        m_ue_shards[NOF_UE_SHARDS];
+  ue_shard_t* get_ue_shard(uint64_t key);
 
   //std::map<uint64_t, ue_emm_ctx_t*>                 m_imsi_to_ue_emm_ctx;
   //std::map<uint32_t, ue_ecm_ctx_t*>                 m_mme_ue_s1ap_id_to_ue_ecm_ctx;
   //std::map<int32_t,ue_emm_ctx_t*>                   m_mme_ue_s1ap_id_to_tmp_ue_emm_ctx;
 
-  uint32_t                                          m_next_mme_ue_s1ap_id;
-  uint32_t                                          m_next_m_tmsi;
+  // Allocated with atomic increments from any S1AP worker
+  volatile uint32_t                                 m_next_mme_ue_s1ap_id;
+  volatile uint32_t                                 m_next_m_tmsi;
 
   //FIXME the GTP-C should be moved to the MME class, when the packaging of GTP-C messages is done.
   mme_gtpc *m_mme_gtpc;
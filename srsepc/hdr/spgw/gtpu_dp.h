@@ -0,0 +1,166 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/******************************************************************************
+ * File:        gtpu_dp.h
+ * Description: Multi-threaded GTP-U data plane of the SP-GW. Every worker
+ *              owns one queue of a multi-queue SGi TUN device and one
+ *              SO_REUSEPORT S1-U socket, waits on both with epoll and moves
+ *              packets in batches with recvmmsg/sendmmsg.
+ *****************************************************************************/
+
+#ifndef SRSEPC_GTPU_DP_H
+#define SRSEPC_GTPU_DP_H
+
+#include <string>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "srslte/common/common.h"
+#include "srslte/common/log.h"
+#include "srslte/common/threads.h"
+#include "srslte/asn1/gtpc.h"
+
+namespace srsepc{
+
+/*
+ * UE IP to eNB user-plane F-TEID table used for downlink forwarding.
+ * Open addressing with linear probing and backward-shift deletion. Every
+ * entry carries a sequence counter so that find() is lock-free and can run
+ * concurrently on all data-plane workers. add() and rem() must be
+ * serialized by the caller. A lookup racing with rem() may miss an entry
+ * that is being shifted, which only drops that downlink packet.
+ */
+class gtpu_tunnel_table
+{
+public:
+  static const uint32_t MAX_TUNNELS = 65536;
+
+  gtpu_tunnel_table();
+  ~gtpu_tunnel_table();
+
+  bool add(in_addr_t ue_ip, const srslte::gtpc_f_teid_ie &enb_fteid);
+  bool rem(in_addr_t ue_ip);
+  bool find(in_addr_t ue_ip, srslte::gtpc_f_teid_ie *enb_fteid);
+  uint32_t size();
+  void clear();
+
+private:
+  static const uint32_t  CAPACITY  = 2*MAX_TUNNELS; // power of two, load factor <= 0.5
+  static const in_addr_t EMPTY     = 0;              // 0.0.0.0 is never a UE address
+
+  typedef struct {
+    volatile uint32_t  seq;
+    volatile in_addr_t ue_ip;
+    volatile uint32_t  teid;
+    volatile in_addr_t enb_ip;
+  } entry_t;
+
+  uint32_t hash(in_addr_t ue_ip);
+  void     write_entry(entry_t *e, in_addr_t ue_ip, uint32_t teid, in_addr_t enb_ip);
+
+  entry_t *m_entries;
+  uint32_t m_nof_tunnels;
+};
+
+typedef struct {
+  uint64_t ul_pkts;
+  uint64_t ul_bytes;
+  uint64_t ul_dropped;
+  uint64_t dl_pkts;
+  uint64_t dl_bytes;
+  uint64_t dl_dropped;
+} gtpu_dp_metrics_t;
+
+class gtpu_dp
+{
+public:
+  static const uint32_t MAX_WORKERS = 16;
+  static const uint32_t BATCH_SIZE  = 32;
+
+  gtpu_dp();
+  ~gtpu_dp();
+
+  // Creates the SGi TUN device with nof_queues queues (multi-queue if more than one)
+  static srslte::error_t init_sgi_if(const char *dev, std::string sgi_if_addr, uint32_t nof_queues,
+                                     int *sgi_fds, int *sgi_sock, srslte::log *log);
+
+  srslte::error_t init(uint32_t nof_workers, int *sgi_fds, struct sockaddr_in *s1u_addr,
+                       gtpu_tunnel_table *tunnels, srslte::log *log);
+  void start(int prio = -1);
+  void stop();
+
+  void get_metrics(gtpu_dp_metrics_t *m);
+
+private:
+
+  class worker : public thread
+  {
+  public:
+    worker();
+    ~worker();
+    srslte::error_t init(uint32_t id, int sgi_fd, int s1u_fd, gtpu_tunnel_table *tunnels, srslte::log *log);
+    void stop();
+    void get_metrics(gtpu_dp_metrics_t *m);
+
+  private:
+    void run_thread();
+    void handle_s1u();
+    void handle_sgi();
+
+    gtpu_tunnel_table *m_tunnels;
+    srslte::log       *m_log;
+    uint32_t           m_id;
+    int                m_epoll;
+    int                m_sgi;
+    int                m_s1u;
+    bool               m_running;
+
+    srslte::byte_buffer_t *m_rx_buf[BATCH_SIZE];
+    srslte::byte_buffer_t *m_tx_buf[BATCH_SIZE];
+    struct mmsghdr         m_rx_msg[BATCH_SIZE];
+    struct mmsghdr         m_tx_msg[BATCH_SIZE];
+    struct iovec           m_rx_iov[BATCH_SIZE];
+    struct iovec           m_tx_iov[BATCH_SIZE];
+    struct sockaddr_in     m_tx_addr[BATCH_SIZE];
+
+    // Written only by the worker thread
+    gtpu_dp_metrics_t      m_metrics;
+  };
+
+  srslte::error_t open_s1u(struct sockaddr_in *s1u_addr, int *s1u_fd);
+
+  srslte::log       *m_log;
+  gtpu_tunnel_table *m_tunnels;
+  uint32_t           m_nof_workers;
+  worker             m_workers[MAX_WORKERS];
+  int                m_s1u[MAX_WORKERS];
+  bool               m_started;
+};
+
+} // namespace srsepc
+
+#endif // SRSEPC_GTPU_DP_H
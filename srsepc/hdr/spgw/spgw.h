@@ -40,6 +40,7 @@
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/threads.h"
 #include "srslte/asn1/gtpc.h"
+#include "srsepc/hdr/spgw/gtpu_dp.h"
 
 namespace srsepc{
 
@@ -50,6 +51,7 @@ const uint16_t GTPU_RX_PORT = 2152;
 typedef struct {
   std::string gtpu_bind_addr;
   std::string sgi_if_addr;
+  uint32_t    nof_dp_threads;   // 0 handles the user plane in the SP-GW thread
 } spgw_args_t;
 
 
@@ -107,6 +109,10 @@ private:
   bool m_sgi_up;
   int m_sgi_if;
   int m_sgi_sock;
+  int m_sgi_fds[gtpu_dp::MAX_WORKERS];  // TUN queues, m_sgi_fds[0] == m_sgi_if
+
+  uint32_t m_nof_dp_threads;
+  gtpu_dp  m_dp;
 
   bool m_s1u_up;
   int m_s1u;
@@ -120,7 +126,7 @@ private:
 
   std::map<uint64_t,uint32_t> m_imsi_to_ctr_teid;                   //IMSI to control TEID map. Important to check if UE is previously connected
   std::map<uint32_t,spgw_tunnel_ctx*> m_teid_to_tunnel_ctx;         //Map control TEID to tunnel ctx. Usefull to get reply ctrl TEID, UE IP, etc.
-  std::map<in_addr_t,srslte::gtpc_f_teid_ie> m_ip_to_teid;          //Map IP to User-plane TEID for downlink traffic
+  gtpu_tunnel_table m_ip_to_teid;                                   //Map IP to User-plane TEID for downlink traffic. Lock-free lookups
 
   uint32_t m_h_next_ue_ip;
 
@@ -25,9 +25,8 @@
  */
 #include <stdlib.h>     /* srand, rand */
 #include <time.h>       /* time */
+#include <string.h>
 #include <string>
-#include <sstream>
-#include <iomanip>
 #include <inttypes.h> // for printing uint64_t
 #include "srsepc/hdr/hss/hss.h"
 #include "srslte/common/security.h"
@@ -39,14 +38,20 @@ namespace srsepc{
 hss*          hss::m_instance = NULL;
 pthread_mutex_t hss_instance_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-hss::hss()
+hss::hss():
+  m_av_batch(0),
+  m_av_cache_size(0),
+  m_av_generation(0)
 {
   m_pool = srslte::byte_buffer_pool::get_instance();
+  pthread_mutex_init(&m_mutex, NULL);
+  bzero(&m_av_metrics, sizeof(hss_av_metrics_t));
   return;
 }
 
 hss::~hss()
 {
+  pthread_mutex_destroy(&m_mutex);
   return;
 }
 
@@ -84,8 +89,8 @@ hss::init(hss_args_t *hss_args, srslte::log_filter *hss_log)
   {
     return -1;
   }
-  /*Read user information from DB*/
-  if(read_db_file(hss_args->db_file) == false)
+  /*Open user DB and its index*/
+  if(m_db.open(hss_args->db_file, "", m_hss_log) == false)
   {
     m_hss_log->console("Error reading user database file %s\n", hss_args->db_file.c_str());
     return -1;
@@ -93,10 +98,21 @@ hss::init(hss_args_t *hss_args, srslte::log_filter *hss_log)
 
   mcc = hss_args->mcc;
   mnc = hss_args->mnc;
-  
-  db_file = hss_args->db_file;
 
-  m_hss_log->info("HSS Initialized. DB file %s, authentication algorithm %s, MCC: %d, MNC: %d\n", hss_args->db_file.c_str(),hss_args->auth_algo.c_str(), mcc, mnc);
+  m_av_cache_size = hss_args->av_cache_size;
+  m_av_batch      = m_av_cache_size > 0 ? hss_args->av_batch : 0;
+  if(m_av_batch > 0)
+  {
+    m_av_generator.init(this);
+    m_av_generator.start();
+  }
+
+  m_hss_log->info("HSS Initialized. DB file %s, authentication algorithm %s, MCC: %d, MNC: %d, users: %" PRIu64 "\n",
+                  hss_args->db_file.c_str(), hss_args->auth_algo.c_str(), mcc, mnc, m_db.size());
+  if(m_av_batch > 0)
+  {
+    m_hss_log->info("Precomputing %d auth vectors per IMSI for up to %d IMSIs\n", m_av_batch, m_av_cache_size);
+  }
   m_hss_log->console("HSS Initialized.\n");
   return 0;
 }
@@ -104,15 +120,16 @@ hss::init(hss_args_t *hss_args, srslte::log_filter *hss_log)
 void
 hss::stop(void)
 {
-  write_db_file(db_file);
-  std::map<uint64_t,hss_ue_ctx_t*>::iterator it = m_imsi_to_ue_ctx.begin();
-  while(it!=m_imsi_to_ue_ctx.end())
-    {
-      m_hss_log->info("Deleting UE context in HSS. IMSI: %015lu\n", it->second->imsi);
-      m_hss_log->console("Deleting UE context in HSS. IMSI: %015lu\n", it->second->imsi);
-      delete it->second;
-      m_imsi_to_ue_ctx.erase(it++);
-    }
+  if(m_av_batch > 0)
+  {
+    m_av_generator.stop();
+    m_hss_log->info("Auth vectors: %" PRIu64 " precomputed, %" PRIu64 " computed on request, %" PRIu64 " batches, %" PRIu64 " discarded\n",
+                    m_av_metrics.cached, m_av_metrics.computed, m_av_metrics.batches, m_av_metrics.discarded);
+    m_av_batch = 0;
+  }
+  m_av_cache.clear();
+  m_av_cache_order.clear();
+  m_db.close();
   return;
 }
 
@@ -137,133 +154,103 @@ hss::set_auth_algo(std::string auth_algo)
 }
 
 bool
-hss::read_db_file(std::string db_filename)
+hss::gen_auth_info_answer(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres)
 {
-  std::ifstream m_db_file;
-  
-  m_db_file.open(db_filename.c_str(), std::ifstream::in);
-  if(!m_db_file.is_open())
+  hss_auth_vector_t av;
+  uint8_t k[16];
+  uint8_t amf[2];
+  uint8_t op[16];
+  uint8_t sqn[6];
+
+  pthread_mutex_lock(&m_mutex);
+  hss_db::record_t *ue = get_ue(imsi);
+  if(ue == NULL)
   {
+    pthread_mutex_unlock(&m_mutex);
     return false;
   }
-  m_hss_log->info("Opened DB file: %s\n", db_filename.c_str() );
 
-  std::string line;
-  while (std::getline(m_db_file, line))
+  av_cache_entry_t *entry = get_av_cache_entry(imsi);
+  if(entry != NULL && !entry->avs.empty())
   {
-    if(line[0] != '#')
+    av = entry->avs.front();
+    entry->avs.pop_front();
+    memcpy(ue->last_rand, av.rand, 16);
+    if(entry->avs.empty())
     {
-      std::vector<std::string> split = split_string(line,','); 
-      if(split.size()!=6)
-      {
-        m_hss_log->error("Error parsing UE database\n");
-        return false;
-      }
-      hss_ue_ctx_t *ue_ctx = new hss_ue_ctx_t;
-      ue_ctx->name = split[0];
-      ue_ctx->imsi = atoll(split[1].c_str());
-      get_uint_vec_from_hex_str(split[2],ue_ctx->key,16);
-      get_uint_vec_from_hex_str(split[3],ue_ctx->op,16);
-      get_uint_vec_from_hex_str(split[4],ue_ctx->amf,2);
-      get_uint_vec_from_hex_str(split[5],ue_ctx->sqn,6);
-
-      m_hss_log->debug("Added user from DB, IMSI: %015lu\n", ue_ctx->imsi);
-      m_hss_log->debug_hex(ue_ctx->key, 16, "User Key : ");
-      m_hss_log->debug_hex(ue_ctx->op, 16, "User OP : ");
-      m_hss_log->debug_hex(ue_ctx->amf, 2, "AMF : ");
-      m_hss_log->debug_hex(ue_ctx->sqn, 6, "SQN : ");
-
-      m_imsi_to_ue_ctx.insert(std::pair<uint64_t,hss_ue_ctx_t*>(ue_ctx->imsi,ue_ctx));
+      request_av_refill(imsi, entry);
     }
+    m_av_metrics.cached++;
+    pthread_mutex_unlock(&m_mutex);
+    m_hss_log->debug("Using precomputed auth vector. IMSI: %015" PRIu64 "\n", imsi);
   }
-
-  if(m_db_file.is_open())
+  else
   {
-    m_db_file.close();
+    memcpy(k, ue->key, 16);
+    memcpy(amf, ue->amf, 2);
+    memcpy(op, ue->op, 16);
+    memcpy(sqn, ue->sqn, 6);
+    increment_sqn(ue, 1);
+    if(entry != NULL)
+    {
+      // A batch still being generated uses older SQNs than this vector
+      entry->generation     = ++m_av_generation;
+      entry->refill_pending = false;
+      request_av_refill(imsi, entry);
+    }
+    m_av_metrics.computed++;
+    pthread_mutex_unlock(&m_mutex);
+
+    gen_auth_vector(k, op, amf, sqn, &av);
+
+    pthread_mutex_lock(&m_mutex);
+    memcpy(ue->last_rand, av.rand, 16);
+    pthread_mutex_unlock(&m_mutex);
   }
 
+  memcpy(k_asme, av.k_asme, 32);
+  memcpy(autn, av.autn, 16);
+  memcpy(rand, av.rand, 16);
+  memcpy(xres, av.xres, 16);
   return true;
 }
 
-bool hss::write_db_file(std::string db_filename)
+bool 
+hss::resync_sqn(uint64_t imsi, uint8_t *auts)
 {
-  std::string line;
-  uint8_t k[16];
-  uint8_t amf[2];
-  uint8_t op[16];
-  uint8_t sqn[6];
-
-  std::ofstream m_db_file;
-  
-  m_db_file.open(db_filename.c_str(), std::ofstream::out);
-  if(!m_db_file.is_open())
+  bool ret = false;
+  pthread_mutex_lock(&m_mutex);
+  hss_db::record_t *ue = get_ue(imsi);
+  if(ue == NULL)
   {
+    pthread_mutex_unlock(&m_mutex);
     return false;
   }
-  m_hss_log->info("Opened DB file: %s\n", db_filename.c_str() );
-
-  std::map<uint64_t,hss_ue_ctx_t*>::iterator it = m_imsi_to_ue_ctx.begin();
-  while(it!=m_imsi_to_ue_ctx.end())
-  {
-      m_db_file << it->second->name;
-      m_db_file << ",";
-      m_db_file << std::setfill('0') << std::setw(15) << it->second->imsi;
-      m_db_file << ",";
-      m_db_file << hex_string(it->second->key, 16);
-      m_db_file << ",";
-      m_db_file << hex_string(it->second->op, 16);
-      m_db_file << ",";
-      m_db_file << hex_string(it->second->amf, 2);
-      m_db_file << ",";
-      m_db_file << hex_string(it->second->sqn, 6);
-      m_db_file << std::endl;
-      it++;
-  }
-  
-  if(m_db_file.is_open())
-  {
-    m_db_file.close();
-  }
-  return true;
-}
-
-bool
-hss::gen_auth_info_answer(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres)
-{
-  bool ret = false;
   switch (m_auth_algo)
   {
   case HSS_ALGO_XOR:
-    ret = gen_auth_info_answer_xor(imsi, k_asme, autn, rand, xres);
+    ret = resync_sqn_xor(ue, auts);
     break;
   case HSS_ALGO_MILENAGE:
-    ret = gen_auth_info_answer_milenage(imsi, k_asme, autn, rand, xres);
+    ret = resync_sqn_milenage(ue, auts);
     break;
   }
-  increment_sqn(imsi);
-  return ret;
+  increment_sqn(ue, 1);
 
-}
-
-bool 
-hss::resync_sqn(uint64_t imsi, uint8_t *auts)
-{
-  bool ret = false;
-  switch (m_auth_algo)
+  // Precomputed vectors carry the SQNs the UE rejected
+  std::map<uint64_t,av_cache_entry_t>::iterator it = m_av_cache.find(imsi);
+  if(it != m_av_cache.end())
   {
-  case HSS_ALGO_XOR:
-    ret = resync_sqn_xor(imsi, auts);
-    break;
-  case HSS_ALGO_MILENAGE:
-    ret = resync_sqn_milenage(imsi, auts);
-    break;
+    it->second.avs.clear();
+    it->second.generation     = ++m_av_generation;
+    it->second.refill_pending = false;
   }
-  increment_sqn(imsi);
+  pthread_mutex_unlock(&m_mutex);
   return ret;
 }
 
 bool 
-hss::resync_sqn_xor(uint64_t imsi, uint8_t *auts)
+hss::resync_sqn_xor(hss_db::record_t *ue, uint8_t *auts)
 {
   m_hss_log->error("XOR SQN synchronization not supported yet\n");
   m_hss_log->console("XOR SQNs synchronization not supported yet\n");
@@ -272,25 +259,12 @@ hss::resync_sqn_xor(uint64_t imsi, uint8_t *auts)
 
 
 bool 
-hss::resync_sqn_milenage(uint64_t imsi, uint8_t *auts)
+hss::resync_sqn_milenage(hss_db::record_t *ue, uint8_t *auts)
 {
-  uint8_t last_rand[16];
   uint8_t ak[6];
   uint8_t mac_s[8];
   uint8_t sqn_ms_xor_ak[6];
 
-  uint8_t k[16];
-  uint8_t amf[2];
-  uint8_t op[16];
-  uint8_t sqn[6];
-
-  if(!get_k_amf_op_sqn(imsi, k, amf, op, sqn))
-  {
-    return false;
-  }
-
-  get_last_rand(imsi, last_rand);
-
   for(int i=0; i<6; i++){
     sqn_ms_xor_ak[i] = auts[i];
   }
@@ -299,14 +273,14 @@ hss::resync_sqn_milenage(uint64_t imsi, uint8_t *auts)
     mac_s[i] = auts[i+6];
   }
 
-  m_hss_log->debug_hex(k, 16, "User Key : ");
-  m_hss_log->debug_hex(op, 16, "User OP : ");
-  m_hss_log->debug_hex(last_rand, 16, "User Last Rand : ");
+  m_hss_log->debug_hex(ue->key, 16, "User Key : ");
+  m_hss_log->debug_hex(ue->op, 16, "User OP : ");
+  m_hss_log->debug_hex(ue->last_rand, 16, "User Last Rand : ");
   m_hss_log->debug_hex(auts, 16, "AUTS : ");
   m_hss_log->debug_hex(sqn_ms_xor_ak, 6, "SQN xor AK : ");
   m_hss_log->debug_hex(mac_s, 8, "MAC : ");
 
-  security_milenage_f5_star(k, op, last_rand, ak);
+  security_milenage_f5_star(ue->key, ue->op, ue->last_rand, ak);
   m_hss_log->debug_hex(ak, 6, "Resynch AK : ");
 
   uint8_t sqn_ms[6];
@@ -315,11 +289,11 @@ hss::resync_sqn_milenage(uint64_t imsi, uint8_t *auts)
   }
   m_hss_log->debug_hex(sqn_ms, 6, "SQN MS : ");
 
-  m_hss_log->debug_hex(amf, 2, "AMF : ");
+  m_hss_log->debug_hex(ue->amf, 2, "AMF : ");
 
   uint8_t mac_s_tmp[8];
 
-  security_milenage_f1_star(k, op, last_rand, sqn_ms, amf, mac_s_tmp);
+  security_milenage_f1_star(ue->key, ue->op, ue->last_rand, sqn_ms, ue->amf, mac_s_tmp);
 
   m_hss_log->debug_hex(mac_s_tmp, 8, "MAC calc : ");
   /*
@@ -330,13 +304,29 @@ hss::resync_sqn_milenage(uint64_t imsi, uint8_t *auts)
     }
   }
   */
-  set_sqn(imsi, sqn_ms);
+  m_db.set_sqn(ue, sqn_ms);
 
   return true;
 }
 
-bool
-hss::gen_auth_info_answer_milenage(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres)
+void
+hss::gen_auth_vector(const uint8_t *k, const uint8_t *op, const uint8_t *amf, const uint8_t *sqn, hss_auth_vector_t *av)
+{
+  bzero(av, sizeof(hss_auth_vector_t));
+  gen_rand(av->rand);
+  switch (m_auth_algo)
+  {
+  case HSS_ALGO_XOR:
+    gen_auth_vector_xor(k, op, amf, sqn, av);
+    break;
+  case HSS_ALGO_MILENAGE:
+    gen_auth_vector_milenage(k, op, amf, sqn, av);
+    break;
+  }
+}
+
+void
+hss::gen_auth_vector_milenage(const uint8_t *k_, const uint8_t *op_, const uint8_t *amf_, const uint8_t *sqn_, hss_auth_vector_t *av)
 {
   uint8_t k[16];
   uint8_t amf[2];
@@ -348,32 +338,31 @@ hss::gen_auth_info_answer_milenage(uint64_t imsi, uint8_t *k_asme, uint8_t *autn
   uint8_t     ak[6];
   uint8_t     mac[8];
 
+  // The security functions take non-const keys
+  memcpy(k, k_, 16);
+  memcpy(amf, amf_, 2);
+  memcpy(op, op_, 16);
+  memcpy(sqn, sqn_, 6);
 
-  if(!get_k_amf_op_sqn(imsi, k, amf, op, sqn))
-  {
-    return false;
-  }
-  gen_rand(rand);
-  
   security_milenage_f2345( k,
                            op,
-                           rand,
-                           xres,
+                           av->rand,
+                           av->xres,
                            ck,
                            ik,
                            ak);
 
   m_hss_log->debug_hex(k, 16, "User Key : ");
   m_hss_log->debug_hex(op, 16, "User OP : ");
-  m_hss_log->debug_hex(rand, 16, "User Rand : ");
-  m_hss_log->debug_hex(xres, 8, "User XRES: ");
+  m_hss_log->debug_hex(av->rand, 16, "User Rand : ");
+  m_hss_log->debug_hex(av->xres, 8, "User XRES: ");
   m_hss_log->debug_hex(ck, 16, "User CK: ");
   m_hss_log->debug_hex(ik, 16, "User IK: ");
   m_hss_log->debug_hex(ak, 6, "User AK: ");
 
   security_milenage_f1( k,
                         op,
-                        rand,
+                        av->rand,
                         sqn,
                         amf,
                         mac);
@@ -388,40 +377,32 @@ hss::gen_auth_info_answer_milenage(uint64_t imsi, uint8_t *k_asme, uint8_t *autn
                             sqn,
                             mcc,
                             mnc,
-                            k_asme);
+                            av->k_asme);
 
   m_hss_log->debug("User MCC : %x  MNC : %x \n", mcc, mnc);
-  m_hss_log->debug_hex(k_asme, 32, "User k_asme : ");
+  m_hss_log->debug_hex(av->k_asme, 32, "User k_asme : ");
 
   //Generate AUTN (autn = sqn ^ ak |+| amf |+| mac)
   for(int i=0;i<6;i++ )
   {
-    autn[i] = sqn[i]^ak[i];
+    av->autn[i] = sqn[i]^ak[i];
   }
   for(int i=0;i<2;i++)
   {
-    autn[6+i]=amf[i];
+    av->autn[6+i]=amf[i];
   }
   for(int i=0;i<8;i++)
   {
-    autn[8+i]=mac[i];
+    av->autn[8+i]=mac[i];
   }
   
-  m_hss_log->debug_hex(autn, 16, "User AUTN: ");
-
-  set_last_rand(imsi, rand);
-
-  return true;
+  m_hss_log->debug_hex(av->autn, 16, "User AUTN: ");
 }
 
-bool
-hss::gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uint8_t *rand, uint8_t *xres)
+void
+hss::gen_auth_vector_xor(const uint8_t *k, const uint8_t *op, const uint8_t *amf, const uint8_t *sqn_, hss_auth_vector_t *av)
 {
-  uint8_t k[16];
-  uint8_t amf[2];
-  uint8_t op[16];
-  uint8_t sqn[6];
-
+  uint8_t  sqn[6];
   uint8_t  xdout[16];
   uint8_t  cdout[8];
 
@@ -432,19 +413,15 @@ hss::gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uin
 
   int i = 0;
 
-  if(!get_k_amf_op_sqn(imsi, k, amf, op, sqn))
-  {
-    return false;
-  }
-  gen_rand(rand);
+  memcpy(sqn, sqn_, 6);
 
   // Use RAND and K to compute RES, CK, IK and AK
   for(i=0; i<16; i++) {
-    xdout[i] = k[i]^rand[i];
+    xdout[i] = k[i]^av->rand[i];
   }
 
   for(i=0; i<16; i++) {
-    xres[i]  = xdout[i];
+    av->xres[i]  = xdout[i];
     ck[i]   = xdout[(i+1)%16];
     ik[i]   = xdout[(i+2)%16];
   }
@@ -454,8 +431,8 @@ hss::gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uin
 
   m_hss_log->debug_hex(k, 16, "User Key : ");
   m_hss_log->debug_hex(op, 16, "User OP : ");
-  m_hss_log->debug_hex(rand, 16, "User Rand : ");
-  m_hss_log->debug_hex(xres, 8, "User XRES: ");
+  m_hss_log->debug_hex(av->rand, 16, "User Rand : ");
+  m_hss_log->debug_hex(av->xres, 8, "User XRES: ");
   m_hss_log->debug_hex(ck, 16, "User CK: ");
   m_hss_log->debug_hex(ik, 16, "User IK: ");
   m_hss_log->debug_hex(ak, 6, "User AK: ");
@@ -476,20 +453,6 @@ hss::gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uin
   m_hss_log->debug_hex(sqn, 6, "User SQN : ");
   m_hss_log->debug_hex(mac, 8, "User MAC : ");
 
-  //Generate AUTN (autn = sqn ^ ak |+| amf |+| mac)
-  for(int i=0;i<6;i++ )
-  {
-      autn[i] = sqn[i]^ak[i];
-  }
-  for(int i=0;i<2;i++)
-  {
-      autn[6+i]=amf[i];
-  }
-  for(int i=0;i<8;i++)
-  {
-      autn[8+i]=mac[i];
-  }
-
   // Generate K_asme
   security_generate_k_asme( ck,
                             ik,
@@ -497,190 +460,212 @@ hss::gen_auth_info_answer_xor(uint64_t imsi, uint8_t *k_asme, uint8_t *autn, uin
                             sqn,
                             mcc,
                             mnc,
-                            k_asme);
+                            av->k_asme);
   
   m_hss_log->debug("User MCC : %x  MNC : %x \n", mcc, mnc);
-  m_hss_log->debug_hex(k_asme, 32, "User k_asme : ");
+  m_hss_log->debug_hex(av->k_asme, 32, "User k_asme : ");
 
   //Generate AUTN (autn = sqn ^ ak |+| amf |+| mac)
   for(int i=0;i<6;i++ )
   {
-    autn[i] = sqn[i]^ak[i];
+    av->autn[i] = sqn[i]^ak[i];
   }
   for(int i=0;i<2;i++)
   {
-    autn[6+i]=amf[i];
+    av->autn[6+i]=amf[i];
   }
   for(int i=0;i<8;i++)
   {
-    autn[8+i]=mac[i];
+    av->autn[8+i]=mac[i];
   }
 
-  m_hss_log->debug_hex(autn, 8, "User AUTN: ");
-
-  set_last_rand(imsi, rand);
-
-  return true;
+  m_hss_log->debug_hex(av->autn, 8, "User AUTN: ");
 }
 
-
-bool
-hss::get_k_amf_op_sqn(uint64_t imsi, uint8_t *k, uint8_t *amf, uint8_t *op, uint8_t *sqn)
+hss_db::record_t*
+hss::get_ue(uint64_t imsi)
 {
-
-  std::map<uint64_t,hss_ue_ctx_t*>::iterator ue_ctx_it = m_imsi_to_ue_ctx.find(imsi);
-  if(ue_ctx_it == m_imsi_to_ue_ctx.end())
+  hss_db::record_t *ue = m_db.find(imsi);
+  if(ue == NULL)
   {
-    m_hss_log->info("User not found. IMSI: %015lu\n",imsi);
-    m_hss_log->console("User not found. IMSI: %015lu\n",imsi);
-    return false;
+    m_hss_log->info("User not found. IMSI: %015" PRIu64 "\n",imsi);
+    m_hss_log->console("User not found. IMSI: %015" PRIu64 "\n",imsi);
+    return NULL;
   }
-  hss_ue_ctx_t *ue_ctx = ue_ctx_it->second;
-  m_hss_log->info("Found User %015lu\n",imsi);
-  memcpy(k, ue_ctx->key, 16);
-  memcpy(amf, ue_ctx->amf, 2);
-  memcpy(op, ue_ctx->op, 16);
-  memcpy(sqn, ue_ctx->sqn, 6);
-
-  return true;
+  m_hss_log->info("Found User %015" PRIu64 "\n",imsi);
+  return ue;
 }
 
 void 
-hss::increment_sqn(uint64_t imsi)
+hss::increment_sqn(hss_db::record_t *ue, uint32_t n)
 {
-  hss_ue_ctx_t *ue_ctx = NULL;
-  bool ret = get_ue_ctx(imsi, &ue_ctx);
-  if(ret == false)
-  {
-    return;
-  }
-
   // Awkward 48 bit sqn and doing arithmetic 
   uint64_t sqn = 0;
-  uint8_t *p = (uint8_t *)&sqn;
-
   for(int i = 0; i < 6; i++) {
-    p[5-i] = (uint8_t) ((ue_ctx->sqn[i]));
+    sqn = (sqn << 8) | ue->sqn[i];
   }
   
-  sqn++;
+  sqn += n;
   
-  m_hss_log->debug("Incremented SQN (IMSI: %" PRIu64 ") SQN: %" PRIu64 "\n", imsi, sqn);
+  m_hss_log->debug("Incremented SQN (IMSI: %" PRIu64 ") SQN: %" PRIu64 "\n", ue->imsi, sqn);
 
-  for(int i = 0; i < 6; i++){
-    ue_ctx->sqn[i] = p[5-i];
+  uint8_t sqn_bytes[6];
+  for(int i = 5; i >= 0; i--) {
+    sqn_bytes[i] = (uint8_t) sqn;
+    sqn >>= 8;
   }
+  m_db.set_sqn(ue, sqn_bytes);
 }
 
 void
-hss::set_sqn(uint64_t imsi, uint8_t *sqn)
+hss::gen_rand(uint8_t rand_[16])
 {
-  hss_ue_ctx_t *ue_ctx = NULL;
-  bool ret = get_ue_ctx(imsi, &ue_ctx);
-  if(ret == false)
+  for(int i=0;i<16;i++)
   {
-    return;
+    rand_[i]=rand()%256; //Pulls on byte at a time. It's slow, but does not depend on RAND_MAX.
   }
-  memcpy(ue_ctx->sqn, sqn, 6);
+  return;
+}
+
+uint64_t
+hss::get_nof_users()
+{
+  pthread_mutex_lock(&m_mutex);
+  uint64_t n = m_db.size();
+  pthread_mutex_unlock(&m_mutex);
+  return n;
 }
 
 void
-hss::set_last_rand(uint64_t imsi, uint8_t *rand)
+hss::get_av_metrics(hss_av_metrics_t *m)
 {
-  hss_ue_ctx_t *ue_ctx = NULL;
-  bool ret = get_ue_ctx(imsi, &ue_ctx);
-  if(ret == false)
+  pthread_mutex_lock(&m_mutex);
+  *m = m_av_metrics;
+  pthread_mutex_unlock(&m_mutex);
+}
+
+/* Auth vector precomputation */
+hss::av_cache_entry_t*
+hss::get_av_cache_entry(uint64_t imsi)
+{
+  if(m_av_batch == 0)
   {
-    return;
+    return NULL;
   }
-  memcpy(ue_ctx->last_rand, rand, 16);
-
+  std::map<uint64_t,av_cache_entry_t>::iterator it = m_av_cache.find(imsi);
+  if(it != m_av_cache.end())
+  {
+    return &it->second;
+  }
+  if(m_av_cache.size() >= m_av_cache_size)
+  {
+    // Unused vectors of the evicted IMSI only skip SQNs, which UEs accept
+    m_av_cache.erase(m_av_cache_order.front());
+    m_av_cache_order.pop_front();
+  }
+  av_cache_entry_t *entry = &m_av_cache[imsi];
+  entry->generation     = ++m_av_generation;
+  entry->refill_pending = false;
+  m_av_cache_order.push_back(imsi);
+  return entry;
 }
 
 void
-hss::get_last_rand(uint64_t imsi, uint8_t *rand)
+hss::request_av_refill(uint64_t imsi, av_cache_entry_t *entry)
 {
-  hss_ue_ctx_t *ue_ctx = NULL;
-  bool ret = get_ue_ctx(imsi, &ue_ctx);
-  if(ret == false)
+  if(!entry->refill_pending)
   {
-    return;
+    entry->refill_pending = true;
+    m_av_generator.request(imsi);
   }
-  memcpy(rand, ue_ctx->last_rand, 16);
 }
 
 void
-hss::gen_rand(uint8_t rand_[16])
+hss::refill_av_cache(uint64_t imsi)
 {
-  for(int i=0;i<16;i++)
+  uint8_t k[16];
+  uint8_t amf[2];
+  uint8_t op[16];
+  uint8_t sqn[6];
+
+  pthread_mutex_lock(&m_mutex);
+  std::map<uint64_t,av_cache_entry_t>::iterator it = m_av_cache.find(imsi);
+  hss_db::record_t *ue = m_db.find(imsi);
+  if(it == m_av_cache.end() || !it->second.refill_pending || ue == NULL)
   {
-    rand_[i]=rand()%256; //Pulls on byte at a time. It's slow, but does not depend on RAND_MAX.
+    pthread_mutex_unlock(&m_mutex);
+    return;
+  }
+  uint64_t generation = it->second.generation;
+  uint32_t nof_avs    = m_av_batch;
+  memcpy(k, ue->key, 16);
+  memcpy(amf, ue->amf, 2);
+  memcpy(op, ue->op, 16);
+  memcpy(sqn, ue->sqn, 6);
+  // Reserve the SQNs of the whole batch
+  increment_sqn(ue, nof_avs);
+  pthread_mutex_unlock(&m_mutex);
+
+  std::deque<hss_auth_vector_t> avs(nof_avs);
+  for(uint32_t i = 0; i < nof_avs; i++)
+  {
+    gen_auth_vector(k, op, amf, sqn, &avs[i]);
+    for(int j = 5; j >= 0; j--)
+    {
+      if(++sqn[j] != 0)
+      {
+        break;
+      }
+    }
   }
-  return;
-}
 
-bool hss::get_ue_ctx(uint64_t imsi, hss_ue_ctx_t **ue_ctx)
-{
-  std::map<uint64_t,hss_ue_ctx_t*>::iterator ue_ctx_it = m_imsi_to_ue_ctx.find(imsi);
-  if(ue_ctx_it == m_imsi_to_ue_ctx.end())
+  pthread_mutex_lock(&m_mutex);
+  it = m_av_cache.find(imsi);
+  if(it != m_av_cache.end() && it->second.generation == generation)
   {
-    m_hss_log->info("User not found. IMSI: %015lu\n",imsi);
-    return false;
+    it->second.avs.insert(it->second.avs.end(), avs.begin(), avs.end());
+    it->second.refill_pending = false;
+    m_av_metrics.batches++;
   }
-  
-  *ue_ctx = ue_ctx_it->second;
-  return true;
+  else
+  {
+    m_av_metrics.discarded++;
+  }
+  pthread_mutex_unlock(&m_mutex);
 }
 
-/* Helper functions*/
-std::vector<std::string>
-hss::split_string(const std::string &str, char delimiter)
+hss::av_generator::av_generator():
+  m_hss(NULL)
 {
-  std::vector<std::string> tokens;
-  std::string token;
-  std::istringstream tokenStream(str);
-
-  while (std::getline(tokenStream, token, delimiter))
-  {
-    tokens.push_back(token); 
-  }
-  return tokens;
 }
 
 void
-hss::get_uint_vec_from_hex_str(const std::string &key_str, uint8_t *key, uint len)
+hss::av_generator::init(hss *hss_)
 {
-  const char *pos =  key_str.c_str();
-
-  for (uint count = 0; count < len; count++) {
-    sscanf(pos, "%2hhx", &key[count]);
-    pos += 2;
-  }
-
-  return;
+  m_hss = hss_;
 }
 
-
-std::string 
-hss::hex_string(uint8_t *hex, int size)
+void
+hss::av_generator::request(uint64_t imsi)
 {
-  std::stringstream ss;
+  m_queue.push(imsi);
+}
 
-  ss << std::hex << std::setfill('0');
-  for(int i=0;i<size;i++) {
-    ss << std::setw(2) << static_cast<unsigned>(hex[i]);
-  }
-  return ss.str();
+void
+hss::av_generator::stop()
+{
+  m_queue.push(0);
+  wait_thread_finish();
 }
-  /*
-uint64_t
-string_to_imsi()
+
+void
+hss::av_generator::run_thread()
 {
-  uint64_t imsi = 0;
-  for(int i=0;i<=14;i++){
-    imsi  += attach_req.eps_mobile_id.imsi[i]*std::pow(10,14-i);
+  uint64_t imsi;
+  while((imsi = m_queue.wait_pop()) != 0)
+  {
+    m_hss->refill_av_cache(imsi);
   }
-  return imsi;
 }
-  */
+
 } //namespace srsepc
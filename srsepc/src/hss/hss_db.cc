@@ -0,0 +1,497 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fstream>
+#include "srsepc/hdr/hss/hss_db.h"
+
+namespace srsepc{
+
+hss_db::hss_db():
+  m_log(NULL),
+  m_journal_fd(-1),
+  m_journal_entries(0),
+  m_journal_buf_len(0)
+{
+  bzero(&m_index, sizeof(mapping_t));
+  m_index.fd = -1;
+}
+
+hss_db::~hss_db()
+{
+  close();
+}
+
+bool
+hss_db::open(std::string csv_file, std::string index_file, srslte::log *log)
+{
+  m_log = log;
+  if(index_file.empty())
+  {
+    index_file = csv_file + ".idx";
+  }
+  m_journal_file = index_file + ".journal";
+
+  struct stat csv_st;
+  bool have_csv = (stat(csv_file.c_str(), &csv_st) == 0);
+
+  mapping_t index;
+  bool have_index = map_index(index_file, &index);
+  if(have_index)
+  {
+    uint64_t n = replay_journal(&index);
+    if(n > 0)
+    {
+      m_log->info("Replayed %" PRIu64 " SQN updates from %s\n", n, m_journal_file.c_str());
+    }
+  }
+
+  if(have_csv && (!have_index ||
+                  index.hdr->csv_mtime != (int64_t) csv_st.st_mtime ||
+                  index.hdr->csv_size  != (int64_t) csv_st.st_size))
+  {
+    std::string tmp_file = index_file + ".tmp";
+    bool ok = build_index(csv_file, csv_st.st_mtime, csv_st.st_size, tmp_file, have_index ? &index : NULL);
+    if(have_index)
+    {
+      unmap_index(&index);
+    }
+    if(!ok)
+    {
+      unlink(tmp_file.c_str());
+      return false;
+    }
+    if(rename(tmp_file.c_str(), index_file.c_str()))
+    {
+      m_log->error("Error renaming %s to %s: %s\n", tmp_file.c_str(), index_file.c_str(), strerror(errno));
+      unlink(tmp_file.c_str());
+      return false;
+    }
+    have_index = map_index(index_file, &index);
+  }
+  if(!have_index)
+  {
+    m_log->error("Could not open user database %s or its index %s\n", csv_file.c_str(), index_file.c_str());
+    return false;
+  }
+  m_index = index;
+
+  m_journal_fd = ::open(m_journal_file.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  if(m_journal_fd < 0)
+  {
+    m_log->error("Error opening SQN journal %s: %s\n", m_journal_file.c_str(), strerror(errno));
+    unmap_index(&m_index);
+    return false;
+  }
+  // The journal has been replayed into the table, start it over
+  checkpoint();
+
+  m_log->info("Opened user database index %s. Users: %" PRIu64 ", slots: %" PRIu64 "\n",
+              index_file.c_str(), m_index.hdr->nof_records, m_index.hdr->nof_slots);
+  return true;
+}
+
+void
+hss_db::close()
+{
+  if(m_index.map != NULL)
+  {
+    checkpoint();
+    unmap_index(&m_index);
+  }
+  if(m_journal_fd >= 0)
+  {
+    ::close(m_journal_fd);
+    m_journal_fd = -1;
+  }
+}
+
+hss_db::record_t*
+hss_db::find(uint64_t imsi)
+{
+  if(m_index.map == NULL || imsi == 0)
+  {
+    return NULL;
+  }
+  return lookup(&m_index, imsi, false);
+}
+
+void
+hss_db::set_sqn(record_t *rec, const uint8_t *sqn)
+{
+  memcpy(rec->sqn, sqn, 6);
+  if(m_journal_fd < 0)
+  {
+    return;
+  }
+
+  journal_entry_t *e = &m_journal_buf[m_journal_buf_len++];
+  e->imsi = rec->imsi;
+  memcpy(e->sqn, sqn, 6);
+  e->check = journal_check(e);
+  m_journal_entries++;
+  if(m_journal_buf_len == JOURNAL_SYNC_INTERVAL)
+  {
+    flush_journal();
+  }
+  if(m_journal_entries >= MAX_JOURNAL_ENTRIES)
+  {
+    checkpoint();
+  }
+}
+
+void
+hss_db::flush_journal()
+{
+  size_t len = m_journal_buf_len*sizeof(journal_entry_t);
+  if(write(m_journal_fd, m_journal_buf, len) != (ssize_t) len)
+  {
+    m_log->warning("Error writing SQN journal: %s\n", strerror(errno));
+  }
+  else if(fdatasync(m_journal_fd))
+  {
+    m_log->warning("Error syncing SQN journal: %s\n", strerror(errno));
+  }
+  m_journal_buf_len = 0;
+}
+
+uint64_t
+hss_db::size()
+{
+  return m_index.hdr ? m_index.hdr->nof_records : 0;
+}
+
+void
+hss_db::checkpoint()
+{
+  if(m_index.map != NULL && msync(m_index.map, m_index.map_len, MS_SYNC))
+  {
+    m_log->warning("Error syncing user database index: %s\n", strerror(errno));
+    return;
+  }
+  // The table holds all journaled and buffered updates now
+  if(m_journal_fd >= 0 && ftruncate(m_journal_fd, 0))
+  {
+    m_log->warning("Error truncating SQN journal: %s\n", strerror(errno));
+  }
+  m_journal_entries = 0;
+  m_journal_buf_len = 0;
+}
+
+bool
+hss_db::map_index(std::string file, mapping_t *m)
+{
+  bzero(m, sizeof(mapping_t));
+  m->fd = ::open(file.c_str(), O_RDWR);
+  if(m->fd < 0)
+  {
+    return false;
+  }
+
+  struct stat st;
+  if(fstat(m->fd, &st) || st.st_size < (off_t) sizeof(header_t))
+  {
+    m_log->warning("Ignoring invalid user database index %s\n", file.c_str());
+    ::close(m->fd);
+    return false;
+  }
+
+  m->map_len = st.st_size;
+  void *p = mmap(NULL, m->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, m->fd, 0);
+  if(p == MAP_FAILED)
+  {
+    m_log->error("Error mapping user database index %s: %s\n", file.c_str(), strerror(errno));
+    ::close(m->fd);
+    return false;
+  }
+  m->map     = (uint8_t*) p;
+  m->hdr     = (header_t*) m->map;
+  m->records = (record_t*) (m->map + sizeof(header_t));
+
+  header_t *h = m->hdr;
+  if(h->magic != MAGIC || h->version != VERSION || h->record_size != sizeof(record_t) ||
+     h->nof_slots == 0 || (h->nof_slots & (h->nof_slots - 1)) || 2*h->nof_records > h->nof_slots ||
+     m->map_len != sizeof(header_t) + h->nof_slots*sizeof(record_t))
+  {
+    m_log->warning("Ignoring invalid user database index %s\n", file.c_str());
+    unmap_index(m);
+    return false;
+  }
+  return true;
+}
+
+void
+hss_db::unmap_index(mapping_t *m)
+{
+  if(m->map != NULL)
+  {
+    munmap(m->map, m->map_len);
+  }
+  if(m->fd >= 0)
+  {
+    ::close(m->fd);
+  }
+  bzero(m, sizeof(mapping_t));
+  m->fd = -1;
+}
+
+bool
+hss_db::build_index(std::string csv_file, int64_t csv_mtime, int64_t csv_size, std::string tmp_file, mapping_t *old)
+{
+  std::ifstream db_file;
+  db_file.open(csv_file.c_str(), std::ifstream::in);
+  if(!db_file.is_open())
+  {
+    return false;
+  }
+  m_log->info("Building user database index from %s\n", csv_file.c_str());
+
+  // First pass sizes the table for a load factor of at most 0.5
+  std::string line;
+  uint64_t nof_lines = 0;
+  while(std::getline(db_file, line))
+  {
+    if(!line.empty() && line[0] != '#')
+    {
+      nof_lines++;
+    }
+  }
+  uint64_t nof_slots = 2;
+  while(nof_slots < 2*nof_lines)
+  {
+    nof_slots <<= 1;
+  }
+
+  mapping_t m;
+  bzero(&m, sizeof(mapping_t));
+  m.map_len = sizeof(header_t) + nof_slots*sizeof(record_t);
+  m.fd = ::open(tmp_file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if(m.fd < 0 || ftruncate(m.fd, m.map_len))
+  {
+    m_log->error("Error creating user database index %s: %s\n", tmp_file.c_str(), strerror(errno));
+    unmap_index(&m);
+    return false;
+  }
+  void *p = mmap(NULL, m.map_len, PROT_READ | PROT_WRITE, MAP_SHARED, m.fd, 0);
+  if(p == MAP_FAILED)
+  {
+    m_log->error("Error mapping user database index %s: %s\n", tmp_file.c_str(), strerror(errno));
+    m.map = NULL;
+    unmap_index(&m);
+    return false;
+  }
+  m.map     = (uint8_t*) p;
+  m.hdr     = (header_t*) m.map;
+  m.records = (record_t*) (m.map + sizeof(header_t));
+
+  m.hdr->record_size = sizeof(record_t);
+  m.hdr->nof_slots   = nof_slots;
+  m.hdr->csv_mtime   = csv_mtime;
+  m.hdr->csv_size    = csv_size;
+
+  db_file.clear();
+  db_file.seekg(0);
+  uint64_t nof_records = 0;
+  uint32_t line_nr     = 0;
+  while(std::getline(db_file, line))
+  {
+    line_nr++;
+    if(line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+    record_t r;
+    if(!parse_csv_line(line, &r))
+    {
+      m_log->error("Error parsing UE database, line %d\n", line_nr);
+      unmap_index(&m);
+      return false;
+    }
+    record_t *rec = lookup(&m, r.imsi, true);
+    if(rec->imsi == r.imsi)
+    {
+      m_log->warning("Ignoring duplicated IMSI %015" PRIu64 " in UE database, line %d\n", r.imsi, line_nr);
+      continue;
+    }
+    // SQNs must not go backwards, keep the ones of the previous index when they are ahead
+    record_t *old_rec = old ? lookup(old, r.imsi, false) : NULL;
+    if(old_rec != NULL && memcmp(old_rec->sqn, r.sqn, 6) > 0)
+    {
+      memcpy(r.sqn, old_rec->sqn, 6);
+    }
+    *rec = r;
+    nof_records++;
+    m_log->debug("Added user from DB, IMSI: %015" PRIu64 "\n", r.imsi);
+  }
+  m.hdr->nof_records = nof_records;
+  m.hdr->version     = VERSION;
+  // Only a complete index carries the magic
+  m.hdr->magic       = MAGIC;
+
+  bool ok = (msync(m.map, m.map_len, MS_SYNC) == 0);
+  if(!ok)
+  {
+    m_log->error("Error writing user database index %s: %s\n", tmp_file.c_str(), strerror(errno));
+  }
+  unmap_index(&m);
+  return ok;
+}
+
+static bool
+hex_to_bytes(const std::string &str, size_t pos, size_t len, uint8_t *bytes, uint32_t nof_bytes)
+{
+  if(len != 2*nof_bytes)
+  {
+    return false;
+  }
+  for(uint32_t i = 0; i < nof_bytes; i++)
+  {
+    char c[3] = {str[pos + 2*i], str[pos + 2*i + 1], '\0'};
+    char *end = NULL;
+    bytes[i] = (uint8_t) strtoul(c, &end, 16);
+    if(end != c + 2)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// name,imsi,key,op,amf,sqn
+bool
+hss_db::parse_csv_line(const std::string &line, record_t *rec)
+{
+  size_t start[6];
+  size_t len[6];
+  size_t pos = 0;
+  for(uint32_t i = 0; i < 6; i++)
+  {
+    size_t end = line.find(',', pos);
+    if((end == std::string::npos) != (i == 5))
+    {
+      return false;
+    }
+    if(end == std::string::npos)
+    {
+      end = line.size();
+      // Tolerate CSV files written on Windows
+      if(end > pos && line[end - 1] == '\r')
+      {
+        end--;
+      }
+    }
+    start[i] = pos;
+    len[i]   = end - pos;
+    pos      = end + 1;
+  }
+
+  bzero(rec, sizeof(record_t));
+  rec->imsi = strtoull(line.substr(start[1], len[1]).c_str(), NULL, 10);
+  return rec->imsi != 0 &&
+         hex_to_bytes(line, start[2], len[2], rec->key, 16) &&
+         hex_to_bytes(line, start[3], len[3], rec->op,  16) &&
+         hex_to_bytes(line, start[4], len[4], rec->amf, 2)  &&
+         hex_to_bytes(line, start[5], len[5], rec->sqn, 6);
+}
+
+uint64_t
+hss_db::replay_journal(mapping_t *m)
+{
+  int fd = ::open(m_journal_file.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return 0;
+  }
+  uint64_t n = 0;
+  journal_entry_t e[256];
+  ssize_t len;
+  bool torn = false;
+  while(!torn && (len = read(fd, e, sizeof(e))) > 0)
+  {
+    for(uint32_t i = 0; i < len/sizeof(journal_entry_t); i++)
+    {
+      // Entries after a torn write are not trusted
+      if(e[i].check != journal_check(&e[i]))
+      {
+        torn = true;
+        break;
+      }
+      // The table may already hold later updates. A higher SQN is always
+      // accepted by the UE, so the larger one is kept
+      record_t *rec = e[i].imsi ? lookup(m, e[i].imsi, false) : NULL;
+      if(rec != NULL && memcmp(e[i].sqn, rec->sqn, 6) > 0)
+      {
+        memcpy(rec->sqn, e[i].sqn, 6);
+        n++;
+      }
+    }
+  }
+  ::close(fd);
+  return n;
+}
+
+hss_db::record_t*
+hss_db::lookup(mapping_t *m, uint64_t imsi, bool insert)
+{
+  uint64_t mask = m->hdr->nof_slots - 1;
+  uint64_t h    = imsi*0x9E3779B97F4A7C15ULL;
+  uint64_t idx  = (h ^ (h >> 32)) & mask;
+  // The table is at most half full, so probing always ends at an empty slot
+  while(true)
+  {
+    record_t *rec = &m->records[idx];
+    if(rec->imsi == imsi)
+    {
+      return rec;
+    }
+    if(rec->imsi == 0)
+    {
+      return insert ? rec : NULL;
+    }
+    idx = (idx + 1) & mask;
+  }
+}
+
+uint16_t
+hss_db::journal_check(const journal_entry_t *e)
+{
+  const uint8_t *b = (const uint8_t*) e;
+  uint16_t c = 0x5A5A;
+  for(uint32_t i = 0; i < 14; i++)
+  {
+    c = (uint16_t) (((c << 1) | (c >> 15)) ^ b[i]);
+  }
+  return c;
+}
+
+} // namespace srsepc
@@ -108,10 +108,14 @@ parse_args(all_args_t *args, int argc, char* argv[]) {
     ("mme.mme_bind_addr",   bpo::value<string>(&mme_bind_addr)->default_value("127.0.0.1"),"IP address of MME for S1 connnection")
     ("mme.dns_addr",        bpo::value<string>(&dns_addr)->default_value("8.8.8.8"),"IP address of the DNS server for the UEs")
     ("mme.apn",             bpo::value<string>(&mme_apn)->default_value(""),                   "Set Access Point Name (APN) for data services")
+    ("mme.nof_workers",     bpo::value<uint32_t>(&args->mme_args.nof_workers)->default_value(0),"Number of S1AP worker threads (0 handles S1AP in the MME thread)")
     ("hss.db_file",         bpo::value<string>(&hss_db_file)->default_value("ue_db.csv"),".csv file that stores UE's keys")
     ("hss.auth_algo",       bpo::value<string>(&hss_auth_algo)->default_value("milenage"),"HSS uthentication algorithm.")
+    ("hss.av_batch",        bpo::value<uint32_t>(&args->hss_args.av_batch)->default_value(0),"Number of auth vectors precomputed per IMSI (0 computes them on request)")
+    ("hss.av_cache_size",   bpo::value<uint32_t>(&args->hss_args.av_cache_size)->default_value(16384),"Maximum number of IMSIs with precomputed auth vectors")
     ("spgw.gtpu_bind_addr", bpo::value<string>(&spgw_bind_addr)->default_value("127.0.0.1"),"IP address of SP-GW for the S1-U connection")
     ("spgw.sgi_if_addr",    bpo::value<string>(&sgi_if_addr)->default_value("176.16.0.1"),"IP address of TUN interface for the SGi connection")
+    ("spgw.nof_dp_threads", bpo::value<uint32_t>(&args->spgw_args.nof_dp_threads)->default_value(0),"Number of GTP-U data plane threads (0 handles the user plane in the SP-GW thread)")
 
     ("log.s1ap_level",     bpo::value<string>(&args->log_args.s1ap_level),   "MME S1AP log level")
     ("log.s1ap_hex_limit", bpo::value<int>(&args->log_args.s1ap_hex_limit),  "MME S1AP log hex dump limit")
@@ -28,16 +28,20 @@
 #include <arpa/inet.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
 #include <netinet/sctp.h>
 #include "srsepc/hdr/mme/mme.h"
 
 namespace srsepc{
 
+const int MME_EPOLL_TIMEOUT_MS = 100;  // Period to check the running flag
+
 mme*          mme::m_instance = NULL;
 pthread_mutex_t mme_instance_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 mme::mme():
-  m_running(false)
+  m_running(false),
+  m_nof_workers(0)
 {
   m_pool = srslte::byte_buffer_pool::get_instance();     
   return;
@@ -92,8 +96,21 @@ mme::init(mme_args_t* args, srslte::log_filter *s1ap_log, srslte::log_filter *mm
     exit(-1);
   }
 
+  /*Init S1AP workers*/
+  if(args->nof_workers > MAX_WORKERS)
+  {
+    m_s1ap_log->console("Invalid number of S1AP workers %d (0 to %d)\n", args->nof_workers, MAX_WORKERS);
+    exit(-1);
+  }
+  m_nof_workers = args->nof_workers;
+  for(uint32_t i=0; i<m_nof_workers; i++)
+  {
+    m_workers[i].init(i, m_s1ap, m_s1ap_log);
+    m_workers[i].start();
+  }
+
   /*Log successful initialization*/
-  m_s1ap_log->info("MME Initialized. MCC: %d, MNC: %d\n",args->s1ap_args.mcc, args->s1ap_args.mnc);
+  m_s1ap_log->info("MME Initialized. MCC: %d, MNC: %d, S1AP workers: %d\n",args->s1ap_args.mcc, args->s1ap_args.mnc, m_nof_workers);
   m_s1ap_log->console("MME Initialized. \n");
   return 0;
 }
@@ -103,11 +120,14 @@ mme::stop()
 {
   if(m_running)
   {
-    m_s1ap->stop();
-    m_s1ap->cleanup();
     m_running = false;
-    thread_cancel();
     wait_thread_finish();
+    for(uint32_t i=0; i<m_nof_workers; i++)
+    {
+      m_workers[i].stop();
+    }
+    m_s1ap->stop();
+    m_s1ap->cleanup();
   }
   return;
 }
@@ -115,7 +135,7 @@ mme::stop()
 void
 mme::run_thread()
 {
-  srslte::byte_buffer_t *pdu = m_pool->allocate();
+  srslte::byte_buffer_t *pdu = NULL;
   uint32_t sz = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
 
   struct sockaddr_in enb_addr;
@@ -125,15 +145,56 @@ mme::run_thread()
   int rd_sz;
   int msg_flags=0;
 
+  //Get S1-MME socket
+  int s1mme = m_s1ap->get_s1_mme();
+
+  //Wait on the socket with a timeout, so that stop() does not need to cancel the thread
+  int epoll_fd = epoll_create1(0);
+  if(epoll_fd < 0)
+  {
+    m_s1ap_log->error("Failed to create epoll instance: %s\n", strerror(errno));
+    return;
+  }
+  struct epoll_event ev;
+  bzero(&ev, sizeof(ev));
+  ev.events  = EPOLLIN;
+  ev.data.fd = s1mme;
+  if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, s1mme, &ev))
+  {
+    m_s1ap_log->error("Failed to add S1-MME socket to epoll: %s\n", strerror(errno));
+    close(epoll_fd);
+    return;
+  }
+
   //Mark the thread as running
   m_running=true;
 
-  //Get S1-MME socket
-  int s1mme = m_s1ap->get_s1_mme();
   while(m_running)
   {
+    if(pdu == NULL)
+    {
+      pdu = m_pool->allocate();
+      if(pdu == NULL)
+      {
+        m_s1ap_log->error("Error allocating buffer for S1AP PDU\n");
+        usleep(MME_EPOLL_TIMEOUT_MS*1000);
+        continue;
+      }
+    }
+
     m_s1ap_log->debug("Waiting for SCTP Msg\n");
+    int n = epoll_wait(epoll_fd, &ev, 1, MME_EPOLL_TIMEOUT_MS);
+    if(n < 0 && errno != EINTR)
+    {
+      m_s1ap_log->error("Error from epoll_wait: %s\n", strerror(errno));
+    }
+    if(n <= 0)
+    {
+      continue;
+    }
+
     pdu->reset();
+    msg_flags = 0;
     rd_sz = sctp_recvmsg(s1mme, pdu->msg, sz,(struct sockaddr*) &enb_addr, &fromlen, &sri, &msg_flags);
     if (rd_sz == -1 && errno != EAGAIN){
       m_s1ap_log->error("Error reading from SCTP socket: %s", strerror(errno));
@@ -151,7 +212,15 @@ mme::run_thread()
         {
           m_s1ap_log->info("SCTP Association Shutdown. Association: %d\n",sri.sinfo_assoc_id);
           m_s1ap_log->console("SCTP Association Shutdown. Association: %d\n",sri.sinfo_assoc_id);
-          m_s1ap->delete_enb_ctx(sri.sinfo_assoc_id);
+          if(m_nof_workers > 0)
+          {
+            //Same worker as the PDUs of the association, so the shutdown is handled after them
+            m_workers[(uint32_t) sri.sinfo_assoc_id % m_nof_workers].push_shutdown(&sri);
+          }
+          else
+          {
+            m_s1ap->delete_enb_ctx(sri.sinfo_assoc_id);
+          }
         }
       }
       else
@@ -159,11 +228,97 @@ mme::run_thread()
         //Received data
         pdu->N_bytes = rd_sz;
         m_s1ap_log->info("Received S1AP msg. Size: %d\n", pdu->N_bytes);
-        m_s1ap->handle_s1ap_rx_pdu(pdu,&sri);
+        if(m_nof_workers > 0)
+        {
+          //The worker owns the buffer from here on
+          m_workers[(uint32_t) sri.sinfo_assoc_id % m_nof_workers].push_pdu(pdu, &sri);
+          pdu = NULL;
+        }
+        else
+        {
+          m_s1ap->handle_s1ap_rx_pdu(pdu,&sri);
+        }
       }
     }
   }
+  if(pdu != NULL)
+  {
+    m_pool->deallocate(pdu);
+  }
+  close(epoll_fd);
   return;
 }
 
+/*
+ * S1AP worker
+ */
+mme::worker::worker():
+  m_s1ap(NULL),
+  m_log(NULL),
+  m_pool(NULL),
+  m_id(0)
+{
+}
+
+void
+mme::worker::init(uint32_t id, s1ap *s1ap_, srslte::log *log)
+{
+  m_id   = id;
+  m_s1ap = s1ap_;
+  m_log  = log;
+  m_pool = srslte::byte_buffer_pool::get_instance();
+}
+
+void
+mme::worker::push_pdu(srslte::byte_buffer_t *pdu, struct sctp_sndrcvinfo *sri)
+{
+  work_t w;
+  w.type = WORK_PDU;
+  w.pdu  = pdu;
+  w.sri  = *sri;
+  m_queue.push(w);
+}
+
+void
+mme::worker::push_shutdown(struct sctp_sndrcvinfo *sri)
+{
+  work_t w;
+  w.type = WORK_SHUTDOWN;
+  w.pdu  = NULL;
+  w.sri  = *sri;
+  m_queue.push(w);
+}
+
+void
+mme::worker::stop()
+{
+  work_t w;
+  bzero(&w, sizeof(w));
+  w.type = WORK_EXIT;
+  m_queue.push(w);
+  wait_thread_finish();
+}
+
+void
+mme::worker::run_thread()
+{
+  while(true)
+  {
+    work_t w = m_queue.wait_pop();
+    switch(w.type)
+    {
+    case WORK_PDU:
+      m_s1ap->handle_s1ap_rx_pdu(w.pdu, &w.sri);
+      m_pool->deallocate(w.pdu);
+      break;
+    case WORK_SHUTDOWN:
+      m_s1ap->delete_enb_ctx(w.sri.sinfo_assoc_id);
+      break;
+    case WORK_EXIT:
+      m_log->debug("S1AP worker %d exiting\n", m_id);
+      return;
+    }
+  }
+}
+
 } //namespace srsepc
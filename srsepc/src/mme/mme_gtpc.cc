@@ -76,6 +76,7 @@ mme_gtpc::init(srslte::log_filter *mme_gtpc_log)
   m_mme_gtpc_log = mme_gtpc_log;
 
   m_next_ctrl_teid = 1;
+  pthread_mutex_init(&m_mutex, NULL);
 
   m_s1ap = s1ap::get_instance();
   m_mme_gtpc_ip = inet_addr("127.0.0.1");//FIXME At the moment, the GTP-C messages are not sent over the wire. So this parameter is not used.
@@ -89,7 +90,7 @@ mme_gtpc::init(srslte::log_filter *mme_gtpc_log)
 uint32_t
 mme_gtpc::get_new_ctrl_teid()
 {
-  return m_next_ctrl_teid++; //FIXME Use a Id pool?
+  return __sync_fetch_and_add(&m_next_ctrl_teid, 1); //FIXME Use a Id pool?
 }
 void
 mme_gtpc::send_create_session_request(uint64_t imsi)
@@ -128,6 +129,7 @@ mme_gtpc::send_create_session_request(uint64_t imsi)
   //cs_req->rat_type = srslte::GTPC_RAT_TYPE::EUTRAN;
 
   //Check whether this UE is already registed
+  pthread_mutex_lock(&m_mutex);
   std::map<uint64_t, struct gtpc_ctx>::iterator it = m_imsi_to_gtpc_ctx.find(imsi);
   if(it != m_imsi_to_gtpc_ctx.end())
   {
@@ -156,7 +158,7 @@ mme_gtpc::send_create_session_request(uint64_t imsi)
   gtpc_ctx.mme_ctr_fteid = cs_req->sender_f_teid;
   m_imsi_to_gtpc_ctx.insert(std::pair<uint64_t,gtpc_ctx_t>(imsi,gtpc_ctx));
   m_spgw->handle_create_session_request(cs_req, &cs_resp_pdu);
-
+  pthread_mutex_unlock(&m_mutex);
 }
 
 void
@@ -259,9 +261,11 @@ mme_gtpc::send_modify_bearer_request(uint64_t imsi, erab_ctx_t *erab_ctx)
   srslte::gtpc_pdu mb_req_pdu;
   srslte::gtp_fteid_t *enb_fteid = &erab_ctx->enb_fteid;
 
+  pthread_mutex_lock(&m_mutex);
   std::map<uint64_t,gtpc_ctx_t>::iterator it = m_imsi_to_gtpc_ctx.find(imsi);
   if(it == m_imsi_to_gtpc_ctx.end())
   {
+    pthread_mutex_unlock(&m_mutex);
     m_mme_gtpc_log->error("Modify bearer request for UE without GTP-C connection\n");
     return;
   }
@@ -286,6 +290,7 @@ mme_gtpc::send_modify_bearer_request(uint64_t imsi, erab_ctx_t *erab_ctx)
   srslte::gtpc_pdu mb_resp_pdu;
   m_spgw->handle_modify_bearer_request(&mb_req_pdu,&mb_resp_pdu);
   handle_modify_bearer_response(&mb_resp_pdu);
+  pthread_mutex_unlock(&m_mutex);
   return;
 }
 
@@ -315,9 +320,11 @@ mme_gtpc::send_delete_session_request(uint64_t imsi)
   srslte::gtp_fteid_t sgw_ctr_fteid;
   srslte::gtp_fteid_t mme_ctr_fteid;
   //Get S-GW Ctr TEID
+  pthread_mutex_lock(&m_mutex);
   std::map<uint64_t,gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if(it_ctx == m_imsi_to_gtpc_ctx.end())
   {
+      pthread_mutex_unlock(&m_mutex);
       m_mme_gtpc_log->error("Could not find GTP-C context to remove\n");
       return;
   }
@@ -348,6 +355,7 @@ mme_gtpc::send_delete_session_request(uint64_t imsi)
     m_mme_ctr_teid_to_imsi.erase(it_imsi);
   }
   m_imsi_to_gtpc_ctx.erase(it_ctx);
+  pthread_mutex_unlock(&m_mutex);
   return;
 }
 
@@ -359,9 +367,11 @@ mme_gtpc::send_release_access_bearers_request(uint64_t imsi)
   srslte::gtp_fteid_t sgw_ctr_fteid;
 
   //Get S-GW Ctr TEID
+  pthread_mutex_lock(&m_mutex);
   std::map<uint64_t,gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if(it_ctx == m_imsi_to_gtpc_ctx.end())
   {
+    pthread_mutex_unlock(&m_mutex);
     m_mme_gtpc_log->error("Could not find GTP-C context to remove\n");
     return;
   }
@@ -378,6 +388,7 @@ mme_gtpc::send_release_access_bearers_request(uint64_t imsi)
 
   srslte::gtpc_pdu rel_resp_pdu;
   m_spgw->handle_release_access_bearers_request(&rel_req_pdu, &rel_resp_pdu);
+  pthread_mutex_unlock(&m_mutex);
 
   //The GTP-C connection will not be torn down, just the user plane bearers.
   return;
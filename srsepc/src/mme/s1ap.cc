@@ -43,10 +43,18 @@ s1ap::s1ap():
   m_mme_gtpc(NULL),
   m_pool(NULL)
 {
+  pthread_mutex_init(&m_enb_mutex, NULL);
+  for (uint32_t i = 0; i < NOF_UE_SHARDS; i++) {
+    pthread_mutex_init(&m_ue_shards[i].mutex, NULL);
+  }
 }
 
 s1ap::~s1ap()
 {
+  for (uint32_t i = 0; i < NOF_UE_SHARDS; i++) {
+    pthread_mutex_destroy(&m_ue_shards[i].mutex);
+  }
+  pthread_mutex_destroy(&m_enb_mutex);
 }
 
 s1ap*
@@ -118,13 +126,19 @@ s1ap::stop()
     m_active_enbs.erase(enb_it++);
   }
 
-  std::map<uint64_t,ue_ctx_t*>::iterator ue_it = m_imsi_to_ue_ctx.begin();
-  while(ue_it!=m_imsi_to_ue_ctx.end())
+  for (uint32_t i = 0; i < NOF_UE_SHARDS; i++)
   {
-    m_s1ap_log->info("Deleting UE EMM context. IMSI: %015lu\n", ue_it->first);
-    m_s1ap_log->console("Deleting UE EMM context. IMSI: %015lu\n", ue_it->first);
-    delete ue_it->second;
-    m_imsi_to_ue_ctx.erase(ue_it++);
+    ue_shard_t *shard = &m_ue_shards[i];
+    std::map<uint64_t,ue_ctx_t*>::iterator ue_it = shard->imsi_to_ue_ctx.begin();
+    while(ue_it!=shard->imsi_to_ue_ctx.end())
+    {
+      m_s1ap_log->info("Deleting UE EMM context. IMSI: %015lu\n", ue_it->first);
+      m_s1ap_log->console("Deleting UE EMM context. IMSI: %015lu\n", ue_it->first);
+      delete ue_it->second;
+      shard->imsi_to_ue_ctx.erase(ue_it++);
+    }
+    shard->mme_ue_s1ap_id_to_ue_ctx.clear();
+    shard->tmsi_to_imsi.clear();
   }
   //Cleanup message handlers
   s1ap_mngmt_proc::cleanup();
@@ -142,7 +156,7 @@ s1ap::get_s1_mme()
 uint32_t
 s1ap::get_next_mme_ue_s1ap_id()
 {
-    return m_next_mme_ue_s1ap_id++;
+  return __sync_fetch_and_add(&m_next_mme_ue_s1ap_id, 1);
 }
 
 
@@ -297,9 +311,11 @@ s1ap::add_new_enb_ctx(const enb_ctx_t &enb_ctx, const struct sctp_sndrcvinfo *en
   std::set<uint32_t> ue_set;
   enb_ctx_t *enb_ptr = new enb_ctx_t;
   memcpy(enb_ptr,&enb_ctx,sizeof(enb_ctx_t));
+  pthread_mutex_lock(&m_enb_mutex);
   m_active_enbs.insert(std::pair<uint16_t,enb_ctx_t*>(enb_ptr->enb_id,enb_ptr));
   m_sctp_to_enb_id.insert(std::pair<int32_t,uint16_t>(enb_sri->sinfo_assoc_id, enb_ptr->enb_id));
   m_enb_id_to_ue_ids.insert(std::pair<uint16_t,std::set<uint32_t> >(enb_ptr->enb_id,ue_set));
+  pthread_mutex_unlock(&m_enb_mutex);
 
   return;
 }
@@ -307,29 +323,37 @@ s1ap::add_new_enb_ctx(const enb_ctx_t &enb_ctx, const struct sctp_sndrcvinfo *en
 enb_ctx_t*
 s1ap::find_enb_ctx(uint16_t enb_id)
 {
+  enb_ctx_t *enb_ctx = NULL;
+  pthread_mutex_lock(&m_enb_mutex);
   std::map<uint16_t,enb_ctx_t*>::iterator it = m_active_enbs.find(enb_id);
-  if(it == m_active_enbs.end())
-  {
-    return NULL;
-  }
-  else
+  if(it != m_active_enbs.end())
   {
-    return it->second;
+    enb_ctx = it->second;
   }
+  pthread_mutex_unlock(&m_enb_mutex);
+  return enb_ctx;
 }
 
 void
 s1ap::delete_enb_ctx(int32_t assoc_id)
 {
+  pthread_mutex_lock(&m_enb_mutex);
   std::map<int32_t,uint16_t>::iterator it_assoc = m_sctp_to_enb_id.find(assoc_id);
+  if(it_assoc == m_sctp_to_enb_id.end())
+  {
+    pthread_mutex_unlock(&m_enb_mutex);
+    m_s1ap_log->error("Could not find eNB to delete. Association: %d\n",assoc_id);
+    return;
+  }
   uint16_t enb_id = it_assoc->second;
 
-  std::map<uint16_t,enb_ctx_t*>::iterator it_ctx = m_active_enbs.find(enb_id);
-  if(it_ctx == m_active_enbs.end() || it_assoc == m_sctp_to_enb_id.end())
+  if(m_active_enbs.find(enb_id) == m_active_enbs.end())
   {
+    pthread_mutex_unlock(&m_enb_mutex);
     m_s1ap_log->error("Could not find eNB to delete. Association: %d\n",assoc_id);
     return;
   }
+  pthread_mutex_unlock(&m_enb_mutex);
 
   m_s1ap_log->info("Deleting eNB context. eNB Id: 0x%x\n", enb_id);
   m_s1ap_log->console("Deleting eNB context. eNB Id: 0x%x\n", enb_id);
@@ -337,34 +361,47 @@ s1ap::delete_enb_ctx(int32_t assoc_id)
   //Delete connected UEs ctx
   release_ues_ecm_ctx_in_enb(enb_id);
 
-  //Delete eNB
+  //Delete eNB. Only the worker serving this association modifies its entries.
+  pthread_mutex_lock(&m_enb_mutex);
+  std::map<uint16_t,enb_ctx_t*>::iterator it_ctx = m_active_enbs.find(enb_id);
   delete it_ctx->second;
   m_active_enbs.erase(it_ctx);
-  m_sctp_to_enb_id.erase(it_assoc);
+  m_sctp_to_enb_id.erase(assoc_id);
+  m_enb_id_to_ue_ids.erase(enb_id);
+  pthread_mutex_unlock(&m_enb_mutex);
   return;
 }
 
 
 //UE Context Management
+s1ap::ue_shard_t*
+s1ap::get_ue_shard(uint64_t key)
+{
+  // IMSIs and S1AP ids are mostly allocated in sequence, Fibonacci hashing spreads them
+  return &m_ue_shards[(key * 0x9E3779B97F4A7C15ULL) >> (64 - NOF_UE_SHARDS_LOG2)];
+}
+
 bool
 s1ap::add_ue_ctx_to_imsi_map(ue_ctx_t *ue_ctx)
 {
-  std::map<uint64_t, ue_ctx_t*>::iterator ctx_it = m_imsi_to_ue_ctx.find(ue_ctx->emm_ctx.imsi);
-  if(ctx_it != m_imsi_to_ue_ctx.end())
-  {
-    m_s1ap_log->error("UE Context already exists. IMSI %015lu",ue_ctx->emm_ctx.imsi);
-    return false;
-  }
   if(ue_ctx->ecm_ctx.mme_ue_s1ap_id != 0)
   {
-    std::map<uint32_t,ue_ctx_t*>::iterator ctx_it2 = m_mme_ue_s1ap_id_to_ue_ctx.find(ue_ctx->ecm_ctx.mme_ue_s1ap_id);
-    if(ctx_it2 != m_mme_ue_s1ap_id_to_ue_ctx.end() && ctx_it2->second != ue_ctx)
+    ue_ctx_t *ctx2 = find_ue_ctx_from_mme_ue_s1ap_id(ue_ctx->ecm_ctx.mme_ue_s1ap_id);
+    if(ctx2 != NULL && ctx2 != ue_ctx)
     {
       m_s1ap_log->error("Context identified with IMSI does not match context identified by MME UE S1AP Id.\n");
       return false;
     }
   }
-  m_imsi_to_ue_ctx.insert(std::pair<uint64_t,ue_ctx_t*>(ue_ctx->emm_ctx.imsi, ue_ctx));
+  ue_shard_t *shard = get_ue_shard(ue_ctx->emm_ctx.imsi);
+  pthread_mutex_lock(&shard->mutex);
+  bool inserted = shard->imsi_to_ue_ctx.insert(std::pair<uint64_t,ue_ctx_t*>(ue_ctx->emm_ctx.imsi, ue_ctx)).second;
+  pthread_mutex_unlock(&shard->mutex);
+  if(!inserted)
+  {
+    m_s1ap_log->error("UE Context already exists. IMSI %015lu",ue_ctx->emm_ctx.imsi);
+    return false;
+  }
   m_s1ap_log->debug("Saved UE context corresponding to IMSI %015lu\n",ue_ctx->emm_ctx.imsi);
   return true;
 }
@@ -377,22 +414,24 @@ s1ap::add_ue_ctx_to_mme_ue_s1ap_id_map(ue_ctx_t *ue_ctx)
     m_s1ap_log->error("Could not add UE context to MME UE S1AP map. MME UE S1AP ID 0 is not valid.");
     return false;
   }
-  std::map<uint32_t, ue_ctx_t*>::iterator ctx_it = m_mme_ue_s1ap_id_to_ue_ctx.find(ue_ctx->ecm_ctx.mme_ue_s1ap_id);
-  if(ctx_it != m_mme_ue_s1ap_id_to_ue_ctx.end())
-  {
-    m_s1ap_log->error("UE Context already exists. MME UE S1AP Id %015lu",ue_ctx->emm_ctx.imsi);
-    return false;
-  }
   if(ue_ctx->ecm_ctx.imsi != 0)
   {
-    std::map<uint32_t,ue_ctx_t*>::iterator ctx_it2 = m_mme_ue_s1ap_id_to_ue_ctx.find(ue_ctx->ecm_ctx.mme_ue_s1ap_id);
-    if(ctx_it2 != m_mme_ue_s1ap_id_to_ue_ctx.end() && ctx_it2->second != ue_ctx)
+    ue_ctx_t *ctx2 = find_ue_ctx_from_imsi(ue_ctx->ecm_ctx.imsi);
+    if(ctx2 != NULL && ctx2 != ue_ctx)
     {
       m_s1ap_log->error("Context identified with MME UE S1AP Id does not match context identified by IMSI.\n");
       return false;
     }
   }
-  m_mme_ue_s1ap_id_to_ue_ctx.insert(std::pair<uint32_t,ue_ctx_t*>(ue_ctx->ecm_ctx.mme_ue_s1ap_id, ue_ctx));
+  ue_shard_t *shard = get_ue_shard(ue_ctx->ecm_ctx.mme_ue_s1ap_id);
+  pthread_mutex_lock(&shard->mutex);
+  bool inserted = shard->mme_ue_s1ap_id_to_ue_ctx.insert(std::pair<uint32_t,ue_ctx_t*>(ue_ctx->ecm_ctx.mme_ue_s1ap_id, ue_ctx)).second;
+  pthread_mutex_unlock(&shard->mutex);
+  if(!inserted)
+  {
+    m_s1ap_log->error("UE Context already exists. MME UE S1AP Id %d",ue_ctx->ecm_ctx.mme_ue_s1ap_id);
+    return false;
+  }
   m_s1ap_log->debug("Saved UE context corresponding to MME UE S1AP Id %d\n",ue_ctx->ecm_ctx.mme_ue_s1ap_id);
   return true;
 }
@@ -400,44 +439,62 @@ s1ap::add_ue_ctx_to_mme_ue_s1ap_id_map(ue_ctx_t *ue_ctx)
 ue_ctx_t*
 s1ap::find_ue_ctx_from_mme_ue_s1ap_id(uint32_t mme_ue_s1ap_id)
 {
-  std::map<uint32_t, ue_ctx_t*>::iterator it = m_mme_ue_s1ap_id_to_ue_ctx.find(mme_ue_s1ap_id);
-  if(it == m_mme_ue_s1ap_id_to_ue_ctx.end())
+  ue_ctx_t *ue_ctx = NULL;
+  ue_shard_t *shard = get_ue_shard(mme_ue_s1ap_id);
+  pthread_mutex_lock(&shard->mutex);
+  std::map<uint32_t, ue_ctx_t*>::iterator it = shard->mme_ue_s1ap_id_to_ue_ctx.find(mme_ue_s1ap_id);
+  if(it != shard->mme_ue_s1ap_id_to_ue_ctx.end())
   {
-    return NULL;
-  }
-  else
-  {
-    return it->second;
+    ue_ctx = it->second;
   }
+  pthread_mutex_unlock(&shard->mutex);
+  return ue_ctx;
 }
 
 ue_ctx_t*
 s1ap::find_ue_ctx_from_imsi(uint64_t imsi)
 {
-  std::map<uint64_t, ue_ctx_t*>::iterator it = m_imsi_to_ue_ctx.find(imsi);
-  if(it == m_imsi_to_ue_ctx.end())
-  {
-    return NULL;
-  }
-  else
+  ue_ctx_t *ue_ctx = NULL;
+  ue_shard_t *shard = get_ue_shard(imsi);
+  pthread_mutex_lock(&shard->mutex);
+  std::map<uint64_t, ue_ctx_t*>::iterator it = shard->imsi_to_ue_ctx.find(imsi);
+  if(it != shard->imsi_to_ue_ctx.end())
   {
-    return it->second;
+    ue_ctx = it->second;
   }
+  pthread_mutex_unlock(&shard->mutex);
+  return ue_ctx;
 }
 
 void
 s1ap::release_ues_ecm_ctx_in_enb(uint16_t enb_id)
 {
-  //delete UEs ctx
+  //Take the eNB's UE set, the contexts are released without holding the eNB lock
+  std::set<uint32_t> ue_ids;
+  pthread_mutex_lock(&m_enb_mutex);
   std::map<uint16_t,std::set<uint32_t> >::iterator ues_in_enb = m_enb_id_to_ue_ids.find(enb_id);
-  std::set<uint32_t>::iterator ue_id = ues_in_enb->second.begin();
-  while(ue_id != ues_in_enb->second.end() )
+  if(ues_in_enb != m_enb_id_to_ue_ids.end())
   {
-    std::map<uint32_t, ue_ctx_t*>::iterator ue_ctx = m_mme_ue_s1ap_id_to_ue_ctx.find(*ue_id);
+    ue_ids.swap(ues_in_enb->second);
+  }
+  pthread_mutex_unlock(&m_enb_mutex);
+
+  for(std::set<uint32_t>::iterator ue_id = ue_ids.begin(); ue_id != ue_ids.end(); ue_id++)
+  {
+    ue_shard_t *shard = get_ue_shard(*ue_id);
+    pthread_mutex_lock(&shard->mutex);
+    std::map<uint32_t, ue_ctx_t*>::iterator ue_ctx = shard->mme_ue_s1ap_id_to_ue_ctx.find(*ue_id);
+    if(ue_ctx == shard->mme_ue_s1ap_id_to_ue_ctx.end())
+    {
+      pthread_mutex_unlock(&shard->mutex);
+      continue;
+    }
     ue_ecm_ctx_t *ecm_ctx = &ue_ctx->second->ecm_ctx;
+    shard->mme_ue_s1ap_id_to_ue_ctx.erase(ue_ctx);
+    pthread_mutex_unlock(&shard->mutex);
+
     m_s1ap_log->info("Releasing UE ECM context. UE-MME S1AP Id: %d\n", ecm_ctx->mme_ue_s1ap_id);
     m_s1ap_log->console("Releasing UE ECM context. UE-MME S1AP Id: %d\n", ecm_ctx->mme_ue_s1ap_id);
-    ues_in_enb->second.erase(ecm_ctx->mme_ue_s1ap_id);
     ecm_ctx->state = ECM_STATE_IDLE;
     ecm_ctx->mme_ue_s1ap_id = 0;
     ecm_ctx->enb_ue_s1ap_id = 0;
@@ -456,9 +513,11 @@ s1ap::release_ue_ecm_ctx(uint32_t mme_ue_s1ap_id)
   ue_ecm_ctx_t* ecm_ctx = &ue_ctx->ecm_ctx;
 
   //Delete UE within eNB UE set
+  pthread_mutex_lock(&m_enb_mutex);
   std::map<int32_t,uint16_t>::iterator it = m_sctp_to_enb_id.find(ecm_ctx->enb_sri.sinfo_assoc_id);
   if(it == m_sctp_to_enb_id.end() )
   {
+    pthread_mutex_unlock(&m_enb_mutex);
     m_s1ap_log->error("Could not find eNB for UE release request.\n");
     return false;
   }
@@ -466,13 +525,18 @@ s1ap::release_ue_ecm_ctx(uint32_t mme_ue_s1ap_id)
   std::map<uint16_t,std::set<uint32_t> >::iterator ue_set = m_enb_id_to_ue_ids.find(enb_id);
   if(ue_set == m_enb_id_to_ue_ids.end())
   {
+    pthread_mutex_unlock(&m_enb_mutex);
     m_s1ap_log->error("Could not find the eNB's UEs.\n");
     return false;
   }
   ue_set->second.erase(mme_ue_s1ap_id);
+  pthread_mutex_unlock(&m_enb_mutex);
 
   //Release UE ECM context
-  m_mme_ue_s1ap_id_to_ue_ctx.erase(mme_ue_s1ap_id);
+  ue_shard_t *shard = get_ue_shard(mme_ue_s1ap_id);
+  pthread_mutex_lock(&shard->mutex);
+  shard->mme_ue_s1ap_id_to_ue_ctx.erase(mme_ue_s1ap_id);
+  pthread_mutex_unlock(&shard->mutex);
   ecm_ctx->state = ECM_STATE_IDLE;
   ecm_ctx->mme_ue_s1ap_id = 0;
   ecm_ctx->enb_ue_s1ap_id = 0;
@@ -498,7 +562,10 @@ s1ap::delete_ue_ctx(uint64_t imsi)
   }
 
   //Delete UE context
-  m_imsi_to_ue_ctx.erase(imsi);
+  ue_shard_t *shard = get_ue_shard(imsi);
+  pthread_mutex_lock(&shard->mutex);
+  shard->imsi_to_ue_ctx.erase(imsi);
+  pthread_mutex_unlock(&shard->mutex);
   delete ue_ctx;
   m_s1ap_log->info("Deleted UE Context.\n");
   return true;
@@ -511,22 +578,21 @@ s1ap::delete_ue_ctx(uint64_t imsi)
 void
 s1ap::activate_eps_bearer(uint64_t imsi, uint8_t ebi)
 {
-  std::map<uint64_t,ue_ctx_t*>::iterator ue_ctx_it = m_imsi_to_ue_ctx.find(imsi);
-  if(ue_ctx_it == m_imsi_to_ue_ctx.end())
+  ue_ctx_t *ue_ctx = find_ue_ctx_from_imsi(imsi);
+  if(ue_ctx == NULL)
   {
     m_s1ap_log->error("Could not activate EPS bearer: Could not find UE context\n");
       return;
   }
   //Make sure NAS is active
-  uint32_t mme_ue_s1ap_id = ue_ctx_it->second->ecm_ctx.mme_ue_s1ap_id;
-  std::map<uint32_t,ue_ctx_t*>::iterator it = m_mme_ue_s1ap_id_to_ue_ctx.find(mme_ue_s1ap_id);
-  if(it == m_mme_ue_s1ap_id_to_ue_ctx.end())
+  uint32_t mme_ue_s1ap_id = ue_ctx->ecm_ctx.mme_ue_s1ap_id;
+  if(find_ue_ctx_from_mme_ue_s1ap_id(mme_ue_s1ap_id) == NULL)
   {
     m_s1ap_log->error("Could not activate EPS bearer: ECM context seems to be missing\n");
     return;
   }
 
-  ue_ecm_ctx_t * ecm_ctx = &ue_ctx_it->second->ecm_ctx;
+  ue_ecm_ctx_t * ecm_ctx = &ue_ctx->ecm_ctx;
   if (ecm_ctx->erabs_ctx[ebi].state != ERAB_CTX_SETUP)
   {
     m_s1ap_log->error("Could not be activate EPS Bearer, bearer in wrong state: MME S1AP Id %d, EPS Bearer id %d, state %d\n", mme_ue_s1ap_id, ebi, ecm_ctx->erabs_ctx[ebi].state);
@@ -543,14 +609,32 @@ s1ap::activate_eps_bearer(uint64_t imsi, uint8_t ebi)
 uint32_t
 s1ap::allocate_m_tmsi(uint64_t imsi)
 {
-  uint32_t m_tmsi = m_next_m_tmsi;
-  m_next_m_tmsi = (m_next_m_tmsi + 1) % UINT32_MAX;
+  uint32_t m_tmsi = __sync_fetch_and_add(&m_next_m_tmsi, 1);
 
-  m_tmsi_to_imsi.insert(std::pair<uint32_t,uint64_t>(m_tmsi,imsi));
+  ue_shard_t *shard = get_ue_shard(m_tmsi);
+  pthread_mutex_lock(&shard->mutex);
+  shard->tmsi_to_imsi.insert(std::pair<uint32_t,uint64_t>(m_tmsi,imsi));
+  pthread_mutex_unlock(&shard->mutex);
   m_s1ap_log->debug("Allocated M-TMSI 0x%x to IMSI %015lu,\n",m_tmsi,imsi);
   return m_tmsi;
 }
 
+bool
+s1ap::find_imsi_from_m_tmsi(uint32_t m_tmsi, uint64_t *imsi)
+{
+  bool found = false;
+  ue_shard_t *shard = get_ue_shard(m_tmsi);
+  pthread_mutex_lock(&shard->mutex);
+  std::map<uint32_t,uint64_t>::iterator it = shard->tmsi_to_imsi.find(m_tmsi);
+  if(it != shard->tmsi_to_imsi.end())
+  {
+    *imsi = it->second;
+    found = true;
+  }
+  pthread_mutex_unlock(&shard->mutex);
+  return found;
+}
+
 void
 s1ap::print_enb_ctx_info(const std::string &prefix, const enb_ctx_t &enb_ctx)
 {
@@ -549,8 +549,8 @@ s1ap_nas_transport::handle_nas_guti_attach_request(  uint32_t enb_ue_s1ap_id,
 
   //GUTI style attach
   uint32_t m_tmsi = attach_req.eps_mobile_id.guti.m_tmsi;
-  std::map<uint32_t,uint64_t>::iterator it = m_s1ap->m_tmsi_to_imsi.find(m_tmsi);
-  if(it == m_s1ap->m_tmsi_to_imsi.end())
+  uint64_t imsi = 0;
+  if(!m_s1ap->find_imsi_from_m_tmsi(m_tmsi, &imsi))
   {
 
     m_s1ap_log->console("Attach Request -- Could not find M-TMSI 0x%x\n", m_tmsi);
@@ -631,9 +631,9 @@ s1ap_nas_transport::handle_nas_guti_attach_request(  uint32_t enb_ue_s1ap_id,
   else{
 
     m_s1ap_log->console("Attach Request -- Found M-TMSI: %d\n",m_tmsi);
-    m_s1ap_log->console("Attach Request -- IMSI: %015lu\n",it->second);
+    m_s1ap_log->console("Attach Request -- IMSI: %015lu\n",imsi);
     //Get UE EMM context
-    ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(it->second);
+    ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(imsi);
     if(ue_ctx!=NULL)
     {
       ue_emm_ctx_t *emm_ctx = &ue_ctx->emm_ctx;
@@ -811,8 +811,8 @@ s1ap_nas_transport::handle_nas_service_request(uint32_t m_tmsi,
     return false;
   }
 
-  std::map<uint32_t,uint64_t>::iterator it = m_s1ap->m_tmsi_to_imsi.find(m_tmsi);
-  if(it == m_s1ap->m_tmsi_to_imsi.end())
+  uint64_t imsi = 0;
+  if(!m_s1ap->find_imsi_from_m_tmsi(m_tmsi, &imsi))
   {
     m_s1ap_log->console("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
     m_s1ap_log->error("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
@@ -821,7 +821,7 @@ s1ap_nas_transport::handle_nas_service_request(uint32_t m_tmsi,
     return true;
   }
 
-  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(it->second);
+  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(imsi);
   if(ue_ctx == NULL || ue_ctx->emm_ctx.state != EMM_STATE_REGISTERED)
   {
     m_s1ap_log->console("UE is not EMM-Registered.\n");
@@ -910,14 +910,14 @@ s1ap_nas_transport::handle_nas_detach_request(uint32_t m_tmsi,
     return false;
   }
 
-  std::map<uint32_t,uint64_t>::iterator it = m_s1ap->m_tmsi_to_imsi.find(m_tmsi);
-  if(it == m_s1ap->m_tmsi_to_imsi.end())
+  uint64_t imsi = 0;
+  if(!m_s1ap->find_imsi_from_m_tmsi(m_tmsi, &imsi))
   {
     m_s1ap_log->console("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
     m_s1ap_log->error("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
     return true;
   }
-  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(it->second);
+  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(imsi);
   ue_emm_ctx_t *emm_ctx = &ue_ctx->emm_ctx;
   ue_ecm_ctx_t *ecm_ctx = &ue_ctx->ecm_ctx;
 
@@ -970,14 +970,14 @@ s1ap_nas_transport::handle_nas_tracking_area_update_request(uint32_t m_tmsi,
   m_s1ap_log->console("Warning: Tracking area update requests are not handled yet.\n");
   m_s1ap_log->warning("Tracking area update requests are not handled yet.\n");
 
-  std::map<uint32_t,uint64_t>::iterator it = m_s1ap->m_tmsi_to_imsi.find(m_tmsi);
-  if(it == m_s1ap->m_tmsi_to_imsi.end())
+  uint64_t imsi = 0;
+  if(!m_s1ap->find_imsi_from_m_tmsi(m_tmsi, &imsi))
   {
     m_s1ap_log->console("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
     m_s1ap_log->error("Could not find IMSI from M-TMSI. M-TMSI 0x%x\n", m_tmsi);
     return true;
   }
-  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(it->second);
+  ue_ctx_t *ue_ctx = m_s1ap->find_ue_ctx_from_imsi(imsi);
   ue_emm_ctx_t *emm_ctx = &ue_ctx->emm_ctx;
   ue_ecm_ctx_t *ecm_ctx = &ue_ctx->ecm_ctx;
 
@@ -1088,7 +1088,6 @@ s1ap_nas_transport::handle_nas_attach_complete(srslte::byte_buffer_t *nas_msg, u
 
   LIBLTE_MME_ATTACH_COMPLETE_MSG_STRUCT attach_comp;
   uint8_t pd, msg_type;
-  srslte::byte_buffer_t *esm_msg = m_pool->allocate();
   LIBLTE_MME_ACTIVATE_DEFAULT_EPS_BEARER_CONTEXT_ACCEPT_MSG_STRUCT act_bearer;
 
   m_s1ap_log->info_hex(nas_msg->msg, nas_msg->N_bytes, "NAS Attach complete");
@@ -1966,6 +1965,7 @@ s1ap_nas_transport::pack_emm_information( ue_ctx_t *ue_ctx, srslte::byte_buffer_
   {
     m_s1ap_log->error("Error packing EMM Information\n");
     m_s1ap_log->console("Error packing EMM Information\n");
+    m_pool->deallocate(nas_buffer);
     return false;
   }
 
@@ -1983,6 +1983,7 @@ s1ap_nas_transport::pack_emm_information( ue_ctx_t *ue_ctx, srslte::byte_buffer_
   //Copy NAS PDU to Downlink NAS Trasport message buffer
   memcpy(dw_nas->NAS_PDU.buffer, nas_buffer->msg, nas_buffer->N_bytes);
   dw_nas->NAS_PDU.n_octets = nas_buffer->N_bytes;
+  m_pool->deallocate(nas_buffer);
 
   //Pack Downlink NAS Transport Message
   err = liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT *) reply_msg);
@@ -2033,12 +2034,14 @@ s1ap_nas_transport::pack_service_reject(srslte::byte_buffer_t *reply_msg, uint8_
   {
     m_s1ap_log->error("Error packing Service Reject\n");
     m_s1ap_log->console("Error packing Service Reject\n");
+    m_pool->deallocate(nas_buffer);
     return false;
   }
 
   //Copy NAS PDU to Downlink NAS Trasport message buffer
   memcpy(dw_nas->NAS_PDU.buffer, nas_buffer->msg, nas_buffer->N_bytes);
   dw_nas->NAS_PDU.n_octets = nas_buffer->N_bytes;
+  m_pool->deallocate(nas_buffer);
 
   //Pack Downlink NAS Transport Message
   err = liblte_s1ap_pack_s1ap_pdu(&tx_pdu, (LIBLTE_BYTE_MSG_STRUCT *) reply_msg);
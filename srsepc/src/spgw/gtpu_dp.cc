@@ -0,0 +1,612 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <linux/filter.h>
+#include "srsepc/hdr/spgw/gtpu_dp.h"
+#include "srsepc/hdr/spgw/spgw.h"
+#include "srslte/upper/gtpu.h"
+
+namespace srsepc{
+
+const int      GTPU_DP_EPOLL_TIMEOUT_MS = 100;  // Period to check the running flag
+const uint32_t GTPU_DP_MAX_PDU_BYTES    = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+const uint32_t GTPU_DP_MIN_IPV4_BYTES   = 20;
+
+/*
+ * Tunnel table
+ */
+gtpu_tunnel_table::gtpu_tunnel_table():
+  m_nof_tunnels(0)
+{
+  m_entries = new entry_t[CAPACITY];
+  memset((void*) m_entries, 0, sizeof(entry_t)*CAPACITY);
+}
+
+gtpu_tunnel_table::~gtpu_tunnel_table()
+{
+  delete [] m_entries;
+}
+
+uint32_t
+gtpu_tunnel_table::hash(in_addr_t ue_ip)
+{
+  uint32_t x = ntohl(ue_ip);
+  x ^= x >> 16;
+  x *= 0x45d9f3b;
+  x ^= x >> 16;
+  return x & (CAPACITY-1);
+}
+
+void
+gtpu_tunnel_table::write_entry(entry_t *e, in_addr_t ue_ip, uint32_t teid, in_addr_t enb_ip)
+{
+  // Odd sequence number while the entry is being written
+  e->seq++;
+  __sync_synchronize();
+  e->teid   = teid;
+  e->enb_ip = enb_ip;
+  e->ue_ip  = ue_ip;
+  __sync_synchronize();
+  e->seq++;
+}
+
+bool
+gtpu_tunnel_table::add(in_addr_t ue_ip, const srslte::gtpc_f_teid_ie &enb_fteid)
+{
+  if (ue_ip == EMPTY) {
+    return false;
+  }
+  uint32_t i = hash(ue_ip);
+  while (m_entries[i].ue_ip != EMPTY) {
+    if (m_entries[i].ue_ip == ue_ip) {
+      write_entry(&m_entries[i], ue_ip, enb_fteid.teid, enb_fteid.ipv4);
+      return true;
+    }
+    i = (i+1) & (CAPACITY-1);
+  }
+  if (m_nof_tunnels >= MAX_TUNNELS) {
+    return false;
+  }
+  write_entry(&m_entries[i], ue_ip, enb_fteid.teid, enb_fteid.ipv4);
+  m_nof_tunnels++;
+  return true;
+}
+
+bool
+gtpu_tunnel_table::rem(in_addr_t ue_ip)
+{
+  uint32_t i = hash(ue_ip);
+  while (m_entries[i].ue_ip != ue_ip) {
+    if (m_entries[i].ue_ip == EMPTY) {
+      return false;
+    }
+    i = (i+1) & (CAPACITY-1);
+  }
+
+  // Backward-shift the rest of the cluster so that no tombstones are needed
+  uint32_t j = i;
+  while (true) {
+    j = (j+1) & (CAPACITY-1);
+    if (m_entries[j].ue_ip == EMPTY) {
+      break;
+    }
+    uint32_t k = hash(m_entries[j].ue_ip);
+    // Entry j stays if its home slot k is cyclically in (i, j]
+    bool stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+    if (!stays) {
+      write_entry(&m_entries[i], m_entries[j].ue_ip, m_entries[j].teid, m_entries[j].enb_ip);
+      i = j;
+    }
+  }
+  write_entry(&m_entries[i], EMPTY, 0, 0);
+  m_nof_tunnels--;
+  return true;
+}
+
+bool
+gtpu_tunnel_table::find(in_addr_t ue_ip, srslte::gtpc_f_teid_ie *enb_fteid)
+{
+  uint32_t i = hash(ue_ip);
+  for (uint32_t n = 0; n < CAPACITY; n++) {
+    entry_t  *e = &m_entries[i];
+    uint32_t  seq;
+    in_addr_t ip;
+    uint32_t  teid;
+    in_addr_t enb_ip;
+    do {
+      seq = e->seq;
+      __sync_synchronize();
+      ip     = e->ue_ip;
+      teid   = e->teid;
+      enb_ip = e->enb_ip;
+      __sync_synchronize();
+    } while ((seq & 1) || seq != e->seq);
+
+    if (ip == ue_ip) {
+      enb_fteid->teid = teid;
+      enb_fteid->ipv4 = enb_ip;
+      return true;
+    }
+    if (ip == EMPTY) {
+      return false;
+    }
+    i = (i+1) & (CAPACITY-1);
+  }
+  return false;
+}
+
+uint32_t
+gtpu_tunnel_table::size()
+{
+  return m_nof_tunnels;
+}
+
+void
+gtpu_tunnel_table::clear()
+{
+  for (uint32_t i = 0; i < CAPACITY; i++) {
+    if (m_entries[i].ue_ip != EMPTY) {
+      write_entry(&m_entries[i], EMPTY, 0, 0);
+    }
+  }
+  m_nof_tunnels = 0;
+}
+
+/*
+ * Data plane
+ */
+gtpu_dp::gtpu_dp():
+  m_log(NULL),
+  m_tunnels(NULL),
+  m_nof_workers(0),
+  m_started(false)
+{
+  for (uint32_t i = 0; i < MAX_WORKERS; i++) {
+    m_s1u[i] = -1;
+  }
+}
+
+gtpu_dp::~gtpu_dp()
+{
+  stop();
+}
+
+static void close_fds(int *fds, uint32_t nof_fds)
+{
+  for (uint32_t i = 0; i < nof_fds; i++) {
+    if (fds[i] >= 0) {
+      close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+}
+
+srslte::error_t
+gtpu_dp::init_sgi_if(const char *dev, std::string sgi_if_addr, uint32_t nof_queues,
+                     int *sgi_fds, int *sgi_sock, srslte::log *log)
+{
+  struct ifreq ifr;
+
+  // Construct the TUN device. With more than one queue every fd is attached to
+  // its own queue and the kernel spreads the flows among them.
+  for (uint32_t q = 0; q < nof_queues; q++) {
+    sgi_fds[q] = open("/dev/net/tun", O_RDWR);
+    log->info("TUN file descriptor = %d\n", sgi_fds[q]);
+    if (sgi_fds[q] < 0) {
+      log->error("Failed to open TUN device: %s\n", strerror(errno));
+      close_fds(sgi_fds, q);
+      return srslte::ERROR_CANT_START;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+    if (nof_queues > 1) {
+      ifr.ifr_flags |= IFF_MULTI_QUEUE;
+    }
+    strncpy(ifr.ifr_ifrn.ifrn_name, dev, IFNAMSIZ-1);
+    ifr.ifr_ifrn.ifrn_name[IFNAMSIZ-1]='\0';
+
+    if (ioctl(sgi_fds[q], TUNSETIFF, &ifr) < 0) {
+      log->error("Failed to set TUN device name: %s\n", strerror(errno));
+      close_fds(sgi_fds, q+1);
+      return srslte::ERROR_CANT_START;
+    }
+  }
+
+  // Bring up the interface
+  *sgi_sock = socket(AF_INET, SOCK_DGRAM, 0);
+  if (ioctl(*sgi_sock, SIOCGIFFLAGS, &ifr) < 0) {
+    log->error("Failed to bring up socket: %s\n", strerror(errno));
+    close_fds(sgi_fds, nof_queues);
+    close(*sgi_sock);
+    return srslte::ERROR_CANT_START;
+  }
+  ifr.ifr_flags |= IFF_UP | IFF_RUNNING;
+  if (ioctl(*sgi_sock, SIOCSIFFLAGS, &ifr) < 0) {
+    log->error("Failed to set socket flags: %s\n", strerror(errno));
+    close_fds(sgi_fds, nof_queues);
+    close(*sgi_sock);
+    return srslte::ERROR_CANT_START;
+  }
+
+  // Set IP of the interface
+  struct sockaddr_in *addr = (struct sockaddr_in*)&ifr.ifr_addr;
+  addr->sin_family = AF_INET;
+  addr->sin_addr.s_addr = inet_addr(sgi_if_addr.c_str());
+  addr->sin_port = 0;
+  if (ioctl(*sgi_sock, SIOCSIFADDR, &ifr) < 0) {
+    log->error("Failed to set TUN interface IP. Address: %s, Error: %s\n", sgi_if_addr.c_str(), strerror(errno));
+    close_fds(sgi_fds, nof_queues);
+    close(*sgi_sock);
+    return srslte::ERROR_CANT_START;
+  }
+
+  ifr.ifr_netmask.sa_family                                 = AF_INET;
+  ((struct sockaddr_in *)&ifr.ifr_netmask)->sin_addr.s_addr = inet_addr("255.255.255.0");
+  if (ioctl(*sgi_sock, SIOCSIFNETMASK, &ifr) < 0) {
+    log->error("Failed to set TUN interface Netmask. Error: %s\n", strerror(errno));
+    close_fds(sgi_fds, nof_queues);
+    close(*sgi_sock);
+    return srslte::ERROR_CANT_START;
+  }
+  return srslte::ERROR_NONE;
+}
+
+srslte::error_t
+gtpu_dp::open_s1u(struct sockaddr_in *s1u_addr, int *s1u_fd)
+{
+  *s1u_fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (*s1u_fd < 0) {
+    m_log->error("Failed to open socket: %s\n", strerror(errno));
+    return srslte::ERROR_CANT_START;
+  }
+  int enable = 1;
+  if (setsockopt(*s1u_fd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable))) {
+    m_log->error("Failed to set SO_REUSEPORT: %s\n", strerror(errno));
+    close(*s1u_fd);
+    return srslte::ERROR_CANT_START;
+  }
+  if (bind(*s1u_fd, (struct sockaddr*) s1u_addr, sizeof(struct sockaddr_in))) {
+    m_log->error("Failed to bind socket: %s\n", strerror(errno));
+    close(*s1u_fd);
+    return srslte::ERROR_CANT_START;
+  }
+  return srslte::ERROR_NONE;
+}
+
+srslte::error_t
+gtpu_dp::init(uint32_t nof_workers, int *sgi_fds, struct sockaddr_in *s1u_addr,
+              gtpu_tunnel_table *tunnels, srslte::log *log)
+{
+  if (nof_workers == 0 || nof_workers > MAX_WORKERS) {
+    log->error("Invalid number of GTP-U data plane workers %d (1 to %d)\n", nof_workers, MAX_WORKERS);
+    return srslte::ERROR_CANT_START;
+  }
+  m_log         = log;
+  m_tunnels     = tunnels;
+  m_nof_workers = nof_workers;
+
+  // One S1-U socket per worker, all bound to the same address
+  for (uint32_t i = 0; i < m_nof_workers; i++) {
+    if (open_s1u(s1u_addr, &m_s1u[i]) != srslte::ERROR_NONE) {
+      close_fds(m_s1u, i);
+      return srslte::ERROR_CANT_START;
+    }
+  }
+
+  // Steer uplink to the socket with index TEID % nof_workers, so that every
+  // tunnel is always served by the same worker. Sockets join the reuseport
+  // group in bind order. The TEID is at offset 4 of the UDP payload.
+  if (m_nof_workers > 1) {
+    struct sock_filter code[] = {
+      BPF_STMT(BPF_LD  | BPF_W   | BPF_ABS, 4),
+      BPF_STMT(BPF_ALU | BPF_MOD | BPF_K,   m_nof_workers),
+      BPF_STMT(BPF_RET | BPF_A,             0),
+    };
+    struct sock_fprog prog;
+    prog.len    = sizeof(code)/sizeof(code[0]);
+    prog.filter = code;
+    if (setsockopt(m_s1u[0], SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog))) {
+      m_log->warning("Could not attach S1-U TEID steering program, using kernel flow hash: %s\n", strerror(errno));
+    }
+  }
+
+  for (uint32_t i = 0; i < m_nof_workers; i++) {
+    if (m_workers[i].init(i, sgi_fds[i], m_s1u[i], m_tunnels, m_log) != srslte::ERROR_NONE) {
+      close_fds(m_s1u, m_nof_workers);
+      return srslte::ERROR_CANT_START;
+    }
+  }
+
+  m_log->info("GTP-U data plane initialized with %d workers\n", m_nof_workers);
+  return srslte::ERROR_NONE;
+}
+
+void
+gtpu_dp::start(int prio)
+{
+  for (uint32_t i = 0; i < m_nof_workers; i++) {
+    m_workers[i].start(prio);
+  }
+  m_started = true;
+}
+
+void
+gtpu_dp::stop()
+{
+  if (m_started) {
+    for (uint32_t i = 0; i < m_nof_workers; i++) {
+      m_workers[i].stop();
+    }
+    m_started = false;
+  }
+  close_fds(m_s1u, m_nof_workers);
+}
+
+void
+gtpu_dp::get_metrics(gtpu_dp_metrics_t *m)
+{
+  bzero(m, sizeof(gtpu_dp_metrics_t));
+  for (uint32_t i = 0; i < m_nof_workers; i++) {
+    m_workers[i].get_metrics(m);
+  }
+}
+
+/*
+ * Worker
+ */
+gtpu_dp::worker::worker():
+  m_tunnels(NULL),
+  m_log(NULL),
+  m_id(0),
+  m_epoll(-1),
+  m_sgi(-1),
+  m_s1u(-1),
+  m_running(false)
+{
+  bzero(&m_metrics, sizeof(gtpu_dp_metrics_t));
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    m_rx_buf[i] = NULL;
+    m_tx_buf[i] = NULL;
+  }
+}
+
+gtpu_dp::worker::~worker()
+{
+  if (m_epoll >= 0) {
+    close(m_epoll);
+  }
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    delete m_rx_buf[i];
+    delete m_tx_buf[i];
+  }
+}
+
+srslte::error_t
+gtpu_dp::worker::init(uint32_t id, int sgi_fd, int s1u_fd, gtpu_tunnel_table *tunnels, srslte::log *log)
+{
+  m_id      = id;
+  m_sgi     = sgi_fd;
+  m_s1u     = s1u_fd;
+  m_tunnels = tunnels;
+  m_log     = log;
+
+  // The SGi queue is drained until EAGAIN on every wake-up
+  int flags = fcntl(m_sgi, F_GETFL, 0);
+  if (flags < 0 || fcntl(m_sgi, F_SETFL, flags | O_NONBLOCK) < 0) {
+    m_log->error("Failed to set SGi queue %d non-blocking: %s\n", m_id, strerror(errno));
+    return srslte::ERROR_CANT_START;
+  }
+
+  m_epoll = epoll_create1(0);
+  if (m_epoll < 0) {
+    m_log->error("Failed to create epoll instance: %s\n", strerror(errno));
+    return srslte::ERROR_CANT_START;
+  }
+  struct epoll_event ev;
+  bzero(&ev, sizeof(ev));
+  ev.events  = EPOLLIN;
+  ev.data.fd = m_s1u;
+  if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_s1u, &ev)) {
+    m_log->error("Failed to add S1-U socket to epoll: %s\n", strerror(errno));
+    return srslte::ERROR_CANT_START;
+  }
+  ev.data.fd = m_sgi;
+  if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_sgi, &ev)) {
+    m_log->error("Failed to add SGi interface to epoll: %s\n", strerror(errno));
+    return srslte::ERROR_CANT_START;
+  }
+
+  // The buffers and message headers are set up once. reset() always restores
+  // msg to the same offset, so the iovecs only need updating on transmission.
+  bzero(m_rx_msg, sizeof(m_rx_msg));
+  bzero(m_tx_msg, sizeof(m_tx_msg));
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    if (m_rx_buf[i] == NULL) {
+      m_rx_buf[i] = new srslte::byte_buffer_t;
+      m_tx_buf[i] = new srslte::byte_buffer_t;
+    }
+    m_rx_iov[i].iov_base = m_rx_buf[i]->msg;
+    m_rx_iov[i].iov_len  = GTPU_DP_MAX_PDU_BYTES;
+    m_rx_msg[i].msg_hdr.msg_iov    = &m_rx_iov[i];
+    m_rx_msg[i].msg_hdr.msg_iovlen = 1;
+
+    bzero(&m_tx_addr[i], sizeof(struct sockaddr_in));
+    m_tx_addr[i].sin_family = AF_INET;
+    m_tx_addr[i].sin_port   = htons(GTPU_RX_PORT);
+    m_tx_msg[i].msg_hdr.msg_name    = &m_tx_addr[i];
+    m_tx_msg[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+    m_tx_msg[i].msg_hdr.msg_iov     = &m_tx_iov[i];
+    m_tx_msg[i].msg_hdr.msg_iovlen  = 1;
+  }
+
+  m_running = true;
+  return srslte::ERROR_NONE;
+}
+
+void
+gtpu_dp::worker::stop()
+{
+  m_running = false;
+  wait_thread_finish();
+}
+
+void
+gtpu_dp::worker::get_metrics(gtpu_dp_metrics_t *m)
+{
+  m->ul_pkts    += m_metrics.ul_pkts;
+  m->ul_bytes   += m_metrics.ul_bytes;
+  m->ul_dropped += m_metrics.ul_dropped;
+  m->dl_pkts    += m_metrics.dl_pkts;
+  m->dl_bytes   += m_metrics.dl_bytes;
+  m->dl_dropped += m_metrics.dl_dropped;
+}
+
+void
+gtpu_dp::worker::run_thread()
+{
+  struct epoll_event events[2];
+  while (m_running) {
+    int n = epoll_wait(m_epoll, events, 2, GTPU_DP_EPOLL_TIMEOUT_MS);
+    if (n < 0) {
+      if (errno != EINTR) {
+        m_log->error("Error from epoll_wait: %s\n", strerror(errno));
+      }
+      continue;
+    }
+    for (int i = 0; i < n; i++) {
+      if (events[i].data.fd == m_s1u) {
+        handle_s1u();
+      } else {
+        handle_sgi();
+      }
+    }
+  }
+}
+
+void
+gtpu_dp::worker::handle_s1u()
+{
+  int n = recvmmsg(m_s1u, m_rx_msg, BATCH_SIZE, MSG_DONTWAIT, NULL);
+  if (n < 0) {
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+      m_log->error("Error receiving from S1-U: %s\n", strerror(errno));
+    }
+    return;
+  }
+
+  for (int i = 0; i < n; i++) {
+    srslte::byte_buffer_t *msg = m_rx_buf[i];
+    msg->reset();
+    msg->N_bytes = m_rx_msg[i].msg_len;
+
+    srslte::gtpu_header_t header;
+    if (msg->N_bytes < GTPU_HEADER_LEN || !srslte::gtpu_read_header(msg, &header)) {
+      m_metrics.ul_dropped++;
+      continue;
+    }
+    // TUN has no batched write, one syscall per packet
+    if (write(m_sgi, msg->msg, msg->N_bytes) < 0) {
+      m_metrics.ul_dropped++;
+    } else {
+      m_metrics.ul_pkts++;
+      m_metrics.ul_bytes += msg->N_bytes;
+    }
+  }
+}
+
+void
+gtpu_dp::worker::handle_sgi()
+{
+  uint32_t nof_pkts = 0;
+  while (nof_pkts < BATCH_SIZE) {
+    srslte::byte_buffer_t *msg = m_tx_buf[nof_pkts];
+    msg->reset();
+    int len = read(m_sgi, msg->msg, GTPU_DP_MAX_PDU_BYTES);
+    if (len <= 0) {
+      if (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        m_log->error("Error reading from SGi: %s\n", strerror(errno));
+      }
+      break;
+    }
+    msg->N_bytes = len;
+
+    if (msg->N_bytes < GTPU_DP_MIN_IPV4_BYTES || (msg->msg[0]>>4) != 4) {
+      m_metrics.dl_dropped++;
+      continue;
+    }
+    in_addr_t dest_ip;
+    memcpy(&dest_ip, &msg->msg[16], sizeof(in_addr_t));
+
+    srslte::gtpc_f_teid_ie enb_fteid;
+    if (!m_tunnels->find(dest_ip, &enb_fteid)) {
+      m_metrics.dl_dropped++;
+      continue;
+    }
+
+    srslte::gtpu_header_t header;
+    header.flags        = 0x30;
+    header.message_type = 0xFF;
+    header.length       = msg->N_bytes;
+    header.teid         = enb_fteid.teid;
+    if (!srslte::gtpu_write_header(&header, msg)) {
+      m_metrics.dl_dropped++;
+      continue;
+    }
+
+    m_tx_iov[nof_pkts].iov_base          = msg->msg;
+    m_tx_iov[nof_pkts].iov_len           = msg->N_bytes;
+    m_tx_addr[nof_pkts].sin_addr.s_addr  = enb_fteid.ipv4;
+    nof_pkts++;
+  }
+
+  uint32_t nof_sent = 0;
+  while (nof_sent < nof_pkts) {
+    int n = sendmmsg(m_s1u, &m_tx_msg[nof_sent], nof_pkts - nof_sent, 0);
+    if (n <= 0) {
+      m_log->error("Error sending packets to eNB: %s\n", strerror(errno));
+      m_metrics.dl_dropped += nof_pkts - nof_sent;
+      break;
+    }
+    for (int i = 0; i < n; i++) {
+      m_metrics.dl_pkts++;
+      m_metrics.dl_bytes += m_tx_msg[nof_sent + i].msg_len;
+    }
+    nof_sent += n;
+  }
+}
+
+} // namespace srsepc
@@ -49,6 +49,7 @@ spgw::spgw():
   m_running(false),
   m_sgi_up(false),
   m_s1u_up(false),
+  m_nof_dp_threads(0),
   m_next_ctrl_teid(1),
   m_next_user_teid(1)
 {
@@ -91,6 +92,7 @@ spgw::init(spgw_args_t* args, srslte::log_filter *spgw_log)
   //Init log
   m_spgw_log = spgw_log;
   m_mme_gtpc = mme_gtpc::get_instance();
+  m_nof_dp_threads = args->nof_dp_threads;
 
   //Init SGi interface
   err = init_sgi_if(args);
@@ -128,13 +130,23 @@ spgw::stop()
   if(m_running)
   {
     m_running = false;
-    thread_cancel();
+    if(m_nof_dp_threads > 0)
+    {
+      m_dp.stop();
+    }
+    else
+    {
+      thread_cancel();
+    }
     wait_thread_finish();
 
     //Clean up SGi interface
     if(m_sgi_up)
     {
-      close(m_sgi_if);
+      for(uint32_t i=0; i<std::max(m_nof_dp_threads,(uint32_t)1); i++)
+      {
+        close(m_sgi_fds[i]);
+      }
       close(m_sgi_sock);
     }
     //Clean up S1-U socket
@@ -158,73 +170,26 @@ srslte::error_t
 spgw::init_sgi_if(spgw_args_t *args)
 {
   char dev[IFNAMSIZ] = "srs_spgw_sgi";
-  struct ifreq ifr;
 
   if(m_sgi_up)
   {
     return(srslte::ERROR_ALREADY_STARTED);
   }
 
-
-  // Construct the TUN device
-  m_sgi_if = open("/dev/net/tun", O_RDWR);
-  m_spgw_log->info("TUN file descriptor = %d\n", m_sgi_if);
-  if(m_sgi_if < 0)
+  //One TUN queue per data plane worker
+  uint32_t nof_queues = std::max(m_nof_dp_threads,(uint32_t)1);
+  if(nof_queues > gtpu_dp::MAX_WORKERS)
   {
-      m_spgw_log->error("Failed to open TUN device: %s\n", strerror(errno));
-      return(srslte::ERROR_CANT_START);
+    m_spgw_log->error("Too many data plane threads %d (max %d)\n", nof_queues, gtpu_dp::MAX_WORKERS);
+    return(srslte::ERROR_CANT_START);
   }
 
-  memset(&ifr, 0, sizeof(ifr));
-  ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
-  strncpy(ifr.ifr_ifrn.ifrn_name, dev, IFNAMSIZ-1);
-  ifr.ifr_ifrn.ifrn_name[IFNAMSIZ-1]='\0';
-
-  if(ioctl(m_sgi_if, TUNSETIFF, &ifr) < 0)
+  srslte::error_t err = gtpu_dp::init_sgi_if(dev, args->sgi_if_addr, nof_queues, m_sgi_fds, &m_sgi_sock, m_spgw_log);
+  if(err != srslte::ERROR_NONE)
   {
-      m_spgw_log->error("Failed to set TUN device name: %s\n", strerror(errno));
-      close(m_sgi_if);
-      return(srslte::ERROR_CANT_START);
-  }
-
-  // Bring up the interface
-  m_sgi_sock = socket(AF_INET, SOCK_DGRAM, 0);
-
-  if(ioctl(m_sgi_sock, SIOCGIFFLAGS, &ifr) < 0)
-  {
-      m_spgw_log->error("Failed to bring up socket: %s\n", strerror(errno));
-      close(m_sgi_if);
-      return(srslte::ERROR_CANT_START);
-  }
-  ifr.ifr_flags |= IFF_UP | IFF_RUNNING;
-  if(ioctl(m_sgi_sock, SIOCSIFFLAGS, &ifr) < 0)
-  {
-      m_spgw_log->error("Failed to set socket flags: %s\n", strerror(errno));
-      close(m_sgi_if);
-      return(srslte::ERROR_CANT_START);
-  }
-
-  //Set IP of the interface
-  struct sockaddr_in *addr = (struct sockaddr_in*)&ifr.ifr_addr;
-  addr->sin_family = AF_INET;
-  addr->sin_addr.s_addr = inet_addr(args->sgi_if_addr.c_str());
-  addr->sin_port = 0;
-
-  if (ioctl(m_sgi_sock, SIOCSIFADDR, &ifr) < 0) {
-    m_spgw_log->error("Failed to set TUN interface IP. Address: %s, Error: %s\n", args->sgi_if_addr.c_str(), strerror(errno));
-    close(m_sgi_if);
-    close(m_sgi_sock);
-    return srslte::ERROR_CANT_START;
-  }
-
-  ifr.ifr_netmask.sa_family                                 = AF_INET;
-  ((struct sockaddr_in *)&ifr.ifr_netmask)->sin_addr.s_addr = inet_addr("255.255.255.0");
-  if (ioctl(m_sgi_sock, SIOCSIFNETMASK, &ifr) < 0) {
-    m_spgw_log->error("Failed to set TUN interface Netmask. Error: %s\n", strerror(errno));
-    close(m_sgi_if);
-    close(m_sgi_sock);
-    return srslte::ERROR_CANT_START;
+    return err;
   }
+  m_sgi_if = m_sgi_fds[0];
 
   //Set initial time of setup
   gettimeofday(&m_t_last_dl, NULL);
@@ -236,6 +201,17 @@ spgw::init_sgi_if(spgw_args_t *args)
 srslte::error_t
 spgw::init_s1u(spgw_args_t *args)
 {
+  m_s1u_addr.sin_family = AF_INET;
+  m_s1u_addr.sin_addr.s_addr=inet_addr(args->gtpu_bind_addr.c_str());
+  m_s1u_addr.sin_port=htons(GTPU_RX_PORT);
+
+  //The data plane workers open their own S1-U sockets
+  if(m_nof_dp_threads > 0)
+  {
+    m_spgw_log->info("S1-U IP = %s, Port = %d, %d data plane threads\n", inet_ntoa(m_s1u_addr.sin_addr),ntohs(m_s1u_addr.sin_port),m_nof_dp_threads);
+    return m_dp.init(m_nof_dp_threads, m_sgi_fds, &m_s1u_addr, &m_ip_to_teid, m_spgw_log);
+  }
+
   //Open S1-U socket
   m_s1u = socket(AF_INET,SOCK_DGRAM,0);
   if (m_s1u == -1)
@@ -246,10 +222,6 @@ spgw::init_s1u(spgw_args_t *args)
   m_s1u_up = true;
 
   //Bind the socket
-  m_s1u_addr.sin_family = AF_INET;
-  m_s1u_addr.sin_addr.s_addr=inet_addr(args->gtpu_bind_addr.c_str());
-  m_s1u_addr.sin_port=htons(GTPU_RX_PORT);
-
   if (bind(m_s1u,(struct sockaddr *)&m_s1u_addr,sizeof(struct sockaddr_in))) {
     m_spgw_log->error("Failed to bind socket: %s\n", strerror(errno));
     return srslte::ERROR_CANT_START;
@@ -272,6 +244,14 @@ spgw::run_thread()
 {
   //Mark the thread as running
   m_running=true;
+
+  //The workers handle the user plane, nothing left to do in this thread
+  if(m_nof_dp_threads > 0)
+  {
+    m_dp.start();
+    return;
+  }
+
   srslte::byte_buffer_t *msg;
   msg = m_pool->allocate();
 
@@ -325,8 +305,6 @@ spgw::handle_sgi_pdu(srslte::byte_buffer_t *msg)
   uint8_t version=0;
   uint32_t dest_ip;
   struct in_addr dest_addr;
-  std::map<uint32_t,srslte::gtpc_f_teid_ie>::iterator gtp_fteid_it;
-  bool ip_found = false;
   srslte::gtpc_f_teid_ie enb_fteid;
 
   struct timeval t_now, t_delta;
@@ -342,16 +320,7 @@ spgw::handle_sgi_pdu(srslte::byte_buffer_t *msg)
   //m_spgw_log->console("IP version: %d\n", version);
   //m_spgw_log->console("Received packet to IP: %s\n", inet_ntoa(dest_addr));
 
-  pthread_mutex_lock(&m_mutex);
-  gtp_fteid_it = m_ip_to_teid.find(dest_ip);
-  if(gtp_fteid_it != m_ip_to_teid.end())
-  {
-    ip_found = true;
-    enb_fteid = gtp_fteid_it->second;
-  }
-  pthread_mutex_unlock(&m_mutex);
-
-  if(ip_found == false)
+  if(!m_ip_to_teid.find(dest_ip, &enb_fteid))
   {
     //m_spgw_log->console("IP Packet is not for any UE\n");
     return;
@@ -481,12 +450,9 @@ spgw::delete_gtp_ctx(uint32_t ctrl_teid)
   tunnel_ctx = m_teid_to_tunnel_ctx[ctrl_teid];
 
   //Remove GTP-U connections, if any.
-  if(m_ip_to_teid.count(tunnel_ctx->ue_ipv4))
-  {
-    pthread_mutex_lock(&m_mutex);
-    m_ip_to_teid.erase(tunnel_ctx->ue_ipv4);
-    pthread_mutex_unlock(&m_mutex);   
-  }
+  pthread_mutex_lock(&m_mutex);
+  m_ip_to_teid.rem(tunnel_ctx->ue_ipv4);
+  pthread_mutex_unlock(&m_mutex);
   //Remove Ctrl TEID from IMSI to control TEID map
   m_imsi_to_ctr_teid.erase(tunnel_ctx->imsi);
 
@@ -588,8 +554,10 @@ spgw::handle_modify_bearer_request(struct srslte::gtpc_pdu *mb_req_pdu, struct s
   //Setup IP to F-TEID map
   //bool ret = false;
   pthread_mutex_lock(&m_mutex);
-  m_ip_to_teid[tunnel_ctx->ue_ipv4]=tunnel_ctx->dw_user_fteid;
-  //ret = m_ip_to_teid.insert(std::pair<uint32_t,srslte::gtpc_f_teid_ie>(tunnel_ctx->ue_ipv4, tunnel_ctx->dw_user_fteid));
+  if(!m_ip_to_teid.add(tunnel_ctx->ue_ipv4, tunnel_ctx->dw_user_fteid))
+  {
+    m_spgw_log->error("Could not add downlink tunnel, table full\n");
+  }
   pthread_mutex_unlock(&m_mutex);
 
   //Setting up Modify bearer response PDU
@@ -624,11 +592,7 @@ spgw::handle_delete_session_request(struct srslte::gtpc_pdu *del_req_pdu, struct
 
   //Delete data tunnel
   pthread_mutex_lock(&m_mutex);
-  std::map<in_addr_t,srslte::gtp_fteid_t>::iterator data_it = m_ip_to_teid.find(tunnel_ctx->ue_ipv4);
-  if(data_it != m_ip_to_teid.end())
-  {
-    m_ip_to_teid.erase(data_it);
-  }
+  m_ip_to_teid.rem(tunnel_ctx->ue_ipv4);
   pthread_mutex_unlock(&m_mutex);
   m_teid_to_tunnel_ctx.erase(tunnel_it);
 
@@ -652,11 +616,7 @@ spgw::handle_release_access_bearers_request(struct srslte::gtpc_pdu *rel_req_pdu
 
   //Delete data tunnel
   pthread_mutex_lock(&m_mutex);
-  std::map<in_addr_t,srslte::gtpc_f_teid_ie>::iterator data_it = m_ip_to_teid.find(tunnel_ctx->ue_ipv4);
-  if(data_it != m_ip_to_teid.end())
-  {
-    m_ip_to_teid.erase(data_it);
-  }
+  m_ip_to_teid.rem(tunnel_ctx->ue_ipv4);
   pthread_mutex_unlock(&m_mutex);
 
   //Do NOT delete control tunnel
@@ -0,0 +1,317 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* HSS benchmark. Writes a user database with the given number of
+ * subscribers, measures the HSS startup time with and without a ready index
+ * and the rate of authentication info answers, computed on request and
+ * precomputed in the background. The SQN of every answer is recovered from
+ * its AUTN and checked to increase across HSS restarts.
+ */
+
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "srsepc/hdr/hss/hss.h"
+#include "srslte/common/log_filter.h"
+#include "srslte/common/logger_stdout.h"
+#include "srslte/common/security.h"
+
+#define IMSI_BASE     ((uint64_t) 1010000000000ULL)  // 001010000000000
+#define SUBSCR_OP     "63bfa50ee6523365ff14c1f45f88737d"
+#define SUBSCR_AMF    "8000"
+#define SUBSCR_SQN    ((uint64_t) 0x1234)
+
+uint32_t nof_users    = 1000000;
+uint32_t av_batch     = 4;
+uint32_t nof_requests = 100000;
+char    *dir          = (char*) ".";
+char    *auth_algo    = (char*) "milenage";
+
+void usage(char *prog) {
+  printf("Usage: %s [nbrda]\n", prog);
+  printf("\t-n number of subscribers [Default %d]\n", nof_users);
+  printf("\t-b auth vectors precomputed per IMSI [Default %d]\n", av_batch);
+  printf("\t-r number of auth info requests [Default %d]\n", nof_requests);
+  printf("\t-d directory for the user database and its index [Default %s]\n", dir);
+  printf("\t-a authentication algorithm, xor or milenage [Default %s]\n", auth_algo);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "nbrda")) != -1) {
+    switch(opt) {
+    case 'n':
+      nof_users = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'b':
+      av_batch = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'r':
+      nof_requests = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'd':
+      dir = argv[optind];
+      break;
+    case 'a':
+      auth_algo = argv[optind];
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (nof_users == 0 || nof_requests == 0 || av_batch == 0) {
+    printf("Number of subscribers, requests and batch size must be at least 1\n");
+    exit(-1);
+  }
+  if (strcmp(auth_algo, "xor") && strcmp(auth_algo, "milenage")) {
+    printf("Unknown authentication algorithm %s\n", auth_algo);
+    exit(-1);
+  }
+}
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static void user_key(uint32_t idx, uint8_t *k) {
+  uint64_t x = (idx + 1)*0x9E3779B97F4A7C15ULL;
+  for (int i = 0; i < 8; i++) {
+    k[i]   = (uint8_t) (x >> (8*i));
+    k[8+i] = (uint8_t) ~(x >> (8*i));
+  }
+}
+
+static bool write_db(std::string file) {
+  FILE *f = fopen(file.c_str(), "w");
+  if (f == NULL) {
+    perror("fopen");
+    return false;
+  }
+  fprintf(f, "# Name,IMSI,Key,OP,AMF,SQN\n");
+  for (uint32_t i = 0; i < nof_users; i++) {
+    uint8_t k[16];
+    user_key(i, k);
+    fprintf(f, "ue%d,%015" PRIu64 ",", i, IMSI_BASE + i);
+    for (int j = 0; j < 16; j++) {
+      fprintf(f, "%02x", k[j]);
+    }
+    fprintf(f, ",%s,%s,%012" PRIx64 "\n", SUBSCR_OP, SUBSCR_AMF, SUBSCR_SQN);
+  }
+  fclose(f);
+  return true;
+}
+
+static uint8_t op[16];
+
+// SQN = (SQN xor AK) xor AK
+static uint64_t recover_sqn(uint32_t idx, uint8_t *rand, uint8_t *autn) {
+  uint8_t k[16];
+  uint8_t res[16];
+  uint8_t ck[16];
+  uint8_t ik[16];
+  uint8_t ak[6];
+  user_key(idx, k);
+  if (!strcmp(auth_algo, "milenage")) {
+    srslte::security_milenage_f2345(k, op, rand, res, ck, ik, ak);
+  } else {
+    for (int i = 0; i < 6; i++) {
+      ak[i] = k[i+3] ^ rand[i+3];
+    }
+  }
+  uint64_t sqn = 0;
+  for (int i = 0; i < 6; i++) {
+    sqn = (sqn << 8) | (uint8_t) (autn[i] ^ ak[i]);
+  }
+  return sqn;
+}
+
+typedef struct {
+  uint8_t rand[16];
+  uint8_t autn[16];
+} answer_t;
+
+static bool request(srsepc::hss *hss, uint32_t idx, answer_t *a) {
+  uint8_t k_asme[32];
+  uint8_t xres[16];
+  if (!hss->gen_auth_info_answer(IMSI_BASE + idx, k_asme, a->autn, a->rand, xres)) {
+    printf("No auth info answer for IMSI %015" PRIu64 "\n", IMSI_BASE + idx);
+    return false;
+  }
+  return true;
+}
+
+// Checked after the timed loops, SQN recovery costs as much as the answer
+std::map<uint32_t, uint64_t> last_sqn;
+
+static bool check_sqns(std::vector<uint32_t> &idx, std::vector<answer_t> &answers) {
+  for (uint32_t i = 0; i < idx.size(); i++) {
+    uint64_t sqn = recover_sqn(idx[i], answers[i].rand, answers[i].autn);
+    std::map<uint32_t, uint64_t>::iterator it = last_sqn.find(idx[i]);
+    uint64_t last = (it == last_sqn.end()) ? SUBSCR_SQN - 1 : it->second;
+    if (sqn <= last) {
+      printf("SQN did not increase for IMSI %015" PRIu64 ": %" PRIu64 " after %" PRIu64 "\n", IMSI_BASE + idx[i], sqn, last);
+      return false;
+    }
+    last_sqn[idx[i]] = sqn;
+  }
+  return true;
+}
+
+static srsepc::hss* start_hss(srslte::log_filter *log, std::string db_file, uint32_t batch, uint64_t *startup_ns) {
+  srsepc::hss_args_t args;
+  args.auth_algo     = auth_algo;
+  args.db_file       = db_file;
+  args.mcc           = 0xF001;
+  args.mnc           = 0xFF01;
+  args.av_batch      = batch;
+  args.av_cache_size = nof_requests;
+
+  uint64_t t = now_ns();
+  srsepc::hss *hss = srsepc::hss::get_instance();
+  if (hss->init(&args, log)) {
+    return NULL;
+  }
+  *startup_ns = now_ns() - t;
+  if (hss->get_nof_users() != nof_users) {
+    printf("HSS has %" PRIu64 " users, expected %d\n", hss->get_nof_users(), nof_users);
+    return NULL;
+  }
+  return hss;
+}
+
+static void stop_hss(srsepc::hss *hss) {
+  hss->stop();
+  srsepc::hss::cleanup();
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+
+  srslte::logger_stdout logger;
+  srslte::log_filter log("HSS ", &logger);
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  for (int i = 0; i < 16; i++) {
+    sscanf(&SUBSCR_OP[2*i], "%2hhx", &op[i]);
+  }
+
+  std::string db_file = std::string(dir) + "/hss_bench_db.csv";
+  unlink((db_file + ".idx").c_str());
+  unlink((db_file + ".idx.journal").c_str());
+  if (!write_db(db_file)) {
+    exit(-1);
+  }
+
+  // Random, distinct subscribers
+  std::vector<uint32_t> idx(nof_requests);
+  std::vector<answer_t> answers(nof_requests);
+  uint64_t x = 1;
+  for (uint32_t i = 0; i < nof_requests; i++) {
+    x = x*6364136223846793005ULL + 1442695040888963407ULL;
+    idx[i] = (uint32_t) ((x >> 32) % nof_users);
+  }
+
+  // Index built from the CSV, auth vectors computed on request
+  uint64_t build_ns;
+  srsepc::hss *hss = start_hss(&log, db_file, 0, &build_ns);
+  if (hss == NULL) {
+    exit(-1);
+  }
+  uint64_t t = now_ns();
+  for (uint32_t i = 0; i < nof_requests; i++) {
+    if (!request(hss, idx[i], &answers[i])) {
+      exit(-1);
+    }
+  }
+  uint64_t computed_ns = now_ns() - t;
+  stop_hss(hss);
+  if (!check_sqns(idx, answers)) {
+    exit(-1);
+  }
+
+  // Index mapped as is, auth vectors precomputed. Warm the cache with one
+  // request per subscriber and wait for the batches
+  uint64_t map_ns;
+  hss = start_hss(&log, db_file, av_batch, &map_ns);
+  if (hss == NULL) {
+    exit(-1);
+  }
+  for (uint32_t i = 0; i < nof_requests; i++) {
+    if (!request(hss, idx[i], &answers[i])) {
+      exit(-1);
+    }
+  }
+  if (!check_sqns(idx, answers)) {
+    exit(-1);
+  }
+  srsepc::hss_av_metrics_t m;
+  uint64_t deadline = now_ns() + 60000000000ULL;
+  do {
+    usleep(1000);
+    hss->get_av_metrics(&m);
+  } while (m.batches + m.discarded < m.computed && now_ns() < deadline);
+
+  uint64_t nof_cached = m.cached;
+  t = now_ns();
+  for (uint32_t i = 0; i < nof_requests; i++) {
+    if (!request(hss, idx[i], &answers[i])) {
+      exit(-1);
+    }
+  }
+  uint64_t cached_ns = now_ns() - t;
+  hss->get_av_metrics(&m);
+  nof_cached = m.cached - nof_cached;
+  stop_hss(hss);
+  if (!check_sqns(idx, answers)) {
+    exit(-1);
+  }
+
+  printf("Users:                          %d\n", nof_users);
+  printf("Startup, building the index:    %.1f ms\n", (double) build_ns/1e6);
+  printf("Startup, mapping the index:     %.1f ms\n", (double) map_ns/1e6);
+  printf("Auth info answers, on request:  %.0f /s\n", (double) nof_requests*1e9/computed_ns);
+  printf("Auth info answers, precomputed: %.0f /s (%" PRIu64 " of %d precomputed)\n",
+         (double) nof_requests*1e9/cached_ns, nof_cached, nof_requests);
+
+  unlink(db_file.c_str());
+  unlink((db_file + ".idx").c_str());
+  unlink((db_file + ".idx.journal").c_str());
+
+  if (nof_cached == 0) {
+    printf("No precomputed auth vector was used\n");
+    exit(-1);
+  }
+  printf("Ok\n");
+  exit(0);
+}
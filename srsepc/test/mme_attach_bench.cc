@@ -0,0 +1,648 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/* Attach load generator for the MME. Every simulated eNB opens its own SCTP
+ * association, runs S1 setup and then keeps a window of UEs attaching at the
+ * same time, playing both the eNB S1AP and the UE NAS side of an IMSI attach:
+ * Attach Request, Authentication Response, Security Mode Complete, Initial
+ * Context Setup Response and Attach Complete. An attach is complete when the
+ * EMM Information is received. Reports attaches per second and attach latency
+ * percentiles. Needs a running srsepc whose HSS database holds the simulated
+ * subscribers, which can be written with -g.
+ */
+
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <poll.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <netinet/sctp.h>
+#include <vector>
+#include <algorithm>
+
+#include "srslte/common/common.h"
+#include "srslte/common/bcd_helpers.h"
+#include "srslte/common/security.h"
+#include "srslte/asn1/liblte_s1ap.h"
+#include "srslte/asn1/liblte_mme.h"
+
+#define MME_PORT      36412
+#define S1AP_PPID     18
+#define IMSI_BASE     1010000000000ULL  // 001010000000000
+#define SUBSCR_K      "00112233445566778899aabbccddeeff"
+#define SUBSCR_OP     "63bfa50ee6523365ff14c1f45f88737d"
+#define SUBSCR_AMF    "8000"
+#define SUBSCR_SQN    "000000001234"
+#define ENB_ID_BASE   0x19B
+#define TAC           7
+#define TIMEOUT_NS    5000000000ULL
+
+uint32_t nof_enbs    = 1;
+uint32_t nof_ues     = 64;
+uint32_t window      = 8;
+uint32_t nof_rounds  = 1;
+char    *mme_addr    = (char*) "127.0.1.100";
+char    *auth_algo   = (char*) "xor";
+char    *db_file     = NULL;
+uint16_t mcc         = 0xF001;
+uint16_t mnc         = 0xFF01;
+
+void usage(char *prog) {
+  printf("Usage: %s [euwrmag]\n", prog);
+  printf("\t-e number of eNBs, each with its own SCTP association [Default %d]\n", nof_enbs);
+  printf("\t-u number of UEs per eNB [Default %d]\n", nof_ues);
+  printf("\t-w maximum attaches in flight per eNB [Default %d]\n", window);
+  printf("\t-r number of times every UE attaches [Default %d]\n", nof_rounds);
+  printf("\t-m MME S1-MME address [Default %s]\n", mme_addr);
+  printf("\t-a authentication algorithm of the HSS, xor or milenage [Default %s]\n", auth_algo);
+  printf("\t-g write the HSS database for the simulated UEs to this file and exit\n");
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "euwrmag")) != -1) {
+    switch(opt) {
+    case 'e':
+      nof_enbs = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_ues = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'w':
+      window = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'r':
+      nof_rounds = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'm':
+      mme_addr = argv[optind];
+      break;
+    case 'a':
+      auth_algo = argv[optind];
+      break;
+    case 'g':
+      db_file = argv[optind];
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (nof_enbs == 0 || nof_ues == 0 || window == 0) {
+    printf("Number of eNBs, UEs and window must be at least 1\n");
+    exit(-1);
+  }
+  if (strcmp(auth_algo, "xor") && strcmp(auth_algo, "milenage")) {
+    printf("Unknown authentication algorithm %s\n", auth_algo);
+    exit(-1);
+  }
+}
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static void hex_to_bytes(const char *hex, uint8_t *out, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    unsigned int b;
+    sscanf(&hex[2*i], "%2x", &b);
+    out[i] = (uint8_t) b;
+  }
+}
+
+static uint64_t ue_imsi(uint32_t enb, uint32_t ue) {
+  return IMSI_BASE + (uint64_t) enb*nof_ues + ue + 1;
+}
+
+static int write_db(const char *file) {
+  FILE *f = fopen(file, "w");
+  if (f == NULL) {
+    printf("Could not open %s: %s\n", file, strerror(errno));
+    return -1;
+  }
+  for (uint32_t e = 0; e < nof_enbs; e++) {
+    for (uint32_t u = 0; u < nof_ues; u++) {
+      fprintf(f, "bench%d_%d,%015lu,%s,%s,%s,%s\n", e, u, ue_imsi(e, u), SUBSCR_K, SUBSCR_OP, SUBSCR_AMF, SUBSCR_SQN);
+    }
+  }
+  fclose(f);
+  printf("Wrote %d subscribers to %s\n", nof_enbs*nof_ues, file);
+  return 0;
+}
+
+/* State of one simulated UE. Identified towards the MME by its eNB UE S1AP ID,
+ * which is the UE index plus one. */
+typedef struct {
+  bool     busy;
+  uint32_t mme_ue_s1ap_id;
+  uint8_t  ebi;
+  uint8_t  k_nas_int[32];
+  uint64_t t_start;
+} ue_t;
+
+typedef struct {
+  uint32_t               id;
+  int                    fd;
+  struct sockaddr_in     mme;
+  std::vector<ue_t>      ues;
+  uint32_t               nof_started;
+  uint32_t               nof_done;
+  uint32_t               nof_failed;
+  std::vector<uint64_t>  latency;
+  LIBLTE_S1AP_TAI_STRUCT        tai;
+  LIBLTE_S1AP_EUTRAN_CGI_STRUCT cgi;
+  LIBLTE_S1AP_S1AP_PDU_STRUCT   pdu;
+} enb_t;
+
+pthread_barrier_t setup_barrier;
+pthread_barrier_t start_barrier;
+
+static bool send_pdu(enb_t *enb, LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu) {
+  srslte::byte_buffer_t msg;
+  if (liblte_s1ap_pack_s1ap_pdu(pdu, (LIBLTE_BYTE_MSG_STRUCT*) &msg) != LIBLTE_SUCCESS) {
+    printf("eNB %d: Failed to pack S1AP PDU\n", enb->id);
+    return false;
+  }
+  // A single stream keeps the messages of every UE in order
+  if (sctp_sendmsg(enb->fd, msg.msg, msg.N_bytes, (struct sockaddr*) &enb->mme, sizeof(enb->mme),
+                   htonl(S1AP_PPID), 0, 0, 0, 0) < 0) {
+    printf("eNB %d: Failed to send S1AP PDU: %s\n", enb->id, strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+static void build_plmn(uint8_t *buf) {
+  uint32_t plmn;
+  srslte::s1ap_mccmnc_to_plmn(mcc, mnc, &plmn);
+  uint32_t tmp32 = htonl(plmn);
+  buf[0] = ((uint8_t*)&tmp32)[1];
+  buf[1] = ((uint8_t*)&tmp32)[2];
+  buf[2] = ((uint8_t*)&tmp32)[3];
+}
+
+static bool setup_s1(enb_t *enb) {
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = &enb->pdu;
+  bzero(pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  init->procedureCode = LIBLTE_S1AP_PROC_ID_S1SETUP;
+  init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_S1SETUPREQUEST;
+
+  LIBLTE_S1AP_MESSAGE_S1SETUPREQUEST_STRUCT *s1setup = &init->choice.S1SetupRequest;
+  build_plmn(s1setup->Global_ENB_ID.pLMNidentity.buffer);
+  s1setup->Global_ENB_ID.eNB_ID.choice_type = LIBLTE_S1AP_ENB_ID_CHOICE_MACROENB_ID;
+  uint32_t tmp32 = htonl(ENB_ID_BASE + enb->id);
+  uint8_t  enb_id_bits[4*8];
+  liblte_unpack((uint8_t*) &tmp32, 4, enb_id_bits);
+  memcpy(s1setup->Global_ENB_ID.eNB_ID.choice.macroENB_ID.buffer,
+         &enb_id_bits[32-LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN], LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN);
+
+  s1setup->eNBname_present = true;
+  s1setup->eNBname.n_octets = snprintf((char*) s1setup->eNBname.buffer, sizeof(s1setup->eNBname.buffer),
+                                       "benchenb%d", enb->id);
+
+  s1setup->SupportedTAs.len = 1;
+  uint16_t tmp16 = htons(TAC);
+  memcpy(s1setup->SupportedTAs.buffer[0].tAC.buffer, (uint8_t*) &tmp16, 2);
+  s1setup->SupportedTAs.buffer[0].broadcastPLMNs.len = 1;
+  build_plmn(s1setup->SupportedTAs.buffer[0].broadcastPLMNs.buffer[0].buffer);
+  s1setup->DefaultPagingDRX.e = LIBLTE_S1AP_PAGINGDRX_V128;
+
+  // TAI and E-UTRAN CGI used in the UE associated messages
+  bzero(&enb->tai, sizeof(enb->tai));
+  build_plmn(enb->tai.pLMNidentity.buffer);
+  memcpy(enb->tai.tAC.buffer, (uint8_t*) &tmp16, 2);
+  bzero(&enb->cgi, sizeof(enb->cgi));
+  build_plmn(enb->cgi.pLMNidentity.buffer);
+  memcpy(enb->cgi.cell_ID.buffer, &enb_id_bits[32-LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN],
+         LIBLTE_S1AP_MACROENB_ID_BIT_STRING_LEN);
+
+  return send_pdu(enb, pdu);
+}
+
+static bool send_nas(enb_t *enb, uint32_t ue, srslte::byte_buffer_t *nas) {
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = &enb->pdu;
+  bzero(pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE;
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+
+  if (enb->ues[ue].mme_ue_s1ap_id == 0) {
+    init->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALUEMESSAGE;
+    init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALUEMESSAGE;
+    LIBLTE_S1AP_MESSAGE_INITIALUEMESSAGE_STRUCT *initue = &init->choice.InitialUEMessage;
+    initue->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue + 1;
+    memcpy(initue->NAS_PDU.buffer, nas->msg, nas->N_bytes);
+    initue->NAS_PDU.n_octets = nas->N_bytes;
+    memcpy(&initue->TAI, &enb->tai, sizeof(LIBLTE_S1AP_TAI_STRUCT));
+    memcpy(&initue->EUTRAN_CGI, &enb->cgi, sizeof(LIBLTE_S1AP_EUTRAN_CGI_STRUCT));
+    initue->RRC_Establishment_Cause.e = LIBLTE_S1AP_RRC_ESTABLISHMENT_CAUSE_MO_SIGNALLING;
+  } else {
+    init->procedureCode = LIBLTE_S1AP_PROC_ID_UPLINKNASTRANSPORT;
+    init->choice_type   = LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_UPLINKNASTRANSPORT;
+    LIBLTE_S1AP_MESSAGE_UPLINKNASTRANSPORT_STRUCT *ultx = &init->choice.UplinkNASTransport;
+    ultx->MME_UE_S1AP_ID.MME_UE_S1AP_ID = enb->ues[ue].mme_ue_s1ap_id;
+    ultx->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue + 1;
+    memcpy(ultx->NAS_PDU.buffer, nas->msg, nas->N_bytes);
+    ultx->NAS_PDU.n_octets = nas->N_bytes;
+    memcpy(&ultx->EUTRAN_CGI, &enb->cgi, sizeof(LIBLTE_S1AP_EUTRAN_CGI_STRUCT));
+    memcpy(&ultx->TAI, &enb->tai, sizeof(LIBLTE_S1AP_TAI_STRUCT));
+  }
+  return send_pdu(enb, pdu);
+}
+
+static bool send_attach_request(enb_t *enb, uint32_t ue) {
+  LIBLTE_MME_ATTACH_REQUEST_MSG_STRUCT           attach_req;
+  LIBLTE_MME_PDN_CONNECTIVITY_REQUEST_MSG_STRUCT pdn_con_req;
+  srslte::byte_buffer_t                          nas;
+
+  // The NAS structs hold LIBLTE_BYTE_MSG_STRUCTs and strings, so they are not cleared with bzero
+  attach_req.eps_attach_type = LIBLTE_MME_EPS_ATTACH_TYPE_EPS_ATTACH;
+  for (int i = 0; i < 8; i++) {
+    attach_req.ue_network_cap.eea[i] = (i == 0);  // EEA0
+    attach_req.ue_network_cap.eia[i] = (i == 1);  // 128-EIA1
+  }
+  attach_req.ue_network_cap.uea_present                     = false;
+  attach_req.ue_network_cap.uia_present                     = false;
+  attach_req.ue_network_cap.lpp_present                     = false;
+  attach_req.ue_network_cap.lcs_present                     = false;
+  attach_req.ue_network_cap.onexsrvcc_present               = false;
+  attach_req.ue_network_cap.nf_present                      = false;
+  attach_req.ms_network_cap_present                         = false;
+  attach_req.old_p_tmsi_signature_present                   = false;
+  attach_req.additional_guti_present                        = false;
+  attach_req.last_visited_registered_tai_present            = false;
+  attach_req.drx_param_present                              = false;
+  attach_req.old_lai_present                                = false;
+  attach_req.tmsi_status_present                            = false;
+  attach_req.ms_cm2_present                                 = false;
+  attach_req.ms_cm3_present                                 = false;
+  attach_req.supported_codecs_present                       = false;
+  attach_req.additional_update_type_present                 = false;
+  attach_req.voice_domain_pref_and_ue_usage_setting_present = false;
+  attach_req.device_properties_present                      = false;
+  attach_req.old_guti_type_present                          = false;
+  attach_req.nas_ksi.tsc_flag = LIBLTE_MME_TYPE_OF_SECURITY_CONTEXT_FLAG_NATIVE;
+  attach_req.nas_ksi.nas_ksi  = 7;  // No key available
+
+  attach_req.eps_mobile_id.type_of_id = LIBLTE_MME_EPS_MOBILE_ID_TYPE_IMSI;
+  uint64_t imsi = ue_imsi(enb->id, ue);
+  for (int i = 14; i >= 0; i--) {
+    attach_req.eps_mobile_id.imsi[i] = imsi % 10;
+    imsi /= 10;
+  }
+
+  pdn_con_req.eps_bearer_id                  = 0x00;
+  pdn_con_req.proc_transaction_id            = 0x01;
+  pdn_con_req.pdn_type                       = LIBLTE_MME_PDN_TYPE_IPV4;
+  pdn_con_req.request_type                   = LIBLTE_MME_REQUEST_TYPE_INITIAL_REQUEST;
+  pdn_con_req.esm_info_transfer_flag_present = false;
+  pdn_con_req.apn_present                    = false;
+  pdn_con_req.protocol_cnfg_opts_present     = false;
+  pdn_con_req.device_properties_present      = false;
+  liblte_mme_pack_pdn_connectivity_request_msg(&pdn_con_req, &attach_req.esm_msg);
+
+  liblte_mme_pack_attach_request_msg(&attach_req, (LIBLTE_BYTE_MSG_STRUCT*) &nas);
+  return send_nas(enb, ue, &nas);
+}
+
+static bool send_authentication_response(enb_t *enb, uint32_t ue, LIBLTE_MME_AUTHENTICATION_REQUEST_MSG_STRUCT *auth_req) {
+  uint8_t k[16], op[16];
+  uint8_t res[16], ck[16], ik[16], ak[6], sqn[6];
+  uint8_t k_asme[32], k_nas_enc[32];
+
+  hex_to_bytes(SUBSCR_K, k, 16);
+  hex_to_bytes(SUBSCR_OP, op, 16);
+  if (!strcmp(auth_algo, "milenage")) {
+    srslte::security_milenage_f2345(k, op, auth_req->rand, res, ck, ik, ak);
+  } else {
+    // 3GPP TS 34.108 Section 8
+    uint8_t xdout[16];
+    for (int i = 0; i < 16; i++) {
+      xdout[i] = k[i]^auth_req->rand[i];
+    }
+    for (int i = 0; i < 16; i++) {
+      res[i] = xdout[i];
+      ck[i]  = xdout[(i+1)%16];
+      ik[i]  = xdout[(i+2)%16];
+    }
+    for (int i = 0; i < 6; i++) {
+      ak[i] = xdout[i+3];
+    }
+  }
+  for (int i = 0; i < 6; i++) {
+    sqn[i] = auth_req->autn[i]^ak[i];
+  }
+  srslte::security_generate_k_asme(ck, ik, ak, sqn, mcc, mnc, k_asme);
+  srslte::security_generate_k_nas(k_asme, srslte::CIPHERING_ALGORITHM_ID_EEA0, srslte::INTEGRITY_ALGORITHM_ID_128_EIA1,
+                                  k_nas_enc, enb->ues[ue].k_nas_int);
+
+  LIBLTE_MME_AUTHENTICATION_RESPONSE_MSG_STRUCT auth_res;
+  srslte::byte_buffer_t                         nas;
+  memcpy(auth_res.res, res, 16);
+  liblte_mme_pack_authentication_response_msg(&auth_res, (LIBLTE_BYTE_MSG_STRUCT*) &nas);
+  return send_nas(enb, ue, &nas);
+}
+
+static void add_mac(enb_t *enb, uint32_t ue, uint32_t count, srslte::byte_buffer_t *nas) {
+  srslte::security_128_eia1(&enb->ues[ue].k_nas_int[16], count, 0, SECURITY_DIRECTION_UPLINK,
+                            &nas->msg[5], nas->N_bytes - 5, &nas->msg[1]);
+}
+
+static bool send_security_mode_complete(enb_t *enb, uint32_t ue) {
+  LIBLTE_MME_SECURITY_MODE_COMPLETE_MSG_STRUCT sm_comp;
+  srslte::byte_buffer_t                        nas;
+  sm_comp.imeisv_present = false;
+  liblte_mme_pack_security_mode_complete_msg(&sm_comp,
+                                             LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED_WITH_NEW_EPS_SECURITY_CONTEXT,
+                                             0, (LIBLTE_BYTE_MSG_STRUCT*) &nas);
+  add_mac(enb, ue, 0, &nas);
+  return send_nas(enb, ue, &nas);
+}
+
+static bool send_context_setup_response_and_attach_complete(enb_t *enb, uint32_t ue) {
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = &enb->pdu;
+  bzero(pdu, sizeof(LIBLTE_S1AP_S1AP_PDU_STRUCT));
+  pdu->choice_type = LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME;
+  LIBLTE_S1AP_SUCCESSFULOUTCOME_STRUCT *succ = &pdu->choice.successfulOutcome;
+  succ->procedureCode = LIBLTE_S1AP_PROC_ID_INITIALCONTEXTSETUP;
+  succ->choice_type   = LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_INITIALCONTEXTSETUPRESPONSE;
+
+  LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPRESPONSE_STRUCT *res = &succ->choice.InitialContextSetupResponse;
+  res->MME_UE_S1AP_ID.MME_UE_S1AP_ID = enb->ues[ue].mme_ue_s1ap_id;
+  res->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID = ue + 1;
+  res->E_RABSetupListCtxtSURes.len = 1;
+  LIBLTE_S1AP_E_RABSETUPITEMCTXTSURES_STRUCT *erab = &res->E_RABSetupListCtxtSURes.buffer[0];
+  erab->e_RAB_ID.E_RAB_ID = enb->ues[ue].ebi;
+  uint32_t enb_ip = enb->mme.sin_addr.s_addr;
+  liblte_unpack((uint8_t*) &enb_ip, 4, erab->transportLayerAddress.buffer);
+  erab->transportLayerAddress.n_bits = 32;
+  uint32_t teid = htonl((enb->id << 16) | (ue + 1));
+  memcpy(erab->gTP_TEID.buffer, &teid, 4);
+  if (!send_pdu(enb, pdu)) {
+    return false;
+  }
+
+  LIBLTE_MME_ACTIVATE_DEFAULT_EPS_BEARER_CONTEXT_ACCEPT_MSG_STRUCT act_accept;
+  LIBLTE_MME_ATTACH_COMPLETE_MSG_STRUCT                            attach_comp;
+  srslte::byte_buffer_t                                            nas;
+  act_accept.eps_bearer_id              = enb->ues[ue].ebi;
+  act_accept.proc_transaction_id        = 0x01;
+  act_accept.protocol_cnfg_opts_present = false;
+  liblte_mme_pack_activate_default_eps_bearer_context_accept_msg(&act_accept, &attach_comp.esm_msg);
+  liblte_mme_pack_attach_complete_msg(&attach_comp, LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED,
+                                      1, (LIBLTE_BYTE_MSG_STRUCT*) &nas);
+  add_mac(enb, ue, 1, &nas);
+  return send_nas(enb, ue, &nas);
+}
+
+static void finish_attach(enb_t *enb, uint32_t ue, bool ok) {
+  if (!enb->ues[ue].busy) {
+    return;
+  }
+  if (ok) {
+    enb->latency.push_back(now_ns() - enb->ues[ue].t_start);
+    enb->nof_done++;
+  } else {
+    enb->nof_failed++;
+  }
+  enb->ues[ue].busy = false;
+}
+
+static void handle_dl_nas(enb_t *enb, uint32_t ue, uint32_t mme_ue_s1ap_id, uint8_t *buf, uint32_t len) {
+  srslte::byte_buffer_t nas;
+  uint8_t               pd, msg_type;
+  memcpy(nas.msg, buf, len);
+  nas.N_bytes = len;
+  enb->ues[ue].mme_ue_s1ap_id = mme_ue_s1ap_id;
+  liblte_mme_parse_msg_header((LIBLTE_BYTE_MSG_STRUCT*) &nas, &pd, &msg_type);
+  switch (msg_type) {
+  case LIBLTE_MME_MSG_TYPE_AUTHENTICATION_REQUEST: {
+    LIBLTE_MME_AUTHENTICATION_REQUEST_MSG_STRUCT auth_req;
+    liblte_mme_unpack_authentication_request_msg((LIBLTE_BYTE_MSG_STRUCT*) &nas, &auth_req);
+    if (!send_authentication_response(enb, ue, &auth_req)) {
+      finish_attach(enb, ue, false);
+    }
+    break;
+  }
+  case LIBLTE_MME_MSG_TYPE_SECURITY_MODE_COMMAND:
+    if (!send_security_mode_complete(enb, ue)) {
+      finish_attach(enb, ue, false);
+    }
+    break;
+  case LIBLTE_MME_MSG_TYPE_EMM_INFORMATION:
+    finish_attach(enb, ue, true);
+    break;
+  default:
+    printf("eNB %d: Attach of UE %d failed with NAS message 0x%x\n", enb->id, ue, msg_type);
+    finish_attach(enb, ue, false);
+    break;
+  }
+}
+
+static bool handle_rx_pdu(enb_t *enb, srslte::byte_buffer_t *msg) {
+  LIBLTE_S1AP_S1AP_PDU_STRUCT *pdu = &enb->pdu;
+  if (liblte_s1ap_unpack_s1ap_pdu((LIBLTE_BYTE_MSG_STRUCT*) msg, pdu) != LIBLTE_SUCCESS) {
+    printf("eNB %d: Failed to unpack S1AP PDU\n", enb->id);
+    return false;
+  }
+
+  if (pdu->choice_type == LIBLTE_S1AP_S1AP_PDU_CHOICE_SUCCESSFULOUTCOME &&
+      pdu->choice.successfulOutcome.choice_type == LIBLTE_S1AP_SUCCESSFULOUTCOME_CHOICE_S1SETUPRESPONSE) {
+    return true;
+  }
+  if (pdu->choice_type != LIBLTE_S1AP_S1AP_PDU_CHOICE_INITIATINGMESSAGE) {
+    printf("eNB %d: Unexpected S1AP PDU type %d\n", enb->id, pdu->choice_type);
+    return false;
+  }
+
+  LIBLTE_S1AP_INITIATINGMESSAGE_STRUCT *init = &pdu->choice.initiatingMessage;
+  if (init->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_DOWNLINKNASTRANSPORT) {
+    LIBLTE_S1AP_MESSAGE_DOWNLINKNASTRANSPORT_STRUCT *dl = &init->choice.DownlinkNASTransport;
+    uint32_t ue = dl->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID - 1;
+    if (ue < nof_ues && enb->ues[ue].busy) {
+      handle_dl_nas(enb, ue, dl->MME_UE_S1AP_ID.MME_UE_S1AP_ID, dl->NAS_PDU.buffer, dl->NAS_PDU.n_octets);
+    }
+  } else if (init->choice_type == LIBLTE_S1AP_INITIATINGMESSAGE_CHOICE_INITIALCONTEXTSETUPREQUEST) {
+    LIBLTE_S1AP_MESSAGE_INITIALCONTEXTSETUPREQUEST_STRUCT *req = &init->choice.InitialContextSetupRequest;
+    uint32_t ue = req->eNB_UE_S1AP_ID.ENB_UE_S1AP_ID - 1;
+    if (ue < nof_ues && enb->ues[ue].busy) {
+      enb->ues[ue].ebi = req->E_RABToBeSetupListCtxtSUReq.buffer[0].e_RAB_ID.E_RAB_ID;
+      if (!send_context_setup_response_and_attach_complete(enb, ue)) {
+        finish_attach(enb, ue, false);
+      }
+    }
+  }
+  // UE Context Release Commands for the previous attach of a UE are ignored
+  return true;
+}
+
+/* Waits for one S1AP PDU. Returns false on timeout or socket error. */
+static bool recv_pdu(enb_t *enb, srslte::byte_buffer_t *msg, int timeout_ms) {
+  struct pollfd pfd;
+  pfd.fd     = enb->fd;
+  pfd.events = POLLIN;
+  if (poll(&pfd, 1, timeout_ms) <= 0) {
+    return false;
+  }
+  msg->reset();
+  int n = recv(enb->fd, msg->msg, SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET, 0);
+  if (n <= 0) {
+    printf("eNB %d: Error reading from SCTP socket: %s\n", enb->id, n < 0 ? strerror(errno) : "closed");
+    return false;
+  }
+  msg->N_bytes = n;
+  return true;
+}
+
+static void *enb_thread(void *arg) {
+  enb_t                 *enb = (enb_t*) arg;
+  srslte::byte_buffer_t *msg = new srslte::byte_buffer_t;
+  uint32_t               nof_attaches = nof_ues*nof_rounds;
+
+  bool ok = setup_s1(enb) && recv_pdu(enb, msg, 5000) && handle_rx_pdu(enb, msg);
+  if (!ok) {
+    printf("eNB %d: S1 setup failed\n", enb->id);
+  }
+  pthread_barrier_wait(&setup_barrier);
+  pthread_barrier_wait(&start_barrier);
+
+  while (ok && enb->nof_done + enb->nof_failed < nof_attaches) {
+    // Keep the window full. Attach i is made by UE i % nof_ues
+    while (enb->nof_started < nof_attaches &&
+           enb->nof_started - enb->nof_done - enb->nof_failed < window &&
+           !enb->ues[enb->nof_started % nof_ues].busy) {
+      uint32_t ue = enb->nof_started % nof_ues;
+      enb->ues[ue].busy           = true;
+      enb->ues[ue].mme_ue_s1ap_id = 0;
+      enb->ues[ue].t_start        = now_ns();
+      enb->nof_started++;
+      if (!send_attach_request(enb, ue)) {
+        finish_attach(enb, ue, false);
+      }
+    }
+
+    if (recv_pdu(enb, msg, 100)) {
+      handle_rx_pdu(enb, msg);
+    }
+
+    // Give up on attaches the MME did not complete
+    uint64_t now = now_ns();
+    for (uint32_t i = 0; i < nof_ues; i++) {
+      if (enb->ues[i].busy && now - enb->ues[i].t_start > TIMEOUT_NS) {
+        printf("eNB %d: Attach of UE %d timed out\n", enb->id, i);
+        finish_attach(enb, i, false);
+      }
+    }
+  }
+  delete msg;
+  return NULL;
+}
+
+static int connect_mme(enb_t *enb) {
+  enb->fd = socket(AF_INET, SOCK_STREAM, IPPROTO_SCTP);
+  if (enb->fd < 0) {
+    printf("Could not create SCTP socket: %s\n", strerror(errno));
+    return -1;
+  }
+  bzero(&enb->mme, sizeof(enb->mme));
+  enb->mme.sin_family = AF_INET;
+  enb->mme.sin_port   = htons(MME_PORT);
+  if (inet_pton(AF_INET, mme_addr, &enb->mme.sin_addr) != 1) {
+    printf("Invalid MME address %s\n", mme_addr);
+    return -1;
+  }
+  if (connect(enb->fd, (struct sockaddr*) &enb->mme, sizeof(enb->mme))) {
+    printf("Could not connect to MME %s:%d: %s\n", mme_addr, MME_PORT, strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+  if (db_file) {
+    exit(write_db(db_file));
+  }
+
+  std::vector<enb_t*> enbs(nof_enbs);
+  for (uint32_t i = 0; i < nof_enbs; i++) {
+    enbs[i] = new enb_t;
+    enbs[i]->id          = i;
+    enbs[i]->nof_started = 0;
+    enbs[i]->nof_done    = 0;
+    enbs[i]->nof_failed  = 0;
+    enbs[i]->ues.resize(nof_ues);
+    bzero(&enbs[i]->ues[0], nof_ues*sizeof(ue_t));
+    if (connect_mme(enbs[i])) {
+      exit(-1);
+    }
+  }
+
+  printf("MME attach load: %d eNBs, %d UEs per eNB, window %d, %d rounds, %s authentication\n",
+         nof_enbs, nof_ues, window, nof_rounds, auth_algo);
+
+  pthread_barrier_init(&setup_barrier, NULL, nof_enbs + 1);
+  pthread_barrier_init(&start_barrier, NULL, nof_enbs + 1);
+  std::vector<pthread_t> threads(nof_enbs);
+  for (uint32_t i = 0; i < nof_enbs; i++) {
+    pthread_create(&threads[i], NULL, enb_thread, enbs[i]);
+  }
+  pthread_barrier_wait(&setup_barrier);
+  uint64_t t_start = now_ns();
+  pthread_barrier_wait(&start_barrier);
+  for (uint32_t i = 0; i < nof_enbs; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  double secs = (now_ns() - t_start) * 1e-9;
+
+  std::vector<uint64_t> lat;
+  uint32_t nof_failed = 0;
+  for (uint32_t i = 0; i < nof_enbs; i++) {
+    lat.insert(lat.end(), enbs[i]->latency.begin(), enbs[i]->latency.end());
+    nof_failed += enbs[i]->nof_failed;
+    close(enbs[i]->fd);
+    delete enbs[i];
+  }
+  std::sort(lat.begin(), lat.end());
+
+  printf("Attaches: %d/%d completed (%d failed), %.1f attaches/s",
+         (int) lat.size(), nof_enbs*nof_ues*nof_rounds, nof_failed, lat.size()/secs);
+  if (lat.size() > 0) {
+    printf(", latency p50=%.2f ms, p90=%.2f ms, p99=%.2f ms, max=%.2f ms\n",
+           lat[lat.size()*50/100]*1e-6, lat[lat.size()*90/100]*1e-6,
+           lat[lat.size()*99/100]*1e-6, lat[lat.size()-1]*1e-6);
+  } else {
+    printf("\n");
+  }
+  exit(nof_failed == 0 && lat.size() > 0 ? 0 : -1);
+}
@@ -0,0 +1,375 @@
+/**
+ *
+ * \section COPYRIGHT
+ *
+ * Copyright 2013-2017 Software Radio Systems Limited
+ *
+ * \section LICENSE
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+/* Loopback benchmark of the SP-GW GTP-U data plane. A TUN device stands in for
+ * the SGi interface and a UDP socket for the eNB. Downlink packets are sent to
+ * UE addresses routed into the TUN device and received GTP-U encapsulated at
+ * the eNB socket. Uplink GTP-U packets are sent from the eNB socket and
+ * received decapsulated on a local UDP socket. Reports packets per second and
+ * one-way latency percentiles for both directions. Needs CAP_NET_ADMIN.
+ */
+
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <vector>
+#include <algorithm>
+
+#include "srsepc/hdr/spgw/gtpu_dp.h"
+#include "srsepc/hdr/spgw/spgw.h"
+#include "srslte/common/log_filter.h"
+#include "srslte/upper/gtpu.h"
+
+#define SGI_DEV       "srs_bench_sgi"
+#define SGI_ADDR      "172.16.99.1"
+#define UE_NET        0xAC106300  // 172.16.99.0/24
+#define ENB_ADDR      "127.0.0.2"
+#define UL_SINK_PORT  9001
+#define DL_DEST_PORT  9000
+#define TEID_OFFSET   0x100
+#define STALL_NS      100000000
+
+uint32_t nof_threads = 1;
+uint32_t nof_pkts    = 100000;
+uint32_t pkt_size    = 64;
+uint32_t nof_ues     = 16;
+uint32_t window      = 256;
+char    *spgw_addr   = (char*) "127.0.1.100";
+
+void usage(char *prog) {
+  printf("Usage: %s [tnsuwa]\n", prog);
+  printf("\t-t number of data plane threads [Default %d]\n", nof_threads);
+  printf("\t-n number of packets per direction [Default %d]\n", nof_pkts);
+  printf("\t-s UDP payload size [Default %d]\n", pkt_size);
+  printf("\t-u number of UEs [Default %d]\n", nof_ues);
+  printf("\t-w maximum packets in flight [Default %d]\n", window);
+  printf("\t-a S1-U bind address [Default %s]\n", spgw_addr);
+}
+
+void parse_args(int argc, char **argv) {
+  int opt;
+  while ((opt = getopt(argc, argv, "tnsuwa")) != -1) {
+    switch(opt) {
+    case 't':
+      nof_threads = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'n':
+      nof_pkts = (uint32_t) atoi(argv[optind]);
+      break;
+    case 's':
+      pkt_size = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'u':
+      nof_ues = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'w':
+      window = (uint32_t) atoi(argv[optind]);
+      break;
+    case 'a':
+      spgw_addr = argv[optind];
+      break;
+    default:
+      usage(argv[0]);
+      exit(-1);
+    }
+  }
+  if (pkt_size < sizeof(uint64_t) + sizeof(uint32_t)) {
+    pkt_size = sizeof(uint64_t) + sizeof(uint32_t);
+  }
+  if (nof_ues == 0 || nof_ues > 250) {
+    printf("Number of UEs must be between 1 and 250\n");
+    exit(-1);
+  }
+}
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static in_addr_t ue_addr(uint32_t ue) {
+  return htonl(UE_NET + 2 + ue);
+}
+
+/* Receiver side of one run. The payload of every packet starts with the
+ * transmission time and the packet index at a fixed offset. */
+typedef struct {
+  int                    fd;
+  uint32_t               offset;
+  volatile uint32_t      nof_rx;
+  volatile bool          done;
+  uint64_t               t_last;
+  std::vector<uint64_t>  latency;
+} rx_ctx_t;
+
+static void *rx_thread(void *arg) {
+  rx_ctx_t *ctx = (rx_ctx_t*) arg;
+  uint8_t buf[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+  while (!ctx->done) {
+    int n = recv(ctx->fd, buf, sizeof(buf), 0);
+    if (n < (int) (ctx->offset + sizeof(uint64_t))) {
+      continue;
+    }
+    uint64_t t_rx = now_ns();
+    uint64_t t_tx;
+    memcpy(&t_tx, &buf[ctx->offset], sizeof(uint64_t));
+    ctx->latency.push_back(t_rx - t_tx);
+    ctx->t_last = t_rx;
+    ctx->nof_rx++;
+  }
+  return NULL;
+}
+
+static uint16_t ip_checksum(uint8_t *hdr, uint32_t len) {
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < len; i += 2) {
+    sum += (hdr[i] << 8) | hdr[i+1];
+  }
+  while (sum >> 16) {
+    sum = (sum & 0xFFFF) + (sum >> 16);
+  }
+  return (uint16_t) ~sum;
+}
+
+/* Builds GTP-U(TEID) + IPv4 + UDP from the UE to the uplink sink. */
+static uint32_t build_ul_pkt(uint8_t *pkt, uint32_t ue, uint32_t payload_len) {
+  uint32_t ip_len = 20 + 8 + payload_len;
+
+  srslte::byte_buffer_t msg;
+  uint8_t *ip = msg.msg;
+  bzero(ip, 28);
+  ip[0] = 0x45;
+  ip[2] = ip_len >> 8;
+  ip[3] = ip_len & 0xFF;
+  ip[8] = 64;
+  ip[9] = IPPROTO_UDP;
+  in_addr_t src = ue_addr(ue);
+  in_addr_t dst = inet_addr(SGI_ADDR);
+  memcpy(&ip[12], &src, 4);
+  memcpy(&ip[16], &dst, 4);
+  uint16_t csum = ip_checksum(ip, 20);
+  ip[10] = csum >> 8;
+  ip[11] = csum & 0xFF;
+
+  uint8_t *udp = &ip[20];
+  udp[0] = DL_DEST_PORT >> 8;
+  udp[1] = DL_DEST_PORT & 0xFF;
+  udp[2] = UL_SINK_PORT >> 8;
+  udp[3] = UL_SINK_PORT & 0xFF;
+  udp[4] = (8 + payload_len) >> 8;
+  udp[5] = (8 + payload_len) & 0xFF;
+  msg.N_bytes = ip_len;
+
+  srslte::gtpu_header_t header;
+  header.flags        = 0x30;
+  header.message_type = 0xFF;
+  header.length       = msg.N_bytes;
+  header.teid         = TEID_OFFSET + ue;
+  srslte::gtpu_write_header(&header, &msg);
+  memcpy(pkt, msg.msg, msg.N_bytes);
+  return msg.N_bytes;
+}
+
+static int open_udp(const char *addr, uint16_t port) {
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in sa;
+  bzero(&sa, sizeof(sa));
+  sa.sin_family      = AF_INET;
+  sa.sin_addr.s_addr = inet_addr(addr);
+  sa.sin_port        = htons(port);
+  if (fd < 0 || bind(fd, (struct sockaddr*) &sa, sizeof(sa))) {
+    printf("Could not bind UDP socket to %s:%d: %s\n", addr, port, strerror(errno));
+    exit(-1);
+  }
+  // Wake up periodically so that the receiver can exit
+  struct timeval to = {0, 100000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &to, sizeof(to));
+  int rcvbuf = 4*1024*1024;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  return fd;
+}
+
+/* Sends nof_pkts packets keeping at most window packets in flight and prints
+ * the results. is_ul selects GTP-U from the eNB socket or plain UDP into the
+ * TUN device. */
+static void run(const char *name, bool is_ul, int tx_fd, int rx_fd) {
+  rx_ctx_t ctx;
+  ctx.fd     = rx_fd;
+  ctx.offset = is_ul ? 0 : GTPU_HEADER_LEN + 20 + 8;
+  ctx.nof_rx = 0;
+  ctx.done   = false;
+  ctx.t_last = 0;
+  ctx.latency.reserve(nof_pkts);
+
+  pthread_t rx;
+  pthread_create(&rx, NULL, rx_thread, &ctx);
+
+  uint8_t pkt[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+  uint8_t payload[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+  bzero(payload, sizeof(payload));
+
+  std::vector<uint8_t> ul_hdr[256];
+  uint32_t ul_hdr_len = 0;
+  if (is_ul) {
+    for (uint32_t i = 0; i < nof_ues; i++) {
+      ul_hdr[i].resize(SRSLTE_MAX_BUFFER_SIZE_BYTES);
+      ul_hdr_len = build_ul_pkt(&ul_hdr[i][0], i, pkt_size) - pkt_size;
+    }
+  }
+
+  struct sockaddr_in dst;
+  bzero(&dst, sizeof(dst));
+  dst.sin_family = AF_INET;
+
+  uint32_t nof_stalls = 0;
+  uint64_t t_start    = now_ns();
+  for (uint32_t i = 0; i < nof_pkts; i++) {
+    uint64_t t_wait = now_ns();
+    while (i - ctx.nof_rx >= window) {
+      if (now_ns() - t_wait > STALL_NS) {
+        nof_stalls++;
+        break;
+      }
+      sched_yield();
+    }
+
+    uint32_t ue  = i % nof_ues;
+    uint64_t t   = now_ns();
+    uint32_t len = 0;
+    memcpy(&payload[0], &t, sizeof(uint64_t));
+    memcpy(&payload[sizeof(uint64_t)], &i, sizeof(uint32_t));
+    if (is_ul) {
+      memcpy(pkt, &ul_hdr[ue][0], ul_hdr_len);
+      memcpy(&pkt[ul_hdr_len], payload, pkt_size);
+      len = ul_hdr_len + pkt_size;
+      dst.sin_addr.s_addr = inet_addr(spgw_addr);
+      dst.sin_port        = htons(srsepc::GTPU_RX_PORT);
+    } else {
+      memcpy(pkt, payload, pkt_size);
+      len = pkt_size;
+      dst.sin_addr.s_addr = ue_addr(ue);
+      dst.sin_port        = htons(DL_DEST_PORT);
+    }
+    if (sendto(tx_fd, pkt, len, 0, (struct sockaddr*) &dst, sizeof(dst)) < 0) {
+      printf("Error sending packet: %s\n", strerror(errno));
+      exit(-1);
+    }
+  }
+
+  // Wait for the tail
+  uint64_t t_wait = now_ns();
+  while (ctx.nof_rx < nof_pkts && now_ns() - t_wait < 10*STALL_NS) {
+    usleep(1000);
+  }
+  ctx.done = true;
+  pthread_join(rx, NULL);
+
+  std::vector<uint64_t> &lat = ctx.latency;
+  std::sort(lat.begin(), lat.end());
+  double secs = (ctx.t_last - t_start) * 1e-9;
+  printf("%s: %d/%d packets received (%d stalls), %.0f pps, %.1f Mbps",
+         name, (int) lat.size(), nof_pkts, nof_stalls,
+         lat.size() > 0 ? lat.size()/secs : 0.0, lat.size() > 0 ? lat.size()*pkt_size*8/secs/1e6 : 0.0);
+  if (lat.size() > 0) {
+    printf(", latency p50=%.1f us, p90=%.1f us, p99=%.1f us, max=%.1f us\n",
+           lat[lat.size()*50/100]*1e-3, lat[lat.size()*90/100]*1e-3,
+           lat[lat.size()*99/100]*1e-3, lat[lat.size()-1]*1e-3);
+  } else {
+    printf("\n");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  srslte::log_filter log("GTPU");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  int sgi_fds[srsepc::gtpu_dp::MAX_WORKERS];
+  int sgi_sock;
+  if (nof_threads == 0 || nof_threads > srsepc::gtpu_dp::MAX_WORKERS) {
+    printf("Number of threads must be between 1 and %d\n", srsepc::gtpu_dp::MAX_WORKERS);
+    exit(-1);
+  }
+  if (srsepc::gtpu_dp::init_sgi_if(SGI_DEV, SGI_ADDR, nof_threads, sgi_fds, &sgi_sock, &log)) {
+    printf("Could not create TUN device. Are you root?\n");
+    exit(-1);
+  }
+
+  srsepc::gtpu_tunnel_table tunnels;
+  srslte::gtpc_f_teid_ie enb_fteid;
+  enb_fteid.ipv4 = inet_addr(ENB_ADDR);
+  for (uint32_t i = 0; i < nof_ues; i++) {
+    enb_fteid.teid = TEID_OFFSET + i;
+    tunnels.add(ue_addr(i), enb_fteid);
+  }
+
+  struct sockaddr_in s1u_addr;
+  bzero(&s1u_addr, sizeof(s1u_addr));
+  s1u_addr.sin_family      = AF_INET;
+  s1u_addr.sin_addr.s_addr = inet_addr(spgw_addr);
+  s1u_addr.sin_port        = htons(srsepc::GTPU_RX_PORT);
+
+  srsepc::gtpu_dp dp;
+  if (dp.init(nof_threads, sgi_fds, &s1u_addr, &tunnels, &log)) {
+    printf("Could not initialize data plane\n");
+    exit(-1);
+  }
+  dp.start();
+
+  int enb_fd  = open_udp(ENB_ADDR, srsepc::GTPU_RX_PORT);
+  int sink_fd = open_udp(SGI_ADDR, UL_SINK_PORT);
+  int src_fd  = socket(AF_INET, SOCK_DGRAM, 0);
+
+  printf("GTP-U data plane: %d threads, %d UEs, %d byte payload, window %d\n",
+         nof_threads, nof_ues, pkt_size, window);
+  run("Downlink", false, src_fd, enb_fd);
+  run("Uplink  ", true, enb_fd, sink_fd);
+
+  srsepc::gtpu_dp_metrics_t m;
+  dp.get_metrics(&m);
+  printf("Data plane: UL %lu pkts, %lu dropped. DL %lu pkts, %lu dropped\n",
+         (unsigned long) m.ul_pkts, (unsigned long) m.ul_dropped,
+         (unsigned long) m.dl_pkts, (unsigned long) m.dl_dropped);
+
+  dp.stop();
+  close(enb_fd);
+  close(sink_fd);
+  close(src_fd);
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    close(sgi_fds[i]);
+  }
+  close(sgi_sock);
+  exit(0);
+}
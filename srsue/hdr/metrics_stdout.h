@@ -53,6 +53,8 @@ public:
   void stop() {};
 
 private:
+  void print_pipeline(phy_pipeline_metrics_t &m);
+
   std::string float_to_string(float f, int digits);
   std::string float_to_eng_string(float f, int digits);
   std::string int_to_eng_string(int f, int digits);
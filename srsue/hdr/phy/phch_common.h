@@ -38,6 +38,7 @@
 #include "srslte/radio/radio.h"
 #include "srslte/common/log.h"
 #include "phy_metrics.h"
+#include "srslte/common/phch_pipeline.h"
 
 
 namespace srsue {
@@ -55,12 +56,25 @@ public:
 class phch_common {
 public:
 
+  // Pipeline sections that must follow the TTI order
+  typedef enum {
+    SECTION_UL_GRANT = 0,
+    SECTION_TX,
+    NOF_SECTIONS
+  } section_t;
+
   /* Common variables used by all phy workers */
   phy_interface_rrc::phy_cfg_t *config;
   phy_args_t                   *args;
   rrc_interface_phy *rrc;
   mac_interface_phy *mac;
 
+  /* Threads decoding PDSCH code blocks in parallel for all workers */
+  srslte_fec_pool_t  fec_pool;
+
+  /* Orders the UL grant handling and the transmission of the workers */
+  srslte::phch_pipeline pipeline;
+
   /* Power control variables */
   float pathloss;
   float cur_pathloss;
@@ -90,7 +104,7 @@ public:
   uint8_t last_ri;
   uint8_t last_pmi;
 
-  phch_common(uint32_t max_mutex = 3);
+  phch_common();
   void init(phy_interface_rrc::phy_cfg_t *config,
             phy_args_t  *args,
             srslte::log *_log,
@@ -116,9 +130,9 @@ public:
   bool get_pending_ack(uint32_t tti, uint32_t *I_lowest, uint32_t *n_dmrs);
   bool is_any_pending_ack();
 
-  void worker_end(uint32_t tti, bool tx_enable, cf_t *buffer, uint32_t nof_samples, srslte_timestamp_t tx_time);
+  void worker_end(uint32_t sf_seq, bool tx_enable, cf_t *buffer, uint32_t nof_samples, srslte_timestamp_t tx_time);
 
-  void set_nof_mutex(uint32_t nof_mutex);
+  void stop();
 
   bool sr_enabled;
   int  sr_last_tx_tti;
@@ -139,8 +153,6 @@ public:
 
 private:
 
-  std::vector<pthread_mutex_t>    tx_mutex;
-
   bool               is_first_of_burst;
   srslte::radio      *radio_h;
   float              cfo;
@@ -166,11 +178,7 @@ private:
   } pending_ack_t;
   pending_ack_t pending_ack[TTIMOD_SZ];
 
-  bool            is_first_tx;
-
   uint32_t        nof_workers;
-  uint32_t        nof_mutex;
-  uint32_t        max_mutex;
 
   srslte_cell_t   cell;
 
@@ -82,8 +82,6 @@ public:
   void    get_current_cell(srslte_cell_t *cell, uint32_t *earfcn = NULL);
 
 
-  const static int MUTEX_X_WORKER = 4;
-
   double set_rx_gain(double gain);
   int radio_recv_fnc(cf_t *data[SRSLTE_MAX_PORTS], uint32_t nsamples, srslte_timestamp_t *rx_time);
   int scell_recv_fnc(cf_t *data[SRSLTE_MAX_PORTS], uint32_t nsamples, srslte_timestamp_t *rx_time);
@@ -233,6 +231,7 @@ private:
     void write(uint32_t tti, cf_t *data, uint32_t nsamples);
   private:
     void run_thread();
+    void end_window(bool aborted);
     const static int INTRA_FREQ_MEAS_PRIO      = DEFAULT_PRIORITY + 5;
 
     scell_recv         scell;
@@ -253,6 +252,8 @@ private:
     bool                running;
     bool                receive_enabled;
     bool                receiving;
+    volatile bool       window_pending;  // Set by write(), cleared by run_thread() once served
+    volatile bool       window_aborted;
     uint32_t            measure_tti;
     uint32_t            receive_cnt;
     srslte_ringbuffer_t ring_buffer;
@@ -326,8 +327,7 @@ private:
   uint32_t      tti;
   bool          do_agc;
   
-  uint32_t      nof_tx_mutex;
-  uint32_t      tx_mutex_cnt;
+  uint32_t      sf_seq;
 
   float         ul_dl_factor;
   uint32_t      current_earfcn;
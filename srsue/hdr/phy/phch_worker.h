@@ -51,7 +51,7 @@ public:
 
   /* Functions used by main PHY thread */
   cf_t* get_buffer(uint32_t antenna_idx);
-  void  set_tti(uint32_t tti, uint32_t tx_tti); 
+  void  set_tti(uint32_t tti, uint32_t sf_seq, struct timeval rx_end); 
   void  set_tx_time(srslte_timestamp_t tx_time, uint32_t next_offset);
   void  set_cfo(float cfo);
 
@@ -119,6 +119,7 @@ private:
   void setup_tx_gain();
   
   void update_measurements();
+  void stage_end(phy_stage_t stage);
   
   void tr_log_start();
   void tr_log_end();
@@ -138,7 +139,8 @@ private:
   bool           cell_initiated;
   cf_t          *signal_buffer[SRSLTE_MAX_PORTS]; 
   uint32_t       tti; 
-  uint32_t       tx_tti;
+  uint32_t       sf_seq;
+  struct timeval rx_end;
   bool           pregen_enabled;
   uint32_t       last_dl_pdcch_ncce;
   bool           rnti_is_set;
@@ -27,6 +27,8 @@
 #ifndef SRSUE_PHY_METRICS_H
 #define SRSUE_PHY_METRICS_H
 
+#include <stdint.h>
+#include "srslte/common/phch_pipeline.h"
 
 namespace srsue {
 
@@ -56,11 +58,29 @@ struct ul_metrics_t
   float mabr_mbps;
 };
 
+// PHY pipeline metrics. Finish times are measured from the end of the subframe reception
+
+typedef enum {
+  PHY_STAGE_DL_FFT = 0,  // OFDM demodulation, channel estimation and PDCCH LLR
+  PHY_STAGE_DL_DECODE,   // PDCCH search and PDSCH decoding
+  PHY_STAGE_UL_ENCODE,   // PHICH, UL grants and PUSCH/PUCCH/SRS encoding
+  PHY_STAGE_TX,          // Subframe handed to the radio
+  PHY_NOF_STAGES
+} phy_stage_t;
+
+typedef srslte::pipeline_stage_metrics_t phy_stage_metrics_t;
+
+struct phy_pipeline_metrics_t
+{
+  phy_stage_metrics_t stage[PHY_NOF_STAGES];
+};
+
 struct phy_metrics_t
 {
   sync_metrics_t sync;
   dl_metrics_t   dl;
   ul_metrics_t   ul;
+  phy_pipeline_metrics_t pipeline;
 };
 
 } // namespace srsue
@@ -101,6 +101,7 @@ typedef struct {
   int           all_hex_limit;
   int           file_max_size;
   std::string   filename;
+  std::string   mode;
 }log_args_t;
 
 typedef struct {
@@ -114,6 +115,8 @@ typedef struct {
   bool          pregenerate_signals;
   bool          metrics_csv_enable;
   std::string   metrics_csv_filename;
+  std::string   fftw_wisdom_file;
+  std::string   simd;
 }expert_args_t;
 
 typedef struct {
@@ -122,6 +122,7 @@ void parse_args(all_args_t *args, int argc, char *argv[]) {
 
     ("log.filename", bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"), "Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.mode",          bpo::value<string>(&args->log.mode)->default_value("file"), "Log writer: file, async (formatted by a background thread) or binary (decode with log_decoder)")
 
     ("usim.algo", bpo::value<string>(&args->usim.algo), "USIM authentication algorithm")
     ("usim.op", bpo::value<string>(&args->usim.op), "USIM operator variant")
@@ -159,6 +160,14 @@ void parse_args(all_args_t *args, int argc, char *argv[]) {
      bpo::value<bool>(&args->expert.pregenerate_signals)->default_value(false),
      "Pregenerate uplink signals after attach. Improves CPU performance.")
 
+    ("expert.fftw_wisdom_file",
+     bpo::value<string>(&args->expert.fftw_wisdom_file)->default_value(".fftw_wisdom"),
+     "FFTW wisdom file loaded at startup and saved at exit. Empty disables it.")
+
+    ("expert.simd",
+     bpo::value<string>(&args->expert.simd)->default_value(""),
+     "SIMD kernels: generic, sse, avx, avx2, avx512 or auto. Empty uses SRSLTE_SIMD or the CPU features")
+
     ("expert.rssi_sensor_enabled",
      bpo::value<bool>(&args->expert.phy.rssi_sensor_enabled)->default_value(false),
      "Enable or disable RF frontend RSSI sensor. In some USRP devices can cause segmentation fault")
@@ -199,6 +208,14 @@ void parse_args(all_args_t *args, int argc, char *argv[]) {
      bpo::value<int>(&args->expert.phy.nof_phy_threads)->default_value(2),
      "Number of PHY threads")
 
+    ("expert.nof_fec_threads",
+     bpo::value<uint32_t>(&args->expert.phy.nof_fec_threads)->default_value(0),
+     "Number of threads shared by the PHY threads to decode PDSCH code blocks in parallel. 0 decodes in the PHY thread")
+
+    ("expert.pipeline_budget_us",
+     bpo::value<uint32_t>(&args->expert.phy.pipeline_budget_us)->default_value(3000),
+     "Time from the end of a subframe reception to its transmission by which the PHY must be done")
+
     ("expert.equalizer_mode",
      bpo::value<string>(&args->expert.phy.equalizer_mode)->default_value("mmse"),
      "Equalizer mode")
@@ -106,7 +106,27 @@ void metrics_stdout::set_metrics(ue_metrics_t &metrics, const uint32_t period_us
   if(metrics.rf.rf_error) {
     printf("RF status: O=%d, U=%d, L=%d\n", metrics.rf.rf_o, metrics.rf.rf_u, metrics.rf.rf_l);
   }
-  
+
+  print_pipeline(metrics.phy.pipeline);
+}
+
+void metrics_stdout::print_pipeline(phy_pipeline_metrics_t &m)
+{
+  const char *stage_names[PHY_NOF_STAGES] = {"fft", "dl", "ul", "tx"};
+  uint32_t nof_late = 0;
+  for (int i=0;i<PHY_NOF_STAGES;i++) {
+    nof_late += m.stage[i].nof_late;
+  }
+  if (nof_late == 0) {
+    return;
+  }
+  printf("PHY late TTIs:");
+  for (int i=0;i<PHY_NOF_STAGES;i++) {
+    phy_stage_metrics_t *s = &m.stage[i];
+    printf(" %s=%d/%d (avg=%.0f max=%.0f budget=%d us)", stage_names[i], s->nof_late, s->nof_ttis,
+           s->avg_us, s->max_us, s->budget_us);
+  }
+  printf("\n");
 }
 
 std::string metrics_stdout::float_to_string(float f, int digits)
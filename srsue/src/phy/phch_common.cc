@@ -38,15 +38,16 @@ namespace srsue {
 
 cf_t zeros[50000];
 
-phch_common::phch_common(uint32_t max_mutex_) : tx_mutex(max_mutex_)
+// Share of the processing budget by which each stage of phy_stage_t has to end
+static const float stage_budget_share[PHY_NOF_STAGES] = {0.2, 0.7, 0.9, 1.0};
+
+phch_common::phch_common()
 {
   config    = NULL; 
   args      = NULL; 
   log_h     = NULL; 
   radio_h   = NULL; 
   mac       = NULL; 
-  max_mutex = max_mutex_;
-  nof_mutex = 0;
   rx_gain_offset = 0;
   last_ri = 0;
   last_pmi = 0;
@@ -61,6 +62,8 @@ phch_common::phch_common(uint32_t max_mutex_) : tx_mutex(max_mutex_)
   sync_metrics_read = true;
   sync_metrics_count = 0;
 
+  bzero(&fec_pool, sizeof(srslte_fec_pool_t));
+
   bzero(zeros, 50000*sizeof(cf_t));
 
   // FIXME: This is an ugly fix to avoid the TX filters to empty
@@ -81,17 +84,19 @@ void phch_common::init(phy_interface_rrc::phy_cfg_t *_config, phy_args_t *_args,
   mac       = _mac; 
   config    = _config;     
   args      = _args; 
-  is_first_tx = true; 
   sr_last_tx_tti = -1;
-  
-  for (uint32_t i=0;i<nof_mutex;i++) {
-    pthread_mutex_init(&tx_mutex[i], NULL);
+
+  pipeline.init(PHY_NOF_STAGES, stage_budget_share, NOF_SECTIONS, args->pipeline_budget_us);
+
+  if (args->nof_fec_threads) {
+    if (srslte_fec_pool_init(&fec_pool, args->nof_fec_threads)) {
+      log_h->console("Error initiating FEC pool with %d threads\n", args->nof_fec_threads);
+    }
   }
 }
 
-void phch_common::set_nof_mutex(uint32_t nof_mutex_) {
-  nof_mutex = nof_mutex_; 
-  assert(nof_mutex <= max_mutex);
+void phch_common::stop() {
+  pipeline.stop();
 }
 
 bool phch_common::ul_rnti_active(uint32_t tti) {
@@ -231,19 +236,17 @@ bool phch_common::is_any_pending_ack() {
  * that all processing is done and data is ready for transmission or there is no transmission at all (tx_enable). 
  * In that case, the end of burst message will be send to the radio 
  */
-void phch_common::worker_end(uint32_t tti, bool tx_enable, 
+void phch_common::worker_end(uint32_t sf_seq, bool tx_enable, 
                                    cf_t *buffer, uint32_t nof_samples, 
                                    srslte_timestamp_t tx_time) 
 {
 
   // Wait previous TTIs to be transmitted 
-  if (is_first_tx) {
-    is_first_tx = false; 
-  } else {
-    pthread_mutex_lock(&tx_mutex[tti%nof_mutex]);
+  if (!pipeline.enter(SECTION_TX, sf_seq)) {
+    return;
   }
 
-  radio_h->set_tti(tti); 
+  radio_h->set_tti(sf_seq); 
   if (tx_enable) {
     radio_h->tx_single(buffer, nof_samples, tx_time);
     is_first_of_burst = false; 
@@ -260,7 +263,7 @@ void phch_common::worker_end(uint32_t tti, bool tx_enable,
     }
   }
   // Trigger next transmission 
-  pthread_mutex_unlock(&tx_mutex[(tti+1)%nof_mutex]);
+  pipeline.leave(SECTION_TX, sf_seq);
 }    
 
 
@@ -333,7 +336,6 @@ void phch_common::get_sync_metrics(sync_metrics_t &m) {
 void phch_common::reset() {
   sr_enabled        = false;
   is_first_of_burst = true;
-  is_first_tx       = true;
   rar_grant_pending = false;
   pathloss = 0;
   cur_pathloss = 0;
@@ -356,13 +358,7 @@ void phch_common::reset() {
 void phch_common::reset_ul()
 {
   /*
-  is_first_tx = true;
   is_first_of_burst = true;
-
-  for (uint32_t i=0;i<nof_mutex;i++) {
-    pthread_mutex_trylock(&tx_mutex[i]);
-    pthread_mutex_unlock(&tx_mutex[i]);
-  }
   radio_h->tx_end();
    */
 }
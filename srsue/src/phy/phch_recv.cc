@@ -55,6 +55,7 @@ phch_recv::phch_recv() {
   bzero(&metrics, sizeof(sync_metrics_t));
   running = false;
   worker_com = NULL;
+  sf_seq = 0;
 }
 
 void phch_recv::init(srslte::radio_multi *_radio_handler, mac_interface_phy *_mac, rrc_interface_phy *_rrc,
@@ -81,9 +82,6 @@ void phch_recv::init(srslte::radio_multi *_radio_handler, mac_interface_phy *_ma
     return;
   }
 
-  nof_tx_mutex = MUTEX_X_WORKER * workers_pool->get_nof_workers();
-  worker_com->set_nof_mutex(nof_tx_mutex);
-
   // Initialize cell searcher
   search_p.init(sf_buffer, log_h, nof_rx_antennas, this);
 
@@ -126,7 +124,6 @@ void phch_recv::reset()
 {
   in_sync_cnt = 0;
   out_of_sync_cnt = 0;
-  tx_mutex_cnt = 0;
   phy_state = IDLE;
   time_adv_sec = 0;
   next_offset  = 0;
@@ -633,6 +630,9 @@ void phch_recv::run_thread()
 
           switch(srslte_ue_sync_zerocopy_multi(&ue_sync, buffer)) {
             case 1:
+              // Processing deadlines of the worker are measured from here
+              struct timeval rx_end;
+              gettimeofday(&rx_end, NULL);
 
               if (last_worker) {
                 Debug("SF: cfo_tot=%7.1f Hz, ref=%f Hz, pss=%f Hz, snr_sf=%.2f dB, rsrp=%.2f dB, noise=%.2f dB\n",
@@ -659,9 +659,10 @@ void phch_recv::run_thread()
               worker->set_tx_time(tx_time, next_offset);
               next_offset = 0;
 
-              Debug("SYNC:  Setting TTI=%d, tx_mutex=%d to worker %d\n", tti, tx_mutex_cnt, worker->get_id());
-              worker->set_tti(tti, tx_mutex_cnt);
-              tx_mutex_cnt = (tx_mutex_cnt+1) % nof_tx_mutex;
+              // Sequence numbers are never reset, workers of a previous camping may still be in the pipeline
+              Debug("SYNC:  Setting TTI=%d, sf_seq=%d to worker %d\n", tti, sf_seq, worker->get_id());
+              worker->set_tti(tti, sf_seq, rx_end);
+              sf_seq++;
 
               // Reset Uplink TX buffer to avoid mixing packets in TX queue
               /*
@@ -1434,6 +1435,9 @@ void phch_recv::intra_measure::init(phch_common *common, rrc_interface_phy *rrc,
   this->log_h  = log_h;
   this->common = common;
   receive_enabled = false;
+  receiving       = false;
+  window_pending  = false;
+  window_aborted  = false;
 
   // Start scell
   scell.init(log_h, common->args->sic_pss_enabled, common->args->intra_freq_meas_len_ms);
@@ -1470,9 +1474,6 @@ void phch_recv::intra_measure::set_primay_cell(uint32_t earfcn, srslte_cell_t ce
 void phch_recv::intra_measure::clear_cells() {
   active_pci.clear();
   receive_enabled = false;
-  receiving = false;
-  receive_cnt = 0;
-  srslte_ringbuffer_reset(&ring_buffer);
 }
 
 void phch_recv::intra_measure::add_cell(int pci) {
@@ -1508,24 +1509,38 @@ void phch_recv::intra_measure::rem_cell(int pci) {
   }
 }
 
+/* Hands the window to the measurement thread. An aborted window is discarded by that thread,
+ * since only the consumer of the ring buffer may drop its data. No new window starts until
+ * this one has been served, so the buffer holds one window at most.
+ */
+void phch_recv::intra_measure::end_window(bool aborted) {
+  receiving      = false;
+  window_aborted = aborted;
+  window_pending = true;
+  __sync_synchronize();
+  tti_sync.increase();
+}
+
 void phch_recv::intra_measure::write(uint32_t tti, cf_t *data, uint32_t nsamples) {
-  if (receive_enabled) {
-    if ((tti%common->args->intra_freq_meas_period_ms) == 0) {
-      receiving   = true;
-      receive_cnt = 0;
-      measure_tti = tti;
-      srslte_ringbuffer_reset(&ring_buffer);
+  if (!receive_enabled) {
+    if (receiving) {
+      end_window(true);
     }
-    if (receiving == true) {
-      if (srslte_ringbuffer_write(&ring_buffer, data, nsamples*sizeof(cf_t)) < (int) (nsamples*sizeof(cf_t))) {
-        Warning("Error writting to ringbuffer\n");
-        receiving = false;
-      } else {
-        receive_cnt++;
-        if (receive_cnt == common->args->intra_freq_meas_len_ms) {
-          tti_sync.increase();
-          receiving = false; 
-        }
+    return;
+  }
+  if ((tti%common->args->intra_freq_meas_period_ms) == 0 && !receiving && !window_pending) {
+    receiving   = true;
+    receive_cnt = 0;
+    measure_tti = tti;
+  }
+  if (receiving == true) {
+    if (srslte_ringbuffer_write(&ring_buffer, data, nsamples*sizeof(cf_t)) < (int) (nsamples*sizeof(cf_t))) {
+      Warning("Error writting to ringbuffer\n");
+      end_window(true);
+    } else {
+      receive_cnt++;
+      if (receive_cnt == common->args->intra_freq_meas_len_ms) {
+        end_window(false);
       }
     }
   }
@@ -1538,18 +1553,20 @@ void phch_recv::intra_measure::run_thread()
       tti_sync.wait();
     }
 
-    if (running) {
+    if (running && !window_aborted) {
 
       // Read data from buffer and find cells in it
       srslte_ringbuffer_read(&ring_buffer, search_buffer, common->args->intra_freq_meas_len_ms*current_sflen*sizeof(cf_t));
       int found_cells = scell.find_cells(search_buffer, common->rx_gain_offset, primary_cell, common->args->intra_freq_meas_len_ms, info);
-      receiving = false;
 
       for (int i=0;i<found_cells;i++) {
         rrc->new_phy_meas(info[i].rsrp, info[i].rsrq, measure_tti, current_earfcn, info[i].pci);
       }
       // Look for other cells not found automatically
     }
+    // Drops an aborted window or what a short read left. write() does not touch the buffer meanwhile
+    srslte_ringbuffer_reset(&ring_buffer);
+    window_pending = false;
   }
 }
 
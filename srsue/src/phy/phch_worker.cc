@@ -61,6 +61,8 @@ phch_worker::phch_worker() : tr_exec(10240)
   chest_loop = NULL;
 
   bzero(signal_buffer, sizeof(cf_t*)*SRSLTE_MAX_PORTS);
+  bzero(&rx_end, sizeof(rx_end));
+  sf_seq = 0;
 
   mem_initiated   = false;
   cell_initiated  = false; 
@@ -177,10 +179,11 @@ cf_t* phch_worker::get_buffer(uint32_t antenna_idx)
   return signal_buffer[antenna_idx]; 
 }
 
-void phch_worker::set_tti(uint32_t tti_, uint32_t tx_tti_)
+void phch_worker::set_tti(uint32_t tti_, uint32_t sf_seq_, struct timeval rx_end_)
 {
   tti    = tti_; 
-  tx_tti = tx_tti_;
+  sf_seq = sf_seq_;
+  rx_end = rx_end_;
   log_h->step(tti);
   log_phy_lib_h->step(tti);
 }
@@ -226,6 +229,7 @@ float phch_worker::get_cfo()
 void phch_worker::work_imp()
 {
   if (!cell_initiated) {
+    phy->pipeline.skip(sf_seq, phch_common::SECTION_UL_GRANT);
     return; 
   }
 
@@ -267,6 +271,7 @@ void phch_worker::work_imp()
   if (chest_loop && ((1<<(tti%10)) & phy->args->cfo_ref_mask)) {
     chest_loop->set_cfo(srslte_chest_dl_get_cfo(&ue_dl.chest));
   }
+  stage_end(PHY_STAGE_DL_FFT);
 
   if (chest_ok) {
 
@@ -311,7 +316,14 @@ void phch_worker::work_imp()
     rar_delivered = true;
     phy->mac->tb_decoded(dl_ack[0], 0, dl_mac_grant.rnti_type, dl_mac_grant.pid);
   }
-  
+  stage_end(PHY_STAGE_DL_DECODE);
+
+  // UL grants and HARQ feedback are passed to the MAC in TTI order
+  if (!phy->pipeline.enter(phch_common::SECTION_UL_GRANT, sf_seq)) {
+    pthread_mutex_unlock(&mutex);
+    return;
+  }
+
   // Decode PHICH 
   bool ul_ack = false;
   bool ul_ack_available = decode_phich(&ul_ack);
@@ -366,13 +378,17 @@ void phch_worker::work_imp()
     signal_ready = true; 
   } 
 
+  phy->pipeline.leave(phch_common::SECTION_UL_GRANT, sf_seq);
+  stage_end(PHY_STAGE_UL_ENCODE);
+
   tr_log_end();
 
   if (next_offset > 0) {
-    phy->worker_end(tx_tti, signal_ready, signal_buffer[0], SRSLTE_SF_LEN_PRB(cell.nof_prb)+next_offset, tx_time);
+    phy->worker_end(sf_seq, signal_ready, signal_buffer[0], SRSLTE_SF_LEN_PRB(cell.nof_prb)+next_offset, tx_time);
   } else {
-    phy->worker_end(tx_tti, signal_ready, &signal_buffer[0][-next_offset], SRSLTE_SF_LEN_PRB(cell.nof_prb)+next_offset, tx_time);
+    phy->worker_end(sf_seq, signal_ready, &signal_buffer[0][-next_offset], SRSLTE_SF_LEN_PRB(cell.nof_prb)+next_offset, tx_time);
   }
+  stage_end(PHY_STAGE_TX);
 
   if (!dl_action.generate_ack_callback) {
     if (dl_mac_grant.rnti_type == SRSLTE_RNTI_PCH && dl_action.decode_enabled[0]) {
@@ -412,6 +428,16 @@ void phch_worker::work_imp()
 #endif
 }
 
+void phch_worker::stage_end(phy_stage_t stage)
+{
+  const static char *stage_names[PHY_NOF_STAGES] = {"DL FFT", "DL decode", "UL encode", "TX"};
+  uint32_t finish_us = 0;
+  if (phy->pipeline.stage_end(stage, &rx_end, &finish_us)) {
+    Warning("TTI %d: %s finished %d us after RX, budget %d us\n",
+            tti, stage_names[stage], finish_us, phy->pipeline.get_budget_us(stage));
+  }
+}
+
 void phch_worker::compute_ri(uint8_t *ri, uint8_t *pmi, float *sinr) {
   if (phy->config->dedicated.antenna_info_explicit_value.tx_mode == LIBLTE_RRC_TRANSMISSION_MODE_3) {
     if (ue_dl.nof_rx_antennas > 1) {
@@ -677,6 +703,9 @@ int phch_worker::decode_pdsch(srslte_ra_dl_grant_t *grant, uint8_t *payload[SRSL
         if (phy->args->pdsch_max_its > 0) {
           srslte_pdsch_set_max_noi(&ue_dl.pdsch, phy->args->pdsch_max_its);
         }
+        if (srslte_fec_pool_nof_workers(&phy->fec_pool)) {
+          srslte_pdsch_set_fec_pool(&ue_dl.pdsch, &phy->fec_pool);
+        }
 
 
   #ifdef LOG_EXECTIME
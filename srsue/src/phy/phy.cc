@@ -51,8 +51,7 @@ using namespace std;
 namespace srsue {
 
 phy::phy() : workers_pool(MAX_WORKERS), 
-             workers(MAX_WORKERS), 
-             workers_common(phch_recv::MUTEX_X_WORKER*MAX_WORKERS)
+             workers(MAX_WORKERS)
 {
 }
 
@@ -93,6 +92,8 @@ void phy::set_default_args(phy_args_t *args)
   args->pdsch_max_its       = 4; 
   args->attach_enable_64qam = false; 
   args->nof_phy_threads     = DEFAULT_WORKERS;
+  args->nof_fec_threads     = 0;
+  args->pipeline_budget_us  = 0;
   args->equalizer_mode      = "mmse"; 
   args->cfo_integer_enabled = false; 
   args->cfo_correct_tol_hz  = 50; 
@@ -203,13 +204,16 @@ void phy::write_trace(std::string filename)
 void phy::stop()
 {  
   sf_recv.stop();
+  workers_common.stop();
   workers_pool.stop();
+  srslte_fec_pool_free(&workers_common.fec_pool);
 }
 
 void phy::get_metrics(phy_metrics_t &m) {
   workers_common.get_dl_metrics(m.dl);
   workers_common.get_ul_metrics(m.ul);
   workers_common.get_sync_metrics(m.sync);
+  workers_common.pipeline.get_metrics(m.pipeline.stage);
   int dl_tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(m.dl.mcs), workers_common.get_nof_prb());
   int ul_tbs = srslte_ra_tbs_from_idx(srslte_ra_tbs_idx_from_mcs(m.ul.mcs), workers_common.get_nof_prb());
   m.dl.mabr_mbps = dl_tbs/1000.0; // TBS is bits/ms - convert to mbps
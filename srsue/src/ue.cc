@@ -53,8 +53,28 @@ bool ue::init(all_args_t *args_)
 {
   args     = args_;
 
+  // Select the SIMD kernels before the PHY objects are created
+  if (!args->expert.simd.empty()) {
+    srslte_cpu_level_t simd_level;
+    if (srslte_cpu_level_parse(args->expert.simd.c_str(), &simd_level)) {
+      printf("Invalid SIMD level %s\n", args->expert.simd.c_str());
+      return false;
+    }
+    srslte_cpu_set_level(simd_level);
+  }
+  srslte_cpu_report(stdout);
+
+  // load FFTW wisdom before the PHY plans its DFTs
+  srslte_dft_set_wisdom_file(args->expert.fftw_wisdom_file.c_str());
+  srslte_dft_load();
+
   if (!args->log.filename.compare("stdout")) {
     logger = &logger_stdout;
+  } else if (!args->log.mode.compare("async") || !args->log.mode.compare("binary")) {
+    logger_binary.init(args->log.filename, !args->log.mode.compare("async"), args->log.file_max_size);
+    logger_binary.log("\n\n");
+    logger_binary.log(get_build_string().c_str());
+    logger = &logger_binary;
   } else {
     logger_file.init(args->log.filename, args->log.file_max_size);
     logger_file.log("\n\n");
@@ -269,6 +289,7 @@ void ue::stop()
       phy.write_trace(args->trace.phy_filename);
       radio.write_trace(args->trace.radio_filename);
     }
+    logger_binary.stop();
     started = false;
   }
 }
@@ -1012,18 +1012,17 @@ void rrc::send_con_request() {
 void rrc::send_con_restablish_request(LIBLTE_RRC_CON_REEST_REQ_CAUSE_ENUM cause, uint16_t crnti)
 {
   // Compute shortMAC-I
-  uint8_t varShortMAC[128], varShortMAC_packed[16];
-  bzero(varShortMAC, 128);
+  uint8_t varShortMAC_packed[16];
   bzero(varShortMAC_packed, 16);
-  uint8_t *msg_ptr = varShortMAC;
+  LIBLTE_BIT_CURSOR_STRUCT msg_ptr;
+  liblte_bit_cursor_init(&msg_ptr, varShortMAC_packed);
 
   // ASN.1 encode byte-aligned VarShortMAC-Input
   liblte_rrc_pack_cell_identity_ie(serving_cell->get_cell_id(), &msg_ptr);
-  msg_ptr = &varShortMAC[4];
+  msg_ptr.N_bits = 4;
   liblte_rrc_pack_phys_cell_id_ie(phy->get_current_pci(), &msg_ptr);
-  msg_ptr = &varShortMAC[4+2];
+  msg_ptr.N_bits = 4+2;
   liblte_rrc_pack_c_rnti_ie(crnti, &msg_ptr);
-  srslte_bit_pack_vector(varShortMAC, varShortMAC_packed, (4+2+4)*8);
 
   rrc_log->info("Generated varShortMAC: cellId=0x%x, PCI=%d, rnti=%d\n",
                 serving_cell->get_cell_id(), phy->get_current_pci(), crnti);
@@ -1687,11 +1686,9 @@ void rrc::write_pdu(uint32_t lcid, byte_buffer_t *pdu) {
 }
 
 void rrc::parse_dl_ccch(byte_buffer_t *pdu) {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-  bit_buf.N_bits = pdu->N_bytes * 8;
-  pool->deallocate(pdu);
   bzero(&dl_ccch_msg, sizeof(LIBLTE_RRC_DL_CCCH_MSG_STRUCT));
-  liblte_rrc_unpack_dl_ccch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dl_ccch_msg);
+  liblte_rrc_unpack_dl_ccch_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &dl_ccch_msg);
+  pool->deallocate(pdu);
 
   rrc_log->info("SRB0 - Received %s\n",
                 liblte_rrc_dl_ccch_msg_type_text[dl_ccch_msg.msg_type]);
@@ -1729,9 +1726,7 @@ void rrc::parse_dl_ccch(byte_buffer_t *pdu) {
 }
 
 void rrc::parse_dl_dcch(uint32_t lcid, byte_buffer_t *pdu) {
-  srslte_bit_unpack_vector(pdu->msg, bit_buf.msg, pdu->N_bytes * 8);
-  bit_buf.N_bits = pdu->N_bytes * 8;
-  liblte_rrc_unpack_dl_dcch_msg((LIBLTE_BIT_MSG_STRUCT *) &bit_buf, &dl_dcch_msg);
+  liblte_rrc_unpack_dl_dcch_msg((LIBLTE_BYTE_MSG_STRUCT *) pdu, &dl_dcch_msg);
 
   rrc_log->info("%s - Received %s\n",
                 get_rb_name(lcid).c_str(),